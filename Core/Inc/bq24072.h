@@ -20,6 +20,4 @@ bq24072_state_t bq24072_get_state(void);
 int bq24072_get_percent(void);
 int bq24072_get_percent_filtered(void);
 
-void bq24072_poll(void);
-
 #endif // BQ24072_H
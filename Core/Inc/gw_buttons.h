@@ -14,6 +14,39 @@
 #define B_PAUSE (1 << 8)
 #define B_POWER (1 << 9)
 
+#include <stdbool.h>
+
+/*
+ * buttons_get() reads the GPIOs right away. Everything else uses the state
+ * buttons_scan() keeps from the SysTick interrupt: once a button changes
+ * it's taken as is and further changes of it are ignored for
+ * BUTTONS_DEBOUNCE_MS, so there's no delay and no chatter. Each change is
+ * also queued as an event for whoever waits for one.
+ */
+
+#define BUTTONS_DEBOUNCE_MS 5
+#define BUTTONS_EVENT_COUNT 16
+
+typedef struct {
+    uint16_t buttons;   // All of them, after the change
+    uint16_t changed;
+} buttons_event_t;
+
 uint32_t buttons_get();
 
+// Starts the scanning, once the GPIOs are set up
+void buttons_init(void);
+// Every millisecond, from SysTick_Handler()
+void buttons_scan(void);
+
+// The debounced state, plus anything pressed since the last call that was
+// already released again, so a quick tap isn't missed. Drops the queued
+// events, the state has them.
+uint32_t buttons_get_state(void);
+
+bool buttons_pop_event(buttons_event_t *event);
+// Sleeps until there's an event to pop or the timeout, event may be NULL.
+// Only changes since the last buttons_get_state() wake it up.
+bool buttons_wait_event(buttons_event_t *event, uint32_t timeout_ms);
+
 #endif
\ No newline at end of file
@@ -20,16 +20,42 @@ bool OSPI_Erase(uint32_t *address, uint32_t *size);
 // Erases the area synchronously. Will block until it's done.
 void OSPI_EraseSync(uint32_t address, uint32_t size);
 
+// Estimated time in ms that erasing the area takes, UINT32_MAX if it isn't
+// aligned to the erase sizes. Sets counts to the number of erase commands of
+// each size (in the order of the erase sizes) if not NULL.
+uint32_t OSPI_EraseEstimate(uint32_t address, uint32_t size, uint32_t counts[4]);
+uint32_t OSPI_ChipEraseEstimate(void);
+
 void OSPI_PageProgram(uint32_t address, const uint8_t *buffer, size_t buffer_size);
 void OSPI_NOR_WriteEnable(void);
 void OSPI_Program(uint32_t address, const uint8_t *buffer, size_t buffer_size);
 
+// Queue an erase or program and return right away. The flash is polled by the
+// OCTOSPI and the next step is started from its interrupt. Memory-mapped mode
+// has to stay disabled and buffer valid until OSPI_AsyncBusy() returns false.
+// Returns false if the queue is full.
+bool OSPI_EraseAsync(uint32_t address, uint32_t size);
+bool OSPI_ProgramAsync(uint32_t address, const uint8_t *buffer, size_t buffer_size);
+bool OSPI_AsyncBusy(void);
+void OSPI_AsyncWait(void);
+
+// Suspends the erase or program in progress so that memory-mapped mode can
+// be enabled in between, except for reads from the area being erased or
+// programmed. Returns false if nothing is running or the chip doesn't
+// support suspend. Every successful suspend needs a OSPI_AsyncResume() with
+// memory-mapped mode disabled again.
+bool OSPI_AsyncSuspend(void);
+void OSPI_AsyncResume(void);
+
 void OSPI_ReadJedecId(uint8_t dest[3]);
 void OSPI_ReadSR(uint8_t dest[1]);
 void OSPI_ReadCR(uint8_t dest[1]);
 const char* OSPI_GetFlashName(void);
 uint32_t OSPI_GetSmallestEraseSize(void);
 
+// Size of the flash in bytes, 0 if the chip isn't known
+uint32_t OSPI_GetSize(void);
+
 void OSPI_Init(OSPI_HandleTypeDef *hospi);
 
 #endif
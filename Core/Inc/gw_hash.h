@@ -0,0 +1,14 @@
+#ifndef _GW_HASH_H_
+#define _GW_HASH_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+// SHA-256 as 64 hex digits and a NUL, computed by the HASH peripheral
+// when the chip has one, otherwise in software.
+void gw_sha256_to_string(uint8_t hash_str[65], const uint8_t *data, size_t len);
+
+// CRC-32 as computed by zlib, using the CRC peripheral.
+uint32_t gw_crc32(const uint8_t *data, size_t len);
+
+#endif
@@ -2,6 +2,7 @@
 #define _LCD_H_
 
 #include "stm32h7xx_hal.h"
+#include <stdbool.h>
 #include <stdint.h>
 
 #define GW_LCD_WIDTH  320
@@ -17,6 +18,11 @@ extern uint16_t framebuffer2[GW_LCD_WIDTH * GW_LCD_HEIGHT]  __attribute__((secti
 typedef uint16_t pixel_t;
 #endif // GW_LCD_MODE_LUT8
 
+#ifdef GW_LCD_TRIPLE_BUFFER
+// Optional third buffer, only fits in AHBRAM with 8-bit pixels
+extern uint8_t framebuffer3[GW_LCD_WIDTH * GW_LCD_HEIGHT]  __attribute__((section (".lcd3"))) __attribute__ ((aligned (16)));
+#endif
+
 
 // To be shared between NES and GB. NES is larger.
 extern uint8_t emulator_framebuffer[(256 + 8 + 8) * 240]  __attribute__((section (".emulator_data")));
@@ -24,23 +30,104 @@ extern uint8_t emulator_framebuffer[(256 + 8 + 8) * 240]  __attribute__((section
 
 // 0 => framebuffer1
 // 1 => framebuffer2
+// 2 => framebuffer3
 extern uint32_t active_framebuffer;
 
 
 void lcd_deinit(SPI_HandleTypeDef *spi);
 void lcd_init(SPI_HandleTypeDef *spi, LTDC_HandleTypeDef *ltdc);
+// Non-blocking lcd_init(): lcd_init_start() begins the power-up sequence and
+// lcd_init_poll() moves it along, returning true once it's complete.
+// lcd_init_finish() waits for the rest of it.
+void lcd_init_start(SPI_HandleTypeDef *spi, LTDC_HandleTypeDef *ltdc);
+bool lcd_init_poll(void);
+void lcd_init_finish(void);
 void lcd_backlight_set(uint8_t brightness);
 void lcd_backlight_on();
 void lcd_backlight_off();
 void lcd_swap(void);
+// Copies the active buffer into the others, returns when it's done
 void lcd_sync(void);
 void* lcd_get_active_buffer(void);
 void* lcd_get_inactive_buffer(void);
 void lcd_set_buffers(uint16_t *buf1, uint16_t *buf2);
 void lcd_wait_for_vblank(void);
+
+/*
+ * With LCD_BEAM_RACING there's only one framebuffer: frames are drawn into
+ * the one the LTDC scans out, and lcd_swap() only marks the end of one.
+ * lcd_beam_begin() is called before a frame is drawn. If the scanout is in
+ * the visible lines, it sleeps until the LTDC line event at the start of
+ * the vertical blanking. From there on the drawing stays ahead of the
+ * scanout, as long as a line is drawn faster than the LCD shows one, so
+ * the frame is on the LCD within this refresh instead of after it.
+ */
+#if LCD_BEAM_RACING
+void lcd_beam_begin(void);
+#else
+static inline void lcd_beam_begin(void) {}
+#endif
+
+/*
+ * With LCD_PACING the refresh of the LCD can be tuned to the frame rate of
+ * the emulated system, and the emulators pace their frames on it instead of
+ * on gw_timer, so every frame is shown for exactly one refresh.
+ *
+ * The LTDC runs at 59.64 Hz by default, from a 6 MHz pixel clock out of
+ * PLL3. The fractional divider of PLL3 can be changed while the LTDC runs
+ * and raises the pixel clock by up to 11%. Slower rates, e.g. 50 Hz, add
+ * lines to the vertical front porch first.
+ *
+ * lcd_set_refresh_rate() returns the rate that was set, in mHz, or 0 if the
+ * LCD can't run at that rate. 0 goes back to the default rate. While it's
+ * tuned a line interrupt at the start of the vertical blanking counts the
+ * refreshes. Not with LCD_BEAM_RACING, which takes that line interrupt.
+ */
+#if LCD_PACING
+uint32_t lcd_set_refresh_rate(uint32_t millihz);
+uint32_t lcd_get_refresh_count(void);
+#else
+static inline uint32_t lcd_set_refresh_rate(uint32_t millihz) { return 0; }
+static inline uint32_t lcd_get_refresh_count(void) { return 0; }
+#endif
+
 uint32_t is_lcd_swap_pending(void);
+// Incremented by every lcd_swap(), lets drawing code tell if a buffer was reused
+uint32_t lcd_get_swap_count(void);
+
+#ifdef GW_LCD_MODE_LUT8
+// Load the LTDC color lookup table, colors are 0x00RRGGBB.
+// Only the entries that changed are written to the hardware.
+void lcd_set_clut(const uint32_t *colors, uint32_t count);
+void lcd_set_clut_rgb565(const uint16_t *palette, uint32_t count);
+// The 256 colors as they were last loaded
+const uint32_t *lcd_get_clut(void);
+#endif
+
+// A whole framebuffer through the DMA2D, the CPU is free in the meantime.
+// They return once it's started: like for the blits of gw_blit.h,
+// gw_blit_wait() has to be called before the buffers are drawn into.
+// `value` is a RGB565 color, or a CLUT index with GW_LCD_MODE_LUT8.
+void lcd_fill_async(void *buffer, uint16_t value);
+void lcd_copy_async(void *dst, const void *src);
+// lcd_fill_async() of every framebuffer
+void lcd_clear_async(uint16_t value);
 
 // To be used by fault handlers
 void lcd_reset_active_buffer(void);
 
+// Second LTDC layer over the game, for the in-game overlays of common.c.
+// ARGB4444, blended in by the LTDC so the game framebuffers aren't drawn
+// on and nothing has to be redrawn when it's hidden again.
+#define LCD_OVERLAY_X 265
+#define LCD_OVERLAY_Y 10
+#define LCD_OVERLAY_W 39
+#define LCD_OVERLAY_H 128
+
+// The buffer that isn't shown, to draw the next overlay into
+uint16_t *lcd_overlay_get_buffer(void);
+// Shows a buffer, or hides the layer if NULL. Like the framebuffers, it
+// changes with the next lcd_swap().
+void lcd_overlay_show(uint16_t *buffer);
+
 #endif
@@ -6,16 +6,36 @@ extern uint8_t __SAVEFLASH_START__;
 extern uint8_t __SAVEFLASH_END__;
 extern uint8_t __EXTFLASH_START__;
 extern uint8_t __EXTFLASH_BASE__;
+extern uint8_t __EXTFLASH_OFFSET__;
+extern uint8_t __EXTFLASH_TOTAL_LENGTH__;
 extern uint32_t __INTFLASH__;  // From linker, usually value 0x08000000 for bank 1, or 0x08100000 for bank 2
 
 extern uint8_t __NULLPTR_LENGTH__;
 
 extern uint8_t _Stack_Redzone_Size;
 extern uint8_t _stack_redzone;
+extern uint8_t _stack_bottom;
+extern uint8_t _stack_top;
 
 extern uint8_t _heap_start;
 extern uint8_t _heap_end;
 
+// Per-emulator state in DTCM
+extern void * __dtcm_emu_start__[];
+extern uint8_t _DTCM_EMU_NES_SIZE;
+extern uint8_t _DTCM_EMU_GB_SIZE;
+extern uint8_t _DTCM_EMU_SMS_SIZE;
+extern uint8_t _DTCM_EMU_PCE_SIZE;
+extern uint8_t _DTCM_EMU_GW_SIZE;
+
+// Free RAM handed out by emu_arena.c
+extern uint8_t __dtc_padding_start__;
+extern uint8_t __dtc_padding_end__;
+extern uint8_t __RAM_CORE_START__;
+extern uint8_t __RAM_EMU_END__;
+extern uint8_t __ahbram_end__;
+extern uint8_t __AHBRAM_END__;
+
 
 extern uint32_t _siramdata;
 extern uint32_t __ram_exec_start__;
@@ -24,6 +44,19 @@ extern uint32_t __ram_exec_end__;
 extern uint32_t _sitcram_hot;
 extern uint32_t __itcram_hot_start__;
 extern uint32_t __itcram_hot_end__;
+
+// Per-emulator code copied after the ITCRAM HOT section
+extern void * __itcram_emu_start__[];
+extern void * _ITCRAM_NES_LOAD_START[];
+extern uint8_t _ITCRAM_NES_SIZE;
+extern void * _ITCRAM_GB_LOAD_START[];
+extern uint8_t _ITCRAM_GB_SIZE;
+extern void * _ITCRAM_SMS_LOAD_START[];
+extern uint8_t _ITCRAM_SMS_SIZE;
+extern void * _ITCRAM_PCE_LOAD_START[];
+extern uint8_t _ITCRAM_PCE_SIZE;
+extern void * _ITCRAM_GW_LOAD_START[];
+extern uint8_t _ITCRAM_GW_SIZE;
 extern uint8_t __configflash_start__;
 extern uint8_t __configflash_end__;
 extern uint8_t __fbflash_start__;
@@ -36,28 +69,29 @@ extern void * _OVERLAY_NES_LOAD_START[];
 extern uint8_t _OVERLAY_NES_SIZE;
 extern void * _OVERLAY_NES_BSS_START[];
 extern uint8_t _OVERLAY_NES_BSS_SIZE;
+extern void * _OVERLAY_NES_BSS_END[];
 extern void * _OVERLAY_GB_LOAD_START[];
 extern uint8_t _OVERLAY_GB_SIZE;
 extern void * _OVERLAY_GB_BSS_START[];
 extern uint8_t _OVERLAY_GB_BSS_SIZE;
+extern void * _OVERLAY_GB_BSS_END[];
 extern void * _OVERLAY_SMS_LOAD_START[];
 extern uint8_t _OVERLAY_SMS_SIZE;
 extern void * _OVERLAY_SMS_BSS_START[];
 extern uint8_t _OVERLAY_SMS_BSS_SIZE;
+extern void * _OVERLAY_SMS_BSS_END[];
 extern void * _OVERLAY_PCE_LOAD_START[];
 extern uint8_t _OVERLAY_PCE_SIZE;
 extern void * _OVERLAY_PCE_BSS_START[];
 extern uint8_t _OVERLAY_PCE_BSS_SIZE;
+extern void * _OVERLAY_PCE_BSS_END[];
 extern void * _OVERLAY_GW_LOAD_START[];
 extern uint8_t _OVERLAY_GW_SIZE;
 extern void * _OVERLAY_GW_BSS_START[];
 extern uint8_t _OVERLAY_GW_BSS_SIZE;
+extern void * _OVERLAY_GW_BSS_END[];
 
-extern uint8_t *_NES_ROM_UNPACK_BUFFER;
-extern uint8_t _NES_ROM_UNPACK_BUFFER_SIZE;
 
 extern uint8_t *_GB_ROM_UNPACK_BUFFER;
 extern uint8_t _GB_ROM_UNPACK_BUFFER_SIZE;
 
-extern uint8_t *_PCE_ROM_UNPACK_BUFFER;
-extern uint8_t _PCE_ROM_UNPACK_BUFFER_SIZE;
@@ -0,0 +1,33 @@
+#ifndef _GW_TIMER_H_
+#define _GW_TIMER_H_
+
+#include <stdint.h>
+
+#include "stm32h7xx_hal.h"
+
+/*
+ * High resolution time.
+ *
+ * gw_timer_us() counts microseconds from the SysTick, which keeps running
+ * while the CPU sleeps in __WFI(). Use it for wall clock time: frame pacing,
+ * busy and sleep time.
+ *
+ * gw_timer_cycles() is the DWT cycle counter. It's cheaper to read and
+ * exact, but stops while the CPU sleeps, so only use it to measure code.
+ *
+ * Both wrap around (after about 71 minutes and 15 seconds), only use
+ * differences.
+ */
+
+void gw_timer_init(void);
+
+uint32_t gw_timer_us(void);
+
+static inline uint32_t gw_timer_cycles(void)
+{
+    return DWT->CYCCNT;
+}
+
+uint32_t gw_timer_cycles_to_us(uint32_t cycles);
+
+#endif
@@ -0,0 +1,31 @@
+#ifndef _BOOT_TRACE_H_
+#define _BOOT_TRACE_H_
+
+#include <stdint.h>
+
+/*
+ * Timestamps of the phases of booting and of starting a game.
+ *
+ * boot_trace() notes the time a phase ended, in microseconds since the
+ * SysTick was started by HAL_Init(). The DWT cycle counter would be finer,
+ * but it stops in __WFI() and counts a different clock before
+ * SystemClock_Config(). Noting a phase only stores the time and the name,
+ * so it doesn't add to what it measures.
+ *
+ * Once the first frame is shown the whole trace is printed to the log, and
+ * tools/logpoll.py --boot-trace reads the table from a running target.
+ */
+
+#define BOOT_TRACE_MAX 32
+
+typedef struct {
+    const char *name;
+    uint32_t us;
+} boot_trace_entry_t;
+
+void boot_trace(const char *name);
+
+// Called by lcd_swap(), ends the trace and prints it
+void boot_trace_frame_shown(void);
+
+#endif
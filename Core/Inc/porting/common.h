@@ -34,18 +34,166 @@ extern int16_t audiobuffer_dma[AUDIO_BUFFER_LENGTH * 2] __attribute__((section (
 
 extern const uint8_t volume_tbl[ODROID_AUDIO_VOLUME_MAX + 1];
 
+/**
+ * Audio ring buffer with rate control, see odroid_audio.c. Emulators write
+ * mono samples at full scale and at the rate passed to odroid_audio_init(),
+ * the resampler takes care of any difference to the SAI rate. Volume and mute
+ * are applied on the way out.
+ *
+ * `frame` is the number of samples the emulator writes per video frame, it's
+ * split into smaller DMA periods depending on the audio latency setting.
+ */
+void odroid_audio_ring_start(uint32_t frame);
+// Rate the SAI actually runs at, the closest one to what was asked for
+uint32_t odroid_audio_sample_rate(void);
+// Returns how many of the samples fit
+uint32_t odroid_audio_ring_write(const int16_t *samples, uint32_t count);
+// Same for 1-bit audio, zero samples play levels[0] and any other levels[1]
+uint32_t odroid_audio_ring_write_levels(const uint8_t *samples, uint32_t count, const int16_t levels[2]);
+// Emulation speed in 16.16, set from common_emu_frame_loop()
+void odroid_audio_ring_set_speed(uint32_t speed_16_16);
+// Called from the SAI DMA half and full transfer interrupts
+void odroid_audio_ring_dma_done(void);
+
+// Audio glitches since the ring was started
+typedef struct {
+    uint32_t underruns;     // DMA periods that ran out of samples
+    uint32_t overruns;      // Writes that didn't fit into the ring
+    uint32_t late;          // Writes with less than a period left to play
+    uint32_t fill;          // Samples in the ring right now
+} odroid_audio_stats_t;
+
+odroid_audio_stats_t odroid_audio_get_stats(void);
+
+// DMA periods of a frame, a quarter of a frame and an eighth of a frame
+typedef enum {
+    ODROID_AUDIO_LATENCY_NORMAL = 0,
+    ODROID_AUDIO_LATENCY_LOW,
+    ODROID_AUDIO_LATENCY_LOWEST,
+    ODROID_AUDIO_LATENCY_COUNT
+} odroid_audio_latency_t;
+
+// Stored in the settings, and applied right away if the ring is running
+void odroid_audio_set_latency(int latency);
+int odroid_audio_get_latency(void);
+
+int32_t odroid_settings_AudioLatency_get();
+void odroid_settings_AudioLatency_set(int32_t value);
+
+// Restarts the DMA with an empty ring, e.g. after it was stopped to sleep
+void odroid_audio_ring_restart(void);
+// Stops the DMA until the next odroid_audio_ring_start()
+void odroid_audio_ring_stop(void);
+
+// What powering off does, see odroid_system_sleep()
+typedef enum {
+    ODROID_SLEEP_STANDBY = 0,   // Off, the game is loaded from its save state again
+    ODROID_SLEEP_SUSPEND,       // STOP mode, the game goes on where it was
+    ODROID_SLEEP_COUNT
+} odroid_sleep_mode_t;
+
+int32_t odroid_settings_SleepMode_get();
+void odroid_settings_SleepMode_set(int32_t value);
+
+// Favorites of the launcher, see rg_favorites.c for the meaning of the ids
+#define FAVORITES_MAX 32
+uint32_t odroid_settings_Favorites_get(const uint32_t **ids);
+void odroid_settings_Favorites_set(const uint32_t *ids, uint32_t count);
+
+// odroid_settings_commit() once the launcher was idle for a while, so that a
+// series of changes is written at once. See odroid_settings.c
+void odroid_settings_commit_later();
+void odroid_settings_idle();
+
+// Recently played games of the launcher, see rg_recent.c
+#define RECENT_MAX 8
+uint32_t odroid_settings_Recent_get(const uint32_t **ids);
+void odroid_settings_Recent_set(const uint32_t *ids, uint32_t count);
+
+// For the running game only, the settings keep the app's mode. See game_profile.h
+void odroid_display_override_scaling_mode(odroid_display_scaling_t mode);
+void odroid_display_override_filter_mode(odroid_display_filter_t mode);
+
+// odroid_display_write_rect() with the DMA2D, without waiting for it. The
+// buffer must stay as it is until odroid_display_write_flush(), which has to
+// be called before the CPU touches the frame again
+void odroid_display_write_rect_async(short left, short top, short width, short height, short stride, const uint16_t* buffer);
+void odroid_display_write_flush(void);
+
+// Shown at the end of the debug menu, in addition to the common entries
+void odroid_overlay_set_debug_options(odroid_dialog_choice_t *extra_options);
+
+// Drawn after every dialog box with where the box is, NULL for none
+typedef void (*odroid_overlay_decoration_t)(int box_x, int box_y, int box_width, int box_height);
+void odroid_overlay_set_dialog_decoration(odroid_overlay_decoration_t decoration);
+
+/**
+ * Fast-forward, one past the speedups of emu_speedup_t. The emulator runs as
+ * fast as it can and only a frame every FAST_FORWARD_DISPLAY_US is drawn,
+ * the rest are skipped. Audio is muted, the resampler follows the measured
+ * speed so the ring neither overflows nor runs dry.
+ */
+#define SPEEDUP_UNLOCKED SPEEDUP_MAX
+#define FAST_FORWARD_DISPLAY_US (1000000 / 30)
+
+/**
+ * Once per frame, returns false if the frame is skipped. A skipped frame is
+ * still emulated, with its audio, only the pixels aren't made or blitted:
+ *  - NES: drawframe, the PPU keeps the sprite 0 hit and overflow flags
+ *  - GB: emu_run(false), the LCD modes and STAT interrupts still run
+ *  - SMS/GG: system_frame(1), the VDP still raises its line interrupts
+ *  - G&W: the segments aren't drawn, the CPU doesn't see them anyway
+ * PCE has no such mode in its core, gfx_run() renders every line. Only the
+ * blit is skipped there.
+ */
 bool common_emu_frame_loop(void);
+// Most frames skipped in a row, 0 never skips
+void common_emu_set_frame_skip_max(uint8_t frames);
+
+/**
+ * Waits until it's time to emulate the next frame, one more when the frame
+ * loop wants to slow down. Frames are paced on the system tick, the audio
+ * resampler makes up for the difference with the SAI clock.
+ */
+void common_emu_sync(void);
 void common_emu_input_loop(odroid_gamepad_state_t *joystick, odroid_dialog_choice_t *game_options);
 
+/**
+ * Reads the buttons again while a frame is emulated, for the moment the game
+ * reads its joypad register instead of the start of the frame. If they
+ * changed since common_emu_input_loop(), the callback set by the emulator
+ * gets them to update the emulated pad.
+ *
+ * Only PCE calls it, from its scanline loop. The joypad registers of GB and
+ * NES are read in their cores, in the retro-go-stm32 submodule, which don't
+ * call it, so their pads only change once per frame.
+ *
+ * Cheap enough to call on every read of the register. Does nothing while
+ * PAUSE or POWER is held, the frame loop handles those, and while an input
+ * replay is recorded or played, which only works per frame.
+ */
+typedef void (*common_emu_pad_cb_t)(const odroid_gamepad_state_t *joystick);
+void common_emu_input_set_late_poll(common_emu_pad_cb_t cb);
+void common_emu_input_late_poll(void);
+
+/*
+ * Back to the state of a fresh boot, from the launcher before the next
+ * game: a core that never sets its frame time mustn't run at the rate of
+ * the previous one, nor start with its frame costs and skip limit.
+ */
+void common_emu_reset(void);
+
+// In microseconds, see gw_timer_us()
 typedef struct {
     uint last_busy;
-    uint busy_ms;
-    uint sleep_ms;
+    uint busy_us;
+    uint sleep_us;
 } cpumon_stats_t;
 extern cpumon_stats_t cpumon_stats;
 
 /**
- * Just calls `__WFI()` and measures time spent sleeping.
+ * Just calls `__WFI()` and measures time spent sleeping, or runs a step of a
+ * pending store_save_async() instead.
  */
 void cpumon_sleep(void);
 void cpumon_busy(void);
@@ -0,0 +1,49 @@
+#ifndef _CPU_CLOCK_H_
+#define _CPU_CLOCK_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Runs the CPU only as fast as the emulator needs.
+ *
+ * SystemClock_Config() starts PLL1 at 280 MHz, which a Game & Watch or
+ * most GB games need a fraction of. Each level below lowers PLL1 and the
+ * core voltage with it. Only the CPU, the buses and the timers on them
+ * change speed: the SAI runs from PLL2, the LTDC from PLL3 and the OSPI
+ * and SPI from the HSI, so audio, the display and the flash don't notice.
+ *
+ * In CPU_CLOCK_AUTO common_emu_frame_loop() feeds cpu_clock_governor()
+ * with the busy time of cpumon_stats. It goes up a level as soon as a frame
+ * is late, and down one once a whole window of frames would still have
+ * fit at the lower level with some headroom. Anything that doesn't go
+ * through the frame loop (menus, saving, the launcher) runs at whatever
+ * level the game left, cpu_clock_reset() goes back to full speed.
+ */
+
+typedef enum {
+    CPU_CLOCK_280MHZ,
+    CPU_CLOCK_220MHZ,
+    CPU_CLOCK_160MHZ,
+    CPU_CLOCK_88MHZ,
+    CPU_CLOCK_LEVEL_COUNT,
+    // Not a level, lets the governor pick one
+    CPU_CLOCK_AUTO = CPU_CLOCK_LEVEL_COUNT,
+} cpu_clock_level_t;
+
+// Reprograms PLL1, the voltage scale and the flash wait states. SysTick
+// and TIM1 are retimed, gw_timer_us() loses the time the switch took.
+void cpu_clock_set_level(cpu_clock_level_t level);
+cpu_clock_level_t cpu_clock_get_level(void);
+uint32_t cpu_clock_get_mhz(void);
+
+// A level, or CPU_CLOCK_AUTO. Set from the debug menu.
+void cpu_clock_set_mode(cpu_clock_level_t mode);
+cpu_clock_level_t cpu_clock_get_mode(void);
+
+// Once per frame, returns true if the level changed
+bool cpu_clock_governor(uint32_t busy_us, uint32_t period_us, bool late);
+// Back to full speed (or the fixed level), e.g. before a menu
+void cpu_clock_reset(void);
+
+#endif
@@ -0,0 +1,62 @@
+#ifndef _EMU_ARENA_H_
+#define _EMU_ARENA_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/*
+ * Per-emulator allocation of the RAM that isn't taken by the linker.
+ *
+ * Only one app runs until the next reset, so each region is a bump
+ * allocator (see rg_arena.h) set up at boot for the launcher and reset by
+ * emulator_start():
+ *  - DTCM: the padding between the heap and the stack, zero wait states.
+ *    For the hottest state of a core.
+ *  - RAM_EMU: from the end of the running overlay's BSS, e.g. ROM buffers.
+ *    Reachable by every DMA.
+ *  - AHBRAM: what's left after the audio buffers, slowest of the three.
+ *
+ * An allocation that doesn't fit in its region falls back to the next one
+ * in that order. scripts/size.sh prints how much each region has free.
+ *
+ * rg_alloc() takes its MEM_FAST and MEM_DMA blocks from here.
+ */
+
+typedef enum {
+    EMU_ARENA_DTCM,
+    EMU_ARENA_RAM_EMU,
+    EMU_ARENA_AHBRAM,
+    EMU_ARENA_COUNT,
+} emu_arena_region_t;
+
+// Resets every region, ram_emu_free is the end of the overlay's BSS
+void emu_arena_init(void *ram_emu_free);
+// RAM_EMU ends at start from the next emu_arena_init() on, what's above is
+// left alone, e.g. a ROM loaded by ram_loader.h
+void emu_arena_reserve_top(void *start);
+
+// Asserts if the block doesn't fit anywhere, align must be a power of 2
+void *emu_arena_alloc(emu_arena_region_t region, size_t size, size_t align);
+// Same, but returns NULL
+void *emu_arena_try_alloc(emu_arena_region_t region, size_t size, size_t align);
+bool emu_arena_contains(const void *ptr);
+
+// Everything left in the region, e.g. to unpack a ROM of unknown size
+void *emu_arena_alloc_rest(emu_arena_region_t region, size_t align, size_t *size);
+
+// Buffers that are only needed for a while, e.g. to load a ROM, can be
+// given back: everything allocated in the region since the mark is freed
+uint32_t emu_arena_mark(emu_arena_region_t region);
+void emu_arena_release(emu_arena_region_t region, uint32_t mark);
+
+// What's left in the region, without the fallback to the next one
+size_t emu_arena_free(emu_arena_region_t region);
+
+// The peak is the most that was ever allocated at once since emu_arena_init(),
+// blocks of emu_arena_alloc_rest() only count with what was kept of them
+void emu_arena_usage(emu_arena_region_t region, size_t *used, size_t *peak, size_t *size);
+
+void emu_arena_print(void);
+
+#endif
@@ -0,0 +1,58 @@
+#ifndef _EMU_SNAPSHOT_H_
+#define _EMU_SNAPSHOT_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Snapshots of the emulator state in RAM, for run-ahead, rewind and the
+ * like. Unlike a save state they never go to the flash and are only valid
+ * until the emulator exits, so pointers in them don't need fixing up.
+ *
+ * A core either lists the blocks its state lives in, which are copied as
+ * they are, or has its own serializer. Each emulator sets up its core with
+ * emu_snapshot_init() before the first frame.
+ *
+ * emu_snapshot_update() is for a buffer that holds an older snapshot: only
+ * the EMU_SNAPSHOT_PAGE_SIZE pages that changed are written, and marked in
+ * a bitmap, so e.g. a delta against the older snapshot only has to look at
+ * those. Serialized cores are written whole and marked all dirty.
+ */
+
+#define EMU_SNAPSHOT_PAGE_SIZE 256
+#define EMU_SNAPSHOT_MAX_PAGES 1024
+
+typedef struct {
+    void *ptr;
+    uint32_t len;       // 0 ends the list
+} emu_snapshot_block_t;
+
+typedef struct {
+    const emu_snapshot_block_t *blocks;
+    // Before a block is restored from src, e.g. to compare it with what it
+    // holds now, and after all of them, e.g. to redo the memory map
+    void (*restoring)(const emu_snapshot_block_t *block, const uint8_t *src);
+    void (*restored)(void);
+
+    // Or the core's own serializer, returns the size used, 0 if it didn't fit
+    size_t (*save)(uint8_t *buffer, size_t size);
+    void (*load)(const uint8_t *buffer, size_t size);
+    // Upper bound of what save() returns, 0 if only trying tells
+    size_t size;
+} emu_snapshot_core_t;
+
+void emu_snapshot_init(const emu_snapshot_core_t *core);
+
+// The size of a snapshot, 0 if it isn't known before taking one
+size_t emu_snapshot_size(void);
+
+// All return the size used, 0 if it didn't fit
+size_t emu_snapshot_save(uint8_t *buffer, size_t size);
+size_t emu_snapshot_update(uint8_t *buffer, size_t size);
+void emu_snapshot_load(const uint8_t *buffer, size_t size);
+
+// Of the last emu_snapshot_update()
+bool emu_snapshot_page_dirty(uint32_t page);
+
+#endif
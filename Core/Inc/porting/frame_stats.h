@@ -0,0 +1,60 @@
+#ifndef _FRAME_STATS_H_
+#define _FRAME_STATS_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Frame times of the running emulator, the stutters averages hide.
+ *
+ * common_emu_frame_loop() records the time since the previous frame into a
+ * window of the last FRAME_STATS_WINDOW frames. Anything that might make a
+ * frame late tags it with frame_stats_tag(), so the longest stall comes
+ * with its cause. Frames that included a menu aren't stutters and are left
+ * out, only counted.
+ *
+ * The window is shown in the debug menu and read over SWD by
+ * tools/logpoll.py --frame-stats.
+ */
+
+#define FRAME_STATS_WINDOW 256
+
+// Frame time in 10 us, up to 655 ms
+#define FRAME_STATS_UNIT_US 10
+
+typedef enum {
+    FRAME_TAG_SKIPPED = 1 << 0,     // Emulated but not drawn
+    FRAME_TAG_OVERLAY = 1 << 1,     // Volume, brightness etc drawn over it
+    FRAME_TAG_FLASH   = 1 << 2,     // Waited for a flash erase or write
+    FRAME_TAG_MENU    = 1 << 3,     // A menu or dialog was open
+} frame_tag_t;
+
+typedef struct {
+    uint16_t times[FRAME_STATS_WINDOW];
+    uint8_t tags[FRAME_STATS_WINDOW];
+    uint32_t count;                 // Frames recorded, the last at [(count - 1) % WINDOW]
+    uint32_t period_us;             // What a frame should take
+    uint32_t late;                  // Frames over 1.25 periods, since the game started
+    uint32_t menu_frames;
+    uint32_t longest_us;
+    uint8_t longest_tags;
+} frame_stats_t;
+
+extern frame_stats_t frame_stats;
+
+typedef struct {
+    uint32_t p50_us;
+    uint32_t p95_us;
+    uint32_t p99_us;
+    uint32_t late;                  // In the window
+} frame_stats_summary_t;
+
+// Once per frame, with the period frames are paced at
+void frame_stats_frame(uint32_t period_us);
+void frame_stats_tag(frame_tag_t tag);
+
+frame_stats_summary_t frame_stats_summary(void);
+// Of the most telling tag
+const char *frame_stats_tag_name(uint8_t tags);
+
+#endif
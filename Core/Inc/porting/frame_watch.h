@@ -0,0 +1,45 @@
+#ifndef _FRAME_WATCH_H_
+#define _FRAME_WATCH_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * What the CPU was doing when a frame ran long, enabled with FRAME_WATCH=1.
+ *
+ * common_emu_frame_loop() arms compare channel 2 of TIM1 once per frame,
+ * FRAME_WATCH_FACTOR frame periods ahead. If the next frame hasn't started
+ * by then, the interrupt logs the interrupted PC and LR and the innermost
+ * profiler scope with LOG_DEFER(), and the next frame logs how long it
+ * really took. tools/logpoll.py prints them, addr2line on the ELF turns the
+ * addresses into code. Only the first time the frame runs over is logged.
+ *
+ * The menus and sleep disarm it, they're long on purpose.
+ *
+ * With FRAME_WATCH=0 all of this compiles to nothing.
+ */
+
+#define FRAME_WATCH_FACTOR 2
+
+#if FRAME_WATCH
+
+// Once TIM1 runs, see bq24072_init()
+void frame_watch_init(void);
+
+void frame_watch_arm(uint32_t period_us);
+void frame_watch_disarm(void);
+
+// From the TIM1 compare interrupt with its exception frame, false if
+// channel 2 didn't raise it
+bool frame_watch_irq(const uint32_t *frame);
+
+#else
+
+static inline void frame_watch_init(void) {}
+
+static inline void frame_watch_arm(uint32_t period_us) {}
+static inline void frame_watch_disarm(void) {}
+
+#endif
+
+#endif
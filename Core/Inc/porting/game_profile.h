@@ -0,0 +1,44 @@
+#ifndef _GAME_PROFILE_H_
+#define _GAME_PROFILE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Per-game settings, on top of the per-app ones of odroid_settings.c.
+ *
+ * odroid_system_emu_init() looks the game up by the CRC32 parse_roms.py
+ * computed for it, first in what was learned on the device and then in the
+ * table of game_profile.c that comes with the firmware. Nothing it applies
+ * is saved as the app's setting, other games of the same system keep theirs.
+ *
+ * What is learned: common_emu_frame_loop() calls game_profile_frame() for
+ * every frame. A game that keeps skipping frames at the highest clock with
+ * the display filter on gets the filter turned off, which is remembered in
+ * the settings for the next time it's started.
+ */
+
+// The app's setting is kept
+#define GAME_PROFILE_KEEP 0xff
+
+#define GAME_PROFILE_LEARNED_MAX 16
+
+typedef struct {
+    uint32_t crc;
+    uint8_t cpu_clock;      // cpu_clock_level_t, or CPU_CLOCK_AUTO
+    uint8_t frame_skip;     // Most frames skipped in a row
+    uint8_t scaling;        // odroid_display_scaling_t
+    uint8_t filter;         // odroid_display_filter_t
+} game_profile_t;
+
+// crc 0 is an unknown game, nothing is applied
+void game_profile_apply(uint32_t crc);
+
+// Once per frame while the game runs
+void game_profile_frame(bool skipped);
+
+// Stored in the settings, newest first
+uint32_t odroid_settings_GameProfiles_get(const game_profile_t **profiles);
+void odroid_settings_GameProfiles_set(const game_profile_t *profiles, uint32_t count);
+
+#endif
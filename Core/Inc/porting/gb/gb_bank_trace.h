@@ -0,0 +1,49 @@
+#ifndef _GB_BANK_TRACE_H_
+#define _GB_BANK_TRACE_H_
+
+#include <stdint.h>
+
+/*
+ * Instrumentation for the GB bank swap cache, enabled with GB_BANK_TRACE=1.
+ *
+ * The swap cache calls gb_bank_trace_hit() when a switched-in bank is
+ * already unpacked and gb_bank_trace_miss() after it had to decompress one.
+ * gb_bank_trace_dump() prints one "<bank> <accesses>" line per bank to the
+ * log (see tools/logpoll.py), which is what parse_roms.py reads from
+ * <rom>.banks to pick the banks left uncompressed.
+ *
+ * With GB_BANK_TRACE=0 all of this compiles to nothing.
+ */
+
+#define GB_BANK_TRACE_MAX_BANKS 512
+
+typedef struct {
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t miss_us;   // Time spent decompressing banks
+} gb_bank_trace_stats_t;
+
+#if GB_BANK_TRACE
+
+void gb_bank_trace_hit(uint32_t bank);
+void gb_bank_trace_miss(uint32_t bank, uint32_t decompress_us);
+
+void gb_bank_trace_reset(void);
+gb_bank_trace_stats_t gb_bank_trace_get_stats(void);
+void gb_bank_trace_dump(void);
+
+#else
+
+static inline void gb_bank_trace_hit(uint32_t bank) {}
+static inline void gb_bank_trace_miss(uint32_t bank, uint32_t decompress_us) {}
+
+static inline void gb_bank_trace_reset(void) {}
+static inline gb_bank_trace_stats_t gb_bank_trace_get_stats(void)
+{
+    return (gb_bank_trace_stats_t) {0};
+}
+static inline void gb_bank_trace_dump(void) {}
+
+#endif
+
+#endif
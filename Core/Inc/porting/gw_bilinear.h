@@ -0,0 +1,22 @@
+#ifndef _GW_BILINEAR_H_
+#define _GW_BILINEAR_H_
+
+#include <stdint.h>
+
+/*
+ * Bilinear RGB565 scaler for the fixed emulator to LCD ratios. The source
+ * positions and weights of every output column and line are computed once
+ * by gw_bilinear_setup(), so scaling a frame is integer only.
+ *
+ * Only the output lines that blend a changed source line are redrawn, the
+ * caller must have called gw_dirty_begin() for the source frame.
+ */
+
+// Cheap to call every frame, the tables are only rebuilt when the sizes change
+void gw_bilinear_setup(uint32_t src_width, uint32_t src_height,
+                       uint32_t dst_width, uint32_t dst_height);
+
+void gw_bilinear_rgb565(const uint16_t *src, uint32_t src_stride,
+                        uint16_t *dst, uint32_t dst_stride);
+
+#endif
@@ -0,0 +1,58 @@
+#ifndef _GW_BLIT_H_
+#define _GW_BLIT_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * Blit engine shared by the emulator ports, backed by the Chrom-ART (DMA2D)
+ * accelerator. DMA2D can do L8 -> RGB565 palette lookups, RGB565 copies and
+ * solid fills in hardware, but it can't scale. Ports use it for the 1:1
+ * parts of a frame (unscaled modes and borders) and keep the fractional
+ * scalers on the CPU.
+ *
+ * All functions take strides in pixels. A blit is started asynchronously;
+ * gw_blit_wait() must be called before the CPU touches the destination or
+ * overwrites the source. Starting a new blit waits for the previous one.
+ *
+ * A port can pipeline a frame by calling gw_blit_swap_when_done() after the
+ * last blit and go on emulating the next frame into another buffer. The LCD
+ * buffers are swapped from the DMA2D interrupt, so gw_blit_wait() must also
+ * be called before lcd_get_active_buffer() is used again.
+ */
+
+void gw_blit_init(void);
+
+// Load a RGB565 palette into the DMA2D foreground CLUT.
+// Only reloads the hardware CLUT when the palette actually changed.
+void gw_blit_set_clut_rgb565(const uint16_t *palette, uint32_t count);
+
+void gw_blit_l8_to_rgb565(const uint8_t *src, uint32_t src_stride,
+                          uint16_t *dst, uint32_t dst_stride,
+                          uint32_t width, uint32_t height);
+
+void gw_blit_copy_rgb565(const uint16_t *src, uint32_t src_stride,
+                         uint16_t *dst, uint32_t dst_stride,
+                         uint32_t width, uint32_t height);
+
+void gw_blit_fill_rgb565(uint16_t *dst, uint32_t dst_stride,
+                         uint32_t width, uint32_t height, uint16_t color);
+
+// Fill everything in the destination outside of the given rectangle
+void gw_blit_fill_border_rgb565(uint16_t *dst, uint32_t dst_stride,
+                                uint32_t dst_width, uint32_t dst_height,
+                                uint32_t x, uint32_t y, uint32_t width, uint32_t height,
+                                uint16_t color);
+
+// The DMA2D can't reach the TCMs, e.g. buffers on the stack
+bool gw_blit_can_read(const void *addr);
+
+bool gw_blit_busy(void);
+void gw_blit_wait(void);
+
+// Call lcd_swap() as soon as the blit in progress is done
+void gw_blit_swap_when_done(void);
+
+void gw_blit_irq_handler(void);
+
+#endif
@@ -0,0 +1,39 @@
+#ifndef _GW_DIRTY_H_
+#define _GW_DIRTY_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * Per-scanline change tracking between the emulator frame and the LCD
+ * buffers. Every source line is hashed once per frame and compared with the
+ * hash of the line that was last drawn into the active LCD buffer, so that
+ * the blitters only redraw lines that changed since that buffer was shown.
+ *
+ * The key passed to gw_dirty_begin() identifies everything besides the
+ * source pixels that ends up in the output (blitter, scaling mode, palette).
+ * A different key redraws the whole frame.
+ *
+ * Anything else that draws into the LCD buffers (overlays, menus, DMA2D
+ * blits of the whole frame) must call gw_dirty_invalidate().
+ */
+
+#define GW_DIRTY_MAX_LINES 256
+
+uint32_t gw_dirty_hash(const void *data, uint32_t bytes, uint32_t seed);
+
+// Returns the number of lines that need to be redrawn
+uint32_t gw_dirty_begin(const void *src, uint32_t stride, uint32_t line_bytes,
+                        uint32_t lines, uint32_t key);
+
+bool gw_dirty_any(void);
+bool gw_dirty_line(uint32_t line);
+
+// True if any of the lines in [first, first + count) changed. Use it for
+// blitters that interpolate between neighbouring source lines.
+bool gw_dirty_lines(uint32_t first, uint32_t count);
+
+// Redraw everything into all of the LCD buffers
+void gw_dirty_invalidate(void);
+
+#endif
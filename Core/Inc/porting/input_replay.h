@@ -0,0 +1,72 @@
+#ifndef _INPUT_REPLAY_H_
+#define _INPUT_REPLAY_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "odroid_input.h"
+
+/*
+ * Records the buttons an emulator sees each frame and plays them back,
+ * enabled with INPUT_REPLAY=1. Together with the profiler or frame_stats
+ * the same session can be timed on two builds.
+ *
+ * The mode is set in the in-game debug menu and kept over the reset back
+ * to the launcher. It starts with the first frame of the next game that is
+ * started, so start it without resuming a save state. Recording goes on
+ * until the buffer is full, playback until the end of the recording, after
+ * which the real buttons take over again.
+ *
+ * common_emu_input_loop() calls input_replay_frame() once per emulated frame,
+ * after the menu and macro keys were handled, so those keep working and
+ * aren't recorded.
+ *
+ * The recording is kept as runs of identical frames in AHBRAM.
+ * tools/input_replay.py saves it to a file and loads it back over SWD, and
+ * the linux ports play such a file with --replay.
+ */
+
+#define INPUT_REPLAY_RUNS   2048
+#define INPUT_REPLAY_MAGIC  0x52504c59  // "RPLY"
+
+typedef enum {
+    INPUT_REPLAY_OFF,
+    INPUT_REPLAY_RECORD,
+    INPUT_REPLAY_PLAY,
+} input_replay_mode_t;
+
+typedef struct {
+    uint16_t buttons;   // Bit n is odroid_gamepad_state_t.values[n]
+    uint16_t frames;
+} input_replay_run_t;
+
+typedef struct {
+    uint32_t magic;
+    uint32_t mode;
+    uint32_t count;     // Runs used
+    uint32_t frames;    // Frames recorded
+    input_replay_run_t runs[INPUT_REPLAY_RUNS];
+} input_replay_t;
+
+#if INPUT_REPLAY
+
+extern input_replay_t input_replay;
+
+void input_replay_set_mode(input_replay_mode_t mode);
+input_replay_mode_t input_replay_get_mode(void);
+
+void input_replay_frame(odroid_gamepad_state_t *joystick);
+
+#else
+
+static inline void input_replay_set_mode(input_replay_mode_t mode) {}
+static inline input_replay_mode_t input_replay_get_mode(void)
+{
+    return INPUT_REPLAY_OFF;
+}
+
+static inline void input_replay_frame(odroid_gamepad_state_t *joystick) {}
+
+#endif
+
+#endif
@@ -0,0 +1,42 @@
+#ifndef _LOG_RING_H_
+#define _LOG_RING_H_
+
+#include <stdint.h>
+
+/*
+ * Deferred logging for the frame loop.
+ *
+ * LOG_DEFER() works like printf() but only stores the format string's id,
+ * a timestamp in ms and the arguments in a ring of words next to logbuf.
+ * The strings live in the .log_fmt section of the ELF, which isn't loaded
+ * on the target, and tools/logpoll.py formats the messages on the host.
+ *
+ * Arguments are converted to 32 bit words, so only integers, pointers
+ * (cast to uint32_t) and %s of strings in the ELF can be logged, no floats.
+ * It's safe from interrupt handlers, a record is reserved with an atomic
+ * add and its header written last.
+ */
+
+#define LOG_RING_WORDS      256
+#define LOG_RING_MAX_ARGS   8
+
+// Header word of a record: magic, number of arguments, format string id
+#define LOG_RING_MAGIC      0xa0000000
+#define LOG_RING_ARGS_SHIFT 24
+
+#define LOG_DEFER(fmt, ...) \
+    do { \
+        static const char _log_fmt[] __attribute__((section (".log_fmt"), used)) = fmt; \
+        const uint32_t _log_args[] = {0, ##__VA_ARGS__}; \
+        _Static_assert(sizeof(_log_args) / sizeof(uint32_t) - 1 <= LOG_RING_MAX_ARGS, \
+                       "Too many arguments for LOG_DEFER()"); \
+        log_ring_write((uint32_t) _log_fmt, &_log_args[1], \
+                       sizeof(_log_args) / sizeof(uint32_t) - 1); \
+    } while (0)
+
+void log_ring_write(uint32_t fmt, const uint32_t *args, uint32_t count);
+
+// At boot, the ring is kept over a watchdog reset like logbuf
+void log_ring_reset(void);
+
+#endif
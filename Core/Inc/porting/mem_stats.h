@@ -0,0 +1,45 @@
+#ifndef _MEM_STATS_H_
+#define _MEM_STATS_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * How close the stack and the heap got to their end, for the debug menu.
+ *
+ * main() calls mem_stats_paint_stack() first thing: what's below the stack
+ * pointer is filled with a pattern, the deepest the stack went is then the
+ * lowest word that doesn't hold it anymore. The heap is whatever _sbrk()
+ * handed out to malloc(), which only grows. The arenas keep their own peak,
+ * see emu_arena_usage().
+ */
+
+#define MEM_STATS_STACK_PATTERN 0xc5c5c5c5
+
+void mem_stats_paint_stack(void);
+
+// Most of the stack that was used, in bytes
+size_t mem_stats_stack_peak(void);
+size_t mem_stats_stack_size(void);
+
+// In use by malloc() now, the most _sbrk() handed out, and the size of the heap
+void mem_stats_heap(size_t *used, size_t *peak, size_t *size);
+
+// In gw_alloc.c, next to _sbrk()
+size_t gw_heap_peak(void);
+
+/*
+ * Everything malloc() hands out after gw_heap_mark() is dropped at once by
+ * gw_heap_release(), for an emulator that goes back to the launcher without
+ * a reset. The blocks that were free at the mark aren't handed out in
+ * between, so the ones of the launcher are all still there after it.
+ */
+typedef struct {
+    char *end;
+    void *free_list;
+} gw_heap_mark_t;
+
+void gw_heap_mark(gw_heap_mark_t *mark);
+void gw_heap_release(const gw_heap_mark_t *mark);
+
+#endif
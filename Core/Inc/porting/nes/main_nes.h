@@ -1,3 +1,10 @@
 #pragma once
 
+#include <stdbool.h>
+#include <stdint.h>
+
 int app_main_nes(uint8_t load_state, uint8_t start_paused);
+
+// In nofrendo's nes.c but not in its nes.h, which is in the retro-go-stm32
+// submodule. One frame, only rendered if draw_flag is set.
+void nes_renderframe(bool draw_flag);
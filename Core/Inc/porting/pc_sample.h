@@ -0,0 +1,40 @@
+#ifndef _PC_SAMPLE_H_
+#define _PC_SAMPLE_H_
+
+#include <stdint.h>
+
+/*
+ * Statistical profiler, enabled with PC_SAMPLER=1.
+ *
+ * A compare channel of TIM1 interrupts the CPU every few timer ticks, next
+ * to the once a second update interrupt TIM1 already serves. The interrupted
+ * PC is counted in a hash table of PC_SAMPLE_BINS addresses in AHBRAM,
+ * which the data cache doesn't hide from the debugger.
+ *
+ * tools/pcprof.py clears the table over SWD, lets the target run and reads
+ * it back into a flat profile per function of the ELF.
+ *
+ * With PC_SAMPLER=0 all of this compiles to nothing.
+ */
+
+#define PC_SAMPLE_BINS      2048
+// TIM1 counts at about 20 kHz, a prime interval doesn't beat with frames
+#define PC_SAMPLE_INTERVAL  7
+
+typedef struct {
+    uint32_t pc;
+    uint32_t count;
+} pc_sample_bin_t;
+
+#if PC_SAMPLER
+
+// Once TIM1 runs, see bq24072_init()
+void pc_sample_init(void);
+
+#else
+
+static inline void pc_sample_init(void) {}
+
+#endif
+
+#endif
@@ -0,0 +1,35 @@
+#ifndef _BANK_CACHE_PCE_H_
+#define _BANK_CACHE_PCE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Keeps the ROM banks a game uses most in RAM, for ROMs that are run from the
+ * memory-mapped flash because they aren't compressed.
+ *
+ * The MMR registers are sampled every few scanlines, which gives how much
+ * time the CPU spends in each 8kB bank. Every BANK_CACHE_WINDOW frames the
+ * hottest banks are copied into buffers and MemoryMapR is pointed at them,
+ * a bank that has gone cold gives its buffer to a hotter one. The ROM is
+ * read-only, so a page still mapped to the other copy reads the same data.
+ *
+ * The buffers are all taken from the emu_arena at init, from what's left in
+ * RAM_EMU after the room rewind and run-ahead need when they're turned on.
+ *
+ * ROMs with the SF2 mapper are left alone, it rewrites MemoryMapR itself.
+ */
+
+#define BANK_CACHE_WINDOW 120
+
+// After LoadCartPCE() and emu_snapshot_init(), rom_data is PCE.ROM_DATA.
+// Pages of the same ROM still mapped to the cache go back to the flash.
+void pce_bank_cache_init(const uint8_t *rom_data, size_t rom_size);
+
+// Every few scanlines
+void pce_bank_cache_sample(void);
+
+// Once per frame
+void pce_bank_cache_frame(void);
+
+#endif
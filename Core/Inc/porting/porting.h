@@ -22,6 +22,20 @@
 #define IRAM_ATTR
 #define DRAM_ATTR
 
+// Zero-initialized state of an emulator core accessed for nearly every
+// emulated instruction, placed in DTCM while the core runs. Variables of
+// the cores can also be listed in dtcm/ instead.
+#define DTCM_EMU_ATTR __attribute__((section (".dtcm_emu")))
+
+// Capabilities of rg_alloc(), only the build with DEBUG_RG_ALLOC (the
+// default) honors them, see gw_alloc.c
+#ifndef MEM_ANY
+#define MEM_ANY   0
+#define MEM_SLOW  (1 << 0)
+#define MEM_FAST  (1 << 1)
+#define MEM_DMA   (1 << 2)
+#endif
+
 #ifndef DEBUG_RG_ALLOC
 
 #define rg_alloc(x, y) malloc(x)
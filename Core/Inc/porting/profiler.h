@@ -0,0 +1,86 @@
+#ifndef _PROFILER_H_
+#define _PROFILER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Where the time of each emulated frame goes, enabled with PROFILER=1.
+ *
+ * Code between profiler_begin() and profiler_end() of a scope is counted
+ * with the DWT cycle counter. Scopes nest, the time of an inner scope isn't
+ * counted for the outer one, and anything outside of a scope is emulation.
+ * The cycle counter stops in __WFI(), so the time spent waiting for the
+ * next frame is what's left of the frame after all the others.
+ *
+ * common_emu_frame_loop() calls profiler_frame() once per frame. Every
+ * second the min/avg/max time per frame of each scope is printed to the
+ * log as a line starting with "Prof:", and the average shown along the top
+ * of the screen if the overlay is turned on in the debug menu.
+ *
+ * With PROFILER=0 all of this compiles to nothing.
+ */
+
+typedef enum {
+    PROFILER_EMULATE,
+    PROFILER_BLIT,
+    PROFILER_AUDIO,
+    PROFILER_INPUT,
+    PROFILER_OVERLAY,
+    PROFILER_FLASH,
+    PROFILER_SYNC,
+    PROFILER_SCOPE_COUNT
+} profiler_scope_t;
+
+// In microseconds per frame, over the last second
+typedef struct {
+    uint32_t min;
+    uint32_t avg;
+    uint32_t max;
+} profiler_stats_t;
+
+#if PROFILER
+
+void profiler_begin(profiler_scope_t scope);
+void profiler_end(profiler_scope_t scope);
+// Of the innermost scope being measured, what frame_watch.c logs
+const char *profiler_scope_name(void);
+
+void profiler_frame(void);
+// Starts a new second, e.g. after a menu or loading a state
+void profiler_reset(void);
+
+profiler_stats_t profiler_get_stats(profiler_scope_t scope);
+
+void profiler_set_overlay(bool enabled);
+bool profiler_get_overlay(void);
+// Called by common_ingame_overlay()
+void profiler_draw_overlay(void);
+
+#else
+
+static inline void profiler_begin(profiler_scope_t scope) {}
+static inline void profiler_end(profiler_scope_t scope) {}
+static inline const char *profiler_scope_name(void)
+{
+    return "unknown";
+}
+
+static inline void profiler_frame(void) {}
+static inline void profiler_reset(void) {}
+
+static inline profiler_stats_t profiler_get_stats(profiler_scope_t scope)
+{
+    return (profiler_stats_t) {0};
+}
+
+static inline void profiler_set_overlay(bool enabled) {}
+static inline bool profiler_get_overlay(void)
+{
+    return false;
+}
+static inline void profiler_draw_overlay(void) {}
+
+#endif
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef _QUICK_SAVE_H_
+#define _QUICK_SAVE_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/*
+ * Quick-save of the state when powering off, kept in the 4kB backup SRAM
+ * which is retained in standby.
+ *
+ * quick_save_arm() makes the next save_pack_store() pack the state into the
+ * backup SRAM instead of writing the flash, if it fits. Powering off then
+ * doesn't wait for the flash. On the next boot quick_save_init() starts
+ * writing it to its slot in the background (see store_async.h), and until
+ * that is done save_pack_load() reads the state from the backup SRAM.
+ *
+ * The quick-save holds exactly what the slot would contain, i.e. a packed
+ * save_pack_header_t, save_pack_meta_t and LZ4 block, and the thumbnail
+ * if it fits.
+ */
+
+#define QUICK_SAVE_MAGIC 0x5153574b // "KWSQ"
+
+// At boot, keeps the backup SRAM powered in standby and flushes a quick-save
+void quick_save_init(void);
+
+void quick_save_arm(void);
+
+/**
+ * Returns where up to max_size bytes of the slot contents can be written if
+ * quick_save_arm() was called, NULL otherwise. Disarms it.
+ * quick_save_commit() makes them the quick-save of the slot at flash_ptr.
+ */
+uint8_t *quick_save_begin(size_t *max_size);
+void quick_save_commit(const uint8_t *flash_ptr, size_t size);
+
+// Returns the quick-save of the slot and sets size, NULL if there is none
+const uint8_t *quick_save_find(const uint8_t *flash_ptr, size_t *size);
+
+// Forgets the quick-save once it has been written to the flash
+void quick_save_poll(void);
+
+#endif
@@ -0,0 +1,48 @@
+#ifndef _RAM_LOADER_H_
+#define _RAM_LOADER_H_
+
+#include <stdint.h>
+
+/*
+ * Starts a ROM that was written into RAM over SWD, for trying out a ROM
+ * without parse_roms.py and the flashapp.
+ *
+ * scripts/ramload.sh halts the launcher, loads the ROM at the top of
+ * RAM_EMU and fills in ram_loader_comm. Once resumed, the launcher picks it
+ * up within a tick of its loop and starts it like a ROM of the external
+ * flash, with the RAM_EMU arena ending below it. Compressed ROMs work too,
+ * anything rom_loader.h detects.
+ *
+ * The ROM has no state slots and is gone after a reset. The GB core keeps
+ * all of RAM_EMU after its overlay for its bank cache, GB ROMs can't be
+ * loaded this way.
+ */
+
+#define RAM_LOADER_MAGIC 0x4d4f5252 // "RROM"
+
+typedef enum {
+    RAM_LOADER_IDLE = 0,
+    RAM_LOADER_READY,       // Set by the host once the rest is written
+    RAM_LOADER_STARTED,
+    RAM_LOADER_BAD_ADDRESS,
+    RAM_LOADER_BAD_CRC,
+    RAM_LOADER_BAD_SYSTEM,
+} ram_loader_state_t;
+
+// Must match scripts/ramload.sh
+typedef struct {
+    uint32_t magic;
+    uint32_t state;         // ram_loader_state_t
+    uint32_t address;       // Of the ROM, 4kB aligned in RAM_EMU
+    uint32_t size;
+    uint32_t crc32;         // As computed by zlib
+    char ext[8];            // Of the system, e.g. "nes"
+    char name[32];
+} ram_loader_comm_t;
+
+extern volatile ram_loader_comm_t ram_loader_comm;
+
+// From the launcher loop, doesn't return if there's a ROM to start
+void ram_loader_poll(void);
+
+#endif
@@ -0,0 +1,47 @@
+#ifndef _REWIND_H_
+#define _REWIND_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "odroid_overlay.h"
+
+/*
+ * Rewind, PAUSE/SET + B steps back through the last seconds of the game
+ * while it's held, instead of loading the state.
+ *
+ * Every REWIND_INTERVAL frames common_emu_frame_loop() calls rewind_frame(),
+ * which takes a snapshot with emu_snapshot_update(). Only the XOR of it
+ * with the previous snapshot is kept, LZ4 packed: most of the state doesn't
+ * change in a few frames, so the delta is mostly zeros and packs to a few
+ * kB. The deltas go into a ring, the oldest are dropped when it's full.
+ *
+ * Besides the ring two full snapshots are kept, both of the newest state.
+ * A step back unpacks the newest delta and XORs it into one of them, which
+ * gives the state before it.
+ *
+ * Everything is allocated from the emu_arena once rewind is turned on in
+ * the game options, after emu_snapshot_init().
+ */
+
+#define REWIND_INTERVAL 10
+// Frames between steps back while the key is held
+#define REWIND_STEP_FRAMES 2
+
+bool rewind_enabled(void);
+// Off, with nothing allocated, for the next game
+void rewind_reset(void);
+
+// Once per frame, between frames
+void rewind_frame(void);
+// Once per frame while the key is held, true if a state was loaded
+bool rewind_step(void);
+
+// What's in the ring
+uint32_t rewind_history_frames(void);
+size_t rewind_history_bytes(void);
+
+bool rewind_update_cb(odroid_dialog_choice_t *option, odroid_dialog_event_t event, uint32_t repeat);
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef _RG_ARENA_H_
+#define _RG_ARENA_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * Bump allocator over a fixed block of RAM. Blocks aren't freed one by one,
+ * the whole arena is wiped at once by rg_arena_reset(), e.g. when switching
+ * to another app. There's no locking, the firmware is single threaded.
+ */
+
+typedef struct {
+    uintptr_t start;
+    uintptr_t end;
+    uintptr_t next;
+} rg_arena_t;
+
+void rg_arena_create(rg_arena_t *arena, void *start, void *end);
+
+// NULL if it doesn't fit, align must be a power of 2
+void *rg_arena_alloc(rg_arena_t *arena, size_t size, size_t align);
+
+static inline void rg_arena_reset(rg_arena_t *arena)
+{
+    arena->next = arena->start;
+}
+
+static inline size_t rg_arena_used(const rg_arena_t *arena)
+{
+    return arena->next - arena->start;
+}
+
+static inline size_t rg_arena_size(const rg_arena_t *arena)
+{
+    return arena->end - arena->start;
+}
+
+static inline int rg_arena_contains(const rg_arena_t *arena, const void *ptr)
+{
+    return (uintptr_t) ptr >= arena->start && (uintptr_t) ptr < arena->end;
+}
+
+#endif
@@ -0,0 +1,63 @@
+#ifndef _ROM_LOADER_H_
+#define _ROM_LOADER_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/*
+ * Loads ROMs from the external flash, decompressing them into RAM if needed.
+ *
+ * The format is detected by going through a table of codecs (LZ4, DEFLATE
+ * from zopfli and LZMA, see rom_loader.c). Uncompressed ROMs are used in
+ * place, straight from the memory mapped flash.
+ *
+ * Codecs report their progress with rom_loader_progress(), which refreshes
+ * the watchdog and calls the callback set with rom_loader_set_progress().
+ * LZ4 frames are decoded a chunk at a time (see lz4_stream_run()), so the
+ * screen can be updated while a large ROM is being unpacked.
+ */
+
+typedef struct {
+    const char *name;
+    // True if src is in this format, ext is the extension of the ROM file
+    bool (*detect)(const uint8_t *src, size_t src_size, const char *ext);
+    // Returns the number of bytes written to dst, 0 on error
+    size_t (*decompress)(uint8_t *dst, size_t dst_size, const uint8_t *src, size_t src_size);
+} rom_codec_t;
+
+// done and total are in bytes of compressed input
+typedef void (*rom_loader_progress_t)(uint32_t done, uint32_t total);
+
+typedef struct {
+    const char *codec;      // NULL when the ROM isn't compressed
+    uint32_t packed_size;
+    uint32_t size;
+    uint32_t time_us;
+} rom_loader_stats_t;
+
+/**
+ * Decompresses src into dst if needed. Returns the size of the ROM and sets
+ * `data` to where it is, either dst or src.
+ */
+size_t rom_loader_load(const uint8_t *src, size_t src_size, const char *ext,
+                       uint8_t *dst, size_t dst_size, const uint8_t **data);
+
+// Same for the active file, see rom_manager.h
+size_t rom_loader_load_active(uint8_t *dst, size_t dst_size, const uint8_t **data);
+
+// CRC-32 as computed by zlib of the ROM of the active file once loaded, a
+// game ID for the emulators. Computed by parse_roms.py, or by the CRC
+// peripheral for ROMs it couldn't do it for.
+uint32_t rom_loader_crc32_active(void);
+
+void rom_loader_set_progress(rom_loader_progress_t callback);
+void rom_loader_progress(uint32_t done, uint32_t total);
+
+// Progress callback that draws a bar in the middle of the screen
+void rom_loader_progress_bar(uint32_t done, uint32_t total);
+
+// About the last ROM that was loaded
+rom_loader_stats_t rom_loader_get_stats(void);
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef _RUN_AHEAD_H_
+#define _RUN_AHEAD_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "odroid_overlay.h"
+
+/*
+ * Run-ahead, hides the frames of input lag that games have on their own.
+ *
+ * Each frame the emulator runs the real frame without drawing it, keeps a
+ * snapshot of the state in RAM with run_ahead_save(), runs
+ * run_ahead_frames() more frames with the same input and draws the last
+ * of them, then goes back to the snapshot with run_ahead_load(). What's
+ * shown is where the game would be a frame or two later, so it reacts to
+ * a button that much earlier. The frames ahead aren't heard, the emulator
+ * checks run_ahead_active() to drop their audio.
+ *
+ * The snapshot is taken with emu_snapshot_save(). The emulator either
+ * passes a buffer to run_ahead_init() or it's allocated from the emu_arena
+ * once run-ahead is turned on.
+ *
+ * It's set in the game options with run_ahead_update_cb(), and skipped for
+ * frames that aren't drawn anyway.
+ */
+
+#define RUN_AHEAD_MAX_FRAMES 2
+
+// After emu_snapshot_init(), buffer may be NULL
+void run_ahead_init(uint8_t *buffer, size_t size);
+
+// Frames to run ahead of the real one, 0 if it's off
+int run_ahead_frames(void);
+bool run_ahead_active(void);
+
+// Returns false if there's no room for the snapshot, which turns it off
+bool run_ahead_save(void);
+void run_ahead_load(void);
+
+bool run_ahead_update_cb(odroid_dialog_choice_t *option, odroid_dialog_event_t event, uint32_t repeat);
+
+#endif
@@ -0,0 +1,68 @@
+#ifndef _SAVE_LOG_H_
+#define _SAVE_LOG_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * Log-structured save storage, enabled with SAVE_LOG_SIZE_KB > 0.
+ *
+ * Instead of erasing and rewriting the save slot of a ROM every time, new
+ * contents of a slot are appended as records to a log area in SAVEFLASH that
+ * is already erased. The log is used round-robin, which spreads the erases
+ * over all of its sectors. The fixed slot at save_address stays the home of
+ * the save: when the log wraps around and a sector that still holds the
+ * latest record of a slot has to be erased, that record is written back to
+ * its home slot first.
+ *
+ * A record is a page with a save_log_header_t followed by the data, which is
+ * exactly what the home slot would contain. The header is programmed last,
+ * so a record that was interrupted while being written is never found.
+ *
+ * The area the next record goes to is erased in the background (see
+ * store_async.h) after every save, so saving usually only programs pages.
+ */
+
+#define SAVE_LOG_MAGIC 0x474f4c53 // "SLOG"
+
+typedef struct {
+    uint32_t magic;
+    uint32_t slot;      // Offset of the home slot in the external flash
+    uint32_t seq;       // Higher is newer
+    uint32_t size;      // Of the data following the header page
+    uint32_t crc;       // crc32 of the data
+    uint32_t obsolete;  // 0xffffffff while valid, cleared to discard it
+} save_log_header_t;
+
+#if SAVE_LOG_SIZE > 0
+
+/**
+ * Returns where up to max_size bytes of new contents for the slot at
+ * flash_ptr can be programmed, or NULL if they don't fit into the log.
+ * The area is erased. save_log_commit() makes it the current contents.
+ */
+uint8_t *save_log_begin(const uint8_t *flash_ptr, size_t max_size);
+void save_log_commit(const uint8_t *flash_ptr, size_t size);
+
+// Returns the latest record of the slot and sets size, NULL if there is none
+const uint8_t *save_log_find(const uint8_t *flash_ptr, size_t *size);
+
+// Forgets the records of a slot, e.g. when the save is deleted
+void save_log_discard(const uint8_t *flash_ptr);
+
+#else
+
+static inline uint8_t *save_log_begin(const uint8_t *flash_ptr, size_t max_size)
+{
+    return NULL;
+}
+static inline void save_log_commit(const uint8_t *flash_ptr, size_t size) {}
+static inline const uint8_t *save_log_find(const uint8_t *flash_ptr, size_t *size)
+{
+    return NULL;
+}
+static inline void save_log_discard(const uint8_t *flash_ptr) {}
+
+#endif
+
+#endif
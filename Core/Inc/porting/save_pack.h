@@ -0,0 +1,79 @@
+#ifndef _SAVE_PACK_H_
+#define _SAVE_PACK_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/*
+ * LZ4 compressed save states in the save slots of the external flash.
+ *
+ * A packed slot starts with a save_pack_header_t followed by the LZ4 block
+ * (see lz4_pack.h). States that don't compress well enough to fit into the
+ * slot are stored as they are with store_save(), and so are states that
+ * were saved before this existed, save_pack_load() tells them apart by the
+ * magic.
+ *
+ * The block is compressed twice: once to compare it with what is in the
+ * flash, and once to write it. Only the 4kB sectors from the first one that
+ * differs up to the end of the block are erased and programmed.
+ *
+ * With the save log (see save_log.h) the new contents of a slot are appended
+ * to the log instead, and both functions look up the latest record of the
+ * slot first, falling back to the slot itself.
+ *
+ * States packed since SAVE_PACK_MAGIC_META have a save_pack_meta_t right
+ * after the header, and a thumbnail of the screen after the LZ4 block if
+ * there's room for it in the slot. The slot menus only read these, see
+ * save_pack_peek_meta().
+ */
+
+#define SAVE_PACK_MAGIC 0x5a4c5747 // "GWLZ"
+#define SAVE_PACK_MAGIC_META 0x4d4c5747 // "GWLM"
+
+typedef struct {
+    uint32_t magic;
+    uint32_t size;          // Of the state
+    uint32_t packed_size;   // Of the LZ4 block after the header
+    uint32_t timestamp;     // Unix time of the save, not compared
+} save_pack_header_t;
+
+typedef struct {
+    uint32_t play_time_s;   // Of the game up to the save, not compared
+    uint32_t crc32;         // Of the state, checked when it's loaded
+    uint16_t thumb_width;   // RGB565, 0x0 if there's no thumbnail
+    uint16_t thumb_height;
+} save_pack_meta_t;
+
+// The thumbnail starts at the first word after the LZ4 block
+#define SAVE_PACK_THUMB_OFFSET(header) \
+    ((sizeof(save_pack_header_t) + sizeof(save_pack_meta_t) + (header)->packed_size + 3) & ~3)
+
+// Returns the number of bytes taken up in the slot
+size_t save_pack_store(const uint8_t *flash_ptr, size_t slot_size,
+                       const uint8_t *data, size_t size);
+
+/**
+ * Returns the state in the slot, unpacked into dst if it is packed or
+ * flash_ptr if it isn't, and sets size to its size. Returns NULL if the
+ * packed state is corrupt or doesn't fit into dst.
+ */
+const uint8_t *save_pack_load(const uint8_t *flash_ptr, size_t slot_size,
+                              uint8_t *dst, size_t dst_size, size_t *size);
+
+/**
+ * Reads the header of the state in the slot without unpacking it. Returns
+ * false if the slot is erased, the magic in header isn't SAVE_PACK_MAGIC if
+ * the state isn't packed.
+ */
+bool save_pack_peek(const uint8_t *flash_ptr, save_pack_header_t *header);
+
+/**
+ * Same as save_pack_peek(), and reads the metadata too. Returns the
+ * thumbnail, NULL if there's none. meta is all zeros for states packed
+ * before SAVE_PACK_MAGIC_META.
+ */
+const uint16_t *save_pack_peek_meta(const uint8_t *flash_ptr, size_t slot_size,
+                                    save_pack_header_t *header, save_pack_meta_t *meta);
+
+#endif
@@ -0,0 +1,46 @@
+#ifndef _SCREENSHOT_H_
+#define _SCREENSHOT_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Screenshots, PAUSE/SET + GAME.
+ *
+ * screenshot_take() LZ4 packs the frame that is shown into a staging
+ * buffer from the emu_arena and writes that with store_save_async(), so the
+ * game only stops for the packing and the flash is written between frames.
+ *
+ * The .fbflash area holds as many screenshots as fit, one after another,
+ * each starting on a 4kB sector: a screenshot_header_t, the CLUT with
+ * GW_LCD_MODE_LUT8, then the LZ4 block. Once the next one doesn't fit
+ * before the end it goes to the start of the area, over the oldest ones.
+ * tools/screenshot.py reads them back, by their sequence number.
+ */
+
+#define SCREENSHOT_MAGIC 0x54485353 // "SSHT"
+
+// Room for the packed screenshot, a frame that packs larger is dropped
+#define SCREENSHOT_STAGING_SIZE (64 * 1024)
+
+typedef enum {
+    SCREENSHOT_RGB565,
+    SCREENSHOT_LUT8,        // Followed by clut_count 0x00RRGGBB colors
+} screenshot_format_t;
+
+typedef struct {
+    uint32_t magic;
+    uint32_t seq;
+    uint16_t width;
+    uint16_t height;
+    uint16_t format;
+    uint16_t clut_count;
+    uint32_t packed_size;
+} screenshot_header_t;
+
+// Between frames, returns false if the screenshot couldn't be taken
+bool screenshot_take(void);
+// Once the game is left, the staging buffer goes with its emu_arena
+void screenshot_reset(void);
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef _PAGE_CACHE_SMS_H_
+#define _PAGE_CACHE_SMS_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Compressed SMS, GG, SG-1000 and ColecoVision ROMs.
+ *
+ * parse_roms.py packs them as one LZ4 frame per 16kB page of the Sega
+ * mapper, one after the other. A ROM that fits in RAM_EMU next to what
+ * rewind and run-ahead need is unpacked whole when it's loaded.
+ *
+ * Otherwise cart.rom stays at the frames in flash, only the base the mapper
+ * computes its pointers from. Mapper writes and state loads point
+ * cpu_readmap into it, sms_page_cache_remap() then moves those pointers to
+ * the pages in RAM, unpacking the missing ones over the least recently
+ * mapped. The pages mapped right now are never reused, page 0 always is
+ * one of them.
+ */
+
+#define SMS_PAGE_SIZE 0x4000
+
+bool sms_page_cache_detect(const uint8_t *src, size_t src_size);
+
+// Returns the size of the ROM and sets rom to what cart.rom has to be
+size_t sms_page_cache_init(const uint8_t *src, size_t src_size, const uint8_t **rom);
+
+// CRC-32 of the unpacked ROM, parse_roms.py gave it unless known is 0
+uint32_t sms_page_cache_crc32(uint32_t known);
+
+// After system_reset() and every load of a state
+void sms_page_cache_remap(void);
+
+#endif
@@ -0,0 +1,73 @@
+#ifndef _STATE_SLOTS_H_
+#define _STATE_SLOTS_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "odroid_system.h"
+#include "rg_emulators.h"
+
+/*
+ * Save state slots of a ROM, STATE_SLOTS of them.
+ *
+ * The save area of a ROM is STATE_SLOTS slots of save_size bytes each, slot
+ * 0 starting at save_address. Every slot is saved and loaded on its own
+ * through save_pack.h, so it can live in the save log as well.
+ *
+ * The selected slot is the one odroid_system_emu_save_state() and
+ * odroid_system_emu_load_state() use. The slot menus read the save time
+ * from the save_pack_header_t of the slots instead of the whole state.
+ *
+ * A save also keeps the play time and a STATE_THUMB_WIDTH x
+ * STATE_THUMB_HEIGHT RGB565 thumbnail of the game screen, see
+ * save_pack_meta_t. The menus show the thumbnail of the selected slot next
+ * to the dialog. The thumbnail is taken from the last frame shown, before a
+ * menu or an overlay is drawn over it, into a buffer from the emu_arena.
+ */
+
+#ifndef STATE_SLOTS
+#define STATE_SLOTS 1
+#endif
+
+// A quarter of the screen each way
+#define STATE_THUMB_WIDTH 80
+#define STATE_THUMB_HEIGHT 60
+
+typedef struct {
+    bool used;
+    uint32_t timestamp;     // Unix time of the save, 0 if unknown
+    uint32_t play_time_s;   // 0 if unknown
+    const uint16_t *thumb;  // In the flash, NULL if there's none
+} state_slot_info_t;
+
+const uint8_t *state_slot_address(const retro_emulator_file_t *file, int slot);
+void state_slot_get_info(const retro_emulator_file_t *file, int slot, state_slot_info_t *info);
+
+// The used slot that was saved last, -1 if there is none
+int state_slot_latest(const retro_emulator_file_t *file);
+
+// The selected slot of ACTIVE_FILE
+const uint8_t *state_slot_current(void);
+
+int state_slot_get(void);
+void state_slot_set(int slot);
+
+// Selects a slot of file and shows it, for the slot choice of the menus
+void state_slot_menu_init(const retro_emulator_file_t *file);
+bool state_slot_update_cb(odroid_dialog_choice_t *option, odroid_dialog_event_t event, uint32_t repeat);
+// Once the dialog of state_slot_menu_init() is closed
+void state_slot_menu_done(void);
+
+// Of the frame that is shown, for the next save
+void state_slot_capture_thumb(void);
+// The one captured for this save or one of the frame now, NULL if there's no room
+const uint16_t *state_slot_take_thumb(void);
+
+// Seconds played, counting from play_time_s now
+void state_slot_play_set(uint32_t play_time_s);
+uint32_t state_slot_play_time(void);
+
+// Once the game is left, the thumbnail buffer goes with its emu_arena
+void state_slot_reset(void);
+
+#endif
@@ -0,0 +1,42 @@
+#ifndef _STORE_ASYNC_H_
+#define _STORE_ASYNC_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+/*
+ * store_save() split into small steps, so that saving e.g. the cartridge RAM
+ * while a game is running doesn't stall the emulation loop for the whole
+ * time the flash takes to erase and program.
+ *
+ * cpumon_sleep() runs one step instead of sleeping while a write is pending,
+ * i.e. the work is done in the idle time between frames. A step is comparing
+ * one 4kB sector with the flash, erasing it, or programming one 256 byte page
+ * of it. Erases are suspended after a few ms if the flash supports it and
+ * resumed in the next step. The flash is back in memory-mapped mode after
+ * every step, so the ROMs can be read from it in between.
+ *
+ * Every sector is copied out of data when it's compared, data has to stay
+ * valid until the write is done but may change in the meantime. Sectors that
+ * were already compared then end up with the older contents, call
+ * store_save_async() again to have them written as well.
+ *
+ * Only one write can be pending. Starting another one, store_save() and
+ * store_erase() finish the pending one first.
+ */
+
+void store_save_async(const uint8_t *flash_ptr, const uint8_t *data, size_t size);
+
+// Erases the sectors of the area that aren't erased yet
+void store_erase_async(const uint8_t *flash_ptr, size_t size);
+
+// Returns true if there was anything to do
+bool store_async_step(void);
+
+bool store_async_busy(void);
+
+// Blocks until the pending write is done
+void store_async_flush(void);
+
+#endif
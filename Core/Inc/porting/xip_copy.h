@@ -0,0 +1,20 @@
+#ifndef _XIP_COPY_H_
+#define _XIP_COPY_H_
+
+#include <stddef.h>
+
+/*
+ * Copies out of the memory-mapped external flash, see
+ * Core/Src/copy_from_xip-armv7m.s.
+ *
+ * The flash is cached 32 bytes at a time, and this reads it a whole cache
+ * line per load once src is aligned to one, prefetching ahead. For the
+ * overlays, the ITCM code and anything else that's copied out of the
+ * flash in bulk; memcpy is as fast for a few bytes.
+ *
+ * It's not a builtin, so unlike memcpy it isn't checked with
+ * -D_FORTIFY_SOURCE against the size of the linker symbols it's given.
+ */
+void *copy_from_xip(void *dst, const void *src, size_t len);
+
+#endif
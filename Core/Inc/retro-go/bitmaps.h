@@ -1,3 +1,13 @@
+/*
+ * The banners (header_*) are packed: width, height and the number of colors
+ * as uint16_t, the RGB565 palette, then runs of a (length - 1, index) byte
+ * pair. tools/img2bin.py --lut8-rle makes them, gui_draw_header() unpacks
+ * the one of the current tab once into RAM and blits it with the DMA2D.
+ *
+ * The logos have more colors than a LUT8 palette holds and stay RGB565, as
+ * do header_gbc and header_lnx that aren't built.
+ */
+
 extern const unsigned char header_sg1000[];
 extern const unsigned char logo_sg1000[];
 
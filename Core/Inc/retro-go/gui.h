@@ -21,8 +21,14 @@ typedef enum {
     PAGE_DOWN,
     FIRST_ROW,
     LAST_ROW,
+    // To the first row of the previous or the next initial letter
+    LETTER_UP,
+    LETTER_DOWN,
 } scroll_mode_t;
 
+// 'a' to 'z', the rows before the first of them start with a digit or the like
+#define LISTBOX_LETTERS 26
+
 typedef struct {
     uint16_t list_background;
     uint16_t list_standard;
@@ -43,6 +49,9 @@ typedef struct {
     listbox_item_t *items;
     int length;
     int cursor;
+    // First row of each of the LISTBOX_LETTERS, or length if there's none.
+    // Only for lists sorted by name, NULL if it has to be searched for.
+    const uint16_t *letters;
 } listbox_t;
 
 typedef void (*gui_event_handler_t)(gui_event_t event, void *arg);
@@ -94,3 +103,15 @@ void gui_draw_status(tab_t *tab);
 void gui_draw_list(tab_t *tab);
 void gui_draw_notice(const char *text, uint16_t color);
 void gui_draw_cover(retro_emulator_file_t *file);
+// What the GUI keeps in the emu_arena, which is gone once a game ran
+void gui_release_caches(void);
+
+/*
+ * Back to the launcher without a reset. emulator_start() calls
+ * launcher_leave() first, launcher_return() then tears the game down and
+ * jumps back into the launcher as it was left, with its tabs and lists still
+ * on the heap. It returns only when the launcher wasn't set up, when the
+ * game was resumed at boot, and the caller resets instead.
+ */
+void launcher_leave(void);
+void launcher_return(void);
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * On-device benchmarks, run from the debug menu of the launcher to compare
+ * hardware revisions and flash chips:
+ *  - memcpy() between DTCM, AXI SRAM and AHBRAM, with the data cache
+ *    cleaned so the RAM itself is measured
+ *  - sequential and random reads of the memory mapped external flash
+ *  - erase and program of a 64 kB block of the external flash, only if
+ *    the user agrees and the block after the firmware and ROMs is blank
+ *  - the DMA2D fill, copy and L8 -> RGB565 blits of a 320x240 frame
+ *  - unpacking a fixed payload with each ROM codec
+ *
+ * The results are shown in a dialog and printed to the log.
+ */
+
+void benchmark_run(void);
+
+// The payload of the codec benchmarks, see tools/benchmark_payload.py
+#define BENCHMARK_PAYLOAD_SIZE 8192
+
+void benchmark_payload(uint8_t *buffer, size_t size);
+
+extern const uint8_t benchmark_payload_deflate[];
+extern const uint32_t benchmark_payload_deflate_size;
+extern const uint8_t benchmark_payload_lzma[];
+extern const uint32_t benchmark_payload_lzma_size;
@@ -23,6 +23,9 @@ typedef struct {
     size_t crc_offset;
     uint32_t checksum;
     bool missing_cover;
+    // Cover art packed by parse_roms.py or NULL: width and height as
+    // uint16_t, then the RGB565 pixels or an LZ4 frame of them
+    const uint8_t *cover;
     rom_region_t region;
     const rom_system_t *system;
 } retro_emulator_file_t;
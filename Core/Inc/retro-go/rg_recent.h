@@ -0,0 +1,7 @@
+#include "rg_emulators.h"
+
+void recent_init();
+// Moves the game to the top of the recently played list
+void recent_add(const retro_emulator_file_t *file, bool has_save);
+// Called when a state of a game in the list is saved, so it's resumed next time
+void recent_set_has_save(const retro_emulator_file_t *file);
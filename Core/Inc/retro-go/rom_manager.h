@@ -3,12 +3,17 @@
 #include <stdint.h>
 
 #include "rg_emulators.h"
+#include "gui.h"
 
 struct rom_system_t {
     char *system_name;
     const retro_emulator_file_t *roms;
     char *extension;
     uint32_t roms_count;
+    // roms_count items sorted by name, generated by parse_roms.py
+    const listbox_item_t *list;
+    // Where each letter starts in the list, see listbox_t
+    const uint16_t *letters;
 };
 
 typedef struct {
@@ -23,4 +28,11 @@ extern unsigned ROM_DATA_LENGTH;
 extern retro_emulator_file_t *ACTIVE_FILE;
 
 const rom_system_t *rom_manager_system(const rom_manager_t *mgr, char *name);
+
+// A ROM as stored in the settings: index of the system in rom_mgr in the
+// upper 16 bits and index of the ROM in the system in the lower 15 bits.
+// Bit 15 is left for flags of the users.
+#define ROM_ID_MASK 0xffff7fff
+bool rom_manager_file_id(const retro_emulator_file_t *file, uint32_t *id);
+const retro_emulator_file_t *rom_manager_file(uint32_t id);
 void rom_manager_set_active_file(retro_emulator_file_t *file);
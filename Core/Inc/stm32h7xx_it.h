@@ -66,6 +66,7 @@ void SAI1_IRQHandler(void);
 void LTDC_IRQHandler(void);
 void OCTOSPI1_IRQHandler(void);
 /* USER CODE BEGIN EFP */
+void DMA2D_IRQHandler(void);
 
 /* USER CODE END EFP */
 
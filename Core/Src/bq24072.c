@@ -1,5 +1,6 @@
 #include <stdio.h>
 #include <stdbool.h>
+#include <string.h>
 
 #include <stm32h7xx_hal.h>
 
@@ -12,6 +13,10 @@
 
 #define BQ24072_PROFILING   0
 
+// TIM1 starts a conversion every second, which the DMA writes here. The
+// value is the average of the last BQ24072_SAMPLES.
+#define BQ24072_SAMPLES     8
+
 typedef enum {
     BQ24072_PIN_CHG,
     BQ24072_PIN_PGOOD,
@@ -38,6 +43,8 @@ extern TIM_HandleTypeDef htim1;
 static volatile uint32_t bq24072_battery_value;
 #endif // BQ24072_PROFILING
 
+static volatile uint16_t bq24072_samples[BQ24072_SAMPLES] __attribute__((section (".ahb"))) __attribute__((aligned(4)));
+
 static struct {
     uint16_t    value;
     bool        charging;
@@ -48,25 +55,61 @@ static struct {
     }           last;
 } bq24072_data;
 
-void HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef* hadc)
+// From the DMA interrupt, every half of the buffer
+static void bq24072_average(void)
 {
-    bq24072_data.value = HAL_ADC_GetValue(hadc);
+    uint32_t sum = 0;
+    uint32_t count = 0;
+
+    // Samples that weren't taken yet since boot are 0
+    for (int i = 0; i < BQ24072_SAMPLES; i++) {
+        if (bq24072_samples[i]) {
+            sum += bq24072_samples[i];
+            count++;
+        }
+    }
+
+    if (count) {
+        bq24072_data.value = sum / count;
+    }
 
 #if BQ24072_PROFILING == 1
     bq24072_battery_value = bq24072_data.value;
 #endif
+}
+
+void HAL_ADC_ConvHalfCpltCallback(ADC_HandleTypeDef* hadc)
+{
+    bq24072_average();
+}
 
-    HAL_ADC_Stop_IT(hadc);
+void HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef* hadc)
+{
+    bq24072_average();
 }
 
 int32_t bq24072_init(void)
 {
+    uint32_t start;
+
     // Read initial states
     bq24072_handle_power_good();
     bq24072_handle_charging();
-    bq24072_poll();
 
-    // Start timer for voltage poll
+    // The section isn't cleared at boot
+    memset((void *) bq24072_samples, 0, sizeof(bq24072_samples));
+    HAL_ADC_Start_DMA(&hadc1, (uint32_t *) bq24072_samples, BQ24072_SAMPLES);
+
+    // First conversion right away rather than in a second. A conversion
+    // takes microseconds, the timeout is only if the ADC doesn't start.
+    HAL_TIM_GenerateEvent(&htim1, TIM_EVENTSOURCE_UPDATE);
+    start = HAL_GetTick();
+    while (!bq24072_samples[0] && HAL_GetTick() - start < 2) {
+    }
+    bq24072_data.value = bq24072_samples[0];
+
+    // Don't count the event above as a second of uptime
+    __HAL_TIM_CLEAR_FLAG(&htim1, TIM_FLAG_UPDATE);
     HAL_TIM_Base_Start_IT(&htim1);
 
     return 0;
@@ -179,8 +222,3 @@ int bq24072_get_percent_filtered(void)
     return percent;
 }
 
-void bq24072_poll(void)
-{
-    HAL_ADC_Start_IT(&hadc1);
-}
-
@@ -0,0 +1,91 @@
+/* Copy from the memory-mapped OSPI flash, see xip_copy.h.
+
+   The flash is read through the D-cache a 32-byte line at a time. Once
+   src is aligned to a line, each iteration loads a whole line with one
+   LDM, which the D-cache turns into a single burst on the OSPI bus, and
+   prefetches the line after the next one. Heads and tails use words and
+   bytes, and when src and dst don't have the same alignment the job is
+   handed to memcpy, which reads src by aligned words anyway.
+
+   Prototype: void *copy_from_xip (void *dst, const void *src, size_t count);
+ */
+
+#define XIP_LINE 32
+#define XIP_MIN_SIZE (2 * XIP_LINE)
+
+	.syntax unified
+	.text
+	.align	2
+	.global	copy_from_xip
+	.thumb
+	.thumb_func
+	.type	copy_from_xip, %function
+copy_from_xip:
+	@ r0: dst
+	@ r1: src
+	@ r2: len
+	cmp	r2, XIP_MIN_SIZE
+	blo	.Lmemcpy
+	eor	r3, r0, r1
+	lsls	r3, r3, #30
+	bne	.Lmemcpy
+
+	push	{r4, r5, r6, r7, r8, r9, r10}
+	mov	ip, r0
+
+	/* Head up to the next line of src, len >= XIP_MIN_SIZE covers it */
+	rsb	r3, r1, #0
+	ands	r3, r3, XIP_LINE - 1
+	beq	.Lline_aligned
+	subs	r2, r2, r3
+1:
+	tst	r1, #3
+	beq	2f
+	ldrb	r4, [r1], #1
+	strb	r4, [ip], #1
+	subs	r3, r3, #1
+	b	1b
+2:
+	cbz	r3, .Lline_aligned
+	ldr	r4, [r1], #4
+	str	r4, [ip], #4
+	subs	r3, r3, #4
+	b	2b
+
+.Lline_aligned:
+	subs	r2, r2, XIP_LINE
+
+	.align 2
+.Lline_loop:
+	pld	[r1, #2 * XIP_LINE]
+	ldmia	r1!, {r3, r4, r5, r6, r7, r8, r9, r10}
+	stmia	ip!, {r3, r4, r5, r6, r7, r8, r9, r10}
+	subs	r2, r2, XIP_LINE
+	bhs	.Lline_loop
+
+	adds	r2, r2, XIP_LINE - 4
+	blo	.Lless_than_4
+
+.Lword_loop:
+	ldr	r3, [r1], #4
+	str	r3, [ip], #4
+	subs	r2, r2, #4
+	bhs	.Lword_loop
+
+.Lless_than_4:
+	adds	r2, r2, #4
+	beq	.Ldone
+1:
+	ldrb	r3, [r1], #1
+	strb	r3, [ip], #1
+	subs	r2, r2, #1
+	bne	1b
+
+.Ldone:
+	pop	{r4, r5, r6, r7, r8, r9, r10}
+	bx	lr
+
+.Lmemcpy:
+	b	memcpy
+
+	.size	copy_from_xip, .-copy_from_xip
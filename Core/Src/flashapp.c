@@ -9,15 +9,16 @@
 
 #include "githash.h"
 #include "gui.h"
+#include "lz4_depack.h"
 #include "gw_buttons.h"
 #include "gw_flash.h"
+#include "gw_hash.h"
 #include "gw_lcd.h"
 #include "gw_linker.h"
 #include "main.h"
 #include "rg_emulators.h"
 #include "rg_favorites.h"
 #include "utils.h"
-#include "sha256.h"
 
 #define DBG(...) printf(__VA_ARGS__)
 // #define DBG(...)
@@ -63,12 +64,24 @@ typedef enum {
 
     FLASHAPP_FINAL                  = 0x0D,
     FLASHAPP_ERROR                  = 0x0E,
+
+    // Entered from FLASHAPP_START for compare and compressed jobs
+    FLASHAPP_COMPARE_FLASH          = 0x0F,
+    FLASHAPP_DECOMPRESS             = 0x10,
 } flashapp_state_t;
 
+typedef enum {
+    FLASHAPP_COMPARE_NONE           = 0,
+    FLASHAPP_COMPARE_REQUESTED      = 1,    // Set by the host, no data is loaded
+    FLASHAPP_COMPARE_IDENTICAL      = 2,
+    FLASHAPP_COMPARE_DIFFERENT      = 3,
+} flashapp_compare_t;
+
 typedef enum {
     FLASHAPP_STATUS_BAD_HASH_RAM    = 0xbad00001,
     FLASHAPP_STATUS_BAD_HAS_FLASH   = 0xbad00002,
     FLASHAPP_STATUS_NOT_ALIGNED     = 0xbad00003,
+    FLASHAPP_STATUS_BAD_COMPRESSION = 0xbad00004,
 
     FLASHAPP_STATUS_IDLE            = 0xcafe0000,
     FLASHAPP_STATUS_DONE            = 0xcafe0001,
@@ -82,45 +95,66 @@ typedef struct {
     uint32_t current_program_address;
     uint32_t program_bytes_left;
     uint8_t* program_buf;
+    uint32_t buffer_idx;
+    bool     chip_erase;
     uint32_t progress_max;
     uint32_t progress_value;
+    lz4_stream_t lz4;
 } flashapp_t;
 
 // framebuffer1 is used as an actual framebuffer.
-// framebuffer2 and onwards is used as a buffer for the flash.
+// framebuffer2 and onwards is used as a buffer for the flash, split into
+// FLASHAPP_BUFFER_COUNT buffers so that the host can load the next chunk
+// while the current one is programmed. Together they take up the same 832kB
+// the chunks used to, see DEFAULT_CHUNK_SIZE_KB in flash_multi.sh.
+#define FLASHAPP_BUFFER_COUNT 2
+#define FLASHAPP_BUFFER_SIZE  (416 * 1024)
+
 static uint8_t *flash_buffer = (uint8_t *) framebuffer2;
 
 // Values below are read or written by the debugger
 
-// Store state in a uint32_t
-uint32_t flashapp_state;
-
-// Set to non-zero to start programming
-uint32_t program_start;
-
-// Status register
-uint32_t program_status;
-
-// Number of bytes to program in the flash
-uint32_t program_size;
-
-// Where to program in the flash
-uint32_t program_address;
-
-// Control if chip should be erased or not
-uint32_t program_erase;
-
-// Number of bytes to be erased from program_address
-int32_t program_erase_bytes;
+// One chunk to program, loaded into buffer (chunk index - 1) % FLASHAPP_BUFFER_COUNT
+typedef struct {
+    // Set to 1 by the host once the buffer and the other fields are loaded,
+    // cleared when the chunk is programmed and the buffer can be reused
+    uint32_t ready;
+    uint32_t size;              // Number of bytes to program in the flash
+    uint32_t address;           // Where to program in the flash
+    uint32_t erase;             // Control if chip should be erased or not
+    int32_t  erase_bytes;       // Number of bytes to be erased from address
+    uint32_t chunk_idx;
+    uint8_t  expected_sha256[68];   // 64 hex digits and a NUL
+    // flashapp_compare_t. A compare job only checks the hash of the flash.
+    // The chunk is done if it is identical, otherwise the host loads the
+    // data into the same buffer as a regular job.
+    uint32_t compare;
+    // If set, the data is verified with the CRC unit against expected_crc32
+    // instead of with expected_sha256. Compare jobs always use the hash.
+    uint32_t verify_crc32;
+    uint32_t expected_crc32;
+    // If not 0, the buffer holds an LZ4 frame of this size at its end instead
+    // of the data. It is decoded in place to the start of the buffer.
+    uint32_t compressed_size;
+} flashapp_job_t;
+
+flashapp_job_t program_jobs[FLASHAPP_BUFFER_COUNT];
+
+// Read by the host in one transfer
+typedef struct {
+    uint32_t state;             // flashapp_state_t
+    uint32_t status;            // flashapp_status_t
+    uint32_t chunk_idx;         // Chunk in progress or the one that failed
+    uint32_t chunk_count;       // Number of chunks, set by the host
+} flashapp_comm_t;
 
-// Current chunk index
-uint32_t program_chunk_idx;
+flashapp_comm_t flashapp_comm;
 
-// Number of chunks
-uint32_t program_chunk_count;
+// Set to 2 to run the flash test
+uint32_t program_start;
 
-// The expected sha256 of the loaded binary
-uint8_t program_expected_sha256[65];
+// The chunk being programmed, copied from program_jobs
+static flashapp_job_t program_job;
 
 // TODO: Expose properly
 int odroid_overlay_draw_text_line(uint16_t x_pos,
@@ -319,32 +353,63 @@ static void test_flash(flashapp_t *flashapp)
 
 static void state_set(flashapp_state_t state_next)
 {
-    printf("State: %ld -> %d\n", flashapp_state, state_next);
+    printf("State: %ld -> %d\n", flashapp_comm.state, state_next);
 
-    flashapp_state = state_next;
+    flashapp_comm.state = state_next;
 }
 
 static void state_inc(void)
 {
-    state_set(flashapp_state + 1);
+    state_set(flashapp_comm.state + 1);
 }
 
-static void flashapp_run(flashapp_t *flashapp)
+static bool sha256_matches(const uint8_t *data)
 {
-    uint8_t program_calculated_sha256[65];
+    uint8_t calculated_sha256[65];
+
+    gw_sha256_to_string(calculated_sha256, data, program_job.size);
 
-    switch (flashapp_state) {
+    return strncmp((char *)calculated_sha256, (char *)program_job.expected_sha256, 64) == 0;
+}
+
+static bool verify(const uint8_t *data)
+{
+    if (program_job.verify_crc32) {
+        return gw_crc32(data, program_job.size) == program_job.expected_crc32;
+    }
+
+    return sha256_matches(data);
+}
+
+static void release_buffer(flashapp_t *flashapp)
+{
+    program_jobs[flashapp->buffer_idx].ready = 0;
+    flashapp->buffer_idx = (flashapp->buffer_idx + 1) % FLASHAPP_BUFFER_COUNT;
+}
+
+static void chunk_done(flashapp_t *flashapp)
+{
+    if (flashapp_comm.chunk_idx != flashapp_comm.chunk_count) {
+        // More chunks will be programmed, skip the init state.
+        state_set(FLASHAPP_IDLE);
+    } else {
+        sprintf(flashapp->tab.name, "Programming done!");
+        flashapp_comm.status = FLASHAPP_STATUS_DONE;
+        state_set(FLASHAPP_FINAL);
+    }
+}
+
+static void flashapp_run(flashapp_t *flashapp)
+{
+    switch (flashapp_comm.state) {
     case FLASHAPP_INIT:
         // Clear variables shared with the host
-        program_size = 0;
-        program_address = 0;
-        program_status = 0;
-        program_erase = 0;
-        program_erase_bytes = 0;
-        program_chunk_idx = 1;
-        program_chunk_count = 1;
-        memset(program_expected_sha256, 0, sizeof(program_expected_sha256));
-        memset(program_calculated_sha256, 0, sizeof(program_calculated_sha256));
+        memset(program_jobs, 0, sizeof(program_jobs));
+        memset(&program_job, 0, sizeof(program_job));
+        flashapp_comm.status = 0;
+        flashapp_comm.chunk_idx = 1;
+        flashapp_comm.chunk_count = 1;
+        flashapp->buffer_idx = 0;
 
         flashapp->progress_value = 0;
         flashapp->progress_max = 0;
@@ -355,41 +420,58 @@ static void flashapp_run(flashapp_t *flashapp)
         sprintf(flashapp->tab.name, "1. Waiting for data");
 
         // Notify that we are ready to start
-        program_status = FLASHAPP_STATUS_IDLE;
+        flashapp_comm.status = FLASHAPP_STATUS_IDLE;
         flashapp->progress_value = 0;
         flashapp->progress_max = 0;
 
-        // program_start is set by the flash script
-        switch (program_start) {
-        case 1: // Normal flash operation
-            program_start = 0;
-            state_inc();
-            break;
-        case 2: // Test flash
+        // program_start and program_jobs are set by the flash script
+        if (program_start == 2) { // Test flash
             program_start = 0;
             state_set(FLASHAPP_TEST_NEXT);
-            break;
-        default:
-            break;
+        } else if (program_jobs[flashapp->buffer_idx].ready) {
+            program_job = program_jobs[flashapp->buffer_idx];
+            flash_buffer = (uint8_t *) framebuffer2 + flashapp->buffer_idx * FLASHAPP_BUFFER_SIZE;
+            flashapp_comm.chunk_idx = program_job.chunk_idx;
+            state_inc();
         }
 
         break;
     case FLASHAPP_START:
-        program_status = FLASHAPP_STATUS_BUSY;
-        state_inc();
+        flashapp_comm.status = FLASHAPP_STATUS_BUSY;
+        if (program_job.compare == FLASHAPP_COMPARE_REQUESTED) {
+            state_set(FLASHAPP_COMPARE_FLASH);
+        } else if (program_job.compressed_size != 0) {
+            const uint8_t *frame = flash_buffer + FLASHAPP_BUFFER_SIZE - program_job.compressed_size;
+
+            sprintf(flashapp->tab.name, "2. Decompressing %ld bytes", program_job.compressed_size);
+
+            // Decoding in place needs some room between the data and the frame
+            if (program_job.size + program_job.compressed_size / 256 + 64 > FLASHAPP_BUFFER_SIZE ||
+                program_job.compressed_size > FLASHAPP_BUFFER_SIZE ||
+                lz4_stream_init(&flashapp->lz4, frame, flash_buffer, program_job.size) != LZ4_STREAM_MORE) {
+                sprintf(flashapp->tab.name, "*** Bad compressed data ***");
+                flashapp_comm.status = FLASHAPP_STATUS_BAD_COMPRESSION;
+                state_set(FLASHAPP_ERROR);
+                break;
+            }
+
+            flashapp->progress_value = 0;
+            flashapp->progress_max = program_job.size;
+            state_set(FLASHAPP_DECOMPRESS);
+        } else {
+            state_inc();
+        }
         break;
     case FLASHAPP_CHECK_HASH_RAM_NEXT:
-        sprintf(flashapp->tab.name, "2. Checking hash in RAM (%ld bytes)", program_size);
+        sprintf(flashapp->tab.name, "2. Checking hash in RAM (%ld bytes)", program_job.size);
         state_inc();
         break;
     case FLASHAPP_CHECK_HASH_RAM:
-        // Calculate sha256 hash of the RAM first
-        sha256_to_string(program_calculated_sha256, (const BYTE*) flash_buffer, program_size);
-
-        if (strncmp((char *)program_calculated_sha256, (char *)program_expected_sha256, 64) != 0) {
+        // Verify the RAM first
+        if (!verify(flash_buffer)) {
             // Hashes don't match even in RAM, openocd loading failed.
             sprintf(flashapp->tab.name, "*** Hash mismatch in RAM ***");
-            program_status = FLASHAPP_STATUS_BAD_HASH_RAM;
+            flashapp_comm.status = FLASHAPP_STATUS_BAD_HASH_RAM;
             state_set(FLASHAPP_ERROR);
             break;
         } else {
@@ -400,18 +482,27 @@ static void flashapp_run(flashapp_t *flashapp)
     case FLASHAPP_ERASE_NEXT:
         OSPI_DisableMemoryMappedMode();
 
-        if (program_erase) {
-            if (program_erase_bytes == 0) {
-                sprintf(flashapp->tab.name, "4. Performing Chip Erase (takes time)");
+        if (program_job.erase) {
+            flashapp->chip_erase = (program_job.erase_bytes == 0);
+
+            // Erasing the whole flash block by block is slower than a chip erase
+            if (program_job.erase_bytes > 0 && program_job.address == 0 &&
+                OSPI_GetSize() > 0 && program_job.erase_bytes >= OSPI_GetSize()) {
+                flashapp->chip_erase = true;
+            }
+
+            if (flashapp->chip_erase) {
+                sprintf(flashapp->tab.name, "4. Performing Chip Erase (~%ld s)",
+                        OSPI_ChipEraseEstimate() / 1000);
             } else {
-                flashapp->erase_address = program_address;
-                flashapp->erase_bytes_left = program_erase_bytes;
+                flashapp->erase_address = program_job.address;
+                flashapp->erase_bytes_left = program_job.erase_bytes;
 
                 uint32_t smallest_erase = OSPI_GetSmallestEraseSize();
 
                 if (flashapp->erase_address & (smallest_erase - 1)) {
                     sprintf(flashapp->tab.name, "** Address not aligned to smallest erase size! **");
-                    program_status = FLASHAPP_STATUS_NOT_ALIGNED;
+                    flashapp_comm.status = FLASHAPP_STATUS_NOT_ALIGNED;
                     state_set(FLASHAPP_ERROR);
                     break;
                 }
@@ -421,9 +512,13 @@ static void flashapp_run(flashapp_t *flashapp)
                     flashapp->erase_bytes_left += smallest_erase - (flashapp->erase_bytes_left & (smallest_erase - 1));
                 }
 
-                sprintf(flashapp->tab.name, "4. Erasing %ld bytes...", flashapp->erase_bytes_left);
+                uint32_t estimate_ms = OSPI_EraseEstimate(flashapp->erase_address,
+                                                          flashapp->erase_bytes_left, NULL);
+
+                sprintf(flashapp->tab.name, "4. Erasing %ld bytes (~%ld s)...",
+                        flashapp->erase_bytes_left, (estimate_ms + 999) / 1000);
                 printf("Erasing %ld bytes at 0x%08lx\n", flashapp->erase_bytes_left, flashapp->erase_address);
-                flashapp->progress_max = program_erase_bytes;
+                flashapp->progress_max = program_job.erase_bytes;
                 flashapp->progress_value = 0;
             }
             state_inc();
@@ -432,7 +527,7 @@ static void flashapp_run(flashapp_t *flashapp)
         }
         break;
     case FLASHAPP_ERASE:
-        if (program_erase_bytes == 0) {
+        if (flashapp->chip_erase) {
             OSPI_NOR_WriteEnable();
             OSPI_ChipErase();
             state_inc();
@@ -447,9 +542,9 @@ static void flashapp_run(flashapp_t *flashapp)
     case FLASHAPP_PROGRAM_NEXT:
         sprintf(flashapp->tab.name, "5. Programming...");
         flashapp->progress_value = 0;
-        flashapp->progress_max = program_size;
-        flashapp->current_program_address = program_address;
-        flashapp->program_bytes_left = program_size;
+        flashapp->progress_max = program_job.size;
+        flashapp->current_program_address = program_job.address;
+        flashapp->program_bytes_left = program_job.size;
         flashapp->program_buf = flash_buffer;
         state_inc();
         break;
@@ -457,13 +552,16 @@ static void flashapp_run(flashapp_t *flashapp)
         if (flashapp->program_bytes_left > 0) {
             uint32_t dest_page = flashapp->current_program_address / 256;
             uint32_t bytes_to_write = flashapp->program_bytes_left > 256 ? 256 : flashapp->program_bytes_left;
-            OSPI_NOR_WriteEnable();
-            OSPI_PageProgram(dest_page * 256, flashapp->program_buf, bytes_to_write);
+            // Skips pages that are all 0xff
+            OSPI_Program(dest_page * 256, flashapp->program_buf, bytes_to_write);
             flashapp->current_program_address += bytes_to_write;
             flashapp->program_buf += bytes_to_write;
             flashapp->program_bytes_left -= bytes_to_write;
-            flashapp->progress_value = program_size - flashapp->program_bytes_left;
+            flashapp->progress_value = program_job.size - flashapp->program_bytes_left;
         } else {
+            // The data is in the flash now, the host can load the next chunk
+            // into this buffer while the hash is checked
+            release_buffer(flashapp);
             state_inc();
         }
         break;
@@ -473,30 +571,49 @@ static void flashapp_run(flashapp_t *flashapp)
         state_inc();
         break;
     case FLASHAPP_CHECK_HASH_FLASH:
-        // Calculate sha256 hash of the FLASH.
-        sha256_to_string(program_calculated_sha256,
-                         (const BYTE*) (0x90000000 + program_address),
-                         program_size);
-
-        if (strncmp((char *)program_calculated_sha256, (char *)program_expected_sha256, 64) != 0) {
+        // Verify the FLASH.
+        if (!verify((const uint8_t *) (0x90000000 + program_job.address))) {
             // Hashes don't match in FLASH, programming failed.
             sprintf(flashapp->tab.name, "*** Hash mismatch in FLASH ***");
-            program_status = FLASHAPP_STATUS_BAD_HAS_FLASH;
+            flashapp_comm.status = FLASHAPP_STATUS_BAD_HAS_FLASH;
             state_set(FLASHAPP_ERROR);
         } else {
             sprintf(flashapp->tab.name, "7. Hash OK in FLASH.");
+            chunk_done(flashapp);
+        }
+        break;
+    case FLASHAPP_COMPARE_FLASH:
+        sprintf(flashapp->tab.name, "2. Comparing chunk %ld with FLASH", program_job.chunk_idx);
+        if (!sha256_matches((const uint8_t *) (0x90000000 + program_job.address))) {
+            // Keep the buffer, the host loads the data into it
+            program_jobs[flashapp->buffer_idx].compare = FLASHAPP_COMPARE_DIFFERENT;
+            program_jobs[flashapp->buffer_idx].ready = 0;
+            state_set(FLASHAPP_IDLE);
+        } else {
+            // Neither erase nor program what is already there
+            sprintf(flashapp->tab.name, "Chunk %ld identical, skipped", program_job.chunk_idx);
+            program_jobs[flashapp->buffer_idx].compare = FLASHAPP_COMPARE_IDENTICAL;
+            release_buffer(flashapp);
+            chunk_done(flashapp);
+        }
+        break;
+    case FLASHAPP_DECOMPRESS: {
+        int status = lz4_stream_run(&flashapp->lz4, 32 * 1024);
 
-            if (program_chunk_idx != program_chunk_count) {
-                // More chunks will be programmed, skip the init state.
-                program_chunk_idx++;
-                state_set(FLASHAPP_IDLE);
-            } else {
-                sprintf(flashapp->tab.name, "Programming done!");
-                program_status = FLASHAPP_STATUS_DONE;
-                state_set(FLASHAPP_FINAL);
-            }
+        flashapp->progress_value = flashapp->lz4.out_pos;
+
+        if (status == LZ4_STREAM_ERROR ||
+            (status == LZ4_STREAM_DONE && flashapp->lz4.out_pos != program_job.size)) {
+            sprintf(flashapp->tab.name, "*** Bad compressed data ***");
+            flashapp_comm.status = FLASHAPP_STATUS_BAD_COMPRESSION;
+            state_set(FLASHAPP_ERROR);
+        } else if (status == LZ4_STREAM_DONE) {
+            // The hash is of the decoded data, this checks the decoder too
+            flashapp->progress_max = 0;
+            state_set(FLASHAPP_CHECK_HASH_RAM_NEXT);
         }
         break;
+    }
     case FLASHAPP_TEST_NEXT:
         test_flash(flashapp);
         state_inc();
@@ -521,18 +638,18 @@ void flashapp_main(void)
     lcd_set_buffers(framebuffer1, framebuffer1);
 
     while (true) {
-        if (program_chunk_count == 1) {
+        if (flashapp_comm.chunk_count == 1) {
             sprintf(flashapp.tab.status, " Game and Watch Flash App");
         } else {
             sprintf(flashapp.tab.status, " Game and Watch Flash App (%ld/%ld)",
-                    program_chunk_idx, program_chunk_count);
+                    flashapp_comm.chunk_idx, flashapp_comm.chunk_count);
         }
 
         // Run multiple times to skip rendering when programming
         for (int i = 0; i < 128; i++) {
             wdog_refresh();
             flashapp_run(&flashapp);
-            if (flashapp_state != FLASHAPP_PROGRAM) {
+            if (flashapp_comm.state != FLASHAPP_PROGRAM) {
                 break;
             }
         }
@@ -5,25 +5,134 @@
 
 #include <stdbool.h>
 
+// The buttons are spread over three ports, each is read once. The port of
+// a button is a constant, so this picks the right snapshot at compile time.
+#define PRESSED(btn) ((( \
+    BTN_##btn##_GPIO_Port == GPIOA ? idr_a : \
+    BTN_##btn##_GPIO_Port == GPIOC ? idr_c : idr_d) & BTN_##btn##_Pin) == 0)
+
 uint32_t buttons_get() {
-    bool left = HAL_GPIO_ReadPin(BTN_Left_GPIO_Port, BTN_Left_Pin) == GPIO_PIN_RESET;
-    bool right = HAL_GPIO_ReadPin(BTN_Right_GPIO_Port, BTN_Right_Pin) == GPIO_PIN_RESET;
-    bool up = HAL_GPIO_ReadPin(BTN_Up_GPIO_Port, BTN_Up_Pin) == GPIO_PIN_RESET ;
-    bool down = HAL_GPIO_ReadPin(BTN_Down_GPIO_Port, BTN_Down_Pin) == GPIO_PIN_RESET;
-    bool a = HAL_GPIO_ReadPin(BTN_A_GPIO_Port, BTN_A_Pin) == GPIO_PIN_RESET;
-    bool b = HAL_GPIO_ReadPin(BTN_B_GPIO_Port, BTN_B_Pin) == GPIO_PIN_RESET;
-    bool time = HAL_GPIO_ReadPin(BTN_TIME_GPIO_Port, BTN_TIME_Pin) == GPIO_PIN_RESET;
-    bool game = HAL_GPIO_ReadPin(BTN_GAME_GPIO_Port, BTN_GAME_Pin) == GPIO_PIN_RESET;
-    bool pause = HAL_GPIO_ReadPin(BTN_PAUSE_GPIO_Port, BTN_PAUSE_Pin) == GPIO_PIN_RESET;
-    bool power = HAL_GPIO_ReadPin(BTN_PWR_GPIO_Port, BTN_PWR_Pin) == GPIO_PIN_RESET;
-
-    game |= HAL_GPIO_ReadPin(BTN_START_GPIO_Port, BTN_START_Pin) == GPIO_PIN_RESET;
-    time |= HAL_GPIO_ReadPin(BTN_SELECT_GPIO_Port, BTN_SELECT_Pin) == GPIO_PIN_RESET;
+    uint32_t idr_a = GPIOA->IDR;
+    uint32_t idr_c = GPIOC->IDR;
+    uint32_t idr_d = GPIOD->IDR;
+
+    bool left = PRESSED(Left);
+    bool right = PRESSED(Right);
+    bool up = PRESSED(Up);
+    bool down = PRESSED(Down);
+    bool a = PRESSED(A);
+    bool b = PRESSED(B);
+    bool time = PRESSED(TIME);
+    bool game = PRESSED(GAME);
+    bool pause = PRESSED(PAUSE);
+    bool power = PRESSED(PWR);
+
+    game |= PRESSED(START);
+    time |= PRESSED(SELECT);
 
     return (
         left | (up << 1) | (right << 2) | (down << 3) | (a << 4) | (b << 5) |
         (time << 6) | (game << 7) | (pause << 8) | (power << 9)
     );
+}
+
+#define BUTTONS_COUNT 10
+
+static bool scanning;
+static volatile uint32_t state;
+static volatile uint32_t tapped;
+static uint8_t hold_ms[BUTTONS_COUNT];
+
+static buttons_event_t events[BUTTONS_EVENT_COUNT];
+static volatile uint32_t event_head;
+static volatile uint32_t event_tail;
+
+void buttons_init(void)
+{
+    state = buttons_get();
+    scanning = true;
+}
+
+void buttons_scan(void)
+{
+    uint32_t buttons;
+    uint32_t changed = 0;
+
+    if (!scanning) {
+        return;
+    }
+
+    buttons = buttons_get();
+    for (int i = 0; i < BUTTONS_COUNT; i++) {
+        if (hold_ms[i] > 0) {
+            hold_ms[i]--;
+        } else if ((buttons ^ state) & (1 << i)) {
+            changed |= 1 << i;
+            hold_ms[i] = BUTTONS_DEBOUNCE_MS;
+        }
+    }
+
+    if (!changed) {
+        return;
+    }
+
+    state ^= changed;
+    tapped |= changed & state;
+
+    // Dropped when full, the state is still right
+    if (event_head - event_tail < BUTTONS_EVENT_COUNT) {
+        events[event_head % BUTTONS_EVENT_COUNT] = (buttons_event_t) {
+            .buttons = state,
+            .changed = changed,
+        };
+        event_head++;
+    }
+}
+
+uint32_t buttons_get_state(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    uint32_t buttons;
+
+    if (!scanning) {
+        return buttons_get();
+    }
+
+    __disable_irq();
+    buttons = state | tapped;
+    tapped = 0;
+    // Already in the state, they mustn't wake up the next wait
+    event_tail = event_head;
+    __set_PRIMASK(primask);
+
+    return buttons;
+}
+
+bool buttons_pop_event(buttons_event_t *event)
+{
+    if (event_tail == event_head) {
+        return false;
+    }
+
+    if (event) {
+        *event = events[event_tail % BUTTONS_EVENT_COUNT];
+    }
+    event_tail++;
+    return true;
+}
+
+bool buttons_wait_event(buttons_event_t *event, uint32_t timeout_ms)
+{
+    uint32_t start = HAL_GetTick();
 
+    // The SysTick wakes it up every millisecond
+    while (!buttons_pop_event(event)) {
+        if (HAL_GetTick() - start >= timeout_ms) {
+            return false;
+        }
+        wdog_refresh();
+        __WFI();
+    }
 
+    return true;
 }
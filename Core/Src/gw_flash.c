@@ -5,6 +5,7 @@
 #include <string.h>
 
 #include "gw_flash.h"
+#include "gw_linker.h"
 #include "main.h"
 #include "utils.h"
 
@@ -36,19 +37,21 @@
 }
 
 // Convenience macro to initialize a flash_config_t struct
-#define FLASH_CONFIG_DEF(_commands, _erase1_size, _erase2_size, _erase3_size, _erase4_size, _set_quad, _init_fn) \
-{                                                                                                                \
-    .commands    = (_commands),                                                                                  \
-    .erase_sizes = { (_erase1_size), (_erase2_size), (_erase3_size), (_erase4_size) },                           \
-    .set_quad    = (_set_quad),                                                                                  \
-    .init_fn     = (_init_fn),                                                                                   \
+#define FLASH_CONFIG_DEF(_commands, _erase1_size, _erase2_size, _erase3_size, _erase4_size, _set_quad, _xip, _init_fn) \
+{                                                                                                                      \
+    .commands    = (_commands),                                                                                        \
+    .erase_sizes = { (_erase1_size), (_erase2_size), (_erase3_size), (_erase4_size) },                                 \
+    .set_quad    = (_set_quad),                                                                                        \
+    .xip         = (_xip),                                                                                             \
+    .init_fn     = (_init_fn),                                                                                         \
 }
 
-#define JEDEC_CONFIG_DEF(_x0, _x1, _x2, _name, _config) \
-{                                                       \
-    .jedec_id.u32 = JEDEC_ID((_x0), (_x1), (_x2)),      \
-    .name         = (_name),                            \
-    .config       = (_config),                          \
+#define JEDEC_CONFIG_DEF(_x0, _x1, _x2, _name, _config, _size_mb) \
+{                                                                 \
+    .jedec_id.u32 = JEDEC_ID((_x0), (_x1), (_x2)),                \
+    .name         = (_name),                                      \
+    .config       = (_config),                                    \
+    .size         = (_size_mb) * 1024 * 1024,                     \
 }
 
 // Generic Status Register (SR) bits
@@ -71,6 +74,11 @@
 #define STATUS_SRWD_Pos  (7U)
 #define STATUS_SRWD_Msk  (1UL << STATUS_SRWD_Pos)
 
+// MX performance enhance mode: Sent as the mode byte of 4READ, the chip then
+// expects the next read to start with the address.
+#define MX_XIP_ENTER     (0xA5)
+#define MX_XIP_EXIT      (0xFF)
+
 // S (Spansion/Cypress/Infineon) specific CR bits
 #define S_CR_QUAD_Pos    (1U)
 #define S_CR_QUAD_Msk    (1UL << S_CR_QUAD_Pos)
@@ -131,6 +139,8 @@ enum {
 
     CMD_PP,         // Page Program
     CMD_READ,       // Read Data Bytes
+    CMD_SUS,        // Program/Erase Suspend
+    CMD_RES,        // Program/Erase Resume
 
     CMD_COUNT,
 };
@@ -150,6 +160,7 @@ typedef struct {
     const flash_cmd_t *commands;
     uint32_t           erase_sizes[4];  // [0] = ERASE1, ... [3] = ERASE4
     bool               set_quad;        // If quad mode should be enabled
+    bool               xip;             // If READ supports the MX performance enhance mode
     init_fn_t          init_fn;         // Chip/vendor specific init function
 } flash_config_t;
 
@@ -162,6 +173,7 @@ typedef struct {
     jedec_id_t            jedec_id;
     const char           *name;
     const flash_config_t *config;
+    uint32_t              size;
 } jedec_config_t;
 
 const flash_cmd_t cmds_spi_24b[CMD_COUNT] = {
@@ -180,6 +192,8 @@ const flash_cmd_t cmds_spi_24b[CMD_COUNT] = {
     [CMD_ERASE4] = { },
     [CMD_PP]     = CMD_DEF(0x02, LINES_1, LINES_1, ADDR_SIZE_24B, LINES_1,    0), // PP
     [CMD_READ]   = CMD_DEF(0x0B, LINES_1, LINES_1, ADDR_SIZE_24B, LINES_1,    8), // FAST_READ dummy=8
+    [CMD_SUS]    = { },
+    [CMD_RES]    = { },
 };
 
 const flash_cmd_t cmds_quad_24b_mx[CMD_COUNT] = {
@@ -198,6 +212,8 @@ const flash_cmd_t cmds_quad_24b_mx[CMD_COUNT] = {
     [CMD_ERASE4] = { },
     [CMD_PP]     = CMD_DEF(0x38, LINES_1, LINES_4, ADDR_SIZE_24B, LINES_4,    0), // 4PP
     [CMD_READ]   = CMD_DEF(0xEB, LINES_1, LINES_4, ADDR_SIZE_24B, LINES_4,    6), // 4READ dummy=6
+    [CMD_SUS]    = CMD_DEF(0xB0, LINES_1, LINES_0, ADDR_SIZE_24B, LINES_0,    0), // PGM/ERS Suspend
+    [CMD_RES]    = CMD_DEF(0x30, LINES_1, LINES_0, ADDR_SIZE_24B, LINES_0,    0), // PGM/ERS Resume
 };
 
 const flash_cmd_t cmds_quad_32b_mx[CMD_COUNT] = {
@@ -216,6 +232,8 @@ const flash_cmd_t cmds_quad_32b_mx[CMD_COUNT] = {
     [CMD_ERASE4] = { },
     [CMD_PP]     = CMD_DEF(0x3E, LINES_1, LINES_4, ADDR_SIZE_32B, LINES_4,    0), // 4PP4B
     [CMD_READ]   = CMD_DEF(0xEC, LINES_1, LINES_4, ADDR_SIZE_32B, LINES_4,    6), // 4READ4B dummy=6
+    [CMD_SUS]    = CMD_DEF(0xB0, LINES_1, LINES_0, ADDR_SIZE_24B, LINES_0,    0), // PGM/ERS Suspend
+    [CMD_RES]    = CMD_DEF(0x30, LINES_1, LINES_0, ADDR_SIZE_24B, LINES_0,    0), // PGM/ERS Resume
 };
 
 const flash_cmd_t cmds_quad_32b_mx54[CMD_COUNT] = {
@@ -234,6 +252,8 @@ const flash_cmd_t cmds_quad_32b_mx54[CMD_COUNT] = {
     [CMD_ERASE4] = { },
     [CMD_PP]     = CMD_DEF(0x38, LINES_1, LINES_4, ADDR_SIZE_32B, LINES_4,    0), // 4PP
     [CMD_READ]   = CMD_DEF(0xEB, LINES_1, LINES_4, ADDR_SIZE_32B, LINES_4,   10), // 4READ dummy=10
+    [CMD_SUS]    = CMD_DEF(0xB0, LINES_1, LINES_0, ADDR_SIZE_24B, LINES_0,    0), // PGM/ERS Suspend
+    [CMD_RES]    = CMD_DEF(0x30, LINES_1, LINES_0, ADDR_SIZE_24B, LINES_0,    0), // PGM/ERS Resume
 };
 
 const flash_cmd_t cmds_quad_32b_s[CMD_COUNT] = {
@@ -253,6 +273,8 @@ const flash_cmd_t cmds_quad_32b_s[CMD_COUNT] = {
     [CMD_ERASE4] = { },
     [CMD_PP]     = CMD_DEF(0x12, LINES_1, LINES_1, ADDR_SIZE_32B, LINES_1,     0), // 4PP (no 4PP4B)
     [CMD_READ]   = CMD_DEF(0xEC, LINES_1, LINES_4, ADDR_SIZE_32B, LINES_4, 2 + 8), // 4QIOR
+    [CMD_SUS]    = CMD_DEF(0x75, LINES_1, LINES_0, ADDR_SIZE_24B, LINES_0,     0), // Erase/Program Suspend
+    [CMD_RES]    = CMD_DEF(0x7A, LINES_1, LINES_0, ADDR_SIZE_24B, LINES_0,     0), // Erase/Program Resume
 };
 
 const flash_cmd_t cmds_quad_24b_issi[CMD_COUNT] = {
@@ -271,41 +293,106 @@ const flash_cmd_t cmds_quad_24b_issi[CMD_COUNT] = {
     [CMD_ERASE4] = { },
     [CMD_PP]     = CMD_DEF(0x38, LINES_1, LINES_1, ADDR_SIZE_24B, LINES_4,    0), // PPQ
     [CMD_READ]   = CMD_DEF(0xEB, LINES_1, LINES_4, ADDR_SIZE_24B, LINES_4,    6), // FRQIO dummy=6
+    [CMD_SUS]    = CMD_DEF(0x75, LINES_1, LINES_0, ADDR_SIZE_24B, LINES_0,    0), // Erase/Program Suspend
+    [CMD_RES]    = CMD_DEF(0x7A, LINES_1, LINES_0, ADDR_SIZE_24B, LINES_0,    0), // Erase/Program Resume
+};
+
+// QPI (4-4-4): Instructions are sent on 4 lines as well, which saves 6 of the
+// 8 instruction clocks of every memory-mapped burst compared to 1-4-4.
+// The chip is only in QPI mode after EQIO has been sent by init_mx_qpi.
+const flash_cmd_t cmds_qpi_24b_mx[CMD_COUNT] = {
+    // cmd                  cmd  i_lines  a_lines         a_size  d_lines  dummy
+    [CMD_WRSR]   = CMD_DEF(0x01, LINES_4, LINES_0, ADDR_SIZE_24B, LINES_4,    0),
+    [CMD_RDSR]   = CMD_DEF(0x05, LINES_4, LINES_0, ADDR_SIZE_24B, LINES_4,    0),
+    [CMD_RDCR]   = CMD_DEF(0x15, LINES_4, LINES_0, ADDR_SIZE_24B, LINES_4,    0),
+    [CMD_WREN]   = CMD_DEF(0x06, LINES_4, LINES_0, ADDR_SIZE_24B, LINES_0,    0),
+    [CMD_RDID]   = CMD_DEF(0xAF, LINES_4, LINES_0, ADDR_SIZE_24B, LINES_4,    0), // QPIID
+    [CMD_RSTEN]  = CMD_DEF(0x66, LINES_4, LINES_0, ADDR_SIZE_24B, LINES_0,    0),
+    [CMD_RST]    = CMD_DEF(0x99, LINES_4, LINES_0, ADDR_SIZE_24B, LINES_0,    0),
+    [CMD_CE]     = CMD_DEF(0x60, LINES_4, LINES_0, ADDR_SIZE_24B, LINES_0,    0), // CE    Chip Erase
+    [CMD_ERASE1] = CMD_DEF(0x20, LINES_4, LINES_4, ADDR_SIZE_24B, LINES_0,    0), // SE    Sector Erase
+    [CMD_ERASE2] = CMD_DEF(0x52, LINES_4, LINES_4, ADDR_SIZE_24B, LINES_0,    0), // BE32K Block Erase 32K
+    [CMD_ERASE3] = CMD_DEF(0xD8, LINES_4, LINES_4, ADDR_SIZE_24B, LINES_0,    0), // BE    Block Erase 64K
+    [CMD_ERASE4] = { },
+    [CMD_PP]     = CMD_DEF(0x02, LINES_4, LINES_4, ADDR_SIZE_24B, LINES_4,    0), // PP (4PP is SPI only)
+    [CMD_READ]   = CMD_DEF(0xEB, LINES_4, LINES_4, ADDR_SIZE_24B, LINES_4,    6), // 4READ dummy=6
+    [CMD_SUS]    = CMD_DEF(0xB0, LINES_4, LINES_0, ADDR_SIZE_24B, LINES_0,    0), // PGM/ERS Suspend
+    [CMD_RES]    = CMD_DEF(0x30, LINES_4, LINES_0, ADDR_SIZE_24B, LINES_0,    0), // PGM/ERS Resume
+};
+
+const flash_cmd_t cmds_qpi_32b_mx[CMD_COUNT] = {
+    // cmd                  cmd  i_lines  a_lines         a_size  d_lines  dummy
+    [CMD_WRSR]   = CMD_DEF(0x01, LINES_4, LINES_0, ADDR_SIZE_24B, LINES_4,    0),
+    [CMD_RDSR]   = CMD_DEF(0x05, LINES_4, LINES_0, ADDR_SIZE_24B, LINES_4,    0),
+    [CMD_RDCR]   = CMD_DEF(0x15, LINES_4, LINES_0, ADDR_SIZE_24B, LINES_4,    0),
+    [CMD_WREN]   = CMD_DEF(0x06, LINES_4, LINES_0, ADDR_SIZE_24B, LINES_0,    0),
+    [CMD_RDID]   = CMD_DEF(0xAF, LINES_4, LINES_0, ADDR_SIZE_24B, LINES_4,    0), // QPIID
+    [CMD_RSTEN]  = CMD_DEF(0x66, LINES_4, LINES_0, ADDR_SIZE_24B, LINES_0,    0),
+    [CMD_RST]    = CMD_DEF(0x99, LINES_4, LINES_0, ADDR_SIZE_24B, LINES_0,    0),
+    [CMD_CE]     = CMD_DEF(0x60, LINES_4, LINES_0, ADDR_SIZE_24B, LINES_0,    0), // CE    Chip Erase
+    [CMD_ERASE1] = CMD_DEF(0x21, LINES_4, LINES_4, ADDR_SIZE_32B, LINES_0,    0), // SE    Sector Erase
+    [CMD_ERASE2] = CMD_DEF(0x5C, LINES_4, LINES_4, ADDR_SIZE_32B, LINES_0,    0), // BE32K Block Erase 32K
+    [CMD_ERASE3] = CMD_DEF(0xDC, LINES_4, LINES_4, ADDR_SIZE_32B, LINES_0,    0), // BE    Block Erase 64K
+    [CMD_ERASE4] = { },
+    [CMD_PP]     = CMD_DEF(0x12, LINES_4, LINES_4, ADDR_SIZE_32B, LINES_4,    0), // PP4B
+    [CMD_READ]   = CMD_DEF(0xEC, LINES_4, LINES_4, ADDR_SIZE_32B, LINES_4,    6), // 4READ4B dummy=6
+    [CMD_SUS]    = CMD_DEF(0xB0, LINES_4, LINES_0, ADDR_SIZE_24B, LINES_0,    0), // PGM/ERS Suspend
+    [CMD_RES]    = CMD_DEF(0x30, LINES_4, LINES_0, ADDR_SIZE_24B, LINES_0,    0), // PGM/ERS Resume
 };
 
+// Sent in SPI mode to switch to QPI, and in QPI mode to reset a chip that
+// was left in QPI mode, e.g. when the MCU was reset by the debugger.
+const flash_cmd_t cmd_spi_eqio  = CMD_DEF(0x35, LINES_1, LINES_0, ADDR_SIZE_24B, LINES_0, 0);
+const flash_cmd_t cmd_qpi_rsten = CMD_DEF(0x66, LINES_4, LINES_0, ADDR_SIZE_24B, LINES_0, 0);
+const flash_cmd_t cmd_qpi_rst   = CMD_DEF(0x99, LINES_4, LINES_0, ADDR_SIZE_24B, LINES_0, 0);
+
+// 4READ without the instruction, see exit_xip
+const flash_cmd_t cmd_xip_exit  = CMD_DEF(0x00, LINES_0, LINES_4, ADDR_SIZE_32B, LINES_4, 4);
+
 static void init_spansion(void);
 static void init_mx_issi(void);
-
-const flash_config_t config_spi_24b       = FLASH_CONFIG_DEF(cmds_spi_24b,       0x01000,  0x8000, 0x10000, 0,  false, NULL);
-const flash_config_t config_quad_24b_mx   = FLASH_CONFIG_DEF(cmds_quad_24b_mx,   0x01000,  0x8000, 0x10000, 0,   true, init_mx_issi);
-const flash_config_t config_quad_32b_mx   = FLASH_CONFIG_DEF(cmds_quad_32b_mx,   0x01000,  0x8000, 0x10000, 0,   true, init_mx_issi);
-const flash_config_t config_quad_32b_mx54 = FLASH_CONFIG_DEF(cmds_quad_32b_mx54, 0x01000,  0x8000, 0x10000, 0,   true, init_mx_issi);
-const flash_config_t config_quad_32b_s    = FLASH_CONFIG_DEF(cmds_quad_32b_s,    0x40000,       0,       0, 0,   true, init_spansion);
-const flash_config_t config_quad_24b_issi = FLASH_CONFIG_DEF(cmds_quad_24b_issi, 0x01000,  0x8000, 0x10000, 0,   true, init_mx_issi);
+static void init_mx_qpi(void);
+
+const flash_config_t config_spi_24b       = FLASH_CONFIG_DEF(cmds_spi_24b,       0x01000,  0x8000, 0x10000, 0, false, false, NULL);
+const flash_config_t config_quad_24b_mx   = FLASH_CONFIG_DEF(cmds_quad_24b_mx,   0x01000,  0x8000, 0x10000, 0,  true,  true, init_mx_issi);
+const flash_config_t config_quad_32b_mx   = FLASH_CONFIG_DEF(cmds_quad_32b_mx,   0x01000,  0x8000, 0x10000, 0,  true,  true, init_mx_issi);
+const flash_config_t config_quad_32b_mx54 = FLASH_CONFIG_DEF(cmds_quad_32b_mx54, 0x01000,  0x8000, 0x10000, 0,  true,  true, init_mx_issi);
+const flash_config_t config_quad_32b_s    = FLASH_CONFIG_DEF(cmds_quad_32b_s,    0x40000,       0,       0, 0,  true, false, init_spansion);
+const flash_config_t config_quad_24b_issi = FLASH_CONFIG_DEF(cmds_quad_24b_issi, 0x01000,  0x8000, 0x10000, 0,  true, false, init_mx_issi);
+const flash_config_t config_qpi_24b_mx    = FLASH_CONFIG_DEF(cmds_qpi_24b_mx,    0x01000,  0x8000, 0x10000, 0,  true,  true, init_mx_qpi);
+const flash_config_t config_qpi_32b_mx    = FLASH_CONFIG_DEF(cmds_qpi_32b_mx,    0x01000,  0x8000, 0x10000, 0,  true,  true, init_mx_qpi);
+
+#if (EXTFLASH_QPI == 1)
+#define CONFIG_24B_MX (&config_qpi_24b_mx)
+#define CONFIG_32B_MX (&config_qpi_32b_mx)
+#else
+#define CONFIG_24B_MX (&config_quad_24b_mx)
+#define CONFIG_32B_MX (&config_quad_32b_mx)
+#endif
 
 const jedec_config_t jedec_map[] = {
 #if (EXTFLASH_FORCE_SPI == 0)
     // MX 24 bit address
-    JEDEC_CONFIG_DEF(0xC2, 0x25, 0x34, "MX25U8035F",  &config_quad_24b_mx),   // Stock 1MB (Mario)
-    JEDEC_CONFIG_DEF(0xC2, 0x25, 0x36, "MX25U3232F",  &config_quad_24b_mx),   // Stock 4MB (Zelda)
-    JEDEC_CONFIG_DEF(0xC2, 0x25, 0x37, "MX25U6432F",  &config_quad_24b_mx),   // 8MB
-    JEDEC_CONFIG_DEF(0xC2, 0x25, 0x38, "MX25U1283xF", &config_quad_24b_mx),   // 16MB MX25U12832F, MX25U12835F
+    JEDEC_CONFIG_DEF(0xC2, 0x25, 0x34, "MX25U8035F",  CONFIG_24B_MX,   1), // Stock 1MB (Mario)
+    JEDEC_CONFIG_DEF(0xC2, 0x25, 0x36, "MX25U3232F",  CONFIG_24B_MX,   4), // Stock 4MB (Zelda)
+    JEDEC_CONFIG_DEF(0xC2, 0x25, 0x37, "MX25U6432F",  CONFIG_24B_MX,   8), // 8MB
+    JEDEC_CONFIG_DEF(0xC2, 0x25, 0x38, "MX25U1283xF", CONFIG_24B_MX,  16), // 16MB MX25U12832F, MX25U12835F
 
     // MX 32 bit address
-    JEDEC_CONFIG_DEF(0xC2, 0x25, 0x39, "MX25U25635F",    &config_quad_32b_mx),   // 32 MB
-    JEDEC_CONFIG_DEF(0xC2, 0x25, 0x3A, "MX25U51245G",    &config_quad_32b_mx),   // 64 MB
-    JEDEC_CONFIG_DEF(0xC2, 0x95, 0x3A, "MX25U51245G-54", &config_quad_32b_mx54), // 64 MB
-    JEDEC_CONFIG_DEF(0xC2, 0x25, 0x3B, "MX66U1G45G",     &config_quad_32b_mx),   // 128 MB
-    JEDEC_CONFIG_DEF(0xC2, 0x25, 0x3C, "MX66U2G45G",     &config_quad_32b_mx),   // 256 MB
+    JEDEC_CONFIG_DEF(0xC2, 0x25, 0x39, "MX25U25635F",    CONFIG_32B_MX,          32), // 32 MB
+    JEDEC_CONFIG_DEF(0xC2, 0x25, 0x3A, "MX25U51245G",    CONFIG_32B_MX,          64), // 64 MB
+    JEDEC_CONFIG_DEF(0xC2, 0x95, 0x3A, "MX25U51245G-54", &config_quad_32b_mx54,  64), // 64 MB
+    JEDEC_CONFIG_DEF(0xC2, 0x25, 0x3B, "MX66U1G45G",     CONFIG_32B_MX,         128), // 128 MB
+    JEDEC_CONFIG_DEF(0xC2, 0x25, 0x3C, "MX66U2G45G",     CONFIG_32B_MX,         256), // 256 MB
 
     // Cypress/Infineon 32 bit address
     // These chips only have 64kB erase size which won't work well with the rest of the code.
-    JEDEC_CONFIG_DEF(0x01, 0x02, 0x20, "S25FS512S",   &config_quad_32b_s), // 64 MB
-    JEDEC_CONFIG_DEF(0x34, 0x2B, 0x1A, "S25FS512S",   &config_quad_32b_s), // 64 MB
+    JEDEC_CONFIG_DEF(0x01, 0x02, 0x20, "S25FS512S",  &config_quad_32b_s,     64), // 64 MB
+    JEDEC_CONFIG_DEF(0x34, 0x2B, 0x1A, "S25FS512S",  &config_quad_32b_s,     64), // 64 MB
 
     // ISSI 24 bit *untested*
     // TODO: Test and uncomment when it's confirmed they work well.
-    JEDEC_CONFIG_DEF(0x9D, 0x70, 0x18, "IS25WP128F",  &config_quad_24b_issi), // 16MB
+    JEDEC_CONFIG_DEF(0x9D, 0x70, 0x18, "IS25WP128F", &config_quad_24b_issi,  16), // 16MB
 #endif
 };
 
@@ -315,12 +402,50 @@ static struct {
     jedec_id_t            jedec_id;
     const flash_config_t *config;
     const char           *name;
+    uint32_t              size;             // 0 if unknown
     bool                  mem_mapped_enabled;
+    bool                  xip_enabled;
+    uint32_t              dirty_start;      // Written while not memory-mapped
+    uint32_t              dirty_end;
 } flash = {
     .config = &config_spi_24b, // Default config to use to probe status etc.
     .name = "Unknown",
+    .dirty_start = UINT32_MAX,
 };
 
+// The memory-mapped flash is cacheable. Lines that were read before an erase
+// or program would return the old contents afterwards, e.g. to code that
+// reads a save state straight from the flash.
+static void mark_dirty(uint32_t address, uint32_t size)
+{
+    if (address < flash.dirty_start) {
+        flash.dirty_start = address;
+    }
+    if (address + size > flash.dirty_end) {
+        flash.dirty_end = address + size;
+    }
+}
+
+static void invalidate_dirty(void)
+{
+    if (flash.dirty_start >= flash.dirty_end) {
+        return;
+    }
+
+    uint32_t start = flash.dirty_start & ~31;
+    uint32_t size = flash.dirty_end - start;
+
+    // Going by address is slower than cleaning the whole cache for large areas
+    if (size > 64 * 1024) {
+        SCB_CleanInvalidateDCache();
+    } else {
+        SCB_InvalidateDCache_by_Addr((uint32_t *) (&__EXTFLASH_BASE__ + start), size);
+    }
+
+    flash.dirty_start = UINT32_MAX;
+    flash.dirty_end = 0;
+}
+
 static void set_ospi_cmd(OSPI_RegularCmdTypeDef *ospi_cmd,
                          const flash_cmd_t *cmd,
                          uint32_t address,
@@ -430,6 +555,33 @@ static void wait_for_status(uint8_t mask, uint8_t value, uint32_t timeout)
     } while ((status & mask) != value);
 }
 
+// Leaves the performance enhance mode with a read that starts with the
+// address and doesn't toggle the mode bits. The address is sent as 32 bits
+// of zeros, so a chip with 24 bit addresses takes the last byte of it as the
+// mode byte. A chip that isn't in that mode sees an incomplete READ and
+// ignores it.
+static void exit_xip(void)
+{
+    OSPI_RegularCmdTypeDef ospi_cmd;
+    uint8_t dummy;
+
+    set_ospi_cmd(&ospi_cmd, &cmd_xip_exit, 0, &dummy, 1);
+    ospi_cmd.AlternateBytes = MX_XIP_EXIT;
+    ospi_cmd.AlternateBytesMode = HAL_OSPI_ALTERNATE_BYTES_4_LINES;
+    ospi_cmd.AlternateBytesSize = HAL_OSPI_ALTERNATE_BYTES_8_BITS;
+    ospi_cmd.AlternateBytesDtrMode = HAL_OSPI_ALTERNATE_BYTES_DTR_DISABLE;
+
+    if (HAL_OSPI_Command(flash.hospi, &ospi_cmd, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK) {
+        Error_Handler();
+    }
+
+    if (HAL_OSPI_Receive(flash.hospi, &dummy, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK) {
+        Error_Handler();
+    }
+
+    flash.xip_enabled = false;
+}
+
 void OSPI_EnableMemoryMappedMode(void)
 {
     OSPI_MemoryMappedTypeDef sMemMappedCfg;
@@ -440,6 +592,20 @@ void OSPI_EnableMemoryMappedMode(void)
 
     set_ospi_cmd(&ospi_cmd, cmd, 0, NULL, 0);
 
+#if (EXTFLASH_XIP == 1)
+    if (flash.config->xip) {
+        // The mode byte takes up 2 of the dummy cycles on 4 lines. Only the
+        // first read sends the instruction, the rest start with the address.
+        ospi_cmd.AlternateBytes = MX_XIP_ENTER;
+        ospi_cmd.AlternateBytesMode = HAL_OSPI_ALTERNATE_BYTES_4_LINES;
+        ospi_cmd.AlternateBytesSize = HAL_OSPI_ALTERNATE_BYTES_8_BITS;
+        ospi_cmd.AlternateBytesDtrMode = HAL_OSPI_ALTERNATE_BYTES_DTR_DISABLE;
+        ospi_cmd.DummyCycles = cmd->dummy - 2;
+        ospi_cmd.SIOOMode = HAL_OSPI_SIOO_INST_ONLY_FIRST_CMD;
+        flash.xip_enabled = true;
+    }
+#endif
+
     // Memory-mapped mode configuration for linear burst read operations
     ospi_cmd.OperationType = HAL_OSPI_OPTYPE_READ_CFG;
     if (HAL_OSPI_Command(flash.hospi, &ospi_cmd, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK) {
@@ -452,9 +618,16 @@ void OSPI_EnableMemoryMappedMode(void)
         Error_Handler();
     }
 
-    // Disable timeout counter for memory mapped mode
+    // Without the timeout the OCTOSPI keeps prefetching the following data
+    // after a burst, with it CS is released after EXTFLASH_MMAP_TIMEOUT idle
+    // clocks. Sequential reads benefit from the former.
+#if (EXTFLASH_MMAP_TIMEOUT > 0)
+    sMemMappedCfg.TimeOutActivation = HAL_OSPI_TIMEOUT_COUNTER_ENABLE;
+    sMemMappedCfg.TimeOutPeriod = EXTFLASH_MMAP_TIMEOUT;
+#else
     sMemMappedCfg.TimeOutActivation = HAL_OSPI_TIMEOUT_COUNTER_DISABLE;
     sMemMappedCfg.TimeOutPeriod = 0;
+#endif
 
     // Enable memory mapped mode
     if (HAL_OSPI_MemoryMapped(flash.hospi, &sMemMappedCfg) != HAL_OK) {
@@ -462,6 +635,8 @@ void OSPI_EnableMemoryMappedMode(void)
     }
 
     flash.mem_mapped_enabled = true;
+
+    invalidate_dirty();
 }
 
 void OSPI_DisableMemoryMappedMode(void)
@@ -472,6 +647,10 @@ void OSPI_DisableMemoryMappedMode(void)
 
     flash.mem_mapped_enabled = false;
 
+    if (flash.xip_enabled) {
+        exit_xip();
+    }
+
     // This will *ONLY* work if you absolutely don't
     // look at the memory mapped address.
     // See here:
@@ -490,9 +669,91 @@ static void _OSPI_Erase(const flash_cmd_t *cmd, uint32_t address)
 void OSPI_ChipErase(void)
 {
     DBG("CE\n");
+    mark_dirty(0, flash.size ? flash.size : UINT32_MAX);
     _OSPI_Erase(CMD(CE), 0); // Chip Erase
 }
 
+// Returns the index of the largest erase command that can be used at address,
+// or -1 if there is none.
+static int erase_index(uint32_t address, uint32_t size)
+{
+    // Assumes that erase sizes are sorted: 4 > 3 > 2 > 1.
+    // Assumes that erase sizes are powers of two.
+
+    for (int i = 3; i >= 0; i--) {
+        uint32_t erase_size = flash.config->erase_sizes[i];
+
+        if (erase_size == 0) {
+            continue;
+        }
+
+        if ((size >= erase_size) && ((address & (erase_size - 1)) == 0)) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+static const flash_cmd_t *erase_cmd(int index)
+{
+    const flash_cmd_t * erase_cmds[] = {
+        CMD(ERASE1),
+        CMD(ERASE2),
+        CMD(ERASE3),
+        CMD(ERASE4),
+    };
+
+    return erase_cmds[index];
+}
+
+// Typical erase times from the datasheets, in ms
+static uint32_t erase_time_ms(uint32_t erase_size)
+{
+    switch (erase_size) {
+    case 0x01000: return 30;
+    case 0x08000: return 150;
+    case 0x10000: return 250;
+    case 0x40000: return 520;
+    default:      return erase_size / 256;
+    }
+}
+
+uint32_t OSPI_EraseEstimate(uint32_t address, uint32_t size, uint32_t counts[4])
+{
+    uint32_t ms = 0;
+
+    if (counts != NULL) {
+        memset(counts, 0, 4 * sizeof(uint32_t));
+    }
+
+    // The same choices as OSPI_Erase. Taking the largest aligned size at every
+    // step is optimal since the sizes are powers of two: a smaller block is
+    // only used until the address is aligned to the next larger one.
+    while (size > 0) {
+        int i = erase_index(address, size);
+
+        if (i < 0) {
+            return UINT32_MAX;
+        }
+
+        if (counts != NULL) {
+            counts[i]++;
+        }
+        ms += erase_time_ms(flash.config->erase_sizes[i]);
+        address += flash.config->erase_sizes[i];
+        size -= flash.config->erase_sizes[i];
+    }
+
+    return ms;
+}
+
+uint32_t OSPI_ChipEraseEstimate(void)
+{
+    // Around 2.5 s per MB for the MX25U parts
+    return (flash.size / (1024 * 1024)) * 2500;
+}
+
 bool OSPI_Erase(uint32_t *address, uint32_t *size)
 {
     // Performs one erase command per call with the largest size possible.
@@ -508,34 +769,21 @@ bool OSPI_Erase(uint32_t *address, uint32_t *size)
 
     DBG("E 0x%lx %ld\n", req_address, req_size);
 
-    // Assumes that erase sizes are sorted: 4 > 3 > 2 > 1.
-    // Assumes that erase sizes are powers of two.
+    int i = erase_index(req_address, req_size);
 
-    const flash_cmd_t * erase_cmd[] = {
-        CMD(ERASE1),
-        CMD(ERASE2),
-        CMD(ERASE3),
-        CMD(ERASE4),
-    };
-
-    for (int i = 3; i >= 0; i--) {
+    if (i >= 0) {
         uint32_t erase_size = flash.config->erase_sizes[i];
 
-        if (erase_size == 0) {
-            continue;
-        }
-
-        if ((req_size >= erase_size) && ((req_address & (erase_size - 1)) == 0)) {
-            *size = req_size - erase_size;
-            *address = req_address + erase_size;
+        *size = req_size - erase_size;
+        *address = req_address + erase_size;
 
-            DBG("Erasing block (%ld): 0x%08lx (%ld left)\n", erase_size, req_address, *size);
+        DBG("Erasing block (%ld): 0x%08lx (%ld left)\n", erase_size, req_address, *size);
 
-            OSPI_NOR_WriteEnable();
-            _OSPI_Erase(erase_cmd[i], req_address);
+        mark_dirty(req_address, erase_size);
+        OSPI_NOR_WriteEnable();
+        _OSPI_Erase(erase_cmd(i), req_address);
 
-            return (*size == 0);
-        }
+        return (*size == 0);
     }
 
     DBG("No suitable erase command found for addr=%08lx size=%ld!\n", *address, *size);
@@ -562,6 +810,7 @@ void OSPI_PageProgram(uint32_t address,
 
     DBG("PP cmd=%02X addr=0x%lx buf=%p len=%d\n", (*CMD(PP)).cmd, address, buffer, buffer_size);
 
+    mark_dirty(address, buffer_size);
     OSPI_WriteBytes(CMD(PP), address, buffer, buffer_size);
 
     // Wait for Write In Progress Bit to become zero
@@ -576,6 +825,19 @@ void OSPI_NOR_WriteEnable(void)
     wait_for_status(STATUS_WEL_Msk, STATUS_WEL_Msk, TMO_DEFAULT);
 }
 
+// Programming only clears bits, so pages of 0xff don't need to be written.
+// ROM images have lots of them in their padding and unused banks.
+static bool page_is_blank(const uint8_t *buffer, size_t size)
+{
+    for (size_t i = 0; i < size; i++) {
+        if (buffer[i] != 0xff) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 void OSPI_Program(uint32_t address,
                   const uint8_t *buffer,
                   size_t buffer_size)
@@ -586,14 +848,217 @@ void OSPI_Program(uint32_t address,
     assert((address & 0xff) == 0);
 
     for (int i = 0; i < iterations; i++) {
-        OSPI_NOR_WriteEnable();
-        OSPI_PageProgram((i + dest_page) * 256,
-                         buffer + (i * 256),
-                         buffer_size > 256 ? 256 : buffer_size);
+        size_t size = buffer_size > 256 ? 256 : buffer_size;
+
+        if (!page_is_blank(buffer + (i * 256), size)) {
+            OSPI_NOR_WriteEnable();
+            OSPI_PageProgram((i + dest_page) * 256, buffer + (i * 256), size);
+        }
         buffer_size -= 256;
     }
 }
 
+// Asynchronous erase and program. Every job is split into erase commands or
+// page programs, and the OCTOSPI polls the status register in auto-polling
+// mode after each of them. The status match interrupt starts the next one.
+
+#define ASYNC_QUEUE_LEN 4
+
+typedef struct {
+    bool           erase;
+    uint32_t       address;
+    const uint8_t *buffer;
+    uint32_t       size;
+} async_job_t;
+
+static struct {
+    async_job_t    queue[ASYNC_QUEUE_LEN];
+    volatile uint32_t head;     // Next free slot
+    volatile uint32_t tail;     // Job in progress
+    volatile bool  running;
+    bool           suspended;   // Only set while the interrupt is disabled
+} async;
+
+static void async_poll_wip(void)
+{
+    OSPI_RegularCmdTypeDef ospi_cmd;
+    OSPI_AutoPollingTypeDef polling = {
+        .Match         = 0,
+        .Mask          = STATUS_WIP_Msk,
+        .MatchMode     = HAL_OSPI_MATCH_MODE_AND,
+        .AutomaticStop = HAL_OSPI_AUTOMATIC_STOP_ENABLE,
+        .Interval      = 0x10,
+    };
+
+    set_ospi_cmd(&ospi_cmd, CMD(RDSR), 0, NULL, 1);
+
+    if (HAL_OSPI_Command(flash.hospi, &ospi_cmd, HAL_OSPI_TIMEOUT_DEFAULT_VALUE) != HAL_OK) {
+        Error_Handler();
+    }
+
+    if (HAL_OSPI_AutoPolling_IT(flash.hospi, &polling) != HAL_OK) {
+        Error_Handler();
+    }
+}
+
+// Starts the next erase command or page program, or stops when the queue is
+// empty. Called from the status match interrupt.
+static void async_next(void)
+{
+    while (async.tail != async.head) {
+        async_job_t *job = &async.queue[async.tail % ASYNC_QUEUE_LEN];
+
+        if (job->size == 0) {
+            async.tail++;
+            continue;
+        }
+
+        if (job->erase) {
+            int i = erase_index(job->address, job->size);
+            assert(i >= 0);
+
+            OSPI_NOR_WriteEnable();
+            OSPI_WriteBytes(erase_cmd(i), job->address, NULL, 0);
+            job->address += flash.config->erase_sizes[i];
+            job->size -= flash.config->erase_sizes[i];
+        } else {
+            uint32_t n = 256 - (job->address & 0xff);
+            if (n > job->size) {
+                n = job->size;
+            }
+
+            bool blank = page_is_blank(job->buffer, n);
+            if (!blank) {
+                OSPI_NOR_WriteEnable();
+                OSPI_WriteBytes(CMD(PP), job->address, job->buffer, n);
+            }
+            job->address += n;
+            job->buffer += n;
+            job->size -= n;
+
+            if (blank) {
+                continue;
+            }
+        }
+
+        async_poll_wip();
+        return;
+    }
+
+    async.running = false;
+}
+
+void HAL_OSPI_StatusMatchCallback(OSPI_HandleTypeDef *hospi)
+{
+    async_next();
+}
+
+static bool async_push(bool erase, uint32_t address, const uint8_t *buffer, uint32_t size)
+{
+    bool start;
+
+    assert(flash.mem_mapped_enabled == false);
+
+    mark_dirty(address, size);
+
+    __disable_irq();
+    if (async.head - async.tail >= ASYNC_QUEUE_LEN) {
+        __enable_irq();
+        return false;
+    }
+
+    async.queue[async.head % ASYNC_QUEUE_LEN] = (async_job_t) {
+        .erase   = erase,
+        .address = address,
+        .buffer  = buffer,
+        .size    = size,
+    };
+    async.head++;
+
+    start = !async.running;
+    async.running = true;
+    __enable_irq();
+
+    if (start) {
+        async_next();
+    }
+
+    return true;
+}
+
+bool OSPI_EraseAsync(uint32_t address, uint32_t size)
+{
+    assert(erase_index(address, size) >= 0);
+
+    return async_push(true, address, NULL, size);
+}
+
+bool OSPI_ProgramAsync(uint32_t address, const uint8_t *buffer, size_t buffer_size)
+{
+    return async_push(false, address, buffer, buffer_size);
+}
+
+bool OSPI_AsyncSuspend(void)
+{
+    uint8_t status;
+
+    if (!async.running || CMD(SUS)->instr_lines == LINES_0) {
+        return false;
+    }
+
+    // Keep the status match interrupt from starting anything else
+    HAL_NVIC_DisableIRQ(OCTOSPI1_IRQn);
+    if (!async.running) {
+        HAL_NVIC_EnableIRQ(OCTOSPI1_IRQn);
+        return false;
+    }
+
+    HAL_OSPI_Abort(flash.hospi);
+    HAL_NVIC_ClearPendingIRQ(OCTOSPI1_IRQn);
+
+    // If the command finished in the meantime there is nothing to suspend,
+    // the next one is started on resume.
+    OSPI_ReadBytes(CMD(RDSR), 0, &status, 1);
+    async.suspended = (status & STATUS_WIP_Msk) != 0;
+
+    if (async.suspended) {
+        OSPI_WriteBytes(CMD(SUS), 0, NULL, 0);
+
+        // The suspend latency is tens of us
+        wait_for_status(STATUS_WIP_Msk, 0, TMO_DEFAULT);
+    }
+
+    return true;
+}
+
+void OSPI_AsyncResume(void)
+{
+    assert(flash.mem_mapped_enabled == false);
+
+    if (async.suspended) {
+        async.suspended = false;
+        OSPI_WriteBytes(CMD(RES), 0, NULL, 0);
+        async_poll_wip();
+    } else {
+        async_next();
+    }
+
+    HAL_NVIC_EnableIRQ(OCTOSPI1_IRQn);
+}
+
+bool OSPI_AsyncBusy(void)
+{
+    return async.running;
+}
+
+void OSPI_AsyncWait(void)
+{
+    while (async.running) {
+        wdog_refresh();
+        __WFI();
+    }
+}
+
 void OSPI_ReadJedecId(uint8_t dest[3])
 {
     OSPI_ReadBytes(CMD(RDID), 0, dest, 3);
@@ -636,6 +1101,21 @@ static void init_mx_issi(void)
     }
 }
 
+static void init_mx_qpi(void)
+{
+    const flash_config_t *qpi_config = flash.config;
+
+    DBG("%s\n", __FUNCTION__);
+
+    // The QE bit is set with the SPI commands, the chip isn't in QPI mode yet
+    flash.config = (qpi_config == &config_qpi_32b_mx) ? &config_quad_32b_mx : &config_quad_24b_mx;
+    init_mx_issi();
+
+    OSPI_WriteBytes(&cmd_spi_eqio, 0, NULL, 0);
+
+    flash.config = qpi_config;
+}
+
 static void init_spansion(void)
 {
     uint8_t rd_sr1;
@@ -683,6 +1163,11 @@ const char* OSPI_GetFlashName(void)
     return flash.name;
 }
 
+uint32_t OSPI_GetSize(void)
+{
+    return flash.size;
+}
+
 uint32_t OSPI_GetSmallestEraseSize(void)
 {
     // Assumes that erase sizes are sorted: 4 > 3 > 2 > 1.
@@ -695,6 +1180,21 @@ void OSPI_Init(OSPI_HandleTypeDef *hospi)
 
     flash.hospi = hospi;
 
+#if (EXTFLASH_XIP == 1)
+    // In case only the MCU was reset, the chip doesn't react to anything else
+    // while it's in performance enhance mode.
+    exit_xip();
+#endif
+
+#if (EXTFLASH_QPI == 1)
+    // The chip is still in QPI mode if only the MCU was reset, and doesn't
+    // understand the SPI reset below. This is ignored in SPI mode.
+    OSPI_WriteBytes(&cmd_qpi_rsten, 0, NULL, 0);
+    HAL_Delay(2);
+    OSPI_WriteBytes(&cmd_qpi_rst, 0, NULL, 0);
+    HAL_Delay(20);
+#endif
+
     // Enable Reset
     OSPI_WriteBytes(CMD(RSTEN), 0, NULL, 0);
     HAL_Delay(2);
@@ -720,6 +1220,7 @@ void OSPI_Init(OSPI_HandleTypeDef *hospi)
         if ((flash.jedec_id.u32 & 0xffffff) == (jedec_map[i].jedec_id.u32 & 0xffffff)) {
             flash.config = jedec_map[i].config;
             flash.name = jedec_map[i].name;
+            flash.size = jedec_map[i].size;
             DBG("Found config: %s\n", flash.name);
             break;
         }
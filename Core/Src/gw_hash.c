@@ -0,0 +1,93 @@
+#include "gw_hash.h"
+
+#include "stm32h7xx_hal.h"
+#include "sha256.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#if defined(HASH)
+static uint32_t read_tail(const uint8_t *data, size_t len)
+{
+    uint32_t word = 0;
+
+    memcpy(&word, data, len);
+    return word;
+}
+
+static void hash_sha256(uint8_t hash[32], const uint8_t *data, size_t len)
+{
+    __HAL_RCC_HASH_CLK_ENABLE();
+
+    // SHA-256 of bytes, the peripheral swaps them into big endian words
+    HASH->CR = HASH_CR_ALGO_0 | HASH_CR_ALGO_1 | HASH_CR_DATATYPE_1 | HASH_CR_INIT;
+
+    // Number of valid bits in the last word
+    MODIFY_REG(HASH->STR, HASH_STR_NBLW, 8 * (len % 4));
+
+    // Writes are stalled while the FIFO is full
+    const uint8_t *end = data + (len & ~3);
+    while (data != end) {
+        uint32_t word;
+
+        memcpy(&word, data, 4);
+        HASH->DIN = word;
+        data += 4;
+    }
+    if (len % 4) {
+        HASH->DIN = read_tail(data, len % 4);
+    }
+
+    SET_BIT(HASH->STR, HASH_STR_DCAL);
+    while (!(HASH->SR & HASH_SR_DCIS)) {
+    }
+
+    for (int i = 0; i < 8; i++) {
+        uint32_t word = HASH_DIGEST->HR[i];
+
+        hash[i * 4 + 0] = word >> 24;
+        hash[i * 4 + 1] = word >> 16;
+        hash[i * 4 + 2] = word >> 8;
+        hash[i * 4 + 3] = word;
+    }
+}
+#endif
+
+void gw_sha256_to_string(uint8_t hash_str[65], const uint8_t *data, size_t len)
+{
+#if defined(HASH)
+    uint8_t hash[32];
+
+    hash_sha256(hash, data, len);
+    for (int i = 0; i < 32; i++) {
+        sprintf((char *) &hash_str[i * 2], "%02x", hash[i]);
+    }
+#else
+    sha256_to_string(hash_str, data, len);
+#endif
+}
+
+uint32_t gw_crc32(const uint8_t *data, size_t len)
+{
+    __HAL_RCC_CRC_CLK_ENABLE();
+
+    // Reflected CRC-32 with the zlib polynomial
+    CRC->INIT = 0xffffffff;
+    CRC->POL = 0x04c11db7;
+    CRC->CR = CRC_CR_REV_IN_0 | CRC_CR_REV_OUT | CRC_CR_RESET;
+
+    // The first byte in memory has to be in the top of the word
+    const uint8_t *end = data + (len & ~3);
+    while (data != end) {
+        uint32_t word;
+
+        memcpy(&word, data, 4);
+        CRC->DR = __REV(word);
+        data += 4;
+    }
+    for (size_t i = 0; i < len % 4; i++) {
+        *(__IO uint8_t *) &CRC->DR = data[i];
+    }
+
+    return CRC->DR ^ 0xffffffff;
+}
@@ -1,8 +1,15 @@
+#include <assert.h>
+#include <stdbool.h>
+#include <stdio.h>
 #include <string.h>
 
 #include "gw_lcd.h"
+#include "gw_blit.h"
 #include "stm32h7xx_hal.h"
 #include "main.h"
+#include "gw_timer.h"
+#include "utils.h"
+#include "boot_trace.h"
 
 #if GW_LCD_MODE_LUT8
 uint8_t framebuffer1[GW_LCD_WIDTH * GW_LCD_HEIGHT];
@@ -12,10 +19,32 @@ uint16_t framebuffer1[GW_LCD_WIDTH * GW_LCD_HEIGHT];
 uint16_t framebuffer2[GW_LCD_WIDTH * GW_LCD_HEIGHT];
 #endif // GW_LCD_MODE_LUT8
 
+#ifdef GW_LCD_TRIPLE_BUFFER
+#ifndef GW_LCD_MODE_LUT8
+#error "GW_LCD_TRIPLE_BUFFER needs GW_LCD_MODE_LUT8, AHBRAM can't fit a RGB565 framebuffer"
+#endif
+uint8_t framebuffer3[GW_LCD_WIDTH * GW_LCD_HEIGHT];
+#endif // GW_LCD_TRIPLE_BUFFER
+
 uint16_t *fb1 = framebuffer1;
+#if LCD_BEAM_RACING
+// Not scanned out, framebuffer2 is left to the flash app
+uint16_t *fb2 = framebuffer1;
+#else
 uint16_t *fb2 = framebuffer2;
+#endif
+#ifdef GW_LCD_TRIPLE_BUFFER
+uint16_t *fb3 = (uint16_t *) framebuffer3;
+#else
+uint16_t *fb3 = NULL;
+#endif
 
-uint8_t emulator_framebuffer[(256 + 8 + 8) * 240];
+// Uncached, the LTDC reads them while the CPU draws
+static uint16_t overlay_buffers[2][LCD_OVERLAY_W * LCD_OVERLAY_H] __attribute__((section (".ahb"))) __attribute__((aligned(4)));
+static uint16_t *overlay_shown = overlay_buffers[0];
+
+// Cache line aligned for the DMA2D and gw_dirty_hash()
+uint8_t emulator_framebuffer[(256 + 8 + 8) * 240] __attribute__((aligned(32)));
 
 extern LTDC_HandleTypeDef hltdc;
 
@@ -23,7 +52,13 @@ extern DAC_HandleTypeDef hdac1;
 extern DAC_HandleTypeDef hdac2;
 
 uint32_t active_framebuffer;
-uint32_t frame_counter;
+volatile uint32_t frame_counter;
+
+// Triple buffering only: the buffer scanned out by the LTDC and the finished
+// frame waiting for the next vertical blanking (-1 if there is none).
+static uint32_t shown_framebuffer = 1;
+static volatile int32_t queued_framebuffer = -1;
+static volatile uint32_t swap_count;
 
 void lcd_backlight_off()
 {
@@ -60,114 +95,168 @@ void lcd_deinit(SPI_HandleTypeDef *spi)
   HAL_GPIO_WritePin(GPIOD, GPIO_PIN_8, GPIO_PIN_RESET);
 }
 
-void lcd_init(SPI_HandleTypeDef *spi, LTDC_HandleTypeDef *ltdc)
-{
-// Wake
-// Enable 3.3v
-  HAL_GPIO_WritePin(GPIOD, GPIO_PIN_1, GPIO_PIN_RESET);
-  HAL_Delay(1);
+// Power-up sequence of the panel. Each step is followed by the minimum time
+// to wait before the next one. The supply and reset timings are the ones the
+// stock firmware uses, the registers only need CS to be seen high between
+// two writes.
+#define LCD_REG_DELAY_US 20
+
+typedef enum {
+  LCD_STEP_PIN,
+  LCD_STEP_WRITE,
+} lcd_step_type_t;
+
+typedef struct {
+  lcd_step_type_t type;
+  GPIO_TypeDef *port;
+  uint16_t pin;
+  GPIO_PinState state;
+  uint8_t data[2];
+  uint32_t delay_us;
+} lcd_step_t;
+
+#define LCD_PIN(port, pin, state, delay_us) { LCD_STEP_PIN, port, pin, state, {0}, delay_us }
+#define LCD_CS(state, delay_us)             LCD_PIN(GPIOB, GPIO_PIN_12, state, delay_us)
+// CS pulses high before each register but the first one
+#define LCD_WRITE(reg, value)               LCD_CS(GPIO_PIN_SET, LCD_REG_DELAY_US), \
+                                            LCD_CS(GPIO_PIN_RESET, LCD_REG_DELAY_US), \
+                                            { LCD_STEP_WRITE, NULL, 0, 0, {reg, value}, LCD_REG_DELAY_US }
+
+static const lcd_step_t lcd_init_steps[] = {
+  // Enable 3.3v
+  LCD_PIN(GPIOD, GPIO_PIN_1, GPIO_PIN_RESET, 1000),
   // Enable 1.8V
-  HAL_GPIO_WritePin(GPIOD, GPIO_PIN_4, GPIO_PIN_SET);
+  LCD_PIN(GPIOD, GPIO_PIN_4, GPIO_PIN_SET, 0),
   // also assert CS, not sure where to put this yet
-  HAL_GPIO_WritePin(GPIOB, GPIO_PIN_12, GPIO_PIN_SET);
-  HAL_Delay(7);
+  LCD_CS(GPIO_PIN_SET, 7000),
+  // Reset pulse
+  LCD_PIN(GPIOD, GPIO_PIN_8, GPIO_PIN_SET, 2000),
+  LCD_PIN(GPIOD, GPIO_PIN_8, GPIO_PIN_RESET, 2000),
+  LCD_PIN(GPIOD, GPIO_PIN_8, GPIO_PIN_SET, 10000),
+  LCD_CS(GPIO_PIN_RESET, 45000),
+  { LCD_STEP_WRITE, NULL, 0, 0, {0x08, 0x80}, LCD_REG_DELAY_US },
+  LCD_WRITE(0x6e, 0x80),
+  LCD_WRITE(0x80, 0x80),
+  LCD_WRITE(0x68, 0x00),
+  LCD_WRITE(0xd0, 0x00),
+  LCD_WRITE(0x1b, 0x00),
+  LCD_WRITE(0xe0, 0x00),
+  LCD_WRITE(0x6a, 0x80),
+  LCD_WRITE(0x80, 0x00),
+  LCD_WRITE(0x14, 0x80),
+  LCD_CS(GPIO_PIN_SET, 0),
+};
 
+static SPI_HandleTypeDef *lcd_spi;
+static uint32_t lcd_step = ARRAY_SIZE(lcd_init_steps);
+static uint32_t lcd_step_start_us;
+static uint32_t lcd_step_delay_us;
 
-// HAL_SPI_Transmit(spi, (uint8_t *)"\x55\x55\x55\x55\x55\x55\x55\x55\x55\x55", 10, 100);
-  // Lets go, bootup sequence.
-  HAL_GPIO_WritePin(GPIOD, GPIO_PIN_8, GPIO_PIN_SET);
-  HAL_Delay(2);
-  HAL_GPIO_WritePin(GPIOD, GPIO_PIN_8, GPIO_PIN_RESET);
-  HAL_Delay(2);
-  HAL_GPIO_WritePin(GPIOD, GPIO_PIN_8, GPIO_PIN_SET);
+static void lcd_overlay_init(LTDC_HandleTypeDef *ltdc)
+{
+  LTDC_LayerCfgTypeDef cfg = {
+    .WindowX0 = LCD_OVERLAY_X,
+    .WindowX1 = LCD_OVERLAY_X + LCD_OVERLAY_W,
+    .WindowY0 = LCD_OVERLAY_Y,
+    .WindowY1 = LCD_OVERLAY_Y + LCD_OVERLAY_H,
+    .PixelFormat = LTDC_PIXEL_FORMAT_ARGB4444,
+    .Alpha = 255,
+    .Alpha0 = 0,
+    // The pixel alpha blends it over the game layer
+    .BlendingFactor1 = LTDC_BLENDING_FACTOR1_PAxCA,
+    .BlendingFactor2 = LTDC_BLENDING_FACTOR2_PAxCA,
+    .FBStartAdress = (uint32_t) overlay_shown,
+    .ImageWidth = LCD_OVERLAY_W,
+    .ImageHeight = LCD_OVERLAY_H,
+  };
 
-  HAL_Delay(10);
-  HAL_GPIO_WritePin(GPIOB, GPIO_PIN_12, GPIO_PIN_RESET);
-  HAL_Delay(45);
-  HAL_SPI_Transmit(spi, (uint8_t *)"\x08\x80", 2, 100);
-  HAL_Delay(2);
-  wdog_refresh();
-  
-  // CS
-  HAL_GPIO_WritePin(GPIOB, GPIO_PIN_12, GPIO_PIN_SET);
-  // HAL_Delay(100);
-  HAL_GPIO_WritePin(GPIOB, GPIO_PIN_12, GPIO_PIN_RESET);
-  HAL_Delay(2);
-  HAL_SPI_Transmit(spi, (uint8_t *)"\x6E\x80", 2, 100);
-  HAL_Delay(2);
-  // CS
-  HAL_GPIO_WritePin(GPIOB, GPIO_PIN_12, GPIO_PIN_SET);
-  // HAL_Delay(100);
-  HAL_GPIO_WritePin(GPIOB, GPIO_PIN_12, GPIO_PIN_RESET);
-  HAL_Delay(2);
-  HAL_SPI_Transmit(spi, (uint8_t *)"\x80\x80", 2, 100);
-  
-  HAL_Delay(2);
-  // CS
-  HAL_GPIO_WritePin(GPIOB, GPIO_PIN_12, GPIO_PIN_SET);
-  // HAL_Delay(100);
-  HAL_GPIO_WritePin(GPIOB, GPIO_PIN_12, GPIO_PIN_RESET);
-  HAL_Delay(2);
-  HAL_SPI_Transmit(spi, (uint8_t *)"\x68\x00", 2, 100);
-  HAL_Delay(2);
-  // CS
-  HAL_GPIO_WritePin(GPIOB, GPIO_PIN_12, GPIO_PIN_SET);
-  // HAL_Delay(100);
-  HAL_GPIO_WritePin(GPIOB, GPIO_PIN_12, GPIO_PIN_RESET);
-  HAL_Delay(2);
-  HAL_SPI_Transmit(spi, (uint8_t *)"\xd0\x00", 2, 100);
-  HAL_Delay(2);
-  // CS
-  HAL_GPIO_WritePin(GPIOB, GPIO_PIN_12, GPIO_PIN_SET);
-  // HAL_Delay(100);
-  HAL_GPIO_WritePin(GPIOB, GPIO_PIN_12, GPIO_PIN_RESET);
-  HAL_Delay(2);
-  HAL_SPI_Transmit(spi, (uint8_t *)"\x1b\x00", 2, 100);
-  
-  HAL_Delay(2);
-  // CS
-  HAL_GPIO_WritePin(GPIOB, GPIO_PIN_12, GPIO_PIN_SET);
-  // HAL_Delay(100);
-  HAL_GPIO_WritePin(GPIOB, GPIO_PIN_12, GPIO_PIN_RESET);
-  HAL_Delay(2);
-  HAL_SPI_Transmit(spi, (uint8_t *)"\xe0\x00", 2, 100);
-  
-  
-  HAL_Delay(2);
-  // CS
-  HAL_GPIO_WritePin(GPIOB, GPIO_PIN_12, GPIO_PIN_SET);
-  // HAL_Delay(100);
-  HAL_GPIO_WritePin(GPIOB, GPIO_PIN_12, GPIO_PIN_RESET);
-  HAL_Delay(2);
-  HAL_SPI_Transmit(spi, (uint8_t *)"\x6a\x80", 2, 100);
-  
-  HAL_Delay(2);
-  // CS
-  HAL_GPIO_WritePin(GPIOB, GPIO_PIN_12, GPIO_PIN_SET);
-  // HAL_Delay(100);
-  HAL_GPIO_WritePin(GPIOB, GPIO_PIN_12, GPIO_PIN_RESET);
-  HAL_Delay(2);
-  HAL_SPI_Transmit(spi, (uint8_t *)"\x80\x00", 2, 100);
-  HAL_Delay(2);
-  // CS
-  HAL_GPIO_WritePin(GPIOB, GPIO_PIN_12, GPIO_PIN_SET);
-  // HAL_Delay(100);
-  HAL_GPIO_WritePin(GPIOB, GPIO_PIN_12, GPIO_PIN_RESET);
-  HAL_Delay(2);
-  HAL_SPI_Transmit(spi, (uint8_t *)"\x14\x80", 2, 100);
-  HAL_Delay(2);
-  // CS
-  HAL_GPIO_WritePin(GPIOB, GPIO_PIN_12, GPIO_PIN_SET);
-  wdog_refresh();
+  HAL_LTDC_ConfigLayer(ltdc, &cfg, 1);
+
+  // Hidden until there's an overlay
+  __HAL_LTDC_LAYER_DISABLE(ltdc, 1);
+  __HAL_LTDC_RELOAD_IMMEDIATE_CONFIG(ltdc);
+}
+
+void lcd_init_start(SPI_HandleTypeDef *spi, LTDC_HandleTypeDef *ltdc)
+{
+  lcd_spi = spi;
+  lcd_step = 0;
+  lcd_step_delay_us = 0;
+  lcd_init_poll();
 
-  HAL_LTDC_SetAddress(ltdc,(uint32_t) &fb1, 0);
+  // Cleared while the supplies come up
+  HAL_LTDC_SetAddress(ltdc, (uint32_t) fb1, 0);
+  lcd_overlay_init(ltdc);
 
   memset(fb1, 0, sizeof(framebuffer1));
   memset(fb2, 0, sizeof(framebuffer1));
+  if (fb3 != NULL) {
+    memset(fb3, 0, sizeof(framebuffer1));
+  }
+}
+
+bool lcd_init_poll(void)
+{
+  while (lcd_step < ARRAY_SIZE(lcd_init_steps)) {
+    if (gw_timer_us() - lcd_step_start_us < lcd_step_delay_us) {
+      return false;
+    }
+
+    const lcd_step_t *step = &lcd_init_steps[lcd_step++];
+
+    if (step->type == LCD_STEP_PIN) {
+      HAL_GPIO_WritePin(step->port, step->pin, step->state);
+    } else {
+      HAL_SPI_Transmit(lcd_spi, (uint8_t *) step->data, sizeof(step->data), 100);
+    }
+
+    lcd_step_start_us = gw_timer_us();
+    lcd_step_delay_us = step->delay_us;
+  }
+
+  // The last step is done, its delay doesn't matter
+  return true;
+}
+
+void lcd_init_finish(void)
+{
+  while (!lcd_init_poll()) {
+    wdog_refresh();
+  }
+}
+
+void lcd_init(SPI_HandleTypeDef *spi, LTDC_HandleTypeDef *ltdc)
+{
+  lcd_init_start(spi, ltdc);
+  lcd_init_finish();
+}
+
+static void *lcd_get_buffer(uint32_t index)
+{
+  switch (index) {
+  case 0:
+    return fb1;
+  case 1:
+    return fb2;
+  default:
+    return fb3;
+  }
 }
 
 void HAL_LTDC_ReloadEventCallback (LTDC_HandleTypeDef *hltdc) {
   frame_counter++;
+  if (fb3 != NULL) {
+    if (queued_framebuffer >= 0) {
+      shown_framebuffer = queued_framebuffer;
+      queued_framebuffer = -1;
+
+      // Not HAL_LTDC_SetAddress(), lcd_swap() may hold the HAL lock
+      LTDC_Layer1->CFBAR = (uint32_t) lcd_get_buffer(shown_framebuffer);
+      hltdc->Instance->SRCR = LTDC_SRCR_IMR;
+    }
+    return;
+  }
+
   if (active_framebuffer == 0) {
     HAL_LTDC_SetAddress(hltdc, (uint32_t) fb2, 0);
   } else {
@@ -177,52 +266,363 @@ void HAL_LTDC_ReloadEventCallback (LTDC_HandleTypeDef *hltdc) {
 
 uint32_t is_lcd_swap_pending(void)
 {
+  if (LCD_BEAM_RACING || fb3 != NULL) {
+    // There is always a free buffer to draw into
+    return 0;
+  }
+
   return (uint32_t) ((hltdc.Instance->SRCR) & (LTDC_SRCR_VBR | LTDC_SRCR_IMR));
 }
 
 void lcd_swap(void)
 {
-  HAL_LTDC_Reload(&hltdc, LTDC_RELOAD_VERTICAL_BLANKING);
-  active_framebuffer = active_framebuffer ? 0 : 1;
+  swap_count++;
+  boot_trace_frame_shown();
+
+#if LCD_BEAM_RACING
+  // Already on the LCD, see lcd_beam_begin(). The reload is still needed
+  // for the overlay layer, without the interrupt there's nothing to swap.
+  hltdc.Instance->SRCR = LTDC_SRCR_VBR;
+  return;
+#endif
+
+  if (fb3 == NULL) {
+    HAL_LTDC_Reload(&hltdc, LTDC_RELOAD_VERTICAL_BLANKING);
+    active_framebuffer = active_framebuffer ? 0 : 1;
+    return;
+  }
+
+  // May be called from an interrupt handler, e.g. gw_blit_swap_when_done()
+  uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+
+  uint32_t done = active_framebuffer;
+
+  if (queued_framebuffer >= 0) {
+    // The previous frame didn't make it to the LCD yet. Replace it with this
+    // one and draw over it instead of waiting for the vertical blanking.
+    active_framebuffer = queued_framebuffer;
+  } else {
+    for (active_framebuffer = 0; active_framebuffer < 2; active_framebuffer++) {
+      if (active_framebuffer != done && active_framebuffer != shown_framebuffer) {
+        break;
+      }
+    }
+  }
+  queued_framebuffer = done;
+
+  hltdc.Instance->IER |= LTDC_IT_RR;
+  hltdc.Instance->SRCR = LTDC_SRCR_VBR;
+
+  __set_PRIMASK(primask);
+}
+
+uint32_t lcd_get_swap_count(void)
+{
+  return swap_count;
+}
+
+// The DMA2D only writes 16 bit pixels, 8 bit ones go two at a time
+#define LCD_DMA2D_WIDTH (sizeof(framebuffer1) / sizeof(uint16_t) / GW_LCD_HEIGHT)
+
+void lcd_fill_async(void *buffer, uint16_t value)
+{
+#ifdef GW_LCD_MODE_LUT8
+  value = (value & 0xff) * 0x0101;
+#endif
+  gw_blit_fill_rgb565(buffer, LCD_DMA2D_WIDTH, LCD_DMA2D_WIDTH, GW_LCD_HEIGHT, value);
+}
+
+void lcd_copy_async(void *dst, const void *src)
+{
+  gw_blit_copy_rgb565(src, LCD_DMA2D_WIDTH, dst, LCD_DMA2D_WIDTH, LCD_DMA2D_WIDTH, GW_LCD_HEIGHT);
+}
+
+void lcd_clear_async(uint16_t value)
+{
+  // Each one starts once the one before is done
+  for (uint32_t i = 0; i < ((fb3 != NULL) ? 3 : 2); i++) {
+    lcd_fill_async(lcd_get_buffer(i), value);
+  }
 }
 
 void lcd_sync(void)
 {
+  if (LCD_BEAM_RACING) {
+    return;
+  }
+
   void *active = lcd_get_active_buffer();
-  void *inactive = lcd_get_inactive_buffer();
+  // Fault handlers run with the interrupts off, gw_blit_wait() needs them
+  bool dma = !__get_PRIMASK();
+
+  for (uint32_t i = 0; i < ((fb3 != NULL) ? 3 : 2); i++) {
+    void *buffer = lcd_get_buffer(i);
 
-  if (active != inactive) {
-    memcpy(inactive, active, sizeof(framebuffer1));
+    if (buffer == active) {
+      continue;
+    }
+    if (dma) {
+      lcd_copy_async(buffer, active);
+    } else {
+      memcpy(buffer, active, sizeof(framebuffer1));
+    }
+  }
+
+  if (dma) {
+    gw_blit_wait();
   }
 }
 
 void* lcd_get_active_buffer(void)
 {
-  return active_framebuffer ? fb2 : fb1;
+  return lcd_get_buffer(active_framebuffer);
 }
 
 void* lcd_get_inactive_buffer(void)
 {
+  if (LCD_BEAM_RACING) {
+    // The last frame is the one being drawn over
+    return fb1;
+  }
+
+  if (fb3 != NULL) {
+    return lcd_get_buffer(shown_framebuffer);
+  }
+
   return active_framebuffer ? fb1 : fb2;
 }
 
 void lcd_reset_active_buffer(void)
 {
+  // Applied right away by HAL_LTDC_SetAddress()
+  LTDC_Layer2->CR &= ~LTDC_LxCR_LEN;
   HAL_LTDC_SetAddress(&hltdc, (uint32_t) fb1, 0);
   active_framebuffer = 0;
+  shown_framebuffer = 0;
+  queued_framebuffer = -1;
 }
 
 void lcd_set_buffers(uint16_t *buf1, uint16_t *buf2)
 {
   fb1 = buf1;
   fb2 = buf2;
+
+  // Back to double buffering, the caller has other uses for the memory
+  fb3 = NULL;
+  if (active_framebuffer > 1) {
+    active_framebuffer = 0;
+  }
+}
+
+uint16_t *lcd_overlay_get_buffer(void)
+{
+  return (overlay_shown == overlay_buffers[0]) ? overlay_buffers[1] : overlay_buffers[0];
+}
+
+void lcd_overlay_show(uint16_t *buffer)
+{
+  // Shadow registers, the reload of lcd_swap() applies them with the frame
+  if (buffer == NULL) {
+    LTDC_Layer2->CR &= ~LTDC_LxCR_LEN;
+    return;
+  }
+
+  overlay_shown = buffer;
+  LTDC_Layer2->CFBAR = (uint32_t) buffer;
+  LTDC_Layer2->CR |= LTDC_LxCR_LEN;
+}
+
+#ifdef GW_LCD_MODE_LUT8
+static uint32_t clut[256];
+static uint32_t clut_size;
+
+void lcd_set_clut(const uint32_t *colors, uint32_t count)
+{
+  assert(count <= 256);
+
+  // Written directly instead of through HAL_LTDC_ConfigCLUT() so the HAL
+  // lock can't make the buffer swap in HAL_LTDC_ReloadEventCallback() fail.
+  for (uint32_t i = 0; i < count; i++) {
+    uint32_t color = colors[i] & 0x00ffffff;
+
+    if ((i >= clut_size) || (clut[i] != color)) {
+      clut[i] = color;
+      LTDC_Layer1->CLUTWR = (i << LTDC_LxCLUTWR_CLUTADD_Pos) | color;
+    }
+  }
+
+  if (clut_size == 0) {
+    HAL_LTDC_EnableCLUT(&hltdc, 0);
+  }
+
+  if (count > clut_size) {
+    clut_size = count;
+  }
+}
+
+void lcd_set_clut_rgb565(const uint16_t *palette, uint32_t count)
+{
+  uint32_t colors[256];
+
+  assert(count <= 256);
+
+  for (uint32_t i = 0; i < count; i++) {
+    uint32_t r = (palette[i] >> 11) & 0x1f;
+    uint32_t g = (palette[i] >> 5) & 0x3f;
+    uint32_t b = palette[i] & 0x1f;
+
+    colors[i] = (((r << 3) | (r >> 2)) << 16) |
+                (((g << 2) | (g >> 4)) << 8) |
+                ((b << 3) | (b >> 2));
+  }
+
+  lcd_set_clut(colors, count);
 }
 
+const uint32_t *lcd_get_clut(void)
+{
+  return clut;
+}
+#endif // GW_LCD_MODE_LUT8
+
+#if LCD_BEAM_RACING
+static volatile bool beam_event;
+
+void HAL_LTDC_LineEventCallback(LTDC_HandleTypeDef *hltdc)
+{
+  beam_event = true;
+}
+
+// Sleeps until the LTDC is done with the visible lines
+static void lcd_beam_wait_blanking(void)
+{
+  uint32_t last_visible = hltdc.Instance->AWCR & LTDC_AWCR_AAH;
+
+  beam_event = false;
+  HAL_LTDC_ProgramLineEvent(&hltdc, last_visible + 1);
+  while (!beam_event) {
+    __WFI();
+  }
+}
+
+void lcd_beam_begin(void)
+{
+  // Lines count from the vertical sync, the porches included
+  uint32_t line = hltdc.Instance->CPSR & LTDC_CPSR_CYPOS;
+  uint32_t first_visible = (hltdc.Instance->BPCR & LTDC_BPCR_AVBP) + 1;
+  uint32_t last_visible = hltdc.Instance->AWCR & LTDC_AWCR_AAH;
+
+  if (line >= first_visible && line <= last_visible) {
+    lcd_beam_wait_blanking();
+  }
+}
+#endif
+
 void lcd_wait_for_vblank(void)
 {
+#if LCD_BEAM_RACING
+  // No swaps, so no reload interrupts
+  lcd_beam_wait_blanking();
+  frame_counter++;
+  return;
+#endif
+
   uint32_t old_counter = frame_counter;
   while (old_counter == frame_counter) {
-    __asm("nop");
+    // Woken up by the LTDC reload interrupt (or any other one)
+    __WFI();
   }
 }
 
+
+#if LCD_PACING
+#if LCD_BEAM_RACING
+#error "LCD_PACING and LCD_BEAM_RACING both need the LTDC line interrupt"
+#endif
+
+// PLL3 as SystemClock_Config() sets it up: HSI / 4 * (9 + FRACN / 8192) / 24
+#define PLL3_INPUT_HZ   16000000
+#define PLL3_N          9
+#define PLL3_R          24
+#define PLL3_FRACN_MAX  8191
+
+static volatile uint32_t refresh_count;
+static uint32_t refresh_millihz;      // As asked for, 0 for the default
+static uint32_t refresh_set;          // What lcd_set_refresh_rate() returned for it
+static uint32_t default_total_h;      // TWCR.TOTALH of MX_LTDC_Init()
+
+void HAL_LTDC_LineEventCallback(LTDC_HandleTypeDef *hltdc)
+{
+  refresh_count++;
+  // HAL_LTDC_IRQHandler() turns it off every time
+  __HAL_LTDC_ENABLE_IT(hltdc, LTDC_IT_LI);
+}
+
+static void set_timing(uint32_t total_h, uint32_t fracn)
+{
+  hltdc.Instance->TWCR = (hltdc.Instance->TWCR & ~LTDC_TWCR_TOTALH) | total_h;
+
+  // The fractional part can change while the PLL runs, the integer one can't
+  __HAL_RCC_PLL3FRACN_DISABLE();
+  __HAL_RCC_PLL3FRACN_CONFIG(fracn);
+  __HAL_RCC_PLL3FRACN_ENABLE();
+}
+
+uint32_t lcd_set_refresh_rate(uint32_t millihz)
+{
+  uint32_t total_w = ((hltdc.Instance->TWCR & LTDC_TWCR_TOTALW) >> LTDC_TWCR_TOTALW_Pos) + 1;
+  uint32_t first_blank = (hltdc.Instance->AWCR & LTDC_AWCR_AAH) + 1;
+  uint64_t pixel_hz = 0;
+  uint32_t total_h;
+
+  if (millihz == refresh_millihz) {
+    return refresh_set;
+  }
+  if (default_total_h == 0) {
+    default_total_h = hltdc.Instance->TWCR & LTDC_TWCR_TOTALH;
+  }
+
+  refresh_millihz = millihz;
+  refresh_set = 0;
+
+  if (millihz == 0) {
+    __HAL_LTDC_DISABLE_IT(&hltdc, LTDC_IT_LI);
+    set_timing(default_total_h, 0);
+    return 0;
+  }
+
+  // As few lines as the pixel clock allows, it can only go up from 6 MHz
+  for (total_h = default_total_h; total_h <= LTDC_TWCR_TOTALH; total_h++) {
+    pixel_hz = (uint64_t) millihz * total_w * (total_h + 1) / 1000;
+    if (pixel_hz * PLL3_R >= (uint64_t) PLL3_INPUT_HZ * PLL3_N) {
+      break;
+    }
+  }
+
+  uint64_t fracn = (pixel_hz * PLL3_R * 8192 + PLL3_INPUT_HZ / 2) / PLL3_INPUT_HZ - PLL3_N * 8192;
+
+  if (total_h > LTDC_TWCR_TOTALH || fracn > PLL3_FRACN_MAX) {
+    printf("LCD can't refresh at %lu mHz\n", millihz);
+    // Not left at the previous rate, the frames are paced on gw_timer now
+    __HAL_LTDC_DISABLE_IT(&hltdc, LTDC_IT_LI);
+    set_timing(default_total_h, 0);
+    return 0;
+  }
+
+  set_timing(total_h, fracn);
+
+  pixel_hz = (uint64_t) PLL3_INPUT_HZ * (PLL3_N * 8192 + fracn) / (8192 * PLL3_R);
+  refresh_set = pixel_hz * 1000 / (total_w * (total_h + 1));
+  printf("LCD refresh %lu mHz, %lu lines\n", refresh_set, total_h + 1);
+
+  HAL_LTDC_ProgramLineEvent(&hltdc, first_blank);
+
+  return refresh_set;
+}
+
+uint32_t lcd_get_refresh_count(void)
+{
+  return refresh_count;
+}
+#endif
@@ -0,0 +1,37 @@
+#include "gw_timer.h"
+
+void gw_timer_init(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->LAR = 0xC5ACCE55; // Unlock access to the DWT registers
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+uint32_t gw_timer_us(void)
+{
+    uint32_t load = SysTick->LOAD + 1;
+    uint32_t tick;
+    uint32_t val;
+    uint32_t pending;
+
+    // Retry if the tick interrupt ran in the meantime
+    do {
+        tick = HAL_GetTick();
+        val = SysTick->VAL;
+        pending = SCB->ICSR & SCB_ICSR_PENDSTSET_Msk;
+    } while (tick != HAL_GetTick());
+
+    // The counter wrapped but the interrupt couldn't run yet, e.g. with
+    // interrupts disabled
+    if (pending && val > load / 2) {
+        tick += HAL_GetTickFreq();
+    }
+
+    return tick * 1000 + ((load - 1 - val) * 1000 * HAL_GetTickFreq()) / load;
+}
+
+uint32_t gw_timer_cycles_to_us(uint32_t cycles)
+{
+    return cycles / (SystemCoreClock / 1000000);
+}
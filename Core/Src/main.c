@@ -26,16 +26,29 @@
 #include "gw_buttons.h"
 #include "gw_flash.h"
 #include "gw_lcd.h"
+#include "gw_timer.h"
+#include "gw_blit.h"
 #include "gw_linker.h"
 #include "githash.h"
 #include "flashapp.h"
+#include "store_async.h"
+#include "quick_save.h"
 
 #include "odroid_colors.h"
 #include "odroid_system.h"
 #include "odroid_overlay.h"
 #include "bq24072.h"
+#include "boot_trace.h"
+#include "pc_sample.h"
+#include "frame_watch.h"
+#include "log_ring.h"
+#include "frame_stats.h"
+#include "cpu_clock.h"
+#include "mem_stats.h"
+#include "xip_copy.h"
 
 #include <string.h>
+#include <strings.h>
 #include <assert.h>
 #include <stdio.h>
 /* USER CODE END Includes */
@@ -67,6 +80,7 @@ OSPI_HandleTypeDef hospi1;
 RTC_HandleTypeDef hrtc;
 
 SAI_HandleTypeDef hsai_BlockA1;
+DMA_HandleTypeDef hdma_adc1;
 DMA_HandleTypeDef hdma_sai1_a;
 
 SPI_HandleTypeDef hspi2;
@@ -95,6 +109,7 @@ static bool wdog_enabled;
 /* Private function prototypes -----------------------------------------------*/
 void SystemClock_Config(void);
 static void MPU_Config(void);
+static void MPU_ConfigExtFlash(uint32_t flash_size);
 static void MX_GPIO_Init(void);
 static void MX_DMA_Init(void);
 static void MX_LTDC_Init(void);
@@ -234,6 +249,10 @@ void store_erase(const uint8_t *flash_ptr, uint32_t size)
   // Only allow 4kB aligned pointers
   assert((save_address & (4*1024 - 1)) == 0);
 
+  // Keep the writes in order
+  store_async_flush();
+  frame_stats_tag(FRAME_TAG_FLASH);
+
   // Round size up to nearest 4K
   if ((size & 0xfff) != 0) {
     size += 0x1000 - (size & 0xfff);
@@ -257,16 +276,33 @@ void store_save(const uint8_t *flash_ptr, const uint8_t *data, size_t size)
   // Only allow 4kB aligned pointers
   assert((save_address & (4*1024 - 1)) == 0);
 
-  int diff = memcmp((void*)flash_ptr, data, size);
-  if (diff == 0) {
-    return;
+  // Keep the writes in order
+  store_async_flush();
+  frame_stats_tag(FRAME_TAG_FLASH);
+
+  // Only erase and program the sectors that changed. Settings and SRAM saves
+  // usually only differ in a few bytes.
+  uint32_t sector_size = OSPI_GetSmallestEraseSize();
+  if (sector_size < 4*1024) {
+    sector_size = 4*1024;
   }
 
-  store_erase(flash_ptr, size);
+  for (size_t offset = 0; offset < size; offset += sector_size) {
+    size_t chunk = size - offset;
+    if (chunk > sector_size) {
+      chunk = sector_size;
+    }
 
-  OSPI_DisableMemoryMappedMode();
-  OSPI_Program(save_address, data, size);
-  OSPI_EnableMemoryMappedMode();
+    if (memcmp(&flash_ptr[offset], &data[offset], chunk) == 0) {
+      continue;
+    }
+
+    store_erase(&flash_ptr[offset], chunk);
+
+    OSPI_DisableMemoryMappedMode();
+    OSPI_Program(save_address + offset, &data[offset], chunk);
+    OSPI_EnableMemoryMappedMode();
+  }
 }
 
 void boot_magic_set(uint32_t magic)
@@ -284,11 +320,26 @@ uint32_t uptime_get(void)
   return uptime_s;
 }
 
+// Delay 500ms to give us a chance to attach a debugger in case
+// we end up in a suspend-loop.
+static void sleep_debug_delay(void)
+{
+#if SLEEP_DEBUG_DELAY
+  for (int i = 0; i < 10; i++) {
+      wdog_refresh();
+      HAL_Delay(50);
+  }
+#endif
+}
+
 void GW_EnterDeepSleep(void)
 {
   // Stop SAI DMA (audio)
   HAL_SAI_DMAStop(&hsai_BlockA1);
 
+  // Don't lose a save that is still being written
+  store_async_flush();
+
   // Enable wakup by PIN1, the power button
   HAL_PWR_EnableWakeUpPin(PWR_WAKEUP_PIN1_LOW);
 
@@ -300,12 +351,7 @@ void GW_EnterDeepSleep(void)
   // Leave a trace in RAM that we entered standby mode
   boot_magic = BOOT_MAGIC_STANDBY;
 
-  // Delay 500ms to give us a chance to attach a debugger in case
-  // we end up in a suspend-loop.
-  for (int i = 0; i < 10; i++) {
-      wdog_refresh();
-      HAL_Delay(50);
-  }
+  sleep_debug_delay();
 
   HAL_PWR_EnterSTANDBYMode();
 
@@ -317,21 +363,70 @@ void GW_EnterDeepSleep(void)
 
 }
 
-// Returns buttons that were pressed at boot
-uint32_t GW_GetBootButtons(void)
+// Same as GW_EnterDeepSleep(), but in STOP mode: the RAM and the peripherals
+// keep their state and this returns once the power button is pressed. Only
+// the clocks and the LCD have to be brought up again, the LCD power-up
+// sequence takes about 70ms.
+void GW_Suspend(void)
 {
-  return boot_buttons;
-}
+  GPIO_InitTypeDef GPIO_InitStruct = {0};
 
-// Workaround for being able to run with -D_FORTIFY_SOURCE=1
-static void memcpy_no_check(uint32_t *dst, uint32_t *src, size_t len)
-{
-  assert((len & 0b11) == 0);
+  // Stop SAI DMA (audio)
+  HAL_SAI_DMAStop(&hsai_BlockA1);
+
+  // Don't lose a save that is still being written
+  store_async_flush();
+
+  lcd_backlight_off();
+  lcd_deinit(&hspi2);
+
+  sleep_debug_delay();
 
-  uint32_t *end = dst + len / 4;
-  while (dst != end) {
-    *(dst++) = *(src++);
+  // The press that got us here would wake us up right away
+  while (buttons_get() & B_POWER) {
+    wdog_refresh();
   }
+
+  // Wake up by an event on the power button, it needs no interrupt handler
+  GPIO_InitStruct.Pin = BTN_PWR_Pin;
+  GPIO_InitStruct.Mode = GPIO_MODE_EVT_FALLING;
+  GPIO_InitStruct.Pull = GPIO_NOPULL;
+  HAL_GPIO_Init(BTN_PWR_GPIO_Port, &GPIO_InitStruct);
+
+  // SystemClock_Config() sets PLL1 up for this level
+  cpu_clock_set_level(CPU_CLOCK_280MHZ);
+
+  // The charger interrupts wake us up as well, only the button resumes
+  do {
+    wdog_refresh();
+    HAL_SuspendTick();
+    HAL_PWR_EnterSTOPMode(PWR_LOWPOWERREGULATOR_ON, PWR_STOPENTRY_WFE);
+    HAL_ResumeTick();
+  } while (!(buttons_get() & B_POWER));
+
+  // Back to the input of MX_GPIO_Init(). HAL_GPIO_Init() leaves the EXTI
+  // event of an input alone, HAL_GPIO_DeInit() clears it.
+  HAL_GPIO_DeInit(BTN_PWR_GPIO_Port, BTN_PWR_Pin);
+  GPIO_InitStruct.Pin = BTN_PWR_Pin;
+  GPIO_InitStruct.Mode = GPIO_MODE_INPUT;
+  GPIO_InitStruct.Pull = GPIO_NOPULL;
+  HAL_GPIO_Init(BTN_PWR_GPIO_Port, &GPIO_InitStruct);
+
+  // The core runs from the HSI after STOP, and the PLLs are off
+  SystemClock_Config();
+
+  lcd_init(&hspi2, &hltdc);
+
+  // Don't let the same press power off again
+  while (buttons_get() & B_POWER) {
+    wdog_refresh();
+  }
+}
+
+// Returns buttons that were pressed at boot
+uint32_t GW_GetBootButtons(void)
+{
+  return boot_buttons;
 }
 
 void wdog_enable()
@@ -359,6 +454,8 @@ int main(void)
   uint8_t trigger_wdt_bsod = 0;
   uint8_t boot_mode = BOOT_MODE_APP;
 
+  mem_stats_paint_stack();
+
   for(int i = 0; i < 1000000; i++) {
     __NOP();
   }
@@ -373,6 +470,7 @@ int main(void)
   if (boot_magic != BOOT_MAGIC_WATCHDOG) {
     log_idx = 0;
     logbuf[0] = '\0';
+    log_ring_reset();
   }
 
   switch (boot_magic) {
@@ -415,6 +513,7 @@ int main(void)
 
   /* Reset of all peripherals, Initializes the Flash interface and the Systick. */
   HAL_Init();
+  boot_trace("HAL_Init");
 
   /* USER CODE BEGIN Init */
 
@@ -428,6 +527,9 @@ int main(void)
 
   /* USER CODE BEGIN SysInit */
 
+  gw_timer_init();
+  boot_trace("clocks");
+
   /* USER CODE END SysInit */
 
   /* Initialize all configured peripherals */
@@ -446,17 +548,29 @@ int main(void)
   /* Initialize interrupts */
   MX_NVIC_Init();
   /* USER CODE BEGIN 2 */
+  boot_trace("peripherals");
 
   // Save the button states as early as possible
   boot_buttons = buttons_get();
+  buttons_init();
+
+  // The LCD powers up during the delay
+  lcd_init_start(&hspi2, &hltdc);
 
   // Keep this
   for (int i = 0; i < 10; i++) {
+      uint32_t start = HAL_GetTick();
+
       wdog_refresh();
-      HAL_Delay(50);
+      while (HAL_GetTick() - start < 50) {
+          lcd_init_poll();
+      }
   }
+  boot_trace("button delay");
 
-  lcd_init(&hspi2, &hltdc);
+  lcd_init_finish();
+  gw_blit_init();
+  boot_trace("lcd_init");
 
   if (trigger_wdt_bsod) {
     BSOD(BSOD_WATCHDOG, 0, 0);
@@ -473,6 +587,8 @@ int main(void)
   // Initialize the external flash
 
   OSPI_Init(&hospi1);
+  MPU_ConfigExtFlash(OSPI_GetSize());
+  boot_trace("OSPI_Init");
 
   // Copy instructions and data from extflash to axiram
   void *copy_areas[3];
@@ -480,7 +596,7 @@ int main(void)
   copy_areas[0] = &_siramdata;  // 0x90000000
   copy_areas[1] = &__ram_exec_start__;  // 0x24000000
   copy_areas[2] = &__ram_exec_end__;  // 0x24000000 + length
-  memcpy_no_check(copy_areas[1], copy_areas[0], copy_areas[2] - copy_areas[1]);
+  copy_from_xip(copy_areas[1], copy_areas[0], copy_areas[2] - copy_areas[1]);
 
   // Copy ITCRAM HOT section
   static uint32_t copy_areas2[4] __attribute__((used));
@@ -488,13 +604,19 @@ int main(void)
   copy_areas2[1] = (uint32_t) &__itcram_hot_start__;
   copy_areas2[2] = (uint32_t) &__itcram_hot_end__;
   copy_areas2[3] = copy_areas2[2] - copy_areas2[1];
-  memcpy_no_check((uint32_t *) copy_areas2[1], (uint32_t *) copy_areas2[0], copy_areas2[3]);
+  copy_from_xip((uint32_t *) copy_areas2[1], (uint32_t *) copy_areas2[0], copy_areas2[3]);
+  boot_trace("copy to RAM");
 
   bq24072_init();
+  pc_sample_init();
+  frame_watch_init();
 
   switch (boot_mode) {
   case BOOT_MODE_APP:
     wdog_enable();
+    // Write the state that was quick-saved when powering off
+    quick_save_init();
+    boot_trace("quick save");
     // Launch the emulator
     app_main();
     break;
@@ -669,10 +791,10 @@ static void MX_ADC1_Init(void)
   hadc1.Init.ContinuousConvMode = DISABLE;
   hadc1.Init.NbrOfConversion = 1;
   hadc1.Init.DiscontinuousConvMode = DISABLE;
-  hadc1.Init.ExternalTrigConv = ADC_SOFTWARE_START;
-  hadc1.Init.ExternalTrigConvEdge = ADC_EXTERNALTRIGCONVEDGE_NONE;
-  hadc1.Init.ConversionDataManagement = ADC_CONVERSIONDATA_DR;
-  hadc1.Init.Overrun = ADC_OVR_DATA_PRESERVED;
+  hadc1.Init.ExternalTrigConv = ADC_EXTERNALTRIG_T1_TRGO;
+  hadc1.Init.ExternalTrigConvEdge = ADC_EXTERNALTRIGCONVEDGE_RISING;
+  hadc1.Init.ConversionDataManagement = ADC_CONVERSIONDATA_DMA_CIRCULAR;
+  hadc1.Init.Overrun = ADC_OVR_DATA_OVERWRITTEN;
   hadc1.Init.LeftBitShift = ADC_LEFTBITSHIFT_NONE;
   hadc1.Init.OversamplingMode = DISABLE;
   if (HAL_ADC_Init(&hadc1) != HAL_OK)
@@ -1093,7 +1215,8 @@ static void MX_TIM1_Init(void)
   {
     Error_Handler();
   }
-  sMasterConfig.MasterOutputTrigger = TIM_TRGO_RESET;
+  // Each update starts a battery voltage conversion, see bq24072.c
+  sMasterConfig.MasterOutputTrigger = TIM_TRGO_UPDATE;
   sMasterConfig.MasterOutputTrigger2 = TIM_TRGO2_RESET;
   sMasterConfig.MasterSlaveMode = TIM_MASTERSLAVEMODE_DISABLE;
   if (HAL_TIMEx_MasterConfigSynchronization(&htim1, &sMasterConfig) != HAL_OK)
@@ -1149,6 +1272,9 @@ static void MX_DMA_Init(void)
   /* DMA1_Stream0_IRQn interrupt configuration */
   HAL_NVIC_SetPriority(DMA1_Stream0_IRQn, 0, 0);
   HAL_NVIC_EnableIRQ(DMA1_Stream0_IRQn);
+  /* DMA1_Stream1_IRQn interrupt configuration */
+  HAL_NVIC_SetPriority(DMA1_Stream1_IRQn, 0, 0);
+  HAL_NVIC_EnableIRQ(DMA1_Stream1_IRQn);
 
 }
 
@@ -1259,106 +1385,118 @@ int __builtin_popcount (unsigned int x);
 
 /* MPU Configuration */
 
-void MPU_Config(void)
+typedef enum {
+  MPU_PROFILE_NO_ACCESS,  // Strongly ordered, any access faults
+  MPU_PROFILE_UNCACHED,   // Normal memory shared with the DMA, LTDC and SAI
+  MPU_PROFILE_WRITE_BACK, // Write-back, read and write allocate
+  MPU_PROFILE_XIP,        // Read-only write-back for the memory-mapped flash
+} mpu_profile_t;
+
+// Where regions overlap the one with the highest number applies
+#define MPU_REGION_OSPI_WINDOW  MPU_REGION_NUMBER0
+#define MPU_REGION_EXTFLASH     MPU_REGION_NUMBER1
+#define MPU_REGION_AXI_SRAM     MPU_REGION_NUMBER2
+#define MPU_REGION_RAM_UC       MPU_REGION_NUMBER3 // Up to 4 regions
+#define MPU_REGION_AHBRAM       MPU_REGION_NUMBER7
+#define MPU_REGION_NULLPTR      MPU_REGION_NUMBER8
+#define MPU_REGION_REDZONE      MPU_REGION_NUMBER9
+
+static void MPU_Region(uint32_t number, uint32_t base, uint32_t size, mpu_profile_t profile)
 {
   MPU_Region_InitTypeDef MPU_InitStruct = {0};
 
-  /* Disables the MPU */
-  HAL_MPU_Disable();
-  /** Initializes and configures the Region and the memory to be protected
-  */
   MPU_InitStruct.Enable = MPU_REGION_ENABLE;
-  MPU_InitStruct.Number = MPU_REGION_NUMBER0;
-  MPU_InitStruct.BaseAddress = 0x30000000;
-  MPU_InitStruct.Size = MPU_REGION_SIZE_128KB;
+  MPU_InitStruct.Number = number;
+  MPU_InitStruct.BaseAddress = base;
+  /* 128B --> 0x06, 256B --> 0x07, 512B --> 0x08, ... */
+  MPU_InitStruct.Size = ffs(size) - 2;
   MPU_InitStruct.SubRegionDisable = 0x0;
-  MPU_InitStruct.TypeExtField = MPU_TEX_LEVEL0;
   MPU_InitStruct.AccessPermission = MPU_REGION_FULL_ACCESS;
   MPU_InitStruct.DisableExec = MPU_INSTRUCTION_ACCESS_ENABLE;
   MPU_InitStruct.IsShareable = MPU_ACCESS_NOT_SHAREABLE;
-  MPU_InitStruct.IsCacheable = MPU_ACCESS_NOT_CACHEABLE;
-  MPU_InitStruct.IsBufferable = MPU_ACCESS_NOT_BUFFERABLE;
-
-  HAL_MPU_ConfigRegion(&MPU_InitStruct);
 
-  if (__builtin_popcount((size_t)&__NULLPTR_LENGTH__) == 1) {
-    /* Only continue if a single bit set in __NULLPTR_LENGTH__.
-     * The MPU can only handle memory sizes which are a power of 2 */
-    MPU_InitStruct.Enable = MPU_REGION_ENABLE;
-    MPU_InitStruct.Number = MPU_REGION_NUMBER1;
-    MPU_InitStruct.BaseAddress = 0x00000000;
-    /* 128B --> 0x06, 256B --> 0x07, 512B --> 0x08, ... */
-    MPU_InitStruct.Size = ffs((size_t)&__NULLPTR_LENGTH__) - 2;
-    MPU_InitStruct.SubRegionDisable = 0x0;
+  switch (profile) {
+  case MPU_PROFILE_NO_ACCESS:
     MPU_InitStruct.TypeExtField = MPU_TEX_LEVEL0;
     MPU_InitStruct.AccessPermission = MPU_REGION_NO_ACCESS;
-    MPU_InitStruct.DisableExec = MPU_INSTRUCTION_ACCESS_ENABLE;
-    MPU_InitStruct.IsShareable = MPU_ACCESS_NOT_SHAREABLE;
+    MPU_InitStruct.DisableExec = MPU_INSTRUCTION_ACCESS_DISABLE;
     MPU_InitStruct.IsCacheable = MPU_ACCESS_NOT_CACHEABLE;
     MPU_InitStruct.IsBufferable = MPU_ACCESS_NOT_BUFFERABLE;
-
-    HAL_MPU_ConfigRegion(&MPU_InitStruct);
-  }
-
-  // Stack redzone
-  if (__builtin_popcount((size_t)&_Stack_Redzone_Size) == 1) {
-    /* Only continue if a single bit set in _Stack_Redzone_Size.
-     * The MPU can only handle memory sizes which are a power of 2 */
-    MPU_InitStruct.Enable = MPU_REGION_ENABLE;
-    MPU_InitStruct.Number = MPU_REGION_NUMBER2;
-    MPU_InitStruct.BaseAddress = (uint32_t) &_stack_redzone;
-    /* 128B --> 0x06, 256B --> 0x07, 512B --> 0x08, ... */
-    MPU_InitStruct.Size = ffs((size_t)&_Stack_Redzone_Size) - 2;
-    MPU_InitStruct.SubRegionDisable = 0x0;
-    MPU_InitStruct.TypeExtField = MPU_TEX_LEVEL0;
-    MPU_InitStruct.AccessPermission = MPU_REGION_NO_ACCESS;
-    MPU_InitStruct.DisableExec = MPU_INSTRUCTION_ACCESS_DISABLE;
-    MPU_InitStruct.IsShareable = MPU_ACCESS_NOT_SHAREABLE;
+    break;
+  case MPU_PROFILE_UNCACHED:
+    MPU_InitStruct.TypeExtField = MPU_TEX_LEVEL1;
     MPU_InitStruct.IsCacheable = MPU_ACCESS_NOT_CACHEABLE;
     MPU_InitStruct.IsBufferable = MPU_ACCESS_NOT_BUFFERABLE;
-
-    HAL_MPU_ConfigRegion(&MPU_InitStruct);
+    break;
+  case MPU_PROFILE_WRITE_BACK:
+    MPU_InitStruct.TypeExtField = MPU_TEX_LEVEL1;
+    MPU_InitStruct.IsCacheable = MPU_ACCESS_CACHEABLE;
+    MPU_InitStruct.IsBufferable = MPU_ACCESS_BUFFERABLE;
+    break;
+  case MPU_PROFILE_XIP:
+    MPU_InitStruct.TypeExtField = MPU_TEX_LEVEL0;
+    MPU_InitStruct.AccessPermission = MPU_REGION_PRIV_RO_URO;
+    MPU_InitStruct.IsCacheable = MPU_ACCESS_CACHEABLE;
+    MPU_InitStruct.IsBufferable = MPU_ACCESS_BUFFERABLE;
+    break;
   }
 
-  /* Uncached areas lead to unalignment issues. Only protect the first 256+32+8+4 kB */
-  MPU_InitStruct.Enable = MPU_REGION_ENABLE;
-  MPU_InitStruct.Number = MPU_REGION_NUMBER3;
-  MPU_InitStruct.BaseAddress = 0x24000000;
-  MPU_InitStruct.Size = MPU_REGION_SIZE_256KB;
-  MPU_InitStruct.SubRegionDisable = 0x0;
-  MPU_InitStruct.TypeExtField = MPU_TEX_LEVEL0;
-  MPU_InitStruct.AccessPermission = MPU_REGION_FULL_ACCESS;
-  MPU_InitStruct.DisableExec = MPU_INSTRUCTION_ACCESS_ENABLE;
-  MPU_InitStruct.IsShareable = MPU_ACCESS_NOT_SHAREABLE;
-  MPU_InitStruct.IsCacheable = MPU_ACCESS_NOT_CACHEABLE;
-  MPU_InitStruct.IsBufferable = MPU_ACCESS_NOT_BUFFERABLE;
-
-  // 0x24000000 -> +256kB
   HAL_MPU_ConfigRegion(&MPU_InitStruct);
+}
 
-  // 0x24000000 + 256kB -> +32kB
-  MPU_InitStruct.Number = MPU_REGION_NUMBER4;
-  MPU_InitStruct.BaseAddress = 0x24000000 + 256 * 1024;
-  MPU_InitStruct.Size = MPU_REGION_SIZE_32KB;
-  HAL_MPU_ConfigRegion(&MPU_InitStruct);
+void MPU_Config(void)
+{
+  /* Disables the MPU */
+  HAL_MPU_Disable();
 
-  // 0x24000000 + 256kB + 32kB -> +8kB
-  MPU_InitStruct.Number = MPU_REGION_NUMBER5;
-  MPU_InitStruct.BaseAddress = 0x24000000 + (256 + 32) * 1024;
-  MPU_InitStruct.Size = MPU_REGION_SIZE_8KB;
-  HAL_MPU_ConfigRegion(&MPU_InitStruct);
+  // Launcher and emulator RAM
+  MPU_Region(MPU_REGION_AXI_SRAM, 0x24000000, 1024 * 1024, MPU_PROFILE_WRITE_BACK);
 
-  // 0x24000000 + 256kB + 32kB + 8kB -> +4kB
-  MPU_InitStruct.Number = MPU_REGION_NUMBER6;
-  MPU_InitStruct.BaseAddress = 0x24000000 + (256 + 32 + 8) * 1024;
-  MPU_InitStruct.Size = MPU_REGION_SIZE_4KB;
-  HAL_MPU_ConfigRegion(&MPU_InitStruct);
+  /* The LCD framebuffers in RAM_UC. A region has to be a power of 2, cover
+   * the first 256+32+8+4 kB with 4 of them */
+  MPU_Region(MPU_REGION_RAM_UC + 0, 0x24000000, 256 * 1024, MPU_PROFILE_UNCACHED);
+  MPU_Region(MPU_REGION_RAM_UC + 1, 0x24000000 + 256 * 1024, 32 * 1024, MPU_PROFILE_UNCACHED);
+  MPU_Region(MPU_REGION_RAM_UC + 2, 0x24000000 + (256 + 32) * 1024, 8 * 1024, MPU_PROFILE_UNCACHED);
+  MPU_Region(MPU_REGION_RAM_UC + 3, 0x24000000 + (256 + 32 + 8) * 1024, 4 * 1024, MPU_PROFILE_UNCACHED);
+
+  // .audio for the SAI DMA and .lcd3
+  MPU_Region(MPU_REGION_AHBRAM, 0x30000000, 128 * 1024, MPU_PROFILE_UNCACHED);
+
+  /* Only if a single bit set in __NULLPTR_LENGTH__ and _Stack_Redzone_Size.
+   * The MPU can only handle memory sizes which are a power of 2 */
+  if (__builtin_popcount((size_t)&__NULLPTR_LENGTH__) == 1) {
+    MPU_Region(MPU_REGION_NULLPTR, 0x00000000, (size_t)&__NULLPTR_LENGTH__, MPU_PROFILE_NO_ACCESS);
+  }
+  if (__builtin_popcount((size_t)&_Stack_Redzone_Size) == 1) {
+    MPU_Region(MPU_REGION_REDZONE, (uint32_t) &_stack_redzone, (size_t)&_Stack_Redzone_Size, MPU_PROFILE_NO_ACCESS);
+  }
 
   /* Enables the MPU */
   HAL_MPU_Enable(MPU_HFNMI_PRIVDEF);
 
 }
 
+/* Once the external flash is memory-mapped. By default the OSPI window is
+ * write-through and the core may read ahead anywhere in its 256 MB, only the
+ * flash itself is made accessible. */
+static void MPU_ConfigExtFlash(uint32_t flash_size)
+{
+  // The chip may not be known, the firmware was built for at least this much
+  uint32_t built_size = (uint32_t) &__EXTFLASH_OFFSET__ + (uint32_t) &__EXTFLASH_TOTAL_LENGTH__;
+  uint32_t size;
+
+  if (flash_size < built_size) {
+    flash_size = built_size;
+  }
+  // MPU regions are a power of 2
+  size = 1 << (32 - __builtin_clz(flash_size - 1));
+
+  HAL_MPU_Disable();
+  MPU_Region(MPU_REGION_OSPI_WINDOW, 0x90000000, 256 * 1024 * 1024, MPU_PROFILE_NO_ACCESS);
+  MPU_Region(MPU_REGION_EXTFLASH, 0x90000000, size, MPU_PROFILE_XIP);
+  HAL_MPU_Enable(MPU_HFNMI_PRIVDEF);
+}
+
 /**
   * @brief  This function is executed in case of error occurrence.
   * @retval None
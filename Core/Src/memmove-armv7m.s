@@ -0,0 +1,92 @@
+/* memmove for the Cortex-M7, next to memcpy-armv7m.s.
+
+   When a forward copy can't overwrite source bytes it hasn't read yet,
+   which is when dst is below src or past its end, the job is handed to
+   memcpy. memcpy-armv7m.s only ever reads ahead of what it writes, so
+   that also holds for overlapping buffers with dst below src.
+
+   Otherwise the copy runs backward from the end: 16 bytes per iteration
+   with LDMDB/STMDB when src and dst have the same alignment, bytes
+   otherwise.
+
+   Prototype: void *memmove (void *dst, const void *src, size_t count);
+ */
+
+	.syntax unified
+	.text
+	.align	2
+	.global	memmove
+	.thumb
+	.thumb_func
+	.type	memmove, %function
+memmove:
+	@ r0: dst
+	@ r1: src
+	@ r2: len
+	subs	r3, r0, r1
+	it	eq
+	bxeq	lr
+	cmp	r3, r2
+	blo	.Lbackward
+	b	memcpy
+
+.Lbackward:
+	mov	ip, r0
+	adds	r0, r0, r2
+	adds	r1, r1, r2
+
+	eor	r3, r0, r1
+	lsls	r3, r3, #30
+	bne	.Lbytes
+
+	/* Align the ends */
+	ands	r3, r0, #3
+	beq	.Laligned
+	cmp	r2, r3
+	blo	.Lbytes
+	subs	r2, r2, r3
+1:
+	ldrb	r3, [r1, #-1]!
+	strb	r3, [r0, #-1]!
+	tst	r0, #3
+	bne	1b
+
+.Laligned:
+	push	{r4, r5, r6}
+	subs	r2, r2, #16
+	blo	.Lwords
+
+	.align 2
+.Lblock_loop:
+	ldmdb	r1!, {r3, r4, r5, r6}
+	stmdb	r0!, {r3, r4, r5, r6}
+	subs	r2, r2, #16
+	bhs	.Lblock_loop
+
+.Lwords:
+	adds	r2, r2, #16 - 4
+	blo	.Lless_than_4
+
+.Lword_loop:
+	ldr	r3, [r1, #-4]!
+	str	r3, [r0, #-4]!
+	subs	r2, r2, #4
+	bhs	.Lword_loop
+
+.Lless_than_4:
+	adds	r2, r2, #4
+	pop	{r4, r5, r6}
+
+.Lbytes:
+	cbz	r2, .Ldone
+1:
+	ldrb	r3, [r1, #-1]!
+	strb	r3, [r0, #-1]!
+	subs	r2, r2, #1
+	bne	1b
+
+.Ldone:
+	mov	r0, ip
+	bx	lr
+
+	.size	memmove, .-memmove
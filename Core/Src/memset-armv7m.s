@@ -0,0 +1,80 @@
+/* memset for the Cortex-M7, next to memcpy-armv7m.s.
+
+   newlib's memset stores a word at a time. This one aligns dst and then
+   fills 32 bytes per iteration with STRD, so uncached buffers like the
+   framebuffers and the audio buffers are written 64 bits per transaction
+   on the AXI bus instead of 32.
+
+   Built with -mno-unaligned-access, so only aligned words are stored.
+
+   Prototype: void *memset (void *dst, int c, size_t count);
+ */
+
+	.syntax unified
+	.text
+	.align	2
+	.global	memset
+	.thumb
+	.thumb_func
+	.type	memset, %function
+memset:
+	@ r0: dst
+	@ r1: c
+	@ r2: len
+	mov	ip, r0
+	cmp	r2, #8
+	blo	.Lbytes
+
+	/* Byte to word */
+	and	r1, r1, #0xff
+	orr	r1, r1, r1, lsl #8
+	orr	r1, r1, r1, lsl #16
+
+	/* Align dst, len >= 8 so there's enough of it */
+	ands	r3, r0, #3
+	beq	.Laligned
+	rsb	r3, r3, #4
+	subs	r2, r2, r3
+1:
+	strb	r1, [r0], #1
+	subs	r3, r3, #1
+	bne	1b
+
+.Laligned:
+	subs	r2, r2, #32
+	blo	.Lwords
+
+	.align 2
+.Lblock_loop:
+	strd	r1, r1, [r0]
+	strd	r1, r1, [r0, #8]
+	strd	r1, r1, [r0, #16]
+	strd	r1, r1, [r0, #24]
+	adds	r0, r0, #32
+	subs	r2, r2, #32
+	bhs	.Lblock_loop
+
+.Lwords:
+	adds	r2, r2, #32 - 4
+	blo	.Lless_than_4
+
+.Lword_loop:
+	str	r1, [r0], #4
+	subs	r2, r2, #4
+	bhs	.Lword_loop
+
+.Lless_than_4:
+	adds	r2, r2, #4
+
+.Lbytes:
+	cbz	r2, .Ldone
+1:
+	strb	r1, [r0], #1
+	subs	r2, r2, #1
+	bne	1b
+
+.Ldone:
+	mov	r0, ip
+	bx	lr
+
+	.size	memset, .-memset
@@ -0,0 +1,46 @@
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "main.h"
+#include "gw_timer.h"
+#include "boot_trace.h"
+
+boot_trace_entry_t boot_trace_entries[BOOT_TRACE_MAX];
+uint32_t boot_trace_count;
+
+static bool done;
+
+void boot_trace(const char *name)
+{
+    if (done || boot_trace_count >= BOOT_TRACE_MAX) {
+        return;
+    }
+
+    boot_trace_entries[boot_trace_count].name = name;
+    boot_trace_entries[boot_trace_count].us = gw_timer_us();
+    boot_trace_count++;
+}
+
+void boot_trace_frame_shown(void)
+{
+    if (done) {
+        return;
+    }
+
+    boot_trace("first frame");
+    done = true;
+
+    // lcd_swap() may run in an interrupt handler, leave the printing to
+    // tools/logpoll.py --boot-trace in that case
+    if (__get_IPSR() != 0) {
+        return;
+    }
+
+    uint32_t last = 0;
+    for (int i = 0; i < boot_trace_count; i++) {
+        const boot_trace_entry_t *e = &boot_trace_entries[i];
+
+        printf("Boot: %-16s %7lu us (+%lu)\n", e->name, e->us, e->us - last);
+        last = e->us;
+    }
+}
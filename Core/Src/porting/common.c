@@ -12,13 +12,25 @@
 #include "main.h"
 #include "gw_buttons.h"
 #include "gw_lcd.h"
+#include "gw_blit.h"
+#include "gw_dirty.h"
 #include "gw_linker.h"
-
-#if ENABLE_SCREENSHOT
-uint16_t framebuffer_capture[GW_LCD_WIDTH * GW_LCD_HEIGHT]  __attribute__((section (".fbflash"))) __attribute__((aligned(4096)));
-#endif
+#include "gw_timer.h"
+#include "store_async.h"
+#include "state_slots.h"
+#include "rom_manager.h"
+#include "quick_save.h"
+#include "profiler.h"
+#include "frame_stats.h"
+#include "frame_watch.h"
+#include "input_replay.h"
+#include "cpu_clock.h"
+#include "rewind.h"
+#include "screenshot.h"
+#include "game_profile.h"
 
 static void set_ingame_overlay(ingame_overlay_t type);
+static bool flash_work(void);
 
 cpumon_stats_t cpumon_stats = {0};
 
@@ -28,7 +40,7 @@ uint32_t audio_mute;
 
 int16_t pendingSamples = 0;
 int16_t audiobuffer_emulator[AUDIO_BUFFER_LENGTH] __attribute__((section (".audio")));
-int16_t audiobuffer_dma[AUDIO_BUFFER_LENGTH * 2] __attribute__((section (".audio")));
+int16_t audiobuffer_dma[AUDIO_BUFFER_LENGTH * 2] __attribute__((section (".audio"))) __attribute__((aligned(4)));
 
 dma_transfer_state_t dma_state;
 uint32_t dma_counter;
@@ -50,12 +62,14 @@ void HAL_SAI_TxHalfCpltCallback(SAI_HandleTypeDef *hsai)
 {
     dma_counter++;
     dma_state = DMA_TRANSFER_STATE_HF;
+    odroid_audio_ring_dma_done();
 }
 
 void HAL_SAI_TxCpltCallback(SAI_HandleTypeDef *hsai)
 {
     dma_counter++;
     dma_state = DMA_TRANSFER_STATE_TC;
+    odroid_audio_ring_dma_done();
 }
 
 
@@ -67,10 +81,13 @@ bool odroid_netplay_quick_start(void)
 // TODO: Move to own file
 void odroid_audio_mute(bool mute)
 {
+    // The SAI sends zeros from the next sample on, nothing has to be cleared.
+    // Meanwhile the DMA interrupt keeps refilling the DMA buffer with silence,
+    // so there are no old samples left over once unmuted.
     if (mute) {
-        for (int i = 0; i < sizeof(audiobuffer_dma) / sizeof(audiobuffer_dma[0]); i++) {
-            audiobuffer_dma[i] = 0;
-        }
+        HAL_SAI_EnableTxMuteMode(&hsai_BlockA1, SAI_ZERO_VALUE);
+    } else {
+        HAL_SAI_DisableTxMuteMode(&hsai_BlockA1);
     }
 
     audio_mute = mute;
@@ -80,16 +97,111 @@ common_emu_state_t common_emu_state = {
     .frame_time_10us = (uint16_t)(100000 / 60 + 0.5f),  // Reasonable default of 60FPS if not explicitly configured.
 };
 
+// Frame time with the speedup applied, what common_emu_sync() paces on
+static int16_t frame_period_10us;
+
+/*
+ * Frame skipping. The busy part of every frame, from common_emu_frame_loop()
+ * until common_emu_sync() starts waiting, is measured in cycles. Frames that
+ * were drawn and frames that were only emulated are averaged separately,
+ * which gives the cost of emulating a frame and, as the difference, of
+ * rendering and blitting it.
+ *
+ * A frame is only skipped if drawing it is predicted to miss its deadline,
+ * given how late the previous one finished, and skipping it actually saves
+ * time. The emulation itself always runs, so audio is never skipped.
+ */
+#define FRAME_SKIP_MAX      3   // In a row, so the screen still updates now and then, by default
+#define FRAME_COST_SHIFT    3   // Averaged over about 8 frames
+
+static uint32_t frame_start_cycles;
+static uint32_t frame_busy_cycles;
+static uint32_t frame_cost[2];      // Busy cycles of a frame, [0] skipped, [1] drawn
+static int32_t frame_late_us;       // How late the last frame finished
+static uint8_t frames_skipped;      // In a row
+static uint8_t frame_skip_max = FRAME_SKIP_MAX;
+
+// Fast-forward, see SPEEDUP_UNLOCKED
+#define FAST_FORWARD_SPEED_SHIFT 3  // Averaged over about 8 frames
+
+static uint32_t ff_last_frame_us;
+static uint32_t ff_last_drawn_us;
+static uint32_t ff_speed;           // 16.16, measured
+static bool ff_muted;
+
+static void frame_cost_update(uint32_t *cost, uint32_t cycles)
+{
+    if (*cost == 0) {
+        *cost = cycles;
+    } else {
+        *cost += ((int32_t) (cycles - *cost)) >> FRAME_COST_SHIFT;
+    }
+}
+
+// Instead of the pacing and frame skipping, once the startup frames are done
+static bool fast_forward_frame(int16_t frame_time_10us)
+{
+    uint32_t now = gw_timer_us();
+    uint32_t period_us = now - ff_last_frame_us;
+    uint32_t speed;
+
+    ff_last_frame_us = now;
+
+    // The menus unmute when they close, checked on every frame
+    if (!audio_mute) {
+        odroid_audio_mute(true);
+        ff_muted = true;
+    }
+
+    // At least 1x, the first frame after the menu takes as long as it was open
+    if (period_us > 0 && period_us < 10 * frame_time_10us) {
+        speed = ((uint64_t) (10 * frame_time_10us) << 16) / period_us;
+    } else {
+        speed = 0x10000;
+    }
+    if (ff_speed == 0) {
+        ff_speed = speed;
+    } else {
+        ff_speed += ((int32_t) (speed - ff_speed)) >> FAST_FORWARD_SPEED_SHIFT;
+    }
+    odroid_audio_ring_set_speed(ff_speed);
+
+    // Still the 1x period, for the frame stats and the governor
+    frame_period_10us = frame_time_10us;
+    frames_skipped = 0;
+
+    if ((now - ff_last_drawn_us) >= FAST_FORWARD_DISPLAY_US) {
+        ff_last_drawn_us = now;
+    } else {
+        common_emu_state.skip_frames = 1;
+        common_emu_state.skipped_frames++;
+    }
+
+    rewind_frame();
+
+    frame_start_cycles = gw_timer_cycles();
+
+    return common_emu_state.skip_frames == 0;
+}
 
 bool common_emu_frame_loop(void){
     rg_app_desc_t *app = odroid_system_get_app();
-    static int32_t frame_integrator = 0;
     int16_t frame_time_10us = common_emu_state.frame_time_10us;
-    int16_t elapsed_10us = 100 * get_elapsed_time_since(common_emu_state.last_sync_time);
-    bool draw_frame = common_emu_state.skip_frames < 2;
+    bool was_drawn = common_emu_state.skip_frames == 0;
 
-    if( !cpumon_stats.busy_ms ) cpumon_busy();
-    odroid_system_tick(!draw_frame, 0, cpumon_stats.busy_ms);
+    // For the frame that just ended
+    if (!was_drawn) {
+        frame_stats_tag(FRAME_TAG_SKIPPED);
+    }
+    if (common_emu_state.startup_frames == 0) {
+        frame_stats_tag(FRAME_TAG_MENU);
+    }
+    frame_stats_frame(10 * (frame_period_10us ? frame_period_10us : frame_time_10us));
+    frame_watch_arm(10 * (frame_period_10us ? frame_period_10us : frame_time_10us));
+
+    if( !cpumon_stats.busy_us ) cpumon_busy();
+    odroid_system_tick(!was_drawn, 0, cpumon_stats.busy_us);
+    uint32_t busy_us = cpumon_stats.busy_us;
     cpumon_reset();
 
     common_emu_state.pause_frames = 0;
@@ -97,11 +209,44 @@ bool common_emu_frame_loop(void){
 
     common_emu_state.last_sync_time = get_elapsed_time();
 
+    if (common_emu_state.startup_frames == 0) {
+        profiler_reset();
+    } else {
+        profiler_frame();
+    }
+
     if(common_emu_state.startup_frames < 3) {
+        if (common_emu_state.startup_frames == 0) {
+            // After the menus, loading a state and the like
+            frame_busy_cycles = 0;
+            frames_skipped = 0;
+        }
         common_emu_state.startup_frames++;
+        frame_start_cycles = gw_timer_cycles();
         return true;
     }
 
+    if (frame_busy_cycles) {
+        frame_cost_update(&frame_cost[was_drawn], frame_busy_cycles);
+        frame_busy_cycles = 0;
+    }
+
+    // Cycle counts don't depend on the clock, the frame costs stay valid.
+    // Fast-forward takes all there is, the governor sees every frame late.
+    if (cpu_clock_governor(busy_us, 10 * (frame_period_10us ? frame_period_10us : frame_time_10us),
+                           !was_drawn || app->speedupEnabled == SPEEDUP_UNLOCKED)) {
+        // The switch stopped the microsecond clock for a moment
+        cpumon_stats.last_busy = 0;
+    }
+
+    if (app->speedupEnabled == SPEEDUP_UNLOCKED) {
+        return fast_forward_frame(frame_time_10us);
+    }
+    if (ff_muted) {
+        odroid_audio_mute(false);
+        ff_muted = false;
+    }
+
     switch(app->speedupEnabled){
         case SPEEDUP_0_5x:
             frame_time_10us *= 2;
@@ -125,13 +270,117 @@ bool common_emu_frame_loop(void){
             frame_time_10us /= 3;
             break;
     }
-    frame_integrator += (elapsed_10us - frame_time_10us);
-    if(frame_integrator > frame_time_10us << 1) common_emu_state.skip_frames = 2;
-    else if(frame_integrator > frame_time_10us) common_emu_state.skip_frames = 1;
-    else if(frame_integrator < -frame_time_10us) common_emu_state.pause_frames = 1;
-    common_emu_state.skipped_frames += common_emu_state.skip_frames;
+    frame_period_10us = frame_time_10us;
+    odroid_audio_ring_set_speed(((uint32_t) common_emu_state.frame_time_10us << 16) / frame_time_10us);
+
+    // Skip the blit only if drawing would overrun and not drawing doesn't
+    int32_t draw_us = gw_timer_cycles_to_us(frame_cost[1]);
+    int32_t skip_us = gw_timer_cycles_to_us(frame_cost[0]);
+    bool overrun = frame_late_us + draw_us > 10 * frame_time_10us;
+    bool saves = !frame_cost[0] || (skip_us < draw_us);
+
+    if (overrun && saves && frames_skipped < frame_skip_max) {
+        common_emu_state.skip_frames = 1;
+        common_emu_state.skipped_frames++;
+        frames_skipped++;
+    } else {
+        frames_skipped = 0;
+    }
+    game_profile_frame(common_emu_state.skip_frames != 0);
+
+    rewind_frame();
+
+    frame_start_cycles = gw_timer_cycles();
+
+    return common_emu_state.skip_frames == 0;
+}
+
+void common_emu_set_frame_skip_max(uint8_t frames)
+{
+    frame_skip_max = frames;
+}
+
+#if LCD_PACING
+/*
+ * At the normal speed the LCD refreshes at the frame rate of the core and
+ * the frames are paced on its vertical blanking, the audio ring's rate
+ * control takes up what's left of the difference. Returns false if the
+ * LCD can't run at the rate, gw_timer paces the frames then.
+ */
+static bool lcd_pace(int32_t period)
+{
+    static uint32_t next_refresh;
+    uint32_t refresh;
+
+    if (period != 10 * common_emu_state.frame_time_10us ||
+        lcd_set_refresh_rate(100000000 / common_emu_state.frame_time_10us) == 0) {
+        return false;
+    }
+
+    // Start over after the menu, loading a state and the like
+    refresh = lcd_get_refresh_count();
+    if ((int32_t) (next_refresh - refresh) > 2 || (int32_t) (refresh - next_refresh) > 2) {
+        next_refresh = refresh;
+    }
 
-    return draw_frame;
+    frame_late_us = (int32_t) (refresh - next_refresh) * period;
+    if (frame_late_us < 0) {
+        frame_late_us = 0;
+    }
+
+    profiler_begin(PROFILER_SYNC);
+    while ((int32_t) (next_refresh - lcd_get_refresh_count()) > 0) {
+        // Woken up by the LTDC line interrupt
+        cpumon_sleep();
+    }
+    profiler_end(PROFILER_SYNC);
+    next_refresh++;
+
+    return true;
+}
+#endif
+
+void common_emu_sync(void)
+{
+    static uint32_t next_frame_us;
+    int32_t period = 10 * (frame_period_10us ? frame_period_10us : common_emu_state.frame_time_10us);
+    uint32_t now = gw_timer_us();
+
+    frame_busy_cycles = gw_timer_cycles() - frame_start_cycles;
+
+    // Start over after the menu, loading a state and the like
+    if ((int32_t) (next_frame_us - now) > 2 * period ||
+        (int32_t) (now - next_frame_us) > 2 * period) {
+        next_frame_us = now;
+    }
+
+    frame_late_us = (int32_t) (now - next_frame_us);
+    if (frame_late_us < 0) {
+        frame_late_us = 0;
+    }
+
+    if (odroid_system_get_app()->speedupEnabled == SPEEDUP_UNLOCKED) {
+        // No waiting, only the flash work that would have been done in it
+        flash_work();
+        next_frame_us = now;
+        frame_late_us = 0;
+        return;
+    }
+
+#if LCD_PACING
+    if (lcd_pace(period)) {
+        next_frame_us = now + period;
+        return;
+    }
+#endif
+
+    profiler_begin(PROFILER_SYNC);
+    while ((int32_t) (next_frame_us - now) > 0) {
+        cpumon_sleep();
+        now = gw_timer_us();
+    }
+    profiler_end(PROFILER_SYNC);
+    next_frame_us += period;
 }
 
 
@@ -142,6 +391,54 @@ bool common_emu_frame_loop(void){
  * is called.
  *
  */
+static common_emu_pad_cb_t late_poll_cb;
+// What the emulator was given last, in this frame
+static uint16_t late_poll_bitmask;
+
+void common_emu_input_set_late_poll(common_emu_pad_cb_t cb)
+{
+    late_poll_cb = cb;
+}
+
+void common_emu_reset(void)
+{
+    common_emu_state = (common_emu_state_t) {
+        .frame_time_10us = (uint16_t)(100000 / 60 + 0.5f),
+    };
+    frame_period_10us = 0;
+
+    frame_busy_cycles = 0;
+    memset(frame_cost, 0, sizeof(frame_cost));
+    frame_late_us = 0;
+    frames_skipped = 0;
+    frame_skip_max = FRAME_SKIP_MAX;
+
+    ff_last_frame_us = 0;
+    ff_last_drawn_us = 0;
+    ff_speed = 0;
+    ff_muted = false;
+
+    late_poll_cb = NULL;
+}
+
+void common_emu_input_late_poll(void)
+{
+    odroid_gamepad_state_t joystick;
+
+    if (!late_poll_cb || input_replay_get_mode() != INPUT_REPLAY_OFF) {
+        return;
+    }
+
+    odroid_input_read_gamepad(&joystick);
+    if (joystick.bitmask == late_poll_bitmask ||
+        joystick.values[ODROID_INPUT_VOLUME] || joystick.values[ODROID_INPUT_POWER]) {
+        return;
+    }
+
+    late_poll_bitmask = joystick.bitmask;
+    late_poll_cb(&joystick);
+}
+
 void common_emu_input_loop(odroid_gamepad_state_t *joystick, odroid_dialog_choice_t *game_options) {
     rg_app_desc_t *app = odroid_system_get_app();
     static emu_speedup_t last_speedup = SPEEDUP_1_5x;
@@ -149,6 +446,14 @@ void common_emu_input_loop(odroid_gamepad_state_t *joystick, odroid_dialog_choic
     static bool pause_pressed = false;
     static bool macro_activated = false;
 
+    profiler_begin(PROFILER_INPUT);
+
+    if (joystick->values[ODROID_INPUT_VOLUME] || joystick->values[ODROID_INPUT_POWER] || pause_pressed) {
+        // Menus and macros draw on the LCD framebuffers, finish any pipelined blit first.
+        gw_blit_wait();
+        gw_dirty_invalidate();
+    }
+
     if(joystick->values[ODROID_INPUT_VOLUME]){  // PAUSE/SET button
         // PAUSE/SET has been pressed, checking additional inputs for macros
         pause_pressed = true;
@@ -160,15 +465,7 @@ void common_emu_input_loop(odroid_gamepad_state_t *joystick, odroid_dialog_choic
                 odroid_system_sleep();
             }
             else if(joystick->values[ODROID_INPUT_START]){ // GAME button
-#if ENABLE_SCREENSHOT
-                printf("Capturing screenshot...\n");
-                odroid_audio_mute(true);
-                store_save((uint8_t *) framebuffer_capture, lcd_get_inactive_buffer(), sizeof(framebuffer_capture));
-                odroid_audio_mute(false);
-                printf("Screenshot captured\n");
-#else
-                printf("Screenshot support is disabled\n");
-#endif
+                screenshot_take();
                 last_key = ODROID_INPUT_START;
             }
             else if(joystick->values[ODROID_INPUT_SELECT]){ // TIME button
@@ -217,23 +514,30 @@ void common_emu_input_loop(odroid_gamepad_state_t *joystick, odroid_dialog_choic
                 odroid_audio_mute(true);
 
                 // Call ingame overlay so that the save icon gets displayed first.
+                state_slot_capture_thumb();
                 set_ingame_overlay(INGAME_OVERLAY_SAVE);
                 common_ingame_overlay();
                 lcd_sync();
 
-                odroid_system_emu_save_state(0);
+                odroid_system_emu_save_state(state_slot_get());
                 odroid_audio_mute(false);
                 common_emu_state.startup_frames = 0;
             }
             else if(joystick->values[ODROID_INPUT_B]){
-                // Load State
+                // Load State, or rewind while it's held
                 last_key = ODROID_INPUT_B;
-                odroid_system_emu_load_state(0);
-                common_emu_state.startup_frames = 0;
+                if (!rewind_enabled()) {
+                    odroid_system_emu_load_state(state_slot_get());
+                    common_emu_state.startup_frames = 0;
+                }
                 set_ingame_overlay(INGAME_OVERLAY_LOAD);
             }
         }
 
+        if (last_key == ODROID_INPUT_B && joystick->values[ODROID_INPUT_B] && rewind_step()) {
+            common_emu_state.startup_frames = 0;
+        }
+
         if (last_key >= 0) {
             macro_activated = true;
             if (!joystick->values[last_key]) {
@@ -253,11 +557,17 @@ void common_emu_input_loop(odroid_gamepad_state_t *joystick, odroid_dialog_choic
         // PAUSE/SET has been released without performing any macro. Launch menu
         pause_pressed = false;
 
+        // Saving and loading states shouldn't wait for a slow clock
+        cpu_clock_reset();
+        lcd_overlay_show(NULL);
+        frame_watch_disarm();
         odroid_overlay_game_menu(game_options);
-        memset(framebuffer1, 0x0, sizeof(framebuffer1));
-        memset(framebuffer2, 0x0, sizeof(framebuffer2));
+        lcd_clear_async(0);
+        gw_dirty_invalidate();
         common_emu_state.startup_frames = 0;
         cpumon_stats.last_busy = 0;
+        // Some cores draw straight into the LCD buffers while they emulate
+        gw_blit_wait();
     }
     else if (!joystick->values[ODROID_INPUT_VOLUME]){
         pause_pressed = false;
@@ -272,8 +582,17 @@ void common_emu_input_loop(odroid_gamepad_state_t *joystick, odroid_dialog_choic
     if (joystick->values[ODROID_INPUT_POWER]) {
         // Save-state and poweroff
         HAL_SAI_DMAStop(&hsai_BlockA1);
+        cpu_clock_reset();
 #if STATE_SAVING == 1
-        app->saveState("");
+        // Keep the state in RAM if it's small enough, writing it is left for the next boot.
+        // Not for a suspend: the game goes on from here, and a quick-save left
+        // in the backup SRAM would win over the later saves.
+        if (ACTIVE_FILE->save_size > 0) {
+            if (odroid_settings_SleepMode_get() != ODROID_SLEEP_SUSPEND) {
+                quick_save_arm();
+            }
+            app->saveState("");
+        }
 #endif
         odroid_system_sleep();
     }
@@ -284,20 +603,25 @@ void common_emu_input_loop(odroid_gamepad_state_t *joystick, odroid_dialog_choic
             pause_pressed = true;
         }
     }
+
+    input_replay_frame(joystick);
+    late_poll_bitmask = joystick->bitmask;
+
+    profiler_end(PROFILER_INPUT);
 }
 
 static void cpumon_common(bool sleep){
-    uint t0 = get_elapsed_time();
+    uint t0 = gw_timer_us();
     if(cpumon_stats.last_busy){
-        cpumon_stats.busy_ms += t0 - cpumon_stats.last_busy;
+        cpumon_stats.busy_us += t0 - cpumon_stats.last_busy;
     }
     else{
-        cpumon_stats.busy_ms = 0;
+        cpumon_stats.busy_us = 0;
     }
     if(sleep) __WFI();
-    uint t1 = get_elapsed_time();
+    uint t1 = gw_timer_us();
     cpumon_stats.last_busy = t1;
-    cpumon_stats.sleep_ms += t1 - t0;
+    cpumon_stats.sleep_us += t1 - t0;
 }
 
 
@@ -305,16 +629,34 @@ void cpumon_busy(void){
     cpumon_common(false);
 }
 
+static bool flash_work(void){
+    bool stored;
+
+    // Use the idle time for pending flash writes, see store_async.h
+    profiler_begin(PROFILER_FLASH);
+    stored = store_async_step();
+    if (!stored) {
+        quick_save_poll();
+    }
+    profiler_end(PROFILER_FLASH);
+
+    return stored;
+}
+
 void cpumon_sleep(void){
+    if(flash_work()){
+        cpumon_busy();
+        return;
+    }
     cpumon_common(true);
 }
 
 void cpumon_reset(void){
-    cpumon_stats.busy_ms = 0;
-    cpumon_stats.sleep_ms = 0;
+    cpumon_stats.busy_us = 0;
+    cpumon_stats.sleep_us = 0;
 }
 
-#define OVERLAY_COLOR_565 0xFFFF
+#define OVERLAY_COLOR_4444 0xFFFF
 
 static const uint8_t ROUND[] = {  // This is the top/left of a 8-pixel radius circle
     0b00000001,
@@ -463,46 +805,62 @@ static const uint8_t IMG_3X[] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 };
 
+static const uint8_t IMG_MAX[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x04, 0x00, 0x03, 0x06, 0x00,
+    0x03, 0x87, 0x00, 0x03, 0xC7, 0x80, 0x03, 0xE7,
+    0xC0, 0x03, 0xF7, 0xE0, 0x03, 0xF7, 0xE0, 0x03,
+    0xE7, 0xC0, 0x03, 0xC7, 0x80, 0x03, 0x87, 0x00,
+    0x03, 0x06, 0x00, 0x02, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+// Coordinates are on the LCD, the overlay layer covers the in-game overlay
+#define OVERLAY_PIXEL(_buf, _x, _y) (_buf)[((_x) - LCD_OVERLAY_X) + LCD_OVERLAY_W * ((_y) - LCD_OVERLAY_Y)]
+
 __attribute__((optimize("unroll-loops")))
-static void draw_img(pixel_t *fb, const uint8_t *img, uint16_t x, uint16_t y){
+static void draw_img(uint16_t *fb, const uint8_t *img, uint16_t x, uint16_t y){
     uint16_t idx = 0;
     for(uint8_t i=0; i < IMG_H; i++) {
         for(uint8_t j=0; j < IMG_W; j++) {
             if(img[idx / 8] & (1 << (7 - idx % 8))){
-                fb[x + j +  GW_LCD_WIDTH * (y + i)] = OVERLAY_COLOR_565;
+                OVERLAY_PIXEL(fb, x + j, y + i) = OVERLAY_COLOR_4444;
             }
             idx++;
         }
     }
 }
 
-#define DARKEN_MASK_565 0x7BEF  // Mask off the MSb of each color
-#define DARKEN_ADD_565 0x2104  // value of 4-red, 8-green, 4-blue to add back in a little gray, especially on black backgrounds
-static inline void darken_pixel(pixel_t *p){
-    // Quickly divide all colors by 2
-    *p = ((*p >> 1) & DARKEN_MASK_565) + DARKEN_ADD_565;
+// About what halving the game's colors and adding back a little gray did,
+// blended in by the LTDC. Darkening twice is darker.
+#define DARKEN_4444  0x8444
+#define DARKER_4444  0xC444
+static inline void darken_pixel(uint16_t *p){
+    *p = (*p == DARKEN_4444) ? DARKER_4444 : DARKEN_4444;
 }
 
 __attribute__((optimize("unroll-loops")))
-static void draw_rectangle(pixel_t *fb, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2){
+static void draw_rectangle(uint16_t *fb, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2){
     for(uint16_t i=y1; i < y2; i++){
         for(uint16_t j=x1; j < x2; j++){
-            fb[j + GW_LCD_WIDTH * i] = OVERLAY_COLOR_565;
+            OVERLAY_PIXEL(fb, j, i) = OVERLAY_COLOR_4444;
         }
     }
 }
 
 __attribute__((optimize("unroll-loops")))
-static void draw_darken_rectangle(pixel_t *fb, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2){
+static void draw_darken_rectangle(uint16_t *fb, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2){
     for(uint16_t i=y1; i < y2; i++){
         for(uint16_t j=x1; j < x2; j++){
-            darken_pixel(&fb[j + GW_LCD_WIDTH * i]);
+            darken_pixel(&OVERLAY_PIXEL(fb, j, i));
         }
     }
 }
 
 __attribute__((optimize("unroll-loops")))
-static void draw_darken_rounded_rectangle(pixel_t *fb, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2){
+static void draw_darken_rounded_rectangle(uint16_t *fb, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2){
     // *1 is inclusive, *2 is exclusive
     uint16_t h = y2 - y1;
     uint16_t w = x2 - x1;
@@ -514,37 +872,37 @@ static void draw_darken_rounded_rectangle(pixel_t *fb, uint16_t x1, uint16_t y1,
 
     // Draw upper left round
     for(uint8_t i=0; i < 8; i++) for(uint8_t j=0; j < 8; j++)
-        if(ROUND[i] & (1 << (7 - j))) darken_pixel(&fb[x1 + j + GW_LCD_WIDTH * (y1 + i)]);
+        if(ROUND[i] & (1 << (7 - j))) darken_pixel(&OVERLAY_PIXEL(fb, x1 + j, y1 + i));
 
     // Draw upper right round
     for(uint8_t i=0; i < 8; i++) for(uint8_t j=0; j < 8; j++)
-        if(ROUND[i] & (1 << (7 - j))) darken_pixel(&fb[x2 - j - 1 + GW_LCD_WIDTH * (y1 + i)]);
+        if(ROUND[i] & (1 << (7 - j))) darken_pixel(&OVERLAY_PIXEL(fb, x2 - j - 1, y1 + i));
 
     // Draw lower left round
     for(uint8_t i=0; i < 8; i++) for(uint8_t j=0; j < 8; j++)
-        if(ROUND[i] & (1 << (7 - j))) darken_pixel(&fb[x1 + j + GW_LCD_WIDTH * (y2 - i - 1)]);
+        if(ROUND[i] & (1 << (7 - j))) darken_pixel(&OVERLAY_PIXEL(fb, x1 + j, y2 - i - 1));
 
     // Draw lower right round
     for(uint8_t i=0; i < 8; i++) for(uint8_t j=0; j < 8; j++)
-        if(ROUND[i] & (1 <<  (7 - j))) darken_pixel(&fb[x2 - j - 1 + GW_LCD_WIDTH * (y2 - i - 1)]);
+        if(ROUND[i] & (1 <<  (7 - j))) darken_pixel(&OVERLAY_PIXEL(fb, x2 - j - 1, y2 - i - 1));
 
     // Draw upper rectangle
     for(uint16_t i=x1+8; i < x2 - 8; i++) for(uint8_t j=0; j < 8; j++)
-        darken_pixel(&fb[ i + GW_LCD_WIDTH * (y1 + j)]);
+        darken_pixel(&OVERLAY_PIXEL(fb, i, y1 + j));
 
     // Draw central rectangle
     for(uint16_t i=x1; i < x2; i++) for(uint16_t j=y1+8; j < y2-8; j++)
-        darken_pixel(&fb[i+GW_LCD_WIDTH * j]);
+        darken_pixel(&OVERLAY_PIXEL(fb, i, j));
 
     // Draw lower rectangle
     for(uint16_t i=x1+8; i < x2 - 8; i++) for(uint8_t j=0; j < 8; j++)
-        darken_pixel(&fb[ i + GW_LCD_WIDTH * (y2 - j - 1)]);
+        darken_pixel(&OVERLAY_PIXEL(fb, i, y2 - j - 1));
 }
 
-#define INGAME_OVERLAY_X 265
-#define INGAME_OVERLAY_Y 10
-#define INGAME_OVERLAY_BARS_H 128
-#define INGAME_OVERLAY_W 39
+#define INGAME_OVERLAY_X LCD_OVERLAY_X
+#define INGAME_OVERLAY_Y LCD_OVERLAY_Y
+#define INGAME_OVERLAY_BARS_H LCD_OVERLAY_H
+#define INGAME_OVERLAY_W LCD_OVERLAY_W
 #define INGAME_OVERLAY_BORDER 4
 #define INGAME_OVERLAY_BOX_GAP 2
 
@@ -575,18 +933,55 @@ static uint8_t box_height(uint8_t n) {
 }
 
 void common_ingame_overlay(void) {
+    static uint32_t drawn_key;
+    static uint16_t *drawn;
     rg_app_desc_t *app = odroid_system_get_app();
-    pixel_t *fb = lcd_get_active_buffer();
-    int8_t level;
+    uint16_t *fb;
+    int8_t level = 0;
     uint8_t bh;
     uint16_t by = INGAME_OVERLAY_BOX_Y;
 
+    profiler_begin(PROFILER_OVERLAY);
+    profiler_draw_overlay();
+
+    if (common_emu_state.overlay == INGAME_OVERLAY_NONE) {
+        lcd_overlay_show(NULL);
+        profiler_end(PROFILER_OVERLAY);
+        return;
+    }
+    frame_stats_tag(FRAME_TAG_OVERLAY);
+
+    switch(common_emu_state.overlay)
+    {
+        case INGAME_OVERLAY_VOLUME:
+            level = odroid_audio_volume_get();
+            break;
+        case INGAME_OVERLAY_BRIGHTNESS:
+            level = odroid_display_get_backlight();
+            break;
+        case INGAME_OVERLAY_SPEEDUP:
+            level = app->speedupEnabled;
+            break;
+        default:
+            break;
+    }
+
+    // It's on its own layer, only drawn again when it changes
+    uint32_t key = (common_emu_state.overlay << 8) | (uint8_t) level;
+    if (key == drawn_key) {
+        lcd_overlay_show(drawn);
+        profiler_end(PROFILER_OVERLAY);
+        return;
+    }
+
+    fb = lcd_overlay_get_buffer();
+    memset(fb, 0, LCD_OVERLAY_W * LCD_OVERLAY_H * sizeof(fb[0]));
+
     switch(common_emu_state.overlay)
     {
         case INGAME_OVERLAY_NONE:
             break;
         case INGAME_OVERLAY_VOLUME:
-            level = odroid_audio_volume_get();
             bh = box_height(ODROID_AUDIO_VOLUME_MAX);
 
             draw_darken_rounded_rectangle(fb,
@@ -614,7 +1009,6 @@ void common_ingame_overlay(void) {
             }
             break;
         case INGAME_OVERLAY_BRIGHTNESS:
-            level = odroid_display_get_backlight();
             bh = box_height(ODROID_BACKLIGHT_LEVEL_COUNT - 1);
 
             draw_darken_rounded_rectangle(fb,
@@ -673,10 +1067,19 @@ void common_ingame_overlay(void) {
                 case SPEEDUP_3x:
                     draw_img(fb, IMG_3X, INGAME_OVERLAY_IMG_X, INGAME_OVERLAY_IMG_Y);
                     break;
+                case SPEEDUP_UNLOCKED:
+                    draw_img(fb, IMG_MAX, INGAME_OVERLAY_IMG_X, INGAME_OVERLAY_IMG_Y);
+                    break;
             }
             break;
 
     }
+
+    drawn_key = key;
+    drawn = fb;
+    lcd_overlay_show(fb);
+
+    profiler_end(PROFILER_OVERLAY);
 }
 
 static void set_ingame_overlay(ingame_overlay_t type){
@@ -0,0 +1,189 @@
+#include <stdio.h>
+
+#include "main.h"
+#include "cpu_clock.h"
+
+// PLL1 runs from the 64 MHz HSI divided by 16, so the core gets 2 * N MHz
+#define PLL1_M 16
+#define PLL1_P 2
+
+// TIM1 (the battery readout) ticks at 20 kHz, its prescaler is for 280 MHz
+#define TIM1_PRESCALER_PER_MHZ 50
+
+#define GOVERNOR_WINDOW 60
+
+// Busy percent of a frame that raises the level, and that the next level
+// down has to stay under to lower it
+#define GOVERNOR_UP_PCT   90
+#define GOVERNOR_DOWN_PCT 75
+
+typedef struct {
+    uint16_t mhz;
+    uint16_t pll1_n;
+    uint32_t vos;
+    uint32_t latency;
+} level_t;
+
+// Highest frequency of each voltage scale, with the wait states of the
+// internal flash for it
+static const level_t levels[CPU_CLOCK_LEVEL_COUNT] = {
+    [CPU_CLOCK_280MHZ] = {280, 140, PWR_REGULATOR_VOLTAGE_SCALE0, FLASH_LATENCY_7},
+    [CPU_CLOCK_220MHZ] = {220, 110, PWR_REGULATOR_VOLTAGE_SCALE1, FLASH_LATENCY_5},
+    [CPU_CLOCK_160MHZ] = {160,  80, PWR_REGULATOR_VOLTAGE_SCALE2, FLASH_LATENCY_4},
+    [CPU_CLOCK_88MHZ]  = { 88,  44, PWR_REGULATOR_VOLTAGE_SCALE3, FLASH_LATENCY_3},
+};
+
+extern TIM_HandleTypeDef htim1;
+
+static cpu_clock_level_t current = CPU_CLOCK_280MHZ;
+static cpu_clock_level_t mode = CPU_CLOCK_AUTO;
+
+static uint32_t window_busy_us;
+static uint32_t window_period_us;
+static uint32_t window_frames;
+
+static void set_voltage(uint32_t vos)
+{
+    __HAL_PWR_VOLTAGESCALING_CONFIG(vos);
+    while (!__HAL_PWR_GET_FLAG(PWR_FLAG_VOSRDY)) {}
+}
+
+static void set_latency(uint32_t latency)
+{
+    __HAL_FLASH_SET_LATENCY(latency);
+    while (__HAL_FLASH_GET_LATENCY() != latency) {}
+}
+
+static void set_pll1(uint32_t n)
+{
+    // PLL1 can't be changed while it clocks the core, run from the HSI
+    __HAL_RCC_SYSCLK_CONFIG(RCC_SYSCLKSOURCE_HSI);
+    while (__HAL_RCC_GET_SYSCLK_SOURCE() != RCC_SYSCLKSOURCE_STATUS_HSI) {}
+
+    __HAL_RCC_PLL_DISABLE();
+    while (__HAL_RCC_GET_FLAG(RCC_FLAG_PLLRDY)) {}
+
+    // Range, VCO and the enabled outputs in PLLCFGR stay as they were
+    __HAL_RCC_PLL_CONFIG(RCC_PLLSOURCE_HSI, PLL1_M, n, PLL1_P, 2, 2);
+    __HAL_RCC_PLL_ENABLE();
+    while (!__HAL_RCC_GET_FLAG(RCC_FLAG_PLLRDY)) {}
+
+    __HAL_RCC_SYSCLK_CONFIG(RCC_SYSCLKSOURCE_PLLCLK);
+    while (__HAL_RCC_GET_SYSCLK_SOURCE() != RCC_SYSCLKSOURCE_STATUS_PLLCLK) {}
+}
+
+void cpu_clock_set_level(cpu_clock_level_t level)
+{
+    const level_t *from = &levels[current];
+    const level_t *to = &levels[level];
+    uint32_t primask;
+
+    if (level == current) {
+        return;
+    }
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+
+    // Start right after a tick, so the switch only costs its own time
+    SysTick->CTRL;
+    while (!(SysTick->CTRL & SysTick_CTRL_COUNTFLAG_Msk)) {}
+
+    // The voltage and wait states have to be there before the clock is
+    if (to->mhz > from->mhz) {
+        set_voltage(to->vos);
+        set_latency(to->latency);
+    }
+
+    set_pll1(to->pll1_n);
+
+    if (to->mhz < from->mhz) {
+        set_latency(to->latency);
+        set_voltage(to->vos);
+    }
+
+    SystemCoreClockUpdate();
+    SysTick->LOAD = SystemCoreClock / (1000U / HAL_GetTickFreq()) - 1;
+    SysTick->VAL = 0;
+    __HAL_TIM_SET_PRESCALER(&htim1, TIM1_PRESCALER_PER_MHZ * to->mhz);
+
+    current = level;
+
+    __set_PRIMASK(primask);
+}
+
+cpu_clock_level_t cpu_clock_get_level(void)
+{
+    return current;
+}
+
+uint32_t cpu_clock_get_mhz(void)
+{
+    return levels[current].mhz;
+}
+
+static void window_start(void)
+{
+    window_busy_us = 0;
+    window_period_us = 0;
+    window_frames = 0;
+}
+
+void cpu_clock_set_mode(cpu_clock_level_t new_mode)
+{
+    mode = new_mode;
+    cpu_clock_reset();
+}
+
+cpu_clock_level_t cpu_clock_get_mode(void)
+{
+    return mode;
+}
+
+void cpu_clock_reset(void)
+{
+    cpu_clock_set_level(mode == CPU_CLOCK_AUTO ? CPU_CLOCK_280MHZ : mode);
+    window_start();
+}
+
+static bool change(cpu_clock_level_t level)
+{
+    printf("CPU clock: %u MHz -> %u MHz\n", levels[current].mhz, levels[level].mhz);
+    cpu_clock_set_level(level);
+    window_start();
+    return true;
+}
+
+bool cpu_clock_governor(uint32_t busy_us, uint32_t period_us, bool late)
+{
+    if (mode != CPU_CLOCK_AUTO) {
+        return false;
+    }
+
+    // Up right away, a late frame is already a stutter
+    if (late || busy_us * 100 > period_us * GOVERNOR_UP_PCT) {
+        if (current > CPU_CLOCK_280MHZ) {
+            return change(current - 1);
+        }
+        window_start();
+        return false;
+    }
+
+    window_busy_us += busy_us;
+    window_period_us += period_us;
+    if (++window_frames < GOVERNOR_WINDOW) {
+        return false;
+    }
+
+    // The work takes the same number of cycles at the lower clock
+    if (current + 1 < CPU_CLOCK_LEVEL_COUNT) {
+        uint64_t slower_us = (uint64_t) window_busy_us * levels[current].mhz / levels[current + 1].mhz;
+
+        if (slower_us * 100 < (uint64_t) window_period_us * GOVERNOR_DOWN_PCT) {
+            return change(current + 1);
+        }
+    }
+
+    window_start();
+    return false;
+}
@@ -0,0 +1,131 @@
+#include <assert.h>
+#include <stdio.h>
+
+#include "gw_linker.h"
+#include "rg_arena.h"
+#include "emu_arena.h"
+
+static rg_arena_t arenas[EMU_ARENA_COUNT];
+static uintptr_t peaks[EMU_ARENA_COUNT];
+static void *ram_emu_end = &__RAM_EMU_END__;
+
+static const char *arena_names[EMU_ARENA_COUNT] = {
+    [EMU_ARENA_DTCM]    = "DTCM",
+    [EMU_ARENA_RAM_EMU] = "RAM_EMU",
+    [EMU_ARENA_AHBRAM]  = "AHBRAM",
+};
+
+void emu_arena_reserve_top(void *start)
+{
+    assert((uintptr_t) start <= (uintptr_t) &__RAM_EMU_END__);
+    ram_emu_end = start;
+}
+
+void emu_arena_init(void *ram_emu_free)
+{
+    assert((uintptr_t) ram_emu_free <= (uintptr_t) ram_emu_end);
+
+    rg_arena_create(&arenas[EMU_ARENA_DTCM], &__dtc_padding_start__, &__dtc_padding_end__);
+    rg_arena_create(&arenas[EMU_ARENA_RAM_EMU], ram_emu_free, ram_emu_end);
+    rg_arena_create(&arenas[EMU_ARENA_AHBRAM], &__ahbram_end__, &__AHBRAM_END__);
+
+    for (int i = 0; i < EMU_ARENA_COUNT; i++) {
+        peaks[i] = arenas[i].start;
+    }
+}
+
+static void update_peak(int region)
+{
+    if (arenas[region].next > peaks[region]) {
+        peaks[region] = arenas[region].next;
+    }
+}
+
+void *emu_arena_try_alloc(emu_arena_region_t region, size_t size, size_t align)
+{
+    for (int i = region; i < EMU_ARENA_COUNT; i++) {
+        void *block = rg_arena_alloc(&arenas[i], size, align);
+
+        if (block != NULL) {
+            update_peak(i);
+            return block;
+        }
+    }
+
+    return NULL;
+}
+
+void *emu_arena_alloc(emu_arena_region_t region, size_t size, size_t align)
+{
+    void *block = emu_arena_try_alloc(region, size, align);
+
+    if (block == NULL) {
+        printf("emu_arena: %u bytes don't fit\n", size);
+        emu_arena_print();
+        assert(!"emu_arena: out of memory");
+    }
+
+    return block;
+}
+
+void *emu_arena_alloc_rest(emu_arena_region_t region, size_t align, size_t *size)
+{
+    rg_arena_t *arena = &arenas[region];
+    uintptr_t addr = (arena->next + align - 1) & ~(align - 1);
+
+    *size = addr < arena->end ? arena->end - addr : 0;
+    return rg_arena_alloc(arena, *size, align);
+}
+
+bool emu_arena_contains(const void *ptr)
+{
+    for (int i = 0; i < EMU_ARENA_COUNT; i++) {
+        if (rg_arena_contains(&arenas[i], ptr)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+uint32_t emu_arena_mark(emu_arena_region_t region)
+{
+    return arenas[region].next;
+}
+
+void emu_arena_release(emu_arena_region_t region, uint32_t mark)
+{
+    rg_arena_t *arena = &arenas[region];
+
+    assert(mark >= arena->start && mark <= arena->next);
+    arena->next = mark;
+    update_peak(region);
+}
+
+size_t emu_arena_free(emu_arena_region_t region)
+{
+    const rg_arena_t *arena = &arenas[region];
+
+    return arena->end - arena->next;
+}
+
+void emu_arena_usage(emu_arena_region_t region, size_t *used, size_t *peak, size_t *size)
+{
+    const rg_arena_t *arena = &arenas[region];
+
+    *used = rg_arena_used(arena);
+    *peak = (peaks[region] > arena->next ? peaks[region] : arena->next) - arena->start;
+    *size = rg_arena_size(arena);
+}
+
+void emu_arena_print(void)
+{
+    for (int i = 0; i < EMU_ARENA_COUNT; i++) {
+        const rg_arena_t *arena = &arenas[i];
+        size_t used, peak, size;
+
+        emu_arena_usage(i, &used, &peak, &size);
+        printf("%-8s %08x %6u / %6u bytes used, %6u at most\n", arena_names[i], arena->start,
+               used, size, peak);
+    }
+}
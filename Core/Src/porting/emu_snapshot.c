@@ -0,0 +1,120 @@
+#include <string.h>
+
+#include "emu_snapshot.h"
+
+static const emu_snapshot_core_t *core;
+static size_t blocks_size;
+
+static uint32_t dirty[EMU_SNAPSHOT_MAX_PAGES / 32];
+
+void emu_snapshot_init(const emu_snapshot_core_t *new_core)
+{
+    core = new_core;
+    blocks_size = 0;
+
+    if (core->blocks) {
+        for (const emu_snapshot_block_t *block = core->blocks; block->len > 0; block++) {
+            blocks_size += block->len;
+        }
+    }
+}
+
+size_t emu_snapshot_size(void)
+{
+    return core->blocks ? blocks_size : core->size;
+}
+
+static size_t serialize(uint8_t *buffer, size_t size)
+{
+    size_t used = core->save(buffer, size);
+
+    return used <= size ? used : 0;
+}
+
+size_t emu_snapshot_save(uint8_t *buffer, size_t size)
+{
+    uint8_t *dst = buffer;
+
+    if (!core->blocks) {
+        return serialize(buffer, size);
+    }
+    if (blocks_size > size) {
+        return 0;
+    }
+
+    for (const emu_snapshot_block_t *block = core->blocks; block->len > 0; block++) {
+        memcpy(dst, block->ptr, block->len);
+        dst += block->len;
+    }
+
+    return blocks_size;
+}
+
+size_t emu_snapshot_update(uint8_t *buffer, size_t size)
+{
+    uint32_t pos = 0;
+
+    memset(dirty, 0, sizeof(dirty));
+
+    if (!core->blocks) {
+        size_t used = serialize(buffer, size);
+
+        memset(dirty, 0xff, sizeof(dirty));
+        return used;
+    }
+    if (blocks_size > size) {
+        return 0;
+    }
+
+    // In pieces that don't cross a page of the snapshot
+    for (const emu_snapshot_block_t *block = core->blocks; block->len > 0; block++) {
+        const uint8_t *src = block->ptr;
+        uint32_t left = block->len;
+
+        while (left > 0) {
+            uint32_t len = EMU_SNAPSHOT_PAGE_SIZE - pos % EMU_SNAPSHOT_PAGE_SIZE;
+            uint32_t page = pos / EMU_SNAPSHOT_PAGE_SIZE;
+
+            if (len > left) {
+                len = left;
+            }
+            if (memcmp(&buffer[pos], src, len) != 0) {
+                memcpy(&buffer[pos], src, len);
+                if (page < EMU_SNAPSHOT_MAX_PAGES) {
+                    dirty[page / 32] |= 1 << (page % 32);
+                }
+            }
+            src += len;
+            pos += len;
+            left -= len;
+        }
+    }
+
+    return blocks_size;
+}
+
+void emu_snapshot_load(const uint8_t *buffer, size_t size)
+{
+    if (!core->blocks) {
+        core->load(buffer, size);
+        return;
+    }
+
+    for (const emu_snapshot_block_t *block = core->blocks; block->len > 0; block++) {
+        if (core->restoring) {
+            core->restoring(block, buffer);
+        }
+        memcpy(block->ptr, buffer, block->len);
+        buffer += block->len;
+    }
+
+    if (core->restored) {
+        core->restored();
+    }
+}
+
+bool emu_snapshot_page_dirty(uint32_t page)
+{
+    // Pages past the bitmap are always taken as dirty
+    return page >= EMU_SNAPSHOT_MAX_PAGES || (dirty[page / 32] & (1 << (page % 32)));
+}
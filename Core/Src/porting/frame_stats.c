@@ -0,0 +1,99 @@
+#include <odroid_system.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "gw_timer.h"
+#include "frame_stats.h"
+
+// Read by tools/logpoll.py --frame-stats
+frame_stats_t frame_stats;
+
+static uint32_t last_us;
+static bool started;
+static uint8_t pending_tags;
+
+static bool is_late(uint32_t us)
+{
+    return us > frame_stats.period_us + frame_stats.period_us / 4;
+}
+
+void frame_stats_frame(uint32_t period_us)
+{
+    uint32_t now = gw_timer_us();
+    uint32_t us = now - last_us;
+    uint8_t tags = pending_tags;
+
+    last_us = now;
+    pending_tags = 0;
+
+    if (!started) {
+        started = true;
+        return;
+    }
+
+    if (tags & FRAME_TAG_MENU) {
+        frame_stats.menu_frames++;
+        return;
+    }
+
+    frame_stats.period_us = period_us;
+    frame_stats.times[frame_stats.count % FRAME_STATS_WINDOW] = MIN(us / FRAME_STATS_UNIT_US, UINT16_MAX);
+    frame_stats.tags[frame_stats.count % FRAME_STATS_WINDOW] = tags;
+    frame_stats.count++;
+
+    if (is_late(us)) {
+        frame_stats.late++;
+    }
+    if (us > frame_stats.longest_us) {
+        frame_stats.longest_us = us;
+        frame_stats.longest_tags = tags;
+    }
+}
+
+void frame_stats_tag(frame_tag_t tag)
+{
+    pending_tags |= tag;
+}
+
+static int compare_times(const void *a, const void *b)
+{
+    return *(const uint16_t *) a - *(const uint16_t *) b;
+}
+
+frame_stats_summary_t frame_stats_summary(void)
+{
+    uint16_t sorted[FRAME_STATS_WINDOW];
+    uint32_t n = MIN(frame_stats.count, FRAME_STATS_WINDOW);
+    frame_stats_summary_t summary = {0};
+
+    if (n == 0) {
+        return summary;
+    }
+
+    memcpy(sorted, frame_stats.times, n * sizeof(sorted[0]));
+    qsort(sorted, n, sizeof(sorted[0]), compare_times);
+
+    summary.p50_us = sorted[n * 50 / 100] * FRAME_STATS_UNIT_US;
+    summary.p95_us = sorted[n * 95 / 100] * FRAME_STATS_UNIT_US;
+    summary.p99_us = sorted[n * 99 / 100] * FRAME_STATS_UNIT_US;
+    for (int i = 0; i < n; i++) {
+        if (is_late(sorted[i] * FRAME_STATS_UNIT_US)) {
+            summary.late++;
+        }
+    }
+
+    return summary;
+}
+
+const char *frame_stats_tag_name(uint8_t tags)
+{
+    if (tags & FRAME_TAG_MENU)
+        return "menu";
+    if (tags & FRAME_TAG_FLASH)
+        return "flash";
+    if (tags & FRAME_TAG_OVERLAY)
+        return "overlay";
+    if (tags & FRAME_TAG_SKIPPED)
+        return "skipped";
+    return "emulation";
+}
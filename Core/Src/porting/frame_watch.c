@@ -0,0 +1,75 @@
+#include "main.h"
+#include "frame_watch.h"
+#include "gw_timer.h"
+#include "log_ring.h"
+#include "profiler.h"
+
+#if FRAME_WATCH
+
+// TIM1 counts at 20 kHz whatever the clock, see cpu_clock.c
+#define TICK_US 50
+
+// Read over SWD
+uint32_t frame_watch_caught;
+
+static uint32_t start_us;
+static bool caught;
+
+void frame_watch_arm(uint32_t period_us)
+{
+    uint32_t now = gw_timer_us();
+    uint32_t ticks = period_us * FRAME_WATCH_FACTOR / TICK_US;
+    uint32_t next;
+
+    if (caught) {
+        LOG_DEFER("Frame watch: the frame took %lu us", now - start_us);
+        caught = false;
+    }
+
+    TIM1->DIER &= ~TIM_DIER_CC2IE;
+    if (ticks == 0 || ticks > TIM1->ARR) {
+        return;
+    }
+
+    next = TIM1->CNT + ticks;
+    TIM1->CCR2 = next > TIM1->ARR ? next - TIM1->ARR - 1 : next;
+    TIM1->SR = ~TIM_SR_CC2IF;
+    start_us = now;
+    TIM1->DIER |= TIM_DIER_CC2IE;
+}
+
+void frame_watch_disarm(void)
+{
+    TIM1->DIER &= ~TIM_DIER_CC2IE;
+    caught = false;
+}
+
+bool frame_watch_irq(const uint32_t *frame)
+{
+    if (!(TIM1->DIER & TIM_DIER_CC2IE) || !(TIM1->SR & TIM_SR_CC2IF)) {
+        return false;
+    }
+
+    // Once per frame
+    TIM1->DIER &= ~TIM_DIER_CC2IE;
+    TIM1->SR = ~TIM_SR_CC2IF;
+
+    frame_watch_caught++;
+    caught = true;
+    LOG_DEFER("Frame watch: %lu us into the frame at pc %08lx lr %08lx, in %s",
+              gw_timer_us() - start_us, frame[6], frame[5], (uint32_t) profiler_scope_name());
+
+    return true;
+}
+
+void frame_watch_init(void)
+{
+    // CCMR1 is left at frozen, the compare only raises the interrupt
+    TIM1->DIER &= ~TIM_DIER_CC2IE;
+    TIM1->SR = ~TIM_SR_CC2IF;
+
+    HAL_NVIC_SetPriority(TIM1_CC_IRQn, 0, 0);
+    HAL_NVIC_EnableIRQ(TIM1_CC_IRQn);
+}
+
+#endif
@@ -0,0 +1,125 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "odroid_system.h"
+#include "common.h"
+#include "cpu_clock.h"
+#include "game_profile.h"
+#include "utils.h"
+
+// Frames of a learning window, and how many of them may be skipped
+#define LEARN_WINDOW 600
+#define LEARN_SKIPPED_MAX (LEARN_WINDOW / 10)
+
+/*
+ * Games that need something else than the defaults of their system, by the
+ * CRC32 of the uncompressed ROM (see the .checksum of the ROM entries that
+ * parse_roms.py generates). E.g.
+ *   {0x12345678, CPU_CLOCK_280MHZ, 4, GAME_PROFILE_KEEP, ODROID_DISPLAY_FILTER_OFF},
+ *
+ * Empty on purpose: the CRC is the one of the file as dumped, which differs
+ * between dumps and headers of the same game, so an entry is only added
+ * for a game measured on the device. Until then the learned profiles
+ * cover the games that keep skipping frames.
+ */
+static const game_profile_t profiles[] = {
+};
+
+static uint32_t game_crc;
+static game_profile_t current;
+static uint32_t window_frames;
+static uint32_t window_skipped;
+
+static const game_profile_t *find(uint32_t crc)
+{
+    const game_profile_t *learned;
+    uint32_t count = odroid_settings_GameProfiles_get(&learned);
+
+    for (uint32_t i = 0; i < count; i++) {
+        if (learned[i].crc == crc) {
+            return &learned[i];
+        }
+    }
+
+    for (uint32_t i = 0; i < ARRAY_SIZE(profiles); i++) {
+        if (profiles[i].crc == crc) {
+            return &profiles[i];
+        }
+    }
+
+    return NULL;
+}
+
+void game_profile_apply(uint32_t crc)
+{
+    const game_profile_t *profile = (crc != 0) ? find(crc) : NULL;
+
+    game_crc = crc;
+    window_frames = 0;
+    window_skipped = 0;
+
+    if (profile == NULL) {
+        current = (game_profile_t) {crc, GAME_PROFILE_KEEP, GAME_PROFILE_KEEP, GAME_PROFILE_KEEP, GAME_PROFILE_KEEP};
+        return;
+    }
+
+    current = *profile;
+    printf("Game profile %08lX: clock %u, frame skip %u, scaling %u, filter %u\n",
+           crc, current.cpu_clock, current.frame_skip, current.scaling, current.filter);
+
+    if (current.cpu_clock != GAME_PROFILE_KEEP) {
+        cpu_clock_set_mode(current.cpu_clock);
+    }
+    if (current.frame_skip != GAME_PROFILE_KEEP) {
+        common_emu_set_frame_skip_max(current.frame_skip);
+    }
+    if (current.scaling != GAME_PROFILE_KEEP) {
+        odroid_display_override_scaling_mode(current.scaling);
+    }
+    if (current.filter != GAME_PROFILE_KEEP) {
+        odroid_display_override_filter_mode(current.filter);
+    }
+}
+
+// In front of the others, the oldest one is dropped if they're all taken
+static void learn(void)
+{
+    const game_profile_t *stored;
+    uint32_t count = odroid_settings_GameProfiles_get(&stored);
+    game_profile_t learned[GAME_PROFILE_LEARNED_MAX];
+    uint32_t n = 0;
+
+    learned[n++] = current;
+    for (uint32_t i = 0; i < count && n < GAME_PROFILE_LEARNED_MAX; i++) {
+        if (stored[i].crc != game_crc) {
+            learned[n++] = stored[i];
+        }
+    }
+
+    odroid_settings_GameProfiles_set(learned, n);
+}
+
+void game_profile_frame(bool skipped)
+{
+    if (game_crc == 0) {
+        return;
+    }
+
+    window_skipped += skipped;
+    if (++window_frames < LEARN_WINDOW) {
+        return;
+    }
+
+    // Only once there's no faster clock to go to
+    if (window_skipped > LEARN_SKIPPED_MAX && cpu_clock_get_level() == CPU_CLOCK_280MHZ &&
+        odroid_display_get_filter_mode() != ODROID_DISPLAY_FILTER_OFF) {
+        printf("Game profile %08lX: %lu of %u frames skipped, filter off\n",
+               game_crc, window_skipped, LEARN_WINDOW);
+        current.filter = ODROID_DISPLAY_FILTER_OFF;
+        odroid_display_override_filter_mode(ODROID_DISPLAY_FILTER_OFF);
+        learn();
+    }
+
+    window_frames = 0;
+    window_skipped = 0;
+}
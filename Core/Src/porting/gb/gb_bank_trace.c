@@ -0,0 +1,65 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "gb_bank_trace.h"
+
+#if GB_BANK_TRACE
+
+typedef struct {
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t miss_us;
+} bank_heat_t;
+
+// Lives in the GB overlay, so it takes a bit away from the swap cache
+static bank_heat_t heat[GB_BANK_TRACE_MAX_BANKS];
+
+void gb_bank_trace_hit(uint32_t bank)
+{
+    if (bank < GB_BANK_TRACE_MAX_BANKS) {
+        heat[bank].hits++;
+    }
+}
+
+void gb_bank_trace_miss(uint32_t bank, uint32_t decompress_us)
+{
+    if (bank < GB_BANK_TRACE_MAX_BANKS) {
+        heat[bank].misses++;
+        heat[bank].miss_us += decompress_us;
+    }
+}
+
+void gb_bank_trace_reset(void)
+{
+    memset(heat, 0, sizeof(heat));
+}
+
+gb_bank_trace_stats_t gb_bank_trace_get_stats(void)
+{
+    gb_bank_trace_stats_t stats = {0};
+
+    for (int i = 0; i < GB_BANK_TRACE_MAX_BANKS; i++) {
+        stats.hits += heat[i].hits;
+        stats.misses += heat[i].misses;
+        stats.miss_us += heat[i].miss_us;
+    }
+
+    return stats;
+}
+
+void gb_bank_trace_dump(void)
+{
+    // logbuf is only 4kB, so banks that were never switched in are left out
+    printf("# bank accesses misses decompress_us\n");
+    for (int i = 0; i < GB_BANK_TRACE_MAX_BANKS; i++) {
+        uint32_t accesses = heat[i].hits + heat[i].misses;
+
+        if (accesses > 0) {
+            printf("%d %" PRIu32 " %" PRIu32 " %" PRIu32 "\n",
+                   i, accesses, heat[i].misses, heat[i].miss_us);
+        }
+    }
+}
+
+#endif
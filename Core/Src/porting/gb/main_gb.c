@@ -3,8 +3,14 @@
 #include <assert.h>
 
 #include "main.h"
-#include "bilinear.h"
 #include "gw_lcd.h"
+#include "gw_blit.h"
+#include "gw_bilinear.h"
+#include "gw_dirty.h"
+#include "gb_bank_trace.h"
+#include "profiler.h"
+#include "log_ring.h"
+#include "rgb565.h"
 #include "gw_linker.h"
 #include "gw_buttons.h"
 #include "gnuboy/loader.h"
@@ -18,18 +24,30 @@
 #include "gnuboy/defs.h"
 #include "common.h"
 #include "rom_manager.h"
+#include "save_pack.h"
+#include "state_slots.h"
 #include "appid.h"
+#include "boot_trace.h"
+#include "run_ahead.h"
+#include "emu_snapshot.h"
 
 #define NVS_KEY_SAVE_SRAM "sram"
 
+// The APU has nothing above 16kHz worth keeping, 32kHz is exact on the SAI
+#define AUDIO_SAMPLE_RATE_GB   (32000)
+
 // Use 60Hz for GB
-#define AUDIO_BUFFER_LENGTH_GB (AUDIO_SAMPLE_RATE / 60)
-#define AUDIO_BUFFER_LENGTH_DMA_GB ((2 * AUDIO_SAMPLE_RATE) / 60)
+#define AUDIO_BUFFER_LENGTH_GB (AUDIO_SAMPLE_RATE_GB / 60)
 
 static odroid_video_frame_t update1 = {GB_WIDTH, GB_HEIGHT, GB_WIDTH * 2, 2, 0xFF, -1, NULL, NULL, 0, {}};
 static odroid_video_frame_t update2 = {GB_WIDTH, GB_HEIGHT, GB_WIDTH * 2, 2, 0xFF, -1, NULL, NULL, 0, {}};
 static odroid_video_frame_t *currentUpdate = &update1;
 
+// Back buffer for pipelining the DMA2D blit with the emulation of the next
+// frame. RAM_CORE (.emulator_data) has no room for a second frame without
+// shrinking the ROM buffers of every overlay, so it lives in the GB overlay.
+static uint16_t gb_framebuffer2[GB_WIDTH * GB_HEIGHT] __attribute__((aligned(32)));
+
 static bool saveSRAM = false;
 static int  saveSRAM_Timer = 0;
 
@@ -45,6 +63,32 @@ static void netplay_callback(netplay_event_t event, void *arg)
 
 
 
+// Source column and line of each output pixel, for the size they were
+// built for. Only rebuilt when the scaling mode changes.
+static uint8_t nn_x[WIDTH];
+static uint8_t nn_y[240];
+static int nn_width;
+static int nn_height;
+
+static void nn_setup(int w1, int h1, int w2, int h2)
+{
+    if (w2 == nn_width && h2 == nn_height) {
+        return;
+    }
+
+    int x_ratio = (int)((w1<<16)/w2) +1;
+    int y_ratio = (int)((h1<<16)/h2) +1;
+
+    for (int j = 0; j < w2; j++) {
+        nn_x[j] = (j * x_ratio) >> 16;
+    }
+    for (int i = 0; i < h2; i++) {
+        nn_y[i] = (i * y_ratio) >> 16;
+    }
+    nn_width = w2;
+    nn_height = h2;
+}
+
 __attribute__((optimize("unroll-loops")))
 static inline void screen_blit_nn(int32_t dest_width, int32_t dest_height)
 {
@@ -57,7 +101,7 @@ static inline void screen_blit_nn(int32_t dest_width, int32_t dest_height)
 
     if (delta >= 1000) {
         int fps = (10000 * frames) / delta;
-        printf("FPS: %d.%d, frames %ld, delta %ld ms, skipped %d\n", fps / 10, fps % 10, delta, frames, common_emu_state.skipped_frames);
+        LOG_DEFER("FPS: %d.%d, frames %ld, delta %ld ms, skipped %d\n", fps / 10, fps % 10, frames, delta, common_emu_state.skipped_frames);
         frames = 0;
         common_emu_state.skipped_frames = 0;
         lastFPSTime = currentTime;
@@ -68,36 +112,61 @@ static inline void screen_blit_nn(int32_t dest_width, int32_t dest_height)
     int w2 = dest_width;
     int h2 = dest_height;
 
-    int x_ratio = (int)((w1<<16)/w2) +1;
-    int y_ratio = (int)((h1<<16)/h2) +1;
     int hpad = (320 - dest_width) / 2;
     int wpad = (240 - dest_height) / 2;
 
-    int x2;
-    int y2;
-
     uint16_t* screen_buf = (uint16_t*)currentUpdate->buffer;
     uint16_t *dest = lcd_get_active_buffer();
 
-    PROFILING_INIT(t_blit);
-    PROFILING_START(t_blit);
+    profiler_begin(PROFILER_BLIT);
+
+    gw_blit_fill_border_rgb565(dest, WIDTH, WIDTH, 240, hpad, wpad, w2, h2, 0);
+
+    bool pipelined = (w1 == w2 && h1 == h2);
+
+    if (pipelined) {
+        // Original resolution, let the DMA2D copy it
+        gw_blit_copy_rgb565(screen_buf, w1, &dest[(wpad * WIDTH) + hpad], WIDTH, w2, h2);
+    } else {
+        nn_setup(w1, h1, w2, h2);
+
+        for (int i = 0; i < h2; ) {
+            int y2 = nn_y[i];
+            int rows = 1;
 
-    for (int i=0;i<h2;i++) {
-        for (int j=0;j<w2;j++) {
-            x2 = ((j*x_ratio)>>16) ;
-            y2 = ((i*y_ratio)>>16) ;
-            uint16_t b2 = screen_buf[(y2*w1)+x2];
-            dest[((i+wpad)*WIDTH)+j+hpad] = b2;
+            // Rows from the same source line are copies of the first one
+            while (i + rows < h2 && nn_y[i + rows] == y2) {
+                rows++;
+            }
+            if (!gw_dirty_line(y2)) {
+                i += rows;
+                continue;
+            }
+
+            const uint16_t *src_row = &screen_buf[y2 * w1];
+            uint16_t *dest_row = &dest[((i + wpad) * WIDTH) + hpad];
+            for (int j = 0; j < w2; j++) {
+                dest_row[j] = src_row[nn_x[j]];
+            }
+            for (int r = 1; r < rows; r++) {
+                memcpy(&dest_row[r * WIDTH], dest_row, w2 * sizeof(dest_row[0]));
+            }
+            i += rows;
         }
+        gw_blit_wait();
     }
 
-    PROFILING_END(t_blit);
-
-#ifdef PROFILING_ENABLED
-    printf("Blit: %d us\n", (1000000 * PROFILING_DIFF(t_blit)) / t_blit_t0.SecondFraction);
-#endif
+    profiler_end(PROFILER_BLIT);
 
-    lcd_swap();
+    if (pipelined) {
+        // Swap once the DMA2D is done and emulate the next frame into the
+        // other buffer in the meantime.
+        gw_blit_swap_when_done();
+        currentUpdate = (currentUpdate == &update1) ? &update2 : &update1;
+        fb.ptr = currentUpdate->buffer;
+    } else {
+        lcd_swap();
+    }
 }
 
 static void screen_blit_bilinear(int32_t dest_width)
@@ -111,7 +180,7 @@ static void screen_blit_bilinear(int32_t dest_width)
 
     if (delta >= 1000) {
         int fps = (10000 * frames) / delta;
-        printf("FPS: %d.%d, frames %ld, delta %ld ms, skipped %d\n", fps / 10, fps % 10, delta, frames, common_emu_state.skipped_frames);
+        LOG_DEFER("FPS: %d.%d, frames %ld, delta %ld ms, skipped %d\n", fps / 10, fps % 10, frames, delta, common_emu_state.skipped_frames);
         frames = 0;
         common_emu_state.skipped_frames = 0;
         lastFPSTime = currentTime;
@@ -127,38 +196,16 @@ static void screen_blit_bilinear(int32_t dest_width)
 
     uint16_t *dest = lcd_get_active_buffer();
 
-    image_t dst_img;
-    dst_img.w = dest_width;
-    dst_img.h = 240;
-    dst_img.bpp = 2;
-    dst_img.pixels = ((uint8_t *) dest) + hpad * 2;
-
-    if (hpad > 0) {
-        memset(dest, 0x00, hpad * 2);
-    }
-
-    image_t src_img;
-    src_img.w = currentUpdate->width;
-    src_img.h = currentUpdate->height;
-    src_img.bpp = 2;
-    src_img.pixels = currentUpdate->buffer;
+    gw_blit_fill_border_rgb565(dest, stride, stride, h2, hpad, 0, w2, h2, 0);
 
-    float x_scale = ((float) w2) / ((float) w1);
-    float y_scale = ((float) h2) / ((float) h1);
+    gw_bilinear_setup(w1, h1, w2, h2);
 
+    profiler_begin(PROFILER_BLIT);
 
+    gw_bilinear_rgb565(currentUpdate->buffer, w1, &dest[hpad], stride);
+    gw_blit_wait();
 
-    PROFILING_INIT(t_blit);
-    PROFILING_START(t_blit);
-
-    imlib_draw_image(&dst_img, &src_img, 0, 0, stride, x_scale, y_scale, NULL, -1, 255, NULL,
-                     NULL, IMAGE_HINT_BILINEAR, NULL, NULL);
-
-    PROFILING_END(t_blit);
-
-#ifdef PROFILING_ENABLED
-    printf("Blit: %d us\n", (1000000 * PROFILING_DIFF(t_blit)) / t_blit_t0.SecondFraction);
-#endif
+    profiler_end(PROFILER_BLIT);
 
     lcd_swap();
 }
@@ -175,7 +222,7 @@ static inline void screen_blit_v3to5(void) {
 
     if (delta >= 1000) {
         int fps = (10000 * frames) / delta;
-        printf("FPS: %d.%d, frames %ld, delta %ld ms, skipped %d\n", fps / 10, fps % 10, delta, frames, common_emu_state.skipped_frames);
+        LOG_DEFER("FPS: %d.%d, frames %ld, delta %ld ms, skipped %d\n", fps / 10, fps % 10, frames, delta, common_emu_state.skipped_frames);
         frames = 0;
         common_emu_state.skipped_frames = 0;
         lastFPSTime = currentTime;
@@ -183,44 +230,33 @@ static inline void screen_blit_v3to5(void) {
 
     uint16_t *dest = lcd_get_active_buffer();
 
-    PROFILING_INIT(t_blit);
-    PROFILING_START(t_blit);
-
-#define CONV(_b0)    (((0b11111000000000000000000000&_b0)>>10) | ((0b000001111110000000000&_b0)>>5) | ((0b0000000000011111&_b0)))
-#define EXPAND(_b0)  (((0b1111100000000000 & _b0) << 10) | ((0b0000011111100000 & _b0) << 5) | ((0b0000000000011111 & _b0)))
+    profiler_begin(PROFILER_BLIT);
 
     int y_src = 0;
     int y_dst = 0;
     int w = currentUpdate->width;
     int h = currentUpdate->height;
     for (; y_src < h; y_src += 3, y_dst += 5) {
-        int x_src = 0;
-        int x_dst = 0;
-        for (; x_src < w; x_src += 1, x_dst += 2) {
-            uint16_t *src_col = &((uint16_t *)currentUpdate->buffer)[(y_src * w) + x_src];
-            uint32_t b0 = EXPAND(src_col[w * 0]);
-            uint32_t b1 = EXPAND(src_col[w * 1]);
-            uint32_t b2 = EXPAND(src_col[w * 2]);
-
-            dest[((y_dst + 0) * WIDTH) + x_dst] = CONV(b0);
-            dest[((y_dst + 1) * WIDTH) + x_dst] = CONV((b0+b1)>>1);
-            dest[((y_dst + 2) * WIDTH) + x_dst] = CONV(b1);
-            dest[((y_dst + 3) * WIDTH) + x_dst] = CONV((b1+b2)>>1);
-            dest[((y_dst + 4) * WIDTH) + x_dst] = CONV(b2);
-
-            dest[((y_dst + 0) * WIDTH) + x_dst + 1] = CONV(b0);
-            dest[((y_dst + 1) * WIDTH) + x_dst + 1] = CONV((b0+b1)>>1);
-            dest[((y_dst + 2) * WIDTH) + x_dst + 1] = CONV(b1);
-            dest[((y_dst + 3) * WIDTH) + x_dst + 1] = CONV((b1+b2)>>1);
-            dest[((y_dst + 4) * WIDTH) + x_dst + 1] = CONV(b2);
+        // Each group of 5 output lines is interpolated from 3 source lines
+        if (!gw_dirty_lines(y_src, 3)) {
+            continue;
         }
-    }
+        // Two pixels at a time, each of them written twice
+        const uint32_t *src = (const uint32_t *) &((uint16_t *)currentUpdate->buffer)[y_src * w];
+        uint32_t *dst = (uint32_t *) &dest[y_dst * WIDTH];
+        for (int x = 0; x < w / 2; x++) {
+            uint32_t lines[5];
 
-    PROFILING_END(t_blit);
+            rgb565_3to5(lines, src[x], src[x + w / 2], src[x + w]);
 
-#ifdef PROFILING_ENABLED
-    printf("Blit: %d us\n", (1000000 * PROFILING_DIFF(t_blit)) / t_blit_t0.SecondFraction);
-#endif
+            for (int i = 0; i < 5; i++) {
+                dst[(i * WIDTH / 2) + (2 * x) + 0] = rgb565_dup(rgb565_lo(lines[i]));
+                dst[(i * WIDTH / 2) + (2 * x) + 1] = rgb565_dup(rgb565_hi(lines[i]));
+            }
+        }
+    }
+
+    profiler_end(PROFILER_BLIT);
     common_ingame_overlay();
 
     lcd_swap();
@@ -239,7 +275,7 @@ static inline void screen_blit_jth(void) {
 
     if (delta >= 1000) {
         int fps = (10000 * frames) / delta;
-        printf("FPS: %d.%d, frames %ld, delta %ld ms, skipped %d\n", fps / 10, fps % 10, delta, frames, common_emu_state.skipped_frames);
+        LOG_DEFER("FPS: %d.%d, frames %ld, delta %ld ms, skipped %d\n", fps / 10, fps % 10, frames, delta, common_emu_state.skipped_frames);
         frames = 0;
         common_emu_state.skipped_frames = 0;
         lastFPSTime = currentTime;
@@ -249,8 +285,7 @@ static inline void screen_blit_jth(void) {
     uint16_t* screen_buf = (uint16_t*)currentUpdate->buffer;
     uint16_t *dest = lcd_get_active_buffer();
 
-    PROFILING_INIT(t_blit);
-    PROFILING_START(t_blit);
+    profiler_begin(PROFILER_BLIT);
 
 
     int w1 = currentUpdate->width;
@@ -262,6 +297,9 @@ static inline void screen_blit_jth(void) {
 
     // Iterate on dest buf rows
     for(int y = 0; y < border; ++y) {
+        if (!gw_dirty_line(y)) {
+            continue;
+        }
         uint16_t *src_row  = &screen_buf[y * w1];
         uint16_t *dest_row = &dest[y * w2];
         for (int x = 0, xsrc=0; x < w2; x+=2,xsrc++) {
@@ -271,6 +309,9 @@ static inline void screen_blit_jth(void) {
     }
 
     for (int y = border, src_y = border; y < h2-border; y+=2, src_y++) {
+        if (!gw_dirty_line(src_y)) {
+            continue;
+        }
         uint16_t *src_row  = &screen_buf[src_y * w1];
         uint32_t *dest_row0 = (uint32_t *) &dest[y * w2];
         for (int x = 0, xsrc=0; x < w2; x++,xsrc++) {
@@ -280,6 +321,9 @@ static inline void screen_blit_jth(void) {
     }
 
     for (int y = border, src_y = border; y < h2-border; y+=2, src_y++) {
+        if (!gw_dirty_line(src_y)) {
+            continue;
+        }
         uint16_t *src_row  = &screen_buf[src_y * w1];
         uint32_t *dest_row1 = (uint32_t *)&dest[(y + 1) * w2];
         for (int x = 0, xsrc=0; x < w2; x++,xsrc++) {
@@ -289,6 +333,9 @@ static inline void screen_blit_jth(void) {
     }
 
     for(int y = 0; y < border; ++y) {
+        if (!gw_dirty_line(h1-border+y)) {
+            continue;
+        }
         uint16_t *src_row  = &screen_buf[(h1-border+y) * w1];
         uint16_t *dest_row = &dest[(h2-border+y) * w2];
         for (int x = 0, xsrc=0; x < w2; x+=2,xsrc++) {
@@ -298,11 +345,7 @@ static inline void screen_blit_jth(void) {
     }
 
 
-    PROFILING_END(t_blit);
-
-#ifdef PROFILING_ENABLED
-    printf("Blit: %d us\n", (1000000 * PROFILING_DIFF(t_blit)) / t_blit_t0.SecondFraction);
-#endif
+    profiler_end(PROFILER_BLIT);
 
     lcd_swap();
 }
@@ -313,6 +356,18 @@ static void blit(void)
     odroid_display_scaling_t scaling = odroid_display_get_scaling_mode();
     odroid_display_filter_t filtering = odroid_display_get_filter_mode();
 
+    // Fence for a pipelined blit of the previous frame
+    gw_blit_wait();
+    lcd_beam_begin();
+
+    if (scaling == ODROID_DISPLAY_SCALING_OFF) {
+        // The DMA2D copies the whole frame, that's cheaper than hashing it
+        gw_dirty_invalidate();
+    } else {
+        gw_dirty_begin(currentUpdate->buffer, GB_WIDTH * 2, GB_WIDTH * 2, GB_HEIGHT,
+                       (scaling << 8) | filtering);
+    }
+
     switch (scaling) {
     case ODROID_DISPLAY_SCALING_OFF:
         // Original Resolution
@@ -378,7 +433,7 @@ static bool SaveState(char *pathName)
     // as a temporary save buffer.
     memset(GB_ROM_SRAM_CACHE,  '\x00', STATE_SAVE_BUFFER_LENGTH);
     size_t size = gb_state_save(GB_ROM_SRAM_CACHE, STATE_SAVE_BUFFER_LENGTH);
-    store_save(ACTIVE_FILE->save_address, GB_ROM_SRAM_CACHE, size);
+    save_pack_store(state_slot_current(), ACTIVE_FILE->save_size, GB_ROM_SRAM_CACHE, size);
 
     // Restore the cache that was overwritten above.
     gb_loader_restore_cache();
@@ -388,7 +443,19 @@ static bool SaveState(char *pathName)
 
 static bool LoadState(char *pathName)
 {
-    gb_state_load(ACTIVE_FILE->save_address, ACTIVE_FILE->save_size);
+    size_t size;
+    const uint8_t *state = save_pack_load(state_slot_current(), ACTIVE_FILE->save_size,
+                                          GB_ROM_SRAM_CACHE, STATE_SAVE_BUFFER_LENGTH, &size);
+
+    if (state != NULL) {
+        gb_state_load(state, size);
+    }
+
+    // The state may have been unpacked into the cache
+    if (state != state_slot_current()) {
+        gb_loader_restore_cache();
+    }
+
     return true;
 }
 
@@ -411,6 +478,7 @@ static bool palette_update_cb(odroid_dialog_choice_t *option, odroid_dialog_even
         pal_set_dmg(pal);
         lcd_reset_active_buffer();
         emu_run(true);
+        gw_blit_wait();
         lcd_swap();
         lcd_sync();
     }
@@ -421,6 +489,44 @@ static bool palette_update_cb(odroid_dialog_choice_t *option, odroid_dialog_even
     return event == ODROID_DIALOG_ENTER;
 }
 
+#if GB_BANK_TRACE
+static char bank_miss_rate_value[12];
+static char bank_misses_value[12];
+static char bank_unpack_value[12];
+static char bank_dump_value[8];
+
+static bool bank_stats_update_cb(odroid_dialog_choice_t *option, odroid_dialog_event_t event, uint32_t repeat)
+{
+    gb_bank_trace_stats_t stats = gb_bank_trace_get_stats();
+    uint32_t accesses = stats.hits + stats.misses;
+    uint32_t rate = accesses ? (uint64_t) stats.misses * 1000 / accesses : 0;
+
+    sprintf(bank_miss_rate_value, "%lu.%lu%%", rate / 10, rate % 10);
+    sprintf(bank_misses_value, "%lu", stats.misses);
+    sprintf(bank_unpack_value, "%lu us", stats.misses ? stats.miss_us / stats.misses : 0);
+
+    return false;
+}
+
+static bool bank_dump_update_cb(odroid_dialog_choice_t *option, odroid_dialog_event_t event, uint32_t repeat)
+{
+    if (event == ODROID_DIALOG_ENTER) {
+        gb_bank_trace_dump();
+        strcpy(option->value, "Done");
+    }
+
+    return false;
+}
+
+static odroid_dialog_choice_t bank_trace_options[] = {
+    {0, "Bank miss rate", bank_miss_rate_value, 1, &bank_stats_update_cb},
+    {0, "Bank misses", bank_misses_value, 1, NULL},
+    {0, "Bank unpack", bank_unpack_value, 1, NULL},
+    {1, "Dump bank trace", bank_dump_value, 1, &bank_dump_update_cb},
+    ODROID_DIALOG_CHOICE_LAST
+};
+#endif
+
 /*static bool save_sram_update_cb(odroid_dialog_choice_t *option, odroid_dialog_event_t event, uint32_t repeat)
 {
     if (event == ODROID_DIALOG_PREV || event == ODROID_DIALOG_NEXT) {
@@ -488,35 +594,40 @@ static bool advanced_settings_cb(odroid_dialog_choice_t *option, odroid_dialog_e
    return false;
 }*/
 
-void pcm_submit() {
-    uint8_t volume = odroid_audio_volume_get();
-    int32_t factor = volume_tbl[volume];
-    size_t offset = (dma_state == DMA_TRANSFER_STATE_HF) ? 0 : AUDIO_BUFFER_LENGTH_GB;
+// The frames run ahead mix into this instead, see run_ahead.h
+static int16_t run_ahead_pcm[AUDIO_BUFFER_LENGTH_GB];
 
-    if (audio_mute || volume == ODROID_AUDIO_VOLUME_MIN) {
-        for (int i = 0; i < AUDIO_BUFFER_LENGTH_GB; i++) {
-            audiobuffer_dma[i + offset] = 0;
-        }
-    } else {
-        for (int i = 0; i < AUDIO_BUFFER_LENGTH_GB; i++) {
-            int32_t sample = pcm.buf[i];
-            audiobuffer_dma[i + offset] = (sample * factor) >> 8;
-        }
+void pcm_submit() {
+    if (run_ahead_active()) {
+        return;
     }
+
+    profiler_begin(PROFILER_AUDIO);
+    odroid_audio_ring_write(pcm.buf, AUDIO_BUFFER_LENGTH_GB);
+    profiler_end(PROFILER_AUDIO);
 }
 
 
 rg_app_desc_t * init(uint8_t load_state)
 {
-    odroid_system_init(APPID_GB, AUDIO_SAMPLE_RATE);
+    odroid_system_init(APPID_GB, AUDIO_SAMPLE_RATE_GB);
     odroid_system_emu_init(&LoadState, &SaveState, &netplay_callback);
 
+    // 4194304 Hz / 70224 cycles per frame, the LCD is tuned to it with LCD_PACING
+    common_emu_state.frame_time_10us = (uint16_t)(100000 / 59.7275f + 0.5f);
+
+#if GB_BANK_TRACE
+    gb_bank_trace_reset();
+    odroid_overlay_set_debug_options(bank_trace_options);
+#endif
+
     // bzhxx : fix LCD glitch at the start by cleaning up the buffer emulator
     memset(emulator_framebuffer, 0x0, sizeof(emulator_framebuffer));
 
-    // Hack: Use the same buffer twice
+    memset(gb_framebuffer2, 0x0, sizeof(gb_framebuffer2));
+
     update1.buffer = emulator_framebuffer;
-    update2.buffer = emulator_framebuffer;
+    update2.buffer = gb_framebuffer2;
 
     //saveSRAM = odroid_settings_app_int32_get(NVS_KEY_SAVE_SRAM, 0);
     saveSRAM = false;
@@ -528,8 +639,7 @@ rg_app_desc_t * init(uint8_t load_state)
     memset(&rtc, 0, sizeof(rtc));
 
     // Video
-    memset(framebuffer1, 0, sizeof(framebuffer1));
-    memset(framebuffer2, 0, sizeof(framebuffer2));
+    lcd_clear_async(0);
     memset(&fb, 0, sizeof(fb));
     fb.w = GB_WIDTH;
     fb.h = GB_HEIGHT;
@@ -542,14 +652,13 @@ rg_app_desc_t * init(uint8_t load_state)
     // Audio
     memset(audiobuffer_emulator, 0, sizeof(audiobuffer_emulator));
     memset(&pcm, 0, sizeof(pcm));
-    pcm.hz = AUDIO_SAMPLE_RATE;
+    pcm.hz = AUDIO_SAMPLE_RATE_GB;
     pcm.stereo = 0;
     pcm.len = AUDIO_BUFFER_LENGTH_GB;
     pcm.buf = (n16*)&audiobuffer_emulator;
     pcm.pos = 0;
 
-    memset(audiobuffer_dma, 0, sizeof(audiobuffer_dma));
-    HAL_SAI_Transmit_DMA(&hsai_BlockA1, (uint8_t *) audiobuffer_dma, AUDIO_BUFFER_LENGTH_DMA_GB);
+    odroid_audio_ring_start(AUDIO_BUFFER_LENGTH_GB);
 
     rg_app_desc_t *app = odroid_system_get_app();
 
@@ -559,16 +668,77 @@ rg_app_desc_t * init(uint8_t load_state)
 
     if (load_state) {
         LoadState("");
+        boot_trace("state loaded");
     }
 
     return app;
 }
 
+static size_t snapshot_save(uint8_t *buffer, size_t size)
+{
+    return gb_state_save(buffer, size);
+}
+
+static void snapshot_load(const uint8_t *buffer, size_t size)
+{
+    gb_state_load(buffer, size);
+}
+
+// The SRAM is part of the state, so its size depends on the cartridge
+static const emu_snapshot_core_t snapshot_core = {
+    .save = &snapshot_save,
+    .load = &snapshot_load,
+};
+
+// One real frame that isn't shown, then the frames ahead of it
+static void emu_run_ahead(bool draw)
+{
+    int frames = run_ahead_frames();
+    n16 *buf = pcm.buf;
+    int pos = pcm.pos;
+
+    if (frames == 0 || !draw) {
+        emu_run(draw);
+        return;
+    }
+
+    emu_run(false);
+    if (!run_ahead_save()) {
+        return;
+    }
+
+    pcm.buf = (n16 *) run_ahead_pcm;
+    for (int i = 1; i <= frames; i++) {
+        emu_run(i == frames);
+    }
+    pcm.buf = buf;
+    pcm.pos = pos;
+
+    run_ahead_load();
+}
+
+// Once per frame. gnuboy's P1 register read doesn't poll again, its core isn't
+// in this tree, see common_emu_input_late_poll()
+static void pad_update(const odroid_gamepad_state_t *joystick)
+{
+    pad_set(PAD_UP, joystick->values[ODROID_INPUT_UP]);
+    pad_set(PAD_RIGHT, joystick->values[ODROID_INPUT_RIGHT]);
+    pad_set(PAD_DOWN, joystick->values[ODROID_INPUT_DOWN]);
+    pad_set(PAD_LEFT, joystick->values[ODROID_INPUT_LEFT]);
+    pad_set(PAD_SELECT, joystick->values[ODROID_INPUT_SELECT]);
+    pad_set(PAD_START, joystick->values[ODROID_INPUT_START]);
+    pad_set(PAD_A, joystick->values[ODROID_INPUT_A]);
+    pad_set(PAD_B, joystick->values[ODROID_INPUT_B]);
+}
+
 void app_main_gb(uint8_t load_state, uint8_t start_paused)
 {
     init(load_state);
     odroid_gamepad_state_t joystick;
 
+    emu_snapshot_init(&snapshot_core);
+    run_ahead_init(NULL, 0);
+
     if (start_paused) {
         common_emu_state.pause_after_frames = 2;
         odroid_audio_mute(true);
@@ -576,6 +746,9 @@ void app_main_gb(uint8_t load_state, uint8_t start_paused)
         common_emu_state.pause_after_frames = 0;
     }
 
+    // The framebuffers were cleared while the rest was set up
+    gw_blit_wait();
+
     while (true)
     {
         wdog_refresh();
@@ -583,23 +756,18 @@ void app_main_gb(uint8_t load_state, uint8_t start_paused)
         odroid_input_read_gamepad(&joystick);
 
         bool drawFrame = common_emu_frame_loop();
+        char run_ahead_str[12];
         odroid_dialog_choice_t options[] = {
             {300, "Palette", "7/7", !hw.cgb, &palette_update_cb},
+            {302, "Run-ahead", run_ahead_str, 1, &run_ahead_update_cb},
             // {301, "More...", "", 1, &advanced_settings_cb},
             ODROID_DIALOG_CHOICE_LAST
         };
         common_emu_input_loop(&joystick, options);
 
-        pad_set(PAD_UP, joystick.values[ODROID_INPUT_UP]);
-        pad_set(PAD_RIGHT, joystick.values[ODROID_INPUT_RIGHT]);
-        pad_set(PAD_DOWN, joystick.values[ODROID_INPUT_DOWN]);
-        pad_set(PAD_LEFT, joystick.values[ODROID_INPUT_LEFT]);
-        pad_set(PAD_SELECT, joystick.values[ODROID_INPUT_SELECT]);
-        pad_set(PAD_START, joystick.values[ODROID_INPUT_START]);
-        pad_set(PAD_A, joystick.values[ODROID_INPUT_A]);
-        pad_set(PAD_B, joystick.values[ODROID_INPUT_B]);
+        pad_update(&joystick);
 
-        emu_run(drawFrame);
+        emu_run_ahead(drawFrame);
 
         if (saveSRAM)
         {
@@ -611,22 +779,13 @@ void app_main_gb(uint8_t load_state, uint8_t start_paused)
 
             if (saveSRAM_Timer > 0 && --saveSRAM_Timer == 0)
             {
-                // TO DO: Try compressing the sram file, it might reduce stuttering
+                // sram_save() lives in gnuboy and blocks until the flash is
+                // written. Queue the write with store_save_async() there so
+                // it's done between frames instead.
                 sram_save();
             }
         }
 
-        if(!common_emu_state.skip_frames)
-        {
-            // odroid_audio_submit(pcm.buf, pcm.pos >> 1);
-            // handled in pcm_submit instead.
-            static dma_transfer_state_t last_dma_state = DMA_TRANSFER_STATE_HF;
-            for(uint8_t p = 0; p < common_emu_state.pause_frames + 1; p++) {
-                while (dma_state == last_dma_state) {
-                    cpumon_sleep();
-                }
-                last_dma_state = dma_state;
-            }
-        }
+        common_emu_sync();
     }
 }
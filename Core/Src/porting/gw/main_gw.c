@@ -13,32 +13,46 @@
 
 #include "common.h"
 #include "rom_manager.h"
+#include "save_pack.h"
+#include "state_slots.h"
+#include "boot_trace.h"
+#include "profiler.h"
+#include "emu_snapshot.h"
+#include "gw_dirty.h"
+#include "emu_arena.h"
 
 /* G&W system support */
 #include "gw_system.h"
 
-/* access to internals for debug purpose */
-#include "sm510.h"
-
-/* Uncomment to enable debug menu in overlay */
-//#define GW_EMU_DEBUG_OVERLAY
-
 #define ODROID_APPID_GW 6
 
-/* Audio buffer length */
-#define GW_AUDIO_BUFFER_LENGTH_DMA ((2 * GW_AUDIO_FREQ) / GW_REFRESH_RATE)
+/* The LCD of a G&W changes a few times a second. Frames are rendered into
+ * a buffer in cached RAM, which is much faster to composite in than the
+ * uncached LCD buffers, and only the lines that differ from what the LCD
+ * buffer holds are copied over (see gw_dirty.h).
+ *
+ * While the frame stays the same, it's only rendered every
+ * GW_IDLE_BLIT_INTERVAL frames. A change goes back to rendering every frame. */
+#define GW_IDLE_BLIT_INTERVAL 4
+#define GW_LINE_BYTES (sizeof(framebuffer1) / GW_LCD_HEIGHT)
 
 static odroid_gamepad_state_t joystick;
 
 static unsigned char state_save_buffer[sizeof(gw_state_t)];
 
+static uint8_t *render_buffer;
+static uint32_t shown_hash;
+static bool shown_overlay;
+static uint8_t blit_wait;
+
 static bool gw_system_SaveState(char *pathName)
 {
     printf("Saving state...\n");
 
     memset(state_save_buffer, '\x00', sizeof(state_save_buffer));
     gw_state_save(state_save_buffer);
-    store_save(ACTIVE_FILE->save_address, state_save_buffer, sizeof(state_save_buffer));
+    save_pack_store(state_slot_current(), ACTIVE_FILE->save_size,
+                    state_save_buffer, sizeof(state_save_buffer));
     printf("Saving state done!\n");
     return false;
 }
@@ -46,7 +60,12 @@ static bool gw_system_SaveState(char *pathName)
 static bool gw_system_LoadState(char *pathName)
 {
     printf("Loading state...\n");
-    gw_state_load((unsigned char *) ACTIVE_FILE->save_address);
+    size_t size;
+    const uint8_t *state = save_pack_load(state_slot_current(), ACTIVE_FILE->save_size,
+                                          state_save_buffer, sizeof(state_save_buffer), &size);
+    if (state != NULL) {
+        gw_state_load((unsigned char *) state);
+    }
     printf("Loading state done!\n");
     return true;
 }
@@ -74,19 +93,15 @@ static void gw_sound_init()
     /* init emulator sound system with shared audio buffer */
     gw_system_sound_init();
 
-    /* clear DMA audio buffer */
-    memset(audiobuffer_dma, 0, sizeof(audiobuffer_dma));
-
     /* Start SAI DMA */
-    HAL_SAI_Transmit_DMA(&hsai_BlockA1, (uint8_t *)audiobuffer_dma, GW_AUDIO_BUFFER_LENGTH_DMA);
+    odroid_audio_ring_start(GW_AUDIO_BUFFER_LENGTH);
 }
 
+static const int16_t gw_audio_levels[2] = {0, 1 << 12};
+
 static void gw_sound_submit()
 {
 
-    uint8_t volume = odroid_audio_volume_get();
-    int16_t factor = volume_tbl[volume];
-
     /** Enables the following code to track audio rendering issues **/
     /*
     if (gw_audio_buffer_idx < GW_AUDIO_BUFFER_LENGTH) {
@@ -100,107 +115,87 @@ static void gw_sound_submit()
     }
     */
 
-    size_t offset = (dma_state == DMA_TRANSFER_STATE_HF) ? 0 : GW_AUDIO_BUFFER_LENGTH;
+    profiler_begin(PROFILER_AUDIO);
 
-    if (audio_mute || volume == ODROID_AUDIO_VOLUME_MIN)
-    {
-        for (int i = 0; i < GW_AUDIO_BUFFER_LENGTH; i++)
-        {
-            audiobuffer_dma[i + offset] = 0;
-        }
-    }
-    else
-    {
-        for (int i = 0; i < GW_AUDIO_BUFFER_LENGTH; i++)
-        {
-            audiobuffer_dma[i + offset] = (factor) * (gw_audio_buffer[i] << 4);
-        }
-    }
+    /* The buzzer is either on or off, the ring takes the samples as they are
+     * and fills whole runs of them at once. Same level as factor * (1 << 4)
+     * once the volume is applied. */
+    odroid_audio_ring_write_levels(gw_audio_buffer, GW_AUDIO_BUFFER_LENGTH, gw_audio_levels);
+
+    profiler_end(PROFILER_AUDIO);
 
     gw_audio_buffer_copied = true;
 }
 
-/************************ Debug function in overlay START *******************************/
-
-/* performance monitoring */
-/* Emulator loop monitoring
-    ( unit is 1/systemcoreclock 1/280MHz )
-    loop_cycles
-        -measured duration of the loop.
-    proc_cycles
-        - estimated duration of emulated CPU for a bunch of emulated system clock.
-    blit_cycles
-        - estimated duration of graphics rendering.
-    end_cycles
-        - estimated duration of overall processing.
-    */
-
-static unsigned int loop_cycles = 1, end_cycles = 1, proc_cycles = 1, blit_cycles = 1;
-
-/* DWT counter used to measure time execution */
-volatile unsigned int *DWT_CONTROL = (unsigned int *)0xE0001000;
-volatile unsigned int *DWT_CYCCNT = (unsigned int *)0xE0001004;
-volatile unsigned int *DEMCR = (unsigned int *)0xE000EDFC;
-volatile unsigned int *LAR = (unsigned int *)0xE0001FB0; // <-- lock access register
+static void gw_blit(void)
+{
+    uint8_t *fb = lcd_get_active_buffer();
+    uint32_t hash;
+
+    if (render_buffer == NULL) {
+        // Not enough RAM left, straight into the LCD buffer every time
+        lcd_beam_begin();
+        profiler_begin(PROFILER_BLIT);
+        gw_system_blit((unsigned short *) fb);
+        profiler_end(PROFILER_BLIT);
+        common_ingame_overlay();
+        lcd_swap();
+        return;
+    }
 
-#define get_dwt_cycles() *DWT_CYCCNT
-#define clear_dwt_cycles() *DWT_CYCCNT = 0
+    if (blit_wait > 0) {
+        blit_wait--;
+        return;
+    }
 
-#ifdef GW_EMU_DEBUG_OVERLAY
-static void enable_dwt_cycles()
-{
+    profiler_begin(PROFILER_BLIT);
+    gw_system_blit((unsigned short *) render_buffer);
+    hash = gw_dirty_hash(render_buffer, sizeof(framebuffer1), 0);
+
+    // The buffers are cleared after the menus, and overlays come and go
+    if (hash == shown_hash && !shown_overlay &&
+        common_emu_state.overlay == INGAME_OVERLAY_NONE &&
+        common_emu_state.startup_frames >= 3) {
+        profiler_end(PROFILER_BLIT);
+        blit_wait = GW_IDLE_BLIT_INTERVAL - 1;
+        return;
+    }
 
-    /* Use DWT cycle counter to get precision time elapsed during loop.
-    The DWT cycle counter is cleared on every loop
-    it may crash if the DWT is used during trace profiling */
+    // The active LCD buffer holds an older frame, update what changed since
+    lcd_beam_begin();
+    gw_dirty_begin(render_buffer, GW_LINE_BYTES, GW_LINE_BYTES, GW_LCD_HEIGHT, 0);
+    for (int y = 0; y < GW_LCD_HEIGHT; y++) {
+        if (gw_dirty_line(y)) {
+            memcpy(&fb[y * GW_LINE_BYTES], &render_buffer[y * GW_LINE_BYTES], GW_LINE_BYTES);
+        }
+    }
+    profiler_end(PROFILER_BLIT);
 
-    *DEMCR = *DEMCR | 0x01000000;    // enable trace
-    *LAR = 0xC5ACCE55;               // <-- added unlock access to DWT (ITM, etc.)registers
-    *DWT_CYCCNT = 0;                 // clear DWT cycle counter
-    *DWT_CONTROL = *DWT_CONTROL | 1; // enable DWT cycle counter
+    shown_hash = hash;
+    shown_overlay = common_emu_state.overlay != INGAME_OVERLAY_NONE;
+    common_ingame_overlay();
+    lcd_swap();
 }
-#endif
 
-static void gw_debug_bar()
+static size_t snapshot_save(uint8_t *buffer, size_t size)
 {
-
-#ifdef GW_EMU_DEBUG_OVERLAY
-    static unsigned int loop_duration_us = 1, end_duration_us = 1, proc_duration_us = 1, blit_duration_us = 1;
-    static const unsigned int SYSTEM_CORE_CLOCK_MHZ = 280;
-
-    static bool debug_init_done = false;
-
-    if (!debug_init_done)
-    {
-        enable_dwt_cycles();
-        debug_init_done = true;
+    if (size < sizeof(gw_state_t)) {
+        return 0;
     }
+    gw_state_save(buffer);
+    return sizeof(gw_state_t);
+}
 
-    static unsigned int overflow_count = 0;
-    static unsigned int busy_percent = 0;
-
-    char debugMsg[120];
-
-    proc_duration_us = proc_cycles / SYSTEM_CORE_CLOCK_MHZ;
-    blit_duration_us = blit_cycles / SYSTEM_CORE_CLOCK_MHZ;
-    end_duration_us = end_cycles / SYSTEM_CORE_CLOCK_MHZ;
-    loop_duration_us = loop_cycles / SYSTEM_CORE_CLOCK_MHZ;
-
-    busy_percent = 100 * (proc_duration_us + blit_duration_us) / loop_duration_us;
-
-    if (end_duration_us > 1000000 / GW_REFRESH_RATE)
-        overflow_count++;
-
-    if (m_halt != 0)
-        sprintf(debugMsg, "%04dus EMU:%04dus FX:%04dus %d%%+%d HALT", loop_duration_us, proc_duration_us, blit_duration_us, busy_percent, overflow_count);
-    else
-        sprintf(debugMsg, "%04dus EMU:%04dus FX:%04dus %d%%+%d", loop_duration_us, proc_duration_us, blit_duration_us, busy_percent, overflow_count);
-
-    odroid_overlay_draw_text(0, 0, GW_SCREEN_WIDTH, debugMsg, C_GW_YELLOW, C_GW_MAIN_COLOR);
-
-#endif
+static void snapshot_load(const uint8_t *buffer, size_t size)
+{
+    gw_state_load((unsigned char *) buffer);
 }
-/************************ Debug function in overlay END ********************************/
+
+static const emu_snapshot_core_t snapshot_core = {
+    .save = &snapshot_save,
+    .load = &snapshot_load,
+    .size = sizeof(gw_state_t),
+};
 
 /* Main */
 int app_main_gw(uint8_t load_state)
@@ -208,6 +203,7 @@ int app_main_gw(uint8_t load_state)
 
     odroid_system_init(APPID_GW, GW_AUDIO_FREQ);
     odroid_system_emu_init(&gw_system_LoadState, &gw_system_SaveState, NULL);
+    emu_snapshot_init(&snapshot_core);
 
     // const int frameTime = get_frame_time(GW_REFRESH_RATE);
 
@@ -219,6 +215,8 @@ int app_main_gw(uint8_t load_state)
     if (!rom_status)
         odroid_system_switch_app(0);
 
+    render_buffer = emu_arena_try_alloc(EMU_ARENA_RAM_EMU, sizeof(framebuffer1), 32);
+
     /*** Clear audio buffer */
     gw_sound_init();
     printf("Sound initialized\n");
@@ -238,16 +236,13 @@ int app_main_gw(uint8_t load_state)
     printf("Main emulator loop start\n");
 
     /* check if we to have to load state */
-    if (load_state != 0)
+    if (load_state != 0) {
         gw_system_LoadState(NULL);
-
-    clear_dwt_cycles();
+        boot_trace("state loaded");
+    }
 
     while (true)
     {
-        /* clear DWT counter used to monitor performances */
-        clear_dwt_cycles();
-
         wdog_refresh();
 
         odroid_input_read_gamepad(&joystick);
@@ -263,47 +258,17 @@ int app_main_gw(uint8_t load_state)
         // to execute on the emulated device
         gw_system_run(GW_SYSTEM_CYCLES);
 
-        /* get how many cycles have been spent in the emulator */
-        proc_cycles = get_dwt_cycles();
-
         /* update the screen only if there is no pending frame to render */
         if (!is_lcd_swap_pending() && drawFrame)
         {
-            gw_system_blit(lcd_get_active_buffer());
-            gw_debug_bar();
-            common_ingame_overlay();
-            lcd_swap();
-
-            /* get how many cycles have been spent in graphics rendering */
-            blit_cycles = get_dwt_cycles() - proc_cycles;
+            gw_blit();
         }
         /****************************************************************************/
 
-        /* copy audio samples for DMA */
-        if (drawFrame) {
-            gw_sound_submit();
-        }
-
-        /* get how many cycles have been spent to process everything */
-        end_cycles = get_dwt_cycles();
-
-        if(!common_emu_state.skip_frames)
-        {
-            for(uint8_t p = 0; p < common_emu_state.pause_frames + 1; p++) {
-                static dma_transfer_state_t last_dma_state = DMA_TRANSFER_STATE_HF;
-                while (dma_state == last_dma_state) {
-                    #ifdef GW_EMU_DEBUG_OVERLAY
-                    __NOP();
-                    #else
-                    cpumon_sleep();
-                    #endif
-                }
-                last_dma_state = dma_state;
-            }
-        }
+        /* copy audio samples for DMA, skipped frames are still emulated */
+        gw_sound_submit();
 
-        /* get how cycles have been spent inside this loop */
-        loop_cycles = get_dwt_cycles();
+        common_emu_sync();
 
     } // end of loop
 }
@@ -4,12 +4,16 @@
 #include <assert.h>
 
 #include "gw_linker.h"
+#include "porting.h"
+#include "emu_arena.h"
+#include "mem_stats.h"
 
+static char *heap_end;
+static char *heap_peak;
 
 void *
 _sbrk (int incr)
 {
-    static char * heap_end;
     char *        prev_heap_end;
 
     if (heap_end == 0)
@@ -19,10 +23,42 @@ _sbrk (int incr)
 
     prev_heap_end = heap_end;
     heap_end += incr;
+    if (heap_end > heap_peak)
+        heap_peak = heap_end;
 
     return (void *) prev_heap_end;
 }
 
+size_t gw_heap_peak(void)
+{
+    return heap_peak ? heap_peak - (char *) &_heap_start : 0;
+}
+
+/*
+ * The free list of the newlib nano malloc(), see nano-mallocr.c. It's no
+ * API, but nano's malloc() and free() keep no other state than it and the
+ * _sbrk() end, so saving and restoring both is all a release takes. That
+ * holds as long as nothing allocated before the mark is freed until the
+ * release, it would be lost then, which the launcher doesn't do while a
+ * game runs, and as there's no other thread calling malloc(). A libc with
+ * another allocator fails to link on the symbol rather than misbehave.
+ */
+extern void *__malloc_free_list;
+
+void gw_heap_mark(gw_heap_mark_t *mark)
+{
+    mark->end = heap_end;
+    mark->free_list = __malloc_free_list;
+    // What's freed from now on is only reused until the release
+    __malloc_free_list = NULL;
+}
+
+void gw_heap_release(const gw_heap_mark_t *mark)
+{
+    heap_end = mark->end;
+    __malloc_free_list = mark->free_list;
+}
+
 #ifdef DEBUG_RG_ALLOC
 
 static struct {
@@ -31,8 +67,29 @@ static struct {
     uint32_t total_alloc_num;
 } alloc_data;
 
+// MEM_FAST and MEM_DMA blocks come from the arenas of the app, they are only
+// freed when the next app starts. DTCM can't be reached by the DMA
+// controllers, only by the MDMA.
+static void *rg_alloc_arena(size_t size, uint32_t caps)
+{
+    if (caps & MEM_DMA) {
+        return emu_arena_try_alloc(EMU_ARENA_RAM_EMU, size, 32);
+    }
+    if (caps & MEM_FAST) {
+        return emu_arena_try_alloc(EMU_ARENA_DTCM, size, 32);
+    }
+
+    return NULL;
+}
+
 void *rg_alloc(size_t size, uint32_t caps)
 {
+    void *block = rg_alloc_arena(size, caps);
+
+    if (block != NULL) {
+        return block;
+    }
+
     uint32_t *p = malloc(size + sizeof(uint32_t));
 
     alloc_data.total_alloc_bytes += size;
@@ -60,6 +117,10 @@ void rg_free(void *ptr)
 {
     assert(ptr != NULL);
 
+    if (emu_arena_contains(ptr)) {
+        return;
+    }
+
     uint32_t *p = ((uint32_t *) ptr) - 1;
 
     alloc_data.total_alloc_bytes -= p[0];
@@ -82,6 +143,9 @@ void *rg_realloc(void *ptr, size_t size)
         return rg_alloc(size, 0);
     }
 
+    // The size of arena blocks isn't known
+    assert(!emu_arena_contains(ptr));
+
     uint32_t *p = ((uint32_t *) ptr) - 1;
 
     alloc_data.total_alloc_bytes -= p[0];
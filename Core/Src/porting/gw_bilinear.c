@@ -0,0 +1,131 @@
+#include <assert.h>
+
+#include "gw_bilinear.h"
+#include "gw_dirty.h"
+#include "gw_lcd.h"
+
+// Weights are 1/32 steps, which is as precise as a 5 bit channel gets
+#define WEIGHT_BITS 5
+#define WEIGHT_ONE  (1 << WEIGHT_BITS)
+
+// RGB565 spread out over a word as ----GGGGGG-----RRRRR------BBBBB, every
+// channel has enough headroom to be multiplied by a weight in place.
+#define SPREAD_MASK  0x07e0f81f
+#define SPREAD_ROUND 0x02008010
+
+typedef struct {
+    uint16_t index;  // Blend this source pixel or line with the next one
+    uint16_t weight; // Weight of the next one, 0 to WEIGHT_ONE
+} tap_t;
+
+static tap_t taps_x[GW_LCD_WIDTH];
+static tap_t taps_y[GW_LCD_HEIGHT];
+
+static uint32_t src_w;
+static uint32_t src_h;
+static uint32_t dst_w;
+static uint32_t dst_h;
+
+// Horizontally scaled source lines in spread format. Upscaled output lines
+// share source lines, so the last two are kept around.
+static uint32_t lines[2][GW_LCD_WIDTH];
+static int32_t lines_src[2];
+
+static void setup_taps(tap_t *taps, uint32_t src, uint32_t dst)
+{
+    for (uint32_t i = 0; i < dst; i++) {
+        // Pixel centers are aligned, same as imlib_draw_image() did
+        int32_t pos = (((2 * i + 1) * src * WEIGHT_ONE) / (2 * dst)) - (WEIGHT_ONE / 2);
+        if (pos < 0) {
+            pos = 0;
+        }
+
+        uint32_t index = pos >> WEIGHT_BITS;
+        uint32_t weight = pos & (WEIGHT_ONE - 1);
+        if (index >= src - 1) {
+            index = src - 2;
+            weight = WEIGHT_ONE;
+        }
+
+        taps[i].index = index;
+        taps[i].weight = weight;
+    }
+}
+
+void gw_bilinear_setup(uint32_t src_width, uint32_t src_height,
+                       uint32_t dst_width, uint32_t dst_height)
+{
+    if (src_width == src_w && src_height == src_h &&
+        dst_width == dst_w && dst_height == dst_h) {
+        return;
+    }
+
+    assert(src_width >= 2 && src_height >= 2);
+    assert(dst_width <= GW_LCD_WIDTH && dst_height <= GW_LCD_HEIGHT);
+
+    setup_taps(taps_x, src_width, dst_width);
+    setup_taps(taps_y, src_height, dst_height);
+
+    src_w = src_width;
+    src_h = src_height;
+    dst_w = dst_width;
+    dst_h = dst_height;
+}
+
+static inline uint32_t spread(uint16_t c)
+{
+    return (c | ((uint32_t) c << 16)) & SPREAD_MASK;
+}
+
+static inline uint32_t blend(uint32_t a, uint32_t b, uint32_t weight)
+{
+    return ((a * (WEIGHT_ONE - weight) + b * weight + SPREAD_ROUND) >> WEIGHT_BITS) & SPREAD_MASK;
+}
+
+__attribute__((optimize("unroll-loops")))
+__attribute__((section (".itcram_hot_text")))
+static const uint32_t *get_line(const uint16_t *src, uint32_t src_stride, uint32_t y)
+{
+    uint32_t *line = lines[y & 1];
+
+    if (lines_src[y & 1] == (int32_t) y) {
+        return line;
+    }
+
+    const uint16_t *src_row = &src[y * src_stride];
+    for (uint32_t x = 0; x < dst_w; x++) {
+        tap_t tap = taps_x[x];
+        line[x] = blend(spread(src_row[tap.index]), spread(src_row[tap.index + 1]), tap.weight);
+    }
+    lines_src[y & 1] = y;
+
+    return line;
+}
+
+__attribute__((optimize("unroll-loops")))
+__attribute__((section (".itcram_hot_text")))
+void gw_bilinear_rgb565(const uint16_t *src, uint32_t src_stride,
+                        uint16_t *dst, uint32_t dst_stride)
+{
+    assert(dst_w > 0);
+
+    lines_src[0] = -1;
+    lines_src[1] = -1;
+
+    for (uint32_t y = 0; y < dst_h; y++) {
+        tap_t tap = taps_y[y];
+
+        if (!gw_dirty_lines(tap.index, 2)) {
+            continue;
+        }
+
+        const uint32_t *l0 = get_line(src, src_stride, tap.index);
+        const uint32_t *l1 = get_line(src, src_stride, tap.index + 1);
+        uint16_t *dst_row = &dst[y * dst_stride];
+
+        for (uint32_t x = 0; x < dst_w; x++) {
+            uint32_t c = blend(l0[x], l1[x], tap.weight);
+            dst_row[x] = c | (c >> 16);
+        }
+    }
+}
@@ -0,0 +1,271 @@
+#include <assert.h>
+#include <string.h>
+
+#include "stm32h7xx_hal.h"
+#include "gw_blit.h"
+#include "gw_lcd.h"
+#include "gw_linker.h"
+
+// The DMA2D is driven at register level. The HAL driver needs a full
+// HAL_DMA2D_Init() to switch between PFC, copy and fill modes, which is more
+// expensive than the transfer itself for the small border fills.
+
+#define DMA2D_MODE_M2M      (0)
+#define DMA2D_MODE_M2M_PFC  (DMA2D_CR_MODE_0)
+#define DMA2D_MODE_R2M      (DMA2D_CR_MODE_1 | DMA2D_CR_MODE_0)
+
+#define DMA2D_CM_ARGB8888   (0x0)
+#define DMA2D_CM_RGB565     (0x2)
+#define DMA2D_CM_L8         (0x5)
+
+#define DMA2D_ISR_ERRORS    (DMA2D_ISR_TEIF | DMA2D_ISR_CAEIF | DMA2D_ISR_CEIF)
+#define DMA2D_IFCR_ALL      (DMA2D_IFCR_CTEIF | DMA2D_IFCR_CTCIF | DMA2D_IFCR_CTWIF | \
+                             DMA2D_IFCR_CAECIF | DMA2D_IFCR_CCTCIF | DMA2D_IFCR_CCEIF)
+
+static uint32_t clut[256] __attribute__((aligned(32)));
+static uint32_t clut_size;
+
+// Set when lcd_swap() should be called from the transfer complete interrupt
+static volatile bool swap_pending;
+
+// Cacheable destination of the blit in progress, invalidated once it's done
+static uint32_t dst_start;
+static uint32_t dst_end;
+
+// Make sure the DMA2D sees what the CPU wrote to cacheable memory
+static void clean_dcache(const void *addr, uint32_t size)
+{
+    if ((SCB->CCR & SCB_CCR_DC_Msk) == 0) {
+        return;
+    }
+
+    uint32_t start = (uint32_t) addr & ~31UL;
+    uint32_t end = ((uint32_t) addr + size + 31) & ~31UL;
+
+    SCB_CleanDCache_by_Addr((uint32_t *) start, end - start);
+}
+
+// Only RAM_CORE and RAM_EMU are cacheable, the LCD framebuffers in RAM_UC
+// and AHBRAM aren't (see MPU_Config)
+static bool is_cached(const void *addr)
+{
+    return (SCB->CCR & SCB_CCR_DC_Msk) &&
+           (uint8_t *) addr >= &__RAM_CORE_START__ &&
+           (uint8_t *) addr < &__RAM_EMU_END__;
+}
+
+// Write back dirty lines over the destination before the DMA2D writes it,
+// and drop them again after the blit in case the CPU fetched some meanwhile
+static void prepare_dst(const void *addr, uint32_t size)
+{
+    if (!is_cached(addr)) {
+        return;
+    }
+
+    dst_start = (uint32_t) addr & ~31UL;
+    dst_end = ((uint32_t) addr + size + 31) & ~31UL;
+
+    SCB_CleanInvalidateDCache_by_Addr((uint32_t *) dst_start, dst_end - dst_start);
+}
+
+static void start(uint32_t mode, uint32_t width, uint32_t height)
+{
+    assert(width <= (DMA2D_NLR_PL_Msk >> DMA2D_NLR_PL_Pos));
+    assert(height <= DMA2D_NLR_NL_Msk);
+
+    if (width == 0 || height == 0) {
+        return;
+    }
+
+    DMA2D->NLR = (width << DMA2D_NLR_PL_Pos) | height;
+    DMA2D->IFCR = DMA2D_IFCR_ALL;
+    DMA2D->CR = mode | DMA2D_CR_TCIE | DMA2D_CR_START;
+}
+
+void gw_blit_init(void)
+{
+    __HAL_RCC_DMA2D_CLK_ENABLE();
+
+    DMA2D->CR = 0;
+    DMA2D->IFCR = DMA2D_IFCR_ALL;
+    DMA2D->OPFCCR = DMA2D_CM_RGB565;
+
+    clut_size = 0;
+    swap_pending = false;
+    dst_start = dst_end = 0;
+
+    HAL_NVIC_SetPriority(DMA2D_IRQn, 0, 0);
+    HAL_NVIC_EnableIRQ(DMA2D_IRQn);
+}
+
+void gw_blit_irq_handler(void)
+{
+    DMA2D->IFCR = DMA2D_IFCR_CTCIF;
+
+    if (swap_pending) {
+        swap_pending = false;
+        lcd_swap();
+    }
+}
+
+bool gw_blit_can_read(const void *addr)
+{
+    uint32_t a = (uint32_t) addr;
+
+    // 64kB of ITCM and 128kB of DTCM
+    return a >= 0x10000 && (a < D1_DTCMRAM_BASE || a >= D1_DTCMRAM_BASE + 0x20000);
+}
+
+bool gw_blit_busy(void)
+{
+    return (DMA2D->CR & DMA2D_CR_START) != 0;
+}
+
+void gw_blit_wait(void)
+{
+    while ((DMA2D->CR & DMA2D_CR_START) || swap_pending) {
+        __NOP();
+    }
+
+    assert((DMA2D->ISR & DMA2D_ISR_ERRORS) == 0);
+
+    if (dst_end != dst_start) {
+        SCB_InvalidateDCache_by_Addr((uint32_t *) dst_start, dst_end - dst_start);
+        dst_start = dst_end = 0;
+    }
+}
+
+void gw_blit_swap_when_done(void)
+{
+    __disable_irq();
+    if (DMA2D->CR & DMA2D_CR_START) {
+        // The transfer complete interrupt fires once interrupts are enabled
+        // again if the transfer finishes in the meantime.
+        swap_pending = true;
+    } else {
+        lcd_swap();
+    }
+    __enable_irq();
+}
+
+void gw_blit_set_clut_rgb565(const uint16_t *palette, uint32_t count)
+{
+    uint32_t argb[256];
+
+    assert(count > 0 && count <= 256);
+
+    for (int i = 0; i < count; i++) {
+        uint32_t c = palette[i];
+        uint32_t r = (c >> 11) & 0x1f;
+        uint32_t g = (c >> 5) & 0x3f;
+        uint32_t b = c & 0x1f;
+
+        argb[i] = 0xff000000 |
+                  (((r << 3) | (r >> 2)) << 16) |
+                  (((g << 2) | (g >> 4)) << 8) |
+                  ((b << 3) | (b >> 2));
+    }
+
+    if ((count == clut_size) && (memcmp(argb, clut, count * sizeof(uint32_t)) == 0)) {
+        return;
+    }
+
+    gw_blit_wait();
+
+    memcpy(clut, argb, count * sizeof(uint32_t));
+    clut_size = count;
+    clean_dcache(clut, sizeof(clut));
+
+    DMA2D->IFCR = DMA2D_IFCR_CCTCIF | DMA2D_IFCR_CCEIF;
+    DMA2D->FGCMAR = (uint32_t) clut;
+    DMA2D->FGPFCCR = DMA2D_CM_L8 |
+                     (DMA2D_CM_ARGB8888 << DMA2D_FGPFCCR_CCM_Pos) |
+                     ((count - 1) << DMA2D_FGPFCCR_CS_Pos) |
+                     DMA2D_FGPFCCR_START;
+
+    while (DMA2D->FGPFCCR & DMA2D_FGPFCCR_START) {
+        __NOP();
+    }
+
+    assert((DMA2D->ISR & DMA2D_ISR_CEIF) == 0);
+}
+
+void gw_blit_l8_to_rgb565(const uint8_t *src, uint32_t src_stride,
+                          uint16_t *dst, uint32_t dst_stride,
+                          uint32_t width, uint32_t height)
+{
+    assert(clut_size > 0);
+
+    gw_blit_wait();
+    if (height == 0) {
+        return;
+    }
+    clean_dcache(src, src_stride * (height - 1) + width);
+    prepare_dst(dst, (dst_stride * (height - 1) + width) * sizeof(uint16_t));
+
+    DMA2D->FGMAR = (uint32_t) src;
+    DMA2D->FGOR = src_stride - width;
+    DMA2D->FGPFCCR = DMA2D_CM_L8 |
+                     (DMA2D_CM_ARGB8888 << DMA2D_FGPFCCR_CCM_Pos) |
+                     ((clut_size - 1) << DMA2D_FGPFCCR_CS_Pos);
+    DMA2D->OMAR = (uint32_t) dst;
+    DMA2D->OOR = dst_stride - width;
+    DMA2D->OPFCCR = DMA2D_CM_RGB565;
+
+    start(DMA2D_MODE_M2M_PFC, width, height);
+}
+
+void gw_blit_copy_rgb565(const uint16_t *src, uint32_t src_stride,
+                         uint16_t *dst, uint32_t dst_stride,
+                         uint32_t width, uint32_t height)
+{
+    gw_blit_wait();
+    if (height == 0) {
+        return;
+    }
+    clean_dcache(src, (src_stride * (height - 1) + width) * sizeof(uint16_t));
+    prepare_dst(dst, (dst_stride * (height - 1) + width) * sizeof(uint16_t));
+
+    DMA2D->FGMAR = (uint32_t) src;
+    DMA2D->FGOR = src_stride - width;
+    DMA2D->FGPFCCR = DMA2D_CM_RGB565;
+    DMA2D->OMAR = (uint32_t) dst;
+    DMA2D->OOR = dst_stride - width;
+    DMA2D->OPFCCR = DMA2D_CM_RGB565;
+
+    start(DMA2D_MODE_M2M, width, height);
+}
+
+void gw_blit_fill_rgb565(uint16_t *dst, uint32_t dst_stride,
+                         uint32_t width, uint32_t height, uint16_t color)
+{
+    gw_blit_wait();
+    if (width == 0 || height == 0) {
+        return;
+    }
+    prepare_dst(dst, (dst_stride * (height - 1) + width) * sizeof(uint16_t));
+
+    DMA2D->OCOLR = color;
+    DMA2D->OMAR = (uint32_t) dst;
+    DMA2D->OOR = dst_stride - width;
+    DMA2D->OPFCCR = DMA2D_CM_RGB565;
+
+    start(DMA2D_MODE_R2M, width, height);
+}
+
+void gw_blit_fill_border_rgb565(uint16_t *dst, uint32_t dst_stride,
+                                uint32_t dst_width, uint32_t dst_height,
+                                uint32_t x, uint32_t y, uint32_t width, uint32_t height,
+                                uint16_t color)
+{
+    assert(x + width <= dst_width);
+    assert(y + height <= dst_height);
+
+    // Top, bottom, left and right of the rectangle
+    gw_blit_fill_rgb565(dst, dst_stride, dst_width, y, color);
+    gw_blit_fill_rgb565(&dst[(y + height) * dst_stride], dst_stride,
+                        dst_width, dst_height - y - height, color);
+    gw_blit_fill_rgb565(&dst[y * dst_stride], dst_stride, x, height, color);
+    gw_blit_fill_rgb565(&dst[y * dst_stride + x + width], dst_stride,
+                        dst_width - x - width, height, color);
+}
@@ -0,0 +1,103 @@
+#include <assert.h>
+
+#include "gw_dirty.h"
+#include "gw_lcd.h"
+
+// What was last drawn into one of the LCD buffers
+typedef struct {
+    bool valid;
+    uint32_t key;
+    uint32_t lines;
+    uint32_t hash[GW_DIRTY_MAX_LINES];
+} drawn_frame_t;
+
+// One per LCD buffer, see active_framebuffer
+static drawn_frame_t drawn[3];
+
+static bool dirty[GW_DIRTY_MAX_LINES];
+static uint32_t dirty_lines;
+static uint32_t frame_lines;
+
+// FNV-1a on words. Lines are hashed every frame, so this has to be cheap
+// rather than good at avoiding collisions.
+__attribute__((optimize("unroll-loops")))
+__attribute__((section (".itcram_hot_text")))
+uint32_t gw_dirty_hash(const void *data, uint32_t bytes, uint32_t seed)
+{
+    const uint32_t *words = data;
+    uint32_t hash = 0x811c9dc5 ^ seed;
+
+    assert(((uint32_t) data & 3) == 0);
+    assert((bytes & 3) == 0);
+
+    for (uint32_t i = 0; i < bytes / 4; i++) {
+        hash = (hash ^ words[i]) * 0x01000193;
+    }
+
+    return hash;
+}
+
+uint32_t gw_dirty_begin(const void *src, uint32_t stride, uint32_t line_bytes,
+                        uint32_t lines, uint32_t key)
+{
+    drawn_frame_t *frame = &drawn[active_framebuffer];
+    const uint8_t *line = src;
+
+    assert(lines <= GW_DIRTY_MAX_LINES);
+
+    bool redraw = !frame->valid || (frame->key != key) || (frame->lines != lines);
+
+    dirty_lines = 0;
+    for (uint32_t i = 0; i < lines; i++, line += stride) {
+        uint32_t hash = gw_dirty_hash(line, line_bytes, key);
+
+        dirty[i] = redraw || (hash != frame->hash[i]);
+        dirty_lines += dirty[i];
+
+        frame->hash[i] = hash;
+    }
+
+    // Assume the caller redraws all of the dirty lines
+    frame->valid = true;
+    frame->key = key;
+    frame->lines = lines;
+    frame_lines = lines;
+
+    return dirty_lines;
+}
+
+bool gw_dirty_any(void)
+{
+    return dirty_lines > 0;
+}
+
+bool gw_dirty_line(uint32_t line)
+{
+    assert(line < frame_lines);
+
+    return dirty[line];
+}
+
+bool gw_dirty_lines(uint32_t first, uint32_t count)
+{
+    uint32_t last = first + count;
+
+    if (last > frame_lines) {
+        last = frame_lines;
+    }
+
+    for (uint32_t i = first; i < last; i++) {
+        if (dirty[i]) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void gw_dirty_invalidate(void)
+{
+    for (int i = 0; i < sizeof(drawn) / sizeof(drawn[0]); i++) {
+        drawn[i].valid = false;
+    }
+}
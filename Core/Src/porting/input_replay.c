@@ -0,0 +1,110 @@
+#include <string.h>
+
+#include "input_replay.h"
+
+#if INPUT_REPLAY
+
+// Not cleared by a reset, read and written by tools/input_replay.py
+input_replay_t input_replay __attribute__((section (".ahb")));
+
+// Menu and power keys are handled before, and would only get in the way
+#define RECORDED_BUTTONS (~((1 << ODROID_INPUT_VOLUME) | (1 << ODROID_INPUT_POWER)) & 0xffff)
+
+static bool started;
+static bool done;
+static input_replay_mode_t mode;
+static uint32_t run;
+static uint32_t run_frame;
+
+void input_replay_set_mode(input_replay_mode_t mode)
+{
+    // Takes effect with the next game
+    input_replay.magic = INPUT_REPLAY_MAGIC;
+    input_replay.mode = mode;
+}
+
+input_replay_mode_t input_replay_get_mode(void)
+{
+    if (input_replay.magic != INPUT_REPLAY_MAGIC) {
+        return INPUT_REPLAY_OFF;
+    }
+    return input_replay.mode;
+}
+
+static uint16_t buttons_get(const odroid_gamepad_state_t *joystick)
+{
+    uint16_t buttons = 0;
+
+    for (int i = 0; i < ODROID_INPUT_MAX && i < 16; i++) {
+        if (joystick->values[i]) {
+            buttons |= 1 << i;
+        }
+    }
+    return buttons & RECORDED_BUTTONS;
+}
+
+static void buttons_set(odroid_gamepad_state_t *joystick, uint16_t buttons)
+{
+    for (int i = 0; i < ODROID_INPUT_MAX && i < 16; i++) {
+        if (RECORDED_BUTTONS & (1 << i)) {
+            joystick->values[i] = (buttons >> i) & 1;
+        }
+    }
+    joystick->bitmask = (joystick->bitmask & ~RECORDED_BUTTONS) | buttons;
+}
+
+static void record(const odroid_gamepad_state_t *joystick)
+{
+    uint16_t buttons = buttons_get(joystick);
+    uint32_t count = input_replay.count;
+
+    if (count > 0 && input_replay.runs[count - 1].buttons == buttons &&
+        input_replay.runs[count - 1].frames < UINT16_MAX) {
+        input_replay.runs[count - 1].frames++;
+    } else if (input_replay.count < INPUT_REPLAY_RUNS) {
+        input_replay.runs[input_replay.count++] = (input_replay_run_t) {buttons, 1};
+    } else {
+        done = true;
+        return;
+    }
+    input_replay.frames++;
+}
+
+static void play(odroid_gamepad_state_t *joystick)
+{
+    if (run >= input_replay.count) {
+        done = true;
+        return;
+    }
+
+    buttons_set(joystick, input_replay.runs[run].buttons);
+    if (++run_frame >= input_replay.runs[run].frames) {
+        run++;
+        run_frame = 0;
+    }
+}
+
+void input_replay_frame(odroid_gamepad_state_t *joystick)
+{
+    // The first frame of the game decides, see input_replay.h
+    if (!started) {
+        started = true;
+        mode = input_replay_get_mode();
+        if (mode == INPUT_REPLAY_RECORD) {
+            input_replay.count = 0;
+            input_replay.frames = 0;
+        }
+    }
+
+    if (done) {
+        return;
+    }
+
+    if (mode == INPUT_REPLAY_RECORD) {
+        record(joystick);
+    } else if (mode == INPUT_REPLAY_PLAY) {
+        play(joystick);
+    }
+}
+
+#endif
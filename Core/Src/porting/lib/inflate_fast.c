@@ -0,0 +1,535 @@
+#include <stdint.h>
+#include <string.h>
+
+#include "inflate_fast.h"
+
+#define LITLEN_MASK ((1U << INFLATE_LITLEN_BITS) - 1)
+#define DIST_MASK ((1U << INFLATE_DIST_BITS) - 1)
+#define MAX_BITS 15
+
+/* Output produced between two progress reports */
+#define PROGRESS_CHUNK (32 * 1024)
+
+/* Table entries: type, extra bits (or the length of the first of two
+literals), code length, then the literal(s) or the base of a length or
+distance in the low 16 bits */
+#define ENTRY(type, value, len, extra) \
+	(((uint32_t)(type) << 24) | ((uint32_t)(extra) << 20) | ((uint32_t)(len) << 16) | (uint32_t)(value))
+#define ENTRY_TYPE(e) ((e) >> 24)
+#define ENTRY_EXTRA(e) (((e) >> 20) & 0xf)
+#define ENTRY_LEN(e) (((e) >> 16) & 0xf)
+#define ENTRY_VALUE(e) ((e) & 0xffff)
+
+enum {
+	TYPE_SLOW,		/* longer than the table, decode bit by bit */
+	TYPE_LIT,
+	TYPE_LIT2,
+	TYPE_LEN,
+	TYPE_END,
+	TYPE_DIST,
+	TYPE_BAD,
+};
+
+enum {
+	CODES_LITLEN,
+	CODES_DIST,
+	CODES_LENGTHS,
+};
+
+static const uint16_t length_base[29] = {
+	3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+	35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+};
+static const uint8_t length_extra[29] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+	3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+};
+static const uint16_t dist_base[30] = {
+	1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+	257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577
+};
+static const uint8_t dist_extra[30] = {
+	0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+	7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+};
+static const uint8_t lengths_order[19] = {
+	16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15
+};
+
+typedef struct {
+	const uint8_t *in_start;
+	const uint8_t *in;
+	const uint8_t *in_end;
+	uint32_t bitbuf;
+	unsigned bitcnt;
+	unsigned overrun;		/* zero bytes put in past the end */
+	uint8_t *out_start;
+	uint8_t *out;
+	uint8_t *out_end;
+} state_t;
+
+static inline void
+refill(state_t *s)
+{
+	while (s->bitcnt <= 24)
+	{
+		uint32_t byte = 0;
+
+		if (s->in < s->in_end)
+			byte = *s->in++;
+		else
+			s->overrun++;
+		s->bitbuf |= byte << s->bitcnt;
+		s->bitcnt += 8;
+	}
+}
+
+static inline void
+consume(state_t *s, unsigned n)
+{
+	s->bitbuf >>= n;
+	s->bitcnt -= n;
+}
+
+/* n is at most 24 */
+static inline uint32_t
+bits(state_t *s, unsigned n)
+{
+	uint32_t v;
+
+	if (s->bitcnt < n)
+		refill(s);
+	v = s->bitbuf & ((1U << n) - 1);
+	consume(s, n);
+	return v;
+}
+
+static uint32_t
+symbol_entry(unsigned sym, unsigned len, int kind)
+{
+	if (kind == CODES_DIST)
+	{
+		if (sym >= 30)
+			return ENTRY(TYPE_BAD, 0, len, 0);
+		return ENTRY(TYPE_DIST, dist_base[sym], len, dist_extra[sym]);
+	}
+
+	if (sym < 256)
+		return ENTRY(TYPE_LIT, sym, len, 0);
+	if (sym == 256)
+		return ENTRY(TYPE_END, 0, len, 0);
+	if (sym < 286)
+		return ENTRY(TYPE_LEN, length_base[sym - 257], len, length_extra[sym - 257]);
+	return ENTRY(TYPE_BAD, 0, len, 0);
+}
+
+/* Canonical decoding a bit at a time, returns -1 for a code that isn't there */
+static int
+decode_slow(state_t *s, const inflate_huffman_t *h)
+{
+	int code = 0;
+	int first = 0;
+	int index = 0;
+
+	for (int len = 1; len <= MAX_BITS; len++)
+	{
+		int count = h->count[len];
+
+		code |= bits(s, 1);
+		if (code - count < first)
+			return h->symbol[index + (code - first)];
+		index += count;
+		first = (first + count) << 1;
+		code <<= 1;
+	}
+
+	return -1;
+}
+
+static unsigned
+reverse(unsigned code, unsigned len)
+{
+	unsigned rev = 0;
+
+	while (len-- > 0)
+	{
+		rev = (rev << 1) | (code & 1);
+		code >>= 1;
+	}
+	return rev;
+}
+
+/* Sorts the symbols for decode_slow() and fills the table, if any, with
+the codes that fit */
+static int
+build(inflate_huffman_t *h, uint32_t *table, unsigned table_bits,
+      const uint8_t *lengths, unsigned n, int kind)
+{
+	uint16_t offs[MAX_BITS + 1];
+	int left = 1;
+
+	memset(h->count, 0, sizeof(h->count));
+	for (unsigned sym = 0; sym < n; sym++)
+		h->count[lengths[sym]]++;
+	h->count[0] = 0;
+
+	for (unsigned len = 1; len <= MAX_BITS; len++)
+	{
+		left = (left << 1) - h->count[len];
+		if (left < 0)
+			return -1;
+	}
+
+	offs[1] = 0;
+	for (unsigned len = 1; len < MAX_BITS; len++)
+		offs[len + 1] = offs[len] + h->count[len];
+	for (unsigned sym = 0; sym < n; sym++)
+	{
+		if (lengths[sym] != 0)
+			h->symbol[offs[lengths[sym]]++] = sym;
+	}
+
+	if (table == NULL)
+		return 0;
+
+	/* Incomplete codes leave TYPE_SLOW entries, decode_slow() rejects them */
+	unsigned size = 1U << table_bits;
+	unsigned code = 0;
+	unsigned index = 0;
+
+	memset(table, 0, size * sizeof(*table));
+	for (unsigned len = 1; len <= table_bits; len++)
+	{
+		for (unsigned k = 0; k < h->count[len]; k++, code++)
+		{
+			uint32_t entry = symbol_entry(h->symbol[index++], len, kind);
+
+			for (unsigned i = reverse(code, len); i < size; i += 1U << len)
+				table[i] = entry;
+		}
+		code <<= 1;
+	}
+
+	if (kind != CODES_LITLEN)
+		return 0;
+
+	/* Two literals in one entry where both fit. The bits after the first
+	code index the entry of the second one, which comes before this one,
+	so the table can be rewritten from the end. */
+	for (unsigned i = size; i-- > 0;)
+	{
+		uint32_t first = table[i];
+		unsigned len1 = ENTRY_LEN(first);
+
+		if (ENTRY_TYPE(first) != TYPE_LIT || len1 >= table_bits)
+			continue;
+
+		uint32_t second = table[i >> len1];
+		unsigned len2 = ENTRY_LEN(second);
+
+		if (ENTRY_TYPE(second) == TYPE_LIT && len2 <= table_bits - len1)
+		{
+			table[i] = ENTRY(TYPE_LIT2, ENTRY_VALUE(first) | (ENTRY_VALUE(second) << 8),
+					 len1 + len2, len1);
+		}
+	}
+
+	return 0;
+}
+
+static int
+build_fixed(inflate_tables_t *t)
+{
+	uint8_t lengths[288];
+	unsigned i = 0;
+
+	for (; i < 144; i++)
+		lengths[i] = 8;
+	for (; i < 256; i++)
+		lengths[i] = 9;
+	for (; i < 280; i++)
+		lengths[i] = 7;
+	for (; i < 288; i++)
+		lengths[i] = 8;
+	if (build(&t->litlen_codes, t->litlen, INFLATE_LITLEN_BITS, lengths, 288, CODES_LITLEN) != 0)
+		return -1;
+
+	memset(lengths, 5, 30);
+	return build(&t->dist_codes, t->dist, INFLATE_DIST_BITS, lengths, 30, CODES_DIST);
+}
+
+static int
+build_dynamic(state_t *s, inflate_tables_t *t)
+{
+	uint8_t lengths[286 + 30];
+	unsigned hlit = bits(s, 5) + 257;
+	unsigned hdist = bits(s, 5) + 1;
+	unsigned hclen = bits(s, 4) + 4;
+	unsigned i;
+
+	if (hlit > 286 || hdist > 30)
+		return -1;
+
+	/* The code of the code lengths goes where the distance code goes next */
+	memset(lengths, 0, 19);
+	for (i = 0; i < hclen; i++)
+		lengths[lengths_order[i]] = bits(s, 3);
+	if (build(&t->dist_codes, NULL, 0, lengths, 19, CODES_LENGTHS) != 0)
+		return -1;
+
+	for (i = 0; i < hlit + hdist;)
+	{
+		int sym = decode_slow(s, &t->dist_codes);
+		unsigned value = 0;
+		unsigned repeat;
+
+		if (sym < 0)
+			return -1;
+		if (sym < 16)
+		{
+			lengths[i++] = sym;
+			continue;
+		}
+
+		if (sym == 16)
+		{
+			if (i == 0)
+				return -1;
+			value = lengths[i - 1];
+			repeat = 3 + bits(s, 2);
+		}
+		else if (sym == 17)
+		{
+			repeat = 3 + bits(s, 3);
+		}
+		else
+		{
+			repeat = 11 + bits(s, 7);
+		}
+
+		if (i + repeat > hlit + hdist)
+			return -1;
+		memset(&lengths[i], value, repeat);
+		i += repeat;
+	}
+
+	/* Without an end of block code the block never ends */
+	if (lengths[256] == 0)
+		return -1;
+
+	if (build(&t->litlen_codes, t->litlen, INFLATE_LITLEN_BITS, lengths, hlit, CODES_LITLEN) != 0)
+		return -1;
+	return build(&t->dist_codes, t->dist, INFLATE_DIST_BITS, &lengths[hlit], hdist, CODES_DIST);
+}
+
+static inline uint32_t
+load32(const uint8_t *p)
+{
+	uint32_t v;
+
+	memcpy(&v, p, sizeof(v));
+	return v;
+}
+
+static inline void
+store32(uint8_t *p, uint32_t v)
+{
+	memcpy(p, &v, sizeof(v));
+}
+
+static inline void
+copy_match(uint8_t *dst, const uint8_t *dst_end, unsigned dist, unsigned len)
+{
+	const uint8_t *match = dst - dist;
+
+	if (dist == 1)
+	{
+		memset(dst, match[0], len);
+	}
+	else if (dist >= 8 && (size_t)(dst_end - dst) >= len + 8)
+	{
+		/* Wild copy, up to 7 bytes past the match are overwritten later */
+		uint8_t *end = dst + len;
+
+		do
+		{
+			uint32_t a = load32(match);
+			uint32_t b = load32(match + 4);
+
+			store32(dst, a);
+			store32(dst + 4, b);
+			dst += 8;
+			match += 8;
+		} while (dst < end);
+	}
+	else if (dist >= 4)
+	{
+		/* Each word was written before it's read */
+		for (; len >= 4; len -= 4, dst += 4, match += 4)
+			store32(dst, load32(match));
+		while (len-- > 0)
+			*dst++ = *match++;
+	}
+	else
+	{
+		while (len-- > 0)
+			*dst++ = *match++;
+	}
+}
+
+static int
+inflate_block(state_t *s, inflate_tables_t *t, inflate_progress_t progress, size_t src_size)
+{
+	uint8_t *report = s->out + PROGRESS_CHUNK;
+
+	for (;;)
+	{
+		uint32_t entry;
+
+		refill(s);
+		entry = t->litlen[s->bitbuf & LITLEN_MASK];
+		if (ENTRY_TYPE(entry) == TYPE_SLOW)
+		{
+			int sym = decode_slow(s, &t->litlen_codes);
+
+			if (sym < 0)
+				return -1;
+			entry = symbol_entry(sym, 0, CODES_LITLEN);
+			refill(s);
+		}
+		consume(s, ENTRY_LEN(entry));
+
+		switch (ENTRY_TYPE(entry))
+		{
+		case TYPE_LIT:
+			if (s->out == s->out_end)
+				return -1;
+			*s->out++ = ENTRY_VALUE(entry);
+			continue;
+
+		case TYPE_LIT2:
+			if (s->out_end - s->out < 2)
+				return -1;
+			s->out[0] = entry;
+			s->out[1] = entry >> 8;
+			s->out += 2;
+			continue;
+
+		case TYPE_END:
+			return 0;
+
+		case TYPE_LEN:
+			break;
+
+		default:
+			return -1;
+		}
+
+		unsigned len = ENTRY_VALUE(entry) + bits(s, ENTRY_EXTRA(entry));
+
+		refill(s);
+		entry = t->dist[s->bitbuf & DIST_MASK];
+		if (ENTRY_TYPE(entry) == TYPE_SLOW)
+		{
+			int sym = decode_slow(s, &t->dist_codes);
+
+			if (sym < 0)
+				return -1;
+			entry = symbol_entry(sym, 0, CODES_DIST);
+		}
+		consume(s, ENTRY_LEN(entry));
+		if (ENTRY_TYPE(entry) != TYPE_DIST)
+			return -1;
+
+		unsigned dist = ENTRY_VALUE(entry) + bits(s, ENTRY_EXTRA(entry));
+
+		if (dist > (size_t)(s->out - s->out_start) || len > (size_t)(s->out_end - s->out))
+			return -1;
+		copy_match(s->out, s->out_end, dist, len);
+		s->out += len;
+
+		if (progress && s->out >= report)
+		{
+			progress(s->in - s->in_start, src_size);
+			report = s->out + PROGRESS_CHUNK;
+		}
+	}
+}
+
+static int
+inflate_stored(state_t *s)
+{
+	unsigned len;
+	unsigned nlen;
+
+	consume(s, s->bitcnt & 7);
+	len = bits(s, 16);
+	nlen = bits(s, 16);
+	if ((len ^ 0xffff) != nlen || (s->bitcnt >> 3) < s->overrun)
+		return -1;
+
+	/* Give the whole bytes of the bit buffer back, but the zeros */
+	s->in -= (s->bitcnt >> 3) - s->overrun;
+	s->overrun = 0;
+	s->bitbuf = 0;
+	s->bitcnt = 0;
+
+	if (len > (size_t)(s->in_end - s->in) || len > (size_t)(s->out_end - s->out))
+		return -1;
+	memcpy(s->out, s->in, len);
+	s->in += len;
+	s->out += len;
+	return 0;
+}
+
+size_t
+inflate_fast(uint8_t *dst, size_t dst_size, const uint8_t *src, size_t src_size,
+	     inflate_tables_t *tables, inflate_progress_t progress)
+{
+	state_t s = {
+		.in_start = src,
+		.in = src,
+		.in_end = src + src_size,
+		.out_start = dst,
+		.out = dst,
+		.out_end = dst + dst_size,
+	};
+	unsigned last;
+
+	do
+	{
+		int status;
+
+		last = bits(&s, 1);
+		switch (bits(&s, 2))
+		{
+		case 0:
+			status = inflate_stored(&s);
+			break;
+		case 1:
+			status = build_fixed(tables);
+			if (status == 0)
+				status = inflate_block(&s, tables, progress, src_size);
+			break;
+		case 2:
+			status = build_dynamic(&s, tables);
+			if (status == 0)
+				status = inflate_block(&s, tables, progress, src_size);
+			break;
+		default:
+			status = -1;
+			break;
+		}
+
+		if (status != 0)
+			return 0;
+		if (progress)
+			progress(s.in - src, src_size);
+	} while (!last);
+
+	/* The zeros put in past the end weren't all in the stream */
+	if (s.overrun * 8 > s.bitcnt)
+		return 0;
+
+	return s.out - dst;
+}
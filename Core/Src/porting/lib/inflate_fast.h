@@ -0,0 +1,50 @@
+#ifndef DEF_INFLATE_FAST
+#define DEF_INFLATE_FAST
+
+#include <stddef.h>
+#include <stdint.h>
+
+// https://www.rfc-editor.org/rfc/rfc1951
+
+/* Raw DEFLATE decoder for data that is in memory as a whole, like the
+zopfli compressed ROMs. Faster than tinfl for the price of a few kB of
+tables, which the caller provides so they can be put in DTCM:
+ - the literal/length codes are looked up INFLATE_LITLEN_BITS at a time,
+   and an entry holds two literals when both codes fit in these bits
+ - lengths and distances come out of the table with their base and their
+   count of extra bits
+ - matches are copied by words, or filled for a distance of 1
+Longer codes are decoded bit by bit, they're rare.
+*/
+
+#define INFLATE_LITLEN_BITS 10
+#define INFLATE_DIST_BITS 8
+
+typedef struct {
+	uint16_t count[16];		/* codes of each length */
+	uint16_t symbol[288];		/* in canonical order */
+} inflate_huffman_t;
+
+typedef struct {
+	uint32_t litlen[1 << INFLATE_LITLEN_BITS];
+	uint32_t dist[1 << INFLATE_DIST_BITS];
+	inflate_huffman_t litlen_codes;
+	inflate_huffman_t dist_codes;
+} inflate_tables_t;
+
+/* Called once in a while with the bytes of input consumed so far */
+typedef void (*inflate_progress_t)(uint32_t done, uint32_t total);
+
+/* DEFLATE uncompress function
+*dst 		: pointer on destination buffer
+dst_size 	: size of the destination buffer
+*src 		: raw DEFLATE stream, without a zlib header
+src_size 	: size of the stream
+*tables 	: room for the decoding tables
+progress 	: may be NULL
+return the size of the uncompressed data, 0 if it's corrupt or doesn't fit
+ */
+size_t inflate_fast(uint8_t *dst, size_t dst_size, const uint8_t *src, size_t src_size,
+		    inflate_tables_t *tables, inflate_progress_t progress);
+
+#endif /* DEF_INFLATE_FAST */
@@ -1,13 +1,99 @@
 
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
 #include "lz4_depack.h"
 /*  original source code of lz4_depack() came from:
 https://github.com/jibsen/blz4/blob/master/lz4_depack.c
-please read the joined notice. This source is not altered.
+please read the joined notice. Altered: the literals and matches are
+copied with the word copies below instead of byte by byte.
 */
 
+/*
+Copies for the Cortex-M7, which loads and stores unaligned words in one go.
+Going forward is also right when dst is before src, like when decoding in
+place. Wild copies go by 8 bytes and write up to LZ4_WILD_COPY - 1 bytes
+past the end, they are only used when there's room for it.
+*/
+
+#define LZ4_WILD_COPY 8
+
+static inline uint32_t
+lz4_load32(const unsigned char *p)
+{
+	uint32_t v;
+
+	memcpy(&v, p, sizeof(v));
+	return v;
+}
+
+static inline void
+lz4_store32(unsigned char *p, uint32_t v)
+{
+	memcpy(p, &v, sizeof(v));
+}
+
+static inline void
+lz4_copy8(unsigned char *dst, const unsigned char *src)
+{
+	uint32_t a = lz4_load32(src);
+	uint32_t b = lz4_load32(src + 4);
+
+	lz4_store32(dst, a);
+	lz4_store32(dst + 4, b);
+}
+
+static inline void
+lz4_copy_forward(unsigned char *dst, const unsigned char *src, unsigned long len)
+{
+	for (; len >= 4; len -= 4, dst += 4, src += 4)
+	{
+		lz4_store32(dst, lz4_load32(src));
+	}
+	while (len-- > 0)
+	{
+		*dst++ = *src++;
+	}
+}
+
+static inline void
+lz4_copy_wild(unsigned char *dst, const unsigned char *src, unsigned long len)
+{
+	unsigned char *end = dst + len;
+
+	do
+	{
+		lz4_copy8(dst, src);
+		dst += 8;
+		src += 8;
+	} while (dst < end);
+}
+
+/* The match starts offs bytes before dst and may overlap it */
+static inline void
+lz4_copy_match(unsigned char *dst, unsigned long offs, unsigned long len, int wild)
+{
+	const unsigned char *match = dst - offs;
+
+	if (offs >= 8 && wild)
+	{
+		lz4_copy_wild(dst, match, len);
+	}
+	else if (offs >= 4)
+	{
+		/* Each word was written before it's read */
+		lz4_copy_forward(dst, match, len);
+	}
+	else
+	{
+		while (len-- > 0)
+		{
+			*dst++ = *match++;
+		}
+	}
+}
+
 
 /*********************************/
 /*
@@ -58,7 +144,6 @@ lz4_depack(const void *src, void *dst, unsigned long packed_size)
 		unsigned long lit_len = token >> 4;
 		unsigned long len = (token & 0x0F) + 4;
 		unsigned long offs;
-		unsigned long i;
 
 		/* Read extra literal length bytes */
 		if (lit_len == 15)
@@ -72,10 +157,9 @@ lz4_depack(const void *src, void *dst, unsigned long packed_size)
 		}
 
 		/* Copy literals */
-		for (i = 0; i < lit_len; ++i)
-		{
-			out[dst_size++] = in[cur++];
-		}
+		lz4_copy_forward(&out[dst_size], &in[cur], lit_len);
+		dst_size += lit_len;
+		cur += lit_len;
 
 		/* Check for last incomplete sequence */
 		if (cur == packed_size)
@@ -112,11 +196,8 @@ lz4_depack(const void *src, void *dst, unsigned long packed_size)
 		prev_match_start = dst_size;
 
 		/* Copy match */
-		for (i = 0; i < len; ++i)
-		{
-			out[dst_size] = out[dst_size - offs];
-			++dst_size;
-		}
+		lz4_copy_match(&out[dst_size], offs, len, 0);
+		dst_size += len;
 	}
 
 	/* Return decompressed size */
@@ -224,3 +305,225 @@ lz4_get_original_size(const void *src)
 
 	return original_size;
 }
+
+
+/*********************************/
+
+static unsigned long
+lz4_read_le32(const unsigned char *p)
+{
+	return (unsigned long)p[0] | ((unsigned long)p[1] << 8) |
+	       ((unsigned long)p[2] << 16) | ((unsigned long)p[3] << 24);
+}
+
+int
+lz4_stream_init(lz4_stream_t *s, const void *src, void *dst, unsigned long dst_size)
+{
+	const unsigned char *in = (const unsigned char *)src;
+
+	memset(s, 0, sizeof(*s));
+	s->in = in;
+	s->out = (unsigned char *)dst;
+	s->out_size = dst_size;
+
+	if (memcmp(&in[0], LZ4_MAGIC, LZ4_MAGIC_SIZE) != 0)
+	{
+		s->status = LZ4_STREAM_ERROR;
+		return s->status;
+	}
+
+	/* Input that isn't decoded yet mustn't be overwritten by wild copies */
+	if (in > s->out && in < s->out + dst_size)
+	{
+		s->in_place = in - s->out;
+	}
+
+	s->flags = in[LZ4_FLG_OFFSET];
+	s->in_pos = LZ4_MAGIC_SIZE + LZ4_FLG_SIZE + LZ4_BD_SIZE;
+
+	if ((s->flags & LZ4_FLG_MASK_C_SIZE) != 0)
+	{
+		/* 64 bits, anything above 4GB doesn't fit anyway */
+		s->original_size = lz4_read_le32(&in[s->in_pos]);
+		s->in_pos += LZ4_CONTENT_SIZE;
+	}
+
+	if ((s->flags & LZ4_FLG_MASK_DICTID) != 0)
+	{
+		s->in_pos += LZ4_DICTID_SIZE;
+	}
+
+	s->in_pos += LZ4_HC_SIZE;
+	s->status = LZ4_STREAM_MORE;
+
+	return s->status;
+}
+
+/* Start the next block, or finish at the end mark */
+static int
+lz4_stream_next_block(lz4_stream_t *s)
+{
+	unsigned long block_size = lz4_read_le32(&s->in[s->in_pos]);
+
+	s->in_pos += LZ4_FRAME_SIZE;
+
+	if (block_size == 0)
+	{
+		if (s->original_size != 0 && s->out_pos != s->original_size)
+		{
+			return LZ4_STREAM_ERROR;
+		}
+		return LZ4_STREAM_DONE;
+	}
+
+	s->raw = (block_size & LZ4_BLOCK_UNCOMPRESSED) != 0;
+	s->block_end = s->in_pos + (block_size & ~LZ4_BLOCK_UNCOMPRESSED);
+
+	return LZ4_STREAM_MORE;
+}
+
+/* The current block is done, skip its checksum */
+static void
+lz4_stream_end_block(lz4_stream_t *s)
+{
+	s->in_pos = s->block_end;
+	s->block_end = 0;
+
+	if ((s->flags & LZ4_FLG_MASK_B_CHECKSUM) != 0)
+	{
+		s->in_pos += LZ4_CHECKSUM_SIZE;
+	}
+}
+
+/* How far out may be written, for the wild copies of the sequence before cur */
+static inline unsigned long
+lz4_stream_room(const lz4_stream_t *s, unsigned long cur)
+{
+	if (s->in_place != 0 && s->in_place + cur < s->out_size)
+	{
+		return s->in_place + cur;
+	}
+	return s->out_size;
+}
+
+/* Stays in the internal flash: the flashapp decodes its chunks with it
+   while the external flash, where ITCM is loaded from, is being written */
+int
+lz4_stream_run(lz4_stream_t *s, unsigned long max_out)
+{
+	const unsigned char *in = s->in;
+	unsigned char *out = s->out;
+	unsigned long limit = s->out_pos + max_out;
+
+	if (s->status != LZ4_STREAM_MORE)
+	{
+		return s->status;
+	}
+
+	do
+	{
+		if (s->block_end == 0)
+		{
+			s->status = lz4_stream_next_block(s);
+			if (s->status != LZ4_STREAM_MORE)
+			{
+				return s->status;
+			}
+		}
+
+		if (s->raw)
+		{
+			unsigned long len = s->block_end - s->in_pos;
+
+			if (len > max_out)
+			{
+				len = max_out;
+			}
+			if (s->out_pos + len > s->out_size)
+			{
+				s->status = LZ4_STREAM_ERROR;
+				return s->status;
+			}
+
+			memmove(&out[s->out_pos], &in[s->in_pos], len);
+			s->out_pos += len;
+			s->in_pos += len;
+
+			if (s->in_pos == s->block_end)
+			{
+				lz4_stream_end_block(s);
+			}
+			continue;
+		}
+
+		/* One sequence, same as lz4_depack() */
+		unsigned long cur = s->in_pos;
+		unsigned long token = in[cur++];
+		unsigned long lit_len = token >> 4;
+		unsigned long len = (token & 0x0F) + 4;
+		unsigned long offs;
+
+		if (lit_len == 15)
+		{
+			while (in[cur] == 255)
+			{
+				lit_len += 255;
+				++cur;
+			}
+			lit_len += in[cur++];
+		}
+
+		if (s->out_pos + lit_len > s->out_size || cur + lit_len > s->block_end)
+		{
+			s->status = LZ4_STREAM_ERROR;
+			return s->status;
+		}
+
+		/* The wild copy reads past the literals, not past the block */
+		if (cur + lit_len + LZ4_WILD_COPY <= s->block_end &&
+		    s->out_pos + lit_len + LZ4_WILD_COPY <= lz4_stream_room(s, cur))
+		{
+			lz4_copy_wild(&out[s->out_pos], &in[cur], lit_len);
+		}
+		else
+		{
+			lz4_copy_forward(&out[s->out_pos], &in[cur], lit_len);
+		}
+		s->out_pos += lit_len;
+		cur += lit_len;
+
+		/* Last sequence of the block has no match */
+		if (cur == s->block_end)
+		{
+			s->in_pos = cur;
+			lz4_stream_end_block(s);
+			continue;
+		}
+
+		offs = (unsigned long)in[cur] | ((unsigned long)in[cur + 1] << 8);
+		cur += 2;
+
+		if (len == 19)
+		{
+			while (in[cur] == 255)
+			{
+				len += 255;
+				++cur;
+			}
+			len += in[cur++];
+		}
+
+		if (offs == 0 || offs > s->out_pos || s->out_pos + len > s->out_size)
+		{
+			s->status = LZ4_STREAM_ERROR;
+			return s->status;
+		}
+
+		lz4_copy_match(&out[s->out_pos], offs, len,
+		               s->out_pos + len + LZ4_WILD_COPY <= lz4_stream_room(s, cur));
+		s->out_pos += len;
+		s->in_pos = cur;
+	} while (s->out_pos < limit);
+
+	return s->status;
+}
@@ -72,4 +72,49 @@ return 0 if it's not a LZ4 file format by checking LZ4_MAGIC NUMBER.
  */
 unsigned long lz4_depack(const void *src, void *dst, unsigned long packed_size);
 
+/* Resumable LZ4 frame decoder
+
+Decodes a frame block by block, and within a block a bounded amount of
+output at a time, so the caller can refresh the watchdog and show progress
+in between. Blocks must be independent (no linked blocks). The output
+buffer is never wrapped: everything up to out_pos is decoded and final,
+lz4_stream_init() doesn't need to be called again to resume.
+The frame may be decoded in place if it is stored at the end of dst, with
+(compressed size / 256) + 64 bytes more room than the decoded data needs.
+*/
+
+#define LZ4_BLOCK_UNCOMPRESSED 0x80000000U
+
+#define LZ4_STREAM_ERROR -1
+#define LZ4_STREAM_MORE 0
+#define LZ4_STREAM_DONE 1
+
+typedef struct {
+	const unsigned char *in;	/* LZ4 frame */
+	unsigned char *out;
+	unsigned long out_size;		/* size of the output buffer */
+	unsigned long out_pos;		/* bytes decoded so far */
+	unsigned long in_pos;		/* current position in the frame */
+	unsigned long block_end;	/* end of the current block, 0 between blocks */
+	unsigned long original_size;	/* from the header, 0 if it isn't there */
+	unsigned long in_place;		/* in - out when in is inside out, 0 otherwise */
+	unsigned char flags;
+	unsigned char raw;		/* current block is stored uncompressed */
+	int status;
+} lz4_stream_t;
+
+/* Parse the frame header
+*src 		: pointer on source buffer (LZ4 file format)
+*dst 		: pointer on destination buffer
+dst_size 	: size of destination buffer
+return LZ4_STREAM_MORE, or LZ4_STREAM_ERROR if it's not a LZ4 frame
+ */
+int lz4_stream_init(lz4_stream_t *s, const void *src, void *dst, unsigned long dst_size);
+
+/* Decode about max_out more bytes (at least one sequence)
+return LZ4_STREAM_MORE until the end mark is reached, then LZ4_STREAM_DONE,
+or LZ4_STREAM_ERROR if the frame is corrupt or doesn't fit into dst
+ */
+int lz4_stream_run(lz4_stream_t *s, unsigned long max_out);
+
 #endif /* DEF_LZ4DEPACK */
\ No newline at end of file
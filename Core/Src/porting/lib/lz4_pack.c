@@ -0,0 +1,206 @@
+#include <stdint.h>
+#include <string.h>
+
+#include "lz4_pack.h"
+
+/* A match can't start in the last 12 bytes, the last 5 are always literals */
+#define LZ4_MFLIMIT 12
+#define LZ4_LASTLITERALS 5
+#define LZ4_MINMATCH 4
+#define LZ4_MAX_OFFSET 65535
+
+/* Search less often the longer nothing is found, like LZ4_compress_fast() */
+#define LZ4_SKIP_TRIGGER 6
+
+static uint32_t
+lz4_read32(const unsigned char *p)
+{
+	uint32_t v;
+
+	memcpy(&v, p, sizeof(v));
+	return v;
+}
+
+static uint32_t
+lz4_hash(uint32_t v)
+{
+	return (v * 2654435761U) >> (32 - LZ4_PACK_HASH_LOG);
+}
+
+/* The 255, 255, ..., rest tail of a literal or match length */
+static size_t
+lz4_write_length(size_t len, lz4_pack_write_t write, void *ctx)
+{
+	unsigned char buf[16];
+	size_t n = 0;
+	size_t total = 0;
+
+	while (len >= 255)
+	{
+		buf[n++] = 255;
+		len -= 255;
+		if (n == sizeof(buf))
+		{
+			write(ctx, buf, n);
+			total += n;
+			n = 0;
+		}
+	}
+	buf[n++] = (unsigned char)len;
+	write(ctx, buf, n);
+
+	return total + n;
+}
+
+/* One sequence, the last one of a block has no match (match_len 0) */
+static size_t
+lz4_write_sequence(const unsigned char *literals, size_t lit_len,
+                   size_t offset, size_t match_len,
+                   lz4_pack_write_t write, void *ctx)
+{
+	size_t ml = match_len ? match_len - LZ4_MINMATCH : 0;
+	unsigned char token = (unsigned char)(((lit_len >= 15 ? 15 : lit_len) << 4) |
+	                                      (ml >= 15 ? 15 : ml));
+	size_t total = 1;
+
+	write(ctx, &token, 1);
+	if (lit_len >= 15)
+		total += lz4_write_length(lit_len - 15, write, ctx);
+
+	if (lit_len)
+		write(ctx, literals, lit_len);
+	total += lit_len;
+
+	if (match_len)
+	{
+		unsigned char le16[2] = {(unsigned char)offset, (unsigned char)(offset >> 8)};
+
+		write(ctx, le16, 2);
+		total += 2;
+		if (ml >= 15)
+			total += lz4_write_length(ml - 15, write, ctx);
+	}
+
+	return total;
+}
+
+size_t
+lz4_block_pack(const void *src, size_t size, lz4_pack_write_t write, void *ctx)
+{
+	const unsigned char *in = (const unsigned char *)src;
+	uint32_t table[1 << LZ4_PACK_HASH_LOG];
+	size_t anchor = 0;
+	size_t ip = 0;
+	size_t total = 0;
+	unsigned misses = 0;
+
+	memset(table, 0, sizeof(table));
+
+	while (size >= LZ4_MFLIMIT + 1 && ip < size - LZ4_MFLIMIT)
+	{
+		uint32_t seq = lz4_read32(&in[ip]);
+		uint32_t h = lz4_hash(seq);
+		size_t ref = table[h];
+
+		table[h] = ip;
+
+		if (ref >= ip || ip - ref > LZ4_MAX_OFFSET || lz4_read32(&in[ref]) != seq)
+		{
+			ip += 1 + (misses++ >> LZ4_SKIP_TRIGGER);
+			continue;
+		}
+		misses = 0;
+
+		/* Grow the match backwards into the pending literals */
+		while (ip > anchor && ref > 0 && in[ip - 1] == in[ref - 1])
+		{
+			ip--;
+			ref--;
+		}
+
+		size_t len = LZ4_MINMATCH;
+		while (ip + len < size - LZ4_LASTLITERALS && in[ip + len] == in[ref + len])
+			len++;
+
+		total += lz4_write_sequence(&in[anchor], ip - anchor, ip - ref, len, write, ctx);
+
+		ip += len;
+		anchor = ip;
+	}
+
+	total += lz4_write_sequence(&in[anchor], size - anchor, 0, 0, write, ctx);
+
+	return total;
+}
+
+size_t
+lz4_block_unpack(const void *src, size_t src_size, void *dst, size_t dst_size)
+{
+	const unsigned char *in = (const unsigned char *)src;
+	const unsigned char *in_end = in + src_size;
+	unsigned char *out = (unsigned char *)dst;
+	size_t pos = 0;
+
+	while (pos < dst_size)
+	{
+		if (in >= in_end)
+			return 0;
+
+		unsigned token = *in++;
+		size_t len = token >> 4;
+
+		if (len == 15)
+		{
+			unsigned char b;
+			do
+			{
+				if (in >= in_end)
+					return 0;
+				b = *in++;
+				len += b;
+			} while (b == 255);
+		}
+
+		if (len > (size_t)(in_end - in) || len > dst_size - pos)
+			return 0;
+		memcpy(&out[pos], in, len);
+		in += len;
+		pos += len;
+
+		/* The last sequence has no match */
+		if (pos == dst_size)
+			break;
+
+		if (in_end - in < 2)
+			return 0;
+		size_t offset = in[0] | (in[1] << 8);
+		in += 2;
+		if (offset == 0 || offset > pos)
+			return 0;
+
+		len = (token & 15);
+		if (len == 15)
+		{
+			unsigned char b;
+			do
+			{
+				if (in >= in_end)
+					return 0;
+				b = *in++;
+				len += b;
+			} while (b == 255);
+		}
+		len += LZ4_MINMATCH;
+
+		if (len > dst_size - pos)
+			return 0;
+
+		/* Byte by byte, the match may overlap what it copies */
+		const unsigned char *ref = &out[pos - offset];
+		for (size_t i = 0; i < len; i++)
+			out[pos + i] = ref[i];
+		pos += len;
+	}
+
+	return pos;
+}
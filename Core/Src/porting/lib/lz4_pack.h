@@ -0,0 +1,43 @@
+#ifndef DEF_LZ4PACK
+#define DEF_LZ4PACK
+
+#include <stddef.h>
+
+// https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md
+
+/* Greedy single-pass LZ4 block compressor, in the spirit of the 'fast' mode
+of the reference implementation. Meant for data that is packed on the device,
+e.g. save states, where speed matters more than ratio.
+
+The output is a raw LZ4 block without a frame around it, so the size of the
+original data has to be stored next to it for lz4_block_unpack().
+*/
+
+/* Hash table entries, the table is on the stack (4 bytes per entry) */
+#define LZ4_PACK_HASH_LOG 11
+
+/* Worst case size of the compressed block */
+#define LZ4_PACK_BOUND(size) ((size) + (size) / 255 + 16)
+
+/* Called with consecutive pieces of the compressed block */
+typedef void (*lz4_pack_write_t)(void *ctx, const unsigned char *data, size_t size);
+
+/* LZ4 block compress function
+*src 		: data to compress
+size 		: size of the data
+write 		: output callback
+*ctx 		: passed to write
+return the size of the compressed block
+ */
+size_t lz4_block_pack(const void *src, size_t size, lz4_pack_write_t write, void *ctx);
+
+/* LZ4 block uncompress function
+*src 		: raw LZ4 block
+src_size 	: size of the block, or an upper bound for it
+*dst 		: pointer on destination buffer
+dst_size 	: exact size of the original data
+return dst_size, or 0 if the block is corrupt
+ */
+size_t lz4_block_unpack(const void *src, size_t src_size, void *dst, size_t dst_size);
+
+#endif /* DEF_LZ4PACK */
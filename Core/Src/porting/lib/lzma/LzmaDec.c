@@ -215,15 +215,26 @@ int MY_FAST_CALL LZMA_DECODE_REAL(CLzmaDec *p, SizeT limit, const Byte *bufLimit
 
 #else
 
+/* The whole ROM is decoded in one call, so this runs from ITCM and is
+   optimized even in -Og builds. */
 static
+__attribute__((optimize("O2")))
+__attribute__((section (".itcram_hot_text")))
 int MY_FAST_CALL LZMA_DECODE_REAL(CLzmaDec *p, SizeT limit, const Byte *bufLimit)
 {
   CLzmaProb *probs = GET_PROBS;
   unsigned state = (unsigned)p->state;
   UInt32 rep0 = p->reps[0], rep1 = p->reps[1], rep2 = p->reps[2], rep3 = p->reps[3];
+#ifdef LZMA_FIXED_LC
+  const unsigned pbMask = ((unsigned)1 << LZMA_FIXED_PB) - 1;
+  const unsigned lc = LZMA_FIXED_LC;
+  const unsigned lpMask = ((unsigned)0x100 << LZMA_FIXED_LP) - ((unsigned)0x100 >> lc);
+#else
   unsigned pbMask = ((unsigned)1 << (p->prop.pb)) - 1;
   unsigned lc = p->prop.lc;
   unsigned lpMask = ((unsigned)0x100 << p->prop.lp) - ((unsigned)0x100 >> lc);
+#endif
+  unsigned wdog_symbols = 0;
 
   Byte *dic = p->dic;
   SizeT dicBufSize = p->dicBufSize;
@@ -244,7 +255,9 @@ int MY_FAST_CALL LZMA_DECODE_REAL(CLzmaDec *p, SizeT limit, const Byte *bufLimit
     unsigned ttt;
     unsigned posState = CALC_POS_STATE(processedPos, pbMask);
 
-    wdog_refresh();
+    // A few thousand symbols take well below a millisecond
+    if ((++wdog_symbols & 0xfff) == 0)
+      wdog_refresh();
 
     prob = probs + IsMatch + COMBINED_PS_STATE;
     IF_BIT_0(prob)
@@ -1103,6 +1116,11 @@ SRes LzmaProps_Decode(CLzmaProps *p, const Byte *data, unsigned size)
   p->pb = (Byte)(d / 5);
   p->lp = (Byte)(d % 5);
 
+#ifdef LZMA_FIXED_LC
+  if (p->lc != LZMA_FIXED_LC || p->lp != LZMA_FIXED_LP || p->pb != LZMA_FIXED_PB)
+    return SZ_ERROR_UNSUPPORTED;
+#endif
+
   return SZ_OK;
 }
 
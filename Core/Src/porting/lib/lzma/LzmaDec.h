@@ -25,6 +25,14 @@ typedef
 
 #define LZMA_PROPS_SIZE 5
 
+/* All ROMs are packed with the same lc/lp/pb, see compress_lzma() in
+   parse_roms.py. Fixing them lets the compiler fold the literal context
+   shifts and masks into the decoder loop. Other properties are rejected
+   by LzmaProps_Decode(). */
+#define LZMA_FIXED_LC 3
+#define LZMA_FIXED_LP 0
+#define LZMA_FIXED_PB 2
+
 typedef struct _CLzmaProps
 {
   Byte lc;
@@ -10,7 +10,10 @@ static void *SzAlloc(ISzAllocPtr p, size_t size) {
 static void SzFree(ISzAllocPtr p, void *address) {
 }
 
-const uint8_t lzma_prop_data[5] = {0x5d, 0x00, 0x40, 0x00, 0x00};
+// (pb * 5 + lp) * 9 + lc, then the 16kB dictionary size
+const uint8_t lzma_prop_data[5] = {
+    (LZMA_FIXED_PB * 5 + LZMA_FIXED_LP) * 9 + LZMA_FIXED_LC, 0x00, 0x40, 0x00, 0x00
+};
 
 void lzma_init_allocs(ISzAlloc *allocs, uint8_t *heap){
     allocs->Alloc = SzAlloc;
@@ -19,6 +22,7 @@ void lzma_init_allocs(ISzAlloc *allocs, uint8_t *heap){
 }
 
 size_t lzma_inflate(uint8_t *dst, size_t dst_size, const uint8_t *src, size_t src_size){
+    // The probabilities are on the stack, which is in DTCM
     unsigned char lzma_heap[LZMA_BUF_SIZE];
     ISzAlloc allocs;
     lzma_init_allocs(&allocs, lzma_heap);
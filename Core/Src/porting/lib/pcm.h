@@ -0,0 +1,124 @@
+#ifndef _PCM_H_
+#define _PCM_H_
+
+#include <stdint.h>
+#include <string.h>
+
+/*
+ * Kernels for the audio path, working on two int16 samples packed into one
+ * 32-bit word (first sample in the low half). With the DSP extension every
+ * step is a single saturating SIMD instruction, plain C is used when it
+ * isn't available, e.g. for the linux/ build.
+ *
+ * Buffers only need 2-byte alignment, except for memory that isn't normal
+ * memory (audiobuffer_dma is strongly-ordered), which needs 4-byte alignment
+ * when accessed through pcm_load2() and pcm_store2().
+ */
+
+#if defined(__ARM_FEATURE_DSP) && __ARM_FEATURE_DSP
+#include "cmsis_compiler.h"
+#endif
+
+// Unity gain for pcm_scale2(), in 16.16
+#define PCM_GAIN_ONE 0x10000
+
+static inline uint32_t pcm_load2(const int16_t *p)
+{
+    uint32_t pair;
+    memcpy(&pair, p, sizeof(pair));
+    return pair;
+}
+
+static inline void pcm_store2(int16_t *p, uint32_t pair)
+{
+    memcpy(p, &pair, sizeof(pair));
+}
+
+// Both samples times gain, saturated
+static inline uint32_t pcm_scale2(uint32_t pair, int32_t gain)
+{
+#if defined(__ARM_FEATURE_DSP) && __ARM_FEATURE_DSP
+    int32_t lo;
+    int32_t hi;
+
+    __ASM ("smulwb %0, %1, %2" : "=r" (lo) : "r" (gain), "r" (pair));
+    __ASM ("smulwt %0, %1, %2" : "=r" (hi) : "r" (gain), "r" (pair));
+
+    return __PKHBT(__SSAT(lo, 16), (uint32_t) __SSAT(hi, 16), 16);
+#else
+    int32_t lo = ((int64_t) gain * (int16_t) pair) >> 16;
+    int32_t hi = ((int64_t) gain * (int16_t) (pair >> 16)) >> 16;
+
+    lo = (lo > INT16_MAX) ? INT16_MAX : (lo < INT16_MIN) ? INT16_MIN : lo;
+    hi = (hi > INT16_MAX) ? INT16_MAX : (hi < INT16_MIN) ? INT16_MIN : hi;
+
+    return (uint16_t) lo | ((uint32_t) hi << 16);
+#endif
+}
+
+// Saturating sum of two pairs, e.g. the left and right channel
+static inline uint32_t pcm_add2(uint32_t a, uint32_t b)
+{
+#if defined(__ARM_FEATURE_DSP) && __ARM_FEATURE_DSP
+    return __QADD16(a, b);
+#else
+    int32_t lo = (int16_t) a + (int16_t) b;
+    int32_t hi = (int16_t) (a >> 16) + (int16_t) (b >> 16);
+
+    lo = (lo > INT16_MAX) ? INT16_MAX : (lo < INT16_MIN) ? INT16_MIN : lo;
+    hi = (hi > INT16_MAX) ? INT16_MAX : (hi < INT16_MIN) ? INT16_MIN : hi;
+
+    return (uint16_t) lo | ((uint32_t) hi << 16);
+#endif
+}
+
+// dst = src * gain, dst may be src
+static inline void pcm_scale(int16_t *dst, const int16_t *src, uint32_t count, int32_t gain)
+{
+    uint32_t i;
+
+    for (i = 0; i + 1 < count; i += 2) {
+        pcm_store2(&dst[i], pcm_scale2(pcm_load2(&src[i]), gain));
+    }
+    if (i < count) {
+        dst[i] = pcm_scale2((uint16_t) src[i], gain);
+    }
+}
+
+// Mono from separate left and right buffers
+static inline void pcm_downmix(int16_t *dst, const int16_t *left, const int16_t *right,
+                               uint32_t count)
+{
+    uint32_t i;
+
+    for (i = 0; i + 1 < count; i += 2) {
+        pcm_store2(&dst[i], pcm_add2(pcm_load2(&left[i]), pcm_load2(&right[i])));
+    }
+    if (i < count) {
+        dst[i] = pcm_add2((uint16_t) left[i], (uint16_t) right[i]);
+    }
+}
+
+// Mono from count interleaved left/right samples, dst may be lr
+static inline void pcm_downmix_interleaved(int16_t *dst, const int16_t *lr, uint32_t count)
+{
+    uint32_t i;
+
+    for (i = 0; i + 1 < count; i += 2) {
+        uint32_t a = pcm_load2(&lr[2 * i]);     // l0 r0
+        uint32_t b = pcm_load2(&lr[2 * i + 2]); // l1 r1
+#if defined(__ARM_FEATURE_DSP) && __ARM_FEATURE_DSP
+        uint32_t l = __PKHBT(a, b, 16);
+        uint32_t r = __PKHTB(b, a, 16);
+#else
+        uint32_t l = (a & 0xffff) | (b << 16);
+        uint32_t r = (a >> 16) | (b & 0xffff0000);
+#endif
+        pcm_store2(&dst[i], pcm_add2(l, r));
+    }
+    if (i < count) {
+        dst[i] = pcm_add2((uint16_t) lr[2 * i], (uint16_t) lr[2 * i + 1]);
+    }
+}
+
+#endif
@@ -0,0 +1,91 @@
+#ifndef _RGB565_H_
+#define _RGB565_H_
+
+#include <stdint.h>
+
+/*
+ * Kernels for the fractional-scale blitters, working on two RGB565 pixels
+ * packed into one 32-bit word (first pixel in the low half).
+ *
+ * The averages are done in-register without unpacking the channels: the
+ * lowest bit of every channel is masked out of a ^ b before the shift so
+ * nothing carries over into the neighbouring channel. UHADD16 can't be used
+ * for this since it averages 16-bit lanes, not the 5/6/5 bit channels, but
+ * the DSP extension is still used to pack pixel pairs. Plain C is used when
+ * it isn't available, e.g. for the linux/ build.
+ */
+
+#if defined(__ARM_FEATURE_DSP) && __ARM_FEATURE_DSP
+#include "cmsis_compiler.h"
+#endif
+
+#define RGB565_PAIR_LSB_MASK 0xf7def7de
+
+static inline uint32_t rgb565_pack(uint16_t lo, uint16_t hi)
+{
+#if defined(__ARM_FEATURE_DSP) && __ARM_FEATURE_DSP
+    return __PKHBT(lo, (uint32_t) hi, 16);
+#else
+    return lo | ((uint32_t) hi << 16);
+#endif
+}
+
+// Both halves set to the same pixel
+static inline uint32_t rgb565_dup(uint16_t c)
+{
+    return rgb565_pack(c, c);
+}
+
+static inline uint16_t rgb565_lo(uint32_t pair)
+{
+    return pair & 0xffff;
+}
+
+static inline uint16_t rgb565_hi(uint32_t pair)
+{
+    return pair >> 16;
+}
+
+// (a + b) / 2 per channel, rounded down
+static inline uint32_t rgb565_avg(uint32_t a, uint32_t b)
+{
+    return (a & b) + (((a ^ b) & RGB565_PAIR_LSB_MASK) >> 1);
+}
+
+// (3 * a + b) / 4 per channel, within one step of the exact value
+static inline uint32_t rgb565_avg31(uint32_t a, uint32_t b)
+{
+    return rgb565_avg(a, rgb565_avg(a, b));
+}
+
+// 3 lines to 5, every output line is (l0, l0+l1, l1, l1+l2, l2)
+static inline void rgb565_3to5(uint32_t out[5], uint32_t l0, uint32_t l1, uint32_t l2)
+{
+    out[0] = l0;
+    out[1] = rgb565_avg(l0, l1);
+    out[2] = l1;
+    out[3] = rgb565_avg(l1, l2);
+    out[4] = l2;
+}
+
+// 5 lines to 6, with the same weights as the SMS scaler always used
+static inline void rgb565_5to6(uint32_t out[6], const uint32_t in[5])
+{
+    out[0] = in[0];
+    out[1] = rgb565_avg31(in[1], in[0]);
+    out[2] = rgb565_avg(in[1], in[2]);
+    out[3] = rgb565_avg(in[2], in[3]);
+    out[4] = rgb565_avg31(in[3], in[4]);
+    out[5] = in[4];
+}
+
+// 5 pixels of a line to 6, as 3 pixel pairs
+static inline void rgb565_row_5to6(uint32_t out[3], uint16_t b0, uint16_t b1,
+                                   uint16_t b2, uint16_t b3, uint16_t b4)
+{
+    out[0] = rgb565_avg31(rgb565_pack(b0, b1), rgb565_dup(b0));
+    out[1] = rgb565_avg(rgb565_pack(b1, b2), rgb565_pack(b2, b3));
+    out[2] = rgb565_avg31(rgb565_pack(b3, b4), rgb565_dup(b4));
+}
+
+#endif
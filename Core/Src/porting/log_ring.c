@@ -0,0 +1,27 @@
+#include "main.h"
+#include "log_ring.h"
+
+// Read by tools/logpoll.py. The head counts words and never wraps around
+// within a session, a record starts at log_ring[head % LOG_RING_WORDS].
+uint32_t log_ring[LOG_RING_WORDS] PERSISTENT;
+uint32_t log_ring_head PERSISTENT;
+
+void log_ring_write(uint32_t fmt, const uint32_t *args, uint32_t count)
+{
+    uint32_t head = __atomic_fetch_add(&log_ring_head, count + 2, __ATOMIC_RELAXED);
+
+    // Incomplete until the header is written
+    log_ring[head % LOG_RING_WORDS] = 0;
+    log_ring[(head + 1) % LOG_RING_WORDS] = HAL_GetTick();
+    for (int i = 0; i < count; i++) {
+        log_ring[(head + 2 + i) % LOG_RING_WORDS] = args[i];
+    }
+
+    __DMB();
+    log_ring[head % LOG_RING_WORDS] = LOG_RING_MAGIC | (count << LOG_RING_ARGS_SHIFT) | fmt;
+}
+
+void log_ring_reset(void)
+{
+    log_ring_head = 0;
+}
@@ -0,0 +1,41 @@
+#include <malloc.h>
+
+#include "main.h"
+#include "gw_linker.h"
+#include "mem_stats.h"
+
+// Left to the frames of the caller and of this function
+#define PAINT_MARGIN 256
+
+void mem_stats_paint_stack(void)
+{
+    uint32_t *end = (uint32_t *) ((__get_MSP() - PAINT_MARGIN) & ~3);
+
+    for (uint32_t *p = (uint32_t *) &_stack_bottom; p < end; p++) {
+        *p = MEM_STATS_STACK_PATTERN;
+    }
+}
+
+size_t mem_stats_stack_peak(void)
+{
+    const uint32_t *p = (const uint32_t *) &_stack_bottom;
+    const uint32_t *top = (const uint32_t *) &_stack_top;
+
+    while (p < top && *p == MEM_STATS_STACK_PATTERN) {
+        p++;
+    }
+
+    return (uintptr_t) top - (uintptr_t) p;
+}
+
+size_t mem_stats_stack_size(void)
+{
+    return &_stack_top - &_stack_bottom;
+}
+
+void mem_stats_heap(size_t *used, size_t *peak, size_t *size)
+{
+    *used = mallinfo().uordblks;
+    *peak = gw_heap_peak();
+    *size = &_heap_end - &_heap_start;
+}
@@ -13,13 +13,26 @@
 #include "gw_lcd.h"
 #include "gw_linker.h"
 #include "common.h"
+#include "gw_blit.h"
+#include "gw_dirty.h"
 #include "rom_manager.h"
 
-#include "lz4_depack.h"
+#include "rom_loader.h"
+#include "save_pack.h"
+#include "state_slots.h"
 #include <assert.h>
-#include  "miniz.h"
-#include "lzma.h"
 #include "appid.h"
+#include "boot_trace.h"
+#include "emu_arena.h"
+#include "profiler.h"
+#include "log_ring.h"
+#include "run_ahead.h"
+#include "emu_snapshot.h"
+#include "porting.h"
+#include "main_nes.h"
+
+// Same as the GB, 32kHz is plenty for the APU and exact on the SAI
+#define AUDIO_SAMPLE_RATE_NES (32000)
 
 static uint samplesPerFrame;
 static uint32_t vsync_wait_ms = 0;
@@ -40,7 +53,8 @@ static bool SaveState(char *pathName)
     printf("Saving state...\n");
 
     nes_state_save(nes_save_buffer, 24000);
-    store_save((uint8_t *) ACTIVE_FILE->save_address, nes_save_buffer, sizeof(nes_save_buffer));
+    save_pack_store(state_slot_current(), ACTIVE_FILE->save_size,
+                    nes_save_buffer, sizeof(nes_save_buffer));
 
     return 0;
 }
@@ -50,21 +64,69 @@ extern int nes_state_load(uint8_t* flash_ptr, size_t size);
 
 static bool LoadState(char *pathName)
 {
-    nes_state_load((uint8_t *) ACTIVE_FILE->save_address, ACTIVE_FILE->save_size);
+    size_t size;
+    const uint8_t *state = save_pack_load(state_slot_current(), ACTIVE_FILE->save_size,
+                                          nes_save_buffer, sizeof(nes_save_buffer), &size);
+
+    if (state != NULL) {
+        nes_state_load((uint8_t *) state, size);
+    }
     return true;
 }
 
+static size_t snapshot_save(uint8_t *buffer, size_t size)
+{
+    return nes_state_save(buffer, size) < 0 ? 0 : size;
+}
+
+static void snapshot_load(const uint8_t *buffer, size_t size)
+{
+    nes_state_load((uint8_t *) buffer, size);
+}
+
+static const emu_snapshot_core_t snapshot_core = {
+    .save = &snapshot_save,
+    .load = &snapshot_load,
+    .size = sizeof(nes_save_buffer),
+};
+
 int osd_init()
 {
    return 0;
 }
 
-// TODO: Move to lcd.c/h
-extern LTDC_HandleTypeDef hltdc;
-
 static rgb_t *palette = NULL;
 static uint16_t palette565[256];
-static uint32_t palette_spaced_565[256];
+
+#ifndef GW_LCD_MODE_LUT8
+// Every mix of two of the 64 colors that blit_4to5() and blit_5to6() need,
+// rebuilt with the palette: a * 3/4 + b * 1/4 and a * 1/2 + b * 1/2.
+// The scalers look them up instead of blending each pixel.
+static uint16_t blend_3_1[64 * 64] DTCM_EMU_ATTR;
+static uint16_t blend_1_1[64 * 64] DTCM_EMU_ATTR;
+
+// The upper bits of a pixel are background and transparency flags
+#define PAIR(_a, _b) ((((_a) & 0x3f) << 6) | ((_b) & 0x3f))
+
+#define SPACE(_c) (((0b1111100000000000&(_c))<<10) | ((0b0000011111100000&(_c))<<5) | ((0b0000000000011111&(_c))))
+#define CONV(_b0) (((0b11111000000000000000000000&(_b0))>>10) | ((0b000001111110000000000&(_b0))>>5) | ((0b0000000000011111&(_b0))))
+
+static void build_blend_tables(void)
+{
+    // With the channels spaced apart the sums don't carry into each other,
+    // the shifts round each channel down like the scalers used to
+    for (int a = 0; a < 64; a++) {
+        uint32_t sa = SPACE(palette565[a]);
+
+        for (int b = 0; b < 64; b++) {
+            uint32_t sb = SPACE(palette565[b]);
+
+            blend_3_1[PAIR(a, b)] = CONV((sa + sa + sa + sb) >> 2);
+            blend_1_1[PAIR(a, b)] = CONV((sa + sb) >> 1);
+        }
+    }
+}
+#endif
 
 
 void osd_setpalette(rgb_t *pal)
@@ -85,12 +147,11 @@ void osd_setpalette(rgb_t *pal)
     }
 
     // Update the color-LUT in the LTDC peripheral
-    HAL_LTDC_ConfigCLUT(&hltdc, clut, 256, 0);
-    HAL_LTDC_EnableCLUT(&hltdc, 0);
+    lcd_set_clut(clut, 256);
 
     // color 13 is "black". Makes for a nice border.
-    memset(framebuffer1, 13, sizeof(framebuffer1));
-    memset(framebuffer2, 13, sizeof(framebuffer2));
+    lcd_clear_async(13);
+    gw_blit_wait();
 
     odroid_display_force_refresh();
 #else
@@ -103,14 +164,11 @@ void osd_setpalette(rgb_t *pal)
         palette565[i]        = c;
         palette565[i | 0x40] = c;
         palette565[i | 0x80] = c;
-
-        uint32_t sc = ((0b1111100000000000&c)<<10) | ((0b0000011111100000&c)<<5) | ((0b0000000000011111&c));
-        palette_spaced_565[i] = sc;
-        palette_spaced_565[i | 0x40] = sc;
-        palette_spaced_565[i | 0x80] = sc;
-
     }
 
+    build_blend_tables();
+
+    gw_blit_set_clut_rgb565(palette565, 256);
 #endif
 }
 
@@ -121,46 +179,31 @@ void osd_vsync()
 
     nes_audio_submit(nes_getptr()->apu->buffer, nes_getptr()->apu->samples_per_frame);
 
+    // The real frame isn't drawn, the last one ahead of it is and its
+    // audio is overwritten by the next real frame, see run_ahead.h. The
+    // real frame then leaves vidbuf alone, the ahead one is blitted here.
+    if (run_ahead_frames() > 0 && draw_frame && run_ahead_save()) {
+        for (int i = 1; i <= run_ahead_frames(); i++) {
+            nes_renderframe(i == run_ahead_frames());
+        }
+        osd_blitscreen(nes_getptr()->vidbuf);
+        run_ahead_load();
+        draw_frame = false;
+    }
+
     nes_getptr()->drawframe = draw_frame;
 
-    // Wait until the audio buffer has been transmitted
-    static uint32_t last_dma_counter = 0;
     t0 = get_elapsed_time();
-    if(!common_emu_state.skip_frames){
-        for(uint8_t p = 0; p < common_emu_state.pause_frames + 1; p++) {
-            while (dma_counter == last_dma_counter) {
-                cpumon_sleep();
-            }
-            last_dma_counter = dma_counter;
-        }
-    }
+    common_emu_sync();
 
     vsync_wait_ms += get_elapsed_time_since(t0);
 }
 
 void nes_audio_submit(int16_t *buffer, int audioSamples)
 {
-    // apu_process(audiobuffer_emulator, audioSamples, false); //get audio data
-
-    size_t offset = (dma_state == DMA_TRANSFER_STATE_HF) ? 0 : audioSamples;
-
-    // MUST shift with at least 1 place, or it will brownout.
-    uint8_t volume = odroid_audio_volume_get();
-    int32_t factor = volume_tbl[volume];
-
-    if (audio_mute || (volume == ODROID_AUDIO_VOLUME_MIN)) {
-        // mute
-        for (int i = 0; i < audioSamples; i++) {
-            audiobuffer_dma[i + offset] = 0;
-        }
-        return;
-    }
-
-    // Write to DMA buffer and lower the volume accordingly
-    for (int i = 0; i < audioSamples; i++) {
-        int32_t sample = buffer[i];
-        audiobuffer_dma[i + offset] = (sample * factor) >> 8;
-    }
+    profiler_begin(PROFILER_AUDIO);
+    odroid_audio_ring_write(buffer, audioSamples);
+    profiler_end(PROFILER_AUDIO);
 }
 
 
@@ -207,21 +250,15 @@ static inline void blit_nearest(bitmap_t *bmp, uint8_t *framebuffer) {
 }
 #else
 
-// No scaling
-__attribute__((optimize("unroll-loops")))
+// No scaling, palette lookup done by the DMA2D
 static inline void blit_normal(bitmap_t *bmp, uint16_t *framebuffer) {
     const int w1 = bmp->width;
     const int w2 = 320;
     const int h2 = 240;
     const int hpad = 27;
 
-    for (int y = 0; y < h2; y++) {
-        uint8_t  *src_row  = bmp->line[y];
-        uint16_t *dest_row = &framebuffer[y * w2 + hpad];
-        for (int x = 0; x < w1; x++) {
-            dest_row[x] = palette565[src_row[x]];
-        }
-    }
+    gw_blit_fill_border_rgb565(framebuffer, w2, w2, h2, hpad, 0, w1, h2, 0);
+    gw_blit_l8_to_rgb565(bmp->line[0], bmp->pitch, &framebuffer[hpad], w2, w1, h2);
 }
 
 __attribute__((optimize("unroll-loops")))
@@ -241,13 +278,18 @@ static inline void blit_nearest(bitmap_t *bmp, uint16_t *framebuffer, bool full_
         // scale to 307
         hpad = (WIDTH - 307) / 2;
         scale_ctr = 4;
+
+        // Clear the borders while the CPU does the scaling
+        gw_blit_fill_border_rgb565(framebuffer, w2, w2, h2, hpad, 0, 307, h2, 0);
     }
 
     // 1767 us
-    PROFILING_INIT(t_blit);
-    PROFILING_START(t_blit);
+    profiler_begin(PROFILER_BLIT);
 
     for (int y = 0; y < h2; y++) {
+        if (!gw_dirty_line(y)) {
+            continue;
+        }
         int ctr = 0;
         uint8_t  *src_row  = bmp->line[y];
         uint16_t *dest_row = &framebuffer[y * w2 + hpad];
@@ -262,15 +304,9 @@ static inline void blit_nearest(bitmap_t *bmp, uint16_t *framebuffer, bool full_
         }
     }
 
-    PROFILING_END(t_blit);
-
-#ifdef PROFILING_ENABLED
-    printf("Blit: %d us\n", (1000000 * PROFILING_DIFF(t_blit)) / t_blit_t0.SecondFraction);
-#endif
+    profiler_end(PROFILER_BLIT);
 }
 
-#define CONV(_b0) ((0b11111000000000000000000000&_b0)>>10) | ((0b000001111110000000000&_b0)>>5) | ((0b0000000000011111&_b0));
-
 __attribute__((optimize("unroll-loops")))
 static void blit_4to5(bitmap_t *bmp, uint16_t *framebuffer) {
     int w1 = bmp->width;
@@ -280,19 +316,22 @@ static void blit_4to5(bitmap_t *bmp, uint16_t *framebuffer) {
     // 1767 us
 
     for (int y = 0; y < h2; y++) {
+        if (!gw_dirty_line(y)) {
+            continue;
+        }
         uint8_t  *src_row  = bmp->line[y];
         uint16_t *dest_row = &framebuffer[y * w2];
         for (int x_src = 0, x_dst=0; x_src < w1; x_src+=4, x_dst+=5) {
-            uint32_t b0 = palette_spaced_565[src_row[x_src]];
-            uint32_t b1 = palette_spaced_565[src_row[x_src+1]];
-            uint32_t b2 = palette_spaced_565[src_row[x_src+2]];
-            uint32_t b3 = palette_spaced_565[src_row[x_src+3]];
-
-            dest_row[x_dst]   = CONV(b0);
-            dest_row[x_dst+1] = CONV((b0+b0+b0+b1)>>2);
-            dest_row[x_dst+2] = CONV((b1+b2)>>1);
-            dest_row[x_dst+3] = CONV((b2+b2+b2+b3)>>2);
-            dest_row[x_dst+4] = CONV(b3);
+            uint8_t b0 = src_row[x_src];
+            uint8_t b1 = src_row[x_src+1];
+            uint8_t b2 = src_row[x_src+2];
+            uint8_t b3 = src_row[x_src+3];
+
+            dest_row[x_dst]   = palette565[b0];
+            dest_row[x_dst+1] = blend_3_1[PAIR(b0, b1)];
+            dest_row[x_dst+2] = blend_1_1[PAIR(b1, b2)];
+            dest_row[x_dst+3] = blend_3_1[PAIR(b2, b3)];
+            dest_row[x_dst+4] = palette565[b3];
         }
     }
 }
@@ -307,24 +346,29 @@ static void blit_5to6(bitmap_t *bmp, uint16_t *framebuffer) {
 
     // Blit: 2015 us
 
+    gw_blit_fill_border_rgb565(framebuffer, w2, w2, h2, hpad, 0, 307, h2, 0);
+
     for (int y = 0; y < h2; y++) {
+        if (!gw_dirty_line(y)) {
+            continue;
+        }
         uint8_t  *src_row  = bmp->line[y];
         uint16_t *dest_row = &framebuffer[y * w2 + hpad];
         int x_src = 0;
         int x_dst = 0;
         for (; x_src < w1_adjusted; x_src+=5, x_dst+=6) {
-            uint32_t b0 = palette_spaced_565[src_row[x_src]];
-            uint32_t b1 = palette_spaced_565[src_row[x_src+1]];
-            uint32_t b2 = palette_spaced_565[src_row[x_src+2]];
-            uint32_t b3 = palette_spaced_565[src_row[x_src+3]];
-            uint32_t b4 = palette_spaced_565[src_row[x_src+4]];
-
-            dest_row[x_dst]   = CONV(b0);
-            dest_row[x_dst+1] = CONV((b0+b1+b1+b1)>>2);
-            dest_row[x_dst+2] = CONV((b1+b2)>>1);
-            dest_row[x_dst+3] = CONV((b2+b3)>>1);
-            dest_row[x_dst+4] = CONV((b3+b3+b3+b4)>>2);
-            dest_row[x_dst+5] = CONV(b4);
+            uint8_t b0 = src_row[x_src];
+            uint8_t b1 = src_row[x_src+1];
+            uint8_t b2 = src_row[x_src+2];
+            uint8_t b3 = src_row[x_src+3];
+            uint8_t b4 = src_row[x_src+4];
+
+            dest_row[x_dst]   = palette565[b0];
+            dest_row[x_dst+1] = blend_3_1[PAIR(b1, b0)];
+            dest_row[x_dst+2] = blend_1_1[PAIR(b1, b2)];
+            dest_row[x_dst+3] = blend_1_1[PAIR(b2, b3)];
+            dest_row[x_dst+4] = blend_3_1[PAIR(b3, b4)];
+            dest_row[x_dst+5] = palette565[b4];
         }
         // Last column, x_src=255
         dest_row[x_dst] = palette565[src_row[x_src]];
@@ -337,6 +381,16 @@ static void blit(bitmap_t *bmp, uint16_t *framebuffer)
     odroid_display_scaling_t scaling = odroid_display_get_scaling_mode();
     odroid_display_filter_t filtering = odroid_display_get_filter_mode();
 
+#ifndef GW_LCD_MODE_LUT8
+    if (scaling == ODROID_DISPLAY_SCALING_OFF || scaling == ODROID_DISPLAY_SCALING_FIT) {
+        // The DMA2D converts the whole frame, that's cheaper than hashing it
+        gw_dirty_invalidate();
+    } else {
+        uint32_t key = gw_dirty_hash(palette565, sizeof(palette565), (scaling << 8) | filtering);
+        gw_dirty_begin(bmp->line[0], bmp->pitch, bmp->width, bmp->height, key);
+    }
+#endif
+
     switch (scaling) {
     case ODROID_DISPLAY_SCALING_OFF:
         /* fall-through */
@@ -375,27 +429,24 @@ void osd_blitscreen(bitmap_t *bmp)
 
     if (delta >= 1000) {
         int fps = (10000 * frames) / delta;
-        printf("FPS: %d.%d, frames %ld, delta %ld ms, skipped %d\n", fps / 10, fps % 10, frames, delta, common_emu_state.skipped_frames);
+        LOG_DEFER("FPS: %d.%d, frames %ld, delta %ld ms, skipped %d\n", fps / 10, fps % 10, frames, delta, common_emu_state.skipped_frames);
         frames = 0;
         common_emu_state.skipped_frames = 0;
         vsync_wait_ms = 0;
         lastFPSTime = currentTime;
     }
 
-    PROFILING_INIT(t_blit);
-    PROFILING_START(t_blit);
+    profiler_begin(PROFILER_BLIT);
 
     // This takes less than 1ms
+    lcd_beam_begin();
     pixel_t *fb = lcd_get_active_buffer();
     blit(bmp, fb);
+    gw_blit_wait();
     common_ingame_overlay();
     lcd_swap();
 
-    PROFILING_END(t_blit);
-
-#ifdef PROFILING_ENABLED
-    printf("Blit: %d us\n", (1000000 * PROFILING_DIFF(t_blit)) / t_blit_t0.SecondFraction);
-#endif
+    profiler_end(PROFILER_BLIT);
 }
 
 static bool palette_update_cb(odroid_dialog_choice_t *option, odroid_dialog_event_t event, uint32_t repeat)
@@ -416,32 +467,20 @@ static bool palette_update_cb(odroid_dialog_choice_t *option, odroid_dialog_even
    return event == ODROID_DIALOG_ENTER;
 }
 
-void osd_getinput(void)
+// Once per frame. nofrendo's $4016 read doesn't poll again, its core isn't in
+// this tree, see common_emu_input_late_poll()
+static void pad_update(const odroid_gamepad_state_t *joystick)
 {
     uint16 pad0 = 0;
-    char pal_name[16];
-
-    wdog_refresh();
-
-    odroid_gamepad_state_t joystick;
-    odroid_input_read_gamepad(&joystick);
 
-    odroid_dialog_choice_t options[] = {
-            {100, "Palette", pal_name, 1, &palette_update_cb},
-            // {101, "More...", "", 1, &advanced_settings_cb},
-            ODROID_DIALOG_CHOICE_LAST
-    };
-    common_emu_input_loop(&joystick, options);
-
-
-    if (joystick.values[ODROID_INPUT_START])  pad0 |= INP_PAD_START;
-    if (joystick.values[ODROID_INPUT_SELECT]) pad0 |= INP_PAD_SELECT;
-    if (joystick.values[ODROID_INPUT_UP]) pad0 |= INP_PAD_UP;
-    if (joystick.values[ODROID_INPUT_DOWN]) pad0 |= INP_PAD_DOWN;
-    if (joystick.values[ODROID_INPUT_LEFT]) pad0 |= INP_PAD_LEFT;
-    if (joystick.values[ODROID_INPUT_RIGHT]) pad0 |= INP_PAD_RIGHT;
-    if (joystick.values[ODROID_INPUT_A]) pad0 |= INP_PAD_A;
-    if (joystick.values[ODROID_INPUT_B]) pad0 |= INP_PAD_B;
+    if (joystick->values[ODROID_INPUT_START])  pad0 |= INP_PAD_START;
+    if (joystick->values[ODROID_INPUT_SELECT]) pad0 |= INP_PAD_SELECT;
+    if (joystick->values[ODROID_INPUT_UP]) pad0 |= INP_PAD_UP;
+    if (joystick->values[ODROID_INPUT_DOWN]) pad0 |= INP_PAD_DOWN;
+    if (joystick->values[ODROID_INPUT_LEFT]) pad0 |= INP_PAD_LEFT;
+    if (joystick->values[ODROID_INPUT_RIGHT]) pad0 |= INP_PAD_RIGHT;
+    if (joystick->values[ODROID_INPUT_A]) pad0 |= INP_PAD_A;
+    if (joystick->values[ODROID_INPUT_B]) pad0 |= INP_PAD_B;
 
     // Enable to log button presses
 #if 0
@@ -455,70 +494,44 @@ void osd_getinput(void)
     input_update(INP_JOYPAD0, pad0);
 }
 
-size_t osd_getromdata(unsigned char **data)
+void osd_getinput(void)
 {
-    /* src pointer to the ROM data in the external flash (raw or LZ4) */
-    const unsigned char *src = ROM_DATA;
-    unsigned char *dest = (unsigned char *)&_NES_ROM_UNPACK_BUFFER;
-    uint32_t available_size = (uint32_t)&_NES_ROM_UNPACK_BUFFER_SIZE;
+    char pal_name[16];
+    char run_ahead_str[12];
 
     wdog_refresh();
-    if (memcmp(&src[0], LZ4_MAGIC, LZ4_MAGIC_SIZE) == 0)
-    {
 
-        /* dest pointer to the ROM data in the internal RAM (raw) */
-        uint32_t lz4_original_size;
-        int32_t lz4_uncompressed_size;
-
-        printf("LZ4 compressed ROM detected.\n");
-        printf("Uncompressing to %p. %ld bytes available.\n", dest, available_size);
-
-        /* get the content size to uncompress */
-        lz4_original_size = lz4_get_original_size(src);
-
-        /* Check if there is enough memory to uncompress it */
-        assert(available_size >= lz4_original_size);
-
-        /* Uncompress the content to RAM */
-        lz4_uncompressed_size = lz4_uncompress(src, dest);
-
-        printf("Uncompressed size: %ld bytes.\n", lz4_uncompressed_size);
-
-        /* Check if the uncompressed content size is as expected */
-        assert(lz4_original_size == lz4_uncompressed_size);
+    odroid_gamepad_state_t joystick;
+    odroid_input_read_gamepad(&joystick);
 
-        *data = dest;
+    odroid_dialog_choice_t options[] = {
+            {100, "Palette", pal_name, 1, &palette_update_cb},
+            {102, "Run-ahead", run_ahead_str, 1, &run_ahead_update_cb},
+            // {101, "More...", "", 1, &advanced_settings_cb},
+            ODROID_DIALOG_CHOICE_LAST
+    };
+    common_emu_input_loop(&joystick, options);
 
-        return lz4_uncompressed_size;
-    }
-    else if(strcmp(ROM_EXT, "zopfli") == 0){
-        /* DEFLATE decompression */
-        printf("Zopfli compressed ROM detected.\n");
-        size_t n_decomp_bytes;
-        int flags = 0;
-        flags |= TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF;
-        n_decomp_bytes = tinfl_decompress_mem_to_mem(dest, available_size, src, ROM_DATA_LENGTH, flags);
-        assert(n_decomp_bytes != TINFL_DECOMPRESS_MEM_TO_MEM_FAILED);
-        *data = dest;
-        return n_decomp_bytes;
-    }
-    else if(strcmp(ROM_EXT, "lzma") == 0){
-        size_t n_decomp_bytes;
-        n_decomp_bytes = lzma_inflate(dest, available_size, src, ROM_DATA_LENGTH);
-        *data = dest;
-        return n_decomp_bytes;
-    }
-    else
-    {
-        *data = (unsigned char *)ROM_DATA;
+    pad_update(&joystick);
+}
 
-        return ROM_DATA_LENGTH;
-    }
+// The whole ROM is unpacked up front, the mappers in nofrendo expect PRG and
+// CHR to be in one contiguous buffer and switch banks without calling out.
+size_t osd_getromdata(unsigned char **data)
+{
+    size_t size;
+    uint8_t *buffer = emu_arena_alloc_rest(EMU_ARENA_RAM_EMU, 4, &size);
+    uint32_t mark = (uint32_t) buffer;
+    size_t rom_size = rom_loader_load_active(buffer, size, (const uint8_t **)data);
+
+    // Give back what the ROM doesn't use, nothing if it's run from flash
+    emu_arena_release(EMU_ARENA_RAM_EMU, mark + (*data == buffer ? rom_size : 0));
+    return rom_size;
 }
 
 uint osd_getromcrc()
 {
-   return 0x1337;
+   return rom_loader_crc32_active();
 }
 
 void osd_loadstate()
@@ -526,6 +539,7 @@ void osd_loadstate()
     if(autoload) {
         autoload = false;
         LoadState("");
+        boot_trace("state loaded");
     }
 }
 
@@ -534,9 +548,8 @@ int app_main_nes(uint8_t load_state, uint8_t start_paused)
 {
     region_t nes_region;
 
-    memset(framebuffer1, 0x0, sizeof(framebuffer1));
-    memset(framebuffer2, 0x0, sizeof(framebuffer2));
-    odroid_system_init(APPID_NES, AUDIO_SAMPLE_RATE);
+    lcd_clear_async(0);
+    odroid_system_init(APPID_NES, AUDIO_SAMPLE_RATE_NES);
     odroid_system_emu_init(&LoadState, &SaveState, NULL);
 
     if (start_paused) {
@@ -547,25 +560,32 @@ int app_main_nes(uint8_t load_state, uint8_t start_paused)
     }
 
     autoload = load_state;
+    emu_snapshot_init(&snapshot_core);
+    // The run-ahead snapshot shares the save buffer
+    run_ahead_init(nes_save_buffer, sizeof(nes_save_buffer));
 
-    printf("Nofrendo start!\n");
+    // nofrendo_start() loads the ROM, show how far along unpacking it is
+    rom_loader_set_progress(&rom_loader_progress_bar);
 
-    memset(audiobuffer_dma, 0, sizeof(audiobuffer_dma));
+    printf("Nofrendo start!\n");
 
     if (ACTIVE_FILE->region == REGION_PAL) {
         nes_region = NES_PAL;
         common_emu_state.frame_time_10us = (uint16_t)(100000 / 50 + 0.5f);
-        samplesPerFrame = (AUDIO_SAMPLE_RATE) / 50;
-        HAL_SAI_Transmit_DMA(&hsai_BlockA1, (uint8_t *) audiobuffer_dma,  (2 * AUDIO_SAMPLE_RATE) / 50);
+        samplesPerFrame = (AUDIO_SAMPLE_RATE_NES) / 50;
+        odroid_audio_ring_start(samplesPerFrame);
     } else {
         nes_region = NES_NTSC;
         common_emu_state.frame_time_10us = (uint16_t)(100000 / 60 + 0.5f);
         //printf("frame_time_10us: %d\n", common_emu_state.frame_time_10us);
-        samplesPerFrame = (AUDIO_SAMPLE_RATE) / 60;
-        HAL_SAI_Transmit_DMA(&hsai_BlockA1, (uint8_t *) audiobuffer_dma, (2 * AUDIO_SAMPLE_RATE) / 60);
+        samplesPerFrame = (AUDIO_SAMPLE_RATE_NES) / 60;
+        odroid_audio_ring_start(samplesPerFrame);
     }
 
-    nofrendo_start(ACTIVE_FILE->name, nes_region, AUDIO_SAMPLE_RATE, false);
+    // The framebuffers were cleared while the rest was set up
+    gw_blit_wait();
+
+    nofrendo_start(ACTIVE_FILE->name, nes_region, AUDIO_SAMPLE_RATE_NES, false);
 
     return 0;
 }
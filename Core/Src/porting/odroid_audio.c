@@ -1,50 +1,110 @@
 #include "odroid_system.h"
 #include "odroid_audio.h"
 #include "common.h"
+#include "pcm.h"
 #include <assert.h>
+#include <string.h>
 
 #include "stm32h7xx_hal.h"
 
 uint8_t audio_level = ODROID_AUDIO_VOLUME_MAX;
 
-/* set audio frequency  */
-static void set_audio_frequency(uint32_t frequency)
+/*
+ * Emulators write into a ring buffer through a resampler, the SAI DMA plays
+ * audiobuffer_dma in circular mode and every half of it is refilled from the
+ * ring by the DMA interrupt. Volume is applied on that last copy, so it
+ * changes right away.
+ *
+ * A DMA period is a video frame worth of samples, or a fraction of one in
+ * the low latency modes. Emulators still write a whole frame at once, so the
+ * ring is kept one frame plus one period full: enough to cover a frame that
+ * is late by a period, and a lot less buffering for the small periods.
+ *
+ * The resampler runs at the emulation speed and its ratio is nudged by up to
+ * DRC_MAX_ADJUST, depending on how far the ring is from that target (dynamic
+ * rate control). That keeps the ring from running dry or overflowing when
+ * the emulator isn't clocked by the SAI.
+ *
+ * ring_read is only written by the DMA interrupt and ring_write only by the
+ * emulator, so neither side needs to lock the other out.
+ */
+#define RING_LENGTH     4096 // Power of two
+#define DRC_MAX_ADJUST  (65536 / 200) // 0.5%, in 1/65536
+
+static int16_t ring[RING_LENGTH] __attribute__((aligned(4)));
+static volatile uint32_t ring_read;
+static volatile uint32_t ring_write;
+
+static uint32_t frame_length;       // Samples per video frame, 0 when stopped
+static uint32_t period_length;      // Samples per DMA interrupt
+static uint32_t fill_target;        // frame_length + period_length
+static uint32_t speed = 0x10000;    // Emulation speed, 16.16
+static int32_t fill_average;        // Ring fill, smoothed over a few writes
+
+static odroid_audio_stats_t stats;
+
+// Resampler state
+static int16_t history[4];
+static uint32_t phase;              // Position between history[1] and [2], 16.16
+/*
+ * The SAI runs in MCKDIV mode, the sample rate is the SAI clock from PLL2P
+ * divided by (256 * MCKDIV). PLL2 is set up for one of these clocks, which
+ * cover most of the rates an emulator would want exactly:
+ *   98.304 MHz:   8, 12, 16, 24, 32, 48 and 96 kHz
+ *   90.3168 MHz:  11025, 22050 and 44100 Hz
+ *   50.331 MHz:   32768 Hz (Game & Watch)
+ */
+#define SAI_CLOCK_48K    98304000
+#define SAI_CLOCK_44K1   90316800
+#define SAI_CLOCK_32768  50331648
+#define SAI_MCKDIV_MAX   63
+
+// DMA periods per video frame, for each ODROID_AUDIO_LATENCY_*
+static const uint8_t latency_periods[ODROID_AUDIO_LATENCY_COUNT] = {1, 4, 8};
+
+// Rate the SAI actually runs at and how much faster the emulator is, 16.16
+static uint32_t sai_sample_rate = 48000;
+static uint32_t rate_ratio = 0x10000;
+
+/* set audio frequency, returns the closest one the SAI can do */
+static uint32_t set_audio_frequency(uint32_t frequency)
 {
 
     /** reconfig PLL2 and SAI */
     RCC_PeriphCLKInitTypeDef PeriphClkInitStruct = {0};
+    uint32_t clock;
 
     PeriphClkInitStruct.PeriphClockSelection = RCC_PERIPHCLK_SAI1;
 
-    /* Reconfigure on the fly PLL2 */
-    /* config to get 32768Hz */
-    /* The audio clock frequency is derived directly */
-    /* SAI mode is MCKDIV mode */
+    /* Reconfigure on the fly PLL2, from HSI / 25 = 2.56 MHz */
+    PeriphClkInitStruct.PLL2.PLL2M = 25;
+    PeriphClkInitStruct.PLL2.PLL2Q = 2;
+    PeriphClkInitStruct.PLL2.PLL2R = 5;
+    PeriphClkInitStruct.PLL2.PLL2RGE = RCC_PLL2VCIRANGE_1;
+    PeriphClkInitStruct.PLL2.PLL2VCOSEL = RCC_PLL2VCOWIDE;
+
     if (frequency == 32768)
     {
-
-        PeriphClkInitStruct.PLL2.PLL2M = 25;
+        /* 2.56 MHz * (196 + 5000 / 8192) / 10 */
+        clock = SAI_CLOCK_32768;
         PeriphClkInitStruct.PLL2.PLL2N = 196;
         PeriphClkInitStruct.PLL2.PLL2P = 10;
-        PeriphClkInitStruct.PLL2.PLL2Q = 2;
-        PeriphClkInitStruct.PLL2.PLL2R = 5;
-        PeriphClkInitStruct.PLL2.PLL2RGE = RCC_PLL2VCIRANGE_1;
-        PeriphClkInitStruct.PLL2.PLL2VCOSEL = RCC_PLL2VCOWIDE;
         PeriphClkInitStruct.PLL2.PLL2FRACN = 5000;
-
-    /* config to get 48KHz and multiple */
-    /* SAI mode is in standard frequency mode */
+    }
+    else if (frequency > 0 && (SAI_CLOCK_44K1 / 256) % frequency == 0 && (SAI_CLOCK_48K / 256) % frequency != 0)
+    {
+        /* 2.56 MHz * (176 + 3277 / 8192) / 5 */
+        clock = SAI_CLOCK_44K1;
+        PeriphClkInitStruct.PLL2.PLL2N = 176;
+        PeriphClkInitStruct.PLL2.PLL2P = 5;
+        PeriphClkInitStruct.PLL2.PLL2FRACN = 3277;
     }
     else
     {
-
-        PeriphClkInitStruct.PLL2.PLL2M = 25;
+        /* 2.56 MHz * 192 / 5, also the fallback for rates that are not exact */
+        clock = SAI_CLOCK_48K;
         PeriphClkInitStruct.PLL2.PLL2N = 192;
         PeriphClkInitStruct.PLL2.PLL2P = 5;
-        PeriphClkInitStruct.PLL2.PLL2Q = 2;
-        PeriphClkInitStruct.PLL2.PLL2R = 5;
-        PeriphClkInitStruct.PLL2.PLL2RGE = RCC_PLL2VCIRANGE_1;
-        PeriphClkInitStruct.PLL2.PLL2VCOSEL = RCC_PLL2VCOWIDE;
         PeriphClkInitStruct.PLL2.PLL2FRACN = 0;
     }
 
@@ -66,61 +126,306 @@ static void set_audio_frequency(uint32_t frequency)
         Error_Handler();
     }
 
+    /* closest divider the SAI has */
+    uint32_t mckdiv = frequency ? (clock + 128 * frequency) / (256 * frequency) : 0;
+    if (mckdiv < 1) {
+        mckdiv = 1;
+    } else if (mckdiv > SAI_MCKDIV_MAX) {
+        mckdiv = SAI_MCKDIV_MAX;
+    }
+
     /* remove the current configuration */
     HAL_SAI_DeInit(&hsai_BlockA1);
 
-    /* Set Audio sample rate at 32768Hz using MCKDIV mode */
-    if (frequency == 32768)
-    {
-
-        hsai_BlockA1.Init.AudioFrequency = SAI_AUDIO_FREQUENCY_MCKDIV;
-        hsai_BlockA1.Init.Mckdiv = 6;
-
-        /* config to get 48KHz and other standard values */
-        /*
-    SAI_AUDIO_FREQUENCY_192K      192000U
-    SAI_AUDIO_FREQUENCY_96K        96000U
-    SAI_AUDIO_FREQUENCY_48K        48000U
-    SAI_AUDIO_FREQUENCY_44K        44100U
-    SAI_AUDIO_FREQUENCY_32K        32000U
-    SAI_AUDIO_FREQUENCY_22K        22050U
-    SAI_AUDIO_FREQUENCY_16K        16000U
-    SAI_AUDIO_FREQUENCY_11K        11025U
-    SAI_AUDIO_FREQUENCY_8K          8000U
-    */
-
-    /* Set Audio sample rate at various standard frequencies using AudioFrequency mode */
-    } else {
-        /* default value 48KHz */
-        hsai_BlockA1.Init.AudioFrequency = SAI_AUDIO_FREQUENCY_48K;
-
-        /* check from the different possible values */
-        if ((frequency == SAI_AUDIO_FREQUENCY_192K) ||
-            (frequency == SAI_AUDIO_FREQUENCY_96K) ||
-            (frequency == SAI_AUDIO_FREQUENCY_48K) ||
-            (frequency == SAI_AUDIO_FREQUENCY_44K) ||
-            (frequency == SAI_AUDIO_FREQUENCY_32K) ||
-            (frequency == SAI_AUDIO_FREQUENCY_22K) ||
-            (frequency == SAI_AUDIO_FREQUENCY_16K) ||
-            (frequency == SAI_AUDIO_FREQUENCY_11K) ||
-            (frequency == SAI_AUDIO_FREQUENCY_8K))
-            hsai_BlockA1.Init.AudioFrequency = frequency;
-    }
+    hsai_BlockA1.Init.AudioFrequency = SAI_AUDIO_FREQUENCY_MCKDIV;
+    hsai_BlockA1.Init.Mckdiv = mckdiv;
 
     /* apply the new configuration */
     HAL_SAI_Init(&hsai_BlockA1);
+
+    return clock / (256 * mckdiv);
 }
 
 void odroid_audio_init(int sample_rate)
 {
-    set_audio_frequency(sample_rate);
+    sai_sample_rate = set_audio_frequency(sample_rate);
+    rate_ratio = ((uint64_t) sample_rate << 16) / sai_sample_rate;
     audio_level = odroid_settings_Volume_get();
 }
 
+uint32_t odroid_audio_sample_rate(void)
+{
+    return sai_sample_rate;
+}
+
 void odroid_audio_submit(short* stereoAudioBuffer, int frameCount)
 {
 }
 
+int odroid_audio_get_latency(void)
+{
+    int latency = odroid_settings_AudioLatency_get();
+
+    if (latency < 0 || latency >= ODROID_AUDIO_LATENCY_COUNT) {
+        return ODROID_AUDIO_LATENCY_NORMAL;
+    }
+    return latency;
+}
+
+void odroid_audio_ring_start(uint32_t frame)
+{
+    int latency = odroid_audio_get_latency();
+
+    // Even, so the DMA halves and the ring are copied in whole sample pairs
+    uint32_t period = (frame / latency_periods[latency]) & ~1;
+
+    assert(period > 0 && frame <= AUDIO_BUFFER_LENGTH);
+    assert((frame + period) * 2 <= RING_LENGTH);
+
+    memset(audiobuffer_dma, 0, sizeof(audiobuffer_dma));
+    memset(ring, 0, sizeof(ring));
+    memset(history, 0, sizeof(history));
+
+    frame_length = frame;
+    period_length = period;
+    fill_target = frame + period;
+    phase = 0;
+
+    // Start out with silence up to the target, as if the emulator was on time
+    ring_read = 0;
+    ring_write = fill_target;
+    fill_average = fill_target;
+    memset(&stats, 0, sizeof(stats));
+
+    HAL_SAI_Transmit_DMA(&hsai_BlockA1, (uint8_t *) audiobuffer_dma, 2 * period);
+}
+
+void odroid_audio_set_latency(int latency)
+{
+    odroid_settings_AudioLatency_set(latency);
+
+    // Apply it right away if a game is running
+    odroid_audio_ring_restart();
+}
+
+void odroid_audio_ring_restart(void)
+{
+    if (frame_length > 0) {
+        HAL_SAI_DMAStop(&hsai_BlockA1);
+        odroid_audio_ring_start(frame_length);
+    }
+}
+
+void odroid_audio_ring_stop(void)
+{
+    if (frame_length > 0) {
+        HAL_SAI_DMAStop(&hsai_BlockA1);
+        frame_length = 0;
+    }
+}
+
+odroid_audio_stats_t odroid_audio_get_stats(void)
+{
+    odroid_audio_stats_t current = stats;
+
+    current.fill = ring_write - ring_read;
+    return current;
+}
+
+void odroid_audio_ring_set_speed(uint32_t speed_16_16)
+{
+    speed = speed_16_16;
+}
+
+void odroid_audio_ring_dma_done(void)
+{
+    // Refill the half that was just played, it's the next one in line
+    int16_t *dst = (dma_state == DMA_TRANSFER_STATE_HF) ? audiobuffer_dma :
+                                                          &audiobuffer_dma[period_length];
+    uint8_t volume = odroid_audio_volume_get();
+    int32_t gain = (audio_mute || volume == ODROID_AUDIO_VOLUME_MIN) ? 0 : volume_tbl[volume] << 8;
+    uint32_t read = ring_read;
+    uint32_t available = ring_write - read;
+    uint32_t n = ((available < period_length) ? available : period_length) & ~1;
+
+    // In up to two parts, around the end of the ring
+    uint32_t start = read & (RING_LENGTH - 1);
+    uint32_t first = (n < RING_LENGTH - start) ? n : RING_LENGTH - start;
+    pcm_scale(dst, &ring[start], first, gain);
+    pcm_scale(&dst[first], ring, n - first, gain);
+
+    // Ran dry, play silence rather than the old samples again
+    if (n < period_length) {
+        // Menus stop the emulator but not the DMA, that's not a glitch
+        if (!audio_mute) {
+            stats.underruns++;
+        }
+        memset(&dst[n], 0, (period_length - n) * sizeof(dst[0]));
+    }
+
+    ring_read = read + n;
+}
+
+// Catmull-Rom spline between p[1] and p[2]
+static inline int32_t interpolate(const int16_t *p, uint32_t t)
+{
+    int32_t a = (-p[0] + 3 * p[1] - 3 * p[2] + p[3]) / 2;
+    int32_t b = (2 * p[0] - 5 * p[1] + 4 * p[2] - p[3]) / 2;
+    int32_t c = (p[2] - p[0]) / 2;
+    int64_t y;
+
+    y = ((int64_t) a * t) >> 16;
+    y = ((y + b) * t) >> 16;
+    y = ((y + c) * t) >> 16;
+    y += p[1];
+
+    if (y > INT16_MAX) {
+        return INT16_MAX;
+    } else if (y < INT16_MIN) {
+        return INT16_MIN;
+    }
+    return y;
+}
+
+// Position in the ring while a write goes along
+typedef struct {
+    uint32_t write;
+    uint32_t space;
+    uint32_t step;      // Input samples per output sample, 16.16
+} writer_t;
+
+static writer_t writer_begin(void)
+{
+    uint32_t write = ring_write;
+    int32_t fill = write - ring_read;
+    int32_t target = fill_target;
+
+    // Less than a period left means the DMA almost caught up with us
+    if (fill < (int32_t) period_length) {
+        stats.late++;
+    }
+
+    // Consume samples faster when the ring fills up, and slower when it runs low
+    fill_average += (fill - fill_average) / 8;
+    int32_t adjust = ((int64_t) DRC_MAX_ADJUST * (fill_average - target)) / target;
+    if (adjust > DRC_MAX_ADJUST) {
+        adjust = DRC_MAX_ADJUST;
+    } else if (adjust < -DRC_MAX_ADJUST) {
+        adjust = -DRC_MAX_ADJUST;
+    }
+
+    return (writer_t) {
+        .write = write,
+        .space = RING_LENGTH - fill,
+        .step = ((((uint64_t) speed * rate_ratio) >> 16) * (0x10000 + adjust)) >> 16,
+    };
+}
+
+// `run` times the same sample, returns how many of them fit
+static uint32_t writer_put(writer_t *w, int16_t sample, uint32_t run)
+{
+    uint32_t i;
+    uint64_t span;
+    uint32_t n;
+
+    // The first few of a run still blend in the samples before it
+    for (i = 0; i < run && !(history[1] == sample && history[2] == sample && history[3] == sample); i++) {
+        history[0] = history[1];
+        history[1] = history[2];
+        history[2] = history[3];
+        history[3] = sample;
+
+        while (phase < 0x10000) {
+            if (w->space == 0) {
+                return i;
+            }
+            ring[w->write & (RING_LENGTH - 1)] = interpolate(history, phase);
+            w->write++;
+            w->space--;
+            phase += w->step;
+        }
+        phase -= 0x10000;
+    }
+
+    if (i == run) {
+        return run;
+    }
+
+    // From here on the spline is flat, it's only the same sample over
+    history[0] = sample;
+    span = (uint64_t) (run - i) << 16;
+    n = (phase < span) ? (span - phase + w->step - 1) / w->step : 0;
+    if (n > w->space) {
+        // Up to the last input that got all its samples out
+        n = w->space;
+        run = i + ((uint64_t) phase + (uint64_t) n * w->step) / 0x10000;
+        span = (uint64_t) (run - i) << 16;
+    }
+
+    for (uint32_t j = 0; j < n; j++) {
+        ring[(w->write + j) & (RING_LENGTH - 1)] = sample;
+    }
+    w->write += n;
+    w->space -= n;
+    phase = phase + (uint64_t) n * w->step - span;
+
+    return run;
+}
+
+uint32_t odroid_audio_ring_write(const int16_t *samples, uint32_t count)
+{
+    writer_t w = writer_begin();
+    uint32_t i = 0;
+
+    // Runs of the same sample are common (silence, square waves), they skip
+    // the interpolation
+    while (i < count) {
+        uint32_t run = 1;
+
+        while (i + run < count && samples[i + run] == samples[i]) {
+            run++;
+        }
+
+        uint32_t done = writer_put(&w, samples[i], run);
+        i += done;
+        if (done < run) {
+            // Overflow, drop the rest
+            stats.overruns++;
+            break;
+        }
+    }
+
+    ring_write = w.write;
+
+    return i;
+}
+
+uint32_t odroid_audio_ring_write_levels(const uint8_t *samples, uint32_t count, const int16_t levels[2])
+{
+    writer_t w = writer_begin();
+    uint32_t i = 0;
+
+    while (i < count) {
+        bool high = samples[i] != 0;
+        uint32_t run = 1;
+
+        while (i + run < count && (samples[i + run] != 0) == high) {
+            run++;
+        }
+
+        uint32_t done = writer_put(&w, levels[high], run);
+        i += done;
+        if (done < run) {
+            stats.overruns++;
+            break;
+        }
+    }
+
+    ring_write = w.write;
+
+    return i;
+}
+
 void odroid_audio_volume_set(int level)
 {
     audio_level = level;
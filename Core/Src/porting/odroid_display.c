@@ -3,6 +3,11 @@
 #include "odroid_system.h"
 #include "odroid_display.h"
 #include "gw_lcd.h"
+#include "gw_blit.h"
+#include "common.h"
+
+// Smaller rectangles are copied faster than the DMA2D is set up
+#define WRITE_DMA2D_MIN_PIXELS 64
 
 static const uint8_t backlightLevels[] = {128, 130, 133, 139, 149, 162, 178, 198, 222, 255};
 static odroid_display_backlight_t backlightLevel = ODROID_BACKLIGHT_LEVEL3;
@@ -15,16 +20,36 @@ short odroid_display_queue_update(odroid_video_frame_t *frame, odroid_video_fram
     return SCREEN_UPDATE_FULL;
 }
 
-void odroid_display_write_rect(short left, short top, short width, short height, short stride, const uint16_t* buffer)
+void odroid_display_write_rect_async(short left, short top, short width, short height, short stride, const uint16_t* buffer)
 {
     pixel_t *dest = lcd_get_active_buffer();
 
+#ifndef GW_LCD_MODE_LUT8
+    if (width * height >= WRITE_DMA2D_MIN_PIXELS && gw_blit_can_read(buffer)) {
+        gw_blit_copy_rgb565(buffer, stride, &dest[top * GW_LCD_WIDTH + left], GW_LCD_WIDTH, width, height);
+        return;
+    }
+#endif
+
+    // The previous one may be over the same pixels
+    gw_blit_wait();
     for (short y = 0; y < height; y++) {
         pixel_t *dest_row = &dest[(y + top) * GW_LCD_WIDTH + left];
         memcpy(dest_row, &buffer[y * stride], width * sizeof(pixel_t));
     }
 }
 
+void odroid_display_write_flush(void)
+{
+    gw_blit_wait();
+}
+
+void odroid_display_write_rect(short left, short top, short width, short height, short stride, const uint16_t* buffer)
+{
+    odroid_display_write_rect_async(left, top, width, height, stride, buffer);
+    odroid_display_write_flush();
+}
+
 // Same as odroid_display_write_rect but stride is assumed to be width (for backwards compat)
 void odroid_display_write(short left, short top, short width, short height, const uint16_t* buffer)
 {
@@ -72,6 +97,16 @@ void odroid_display_set_filter_mode(odroid_display_filter_t mode)
     filterMode = mode;
 }
 
+void odroid_display_override_scaling_mode(odroid_display_scaling_t mode)
+{
+    scalingMode = mode;
+}
+
+void odroid_display_override_filter_mode(odroid_display_filter_t mode)
+{
+    filterMode = mode;
+}
+
 void odroid_display_init()
 {
     backlightLevel = odroid_settings_Backlight_get();
@@ -3,6 +3,7 @@
 #include "gw_buttons.h"
 #include "bq24072.h"
 #include "main.h"
+#include "profiler.h"
 
 /*typedef enum
 {
@@ -28,43 +29,58 @@ typedef struct
     uint16_t bitmask;
 } odroid_gamepad_state_t;
 */
-void update_gamepad_state(odroid_gamepad_state_t *state, uint32_t buttons, odroid_gamepad_key_t odroid_key, uint32_t gw_key) {
-    if(buttons & gw_key) {
-        state->values[odroid_key] = 1;
-        state->bitmask |= 1 << odroid_key;
-    } else {
-        state->values[odroid_key] = 0;
-        state->bitmask &= ~(1 << odroid_key);
+static const struct {
+    odroid_gamepad_key_t key;
+    uint32_t button;
+} keymap[] = {
+    {ODROID_INPUT_UP, B_Up},
+    {ODROID_INPUT_RIGHT, B_Right},
+    {ODROID_INPUT_DOWN, B_Down},
+    {ODROID_INPUT_LEFT, B_Left},
+    {ODROID_INPUT_START, B_GAME},
+    {ODROID_INPUT_SELECT, B_TIME},
+    {ODROID_INPUT_VOLUME, B_PAUSE},
+    {ODROID_INPUT_POWER, B_POWER},
+    {ODROID_INPUT_A, B_A},
+    {ODROID_INPUT_B, B_B},
+};
+
+void odroid_input_read_gamepad(odroid_gamepad_state_t* out_state)
+{
+    static odroid_gamepad_state_t last_state;
+    static uint32_t last_buttons = UINT32_MAX;
+
+    profiler_begin(PROFILER_INPUT);
+
+    // Mostly nothing changed since the last call
+    uint32_t buttons = buttons_get_state();
+    if (buttons != last_buttons) {
+        memset(&last_state, 0, sizeof(last_state));
+        for (int i = 0; i < sizeof(keymap) / sizeof(keymap[0]); i++) {
+            if (buttons & keymap[i].button) {
+                last_state.values[keymap[i].key] = 1;
+                last_state.bitmask |= 1 << keymap[i].key;
+            }
+        }
+        last_buttons = buttons;
     }
-}
- 
- void odroid_input_read_gamepad(odroid_gamepad_state_t* out_state)
- {
-    memset(out_state, '\x00', sizeof(odroid_gamepad_state_t));
-
-    uint32_t buttons = buttons_get();
-    update_gamepad_state(out_state, buttons, ODROID_INPUT_UP, B_Up);
-    update_gamepad_state(out_state, buttons, ODROID_INPUT_RIGHT, B_Right);
-    update_gamepad_state(out_state, buttons, ODROID_INPUT_DOWN, B_Down);
-    update_gamepad_state(out_state, buttons, ODROID_INPUT_LEFT, B_Left);
-    update_gamepad_state(out_state, buttons, ODROID_INPUT_START, B_GAME);
-    update_gamepad_state(out_state, buttons, ODROID_INPUT_SELECT, B_TIME);
-    update_gamepad_state(out_state, buttons, ODROID_INPUT_VOLUME, B_PAUSE);
-    update_gamepad_state(out_state, buttons, ODROID_INPUT_POWER, B_POWER);
-    update_gamepad_state(out_state, buttons, ODROID_INPUT_A, B_A);
-    update_gamepad_state(out_state, buttons, ODROID_INPUT_B, B_B);
-    // if(buttons & B_Left)
+    *out_state = last_state;
 
+    profiler_end(PROFILER_INPUT);
 }
 
 void odroid_input_wait_for_key(odroid_gamepad_key_t key, bool pressed)
 {
     odroid_gamepad_state_t joystick;
 
-    do {
+    // Sleeps between the button events, see gw_buttons.h
+    while (true) {
         odroid_input_read_gamepad(&joystick);
-        wdog_refresh();
-    } while (joystick.values[key] != (pressed ? 1 : 0));
+        if (joystick.values[key] == (pressed ? 1 : 0)) {
+            break;
+        }
+        buttons_wait_event(NULL, 100);
+    }
 }
 
 bool odroid_input_key_is_pressed(odroid_gamepad_key_t key)
@@ -73,11 +89,7 @@ bool odroid_input_key_is_pressed(odroid_gamepad_key_t key)
     odroid_input_read_gamepad(&joystick);
 
     if (key == ODROID_INPUT_ANY) {
-        uint32_t buttons = buttons_get();
-        if(buttons) {
-            return true;
-        }
-        return false;
+        return joystick.bitmask != 0;
     }
 
     return joystick.values[key];
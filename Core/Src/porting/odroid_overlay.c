@@ -35,11 +35,22 @@ int odroid_overlay_game_menu()
 #include "odroid_system.h"
 #include "odroid_overlay.h"
 #include "main.h"
+#include "common.h"
+#include "state_slots.h"
+#include "profiler.h"
+#include "input_replay.h"
+#include "cpu_clock.h"
+#include "frame_stats.h"
+#include "rewind.h"
+#include "emu_arena.h"
+#include "mem_stats.h"
 
 // static uint16_t *overlay_buffer = NULL;
 static uint16_t overlay_buffer[ODROID_SCREEN_WIDTH * 32 * 2]  __attribute__ ((aligned (4)));
 static short dialog_open_depth = 0;
 static short font_size = 8;
+static odroid_dialog_choice_t *debug_extra_options;
+static odroid_overlay_decoration_t dialog_decoration;
 
 void odroid_overlay_init()
 {
@@ -63,13 +74,50 @@ int odroid_overlay_get_font_width()
     return 8;
 }
 
+// Every row of a glyph is one byte of the 8x8 font. Expanding all 256
+// possible rows for a color pair once turns drawing text into copies.
+#define FONT_CACHE_SIZE 4
+
+typedef struct {
+    uint16_t color;
+    uint16_t color_bg;
+    uint16_t rows[256][8];
+} font_cache_t;
+
+static font_cache_t font_cache[FONT_CACHE_SIZE];
+static int font_cache_count;
+static int font_cache_next;
+
+static const font_cache_t *font_cache_get(uint16_t color, uint16_t color_bg)
+{
+    for (int i = 0; i < font_cache_count; i++) {
+        if (font_cache[i].color == color && font_cache[i].color_bg == color_bg)
+            return &font_cache[i];
+    }
+
+    font_cache_t *entry = &font_cache[font_cache_next];
+    font_cache_next = (font_cache_next + 1) % FONT_CACHE_SIZE;
+    if (font_cache_count < FONT_CACHE_SIZE)
+        font_cache_count++;
+
+    entry->color = color;
+    entry->color_bg = color_bg;
+    for (int row = 0; row < 256; row++) {
+        for (int x = 0; x < 8; x++) {
+            entry->rows[row][x] = (row & (1 << x)) ? color : color_bg;
+        }
+    }
+
+    return entry;
+}
+
 int odroid_overlay_draw_text_line(uint16_t x_pos, uint16_t y_pos, uint16_t width, const char *text, uint16_t color, uint16_t color_bg)
 {
     int font_height = 8; //odroid_overlay_get_font_size();
     int font_width = 8; //odroid_overlay_get_font_width();
     int x_offset = 0;
-    float scale = 1; //(float)font_height / 8;
     int text_len = strlen(text);
+    const font_cache_t *cache = font_cache_get(color, color_bg);
 
     for (int i = 0; i < (width / font_width); i++)
     {
@@ -77,10 +125,7 @@ int odroid_overlay_draw_text_line(uint16_t x_pos, uint16_t y_pos, uint16_t width
         for (int y = 0; y < font_height; y++)
         {
             int offset = x_offset + (width * y);
-            for (int x = 0; x < 8; x++)
-            {
-                overlay_buffer[offset + x] = (glyph[(int)(y/scale)] & (1 << x)) ? color : color_bg;
-            }
+            memcpy(&overlay_buffer[offset], cache->rows[(uint8_t)glyph[y]], sizeof(cache->rows[0]));
         }
         x_offset += font_width;
     }
@@ -134,10 +179,11 @@ void odroid_overlay_draw_rect(int x, int y, int width, int height, int border, u
     {
         overlay_buffer[i] = color;
     }
-    odroid_display_write(x, y, width, border, overlay_buffer); // T
-    odroid_display_write(x, y + height - border, width, border, overlay_buffer); // B
-    odroid_display_write(x, y, border, height, overlay_buffer); // L
-    odroid_display_write(x + width - border, y, border, height, overlay_buffer); // R
+    odroid_display_write_rect_async(x, y, width, border, width, overlay_buffer); // T
+    odroid_display_write_rect_async(x, y + height - border, width, border, width, overlay_buffer); // B
+    odroid_display_write_rect_async(x, y, border, height, border, overlay_buffer); // L
+    odroid_display_write_rect_async(x + width - border, y, border, height, border, overlay_buffer); // R
+    odroid_display_write_flush();
 }
 
 void odroid_overlay_draw_fill_rect(int x, int y, int width, int height, uint16_t color)
@@ -156,9 +202,10 @@ void odroid_overlay_draw_fill_rect(int x, int y, int width, int height, uint16_t
     while (y_pos < y_end)
     {
         int thickness = (y_end - y_pos >= 16) ? 16 : (y_end - y_pos);
-        odroid_display_write(x, y_pos, width, thickness, overlay_buffer);
+        odroid_display_write_rect_async(x, y_pos, width, thickness, width, overlay_buffer);
         y_pos += 16;
     }
+    odroid_display_write_flush();
 }
 
 void odroid_overlay_draw_battery(int x_pos, int y_pos)
@@ -290,6 +337,10 @@ void odroid_overlay_draw_dialog(const char *header, odroid_dialog_choice_t *opti
     odroid_overlay_draw_rect(box_x, box_y, box_width, box_height, box_padding, box_color);
     odroid_overlay_draw_rect(box_x - 1, box_y - 1, box_width + 2, box_height + 2, 1, box_border_color);
 
+    if (dialog_decoration != NULL) {
+        dialog_decoration(box_x - 1, box_y - 1, box_width + 2, box_height + 2);
+    }
+
     rg_free(rows);
 }
 
@@ -342,7 +393,7 @@ int odroid_overlay_dialog(const char *header, odroid_dialog_choice_t *options, i
             }
             else if (joystick.values[ODROID_INPUT_POWER]) {
                 sel = -1;
-                odroid_system_emu_save_state(0);
+                odroid_system_emu_save_state(state_slot_get());
                 odroid_system_sleep();
                 break;
             }
@@ -399,7 +450,8 @@ int odroid_overlay_dialog(const char *header, odroid_dialog_choice_t *options, i
 
         odroid_overlay_draw_dialog(header, options, sel);
         lcd_swap();
-        HAL_Delay(20);
+        // Wakes up right away for a button, the repeat counts on the timeout
+        buttons_wait_event(NULL, 20);
     }
 
     odroid_input_wait_for_key(last_key, false);
@@ -454,6 +506,42 @@ static bool volume_update_cb(odroid_dialog_choice_t *option, odroid_dialog_event
     return false;
 }
 
+static bool latency_update_cb(odroid_dialog_choice_t *option, odroid_dialog_event_t event, uint32_t repeat)
+{
+    int8_t max = ODROID_AUDIO_LATENCY_COUNT - 1;
+    int8_t mode = odroid_audio_get_latency();
+    int8_t prev = mode;
+
+    if (event == ODROID_DIALOG_PREV && --mode < 0) mode = max;
+    if (event == ODROID_DIALOG_NEXT && ++mode > max) mode = 0;
+
+    if (mode != prev) {
+        odroid_audio_set_latency(mode);
+    }
+
+    if (mode == ODROID_AUDIO_LATENCY_NORMAL) strcpy(option->value, "Normal");
+    if (mode == ODROID_AUDIO_LATENCY_LOW)    strcpy(option->value, "Low");
+    if (mode == ODROID_AUDIO_LATENCY_LOWEST) strcpy(option->value, "Lowest");
+
+    return event == ODROID_DIALOG_ENTER;
+}
+
+static bool sleep_mode_update_cb(odroid_dialog_choice_t *option, odroid_dialog_event_t event, uint32_t repeat)
+{
+    int8_t max = ODROID_SLEEP_COUNT - 1;
+    int8_t mode = odroid_settings_SleepMode_get();
+
+    if (event == ODROID_DIALOG_PREV && --mode < 0) mode = max;
+    if (event == ODROID_DIALOG_NEXT && ++mode > max) mode = 0;
+
+    odroid_settings_SleepMode_set(mode);
+
+    if (mode == ODROID_SLEEP_STANDBY) strcpy(option->value, "Off");
+    if (mode == ODROID_SLEEP_SUSPEND) strcpy(option->value, "Suspend");
+
+    return event == ODROID_DIALOG_ENTER;
+}
+
 static bool brightness_update_cb(odroid_dialog_choice_t *option, odroid_dialog_event_t event, uint32_t repeat)
 {
     int8_t level = odroid_display_get_backlight();
@@ -516,8 +604,8 @@ static bool scaling_update_cb(odroid_dialog_choice_t *option, odroid_dialog_even
 bool speedup_update_cb(odroid_dialog_choice_t *option, odroid_dialog_event_t event, uint32_t repeat)
 {
     rg_app_desc_t *app = odroid_system_get_app();
-    if (event == ODROID_DIALOG_PREV && --app->speedupEnabled <= SPEEDUP_MIN) app->speedupEnabled = SPEEDUP_MAX - 1;
-    if (event == ODROID_DIALOG_NEXT && ++app->speedupEnabled >= SPEEDUP_MAX) app->speedupEnabled = SPEEDUP_MIN + 1;
+    if (event == ODROID_DIALOG_PREV && --app->speedupEnabled <= SPEEDUP_MIN) app->speedupEnabled = SPEEDUP_UNLOCKED;
+    if (event == ODROID_DIALOG_NEXT && ++app->speedupEnabled > SPEEDUP_UNLOCKED) app->speedupEnabled = SPEEDUP_MIN + 1;
 
     switch(app->speedupEnabled){
         case SPEEDUP_0_5x:
@@ -541,6 +629,9 @@ bool speedup_update_cb(odroid_dialog_choice_t *option, odroid_dialog_event_t eve
         case SPEEDUP_3x:
             strcpy(option->value, "3x   ");
             break;
+        case SPEEDUP_UNLOCKED:
+            strcpy(option->value, "Max  ");
+            break;
     }
 
     return event == ODROID_DIALOG_ENTER;
@@ -550,10 +641,14 @@ int odroid_overlay_settings_menu(odroid_dialog_choice_t *extra_options)
 {
     static char bright_value[8];
     static char volume_value[8];
+    static char latency_value[8];
+    static char sleep_value[8];
 
     odroid_dialog_choice_t options[32] = {
         {0, "Brightness", bright_value, 1, &brightness_update_cb},
         {1, "Volume    ", volume_value, 1, &volume_update_cb},
+        {2, "Latency   ", latency_value, 1, &latency_update_cb},
+        {3, "Power off ", sleep_value, 1, &sleep_mode_update_cb},
         ODROID_DIALOG_CHOICE_LAST
     };
 
@@ -596,11 +691,13 @@ int odroid_overlay_game_settings_menu(odroid_dialog_choice_t *extra_options)
     char speedup_value[8];
     char scaling_value[8];
     char filtering_value[8];
+    char rewind_value[4];
 
     odroid_dialog_choice_t options[32] = {
         {200, "Scaling", scaling_value, 1, &scaling_update_cb},
         {210, "Filtering", filtering_value, 1, &filter_update_cb}, // Interpolation
         {220, "Speed", speedup_value, 1, &speedup_update_cb},
+        {230, "Rewind", rewind_value, 1, &rewind_update_cb},
 
         ODROID_DIALOG_CHOICE_LAST
     };
@@ -622,18 +719,163 @@ int odroid_overlay_game_settings_menu(odroid_dialog_choice_t *extra_options)
     return r;
 }
 
+#if PROFILER
+static bool profiler_update_cb(odroid_dialog_choice_t *option, odroid_dialog_event_t event, uint32_t repeat)
+{
+    if (event == ODROID_DIALOG_PREV || event == ODROID_DIALOG_NEXT) {
+        profiler_set_overlay(!profiler_get_overlay());
+    }
+
+    strcpy(option->value, profiler_get_overlay() ? "On" : "Off");
+    return event == ODROID_DIALOG_ENTER;
+}
+#endif
+
+#if INPUT_REPLAY
+static bool input_replay_update_cb(odroid_dialog_choice_t *option, odroid_dialog_event_t event, uint32_t repeat)
+{
+    static const char *const modes[] = {"Off", "Record", "Play"};
+    int mode = input_replay_get_mode();
+
+    if (event == ODROID_DIALOG_PREV) {
+        input_replay_set_mode((mode + 2) % 3);
+    } else if (event == ODROID_DIALOG_NEXT) {
+        input_replay_set_mode((mode + 1) % 3);
+    }
+
+    // Starts with the next game, see input_replay.h
+    strcpy(option->value, modes[input_replay_get_mode()]);
+    return event == ODROID_DIALOG_ENTER;
+}
+#endif
+
+static bool cpu_clock_update_cb(odroid_dialog_choice_t *option, odroid_dialog_event_t event, uint32_t repeat)
+{
+    // Auto first, then the levels from the fastest down
+    int count = CPU_CLOCK_LEVEL_COUNT + 1;
+    int pos = (cpu_clock_get_mode() + 1) % count;
+
+    if (event == ODROID_DIALOG_PREV) {
+        cpu_clock_set_mode((pos + count - 2) % count);
+    } else if (event == ODROID_DIALOG_NEXT) {
+        cpu_clock_set_mode(pos % count);
+    }
+
+    if (cpu_clock_get_mode() == CPU_CLOCK_AUTO) {
+        sprintf(option->value, "Auto %lu", cpu_clock_get_mhz());
+    } else {
+        sprintf(option->value, "%lu MHz", cpu_clock_get_mhz());
+    }
+    return event == ODROID_DIALOG_ENTER;
+}
+
+void odroid_overlay_set_debug_options(odroid_dialog_choice_t *extra_options)
+{
+    debug_extra_options = extra_options;
+}
+
+void odroid_overlay_set_dialog_decoration(odroid_overlay_decoration_t decoration)
+{
+    dialog_decoration = decoration;
+}
+
+// In kB: now (at most) / size
+static void format_mem_usage(char *str, size_t len, size_t used, size_t peak, size_t size)
+{
+    snprintf(str, len, "%u (%u)/%u kB", (used + 1023) / 1024, (peak + 1023) / 1024, size / 1024);
+}
+
 int odroid_overlay_game_debug_menu(void)
 {
-    odroid_dialog_choice_t options[12] = {
+    odroid_audio_stats_t audio = odroid_audio_get_stats();
+    char underruns_str[12];
+    char overruns_str[12];
+    char late_str[12];
+    char fill_str[12];
+    frame_stats_summary_t frames = frame_stats_summary();
+    char percentiles_str[24];
+    char late_frames_str[20];
+    char longest_str[24];
+    char cpu_clock_str[12];
+    char rewind_str[24];
+    char stack_str[16];
+    char heap_str[20];
+    char arena_str[EMU_ARENA_COUNT][20];
+    size_t used, peak, size;
+#if PROFILER
+    char profiler_str[4] = "Off";
+#endif
+#if INPUT_REPLAY
+    char input_replay_str[8] = "Off";
+#endif
+
+    snprintf(underruns_str, sizeof(underruns_str), "%lu", audio.underruns);
+    snprintf(overruns_str, sizeof(overruns_str), "%lu", audio.overruns);
+    snprintf(late_str, sizeof(late_str), "%lu", audio.late);
+    snprintf(fill_str, sizeof(fill_str), "%lu", audio.fill);
+    snprintf(percentiles_str, sizeof(percentiles_str), "%lu.%lu/%lu.%lu/%lu.%lu",
+             frames.p50_us / 1000, frames.p50_us / 100 % 10,
+             frames.p95_us / 1000, frames.p95_us / 100 % 10,
+             frames.p99_us / 1000, frames.p99_us / 100 % 10);
+    // Of the last frames, and since the game started
+    snprintf(late_frames_str, sizeof(late_frames_str), "%lu (%lu)", frames.late, frame_stats.late);
+    snprintf(longest_str, sizeof(longest_str), "%lu ms %s", frame_stats.longest_us / 1000,
+             frame_stats_tag_name(frame_stats.longest_tags));
+    if (rewind_enabled()) {
+        snprintf(rewind_str, sizeof(rewind_str), "%lu frames %ukB", rewind_history_frames(),
+                 rewind_history_bytes() / 1024);
+    } else {
+        strcpy(rewind_str, "Off");
+    }
+    snprintf(stack_str, sizeof(stack_str), "%u/%u kB", (mem_stats_stack_peak() + 1023) / 1024,
+             mem_stats_stack_size() / 1024);
+    mem_stats_heap(&used, &peak, &size);
+    format_mem_usage(heap_str, sizeof(heap_str), used, peak, size);
+    for (int i = 0; i < EMU_ARENA_COUNT; i++) {
+        emu_arena_usage(i, &used, &peak, &size);
+        format_mem_usage(arena_str[i], sizeof(arena_str[i]), used, peak, size);
+    }
+
+    odroid_dialog_choice_t options[32] = {
         {10, "Screen Res", "A", 1, NULL},
         {10, "Game Res", "B", 1, NULL},
         {10, "Scaled Res", "C", 1, NULL},
         {10, "Cheats", "C", 1, NULL},
-        {10, "Rewind", "C", 1, NULL},
         {10, "Registers", "C", 1, NULL},
+        {0, "------------------", "", 1, NULL},
+        {0, "Audio underruns", underruns_str, 1, NULL},
+        {0, "Audio overruns", overruns_str, 1, NULL},
+        {0, "Audio late", late_str, 1, NULL},
+        {0, "Audio buffered", fill_str, 1, NULL},
+        {0, "Frame ms 50/95/99%", percentiles_str, 1, NULL},
+        {0, "Late frames", late_frames_str, 1, NULL},
+        {0, "Longest stall", longest_str, 1, NULL},
+        {0, "Rewind", rewind_str, 1, NULL},
+        {0, "Stack peak", stack_str, 1, NULL},
+        {0, "Heap", heap_str, 1, NULL},
+        {0, "DTCM", arena_str[EMU_ARENA_DTCM], 1, NULL},
+        {0, "RAM_EMU", arena_str[EMU_ARENA_RAM_EMU], 1, NULL},
+        {0, "AHBRAM", arena_str[EMU_ARENA_AHBRAM], 1, NULL},
+        {22, "CPU clock", cpu_clock_str, 1, &cpu_clock_update_cb},
+#if PROFILER
+        {20, "Profiler", profiler_str, 1, &profiler_update_cb},
+#endif
+#if INPUT_REPLAY
+        {21, "Input replay", input_replay_str, 1, &input_replay_update_cb},
+#endif
         ODROID_DIALOG_CHOICE_LAST
     };
 
+    odroid_dialog_choice_t last = ODROID_DIALOG_CHOICE_LAST;
+    int count = get_dialog_items_count(options);
+    int extra_count = get_dialog_items_count(debug_extra_options);
+
+    // Leave room for the terminating entry
+    for (int i = 0; i < extra_count && count < 31; i++) {
+        options[count++] = debug_extra_options[i];
+    }
+    options[count] = last;
+
     while (odroid_input_key_is_pressed(ODROID_INPUT_ANY))
         wdog_refresh();
     return odroid_overlay_dialog("Debugging", options, 0);
@@ -641,15 +883,23 @@ int odroid_overlay_game_debug_menu(void)
 
 int odroid_overlay_game_menu(odroid_dialog_choice_t *extra_options)
 {
+#if STATE_SAVING == 1 && STATE_SLOTS > 1
+    static char slot_value[16];
+#endif
+
     odroid_dialog_choice_t choices[] = {
         // {0, "Continue", "",  1, NULL},
 #if STATE_SAVING == 1
         {10, "Save & Continue", "",  1, NULL},
+#if STATE_SLOTS > 1
+        {15, "Slot", slot_value, 1, &state_slot_update_cb},
+#endif
         {20, "Save & Quit", "", 1, NULL},
         {30, "Reload", "", 1, NULL},
 #endif
         {40, "Options", "", 1, NULL},
         // {50, "Tools", "", 1, NULL},
+        {50, "Debug", "", 1, NULL},
         {90, "Power off", "", 1, NULL},
         {100, "Quit to menu", "", 1, NULL},
         ODROID_DIALOG_CHOICE_LAST
@@ -661,20 +911,23 @@ int odroid_overlay_game_menu(odroid_dialog_choice_t *extra_options)
     odroid_audio_mute(true);
     while (odroid_input_key_is_pressed(ODROID_INPUT_ANY))
         wdog_refresh();
+    state_slot_capture_thumb();
     draw_game_status_bar(stats);
 
     lcd_sync();
 
+    state_slot_menu_init(ACTIVE_FILE);
     int r = odroid_overlay_dialog("Retro-Go", choices, 0);
+    state_slot_menu_done();
 
     // Clear startup file so we boot into the retro-go gui
     odroid_settings_StartupFile_set(NULL);
 
     switch (r)
     {
-        case 10: odroid_system_emu_save_state(0); break;
-        case 20: odroid_system_emu_save_state(0); odroid_system_switch_app(0); break;
-        case 30: odroid_system_emu_load_state(0); break; // TODO: Reload emulator?
+        case 10: odroid_system_emu_save_state(state_slot_get()); break;
+        case 20: odroid_system_emu_save_state(state_slot_get()); odroid_system_switch_app(0); break;
+        case 30: odroid_system_emu_load_state(state_slot_get()); break; // TODO: Reload emulator?
         case 40: odroid_overlay_game_settings_menu(extra_options); break;
         case 50: odroid_overlay_game_debug_menu(); break;
         case 90: odroid_system_sleep(); break;
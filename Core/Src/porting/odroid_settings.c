@@ -1,10 +1,19 @@
 #include <assert.h>
+#include <stddef.h>
 #include <string.h>
 
 #include "odroid_system.h"
 #include "odroid_settings.h"
 #include "main.h"
 #include "appid.h"
+#include "common.h"
+#include "crc32.h"
+#include "game_profile.h"
+#include "gw_flash.h"
+#include "gw_linker.h"
+#include "gw_timer.h"
+#include "store_async.h"
+#include "utils.h"
 
 #define CONFIG_MAGIC 0xcafef00d
 #define ODROID_APPID_COUNT 4
@@ -25,6 +34,8 @@ typedef struct app_config {
     uint8_t sprite_limit;
 } app_config_t;
 
+// magic, version and crc32 aren't stored anymore, see config_fields for how
+// the rest is. persistent_config_v4_t is what firmware from before the log had.
 typedef struct persistent_config {
     uint32_t magic;
     uint8_t version;
@@ -32,6 +43,7 @@ typedef struct persistent_config {
     uint8_t backlight;
     uint8_t start_action;
     uint8_t volume;
+    uint8_t audio_latency;
     uint8_t font_size;
     uint8_t startup_app;
     void *startup_file;
@@ -40,18 +52,51 @@ typedef struct persistent_config {
     uint16_t main_menu_selected_tab;
     uint16_t main_menu_cursor;
 
+    uint16_t favorites_count;
+    uint32_t favorites[FAVORITES_MAX];
+    uint16_t recent_count;
+    uint32_t recent[RECENT_MAX];
+
     app_config_t app[APPID_COUNT];
 
     uint32_t crc32;
+
+    // Only in the log, firmware from before it had no such settings
+    uint8_t sleep_mode;
+    uint8_t game_profiles_count;
+    game_profile_t game_profiles[GAME_PROFILE_LEARNED_MAX];
 } persistent_config_t;
 
+// What firmware from before the log stored, as version 4. The configflash
+// grew downwards by a sector for the log, so that's config_log[1] now.
+typedef struct persistent_config_v4 {
+    uint32_t magic;
+    uint8_t version;
+
+    uint8_t backlight;
+    uint8_t start_action;
+    uint8_t volume;
+    uint8_t font_size;
+    uint8_t startup_app;
+    void *startup_file;
+
+    uint16_t main_menu_timeout_s;
+    uint16_t main_menu_selected_tab;
+    uint16_t main_menu_cursor;
+
+    app_config_t app[APPID_COUNT];
+
+    uint32_t crc32;
+} persistent_config_v4_t;
+
 static const persistent_config_t persistent_config_default = {
     .magic = CONFIG_MAGIC,
-    .version = 4,
+    .version = 7,
 
     .backlight = ODROID_BACKLIGHT_LEVEL6,
     .start_action = ODROID_START_ACTION_RESUME,
     .volume = ODROID_AUDIO_VOLUME_MAX / 2, // Too high volume can cause brown out if the battery isn't connected.
+    .audio_latency = ODROID_AUDIO_LATENCY_NORMAL,
     .font_size = 8,
     .startup_app = 0,
     .main_menu_timeout_s = 60 * 10, // Turn off after 10 minutes of idle time in the main menu
@@ -75,45 +120,328 @@ static const persistent_config_t persistent_config_default = {
         {0}, // PCE
         {0}, // GW
     },
+    .sleep_mode = ODROID_SLEEP_STANDBY,
 };
 
-__attribute__((section (".configflash"))) __attribute__((aligned(4096))) persistent_config_t persistent_config_flash;
+/*
+ * The settings are kept in the configflash as a log of records, each holding
+ * the value of one field of persistent_config_t. A commit only appends the
+ * fields that changed since the last one, so it usually programs a few bytes
+ * into flash that is already erased. When the sector is full, all fields are
+ * written to the other sector, which has a newer sequence number once its
+ * header is programmed. The header goes last, an interrupted commit leaves
+ * the previous state intact.
+ *
+ * Changes made while browsing the launcher are committed with
+ * odroid_settings_commit_later(): odroid_settings_idle() does it once
+ * nothing changed for CONFIG_IDLE_US, so a run of them is a single append.
+ * odroid_settings_commit() writes whatever is pending right away, before
+ * switching apps or going to sleep.
+ *
+ * The keys below must never be reused for something else. Records of keys
+ * this firmware doesn't know, or of a different size, are skipped, so fields
+ * can be added and changed without losing the others. New fields start out
+ * with their default value.
+ */
+
+#define CONFIG_LOG_MAGIC   0x31474643 // "CFG1"
+#define CONFIG_SECTOR_SIZE (4 * 1024)
+#define CONFIG_KEY_ERASED  0xffff
+#define CONFIG_PAGE_SIZE   256
+#define CONFIG_IDLE_US     (2 * 1000 * 1000)
+
+#define ROUND_UP(x, n) (((x) + (n) - 1) & ~((n) - 1))
+
+typedef struct {
+    uint32_t magic;
+    uint32_t seq;     // Higher is newer
+} config_sector_t;
+
+typedef struct {
+    uint16_t key;
+    uint16_t size;    // Of the value following the record, padded to 4 bytes
+    uint32_t crc;     // crc32 of the record with crc = 0 and the value
+} config_record_t;
+
+typedef struct {
+    uint16_t key;
+    uint16_t offset;
+    uint16_t size;
+} config_field_t;
+
+#define CONFIG_FIELD(key, field) {key, offsetof(persistent_config_t, field), sizeof(((persistent_config_t *) 0)->field)}
+
+static const config_field_t config_fields[] = {
+    CONFIG_FIELD(1, backlight),
+    CONFIG_FIELD(2, start_action),
+    CONFIG_FIELD(3, volume),
+    CONFIG_FIELD(4, audio_latency),
+    CONFIG_FIELD(5, font_size),
+    CONFIG_FIELD(6, startup_app),
+    CONFIG_FIELD(7, startup_file),
+    CONFIG_FIELD(8, main_menu_timeout_s),
+    CONFIG_FIELD(9, main_menu_selected_tab),
+    CONFIG_FIELD(10, main_menu_cursor),
+    CONFIG_FIELD(11, favorites_count),
+    CONFIG_FIELD(12, favorites),
+    CONFIG_FIELD(13, recent_count),
+    CONFIG_FIELD(14, recent),
+    CONFIG_FIELD(15, sleep_mode),
+    CONFIG_FIELD(16, game_profiles_count),
+    CONFIG_FIELD(17, game_profiles),
+    CONFIG_FIELD(0x100 + APPID_LAUNCHER, app[APPID_LAUNCHER]),
+    CONFIG_FIELD(0x100 + APPID_GB, app[APPID_GB]),
+    CONFIG_FIELD(0x100 + APPID_NES, app[APPID_NES]),
+    CONFIG_FIELD(0x100 + APPID_SMS, app[APPID_SMS]),
+    CONFIG_FIELD(0x100 + APPID_PCE, app[APPID_PCE]),
+    CONFIG_FIELD(0x100 + APPID_GW, app[APPID_GW]),
+};
+
+// Enough for a record of every field
+#define CONFIG_RECORDS_SIZE 1024
+
+__attribute__((section (".configflash"))) __attribute__((aligned(4096))) uint8_t config_log[2][CONFIG_SECTOR_SIZE];
 persistent_config_t persistent_config_ram;
 
+// What the log holds, to find the fields that changed
+static persistent_config_t persistent_config_committed;
+static int log_sector = -1;
+static uint32_t log_pos;
+static uint32_t log_seq;
+
+static bool commit_pending;
+static uint32_t commit_pending_us;   // Of the last change
+
+static uint8_t config_records[CONFIG_RECORDS_SIZE] __attribute__((aligned(4)));
+static uint8_t config_page[CONFIG_PAGE_SIZE] __attribute__((aligned(4)));
+
+static const config_field_t *config_field(uint16_t key)
+{
+    for (int i = 0; i < ARRAY_SIZE(config_fields); i++) {
+        if (config_fields[i].key == key) {
+            return &config_fields[i];
+        }
+    }
+    return NULL;
+}
+
+static uint32_t config_record_crc(const config_record_t *record, const uint8_t *value)
+{
+    config_record_t header = *record;
+
+    header.crc = 0;
+    uint32_t crc = crc32_le(0, (unsigned char *) &header, sizeof(header));
+    return crc32_le(crc, (unsigned char *) value, record->size);
+}
+
+// Applies the records of the sector, returns where the next one goes
+static uint32_t config_log_replay(int sector)
+{
+    uint32_t pos = sizeof(config_sector_t);
+
+    while (pos + sizeof(config_record_t) <= CONFIG_SECTOR_SIZE) {
+        config_record_t record;
+        const uint8_t *value = &config_log[sector][pos + sizeof(record)];
+
+        memcpy(&record, &config_log[sector][pos], sizeof(record));
+        if (record.key == CONFIG_KEY_ERASED) {
+            return pos;
+        }
+
+        if (pos + sizeof(record) + ROUND_UP(record.size, 4) > CONFIG_SECTOR_SIZE ||
+            config_record_crc(&record, value) != record.crc) {
+            // Interrupted while writing it, start over in the other sector
+            printf("Config: Bad record at offset %lu\n", pos);
+            return CONFIG_SECTOR_SIZE;
+        }
+
+        const config_field_t *field = config_field(record.key);
+        if (field != NULL && field->size == record.size) {
+            memcpy((uint8_t *) &persistent_config_ram + field->offset, value, record.size);
+        }
+
+        pos += sizeof(record) + ROUND_UP(record.size, 4);
+    }
+
+    return pos;
+}
+
+// Programs data at pos of the sector, which has to be erased there
+static void config_log_program(int sector, uint32_t pos, const uint8_t *data, uint32_t size)
+{
+    uint32_t address = &config_log[sector][0] - &__EXTFLASH_BASE__;
+
+    // Keep the writes in order
+    store_async_flush();
+
+    OSPI_DisableMemoryMappedMode();
+    while (size > 0) {
+        uint32_t page_pos = pos & ~(CONFIG_PAGE_SIZE - 1);
+        uint32_t n = MIN(size, page_pos + CONFIG_PAGE_SIZE - pos);
+
+        // Programming 0xff leaves the rest of the page as it is
+        memset(config_page, 0xff, CONFIG_PAGE_SIZE);
+        memcpy(&config_page[pos - page_pos], data, n);
+        OSPI_Program(address + page_pos, config_page, CONFIG_PAGE_SIZE);
+
+        pos += n;
+        data += n;
+        size -= n;
+    }
+    OSPI_EnableMemoryMappedMode();
+}
+
+// Adds the record of a field to config_records, returns the new size
+static uint32_t config_record_add(uint32_t size, const config_field_t *field)
+{
+    config_record_t record = {
+        .key = field->key,
+        .size = field->size,
+    };
+    const uint8_t *value = (const uint8_t *) &persistent_config_ram + field->offset;
+
+    assert(size + sizeof(record) + ROUND_UP(field->size, 4) <= CONFIG_RECORDS_SIZE);
+
+    record.crc = config_record_crc(&record, value);
+    memcpy(&config_records[size], &record, sizeof(record));
+    memset(&config_records[size + sizeof(record)], 0, ROUND_UP(field->size, 4));
+    memcpy(&config_records[size + sizeof(record)], value, field->size);
+
+    return size + sizeof(record) + ROUND_UP(field->size, 4);
+}
+
+// Writes all fields to the other sector and switches to it
+static void config_log_compact(void)
+{
+    int sector = (log_sector == 1) ? 0 : 1;
+    uint32_t size = 0;
+
+    for (int i = 0; i < ARRAY_SIZE(config_fields); i++) {
+        size = config_record_add(size, &config_fields[i]);
+    }
+
+    printf("Config: Writing all settings to sector %d\n", sector);
+
+    store_erase(config_log[sector], CONFIG_SECTOR_SIZE);
+    config_log_program(sector, sizeof(config_sector_t), config_records, size);
+
+    config_sector_t header = {
+        .magic = CONFIG_LOG_MAGIC,
+        .seq = log_seq + 1,
+    };
+    config_log_program(sector, 0, (const uint8_t *) &header, sizeof(header));
+
+    log_sector = sector;
+    log_seq = header.seq;
+    log_pos = sizeof(config_sector_t) + size;
+}
+
+// Takes over the settings stored by firmware from before the log
+static bool config_import_legacy(void)
+{
+    persistent_config_v4_t legacy;
+
+    memcpy(&legacy, config_log[1], sizeof(legacy));
+    if (legacy.magic != CONFIG_MAGIC || legacy.version != 4) {
+        return false;
+    }
+
+    uint32_t crc = legacy.crc32;
+    legacy.crc32 = 0;
+    if (crc32_le(0, (unsigned char *) &legacy, sizeof(legacy)) != crc) {
+        return false;
+    }
+
+    // What version 4 didn't have keeps its default
+    persistent_config_ram.backlight = legacy.backlight;
+    persistent_config_ram.start_action = legacy.start_action;
+    persistent_config_ram.volume = legacy.volume;
+    persistent_config_ram.font_size = legacy.font_size;
+    persistent_config_ram.startup_app = legacy.startup_app;
+    persistent_config_ram.startup_file = legacy.startup_file;
+    persistent_config_ram.main_menu_timeout_s = legacy.main_menu_timeout_s;
+    persistent_config_ram.main_menu_selected_tab = legacy.main_menu_selected_tab;
+    persistent_config_ram.main_menu_cursor = legacy.main_menu_cursor;
+    memcpy(persistent_config_ram.app, legacy.app, sizeof(legacy.app));
+    return true;
+}
+
 void odroid_settings_init()
 {
-    memcpy(&persistent_config_ram, &persistent_config_flash, sizeof(persistent_config_t));
+    memcpy(&persistent_config_ram, &persistent_config_default, sizeof(persistent_config_t));
 
-    if (persistent_config_ram.magic != CONFIG_MAGIC) {
-        printf("Config: Magic mismatch. Expected 0x%08x, got 0x%08lx\n", CONFIG_MAGIC, persistent_config_ram.magic);
-        odroid_settings_reset();
-        return;
+    log_sector = -1;
+    log_seq = 0;
+    for (int i = 0; i < 2; i++) {
+        config_sector_t header;
+
+        memcpy(&header, config_log[i], sizeof(header));
+        if (header.magic == CONFIG_LOG_MAGIC && (log_sector < 0 || header.seq > log_seq)) {
+            log_sector = i;
+            log_seq = header.seq;
+        }
+    }
+
+    if (log_sector >= 0) {
+        log_pos = config_log_replay(log_sector);
+        memcpy(&persistent_config_committed, &persistent_config_ram, sizeof(persistent_config_t));
+    } else if (config_import_legacy()) {
+        printf("Config: Imported the settings of the previous firmware\n");
+    } else {
+        printf("Config: No settings found, using the defaults\n");
     }
+}
+
+void odroid_settings_commit()
+{
+#ifdef DISABLE_STORE
+    return;
+#endif
 
-    if (persistent_config_ram.version != persistent_config_default.version) {
-        printf("Config: New config version, resetting settings.\n");
-        odroid_settings_reset();
+    commit_pending = false;
+
+    // Nothing to append to yet, or the last commit was interrupted
+    if (log_sector < 0 || log_pos > CONFIG_SECTOR_SIZE - sizeof(config_record_t)) {
+        config_log_compact();
+        memcpy(&persistent_config_committed, &persistent_config_ram, sizeof(persistent_config_t));
         return;
     }
 
-    // Calculate crc32 of the whole struct with the crc32 value set to 0
-    persistent_config_ram.crc32 = 0;
-    persistent_config_ram.crc32 = crc32_le(0, (unsigned char *) &persistent_config_ram, sizeof(persistent_config_t));
+    uint32_t size = 0;
+    for (int i = 0; i < ARRAY_SIZE(config_fields); i++) {
+        const config_field_t *field = &config_fields[i];
+
+        if (memcmp((uint8_t *) &persistent_config_ram + field->offset,
+                   (uint8_t *) &persistent_config_committed + field->offset, field->size) != 0) {
+            size = config_record_add(size, field);
+        }
+    }
 
-    if (persistent_config_ram.crc32 != persistent_config_flash.crc32) {
-        printf("Config: CRC32 mismatch. Expected 0x%08lx, got 0x%08lx\n", persistent_config_ram.crc32, persistent_config_flash.crc32);
-        odroid_settings_reset();
+    if (size == 0) {
         return;
     }
+
+    if (log_pos + size <= CONFIG_SECTOR_SIZE) {
+        config_log_program(log_sector, log_pos, config_records, size);
+        log_pos += size;
+    } else {
+        config_log_compact();
+    }
+
+    memcpy(&persistent_config_committed, &persistent_config_ram, sizeof(persistent_config_t));
 }
 
-void odroid_settings_commit()
+void odroid_settings_commit_later()
 {
-    // Calculate crc32 of the whole struct with the crc32 value set to 0
-    persistent_config_ram.crc32 = 0;
-    persistent_config_ram.crc32 = crc32_le(0, (unsigned char *) &persistent_config_ram, sizeof(persistent_config_t));
+    commit_pending = true;
+    commit_pending_us = gw_timer_us();
+}
 
-    store_save((const uint8_t *) &persistent_config_flash, (const uint8_t *) &persistent_config_ram, sizeof(persistent_config_t));
+void odroid_settings_idle()
+{
+    if (commit_pending && gw_timer_us() - commit_pending_us >= CONFIG_IDLE_US) {
+        odroid_settings_commit();
+    }
 }
 
 void odroid_settings_reset()
@@ -185,6 +513,26 @@ void odroid_settings_Volume_set(int32_t value)
 }
 
 
+int32_t odroid_settings_AudioLatency_get()
+{
+    return persistent_config_ram.audio_latency;
+}
+void odroid_settings_AudioLatency_set(int32_t value)
+{
+    persistent_config_ram.audio_latency = value;
+}
+
+
+int32_t odroid_settings_SleepMode_get()
+{
+    return persistent_config_ram.sleep_mode;
+}
+void odroid_settings_SleepMode_set(int32_t value)
+{
+    persistent_config_ram.sleep_mode = value;
+}
+
+
 int32_t odroid_settings_AudioSink_get()
 {
   return odroid_settings_int32_get(Key_AudioSink, ODROID_AUDIO_SINK_SPEAKER);
@@ -262,6 +610,42 @@ void odroid_settings_MainMenuCursor_set(uint16_t value)
     persistent_config_ram.main_menu_cursor = value;
 }
 
+uint32_t odroid_settings_Favorites_get(const uint32_t **ids)
+{
+    *ids = persistent_config_ram.favorites;
+    return MIN(persistent_config_ram.favorites_count, FAVORITES_MAX);
+}
+void odroid_settings_Favorites_set(const uint32_t *ids, uint32_t count)
+{
+    count = MIN(count, FAVORITES_MAX);
+    memcpy(persistent_config_ram.favorites, ids, count * sizeof(uint32_t));
+    persistent_config_ram.favorites_count = count;
+}
+
+uint32_t odroid_settings_Recent_get(const uint32_t **ids)
+{
+    *ids = persistent_config_ram.recent;
+    return MIN(persistent_config_ram.recent_count, RECENT_MAX);
+}
+void odroid_settings_Recent_set(const uint32_t *ids, uint32_t count)
+{
+    count = MIN(count, RECENT_MAX);
+    memcpy(persistent_config_ram.recent, ids, count * sizeof(uint32_t));
+    persistent_config_ram.recent_count = count;
+}
+
+uint32_t odroid_settings_GameProfiles_get(const game_profile_t **profiles)
+{
+    *profiles = persistent_config_ram.game_profiles;
+    return MIN(persistent_config_ram.game_profiles_count, GAME_PROFILE_LEARNED_MAX);
+}
+void odroid_settings_GameProfiles_set(const game_profile_t *profiles, uint32_t count)
+{
+    count = MIN(count, GAME_PROFILE_LEARNED_MAX);
+    memmove(persistent_config_ram.game_profiles, profiles, count * sizeof(game_profile_t));
+    persistent_config_ram.game_profiles_count = count;
+}
+
 
 int32_t odroid_settings_Palette_get()
 {
@@ -5,6 +5,13 @@
 #include "gw_linker.h"
 #include "gui.h"
 #include "main.h"
+#include "common.h"
+#include "gw_dirty.h"
+#include "gw_timer.h"
+#include "state_slots.h"
+#include "rg_recent.h"
+#include "game_profile.h"
+#include "frame_watch.h"
 
 static rg_app_desc_t currentApp;
 static runtime_stats_t statistics;
@@ -20,24 +27,31 @@ void odroid_system_panic(const char *reason, const char *function, const char *f
 void odroid_system_init(int appId, int sampleRate)
 {
     currentApp.id = appId;
+    // Still those of the emulator after a return to the launcher
+    currentApp.gameId = 0;
+    currentApp.loadState = NULL;
+    currentApp.saveState = NULL;
 
     odroid_settings_init();
     odroid_audio_init(sampleRate);
     odroid_display_init();
 
-    counters.resetTime = get_elapsed_time();
+    counters.resetTime = gw_timer_us();
 
     printf("%s: System ready!\n\n", __func__);
 }
 
 void odroid_system_emu_init(state_handler_t load, state_handler_t save, netplay_callback_t netplay_cb)
 {
-    // currentApp.gameId = crc32_le(0, buffer, sizeof(buffer));
-    currentApp.gameId = 0;
+    // From parse_roms.py, 0 for a ROM it didn't compute it for
+    currentApp.gameId = (ACTIVE_FILE != NULL) ? ACTIVE_FILE->checksum : 0;
     currentApp.loadState = load;
     currentApp.saveState = save;
+    state_slot_play_set(0);
 
     printf("%s: Init done. GameId=%08lX\n", __func__, currentApp.gameId);
+
+    game_profile_apply(currentApp.gameId);
 }
 
 rg_app_desc_t *odroid_system_get_app()
@@ -49,6 +63,12 @@ rg_app_desc_t *odroid_system_get_app()
 bool odroid_system_emu_load_state(int slot)
 {
 #if STATE_SAVING == 1
+    // Not a ROM of the external flash, it has no slots
+    if (ACTIVE_FILE->save_size == 0) {
+        return false;
+    }
+
+    state_slot_set(slot);
     if (currentApp.loadState != NULL) {
         (*currentApp.loadState)("");
     }
@@ -59,8 +79,14 @@ bool odroid_system_emu_load_state(int slot)
 bool odroid_system_emu_save_state(int slot)
 {
 #if STATE_SAVING == 1
+    if (ACTIVE_FILE->save_size == 0) {
+        return false;
+    }
+
+    state_slot_set(slot);
     if (currentApp.saveState != NULL) {
         (*currentApp.saveState)("");
+        recent_set_has_save(ACTIVE_FILE);
     }
 #endif
     return true;
@@ -91,6 +117,9 @@ void odroid_system_switch_app(int app)
         odroid_settings_StartupFile_set(0);
         odroid_settings_commit();
 
+        // Doesn't return if the launcher is still set up
+        launcher_return();
+
         /**
          * Setting these two places in memory tell tim's patched firmware
          * bootloader running in bank 1 (0x08000000) to boot into retro-go
@@ -115,20 +144,21 @@ void odroid_system_switch_app(int app)
     }
 }
 
+// busyTime and resetTime are in microseconds, see gw_timer_us()
 runtime_stats_t odroid_system_get_stats()
 {
-    float tickTime = (get_elapsed_time() - counters.resetTime);
+    float tickTime = (uint32_t) (gw_timer_us() - counters.resetTime);
 
     statistics.battery = odroid_input_read_battery();
     statistics.busyPercent = counters.busyTime / tickTime * 100.f;
-    statistics.skippedFPS = counters.skippedFrames / (tickTime / 1000.f);
-    statistics.totalFPS = counters.totalFrames / (tickTime / 1000.f);
+    statistics.skippedFPS = counters.skippedFrames / (tickTime / 1000000.f);
+    statistics.totalFPS = counters.totalFrames / (tickTime / 1000000.f);
 
     skip = 1;
     counters.busyTime = 0;
     counters.totalFrames = 0;
     counters.skippedFrames = 0;
-    counters.resetTime = get_elapsed_time();
+    counters.resetTime = gw_timer_us();
 
     return statistics;
 }
@@ -139,6 +169,17 @@ void odroid_system_sleep(void)
 
     // odroid_settings_commit();
     gui_save_current_tab();
+    frame_watch_disarm();
+
+    if (odroid_settings_SleepMode_get() != ODROID_SLEEP_SUSPEND) {
+        GW_EnterDeepSleep();
+    }
+
+    GW_Suspend();
 
-    GW_EnterDeepSleep();
+    // The LCD came up with black framebuffers, and the audio stopped
+    odroid_display_set_backlight(odroid_display_get_backlight());
+    gw_dirty_invalidate();
+    odroid_audio_ring_restart();
+    common_emu_state.startup_frames = 0;
 }
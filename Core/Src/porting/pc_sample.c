@@ -0,0 +1,88 @@
+#include <string.h>
+
+#include "main.h"
+#include "frame_watch.h"
+#include "pc_sample.h"
+
+#if PC_SAMPLER
+
+// Read by tools/pcprof.py, cleared by it too
+pc_sample_bin_t pc_sample_bins[PC_SAMPLE_BINS] __attribute__((section (".ahb")));
+uint32_t pc_sample_total __attribute__((section (".ahb")));
+uint32_t pc_sample_dropped __attribute__((section (".ahb")));
+
+#define MAX_PROBES 16
+
+static void pc_sample_record(const uint32_t *frame)
+{
+    uint32_t pc = frame[6];
+    uint32_t next = TIM1->CNT + PC_SAMPLE_INTERVAL;
+    uint32_t i = ((pc >> 1) * 2654435761u) >> (32 - __builtin_ctz(PC_SAMPLE_BINS));
+
+    TIM1->SR = ~TIM_SR_CC1IF;
+
+    // HAL_TIM_IRQHandler() may also clear the flag, go on from the counter
+    TIM1->CCR1 = next > TIM1->ARR ? next - TIM1->ARR - 1 : next;
+
+    pc_sample_total++;
+    for (int probe = 0; probe < MAX_PROBES; probe++) {
+        pc_sample_bin_t *bin = &pc_sample_bins[i];
+
+        if (bin->pc == pc || bin->count == 0) {
+            bin->pc = pc;
+            bin->count++;
+            return;
+        }
+        i = (i + 1) % PC_SAMPLE_BINS;
+    }
+    pc_sample_dropped++;
+}
+
+void pc_sample_init(void)
+{
+    _Static_assert((PC_SAMPLE_BINS & (PC_SAMPLE_BINS - 1)) == 0, "PC_SAMPLE_BINS must be a power of 2");
+
+    // NOLOAD, nothing clears it at boot
+    memset(pc_sample_bins, 0, sizeof(pc_sample_bins));
+    pc_sample_total = 0;
+    pc_sample_dropped = 0;
+
+    // Frozen output compare, it only raises the interrupt
+    TIM1->CCR1 = PC_SAMPLE_INTERVAL;
+    TIM1->SR = ~TIM_SR_CC1IF;
+    TIM1->DIER |= TIM_DIER_CC1IE;
+
+    HAL_NVIC_SetPriority(TIM1_CC_IRQn, 0, 0);
+    HAL_NVIC_EnableIRQ(TIM1_CC_IRQn);
+}
+
+#endif
+
+#if PC_SAMPLER || FRAME_WATCH
+
+// Channel 1 samples, channel 2 is frame_watch.c's
+void __attribute__((used)) pc_sample_irq(const uint32_t *frame)
+{
+#if FRAME_WATCH
+    if (frame_watch_irq(frame)) {
+        // Raised again if channel 1 is pending too
+        return;
+    }
+#endif
+#if PC_SAMPLER
+    pc_sample_record(frame);
+#endif
+}
+
+// The stacked PC is in the exception frame, on the MSP unless in a thread
+__attribute__((naked)) void TIM1_CC_IRQHandler(void)
+{
+    __asm volatile(
+        "tst lr, #4 \n"
+        "ite eq \n"
+        "mrseq r0, msp \n"
+        "mrsne r0, psp \n"
+        "b pc_sample_irq \n");
+}
+
+#endif
@@ -0,0 +1,202 @@
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <hard_pce.h>
+#include "bank_cache_pce.h"
+#include "emu_arena.h"
+#include "emu_snapshot.h"
+#include "lz4_pack.h"
+
+#define PAGE_SIZE 0x2000
+// 1MB, larger ROMs need the SF2 mapper
+#define MAX_BANKS 0x80
+#define CACHE_MAX 16
+// Banks moved per window, a copy from the flash takes about 100 us
+#define MOVES_MAX 4
+
+typedef struct {
+    uint8_t *ram;
+    int16_t bank;       // -1 while the slot is free
+} slot_t;
+
+static const uint8_t *rom;
+static bool enabled;
+static uint32_t frames;
+
+static int8_t page_bank[256];       // ROM bank of every page, -1 if it isn't one
+static uint16_t heat[MAX_BANKS];    // Samples in the bank, halved every window
+static int8_t bank_slot[MAX_BANKS];
+static slot_t slots[CACHE_MAX];
+static int slot_count;
+
+// What rewind and run-ahead take from RAM_EMU once they are turned on, which
+// is after this: run-ahead a snapshot, rewind two and at least a ring for
+// two deltas. They fall back to the AHBRAM for what doesn't fit.
+static size_t ram_emu_reserve(void)
+{
+    size_t snapshot = emu_snapshot_size();
+
+    return 3 * snapshot + 2 * LZ4_PACK_BOUND(snapshot);
+}
+
+// Back to the flash copy, for a reload or reset of the same ROM
+static void unmap_all(const uint8_t *rom_data)
+{
+    if (!enabled || rom != rom_data) {
+        return;
+    }
+
+    for (int p = 0; p < 256; p++) {
+        for (int i = 0; i < slot_count; i++) {
+            if (slots[i].bank >= 0 && MemoryMapR[p] == slots[i].ram) {
+                MemoryMapR[p] = (uint8_t *) &rom[slots[i].bank * PAGE_SIZE];
+            }
+        }
+    }
+}
+
+void pce_bank_cache_init(const uint8_t *rom_data, size_t rom_size)
+{
+    size_t banks = rom_size / PAGE_SIZE;
+    size_t room;
+
+    unmap_all(rom_data);
+
+    rom = rom_data;
+    frames = 0;
+    slot_count = 0;
+    memset(heat, 0, sizeof(heat));
+    memset(bank_slot, -1, sizeof(bank_slot));
+
+    enabled = !emu_arena_contains(rom_data) && banks <= MAX_BANKS && PCE.ROM_SIZE < 192;
+    if (!enabled) {
+        return;
+    }
+
+    // All of it now, the slots are only reassigned while the game runs
+    room = emu_arena_free(EMU_ARENA_RAM_EMU);
+    room = room > ram_emu_reserve() ? room - ram_emu_reserve() : 0;
+    while (slot_count < CACHE_MAX && room >= PAGE_SIZE) {
+        slots[slot_count].ram = emu_arena_alloc(EMU_ARENA_RAM_EMU, PAGE_SIZE, 32);
+        slots[slot_count].bank = -1;
+        slot_count++;
+        room -= PAGE_SIZE;
+    }
+    printf("PCE: Room for %d ROM banks in RAM\n", slot_count);
+
+    enabled = slot_count > 0;
+    if (!enabled) {
+        return;
+    }
+
+    // Mirrors map the same bank more than once
+    for (int p = 0; p < 256; p++) {
+        const uint8_t *ptr = MemoryMapR[p];
+        bool in_rom = ptr >= rom && ptr < rom + banks * PAGE_SIZE && (ptr - rom) % PAGE_SIZE == 0;
+
+        page_bank[p] = in_rom ? (ptr - rom) / PAGE_SIZE : -1;
+    }
+}
+
+void pce_bank_cache_sample(void)
+{
+    if (!enabled) {
+        return;
+    }
+
+    for (int i = 0; i < 8; i++) {
+        int bank = page_bank[PCE.MMR[i]];
+
+        if (bank >= 0 && heat[bank] < UINT16_MAX) {
+            heat[bank]++;
+        }
+    }
+}
+
+// MemoryMapR is only read when a bank is switched in, the MMRs that have it
+// switched in right now are set again
+static void map(int bank, uint8_t *ptr)
+{
+    for (int p = 0; p < 256; p++) {
+        if (page_bank[p] == bank) {
+            MemoryMapR[p] = ptr;
+        }
+    }
+    for (int i = 0; i < 8; i++) {
+        if (page_bank[PCE.MMR[i]] == bank) {
+            pce_bank_set(i, PCE.MMR[i]);
+        }
+    }
+}
+
+static int hottest_uncached(void)
+{
+    int best = -1;
+
+    for (int bank = 0; bank < MAX_BANKS; bank++) {
+        if (bank_slot[bank] < 0 && heat[bank] > 0 && (best < 0 || heat[bank] > heat[best])) {
+            best = bank;
+        }
+    }
+
+    return best;
+}
+
+// A free one first
+static int coldest_slot(void)
+{
+    int best = 0;
+
+    for (int i = 0; i < slot_count; i++) {
+        if (slots[i].bank < 0) {
+            return i;
+        }
+        if (heat[slots[i].bank] < heat[slots[best].bank]) {
+            best = i;
+        }
+    }
+
+    return best;
+}
+
+static void rebalance(void)
+{
+    for (int moves = 0; moves < MOVES_MAX; moves++) {
+        int bank = hottest_uncached();
+        int slot;
+
+        if (bank < 0) {
+            break;
+        }
+
+        slot = coldest_slot();
+        if (slots[slot].bank >= 0) {
+            // Only for a bank that is clearly hotter, or they'd swap back and forth
+            if (2 * heat[slots[slot].bank] >= heat[bank]) {
+                break;
+            }
+            map(slots[slot].bank, (uint8_t *) &rom[slots[slot].bank * PAGE_SIZE]);
+            bank_slot[slots[slot].bank] = -1;
+        }
+
+        memcpy(slots[slot].ram, &rom[bank * PAGE_SIZE], PAGE_SIZE);
+        slots[slot].bank = bank;
+        bank_slot[bank] = slot;
+        map(bank, slots[slot].ram);
+    }
+}
+
+void pce_bank_cache_frame(void)
+{
+    if (!enabled || ++frames < BANK_CACHE_WINDOW) {
+        return;
+    }
+    frames = 0;
+
+    rebalance();
+
+    for (int bank = 0; bank < MAX_BANKS; bank++) {
+        heat[bank] >>= 1;
+    }
+}
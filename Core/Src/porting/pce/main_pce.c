@@ -9,20 +9,28 @@
 
 #include <hard_pce.h>
 #include <romdb_pce.h>
-#include "lz4_depack.h"
+#include "rom_loader.h"
+#include "save_pack.h"
+#include "state_slots.h"
 #include <assert.h>
-#include "miniz.h"
 #include <gfx.h>
 #include "main.h"
 #include "bilinear.h"
 #include "gw_lcd.h"
+#include "gw_blit.h"
 #include "gw_linker.h"
 #include "gw_buttons.h"
 #include "rom_manager.h"
 #include "common.h"
 #include "sound_pce.h"
+#include "pcm.h"
 #include "appid.h"
-#include "lzma.h"
+#include "boot_trace.h"
+#include "emu_arena.h"
+#include "profiler.h"
+#include "log_ring.h"
+#include "emu_snapshot.h"
+#include "bank_cache_pce.h"
 
 //#define PCE_SHOW_DEBUG
 //#define XBUF_WIDTH 	(480 + 32)
@@ -56,14 +64,15 @@ typedef struct
 
 static uint16_t mypalette[256];
 static int current_height, current_width;
+// Source column and row of every LCD column and row, see osd_gfx_set_mode()
+static uint16_t scale_x[GW_LCD_WIDTH];
+static uint16_t scale_y[GW_LCD_HEIGHT];
+static int render_height;
 static short audioBuffer_pce[ AUDIO_BUFFER_LENGTH_PCE * 2];
 static uint8_t emulator_framebuffer_pce[XBUF_WIDTH * XBUF_HEIGHT];
-static uint8_t OBJ_CACHE_buf[0x10000];
 static uint8_t PCE_EXRAM_BUF[0x8000];
 static int framePerSecond=0;
 
-// TODO: Move to lcd.c/h
-extern LTDC_HandleTypeDef hltdc;
 static char pce_log[100];
 const char SAVESTATE_HEADER[8] = "PCE_V004";
 
@@ -107,18 +116,52 @@ const svar_t SaveStateVars[] =
     SVAR_END
 };
 
+// SaveStateVars without the names, filled in by app_main_pce()
+static emu_snapshot_block_t snapshot_blocks[sizeof(SaveStateVars) / sizeof(SaveStateVars[0])];
+
 uint8_t *osd_gfx_framebuffer(void){
     return emulator_framebuffer_pce + FB_INTERNAL_OFFSET;
 }
 
+// The sprite cache is read for every sprite line drawn, in DTCM if it fits
 void* osd_alloc(size_t size) {
     assert(size==0x10000);
-    return OBJ_CACHE_buf;
+    void *buf = emu_arena_try_alloc(EMU_ARENA_DTCM, size, 32);
+
+    // The core doesn't check, it can't run without it
+    if (buf == NULL) {
+        printf("PCE: No room for the sprite cache\n");
+        odroid_system_switch_app(0);
+    }
+    return buf;
 }
 
 void osd_gfx_set_mode(int width, int height) {
+    if (width != current_width || height != current_height) {
+        // The core redraws every line of the active display area each
+        // frame, only a mode change can leave stale pixels behind.
+        memset(emulator_framebuffer_pce, 0, sizeof(emulator_framebuffer_pce));
+    }
     current_width = width;
     current_height = height;
+
+    render_height = 0;
+    if (width <= 0 || height <= 0) {
+        return;
+    }
+
+    // Nearest neighbour, 16.16 fixed point. Horizontally the frame always
+    // fills the LCD, vertically it is only scaled down when it doesn't fit.
+    uint32_t step = (width << 16) / GW_LCD_WIDTH;
+    for (int x = 0; x < GW_LCD_WIDTH; x++) {
+        scale_x[x] = (x * step) >> 16;
+    }
+
+    render_height = MIN(height, GW_LCD_HEIGHT);
+    step = (height << 16) / render_height;
+    for (int y = 0; y < render_height; y++) {
+        scale_y[y] = (y * step) >> 16;
+    }
 }
 
 void osd_gfx_init(void) {
@@ -133,120 +176,101 @@ static void netplay_callback(netplay_event_t event, void *arg) {
     // Where we're going we don't need netplay!
 }
 
+// Only the tiles and sprites whose patterns differ in the restored VRAM are
+// decoded again, 32 bytes a tile and 4 tiles a sprite. Clearing the whole
+// cache made every load, and run-ahead or rewind with them, drop frames.
+static void state_restoring(const emu_snapshot_block_t *block, const uint8_t *src)
+{
+    if (block->ptr != PCE.VRAM) {
+        return;
+    }
+
+    for (int tile = 0; tile < 2048; tile++) {
+        if (memcmp(&PCE.VRAM[tile * 32], &src[tile * 32], 32) != 0) {
+            TILE_CACHE[tile] = 0;
+            SPR_CACHE[tile / 4] = 0;
+        }
+    }
+}
+
+// The memory map and caches that follow from the state
+static void state_restored(void)
+{
+    for(int i = 0; i < 8; i++) {
+        pce_bank_set(i, PCE.MMR[i]);
+    }
+    osd_gfx_set_mode(IO_VDC_SCREEN_WIDTH, IO_VDC_SCREEN_HEIGHT);
+}
+
+static const emu_snapshot_core_t snapshot_core = {
+    .blocks = snapshot_blocks,
+    .restoring = &state_restoring,
+    .restored = &state_restored,
+};
+
 static bool SaveState(char *pathName) {
     int pos=0;
     uint8_t *pce_save_buf = emulator_framebuffer_pce;
-    memset(pce_save_buf, 0x00, 76*1024); // 76K save size
 
-    uint8_t *pce_save_header=(uint8_t *)SAVESTATE_HEADER;
-    for(int i=0;i<sizeof(SAVESTATE_HEADER);i++) {
-        pce_save_buf[pos]=pce_save_header[i];
-        pos++;
-    }
+    memcpy(pce_save_buf, SAVESTATE_HEADER, sizeof(SAVESTATE_HEADER));
+    pos += sizeof(SAVESTATE_HEADER);
     pce_save_buf[pos]=0; pos++;
     uint32_t *crc_ptr = (uint32_t *)(pce_save_buf + pos);
     crc_ptr[0] = PCE.ROM_CRC; pos+=sizeof(uint32_t);
 
-    for (int i = 0; SaveStateVars[i].len > 0; i++) {
-        uint8_t *pce_save_ptr = (uint8_t *)SaveStateVars[i].ptr;
-        for(int j=0;j<SaveStateVars[i].len;j++) {
-            pce_save_buf[pos]=pce_save_ptr[j];
-            pos++;
-        }
-    }
+    pos += emu_snapshot_save(&pce_save_buf[pos], 76*1024 - pos);
     assert(pos<76*1024);
-    store_save(ACTIVE_FILE->save_address, pce_save_buf, 76*1024);
+    memset(&pce_save_buf[pos], 0x00, 76*1024 - pos); // 76K save size
+    save_pack_store(state_slot_current(), ACTIVE_FILE->save_size, pce_save_buf, 76*1024);
     sprintf(pce_log,"%08lX",PCE.ROM_CRC);
+    // Don't leave the save data around in the guard bands of the frame
     memset(emulator_framebuffer_pce,0,sizeof(emulator_framebuffer_pce));
     return false;
 }
 
 static bool LoadState(char *pathName) {
-    uint8_t *pce_save_buf = (uint8_t *)ACTIVE_FILE->save_address;
+    size_t size;
     if (ACTIVE_FILE->save_size==0) return true;
     sprintf(pce_log,"%ld",ACTIVE_FILE->save_size);
 
+    const uint8_t *pce_save_buf = save_pack_load(state_slot_current(), ACTIVE_FILE->save_size,
+                                                 emulator_framebuffer_pce,
+                                                 sizeof(emulator_framebuffer_pce), &size);
+    if (pce_save_buf == NULL) return true;
+
     pce_save_buf+=sizeof(SAVESTATE_HEADER) + 1;
 
-    uint32_t *crc_ptr = (uint32_t *)pce_save_buf;
+    const uint32_t *crc_ptr = (const uint32_t *)pce_save_buf;
     sprintf(pce_log,"%08lX",crc_ptr[0]);
     if (crc_ptr[0]!=PCE.ROM_CRC) {
+        memset(emulator_framebuffer_pce,0,sizeof(emulator_framebuffer_pce));
         return true;
     }
 
     pce_save_buf+=sizeof(uint32_t);
 
 
-    int pos=0;
-    for (int i = 0; SaveStateVars[i].len > 0; i++) {
-        printf("Loading %s (%d)\n", SaveStateVars[i].key, SaveStateVars[i].len);
-        uint8_t *pce_save_ptr = (uint8_t *)SaveStateVars[i].ptr;
-        for(int j=0;j<SaveStateVars[i].len;j++) {
-            pce_save_ptr[j] = pce_save_buf[pos];
-            pos++;
-        }
-    }
-    for(int i = 0; i < 8; i++) {
-        pce_bank_set(i, PCE.MMR[i]);
-    }
-    gfx_clear_cache();
-    osd_gfx_set_mode(IO_VDC_SCREEN_WIDTH, IO_VDC_SCREEN_HEIGHT);
+    // memcpy() of each block, the state may be read straight from the
+    // memory-mapped flash when it isn't packed
+    emu_snapshot_load(pce_save_buf, emu_snapshot_size());
+    // The state may have been unpacked into the frame
+    memset(emulator_framebuffer_pce,0,sizeof(emulator_framebuffer_pce));
     return true;
 }
 
+// The whole ROM is unpacked up front. Unpacking banks on demand would need
+// a hook in pce_bank_set() of the core, MemoryMapR is only read from there.
 size_t
 pce_osd_getromdata(unsigned char **data)
 {
-    /* src pointer to the ROM data in the external flash (raw or LZ4) */
-    const unsigned char *src = ROM_DATA;
-    unsigned char *dest = (unsigned char *)&_PCE_ROM_UNPACK_BUFFER;
-    uint32_t available_size = (uint32_t)&_PCE_ROM_UNPACK_BUFFER_SIZE;
-
-    if (memcmp(&src[0], LZ4_MAGIC, LZ4_MAGIC_SIZE) == 0) {
-        /* dest pointer to the ROM data in the internal RAM (raw) */
-        uint32_t lz4_original_size;
-        int32_t lz4_uncompressed_size;
-
-        printf("LZ4 compressed ROM detected.\n");
-        printf("Uncompressing to %p. %ld bytes available.\n", dest, available_size);
-
-        /* get the content size to uncompress */
-        lz4_original_size = lz4_get_original_size(src);
-
-        printf("Original size is %ld\n", lz4_original_size);
-        /* Check if there is enough memory to uncompress it */
-        assert(available_size >= lz4_original_size);
-
-        /* Uncompress the content to RAM */
-        lz4_uncompressed_size = lz4_uncompress(src, dest);
-
-        printf("Uncompressed size: %ld bytes.\n", lz4_uncompressed_size);
-
-        /* Check if the uncompressed content size is as expected */
-        assert(lz4_original_size == lz4_uncompressed_size);
-
-        *data = dest;
-
-        return lz4_uncompressed_size;
-    } else if(strcmp(ROM_EXT, "zopfli") == 0) {
-        /* DEFLATE decompression */
-        printf("Zopfli compressed ROM detected.\n");
-        size_t n_decomp_bytes;
-        int flags = 0;
-        flags |= TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF;
-        n_decomp_bytes = tinfl_decompress_mem_to_mem(dest, available_size, src, ROM_DATA_LENGTH, flags);
-        assert(n_decomp_bytes != TINFL_DECOMPRESS_MEM_TO_MEM_FAILED);
-        *data = dest;
-        return n_decomp_bytes;
-    } else if(strcmp(ROM_EXT, "lzma") == 0){
-        size_t n_decomp_bytes;
-        n_decomp_bytes = lzma_inflate(dest, available_size, src, ROM_DATA_LENGTH);
-        *data = dest;
-        return n_decomp_bytes;
-    } else {
-        *data = (unsigned char *)ROM_DATA;
-        return ROM_DATA_LENGTH;
-    }
+    size_t size;
+    uint8_t *buffer = emu_arena_alloc_rest(EMU_ARENA_RAM_EMU, 4, &size);
+    uint32_t mark = (uint32_t) buffer;
+    size_t rom_size = rom_loader_load_active(buffer, size, (const uint8_t **)data);
+
+    // Give back what the ROM doesn't use, nothing if it's run from flash
+    emu_arena_release(EMU_ARENA_RAM_EMU, mark + (*data == buffer ? rom_size : 0));
+    return rom_size;
 }
 
 void LoadCartPCE() {
@@ -255,7 +279,7 @@ void LoadCartPCE() {
     offset = rom_length & 0x1fff;
     PCE.ROM_SIZE = (rom_length - offset) / 0x2000;
      PCE.ROM_DATA = PCE.ROM + offset;
-       PCE.ROM_CRC = crc32_le(0, PCE.ROM, rom_length);
+       PCE.ROM_CRC = rom_loader_crc32_active();
        uint IDX = 0;
        uint ROM_MASK = 1;
 
@@ -323,6 +347,8 @@ void LoadCartPCE() {
     // Mapper for roms >= 1.5MB (SF2, homebrews)
     if (PCE.ROM_SIZE >= 192)
         MemoryMapW[0x00] = PCE.IOAREA;
+
+    pce_bank_cache_init(PCE.ROM_DATA, rom_length - offset);
 }
 
 void ResetPCE() {
@@ -348,7 +374,8 @@ static inline void pce_timer_run(void) {
     }
 }
 
-void pce_input_read(odroid_gamepad_state_t* out_state) {
+// Also called during the frame, see common_emu_input_late_poll()
+void pce_input_read(const odroid_gamepad_state_t* out_state) {
     unsigned char rc = 0;
     if (out_state->values[ODROID_INPUT_LEFT])   rc |= JOY_LEFT;
     if (out_state->values[ODROID_INPUT_RIGHT])  rc |= JOY_RIGHT;
@@ -375,13 +402,24 @@ void init_color_pals() {
           set_color(i, (i & 0x1C)>>2, (i & 0xE0) >> 5, (i & 0x03) );
     }
     set_color(255, 0x3f, 0x3f, 0x3f);
+#ifdef GW_LCD_MODE_LUT8
+    lcd_set_clut_rgb565(mypalette, 256);
+#else
+    gw_blit_set_clut_rgb565(mypalette, 256);
+#endif
 }
 
+#ifdef GW_LCD_MODE_LUT8
+// The palette lookup is done by the LTDC
+#define PIXEL(_c) (_c)
+#else
+#define PIXEL(_c) mypalette[_c]
+#endif
+
 void pce_osd_gfx_blit(bool drawFrame) {
     static uint32_t lastFPSTime = 0;
     static uint32_t frames = 0;
     if (!drawFrame) {
-        memset(emulator_framebuffer_pce,0,sizeof(emulator_framebuffer_pce));
         return;
     }
 
@@ -408,52 +446,39 @@ void pce_osd_gfx_blit(bool drawFrame) {
 #endif
 
     uint8_t *emuFrameBuffer = osd_gfx_framebuffer();
+    lcd_beam_begin();
     pixel_t *framebuffer_active = lcd_get_active_buffer();
-    int x2=0,y=0, offsetY;
-    int xScaleDownModulo = 0;
-    int xScaleUpModulo = 0;
-    uint8_t *fbTmp;
-    if (GW_LCD_WIDTH<current_width) xScaleDownModulo = current_width/(current_width-GW_LCD_WIDTH);
-    if (GW_LCD_WIDTH>current_width) xScaleUpModulo = current_width/(GW_LCD_WIDTH-current_width);
-    int renderHeight = (current_height<=GW_LCD_HEIGHT)?current_height:GW_LCD_HEIGHT;
-
-    for(y=0;y<renderHeight;y++) {
-        x2=0;
-        fbTmp = emuFrameBuffer+(y*XBUF_WIDTH);
-        offsetY = y*GW_LCD_WIDTH;
-        if (xScaleUpModulo) {
-            // Horizontal - Scale up
-            for(int x=0;x<current_width;x++) {
-                framebuffer_active[offsetY+x2]=mypalette[fbTmp[x]];
-                x2++;
-                if ((x+1)%xScaleUpModulo==0) {
-                    framebuffer_active[offsetY+x2]=mypalette[fbTmp[x]];
-                    x2++;
-                }
-            }
-        } else if (xScaleDownModulo) {
-            // Horizontal - Scale down
-            for(int x=0;x<current_width;x++) {
-                if (x%xScaleDownModulo!=0) {
-                    framebuffer_active[offsetY+x2]=mypalette[fbTmp[x]];
-                    x2++;
-                }
-            }
-        } else {
-            // No scaling, 1:1
-            for(int x=0;x<current_width;x++) {
-                   framebuffer_active[offsetY+x]=mypalette[fbTmp[x]];
-            }
+
+    // Rows below the frame are cleared
+#ifdef GW_LCD_MODE_LUT8
+    // Color 0 is black
+    memset(&framebuffer_active[render_height * GW_LCD_WIDTH], 0,
+           (GW_LCD_HEIGHT - render_height) * GW_LCD_WIDTH);
+#else
+    gw_blit_fill_rgb565(&framebuffer_active[render_height * GW_LCD_WIDTH], GW_LCD_WIDTH,
+                        GW_LCD_WIDTH, GW_LCD_HEIGHT - render_height, 0);
+#endif
+
+    if (current_width == GW_LCD_WIDTH && current_height <= GW_LCD_HEIGHT) {
+        // No scaling, 1:1
+#ifdef GW_LCD_MODE_LUT8
+        for(int y=0;y<render_height;y++) {
+            memcpy(&framebuffer_active[y*GW_LCD_WIDTH], emuFrameBuffer+(y*XBUF_WIDTH), current_width);
         }
-    }
-    // Temporary, Y scaling is not yet implemented
-    for(;y<GW_LCD_HEIGHT;y++) {
-        fbTmp = emuFrameBuffer+(y*XBUF_WIDTH);
-        offsetY = y*GW_LCD_WIDTH;
-        for(int x=0;x<GW_LCD_WIDTH;x++) {
-            framebuffer_active[offsetY+x]=0;
+#else
+        gw_blit_l8_to_rgb565(emuFrameBuffer, XBUF_WIDTH, framebuffer_active, GW_LCD_WIDTH,
+                             current_width, render_height);
+#endif
+    } else {
+        for(int y=0;y<render_height;y++) {
+            const uint8_t *src_row = emuFrameBuffer+(scale_y[y]*XBUF_WIDTH);
+            pixel_t *dest_row = &framebuffer_active[y*GW_LCD_WIDTH];
+            for(int x=0;x<GW_LCD_WIDTH;x++) {
+                dest_row[x]=PIXEL(src_row[scale_x[x]]);
+            }
         }
     }
+    gw_blit_wait();
 
 #ifdef PCE_SHOW_DEBUG
     char debugMsg[100];
@@ -463,26 +488,14 @@ void pce_osd_gfx_blit(bool drawFrame) {
 
     common_ingame_overlay();
     lcd_swap();
-
-    memset(emulator_framebuffer_pce,0,sizeof(emulator_framebuffer_pce));
 }
 
 void pce_pcm_submit() {
-    uint8_t volume = odroid_audio_volume_get();
-    int32_t factor = volume_tbl[volume] / 2; // Divide by 2 to prevent overflow in stereo mixing
+    profiler_begin(PROFILER_AUDIO);
     pce_snd_update(audioBuffer_pce, AUDIO_BUFFER_LENGTH_PCE );
-    size_t offset = (dma_state == DMA_TRANSFER_STATE_HF) ? 0 : AUDIO_BUFFER_LENGTH_PCE;
-    if (audio_mute || volume == ODROID_AUDIO_VOLUME_MIN) {
-        for (int i = 0; i < AUDIO_BUFFER_LENGTH_PCE; i++) {
-            audiobuffer_dma[offset + i] = 0;
-        }
-    } else {
-        for (int i = 0; i < AUDIO_BUFFER_LENGTH_PCE; i++) {
-            /* mix left & right */
-            int32_t sample = (audioBuffer_pce[i*2] + audioBuffer_pce[i*2+1]);
-            audiobuffer_dma[offset + i] = (sample * factor) >> 8;
-        }
-    }
+    pcm_downmix_interleaved(audioBuffer_pce, audioBuffer_pce, AUDIO_BUFFER_LENGTH_PCE);
+    odroid_audio_ring_write(audioBuffer_pce, AUDIO_BUFFER_LENGTH_PCE);
+    profiler_end(PROFILER_AUDIO);
 }
 
 int app_main_pce(uint8_t load_state, uint8_t start_paused) {
@@ -496,34 +509,44 @@ int app_main_pce(uint8_t load_state, uint8_t start_paused) {
 
     odroid_system_init(APPID_PCE, PCE_SAMPLE_RATE);
     odroid_system_emu_init(&LoadState, &SaveState, &netplay_callback);
+    for (int i = 0; i < sizeof(SaveStateVars) / sizeof(SaveStateVars[0]); i++) {
+        snapshot_blocks[i] = (emu_snapshot_block_t) {SaveStateVars[i].ptr, SaveStateVars[i].len};
+    }
+    emu_snapshot_init(&snapshot_core);
     pce_log[0]=0;
 
     // Init Graphics
     init_color_pals();
     const int refresh_rate = FPS_NTSC;
     sprintf(pce_log,"%d",refresh_rate);
-    memset(framebuffer1, 0, sizeof(framebuffer1));
-    memset(framebuffer2, 0, sizeof(framebuffer2));
+    lcd_clear_async(0);
     gfx_init();
     printf("Graphics initialized\n");
 
     // Init Sound
-    memset(audiobuffer_dma, 0, sizeof(audiobuffer_dma));
-    HAL_SAI_Transmit_DMA(&hsai_BlockA1, (uint8_t *)audiobuffer_dma, AUDIO_BUFFER_LENGTH_PCE * 2 );
+    odroid_audio_ring_start(AUDIO_BUFFER_LENGTH_PCE);
     pce_snd_init();
     printf("Sound initialized\n");
 
     // Init PCE Core
     pce_init();
+    rom_loader_set_progress(&rom_loader_progress_bar);
     LoadCartPCE();
     ResetPCE();
     printf("PCE Core initialized\n");
 
     // If user select "RESUME" in main menu
-    if (load_state) LoadState(NULL);
+    if (load_state) {
+        LoadState(NULL);
+        boot_trace("state loaded");
+    }
 
     // Main emulator loop
     printf("Main emulator loop start\n");
+    common_emu_input_set_late_poll(&pce_input_read);
+
+    // The framebuffers were cleared while the rest was set up
+    gw_blit_wait();
 
     while (true) {
         wdog_refresh();
@@ -540,24 +563,25 @@ int app_main_pce(uint8_t load_state, uint8_t start_paused) {
         pce_input_read(&joystick);
 
         for (Scanline = 0; Scanline < 263; ++Scanline) {
+            // The joypad port is read by the core, polled here every few
+            // lines so the game sees the buttons of the moment it reads
+            if ((Scanline & 15) == 15) {
+                common_emu_input_late_poll();
+                pce_bank_cache_sample();
+            }
             PCE.MaxCycles += CYCLES_PER_LINE;
             h6280_run();
             pce_timer_run();
             gfx_run();
         }
 
+        profiler_begin(PROFILER_BLIT);
         pce_osd_gfx_blit(drawFrame);
-        if(drawFrame) pce_pcm_submit();
-
-        if(!common_emu_state.skip_frames){
-            dma_transfer_state_t last_dma_state = DMA_TRANSFER_STATE_HF;
-            for(uint8_t p = 0; p < common_emu_state.pause_frames + 1; p++) {
-                while (dma_state == last_dma_state) {
-                    cpumon_sleep();
-                }
-                last_dma_state = dma_state;
-            }
-        }
+        profiler_end(PROFILER_BLIT);
+        pce_pcm_submit();
+        pce_bank_cache_frame();
+
+        common_emu_sync();
 
         // Prevent overflow
         int trim = MIN(Cycles, PCE.MaxCycles);
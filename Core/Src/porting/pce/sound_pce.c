@@ -20,65 +20,86 @@ static sample_t mix_buffer[PCE_SAMPLE_RATE / 60 * 2];
 
 struct host_machine host;
 
-static inline void
-psg_update_chan(sample_t *buf, int ch, size_t dwSize)
+// Channel volume, only recomputed when the game changes the registers
+typedef struct {
+    bool valid;
+    uint8_t balance;
+    uint8_t control;
+    int lvol;
+    int rvol;
+} chan_vol_t;
+static chan_vol_t chan_vol[PSG_CHANNELS];
+
+static inline const chan_vol_t *
+psg_chan_volume(int ch)
 {
     psg_chan_t *chan = &PCE.PSG.chan[ch];
-    int sample = 0;
-    uint32_t Tp;
-    sample_t *buf_end = buf + dwSize;
+    chan_vol_t *vol = &chan_vol[ch];
+
+    if (vol->valid && vol->balance == chan->balance && vol->control == chan->control) {
+        return vol;
+    }
 
     /*
-    * This gives us a volume level of (0...15).
+    * This gives us a volume level of (0...15), the balance is boosted by 10%.
     */
-    int lvol = (((chan->balance >>  4) * 1.1) * (chan->control & 0x1E)) / 32;
-    int rvol = (((chan->balance & 0xF) * 1.1) * (chan->control & 0x1E)) / 32;
+    int level = chan->control & 0x1E;
+    int lvol = ((chan->balance >>  4) * level * 11) / 320;
+    int rvol = ((chan->balance & 0xF) * level * 11) / 320;
 
-    lvol = vol_tbl[lvol & 0x1F];
-    rvol = vol_tbl[rvol & 0x1F];
+    vol->lvol = vol_tbl[lvol & 0x1F];
+    vol->rvol = vol_tbl[rvol & 0x1F];
 
     if (!host.sound.stereo) {
-        lvol = (lvol + rvol) / 2;
+        vol->lvol = (vol->lvol + vol->rvol) / 2;
     }
 
-    // This isn't very accurate, we don't track how long each DA sample should play
-    // but we call psg_update() often enough (10x per frame) that guessing should be good enough...
-    if (chan->dda_count) {
-        // Cycles per frame: 119318
-        // Samples per frame: 368
+    vol->balance = chan->balance;
+    vol->control = chan->control;
+    vol->valid = true;
 
-        // Cycles per scanline: 454
-        // Samples per scanline: ~1.4
+    return vol;
+}
 
-        // One sample = 324 cycles
+static inline void
+psg_update_chan(sample_t *buf, int ch, size_t dwSize)
+{
+    psg_chan_t *chan = &PCE.PSG.chan[ch];
+    int sample = 0;
+    uint32_t Tp;
+    sample_t *buf_end = buf + dwSize;
 
-        // const int cycles_per_sample = CYCLES_PER_FRAME / (host.sound.sample_freq / 60);
+    const chan_vol_t *vol = psg_chan_volume(ch);
+    int lvol = vol->lvol;
+    int rvol = vol->rvol;
 
-        // float repeat = (float)elapsed / cycles_per_sample / chan->dda_count;
-        // printf("%.2f\n", repeat);
+    // We don't know when each DA sample was written, only how many there were
+    // since the last update. That's once per frame, so they are spread evenly
+    // over the frame, which is what games streaming samples from a timer do.
+    if (chan->dda_count) {
+        // Cycles per frame: 119318
+        // Samples per frame: 368
 
         int start = (int)chan->dda_index - chan->dda_count;
         if (start < 0)
             start += 0x100;
 
-        int repeat = 3; // MIN(2, (dwSize / 2) / chan->dda_count) + 1;
+        uint32_t frames = host.sound.stereo ? dwSize / 2 : dwSize;
+        uint32_t step = ((uint32_t) chan->dda_count << 16) / frames;
+        uint32_t pos = 0;
 
-        while (buf < buf_end && (chan->dda_count || chan->control & PSG_DDA_ENABLE)) {
-            if (chan->dda_count) {
-                // sample = chan->dda_data[(start++) & 0x7F];
-                if ((sample = (chan->dda_data[(start++) & 0xFF] - 16)) >= 0)
-                    sample++;
-                chan->dda_count--;
-            }
+        while (buf < buf_end) {
+            if ((sample = (chan->dda_data[(start + (pos >> 16)) & 0xFF] - 16)) >= 0)
+                sample++;
+            pos += step;
 
-            for (int i = 0; i < repeat; i++) {
-                *buf++ = (sample * lvol) >> 8;
+            *buf++ = (sample * lvol) >> 8;
 
-                if (host.sound.stereo) {
-                    *buf++ = (sample * rvol) >> 8;
-                }
+            if (host.sound.stereo) {
+                *buf++ = (sample * rvol) >> 8;
             }
         }
+        chan->dda_count = 0;
     }
 
     /*
@@ -96,7 +117,7 @@ psg_update_chan(sample_t *buf, int ch, size_t dwSize)
         while (buf < buf_end) {
             chan->noise_accum += 3000 + Np * 512;
 
-            if ((Tp = (chan->noise_accum / host.sound.freq)) >= 1) {
+            if (chan->noise_accum >= host.sound.freq) {
                 if (noise_rand[ch] & 0x00080000) {
                     noise_rand[ch] = ((noise_rand[ch] ^ 0x0004) << 1) + 1;
                     noise_level[ch] = -15;
@@ -104,7 +125,7 @@ psg_update_chan(sample_t *buf, int ch, size_t dwSize)
                     noise_rand[ch] <<= 1;
                     noise_level[ch] = 15;
                 }
-                chan->noise_accum -= host.sound.freq * Tp;
+                chan->noise_accum %= host.sound.freq;
             }
 
             *buf++ = (noise_level[ch] * lvol) >> 8;
@@ -181,6 +202,7 @@ void osd_snd_init(void) {
 int pce_snd_init(void) {
     noise_rand[4] = 0x51F63101;
     noise_rand[5] = 0x1F631042;
+    memset(chan_vol, 0, sizeof(chan_vol));
     osd_snd_init();
     return 0;
 }
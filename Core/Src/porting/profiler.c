@@ -0,0 +1,191 @@
+#include <odroid_system.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "gw_dirty.h"
+#include "gw_lcd.h"
+#include "gw_timer.h"
+#include "odroid_colors.h"
+#include "odroid_overlay.h"
+#include "profiler.h"
+
+#if PROFILER
+
+#define STACK_DEPTH 8
+
+static const char *const names[PROFILER_SCOPE_COUNT] = {
+    [PROFILER_EMULATE] = "emu",
+    [PROFILER_BLIT]    = "blit",
+    [PROFILER_AUDIO]   = "audio",
+    [PROFILER_INPUT]   = "input",
+    [PROFILER_OVERLAY] = "ovl",
+    [PROFILER_FLASH]   = "flash",
+    [PROFILER_SYNC]    = "sync",
+};
+
+typedef struct {
+    uint32_t min;
+    uint32_t max;
+    uint32_t sum;
+} window_t;
+
+// Scopes being measured, the innermost one is charged with the cycles
+static profiler_scope_t stack[STACK_DEPTH] = {PROFILER_EMULATE};
+static uint32_t depth;
+static uint32_t mark_cycles;
+
+// The frame so far
+static uint32_t frame_cycles[PROFILER_SCOPE_COUNT];
+static uint32_t frame_start_us;
+
+// The second so far and the last complete one
+static window_t window[PROFILER_SCOPE_COUNT];
+static uint32_t window_frames;
+static uint32_t window_start_us;
+static profiler_stats_t last[PROFILER_SCOPE_COUNT];
+
+static bool overlay;
+
+static void charge(void)
+{
+    uint32_t now = gw_timer_cycles();
+
+    frame_cycles[stack[depth]] += now - mark_cycles;
+    mark_cycles = now;
+}
+
+void profiler_begin(profiler_scope_t scope)
+{
+    charge();
+    if (depth + 1 < STACK_DEPTH) {
+        stack[++depth] = scope;
+    }
+}
+
+void profiler_end(profiler_scope_t scope)
+{
+    charge();
+    if (depth > 0 && stack[depth] == scope) {
+        depth--;
+    }
+}
+
+const char *profiler_scope_name(void)
+{
+    return names[stack[depth]];
+}
+
+static void window_start(uint32_t now)
+{
+    for (int i = 0; i < PROFILER_SCOPE_COUNT; i++) {
+        window[i] = (window_t) {.min = UINT32_MAX};
+    }
+    window_frames = 0;
+    window_start_us = now;
+}
+
+static void window_end(void)
+{
+    char line[200];
+    int len = snprintf(line, sizeof(line), "Prof: %lu frames", window_frames);
+
+    for (int i = 0; i < PROFILER_SCOPE_COUNT; i++) {
+        last[i] = (profiler_stats_t) {
+            .min = window[i].min,
+            .avg = window[i].sum / window_frames,
+            .max = window[i].max,
+        };
+        len += snprintf(&line[len], sizeof(line) - len, " %s %lu/%lu/%lu",
+                        names[i], last[i].min, last[i].avg, last[i].max);
+    }
+
+    // One line per second, logbuf keeps the last few of them
+    printf("%s\n", line);
+}
+
+void profiler_frame(void)
+{
+    uint32_t now = gw_timer_us();
+    uint32_t busy_us = 0;
+
+    charge();
+
+    if (frame_start_us != 0) {
+        uint32_t frame_us = now - frame_start_us;
+
+        for (int i = 0; i < PROFILER_SCOPE_COUNT; i++) {
+            uint32_t us;
+
+            // The cycle counter doesn't count while sleeping
+            if (i == PROFILER_SYNC) {
+                us = frame_us > busy_us ? frame_us - busy_us : 0;
+            } else {
+                us = gw_timer_cycles_to_us(frame_cycles[i]);
+                busy_us += us;
+            }
+
+            window[i].min = MIN(window[i].min, us);
+            window[i].max = MAX(window[i].max, us);
+            window[i].sum += us;
+        }
+        window_frames++;
+
+        if (now - window_start_us >= 1000000) {
+            window_end();
+            window_start(now);
+        }
+    }
+
+    memset(frame_cycles, 0, sizeof(frame_cycles));
+    frame_start_us = gw_timer_us();
+    // Printing isn't part of the next frame
+    mark_cycles = gw_timer_cycles();
+}
+
+void profiler_reset(void)
+{
+    memset(frame_cycles, 0, sizeof(frame_cycles));
+    frame_start_us = 0;
+    window_start(gw_timer_us());
+    mark_cycles = gw_timer_cycles();
+}
+
+profiler_stats_t profiler_get_stats(profiler_scope_t scope)
+{
+    return last[scope];
+}
+
+void profiler_set_overlay(bool enabled)
+{
+    overlay = enabled;
+}
+
+bool profiler_get_overlay(void)
+{
+    return overlay;
+}
+
+void profiler_draw_overlay(void)
+{
+    char text[48];
+    int len = 0;
+
+    if (!overlay) {
+        return;
+    }
+
+    // Average per frame in 0.1 ms, the line fits 40 characters
+    for (int i = 0; i < PROFILER_SCOPE_COUNT; i++) {
+        uint32_t avg = (last[i].avg + 50) / 100;
+
+        len += snprintf(&text[len], sizeof(text) - len, "%c%lu.%lu ",
+                        names[i][0] - 'a' + 'A', avg / 10, avg % 10);
+    }
+
+    odroid_overlay_draw_text(0, 0, GW_LCD_WIDTH, text, C_GW_YELLOW, C_GW_MAIN_COLOR);
+
+    // Like the other overlays, so the blit time includes full redraws
+    gw_dirty_invalidate();
+}
+
+#endif
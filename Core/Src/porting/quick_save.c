@@ -0,0 +1,111 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "main.h"
+#include "gw_linker.h"
+#include "crc32.h"
+#include "quick_save.h"
+#include "save_log.h"
+#include "store_async.h"
+
+#define QUICK_SAVE_SIZE (4 * 1024)
+
+typedef struct {
+    uint32_t magic;
+    uint32_t slot;      // Offset of the slot in the external flash
+    uint32_t size;
+    uint32_t crc;       // Of the data
+} quick_save_header_t;
+
+static struct {
+    quick_save_header_t header;
+    uint8_t data[QUICK_SAVE_SIZE - sizeof(quick_save_header_t)];
+} quick __attribute__((section (".backup"))) __attribute__((aligned(32)));
+
+static bool armed;
+static bool flushing;
+
+static bool is_valid(void)
+{
+    return quick.header.magic == QUICK_SAVE_MAGIC &&
+           quick.header.size <= sizeof(quick.data) &&
+           crc32_le(0, quick.data, quick.header.size) == quick.header.crc;
+}
+
+static void invalidate(void)
+{
+    quick.header.magic = 0;
+    SCB_CleanDCache_by_Addr((uint32_t *) &quick, sizeof(quick));
+}
+
+void quick_save_init(void)
+{
+    __HAL_RCC_BKPRAM_CLK_ENABLE();
+    HAL_PWREx_EnableBkUpReg();
+
+    if (!is_valid()) {
+        return;
+    }
+
+    printf("Quick-save: writing %lu bytes to 0x%08lx\n", quick.header.size, quick.header.slot);
+
+    // The home slot is written, forget the older record in the log
+    const uint8_t *flash_ptr = &__EXTFLASH_BASE__ + quick.header.slot;
+
+    save_log_discard(flash_ptr);
+    store_save_async(flash_ptr, quick.data, quick.header.size);
+    flushing = true;
+}
+
+void quick_save_arm(void)
+{
+    armed = true;
+}
+
+uint8_t *quick_save_begin(size_t *max_size)
+{
+    if (!armed) {
+        return NULL;
+    }
+    armed = false;
+
+    // Don't overwrite a quick-save that is still being written
+    store_async_flush();
+    quick_save_poll();
+
+    *max_size = sizeof(quick.data);
+    return quick.data;
+}
+
+void quick_save_commit(const uint8_t *flash_ptr, size_t size)
+{
+    quick.header = (quick_save_header_t) {
+        .magic = QUICK_SAVE_MAGIC,
+        .slot  = flash_ptr - &__EXTFLASH_BASE__,
+        .size  = size,
+        .crc   = crc32_le(0, quick.data, size),
+    };
+
+    // Nothing in the cache survives standby
+    SCB_CleanDCache_by_Addr((uint32_t *) &quick, sizeof(quick));
+}
+
+const uint8_t *quick_save_find(const uint8_t *flash_ptr, size_t *size)
+{
+    quick_save_poll();
+
+    if (!is_valid() || quick.header.slot != flash_ptr - &__EXTFLASH_BASE__) {
+        return NULL;
+    }
+
+    *size = quick.header.size;
+    return quick.data;
+}
+
+void quick_save_poll(void)
+{
+    if (flushing && !store_async_busy()) {
+        flushing = false;
+        invalidate();
+    }
+}
@@ -0,0 +1,85 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "main.h"
+#include "gw_linker.h"
+#include "crc32.h"
+#include "emu_arena.h"
+#include "ram_loader.h"
+#include "rom_manager.h"
+
+volatile ram_loader_comm_t ram_loader_comm;
+
+static char name[sizeof(ram_loader_comm.name) + 1];
+static char ext[sizeof(ram_loader_comm.ext) + 1];
+static retro_emulator_file_t file;
+
+static const rom_system_t *find_system(const char *extension)
+{
+    for (uint32_t i = 0; i < rom_mgr.systems_count; i++) {
+        if (strcmp(rom_mgr.systems[i]->extension, extension) == 0) {
+            return rom_mgr.systems[i];
+        }
+    }
+
+    return NULL;
+}
+
+static ram_loader_state_t check(uint8_t *rom, size_t size, const rom_system_t **system)
+{
+    uintptr_t start = (uintptr_t) rom;
+
+    if ((start & (4 * 1024 - 1)) != 0 || start < (uintptr_t) &__RAM_EMU_START__ ||
+        size == 0 || size > (uintptr_t) &__RAM_EMU_END__ - start) {
+        return RAM_LOADER_BAD_ADDRESS;
+    }
+
+    // Written behind the back of the D-cache
+    SCB_InvalidateDCache_by_Addr((uint32_t *) rom, (size + 31) & ~31);
+    if (crc32_le(0, rom, size) != ram_loader_comm.crc32) {
+        return RAM_LOADER_BAD_CRC;
+    }
+
+    *system = find_system(ext);
+    if (*system == NULL || strcmp((*system)->system_name, "Nintendo Gameboy") == 0) {
+        return RAM_LOADER_BAD_SYSTEM;
+    }
+
+    return RAM_LOADER_STARTED;
+}
+
+void ram_loader_poll(void)
+{
+    const rom_system_t *system = NULL;
+    uint8_t *rom;
+    size_t size;
+
+    if (ram_loader_comm.magic != RAM_LOADER_MAGIC || ram_loader_comm.state != RAM_LOADER_READY) {
+        return;
+    }
+
+    rom = (uint8_t *) ram_loader_comm.address;
+    size = ram_loader_comm.size;
+    memcpy(name, (const char *) ram_loader_comm.name, sizeof(ram_loader_comm.name));
+    memcpy(ext, (const char *) ram_loader_comm.ext, sizeof(ram_loader_comm.ext));
+
+    ram_loader_comm.state = check(rom, size, &system);
+    if (ram_loader_comm.state != RAM_LOADER_STARTED) {
+        printf("RAM loader: %s.%s rejected (%lu)\n", name, ext, ram_loader_comm.state);
+        return;
+    }
+
+    file = (retro_emulator_file_t) {
+        .name = name,
+        .ext = ext,
+        .address = rom,
+        .size = size,
+        .checksum = ram_loader_comm.crc32,
+        .missing_cover = true,
+        .system = system,
+    };
+
+    printf("RAM loader: %s.%s, %u bytes at %p\n", name, ext, size, rom);
+    emu_arena_reserve_top(rom);
+    emulator_start(&file, false, false);
+}
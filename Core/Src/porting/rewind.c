@@ -0,0 +1,328 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "emu_arena.h"
+#include "emu_snapshot.h"
+#include "lib/lz4_pack.h"
+#include "rewind.h"
+
+#define RING_SIZE_MAX (128 * 1024)
+#define MAX_ENTRIES 256
+
+typedef struct {
+    uint32_t offset;
+    uint32_t size;
+} entry_t;
+
+// Both hold the newest state between calls, see rewind.h
+static uint8_t *current;
+static uint8_t *next;
+static size_t snapshot_size;    // Room for them
+static size_t snapshot_used;
+
+static uint8_t *ring;
+static size_t ring_size;
+static uint32_t ring_head;      // End of the newest entry
+
+static entry_t entries[MAX_ENTRIES];
+static uint32_t entries_first;  // Oldest
+static uint32_t entries_count;
+
+static bool enabled;
+static bool allocated;
+static bool seeded;             // current and next hold a snapshot
+static bool rewinding;
+static uint16_t frames;
+static uint16_t step_wait;
+
+bool rewind_enabled(void)
+{
+    return enabled;
+}
+
+void rewind_reset(void)
+{
+    enabled = false;
+    allocated = false;
+    seeded = false;
+    rewinding = false;
+    frames = 0;
+    current = NULL;
+    next = NULL;
+    ring = NULL;
+    entries_first = 0;
+    entries_count = 0;
+    ring_head = 0;
+}
+
+static entry_t *entry(uint32_t i)
+{
+    return &entries[(entries_first + i) % MAX_ENTRIES];
+}
+
+static void history_reset(void)
+{
+    entries_first = 0;
+    entries_count = 0;
+    ring_head = 0;
+}
+
+static void history_drop_oldest(void)
+{
+    entries_first = (entries_first + 1) % MAX_ENTRIES;
+    entries_count--;
+}
+
+// The snapshot goes into the first buffer like for run-ahead: if its size
+// isn't known, into what's left of a region, which is then cut down to it
+static uint8_t *allocate_first(void)
+{
+    static const emu_arena_region_t regions[] = {EMU_ARENA_RAM_EMU, EMU_ARENA_AHBRAM};
+    size_t known = emu_snapshot_size();
+
+    if (known > 0) {
+        uint8_t *buffer = emu_arena_try_alloc(EMU_ARENA_RAM_EMU, known, 4);
+
+        snapshot_size = known;
+        snapshot_used = buffer ? emu_snapshot_save(buffer, known) : 0;
+        return snapshot_used > 0 ? buffer : NULL;
+    }
+
+    for (int i = 0; i < sizeof(regions) / sizeof(regions[0]); i++) {
+        uint32_t mark = emu_arena_mark(regions[i]);
+        size_t size;
+        uint8_t *buffer = emu_arena_alloc_rest(regions[i], 4, &size);
+        size_t used = emu_snapshot_save(buffer, size);
+
+        if (used > 0) {
+            emu_arena_release(regions[i], (uint32_t) buffer + used);
+            snapshot_size = used;
+            snapshot_used = used;
+            return buffer;
+        }
+        emu_arena_release(regions[i], mark);
+    }
+
+    return NULL;
+}
+
+static bool allocate(void)
+{
+    uint32_t ram_emu_mark = emu_arena_mark(EMU_ARENA_RAM_EMU);
+    uint32_t ahbram_mark = emu_arena_mark(EMU_ARENA_AHBRAM);
+    size_t bound;
+
+    current = allocate_first();
+    if (current != NULL) {
+        next = emu_arena_try_alloc(EMU_ARENA_RAM_EMU, snapshot_size, 4);
+    }
+
+    // At least two deltas have to fit, or one would always be dropped
+    bound = LZ4_PACK_BOUND(snapshot_size);
+    ring = NULL;
+    for (ring_size = RING_SIZE_MAX; current && next && ring_size >= 2 * bound; ring_size /= 2) {
+        ring = emu_arena_try_alloc(EMU_ARENA_RAM_EMU, ring_size, 4);
+        if (ring != NULL) {
+            break;
+        }
+    }
+
+    if (ring == NULL) {
+        printf("Rewind: no room for the buffers\n");
+        emu_arena_release(EMU_ARENA_AHBRAM, ahbram_mark);
+        emu_arena_release(EMU_ARENA_RAM_EMU, ram_emu_mark);
+        return false;
+    }
+
+    printf("Rewind: %u byte snapshots, %u byte ring\n", snapshot_size, ring_size);
+    memcpy(next, current, snapshot_used);
+    history_reset();
+    allocated = true;
+    seeded = true;
+    return true;
+}
+
+static void ring_write(void *ctx, const unsigned char *data, size_t size)
+{
+    uint8_t **dst = ctx;
+
+    memcpy(*dst, data, size);
+    *dst += size;
+}
+
+// Room for a delta at the head, or at the start of the ring if there isn't
+// enough before the end. The oldest entries in the way are dropped.
+static uint32_t ring_reserve(size_t size)
+{
+    uint32_t head = ring_head;
+    bool wrap = head + size > ring_size;
+
+    if (wrap) {
+        head = 0;
+    }
+
+    while (entries_count > 0) {
+        entry_t *oldest = entry(0);
+        bool overlaps = oldest->offset < head + size && oldest->offset + oldest->size > head;
+
+        // After a wrap, everything between the head and the end is skipped
+        if (!overlaps && !(wrap && oldest->offset >= ring_head) && entries_count < MAX_ENTRIES) {
+            break;
+        }
+        history_drop_oldest();
+    }
+
+    return head;
+}
+
+static void xor_page(uint8_t *dst, const uint8_t *src, size_t len)
+{
+    uint32_t *d = (uint32_t *) dst;
+    const uint32_t *s = (const uint32_t *) src;
+
+    for (; len >= 4; len -= 4) {
+        *d++ ^= *s++;
+    }
+    for (dst = (uint8_t *) d, src = (const uint8_t *) s; len > 0; len--) {
+        *dst++ ^= *src++;
+    }
+}
+
+static void capture(void)
+{
+    size_t used = emu_snapshot_update(next, snapshot_size);
+    uint32_t offset;
+    uint8_t *dst;
+
+    if (!seeded || used != snapshot_used) {
+        // The state grew or shrank, the deltas don't apply anymore
+        history_reset();
+        if (used == 0) {
+            printf("Rewind: snapshot doesn't fit in %u bytes\n", snapshot_size);
+            enabled = false;
+            seeded = false;
+            return;
+        }
+        snapshot_used = used;
+        memcpy(current, next, used);
+        seeded = true;
+        return;
+    }
+
+    // Into the delta, pages that didn't change are all zeros
+    for (uint32_t pos = 0; pos < used; pos += EMU_SNAPSHOT_PAGE_SIZE) {
+        size_t len = used - pos < EMU_SNAPSHOT_PAGE_SIZE ? used - pos : EMU_SNAPSHOT_PAGE_SIZE;
+
+        if (emu_snapshot_page_dirty(pos / EMU_SNAPSHOT_PAGE_SIZE)) {
+            xor_page(&current[pos], &next[pos], len);
+        } else {
+            memset(&current[pos], 0, len);
+        }
+    }
+
+    offset = ring_reserve(LZ4_PACK_BOUND(used));
+    dst = &ring[offset];
+    *entry(entries_count) = (entry_t) {
+        .offset = offset,
+        .size = lz4_block_pack(current, used, &ring_write, &dst),
+    };
+    entries_count++;
+    ring_head = offset + entry(entries_count - 1)->size;
+
+    memcpy(current, next, used);
+}
+
+void rewind_frame(void)
+{
+    if (!enabled) {
+        return;
+    }
+
+    if (rewinding) {
+        // Start over from where it stopped
+        rewinding = false;
+        frames = 0;
+        return;
+    }
+
+    if (++frames < REWIND_INTERVAL) {
+        return;
+    }
+    frames = 0;
+
+    if (!allocated) {
+        enabled = allocate();
+        return;
+    }
+
+    capture();
+}
+
+bool rewind_step(void)
+{
+    entry_t *newest;
+
+    if (!enabled || !seeded) {
+        return false;
+    }
+
+    if (rewinding && step_wait > 0) {
+        step_wait--;
+        return false;
+    }
+    rewinding = true;
+    step_wait = REWIND_STEP_FRAMES - 1;
+
+    // Nothing older, stay at the oldest state
+    if (entries_count == 0) {
+        emu_snapshot_load(next, snapshot_used);
+        return true;
+    }
+
+    newest = entry(entries_count - 1);
+    if (lz4_block_unpack(&ring[newest->offset], newest->size, current, snapshot_used) == 0) {
+        printf("Rewind: corrupt delta\n");
+        memcpy(current, next, snapshot_used);
+        history_reset();
+        return false;
+    }
+
+    xor_page(next, current, snapshot_used);
+    memcpy(current, next, snapshot_used);
+    emu_snapshot_load(next, snapshot_used);
+
+    entries_count--;
+    ring_head = entries_count > 0 ? newest->offset : 0;
+
+    return true;
+}
+
+uint32_t rewind_history_frames(void)
+{
+    return entries_count * REWIND_INTERVAL;
+}
+
+size_t rewind_history_bytes(void)
+{
+    size_t bytes = 0;
+
+    for (uint32_t i = 0; i < entries_count; i++) {
+        bytes += entry(i)->size;
+    }
+
+    return bytes;
+}
+
+bool rewind_update_cb(odroid_dialog_choice_t *option, odroid_dialog_event_t event, uint32_t repeat)
+{
+    if (event == ODROID_DIALOG_PREV || event == ODROID_DIALOG_NEXT) {
+        enabled = !enabled;
+        frames = 0;
+        // The snapshots are of the state when it was turned off
+        seeded = false;
+    }
+
+    strcpy(option->value, enabled ? "On" : "Off");
+
+    return event == ODROID_DIALOG_ENTER;
+}
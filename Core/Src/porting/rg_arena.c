@@ -0,0 +1,20 @@
+#include "rg_arena.h"
+
+void rg_arena_create(rg_arena_t *arena, void *start, void *end)
+{
+    arena->start = (uintptr_t) start;
+    arena->end = (uintptr_t) end;
+    arena->next = arena->start;
+}
+
+void *rg_arena_alloc(rg_arena_t *arena, size_t size, size_t align)
+{
+    uintptr_t addr = (arena->next + align - 1) & ~(align - 1);
+
+    if (addr > arena->end || arena->end - addr < size) {
+        return NULL;
+    }
+
+    arena->next = addr + size;
+    return (void *) addr;
+}
@@ -0,0 +1,259 @@
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "rom_loader.h"
+#include "rom_manager.h"
+#include "main.h"
+#include "gw_timer.h"
+#include "gw_lcd.h"
+#include "gw_blit.h"
+#include "gw_hash.h"
+#include "odroid_colors.h"
+#include "odroid_overlay.h"
+#include "lz4_depack.h"
+#include "lzma.h"
+#include "miniz.h"
+#include "inflate_fast.h"
+#include "emu_arena.h"
+#include "boot_trace.h"
+
+// Input consumed between two progress reports
+#define DEFLATE_CHUNK_SIZE (16 * 1024)
+// Output produced between two progress reports
+#define LZ4_CHUNK_SIZE     (32 * 1024)
+
+#define PROGRESS_BAR_WIDTH  200
+#define PROGRESS_BAR_HEIGHT 8
+
+static rom_loader_progress_t progress_callback;
+static rom_loader_stats_t stats;
+
+// The active file's ROM, see rom_loader_crc32_active()
+static const uint8_t *active_data;
+static size_t active_size;
+static uint32_t active_crc32;
+
+static bool lz4_detect(const uint8_t *src, size_t src_size, const char *ext)
+{
+    return (src_size >= LZ4_MAGIC_SIZE) && (memcmp(src, LZ4_MAGIC, LZ4_MAGIC_SIZE) == 0);
+}
+
+static size_t lz4_decompress(uint8_t *dst, size_t dst_size, const uint8_t *src, size_t src_size)
+{
+    lz4_stream_t stream;
+    int status = lz4_stream_init(&stream, src, dst, dst_size);
+
+    if (stream.original_size > dst_size) {
+        printf("LZ4: %lu bytes don't fit into %u bytes.\n", stream.original_size, dst_size);
+        return 0;
+    }
+
+    while (status == LZ4_STREAM_MORE) {
+        status = lz4_stream_run(&stream, LZ4_CHUNK_SIZE);
+        rom_loader_progress(stream.in_pos, src_size);
+    }
+
+    return (status == LZ4_STREAM_DONE) ? stream.out_pos : 0;
+}
+
+static bool deflate_detect(const uint8_t *src, size_t src_size, const char *ext)
+{
+    return strcmp(ext, "zopfli") == 0;
+}
+
+#if DEFLATE_FAST
+// With its tables in DTCM if there's room, only while the ROM is unpacked
+static bool deflate_decompress_fast(uint8_t *dst, size_t dst_size, const uint8_t *src, size_t src_size,
+                                    size_t *size)
+{
+    uint32_t marks[EMU_ARENA_COUNT];
+    inflate_tables_t *tables;
+
+    for (int i = 0; i < EMU_ARENA_COUNT; i++) {
+        marks[i] = emu_arena_mark(i);
+    }
+
+    tables = emu_arena_try_alloc(EMU_ARENA_DTCM, sizeof(*tables), 4);
+    if (tables == NULL) {
+        return false;
+    }
+
+    *size = inflate_fast(dst, dst_size, src, src_size, tables, &rom_loader_progress);
+
+    for (int i = 0; i < EMU_ARENA_COUNT; i++) {
+        emu_arena_release(i, marks[i]);
+    }
+    return true;
+}
+#endif
+
+static size_t deflate_decompress(uint8_t *dst, size_t dst_size, const uint8_t *src, size_t src_size)
+{
+    tinfl_decompressor inflator;
+    size_t in_offset = 0;
+    size_t out_offset = 0;
+
+#if DEFLATE_FAST
+    size_t size;
+
+    if (deflate_decompress_fast(dst, dst_size, src, src_size, &size)) {
+        return size;
+    }
+#endif
+
+    tinfl_init(&inflator);
+
+    while (true) {
+        size_t in_bytes = src_size - in_offset;
+        size_t out_bytes = dst_size - out_offset;
+        int flags = TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF;
+
+        if (in_bytes > DEFLATE_CHUNK_SIZE) {
+            in_bytes = DEFLATE_CHUNK_SIZE;
+            flags |= TINFL_FLAG_HAS_MORE_INPUT;
+        }
+
+        tinfl_status status = tinfl_decompress(&inflator, &src[in_offset], &in_bytes,
+                                               dst, &dst[out_offset], &out_bytes, flags);
+        in_offset += in_bytes;
+        out_offset += out_bytes;
+
+        rom_loader_progress(in_offset, src_size);
+
+        if (status == TINFL_STATUS_DONE) {
+            return out_offset;
+        }
+        if (status != TINFL_STATUS_NEEDS_MORE_INPUT) {
+            // Corrupt input, or dst is too small
+            return 0;
+        }
+    }
+}
+
+static bool lzma_detect(const uint8_t *src, size_t src_size, const char *ext)
+{
+    return strcmp(ext, "lzma") == 0;
+}
+
+static size_t lzma_decompress(uint8_t *dst, size_t dst_size, const uint8_t *src, size_t src_size)
+{
+    return lzma_inflate(dst, dst_size, src, src_size);
+}
+
+static const rom_codec_t codecs[] = {
+    {"LZ4", &lz4_detect, &lz4_decompress},
+    {"DEFLATE", &deflate_detect, &deflate_decompress},
+    {"LZMA", &lzma_detect, &lzma_decompress},
+};
+
+void rom_loader_set_progress(rom_loader_progress_t callback)
+{
+    progress_callback = callback;
+}
+
+void rom_loader_progress(uint32_t done, uint32_t total)
+{
+    wdog_refresh();
+
+    if (progress_callback) {
+        progress_callback(done, total);
+    }
+}
+
+void rom_loader_progress_bar(uint32_t done, uint32_t total)
+{
+    static int drawn = -1;
+    int x = (GW_LCD_WIDTH - PROGRESS_BAR_WIDTH) / 2;
+    int y = (GW_LCD_HEIGHT - PROGRESS_BAR_HEIGHT) / 2;
+    int width = total ? ((uint64_t) PROGRESS_BAR_WIDTH * done) / total : 0;
+
+    // The emulator may still be clearing the framebuffers
+    gw_blit_wait();
+
+    if (done == 0 || width < drawn) {
+        odroid_overlay_draw_fill_rect(x, y, PROGRESS_BAR_WIDTH, PROGRESS_BAR_HEIGHT, C_GW_MAIN_COLOR);
+        drawn = 0;
+    }
+
+    if (width == drawn) {
+        return;
+    }
+
+    odroid_overlay_draw_fill_rect(x + drawn, y, width - drawn, PROGRESS_BAR_HEIGHT, C_GW_YELLOW);
+    drawn = width;
+
+    // Straight to all of the LCD buffers, nothing else is drawing while loading
+    lcd_sync();
+}
+
+size_t rom_loader_load(const uint8_t *src, size_t src_size, const char *ext,
+                       uint8_t *dst, size_t dst_size, const uint8_t **data)
+{
+    uint32_t start = gw_timer_us();
+    const rom_codec_t *codec = NULL;
+
+    for (int i = 0; i < sizeof(codecs) / sizeof(codecs[0]); i++) {
+        if (codecs[i].detect(src, src_size, ext ? ext : "")) {
+            codec = &codecs[i];
+            break;
+        }
+    }
+
+    memset(&stats, 0, sizeof(stats));
+    stats.packed_size = src_size;
+
+    if (codec == NULL) {
+        *data = src;
+        stats.size = src_size;
+        return src_size;
+    }
+
+    printf("%s compressed ROM detected.\n", codec->name);
+    printf("Uncompressing to %p. %u bytes available.\n", dst, dst_size);
+
+    assert(dst != NULL);
+
+    rom_loader_progress(0, src_size);
+    size_t size = codec->decompress(dst, dst_size, src, src_size);
+    rom_loader_progress(src_size, src_size);
+
+    assert(size > 0);
+
+    stats.codec = codec->name;
+    stats.size = size;
+    stats.time_us = gw_timer_us() - start;
+
+    // Also read by parse_roms.py --codec-calibration
+    printf("%s: uncompressed %lu to %lu bytes in %lu us.\n",
+           stats.codec, stats.packed_size, stats.size, stats.time_us);
+
+    *data = dst;
+    return size;
+}
+
+size_t rom_loader_load_active(uint8_t *dst, size_t dst_size, const uint8_t **data)
+{
+    size_t size = rom_loader_load(ROM_DATA, ROM_DATA_LENGTH, ROM_EXT, dst, dst_size, data);
+
+    active_data = *data;
+    active_size = size;
+    active_crc32 = ACTIVE_FILE->checksum;
+
+    boot_trace("ROM loaded");
+    return size;
+}
+
+uint32_t rom_loader_crc32_active(void)
+{
+    if (active_crc32 == 0 && active_data != NULL) {
+        active_crc32 = gw_crc32(active_data, active_size);
+    }
+
+    return active_crc32;
+}
+
+rom_loader_stats_t rom_loader_get_stats(void)
+{
+    return stats;
+}
@@ -0,0 +1,117 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "emu_arena.h"
+#include "emu_snapshot.h"
+#include "run_ahead.h"
+
+static uint8_t *snapshot;
+static size_t snapshot_size;    // Room for it, once known
+static size_t snapshot_used;
+static bool allocated;
+
+static int frames;
+static bool active;
+
+void run_ahead_init(uint8_t *buffer, size_t size)
+{
+    snapshot = buffer;
+    snapshot_size = size;
+    allocated = buffer != NULL;
+    frames = 0;
+    active = false;
+}
+
+int run_ahead_frames(void)
+{
+    return frames;
+}
+
+bool run_ahead_active(void)
+{
+    return active;
+}
+
+// If the size of a snapshot isn't known, the first one goes into what's
+// left of a region, which is then cut down to its size
+static bool allocate(void)
+{
+    static const emu_arena_region_t regions[] = {EMU_ARENA_RAM_EMU, EMU_ARENA_AHBRAM};
+    size_t known = emu_snapshot_size();
+
+    if (known > 0) {
+        snapshot = emu_arena_try_alloc(EMU_ARENA_RAM_EMU, known, 4);
+        snapshot_size = known;
+        snapshot_used = snapshot ? emu_snapshot_save(snapshot, snapshot_size) : 0;
+        allocated = snapshot_used > 0;
+        if (!allocated) {
+            printf("Run-ahead: no room for the snapshot\n");
+        }
+        return allocated;
+    }
+
+    for (int i = 0; i < sizeof(regions) / sizeof(regions[0]); i++) {
+        uint32_t mark = emu_arena_mark(regions[i]);
+        size_t size;
+        uint8_t *buffer = emu_arena_alloc_rest(regions[i], 4, &size);
+        size_t used = emu_snapshot_save(buffer, size);
+
+        if (used > 0) {
+            emu_arena_release(regions[i], (uint32_t) buffer + used);
+            snapshot = buffer;
+            snapshot_size = used;
+            snapshot_used = used;
+            allocated = true;
+            printf("Run-ahead: %u byte snapshot\n", used);
+            return true;
+        }
+        emu_arena_release(regions[i], mark);
+    }
+
+    printf("Run-ahead: no room for the snapshot\n");
+    return false;
+}
+
+bool run_ahead_save(void)
+{
+    if (!allocated) {
+        if (!allocate()) {
+            frames = 0;
+            return false;
+        }
+    } else {
+        snapshot_used = emu_snapshot_save(snapshot, snapshot_size);
+        if (snapshot_used == 0) {
+            // The state grew, e.g. the game turned on more SRAM
+            printf("Run-ahead: snapshot doesn't fit in %u bytes\n", snapshot_size);
+            frames = 0;
+            return false;
+        }
+    }
+
+    active = true;
+    return true;
+}
+
+void run_ahead_load(void)
+{
+    active = false;
+    emu_snapshot_load(snapshot, snapshot_used);
+}
+
+bool run_ahead_update_cb(odroid_dialog_choice_t *option, odroid_dialog_event_t event, uint32_t repeat)
+{
+    if (event == ODROID_DIALOG_PREV) {
+        frames = frames > 0 ? frames - 1 : RUN_AHEAD_MAX_FRAMES;
+    } else if (event == ODROID_DIALOG_NEXT) {
+        frames = frames < RUN_AHEAD_MAX_FRAMES ? frames + 1 : 0;
+    }
+
+    if (frames == 0) {
+        strcpy(option->value, "Off");
+    } else {
+        sprintf(option->value, "%d frame%s", frames, frames > 1 ? "s" : "");
+    }
+
+    return event == ODROID_DIALOG_ENTER;
+}
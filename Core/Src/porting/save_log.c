@@ -0,0 +1,308 @@
+#include <assert.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "main.h"
+#include "gw_flash.h"
+#include "gw_linker.h"
+#include "crc32.h"
+#include "save_log.h"
+#include "store_async.h"
+#include "xip_copy.h"
+
+#if SAVE_LOG_SIZE > 0
+
+#define SECTOR_SIZE (4 * 1024)
+#define PAGE_SIZE 256
+
+// Slots that can have a record in the log at the same time
+#define MAX_ENTRIES 64
+
+#define ROUND_UP(x, n) (((x) + (n) - 1) & ~((n) - 1))
+
+uint8_t save_log[SAVE_LOG_SIZE] __attribute__((section (".saveflash"))) __attribute__((aligned(4096)));
+
+// Latest record of a slot
+typedef struct {
+    uint32_t slot;
+    uint32_t offset;
+    uint32_t seq;
+    uint32_t size;
+} entry_t;
+
+static entry_t entries[MAX_ENTRIES];
+static uint32_t entry_count;
+
+static bool scanned;
+static uint32_t head;       // Where the next record goes
+static uint32_t next_seq;
+
+// Between save_log_begin() and save_log_commit()
+static uint32_t pending_offset;
+static size_t pending_max_size;
+
+// For header pages and for copying records back to their slot
+static uint8_t buffer[SECTOR_SIZE] __attribute__((aligned(4)));
+
+static uint32_t slot_of(const uint8_t *flash_ptr)
+{
+    return flash_ptr - &__EXTFLASH_BASE__;
+}
+
+static uint32_t record_end(const entry_t *e)
+{
+    return e->offset + PAGE_SIZE + ROUND_UP(e->size, PAGE_SIZE);
+}
+
+static entry_t *find_entry(uint32_t slot)
+{
+    for (int i = 0; i < entry_count; i++) {
+        if (entries[i].slot == slot) {
+            return &entries[i];
+        }
+    }
+
+    return NULL;
+}
+
+static void remove_entry(entry_t *e)
+{
+    *e = entries[--entry_count];
+}
+
+static bool is_erased(uint32_t offset, uint32_t size)
+{
+    const uint32_t *words = (const uint32_t *) &save_log[offset];
+
+    for (uint32_t i = 0; i < size / 4; i++) {
+        if (words[i] != 0xffffffff) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static void program_header(uint32_t offset, const save_log_header_t *header)
+{
+    memset(buffer, 0xff, PAGE_SIZE);
+    memcpy(buffer, header, sizeof(*header));
+
+    OSPI_DisableMemoryMappedMode();
+    OSPI_Program(slot_of(&save_log[offset]), buffer, PAGE_SIZE);
+    OSPI_EnableMemoryMappedMode();
+}
+
+static void discard_record(entry_t *e)
+{
+    save_log_header_t header;
+
+    memcpy(&header, &save_log[e->offset], sizeof(header));
+    header.obsolete = 0;
+    program_header(e->offset, &header);
+
+    remove_entry(e);
+}
+
+// Writes the record back to its home slot and forgets it
+static void write_back(entry_t *e)
+{
+    const uint8_t *home = &__EXTFLASH_BASE__ + e->slot;
+
+    printf("Save log: writing %lu bytes back to 0x%08lx\n", e->size, e->slot);
+
+    // The data can't be read from the flash while it's being programmed
+    for (uint32_t pos = 0; pos < e->size; pos += SECTOR_SIZE) {
+        uint32_t n = (e->size - pos > SECTOR_SIZE) ? SECTOR_SIZE : e->size - pos;
+
+        copy_from_xip(buffer, &save_log[e->offset + PAGE_SIZE + pos], n);
+        store_save(home + pos, buffer, n);
+    }
+
+    discard_record(e);
+}
+
+static void write_back_oldest(void)
+{
+    entry_t *oldest = &entries[0];
+
+    for (int i = 1; i < entry_count; i++) {
+        if (entries[i].seq < oldest->seq) {
+            oldest = &entries[i];
+        }
+    }
+
+    write_back(oldest);
+}
+
+static void add_entry(uint32_t slot, uint32_t offset, uint32_t seq, uint32_t size)
+{
+    entry_t *e = find_entry(slot);
+
+    if (e == NULL) {
+        if (entry_count == MAX_ENTRIES) {
+            write_back_oldest();
+        }
+        e = &entries[entry_count++];
+    } else if (e->seq > seq) {
+        return;
+    }
+
+    *e = (entry_t) {
+        .slot   = slot,
+        .offset = offset,
+        .seq    = seq,
+        .size   = size,
+    };
+}
+
+static void scan(void)
+{
+    uint32_t offset = 0;
+
+    if (scanned) {
+        return;
+    }
+    scanned = true;
+
+    while (offset + PAGE_SIZE <= SAVE_LOG_SIZE) {
+        save_log_header_t header;
+
+        memcpy(&header, &save_log[offset], sizeof(header));
+
+        if (header.magic != SAVE_LOG_MAGIC ||
+            header.size > SAVE_LOG_SIZE - offset - PAGE_SIZE ||
+            crc32_le(0, &save_log[offset + PAGE_SIZE], header.size) != header.crc) {
+            offset += PAGE_SIZE;
+            continue;
+        }
+
+        if (header.obsolete == 0xffffffff) {
+            add_entry(header.slot, offset, header.seq, header.size);
+        }
+
+        offset += PAGE_SIZE + ROUND_UP(header.size, PAGE_SIZE);
+
+        if (header.seq >= next_seq) {
+            next_seq = header.seq + 1;
+            head = offset;
+        }
+    }
+
+    printf("Save log: %lu slots, next record at 0x%lx\n", entry_count, head);
+}
+
+/**
+ * Finds room for a record of up to max_size bytes at the head of the log,
+ * writes back the records in the way and erases it, in the background if
+ * requested. Returns the offset of the record, or UINT32_MAX if it doesn't fit.
+ */
+static uint32_t reserve(size_t max_size, bool background)
+{
+    uint32_t need = PAGE_SIZE + ROUND_UP(max_size, PAGE_SIZE);
+    uint32_t start = head;
+
+    // Keep room for the previous record, which may be the latest of its slot
+    if (need > SAVE_LOG_SIZE / 2) {
+        return UINT32_MAX;
+    }
+
+    // The rest of the sector the previous record ended in isn't erased again
+    if ((start & (SECTOR_SIZE - 1)) != 0 &&
+        !is_erased(start, ROUND_UP(start, SECTOR_SIZE) - start)) {
+        start = ROUND_UP(start, SECTOR_SIZE);
+    }
+
+    if (start + need > SAVE_LOG_SIZE) {
+        start = 0;
+    }
+
+    uint32_t erase_start = ROUND_UP(start, SECTOR_SIZE);
+    uint32_t erase_end = ROUND_UP(start + need, SECTOR_SIZE);
+
+    for (int i = 0; i < entry_count; i++) {
+        if (entries[i].offset < erase_end && record_end(&entries[i]) > erase_start) {
+            write_back(&entries[i]);
+            i--;
+        }
+    }
+
+    if (erase_end > erase_start) {
+        if (background) {
+            store_erase_async(&save_log[erase_start], erase_end - erase_start);
+        } else if (!is_erased(erase_start, erase_end - erase_start)) {
+            store_erase(&save_log[erase_start], erase_end - erase_start);
+        }
+    }
+
+    return start;
+}
+
+uint8_t *save_log_begin(const uint8_t *flash_ptr, size_t max_size)
+{
+    scan();
+
+    // Finish erasing in the background first
+    store_async_flush();
+
+    pending_offset = reserve(max_size, false);
+    pending_max_size = max_size;
+
+    if (pending_offset == UINT32_MAX) {
+        return NULL;
+    }
+
+    return &save_log[pending_offset + PAGE_SIZE];
+}
+
+void save_log_commit(const uint8_t *flash_ptr, size_t size)
+{
+    save_log_header_t header = {
+        .magic    = SAVE_LOG_MAGIC,
+        .slot     = slot_of(flash_ptr),
+        .seq      = next_seq++,
+        .size     = size,
+        .crc      = crc32_le(0, &save_log[pending_offset + PAGE_SIZE], size),
+        .obsolete = 0xffffffff,
+    };
+
+    assert(pending_offset != UINT32_MAX);
+    assert(size <= pending_max_size);
+
+    program_header(pending_offset, &header);
+    add_entry(header.slot, pending_offset, header.seq, size);
+
+    head = pending_offset + PAGE_SIZE + ROUND_UP(size, PAGE_SIZE);
+    pending_offset = UINT32_MAX;
+
+    // Have the room for the next save of the same size ready
+    reserve(pending_max_size, true);
+}
+
+const uint8_t *save_log_find(const uint8_t *flash_ptr, size_t *size)
+{
+    scan();
+
+    entry_t *e = find_entry(slot_of(flash_ptr));
+
+    if (e == NULL) {
+        return NULL;
+    }
+
+    *size = e->size;
+    return &save_log[e->offset + PAGE_SIZE];
+}
+
+void save_log_discard(const uint8_t *flash_ptr)
+{
+    scan();
+
+    entry_t *e = find_entry(slot_of(flash_ptr));
+
+    if (e != NULL) {
+        discard_record(e);
+    }
+}
+
+#endif
@@ -0,0 +1,408 @@
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "main.h"
+#include "crc32.h"
+#include "gw_flash.h"
+#include "gw_linker.h"
+#include "gw_timer.h"
+#include "lz4_pack.h"
+#include "quick_save.h"
+#include "rg_rtc.h"
+#include "save_log.h"
+#include "save_pack.h"
+#include "state_slots.h"
+#include "store_async.h"
+
+#define SECTOR_SIZE (4 * 1024)
+#define PAGE_SIZE 256
+
+typedef struct {
+    const uint8_t *flash_ptr;
+    size_t slot_size;
+    size_t pos;
+    // Compare pass: first offset that differs from the flash, SIZE_MAX if none
+    size_t first_diff;
+    // Write pass: sectors before start are left as they are
+    bool write;
+    size_t start;
+    // The area was erased up front
+    bool erased;
+    uint8_t page[PAGE_SIZE];
+} save_stream_t;
+
+static void program_page(save_stream_t *s, size_t offset, size_t size)
+{
+    if (!s->erased && (offset & (SECTOR_SIZE - 1)) == 0) {
+        store_erase(s->flash_ptr + offset, SECTOR_SIZE);
+    }
+
+    OSPI_DisableMemoryMappedMode();
+    OSPI_Program(s->flash_ptr + offset - &__EXTFLASH_BASE__, s->page, size);
+    OSPI_EnableMemoryMappedMode();
+}
+
+static void compare(save_stream_t *s, const uint8_t *data, size_t size)
+{
+    if (s->first_diff != SIZE_MAX) {
+        return;
+    }
+
+    if (s->pos + size > s->slot_size) {
+        s->first_diff = s->pos;
+        return;
+    }
+
+    for (size_t i = 0; i < size; i++) {
+        if (s->flash_ptr[s->pos + i] != data[i]) {
+            s->first_diff = s->pos + i;
+            return;
+        }
+    }
+}
+
+static void stream_write(void *ctx, const uint8_t *data, size_t size)
+{
+    save_stream_t *s = ctx;
+
+    if (!s->write) {
+        compare(s, data, size);
+        s->pos += size;
+        return;
+    }
+
+    // start is sector aligned, so pages are either all before it or not
+    while (size > 0) {
+        size_t in_page = s->pos & (PAGE_SIZE - 1);
+        size_t n = PAGE_SIZE - in_page;
+
+        if (n > size) {
+            n = size;
+        }
+
+        if (s->pos >= s->start) {
+            memcpy(&s->page[in_page], data, n);
+        }
+
+        s->pos += n;
+        data += n;
+        size -= n;
+
+        if ((s->pos & (PAGE_SIZE - 1)) == 0 && s->pos > s->start) {
+            program_page(s, s->pos - PAGE_SIZE, PAGE_SIZE);
+        }
+    }
+}
+
+static size_t thumb_size(const save_pack_meta_t *meta)
+{
+    return meta->thumb_width * meta->thumb_height * sizeof(uint16_t);
+}
+
+// Of the state and the screen, the thumbnail is NULL if there's none
+static const uint16_t *meta_init(save_pack_meta_t *meta, const uint8_t *data, size_t size)
+{
+    const uint16_t *thumb = state_slot_take_thumb();
+
+    *meta = (save_pack_meta_t) {
+        .play_time_s = state_slot_play_time(),
+        .crc32 = crc32_le(0, data, size),
+        .thumb_width = thumb ? STATE_THUMB_WIDTH : 0,
+        .thumb_height = thumb ? STATE_THUMB_HEIGHT : 0,
+    };
+
+    return thumb;
+}
+
+// After the LZ4 block, which ended at sizeof(header) + sizeof(meta) + packed_size
+static void write_thumb(lz4_pack_write_t write, void *ctx, const save_pack_header_t *header,
+                        const save_pack_meta_t *meta, const uint16_t *thumb)
+{
+    static const uint8_t padding[3];
+    size_t end = sizeof(*header) + sizeof(*meta) + header->packed_size;
+
+    if (meta->thumb_width == 0) {
+        return;
+    }
+
+    write(ctx, padding, SAVE_PACK_THUMB_OFFSET(header) - end);
+    write(ctx, (const uint8_t *) thumb, thumb_size(meta));
+}
+
+// Writes the slot into a new record of the save log, returns false if it doesn't fit
+static bool log_store(save_stream_t *s, const save_pack_header_t *header,
+                      const save_pack_meta_t *meta, const uint16_t *thumb,
+                      const uint8_t *data, size_t size, size_t total)
+{
+    const uint8_t *flash_ptr = s->flash_ptr;
+    uint8_t *record = save_log_begin(flash_ptr, total);
+
+    if (record == NULL) {
+        return false;
+    }
+
+    s->flash_ptr = record;
+    s->slot_size = total;
+    s->write = true;
+    s->start = 0;
+    s->erased = true;
+    s->pos = 0;
+
+    if (header != NULL) {
+        stream_write(s, (const uint8_t *) header, sizeof(*header));
+        stream_write(s, (const uint8_t *) meta, sizeof(*meta));
+        lz4_block_pack(data, size, &stream_write, s);
+        write_thumb(&stream_write, s, header, meta, thumb);
+    } else {
+        stream_write(s, data, size);
+    }
+
+    if ((s->pos & (PAGE_SIZE - 1)) != 0) {
+        program_page(s, s->pos & ~(PAGE_SIZE - 1), s->pos & (PAGE_SIZE - 1));
+    }
+
+    save_log_commit(flash_ptr, total);
+    s->flash_ptr = flash_ptr;
+
+    return true;
+}
+
+typedef struct {
+    uint8_t *dst;
+    size_t size;
+    size_t pos;
+} ram_stream_t;
+
+static void ram_write(void *ctx, const uint8_t *data, size_t size)
+{
+    ram_stream_t *r = ctx;
+
+    if (r->pos + size <= r->size) {
+        memcpy(&r->dst[r->pos], data, size);
+    }
+    r->pos += size;
+}
+
+// Packs the slot into the quick-save, returns 0 if it isn't armed or doesn't fit
+static size_t quick_store(const uint8_t *flash_ptr, size_t slot_size, save_pack_meta_t meta,
+                          const uint16_t *thumb, const uint8_t *data, size_t size)
+{
+    size_t max_size;
+    uint8_t *dst = quick_save_begin(&max_size);
+
+    if (dst == NULL) {
+        return 0;
+    }
+
+    ram_stream_t r = {
+        .dst = dst,
+        .size = (max_size < slot_size) ? max_size : slot_size,
+        .pos = sizeof(save_pack_header_t) + sizeof(save_pack_meta_t),
+    };
+    size_t packed_size = lz4_block_pack(data, size, &ram_write, &r);
+    save_pack_header_t header = {
+        .magic = SAVE_PACK_MAGIC_META,
+        .size = size,
+        .packed_size = packed_size,
+        .timestamp = GW_GetUnixTime(),
+    };
+
+    // The backup SRAM is small, the state goes first
+    if (SAVE_PACK_THUMB_OFFSET(&header) + thumb_size(&meta) > r.size) {
+        meta.thumb_width = 0;
+        meta.thumb_height = 0;
+    }
+    write_thumb(&ram_write, &r, &header, &meta, thumb);
+
+    if (r.pos > r.size) {
+        printf("Packed state of %u bytes doesn't fit into the quick-save\n", r.pos);
+        return 0;
+    }
+
+    memcpy(dst, &header, sizeof(header));
+    memcpy(dst + sizeof(header), &meta, sizeof(meta));
+    quick_save_commit(flash_ptr, r.pos);
+
+    printf("Packed state %u to %u bytes into the quick-save\n", size, r.pos);
+    return r.pos;
+}
+
+size_t save_pack_store(const uint8_t *flash_ptr, size_t slot_size,
+                       const uint8_t *data, size_t size)
+{
+    uint32_t start_us = gw_timer_us();
+    save_pack_meta_t meta;
+    const uint16_t *thumb = meta_init(&meta, data, size);
+    size_t quick_size = quick_store(flash_ptr, slot_size, meta, thumb, data, size);
+
+    if (quick_size > 0) {
+        return quick_size;
+    }
+
+    // A quick-save that is still being written may be for this slot
+    store_async_flush();
+    quick_save_poll();
+
+    size_t current_size = slot_size;
+    const uint8_t *current = save_log_find(flash_ptr, &current_size);
+    save_stream_t s = {
+        .flash_ptr = current ? current : flash_ptr,
+        .slot_size = current_size,
+        .pos = sizeof(save_pack_header_t) + sizeof(save_pack_meta_t),
+        .first_diff = SIZE_MAX,
+    };
+
+    size_t packed_size = lz4_block_pack(data, size, &stream_write, &s);
+    save_pack_header_t header = {
+        .magic = SAVE_PACK_MAGIC_META,
+        .size = size,
+        .packed_size = packed_size,
+        .timestamp = GW_GetUnixTime(),
+    };
+    size_t total = SAVE_PACK_THUMB_OFFSET(&header) + thumb_size(&meta);
+
+    // The thumbnail is left out before the state is stored as it is
+    if (meta.thumb_width != 0 && total > slot_size) {
+        meta.thumb_width = 0;
+        meta.thumb_height = 0;
+        total = sizeof(header) + sizeof(meta) + packed_size;
+    }
+    write_thumb(&stream_write, &s, &header, &meta, thumb);
+
+    s.flash_ptr = flash_ptr;
+    s.slot_size = slot_size;
+
+    if (total > slot_size) {
+        printf("State doesn't compress, saving %u bytes as they are\n", size);
+        assert(size <= slot_size);
+        if (!log_store(&s, NULL, NULL, NULL, data, size, size)) {
+            save_log_discard(flash_ptr);
+            store_save(flash_ptr, data, size);
+        }
+        return size;
+    }
+
+    const uint8_t *stored = current ? current : flash_ptr;
+
+    if (memcmp(stored, &header, offsetof(save_pack_header_t, timestamp)) != 0 ||
+        memcmp(stored + sizeof(header) + offsetof(save_pack_meta_t, crc32), &meta.crc32,
+               sizeof(meta) - offsetof(save_pack_meta_t, crc32)) != 0) {
+        s.first_diff = 0;
+    }
+
+    if (s.first_diff == SIZE_MAX) {
+        printf("State unchanged\n");
+        return total;
+    }
+
+    if (log_store(&s, &header, &meta, thumb, data, size, total)) {
+        printf("Packed state %u to %u bytes, appended it to the save log in %lu us\n",
+               size, total, gw_timer_us() - start_us);
+        return total;
+    }
+
+    if (current != NULL) {
+        // The home slot is compared with nothing, rewrite all of it
+        save_log_discard(flash_ptr);
+        s.first_diff = 0;
+    }
+
+    s.write = true;
+    s.start = s.first_diff & ~(SECTOR_SIZE - 1);
+    s.pos = 0;
+    stream_write(&s, (const uint8_t *) &header, sizeof(header));
+    stream_write(&s, (const uint8_t *) &meta, sizeof(meta));
+    lz4_block_pack(data, size, &stream_write, &s);
+    write_thumb(&stream_write, &s, &header, &meta, thumb);
+
+    if ((s.pos & (PAGE_SIZE - 1)) != 0 && s.pos > s.start) {
+        program_page(&s, s.pos & ~(PAGE_SIZE - 1), s.pos & (PAGE_SIZE - 1));
+    }
+
+    printf("Packed state %u to %u bytes, wrote %u bytes from %u in %lu us\n",
+           size, total, total - s.start, s.start, gw_timer_us() - start_us);
+
+    return total;
+}
+
+// The latest contents of the slot: in the quick-save, the save log or the slot itself
+static const uint8_t *find_current(const uint8_t *flash_ptr, size_t *slot_size)
+{
+    const uint8_t *record = quick_save_find(flash_ptr, slot_size);
+
+    if (record == NULL) {
+        record = save_log_find(flash_ptr, slot_size);
+    }
+
+    return record ? record : flash_ptr;
+}
+
+const uint8_t *save_pack_load(const uint8_t *flash_ptr, size_t slot_size,
+                              uint8_t *dst, size_t dst_size, size_t *size)
+{
+    save_pack_header_t header;
+    save_pack_meta_t meta;
+    size_t offset = sizeof(header);
+
+    flash_ptr = find_current(flash_ptr, &slot_size);
+    memcpy(&header, flash_ptr, sizeof(header));
+
+    if (header.magic != SAVE_PACK_MAGIC && header.magic != SAVE_PACK_MAGIC_META) {
+        *size = slot_size;
+        return flash_ptr;
+    }
+
+    if (header.magic == SAVE_PACK_MAGIC_META) {
+        memcpy(&meta, flash_ptr + offset, sizeof(meta));
+        offset += sizeof(meta);
+    }
+
+    if (header.size > dst_size || header.packed_size > slot_size - offset) {
+        return NULL;
+    }
+
+    if (lz4_block_unpack(flash_ptr + offset, header.packed_size, dst, header.size) != header.size) {
+        return NULL;
+    }
+
+    if (header.magic == SAVE_PACK_MAGIC_META) {
+        if (crc32_le(0, dst, header.size) != meta.crc32) {
+            printf("State CRC mismatch\n");
+            return NULL;
+        }
+        state_slot_play_set(meta.play_time_s);
+    }
+
+    *size = header.size;
+    return dst;
+}
+
+bool save_pack_peek(const uint8_t *flash_ptr, save_pack_header_t *header)
+{
+    size_t size;
+
+    flash_ptr = find_current(flash_ptr, &size);
+    memcpy(header, flash_ptr, sizeof(*header));
+
+    return header->magic != 0xffffffff;
+}
+
+const uint16_t *save_pack_peek_meta(const uint8_t *flash_ptr, size_t slot_size,
+                                    save_pack_header_t *header, save_pack_meta_t *meta)
+{
+    flash_ptr = find_current(flash_ptr, &slot_size);
+    memcpy(header, flash_ptr, sizeof(*header));
+    memset(meta, 0, sizeof(*meta));
+
+    if (header->magic != SAVE_PACK_MAGIC_META || header->packed_size > slot_size) {
+        return NULL;
+    }
+
+    memcpy(meta, flash_ptr + sizeof(*header), sizeof(*meta));
+    if (meta->thumb_width == 0 || SAVE_PACK_THUMB_OFFSET(header) + thumb_size(meta) > slot_size) {
+        return NULL;
+    }
+
+    return (const uint16_t *) (flash_ptr + SAVE_PACK_THUMB_OFFSET(header));
+}
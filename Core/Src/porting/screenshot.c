@@ -0,0 +1,164 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "emu_arena.h"
+#include "gw_lcd.h"
+#include "gw_timer.h"
+#include "lib/lz4_pack.h"
+#include "screenshot.h"
+#include "store_async.h"
+
+#if ENABLE_SCREENSHOT
+
+#define SECTOR_SIZE (4 * 1024)
+
+// Same size as __FBFLASH_LENGTH__ in the linker script
+uint8_t screenshot_area[((GW_LCD_WIDTH * GW_LCD_HEIGHT * 2 + SECTOR_SIZE - 1) / SECTOR_SIZE) * SECTOR_SIZE]
+    __attribute__((section (".fbflash"))) __attribute__((aligned(SECTOR_SIZE)));
+
+#ifdef GW_LCD_MODE_LUT8
+#define FORMAT SCREENSHOT_LUT8
+#define CLUT_SIZE (256 * sizeof(uint32_t))
+#else
+#define FORMAT SCREENSHOT_RGB565
+#define CLUT_SIZE 0
+#endif
+
+typedef struct {
+    uint8_t *dst;
+    size_t room;
+    bool overflow;
+} sink_t;
+
+static uint8_t *staging;
+static bool writing;
+static bool scanned;
+static uint32_t next_seq;
+static uint32_t next_offset;
+
+// Where the one after the newest goes, the area keeps them over resets
+static void scan(void)
+{
+    next_seq = 0;
+    next_offset = 0;
+
+    for (uint32_t offset = 0; offset < sizeof(screenshot_area); offset += SECTOR_SIZE) {
+        const screenshot_header_t *header = (const screenshot_header_t *) &screenshot_area[offset];
+        uint32_t size;
+
+        if (header->magic != SCREENSHOT_MAGIC) {
+            continue;
+        }
+        size = sizeof(*header) + header->clut_count * sizeof(uint32_t) + header->packed_size;
+        if (size > sizeof(screenshot_area) - offset || header->seq + 1 <= next_seq) {
+            continue;
+        }
+
+        next_seq = header->seq + 1;
+        next_offset = (offset + size + SECTOR_SIZE - 1) & ~(SECTOR_SIZE - 1);
+    }
+
+    scanned = true;
+}
+
+static void sink_write(void *ctx, const unsigned char *data, size_t size)
+{
+    sink_t *sink = ctx;
+
+    if (size > sink->room) {
+        sink->overflow = true;
+        sink->room = 0;
+        return;
+    }
+
+    memcpy(sink->dst, data, size);
+    sink->dst += size;
+    sink->room -= size;
+}
+
+void screenshot_reset(void)
+{
+    if (writing && store_async_busy()) {
+        store_async_flush();
+    }
+    writing = false;
+    staging = NULL;
+}
+
+bool screenshot_take(void)
+{
+    const size_t head = sizeof(screenshot_header_t) + CLUT_SIZE;
+    const void *frame = lcd_get_inactive_buffer();
+    screenshot_header_t *header;
+    uint32_t t0 = gw_timer_us();
+    size_t total;
+    sink_t sink;
+
+    if (staging == NULL) {
+        staging = emu_arena_try_alloc(EMU_ARENA_RAM_EMU, SCREENSHOT_STAGING_SIZE, 4);
+        if (staging == NULL) {
+            printf("Screenshot: no room for the staging buffer\n");
+            return false;
+        }
+    }
+    if (!scanned) {
+        scan();
+    }
+
+    // The previous one is still being written from the staging buffer
+    if (writing && store_async_busy()) {
+        store_async_flush();
+    }
+
+    sink = (sink_t) {
+        .dst = &staging[head],
+        .room = SCREENSHOT_STAGING_SIZE - head,
+    };
+    header = (screenshot_header_t *) staging;
+    *header = (screenshot_header_t) {
+        .magic = SCREENSHOT_MAGIC,
+        .seq = next_seq,
+        .width = GW_LCD_WIDTH,
+        .height = GW_LCD_HEIGHT,
+        .format = FORMAT,
+        .clut_count = CLUT_SIZE / sizeof(uint32_t),
+        .packed_size = lz4_block_pack(frame, GW_LCD_WIDTH * GW_LCD_HEIGHT * sizeof(pixel_t), &sink_write, &sink),
+    };
+#ifdef GW_LCD_MODE_LUT8
+    memcpy(&header[1], lcd_get_clut(), CLUT_SIZE);
+#endif
+
+    if (sink.overflow) {
+        printf("Screenshot: doesn't pack into %u bytes\n", SCREENSHOT_STAGING_SIZE);
+        return false;
+    }
+
+    total = head + header->packed_size;
+    if (next_offset + total > sizeof(screenshot_area)) {
+        next_offset = 0;
+    }
+
+    store_save_async(&screenshot_area[next_offset], staging, total);
+    writing = true;
+    printf("Screenshot %lu: %u bytes at 0x%05lx, packed in %lu us\n",
+           next_seq, total, next_offset, gw_timer_us() - t0);
+
+    next_seq++;
+    next_offset = (next_offset + total + SECTOR_SIZE - 1) & ~(SECTOR_SIZE - 1);
+
+    return true;
+}
+
+#else
+
+void screenshot_reset(void)
+{
+}
+
+bool screenshot_take(void)
+{
+    printf("Screenshot support is disabled\n");
+    return false;
+}
+
+#endif
@@ -4,13 +4,25 @@
 #include "main.h"
 #include "bilinear.h"
 #include "gw_lcd.h"
+#include "gw_blit.h"
+#include "gw_dirty.h"
+#include "rgb565.h"
+#include "pcm.h"
 #include "gw_linker.h"
 #include "gw_buttons.h"
+#include "save_pack.h"
+#include "state_slots.h"
 #include "shared.h"
 #include "rom_manager.h"
+#include "rom_loader.h"
 #include "common.h"
 #include "main_smsplusgx.h"
 #include "appid.h"
+#include "boot_trace.h"
+#include "profiler.h"
+#include "log_ring.h"
+#include "emu_snapshot.h"
+#include "page_cache_sms.h"
 
 #define SMS_WIDTH 256
 #define SMS_HEIGHT 192
@@ -25,10 +37,12 @@
 #define PAL_SHIFT_MASK 0x80
 
 #define AUDIO_BUFFER_LENGTH_SMS (AUDIO_SAMPLE_RATE / 60)
-#define AUDIO_BUFFER_LENGTH_DMA_SMS ((2 * AUDIO_SAMPLE_RATE) / 60)
 
 static uint16_t palette[32];
-static uint32_t palette_spaced[32];
+#ifndef GW_LCD_MODE_LUT8
+// palette[] is big endian, the blitters want plain RGB565
+static uint16_t palette565[32];
+#endif
 
 
 static bool consoleIsGG  = false;
@@ -36,11 +50,7 @@ static bool consoleIsSMS = false;
 static bool consoleIsCOL = false;
 static bool consoleIsSG  = false;
 
-// TODO: Move to lcd.c/h
-extern LTDC_HandleTypeDef hltdc;
-
 void set_config();
-unsigned int crc32_le(unsigned int crc, unsigned char const * buf,unsigned int len);
 
 // --- MAIN
 
@@ -48,11 +58,19 @@ static int
 load_rom_from_flash(uint8_t emu_engine)
 {
     static uint8 sram[0x8000];
-    cart.rom = (uint8 *)ROM_DATA;
-    cart.size = ROM_DATA_LENGTH;
+    const uint8_t *rom;
+
+    // Compressed ROMs are unpacked a page at a time, see page_cache_sms.h
+    if (sms_page_cache_detect(ROM_DATA, ROM_DATA_LENGTH)) {
+        cart.size = sms_page_cache_init(ROM_DATA, ROM_DATA_LENGTH, &rom);
+        cart.crc = sms_page_cache_crc32(ACTIVE_FILE->checksum);
+    } else {
+        cart.size = rom_loader_load_active(NULL, 0, &rom);
+        cart.crc = rom_loader_crc32_active();
+    }
+    cart.rom = (uint8 *)rom;
     cart.sram = sram;
     cart.pages = cart.size / 0x4000;
-    cart.crc = crc32_le(0, cart.rom, cart.size);
     cart.loaded = 1;
 
     if (emu_engine == SMSPLUSGX_ENGINE_COLECO) {
@@ -78,12 +96,36 @@ static void netplay_callback(netplay_event_t event, void *arg)
 
 extern uint32 glob_bp_lut[0x10000];
 
+// Same bound as the save state
+#define SNAPSHOT_SIZE (60 * 1024)
+
+static size_t snapshot_save(uint8_t *buffer, size_t size)
+{
+    if (size < SNAPSHOT_SIZE) {
+        return 0;
+    }
+    system_save_state(buffer);
+    return SNAPSHOT_SIZE;
+}
+
+static void snapshot_load(const uint8_t *buffer, size_t size)
+{
+    system_load_state((void *) buffer);
+    sms_page_cache_remap();
+}
+
+static const emu_snapshot_core_t snapshot_core = {
+    .save = &snapshot_save,
+    .load = &snapshot_load,
+    .size = SNAPSHOT_SIZE,
+};
+
 static bool SaveState(char *pathName)
 {
     uint8_t *state_save_buffer = (uint8_t *)glob_bp_lut;
     memset(state_save_buffer, 0x00, 60 * 1024);
     system_save_state(state_save_buffer);
-    store_save(ACTIVE_FILE->save_address, state_save_buffer, 60 * 1024);
+    save_pack_store(state_slot_current(), ACTIVE_FILE->save_size, state_save_buffer, 60 * 1024);
     /* restore the contents of _bp_lut */
     render_init();
     return false;
@@ -91,38 +133,102 @@ static bool SaveState(char *pathName)
 
 static bool LoadState(char *pathName)
 {
-    system_load_state((void *)ACTIVE_FILE->save_address);
+    size_t size;
+    const uint8_t *state = save_pack_load(state_slot_current(), ACTIVE_FILE->save_size,
+                                          (uint8_t *)glob_bp_lut, sizeof(glob_bp_lut), &size);
+
+    if (state != NULL) {
+        system_load_state((void *)state);
+        sms_page_cache_remap();
+    }
+
+    if (state != state_slot_current()) {
+        /* restore the contents of _bp_lut */
+        render_init();
+    }
     return true;
 }
 
 uint8_t *fb_buffer = emulator_framebuffer;
 
-#define CONV(_b0) ((0b11111000000000000000000000&_b0)>>10) | ((0b000001111110000000000&_b0)>>5) | ((0b0000000000011111&_b0));
+#ifdef GW_LCD_MODE_LUT8
+// CLUT entry used for the borders, after the 32 colors of the VDP
+#define BORDER_COLOR 32
+
+// Fill everything outside of the given rectangle
+static void
+fill_border_lut8(uint8_t *framebuffer, int x, int y, int w, int h, uint8_t color) {
+    memset(framebuffer, color, y * WIDTH);
+    memset(&framebuffer[(y + h) * WIDTH], color, (HEIGHT - y - h) * WIDTH);
+
+    for (int i = y; i < y + h; i++) {
+        memset(&framebuffer[i * WIDTH], color, x);
+        memset(&framebuffer[i * WIDTH + x + w], color, WIDTH - x - w);
+    }
+}
+
+// Nearest neighbour scaling, the palette lookup is done by the LTDC
+static void
+blit_lut8(bitmap_t *bmp, uint8_t *framebuffer, int dst_w, int dst_h) {
+    const int hpad = (WIDTH - dst_w) / 2;
+    const int vpad = (HEIGHT - dst_h) / 2;
+    const int x_ratio = ((bmp->viewport.w << 16) / dst_w) + 1;
+    const int y_ratio = ((bmp->viewport.h << 16) / dst_h) + 1;
+
+    fill_border_lut8(framebuffer, hpad, vpad, dst_w, dst_h, BORDER_COLOR);
+
+    for (int y = 0; y < dst_h; y++) {
+        int y_src = (y * y_ratio) >> 16;
+        uint8_t *src_row = &bmp->data[(y_src + bmp->viewport.y) * bmp->pitch + bmp->viewport.x];
+        uint8_t *dest_row = &framebuffer[(y + vpad) * WIDTH];
+
+        if (!gw_dirty_line(y_src)) {
+            continue;
+        }
+
+        for (int x = 0; x < dst_w; x++) {
+            dest_row[hpad + x] = src_row[(x * x_ratio) >> 16] & PIXEL_MASK;
+        }
+    }
+}
+
+static void
+blit_gg(bitmap_t *bmp, uint8_t *framebuffer) {	/* 160 x 144 -> 320 x 240 */
+    blit_lut8(bmp, framebuffer, 320, 240);
+}
+
+static void
+blit_sms(bitmap_t *bmp, uint8_t *framebuffer) {	/* 256 x 192 -> 320 x 230 */
+    blit_lut8(bmp, framebuffer, 307, 230);
+}
+#else
+#define PAL565(_c) palette565[(_c) & PIXEL_MASK]
 
 static void
 blit_gg(bitmap_t *bmp, uint16_t *framebuffer) {	/* 160 x 144 -> 320 x 240 */
     int y_src = 0;
     int y_dst = 0;
     for (; y_src < bmp->viewport.h; y_src += 3, y_dst += 5) {
-        int x_src = 0;
-        int x_dst = 0;
-        for (; x_src < bmp->viewport.w; x_src += 1, x_dst += 2) {
-            uint8_t *src_col = &bmp->data[(y_src + bmp->viewport.y) * bmp->pitch + x_src + bmp->viewport.x];
-            uint32_t b0 = palette_spaced[src_col[bmp->pitch * 0] & 0x1f];
-            uint32_t b1 = palette_spaced[src_col[bmp->pitch * 1] & 0x1f];
-            uint32_t b2 = palette_spaced[src_col[bmp->pitch * 2] & 0x1f];
-
-            framebuffer[((y_dst + 0) * WIDTH) + x_dst] = CONV(b0);
-            framebuffer[((y_dst + 1) * WIDTH) + x_dst] = CONV((b0+b1)>>1);
-            framebuffer[((y_dst + 2) * WIDTH) + x_dst] = CONV(b1);
-            framebuffer[((y_dst + 3) * WIDTH) + x_dst] = CONV((b1+b2)>>1);
-            framebuffer[((y_dst + 4) * WIDTH) + x_dst] = CONV(b2);
-
-            framebuffer[((y_dst + 0) * WIDTH) + x_dst + 1] = CONV(b0);
-            framebuffer[((y_dst + 1) * WIDTH) + x_dst + 1] = CONV((b0+b1)>>1);
-            framebuffer[((y_dst + 2) * WIDTH) + x_dst + 1] = CONV(b1);
-            framebuffer[((y_dst + 3) * WIDTH) + x_dst + 1] = CONV((b1+b2)>>1);
-            framebuffer[((y_dst + 4) * WIDTH) + x_dst + 1] = CONV(b2);
+        // Each group of 5 output lines is interpolated from 3 source lines
+        if (!gw_dirty_lines(y_src, 3)) {
+            continue;
+        }
+        // Two pixels at a time, each of them written twice
+        uint8_t *src_row = &bmp->data[(y_src + bmp->viewport.y) * bmp->pitch + bmp->viewport.x];
+        uint32_t *dst = (uint32_t *) &framebuffer[y_dst * WIDTH];
+        for (int x_src = 0; x_src < bmp->viewport.w; x_src += 2) {
+            uint8_t *src_col = &src_row[x_src];
+            uint32_t lines[5];
+
+            rgb565_3to5(lines,
+                        rgb565_pack(PAL565(src_col[bmp->pitch * 0]), PAL565(src_col[bmp->pitch * 0 + 1])),
+                        rgb565_pack(PAL565(src_col[bmp->pitch * 1]), PAL565(src_col[bmp->pitch * 1 + 1])),
+                        rgb565_pack(PAL565(src_col[bmp->pitch * 2]), PAL565(src_col[bmp->pitch * 2 + 1])));
+
+            for (int i = 0; i < 5; i++) {
+                dst[(i * WIDTH / 2) + x_src + 0] = rgb565_dup(rgb565_lo(lines[i]));
+                dst[(i * WIDTH / 2) + x_src + 1] = rgb565_dup(rgb565_hi(lines[i]));
+            }
         }
     }
 }
@@ -132,103 +238,88 @@ blit_sms(bitmap_t *bmp, uint16_t *framebuffer) {	/* 256 x 192 -> 320 x 230 */
     const int hpad = (WIDTH - 307) / 2;
     const int vpad = (HEIGHT - 230) / 2;
 
-    uint32_t block[6 * 5]; /* workspace: 5 rows, 6 pixels wide */
+    uint32_t block[3 * 5]; /* workspace: 5 rows, 3 pixel pairs wide */
+
+    /* Borders are cleared by the DMA2D while the CPU scales */
+    gw_blit_fill_border_rgb565(framebuffer, WIDTH, WIDTH, HEIGHT, hpad, vpad, 307, 230, 0);
 
     int y_src = 1;         /* 1st and last row of 192 will not be scaled */
     int y_dst = 1 + vpad;  /* the remaining 190 are scaled */
     for (; y_src < bmp->viewport.h - 1; y_src += 5, y_dst += 6) {
+        // Each group of 6 output lines is interpolated from 5 source lines
+        if (!gw_dirty_lines(y_src, 5)) {
+            continue;
+        }
         int x_src = 0;
-        int x_dst = hpad;
+        int x_dst = hpad;  /* even, the pixel pairs can be stored as words */
         for (; x_src < bmp->viewport.w - 1; x_src += 5, x_dst += 6) {
             for (int y = 0; y < 5; y++) {
-                uint8_t *src_row = &bmp->data[(y_src + y + bmp->viewport.y) * bmp->pitch];
-                uint32_t b0 = palette_spaced[src_row[x_src + 0] & 0x1f];
-                uint32_t b1 = palette_spaced[src_row[x_src + 1] & 0x1f];
-                uint32_t b2 = palette_spaced[src_row[x_src + 2] & 0x1f];
-                uint32_t b3 = palette_spaced[src_row[x_src + 3] & 0x1f];
-                uint32_t b4 = palette_spaced[src_row[x_src + 4] & 0x1f];
-
-                block[(y * 6) + 0] = b0;
-                block[(y * 6) + 1] = (b0+b1+b1+b1)>>2;
-                block[(y * 6) + 2] = (b1+b2)>>1;
-                block[(y * 6) + 3] = (b2+b3)>>1;
-                block[(y * 6) + 4] = (b3+b3+b3+b4)>>2;
-                block[(y * 6) + 5] = b4;
+                uint8_t *src_row = &bmp->data[(y_src + y + bmp->viewport.y) * bmp->pitch + x_src];
+
+                rgb565_row_5to6(&block[y * 3],
+                                PAL565(src_row[0]), PAL565(src_row[1]), PAL565(src_row[2]),
+                                PAL565(src_row[3]), PAL565(src_row[4]));
             }
 
-            for (int x = 0; x < 6; x++) {
-                uint32_t b0 = block[(0 * 6) + x];
-                uint32_t b1 = block[(1 * 6) + x];
-                uint32_t b2 = block[(2 * 6) + x];
-                uint32_t b3 = block[(3 * 6) + x];
-                uint32_t b4 = block[(4 * 6) + x];
-
-                framebuffer[((y_dst + 0) * WIDTH) + x + x_dst] = CONV(b0);
-                framebuffer[((y_dst + 1) * WIDTH) + x + x_dst] = CONV((b0+b1+b1+b1)>>2);
-                framebuffer[((y_dst + 2) * WIDTH) + x + x_dst] = CONV((b1+b2)>>1);
-                framebuffer[((y_dst + 3) * WIDTH) + x + x_dst] = CONV((b2+b3)>>1);
-                framebuffer[((y_dst + 4) * WIDTH) + x + x_dst] = CONV((b3+b3+b3+b4)>>2);
-                framebuffer[((y_dst + 5) * WIDTH) + x + x_dst] = CONV(b4);
+            for (int x = 0; x < 3; x++) {
+                uint32_t col[5] = { block[0 * 3 + x], block[1 * 3 + x], block[2 * 3 + x],
+                                    block[3 * 3 + x], block[4 * 3 + x] };
+                uint32_t lines[6];
+
+                rgb565_5to6(lines, col);
+
+                for (int i = 0; i < 6; i++) {
+                    uint32_t *dst = (uint32_t *) &framebuffer[((y_dst + i) * WIDTH) + x_dst];
+                    dst[x] = lines[i];
+                }
             }
         }
 
         /* Last column, x_src = 255 */
         uint8_t *src_col = &bmp->data[(y_src + bmp->viewport.y) * bmp->pitch + x_src];
-        uint32_t b0 = palette_spaced[src_col[bmp->pitch * 0] & 0x1f];
-        uint32_t b1 = palette_spaced[src_col[bmp->pitch * 1] & 0x1f];
-        uint32_t b2 = palette_spaced[src_col[bmp->pitch * 2] & 0x1f];
-        uint32_t b3 = palette_spaced[src_col[bmp->pitch * 3] & 0x1f];
-        uint32_t b4 = palette_spaced[src_col[bmp->pitch * 4] & 0x1f];
-
-        framebuffer[((y_dst + 0) * WIDTH) + x_dst] = CONV(b0);
-        framebuffer[((y_dst + 1) * WIDTH) + x_dst] = CONV((b0+b1+b1+b1)>>2);
-        framebuffer[((y_dst + 2) * WIDTH) + x_dst] = CONV((b1+b2)>>1);
-        framebuffer[((y_dst + 3) * WIDTH) + x_dst] = CONV((b2+b3)>>1);
-        framebuffer[((y_dst + 4) * WIDTH) + x_dst] = CONV((b3+b3+b3+b4)>>2);
-        framebuffer[((y_dst + 5) * WIDTH) + x_dst] = CONV(b4);
+        uint32_t col[5];
+        uint32_t lines[6];
+
+        for (int y = 0; y < 5; y++) {
+            col[y] = PAL565(src_col[bmp->pitch * y]);
+        }
+        rgb565_5to6(lines, col);
+
+        for (int i = 0; i < 6; i++) {
+            framebuffer[((y_dst + i) * WIDTH) + x_dst] = rgb565_lo(lines[i]);
+        }
     }
 
     y_src = 0;		   /* First & last row */
     y_dst = 0 + vpad;
     for (; y_src < bmp->viewport.h; y_src += 191, y_dst += 228) {
+        if (!gw_dirty_line(y_src)) {
+            continue;
+        }
         uint8_t *src_row = &bmp->data[(y_src + bmp->viewport.y) * bmp->pitch];
         uint16_t *dest_row = &framebuffer[WIDTH * y_dst];
         int x_src = 0;
         int x_dst = hpad;
         for (; x_src < bmp->viewport.w - 1; x_src += 5, x_dst += 6) {
-            uint32_t b0 = palette_spaced[src_row[x_src + 0] & 0x1f];
-            uint32_t b1 = palette_spaced[src_row[x_src + 1] & 0x1f];
-            uint32_t b2 = palette_spaced[src_row[x_src + 2] & 0x1f];
-            uint32_t b3 = palette_spaced[src_row[x_src + 3] & 0x1f];
-            uint32_t b4 = palette_spaced[src_row[x_src + 4] & 0x1f];
-
-            dest_row[x_dst + 0]   = CONV(b0);
-            dest_row[x_dst + 1] = CONV((b0+b1+b1+b1)>>2);
-            dest_row[x_dst + 2] = CONV((b1+b2)>>1);
-            dest_row[x_dst + 3] = CONV((b2+b3)>>1);
-            dest_row[x_dst + 4] = CONV((b3+b3+b3+b4)>>2);
-            dest_row[x_dst + 5] = CONV(b4);
+            rgb565_row_5to6((uint32_t *) &dest_row[x_dst],
+                            PAL565(src_row[x_src + 0]), PAL565(src_row[x_src + 1]),
+                            PAL565(src_row[x_src + 2]), PAL565(src_row[x_src + 3]),
+                            PAL565(src_row[x_src + 4]));
         }
         /* Last column, x_src = 255 */
-        dest_row[x_dst] = CONV(palette_spaced[src_row[x_src] & 0x1f]);
+        dest_row[x_dst] = PAL565(src_row[x_src]);
     }
 }
+#endif
 
 void sms_pcm_submit() {
-    uint8_t volume = odroid_audio_volume_get();
-    int32_t factor = volume_tbl[volume] / 2; // Divide by 2 to prevent overflow in stereo mixing
-    size_t offset = (dma_state == DMA_TRANSFER_STATE_HF) ? 0 : AUDIO_BUFFER_LENGTH_SMS;
-    if (audio_mute || volume == ODROID_AUDIO_VOLUME_MIN) {
-        for (int i = 0; i < AUDIO_BUFFER_LENGTH_SMS; i++) {
-            audiobuffer_dma[i + offset] = 0;
-        }
-    } else {
-        for (int i = 0; i < AUDIO_BUFFER_LENGTH_SMS; i++) {
-            /* mix left & right */
-            int32_t sample = (sms_snd.output[0][i] + sms_snd.output[1][i]);
-            audiobuffer_dma[i + offset] = (sample * factor) >> 8;
-        }
-    }
+    /* 50 Hz games make more samples per frame, the ring takes any amount */
+    int samples = MIN(sms_snd.sample_count, AUDIO_BUFFER_LENGTH);
+
+    profiler_begin(PROFILER_AUDIO);
+    pcm_downmix(audiobuffer_emulator, sms_snd.output[0], sms_snd.output[1], samples);
+    odroid_audio_ring_write(audiobuffer_emulator, samples);
+    profiler_end(PROFILER_AUDIO);
 }
 
 static void sms_draw_frame()
@@ -244,26 +335,82 @@ static void sms_draw_frame()
 
   if (delta >= 1000) {
       int fps = (10000 * frames) / delta;
-      printf("FPS: %d.%d, frames %ld, delta %ld ms\n", fps / 10, fps % 10, frames, delta);
+      LOG_DEFER("FPS: %d.%d, frames %ld, delta %ld ms\n", fps / 10, fps % 10, frames, delta);
       frames = 0;
       lastFPSTime = currentTime;
   }
 
   render_copy_palette((uint16_t *)palette);
+#ifdef GW_LCD_MODE_LUT8
+  bool direct = (bitmap.data != fb_buffer);
+
+  // Pixels rendered by the core still carry the priority flags above
+  // PIXEL_MASK, the CLUT repeats the palette for all of them.
+  uint16_t clut[256];
+  for (int i = 0; i < 256; i++) {
+      uint16_t p = palette[i & PIXEL_MASK];
+      clut[i] = (p << 8) | (p >> 8);
+  }
+  if (!direct) {
+      clut[BORDER_COLOR] = 0;
+  }
+  lcd_set_clut_rgb565(clut, 256);
+
+  if (direct) {
+      // Rendered straight into the LCD buffer by the core, only the parts
+      // outside of the viewport are left to clear. There is no spare CLUT
+      // entry when every index is in use, so the borders use color 0.
+      uint8_t *fb = lcd_get_active_buffer();
+      int offset = bitmap.data - fb;
+
+      fill_border_lut8(fb, offset % WIDTH + bitmap.viewport.x, offset / WIDTH + bitmap.viewport.y,
+                       bitmap.viewport.w, bitmap.viewport.h, 0);
+      gw_dirty_invalidate();
+      common_ingame_overlay();
+      lcd_swap();
+      return;
+  }
+
+  // Palette changes are handled by the LTDC, no need to redraw
+  uint32_t key = sms.console;
+#else
   for (int i = 0; i < 32; i++) {
-      uint16_t p = (palette[i] << 8) | (palette[i] >> 8);
-      palette_spaced[i] = ((0b1111100000000000 & p) << 10) |
-                          ((0b0000011111100000 & p) << 5) |
-                          ((0b0000000000011111 & p));
+      palette565[i] = (palette[i] << 8) | (palette[i] >> 8);
   }
 
+  // The palette can change every frame, it's part of the key
+  uint32_t key = gw_dirty_hash(palette, sizeof(palette), sms.console);
+#endif
+  gw_dirty_begin(&bitmap.data[bitmap.viewport.y * bitmap.pitch], bitmap.pitch,
+                 (bitmap.viewport.x + bitmap.viewport.w + 3) & ~3,
+                 bitmap.viewport.h, key);
+
+  lcd_beam_begin();
   curr_framebuffer = lcd_get_active_buffer();
   if (sms.console == CONSOLE_GG)     blit_gg(&bitmap, curr_framebuffer);
   else                               blit_sms(&bitmap, curr_framebuffer);
+  gw_blit_wait();
   common_ingame_overlay();
   lcd_swap();
 }
 
+// Point the core at the buffer to render the next frame into
+static void sms_set_bitmap()
+{
+#ifdef GW_LCD_MODE_LUT8
+  if (odroid_display_get_scaling_mode() == ODROID_DISPLAY_SCALING_OFF) {
+      // Unscaled, render straight into the LCD buffer. The bitmap is
+      // centered, which also centers the GG viewport.
+      uint8_t *fb = lcd_get_active_buffer();
+      bitmap.pitch = WIDTH;
+      bitmap.data = &fb[((HEIGHT - bitmap.height) / 2) * WIDTH + (WIDTH - bitmap.width) / 2];
+      return;
+  }
+#endif
+  bitmap.pitch = bitmap.width;
+  bitmap.data = fb_buffer;
+}
+
 static void sms_update_keys( odroid_gamepad_state_t* joystick )
 {
   uint8 k = 0;
@@ -326,6 +473,7 @@ app_main_smsplusgx(uint8_t load_state, uint8_t start_paused, uint8_t is_coleco)
 
     odroid_system_init(APPID_SMS, AUDIO_SAMPLE_RATE);
     odroid_system_emu_init(&LoadState, &SaveState, &netplay_callback);
+    emu_snapshot_init(&snapshot_core);
 
     system_reset_config();
     load_rom_from_flash( is_coleco );
@@ -352,9 +500,9 @@ app_main_smsplusgx(uint8_t load_state, uint8_t start_paused, uint8_t is_coleco)
 
     system_init2();
     system_reset();
+    sms_page_cache_remap();
 
-    memset(audiobuffer_dma, 0, sizeof(audiobuffer_dma));
-    HAL_SAI_Transmit_DMA(&hsai_BlockA1, (uint8_t *)audiobuffer_dma, AUDIO_BUFFER_LENGTH_DMA_SMS);
+    odroid_audio_ring_start(AUDIO_BUFFER_LENGTH_SMS);
 
     consoleIsSMS = sms.console == CONSOLE_SMS || sms.console == CONSOLE_SMS2;
     consoleIsGG  = sms.console == CONSOLE_GG || sms.console == CONSOLE_GGMS;
@@ -369,10 +517,15 @@ app_main_smsplusgx(uint8_t load_state, uint8_t start_paused, uint8_t is_coleco)
     }
 
     // Video
-    memset(framebuffer1, 0, sizeof(framebuffer1));
-    memset(framebuffer2, 0, sizeof(framebuffer2));
+    lcd_clear_async(0);
 
-    if (load_state) LoadState(NULL);
+    if (load_state) {
+        LoadState(NULL);
+        boot_trace("state loaded");
+    }
+
+    // The core draws straight into the framebuffers
+    gw_blit_wait();
 
     while (true)
     {
@@ -389,22 +542,17 @@ app_main_smsplusgx(uint8_t load_state, uint8_t start_paused, uint8_t is_coleco)
 
         sms_update_keys( &joystick );
 
+        sms_set_bitmap();
         system_frame(!drawFrame);
 
         if (drawFrame) {
+            profiler_begin(PROFILER_BLIT);
             sms_draw_frame();
-            sms_pcm_submit();
+            profiler_end(PROFILER_BLIT);
         }
+        // A skipped frame was still emulated, and made its samples
+        sms_pcm_submit();
 
-        if(!common_emu_state.skip_frames)
-        {
-            for(uint8_t p = 0; p < common_emu_state.pause_frames + 1; p++) {
-                static dma_transfer_state_t last_dma_state = DMA_TRANSFER_STATE_HF;
-                while (dma_state == last_dma_state) {
-                    cpumon_sleep();
-                }
-                last_dma_state = dma_state;
-            }
-        }
+        common_emu_sync();
     }
 }
@@ -0,0 +1,287 @@
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "shared.h"
+#include "crc32.h"
+#include "emu_arena.h"
+#include "gw_timer.h"
+#include "lz4_depack.h"
+#include "page_cache_sms.h"
+#include "rom_loader.h"
+
+// 1MB, the largest of the Sega mappers
+#define MAX_PAGES 64
+#define SLOTS_MIN 8
+#define SLOTS_MAX 32
+// Left in RAM_EMU for what allocates later, rewind and run-ahead
+#define RAM_EMU_RESERVE (192 * 1024)
+
+typedef struct {
+    uint8_t *ram;
+    int16_t page;
+    uint32_t used;      // When it was last mapped
+} slot_t;
+
+static const uint8_t *page_src[MAX_PAGES];
+static uint32_t page_size[MAX_PAGES];
+static int page_count;
+static size_t rom_size;
+
+static const uint8_t *unpacked;     // The whole ROM, when it fits
+
+static bool enabled;
+static const uint8_t *base;
+static int8_t page_slot[MAX_PAGES];
+static slot_t slots[SLOTS_MAX];
+static int slot_count;
+static uint32_t lru_clock;
+
+static void (*core_writemem16)(int address, int data);
+
+static uint32_t read_le32(const uint8_t *p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t) p[3] << 24);
+}
+
+// Skips the blocks of the frame without decoding them, NULL if it's corrupt
+static const uint8_t *frame_end(const uint8_t *frame, const uint8_t *end, uint32_t *size)
+{
+    const uint8_t *p = frame + LZ4_MAGIC_SIZE + LZ4_FLG_SIZE + LZ4_BD_SIZE;
+    uint8_t flags;
+
+    if (end - frame < LZ4_MAGIC_SIZE + LZ4_FLG_SIZE || memcmp(frame, LZ4_MAGIC, LZ4_MAGIC_SIZE) != 0) {
+        return NULL;
+    }
+    flags = frame[LZ4_FLG_OFFSET];
+
+    *size = SMS_PAGE_SIZE;
+    if (flags & LZ4_FLG_MASK_C_SIZE) {
+        *size = read_le32(p);
+        p += LZ4_CONTENT_SIZE;
+    }
+    if (flags & LZ4_FLG_MASK_DICTID) {
+        p += LZ4_DICTID_SIZE;
+    }
+    p += LZ4_HC_SIZE;
+
+    while (p + LZ4_FRAME_SIZE <= end) {
+        uint32_t block = read_le32(p);
+
+        p += LZ4_FRAME_SIZE;
+        if (block == 0) {
+            if (flags & LZ4_FLG_MASK_C_CHECKSUM) {
+                p += LZ4_CHECKSUM_SIZE;
+            }
+            return (p <= end && *size <= SMS_PAGE_SIZE) ? p : NULL;
+        }
+
+        p += block & ~LZ4_BLOCK_UNCOMPRESSED;
+        if (flags & LZ4_FLG_MASK_B_CHECKSUM) {
+            p += LZ4_CHECKSUM_SIZE;
+        }
+    }
+
+    return NULL;
+}
+
+static void unpack(int page, uint8_t *dst)
+{
+    lz4_stream_t stream;
+    int status = lz4_stream_init(&stream, page_src[page], dst, SMS_PAGE_SIZE);
+
+    while (status == LZ4_STREAM_MORE) {
+        status = lz4_stream_run(&stream, SMS_PAGE_SIZE);
+    }
+    assert(status == LZ4_STREAM_DONE);
+}
+
+bool sms_page_cache_detect(const uint8_t *src, size_t src_size)
+{
+    return src_size >= LZ4_MAGIC_SIZE && memcmp(src, LZ4_MAGIC, LZ4_MAGIC_SIZE) == 0;
+}
+
+static void init_slots(size_t room)
+{
+    int count = room / SMS_PAGE_SIZE;
+
+    count = count < SLOTS_MIN ? SLOTS_MIN : count;
+    count = count > SLOTS_MAX ? SLOTS_MAX : count;
+    count = count > page_count ? page_count : count;
+
+    // The first ones have to fit, from AHBRAM if need be
+    for (slot_count = 0; slot_count < count; slot_count++) {
+        uint8_t *ram = slot_count < SLOTS_MIN ? emu_arena_alloc(EMU_ARENA_RAM_EMU, SMS_PAGE_SIZE, 32)
+                                              : emu_arena_try_alloc(EMU_ARENA_RAM_EMU, SMS_PAGE_SIZE, 32);
+
+        if (ram == NULL) {
+            break;
+        }
+        slots[slot_count] = (slot_t) {ram, -1, 0};
+    }
+
+    memset(page_slot, -1, sizeof(page_slot));
+}
+
+size_t sms_page_cache_init(const uint8_t *src, size_t src_size, const uint8_t **rom)
+{
+    const uint8_t *end = src + src_size;
+    const uint8_t *frame = src;
+    size_t room;
+    uint8_t *buffer;
+
+    enabled = false;
+    unpacked = NULL;
+    lru_clock = 0;
+    rom_size = 0;
+
+    // Every page but the last one is full, the mapper counts on it
+    for (page_count = 0; frame < end && page_count < MAX_PAGES; page_count++) {
+        assert(page_count == 0 || page_size[page_count - 1] == SMS_PAGE_SIZE);
+        page_src[page_count] = frame;
+        frame = frame_end(frame, end, &page_size[page_count]);
+        assert(frame != NULL);
+        rom_size += page_size[page_count];
+    }
+    assert(frame == end);
+
+    room = emu_arena_free(EMU_ARENA_RAM_EMU);
+    room = room > RAM_EMU_RESERVE ? room - RAM_EMU_RESERVE : 0;
+
+    if (rom_size <= room) {
+        uint32_t t0 = gw_timer_us();
+
+        buffer = emu_arena_alloc(EMU_ARENA_RAM_EMU, rom_size, 32);
+        for (int page = 0; page < page_count; page++) {
+            unpack(page, &buffer[page * SMS_PAGE_SIZE]);
+            rom_loader_progress(page_src[page] - src, src_size);
+        }
+        printf("SMS: %d pages unpacked in %lu us\n", page_count, gw_timer_us() - t0);
+
+        unpacked = buffer;
+        *rom = buffer;
+        return rom_size;
+    }
+
+    init_slots(room);
+    printf("SMS: %d pages, %d of them in RAM\n", page_count, slot_count);
+
+    enabled = true;
+    base = src;
+    *rom = src;
+    return rom_size;
+}
+
+uint32_t sms_page_cache_crc32(uint32_t known)
+{
+    uint32_t crc = 0;
+
+    if (known != 0) {
+        return known;
+    }
+
+    // Through the first slot, before anything is mapped
+    for (int page = 0; page < page_count; page++) {
+        const uint8_t *data = unpacked ? &unpacked[page * SMS_PAGE_SIZE] : slots[0].ram;
+
+        if (unpacked == NULL) {
+            unpack(page, slots[0].ram);
+        }
+        crc = crc32_le(crc, (unsigned char *) data, page_size[page]);
+    }
+
+    return crc;
+}
+
+// Slots that cpu_readmap points into
+static uint32_t mapped_slots(void)
+{
+    uint32_t mapped = 0;
+
+    for (int i = 0; i < 64; i++) {
+        for (int slot = 0; slot < slot_count; slot++) {
+            if (cpu_readmap[i] >= slots[slot].ram && cpu_readmap[i] < slots[slot].ram + SMS_PAGE_SIZE) {
+                mapped |= 1u << slot;
+            }
+        }
+    }
+
+    return mapped;
+}
+
+static int load(int page, uint32_t pinned)
+{
+    int best = -1;
+
+    for (int slot = 0; slot < slot_count; slot++) {
+        if (!(pinned & (1u << slot)) && (best < 0 || slots[slot].used < slots[best].used)) {
+            best = slot;
+        }
+    }
+    assert(best >= 0);
+
+    if (slots[best].page >= 0) {
+        page_slot[slots[best].page] = -1;
+    }
+    unpack(page, slots[best].ram);
+    slots[best].page = page;
+    page_slot[page] = best;
+
+    return best;
+}
+
+static void remap(void)
+{
+    uint32_t pinned = 0;
+    bool pinned_known = false;
+
+    for (int i = 0; i < 64; i++) {
+        const uint8_t *ptr = cpu_readmap[i];
+        uint32_t offset;
+        int page, slot;
+
+        if (ptr < base || ptr >= base + rom_size) {
+            continue;
+        }
+
+        offset = ptr - base;
+        page = offset / SMS_PAGE_SIZE;
+        slot = page_slot[page];
+        if (slot < 0) {
+            if (!pinned_known) {
+                pinned |= mapped_slots();
+                pinned_known = true;
+            }
+            slot = load(page, pinned);
+        }
+
+        pinned |= 1u << slot;
+        slots[slot].used = ++lru_clock;
+        cpu_readmap[i] = slots[slot].ram + offset % SMS_PAGE_SIZE;
+    }
+}
+
+// Every mapper has its registers in the ROM area or at the end of RAM
+static void writemem16_paged(int address, int data)
+{
+    core_writemem16(address, data);
+
+    if (address < 0xc000 || address >= 0xfffc) {
+        remap();
+    }
+}
+
+void sms_page_cache_remap(void)
+{
+    if (!enabled) {
+        return;
+    }
+
+    // sms_init() sets the handler of the cart's mapper
+    if (cpu_writemem16 != &writemem16_paged) {
+        core_writemem16 = cpu_writemem16;
+        cpu_writemem16 = &writemem16_paged;
+    }
+
+    remap();
+}
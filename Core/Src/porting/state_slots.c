@@ -0,0 +1,233 @@
+#include <stdio.h>
+#include <time.h>
+
+#include "main.h"
+#include "common.h"
+#include "emu_arena.h"
+#include "gw_lcd.h"
+#include "odroid_colors.h"
+#include "rom_manager.h"
+#include "save_pack.h"
+#include "state_slots.h"
+
+#define THUMB_SCALE (GW_LCD_WIDTH / STATE_THUMB_WIDTH)
+#define THUMB_MARGIN 4
+
+static int current_slot;
+static const retro_emulator_file_t *menu_file;
+
+static uint16_t *thumb;
+static bool thumb_captured;
+static uint32_t play_base_s;
+static uint32_t play_start_s;
+
+const uint8_t *state_slot_address(const retro_emulator_file_t *file, int slot)
+{
+    return file->save_address + slot * file->save_size;
+}
+
+void state_slot_get_info(const retro_emulator_file_t *file, int slot, state_slot_info_t *info)
+{
+    save_pack_header_t header;
+    save_pack_meta_t meta;
+
+    info->thumb = save_pack_peek_meta(state_slot_address(file, slot), file->save_size, &header, &meta);
+    info->used = header.magic != 0xffffffff;
+    info->timestamp = (header.magic == SAVE_PACK_MAGIC || header.magic == SAVE_PACK_MAGIC_META) ?
+                      header.timestamp : 0;
+    info->play_time_s = meta.play_time_s;
+}
+
+int state_slot_latest(const retro_emulator_file_t *file)
+{
+    int latest = -1;
+    uint32_t latest_time = 0;
+
+    for (int slot = 0; slot < STATE_SLOTS; slot++) {
+        state_slot_info_t info;
+
+        state_slot_get_info(file, slot, &info);
+        if (info.used && (latest < 0 || info.timestamp > latest_time)) {
+            latest = slot;
+            latest_time = info.timestamp;
+        }
+    }
+
+    return latest;
+}
+
+const uint8_t *state_slot_current(void)
+{
+    return state_slot_address(ACTIVE_FILE, current_slot);
+}
+
+int state_slot_get(void)
+{
+    return current_slot;
+}
+
+void state_slot_set(int slot)
+{
+    if (slot >= 0 && slot < STATE_SLOTS) {
+        current_slot = slot;
+    }
+}
+
+// Left of the box, right of it, or else under it
+static void draw_thumb(int box_x, int box_y, int box_width, int box_height)
+{
+#ifndef GW_LCD_MODE_LUT8
+    state_slot_info_t info;
+    int x, y = box_y;
+
+    if (box_x >= STATE_THUMB_WIDTH + THUMB_MARGIN) {
+        x = box_x - THUMB_MARGIN - STATE_THUMB_WIDTH;
+    } else if (box_x + box_width + THUMB_MARGIN + STATE_THUMB_WIDTH <= ODROID_SCREEN_WIDTH) {
+        x = box_x + box_width + THUMB_MARGIN;
+    } else if (box_y + box_height + THUMB_MARGIN + STATE_THUMB_HEIGHT <= ODROID_SCREEN_HEIGHT) {
+        x = (ODROID_SCREEN_WIDTH - STATE_THUMB_WIDTH) / 2;
+        y = box_y + box_height + THUMB_MARGIN;
+    } else {
+        return;
+    }
+
+    if (y + STATE_THUMB_HEIGHT > ODROID_SCREEN_HEIGHT) {
+        y = ODROID_SCREEN_HEIGHT - STATE_THUMB_HEIGHT;
+    }
+
+    // Over the one of the slot that was selected before
+    state_slot_get_info(menu_file, current_slot, &info);
+    if (info.thumb != NULL) {
+        odroid_display_write(x, y, STATE_THUMB_WIDTH, STATE_THUMB_HEIGHT, info.thumb);
+    } else {
+        odroid_overlay_draw_fill_rect(x, y, STATE_THUMB_WIDTH, STATE_THUMB_HEIGHT, C_BLACK);
+    }
+#endif
+}
+
+void state_slot_menu_init(const retro_emulator_file_t *file)
+{
+    menu_file = file;
+    odroid_overlay_set_dialog_decoration(&draw_thumb);
+}
+
+void state_slot_menu_done(void)
+{
+    odroid_overlay_set_dialog_decoration(NULL);
+}
+
+bool state_slot_update_cb(odroid_dialog_choice_t *option, odroid_dialog_event_t event, uint32_t repeat)
+{
+    state_slot_info_t info;
+
+    if (event == ODROID_DIALOG_PREV) {
+        state_slot_set(current_slot > 0 ? current_slot - 1 : STATE_SLOTS - 1);
+    }
+
+    if (event == ODROID_DIALOG_NEXT) {
+        state_slot_set(current_slot < STATE_SLOTS - 1 ? current_slot + 1 : 0);
+    }
+
+    state_slot_get_info(menu_file, current_slot, &info);
+
+    if (!info.used) {
+        sprintf(option->value, "%d empty", current_slot + 1);
+    } else if (info.timestamp == 0) {
+        sprintf(option->value, "%d saved", current_slot + 1);
+    } else {
+        time_t t = info.timestamp;
+        struct tm tm;
+
+        gmtime_r(&t, &tm);
+        sprintf(option->value, "%d %02d/%02d %02d:%02d", current_slot + 1,
+                tm.tm_mon + 1, tm.tm_mday, tm.tm_hour, tm.tm_min);
+    }
+
+    return event == ODROID_DIALOG_ENTER;
+}
+
+static inline uint16_t to_rgb565(pixel_t pixel)
+{
+#ifdef GW_LCD_MODE_LUT8
+    uint32_t color = lcd_get_clut()[pixel];
+
+    return ((color >> 8) & 0xf800) | ((color >> 5) & 0x07e0) | ((color >> 3) & 0x001f);
+#else
+    return pixel;
+#endif
+}
+
+// Of the 2x2 pixels in the middle of the block
+static uint16_t average(const pixel_t *block)
+{
+    const pixel_t *row = &block[(THUMB_SCALE / 2 - 1) * (GW_LCD_WIDTH + 1)];
+    uint16_t p[4] = {
+        to_rgb565(row[0]), to_rgb565(row[1]),
+        to_rgb565(row[GW_LCD_WIDTH]), to_rgb565(row[GW_LCD_WIDTH + 1]),
+    };
+    uint32_t r = 0, g = 0, b = 0;
+
+    for (int i = 0; i < 4; i++) {
+        r += p[i] >> 11;
+        g += (p[i] >> 5) & 0x3f;
+        b += p[i] & 0x1f;
+    }
+
+    return ((r / 4) << 11) | ((g / 4) << 5) | (b / 4);
+}
+
+// The DMA2D can't scale, the CPU takes a pixel out of each block
+void state_slot_capture_thumb(void)
+{
+    const pixel_t *frame = lcd_get_inactive_buffer();
+
+    if (thumb == NULL) {
+        thumb = emu_arena_try_alloc(EMU_ARENA_AHBRAM,
+                                    STATE_THUMB_WIDTH * STATE_THUMB_HEIGHT * sizeof(uint16_t), 4);
+        if (thumb == NULL) {
+            return;
+        }
+    }
+
+    for (int y = 0; y < STATE_THUMB_HEIGHT; y++) {
+        const pixel_t *src = &frame[y * THUMB_SCALE * GW_LCD_WIDTH];
+        uint16_t *dst = &thumb[y * STATE_THUMB_WIDTH];
+
+        for (int x = 0; x < STATE_THUMB_WIDTH; x++) {
+            dst[x] = average(&src[x * THUMB_SCALE]);
+        }
+    }
+
+    thumb_captured = true;
+}
+
+const uint16_t *state_slot_take_thumb(void)
+{
+    if (!thumb_captured) {
+        state_slot_capture_thumb();
+    }
+
+    if (!thumb_captured) {
+        return NULL;
+    }
+
+    thumb_captured = false;
+    return thumb;
+}
+
+void state_slot_play_set(uint32_t play_time_s)
+{
+    play_base_s = play_time_s;
+    play_start_s = uptime_get();
+}
+
+uint32_t state_slot_play_time(void)
+{
+    return play_base_s + (uptime_get() - play_start_s);
+}
+
+void state_slot_reset(void)
+{
+    thumb = NULL;
+    thumb_captured = false;
+}
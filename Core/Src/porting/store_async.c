@@ -0,0 +1,188 @@
+#include <assert.h>
+#include <string.h>
+
+#include "main.h"
+#include "gw_flash.h"
+#include "gw_linker.h"
+#include "gw_timer.h"
+#include "store_async.h"
+
+#define SECTOR_SIZE (4 * 1024)
+#define PAGE_SIZE 256
+
+// How long an erase may run per step before it's suspended
+#define ERASE_SLICE_US 2000
+
+typedef enum {
+    STEP_IDLE,
+    STEP_COMPARE,
+    STEP_ERASE,
+    STEP_ERASE_RESUME,
+    STEP_PROGRAM,
+} step_t;
+
+static struct {
+    step_t step;
+    const uint8_t *flash_ptr;
+    const uint8_t *data;
+    size_t size;
+    // Of the current sector
+    size_t offset;
+    size_t chunk;
+    size_t programmed;
+} job;
+
+// The current sector as it will be written
+static uint8_t sector[SECTOR_SIZE] __attribute__((aligned(4)));
+
+static bool is_erased(const uint8_t *flash_ptr)
+{
+    const uint32_t *words = (const uint32_t *) flash_ptr;
+
+    for (size_t i = 0; i < SECTOR_SIZE / 4; i++) {
+        if (words[i] != 0xffffffff) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static void next_sector(void)
+{
+    job.offset += SECTOR_SIZE;
+    job.step = (job.offset < job.size) ? STEP_COMPARE : STEP_IDLE;
+}
+
+void store_save_async(const uint8_t *flash_ptr, const uint8_t *data, size_t size)
+{
+#ifdef DISABLE_STORE
+    return;
+#endif
+
+    // Only allow 4kB aligned pointers
+    assert(((flash_ptr - &__EXTFLASH_BASE__) & (SECTOR_SIZE - 1)) == 0);
+
+    if (job.step != STEP_IDLE && (job.flash_ptr != flash_ptr || job.data != data)) {
+        store_async_flush();
+    }
+
+    // The sectors are erased one at a time, this doesn't work on flashes
+    // with larger erase sizes.
+    if (OSPI_GetSmallestEraseSize() != SECTOR_SIZE) {
+        if (data == NULL) {
+            store_erase(flash_ptr, size);
+        } else {
+            store_save(flash_ptr, data, size);
+        }
+        return;
+    }
+
+    // Start over if the same area is written again, sectors that are already
+    // done compare equal.
+    job.flash_ptr = flash_ptr;
+    job.data = data;
+    job.size = size;
+    job.offset = 0;
+    job.step = (size > 0) ? STEP_COMPARE : STEP_IDLE;
+}
+
+void store_erase_async(const uint8_t *flash_ptr, size_t size)
+{
+    assert(((flash_ptr - &__EXTFLASH_BASE__) & (SECTOR_SIZE - 1)) == 0);
+    assert((size & (SECTOR_SIZE - 1)) == 0);
+
+    store_save_async(flash_ptr, NULL, size);
+}
+
+bool store_async_step(void)
+{
+    uint32_t address = job.flash_ptr + job.offset - &__EXTFLASH_BASE__;
+
+    switch (job.step) {
+    case STEP_IDLE:
+        return false;
+
+    case STEP_COMPARE:
+        job.chunk = job.size - job.offset;
+        if (job.chunk > SECTOR_SIZE) {
+            job.chunk = SECTOR_SIZE;
+        }
+
+        if (job.data == NULL) {
+            // Erase only
+            if (is_erased(&job.flash_ptr[job.offset])) {
+                next_sector();
+            } else {
+                job.step = STEP_ERASE;
+            }
+        } else if (memcmp(&job.flash_ptr[job.offset], &job.data[job.offset], job.chunk) == 0) {
+            next_sector();
+        } else {
+            memcpy(sector, &job.data[job.offset], job.chunk);
+            job.step = STEP_ERASE;
+        }
+        break;
+
+    case STEP_ERASE:
+    case STEP_ERASE_RESUME: {
+        uint32_t t0 = gw_timer_us();
+
+        OSPI_DisableMemoryMappedMode();
+        if (job.step == STEP_ERASE) {
+            OSPI_EraseAsync(address, SECTOR_SIZE);
+        } else {
+            OSPI_AsyncResume();
+        }
+
+        while (OSPI_AsyncBusy() && (gw_timer_us() - t0) < ERASE_SLICE_US) {
+            wdog_refresh();
+        }
+
+        // Let the emulator read from the flash again until the next step
+        if (OSPI_AsyncSuspend()) {
+            job.step = STEP_ERASE_RESUME;
+        } else {
+            OSPI_AsyncWait();
+            job.programmed = 0;
+            job.step = STEP_PROGRAM;
+            if (job.data == NULL) {
+                next_sector();
+            }
+        }
+        OSPI_EnableMemoryMappedMode();
+        break;
+    }
+
+    case STEP_PROGRAM: {
+        size_t n = job.chunk - job.programmed;
+        if (n > PAGE_SIZE) {
+            n = PAGE_SIZE;
+        }
+
+        OSPI_DisableMemoryMappedMode();
+        OSPI_Program(address + job.programmed, &sector[job.programmed], n);
+        OSPI_EnableMemoryMappedMode();
+
+        job.programmed += n;
+        if (job.programmed == job.chunk) {
+            next_sector();
+        }
+        break;
+    }
+    }
+
+    return true;
+}
+
+bool store_async_busy(void)
+{
+    return job.step != STEP_IDLE;
+}
+
+void store_async_flush(void)
+{
+    while (store_async_step()) {
+        wdog_refresh();
+    }
+}
@@ -1,73 +1,501 @@
+// Packed bitmap, see bitmaps.h. Generated by tools/img2bin.py --lut8-rle
 #if !defined(GNW_TARGET_ZELDA)
 #define GNW_TARGET_ZELDA 0
 #endif /* GNW_TARGET_ZELDA */
 
-const unsigned short header_col[] = {
+const unsigned char header_col[] __attribute__((aligned(4))) = {
 #if GNW_TARGET_ZELDA != 0
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x3BA3,0xA488,0xD488,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xCC89,0x1341,0x0320,0x0320,0x2BA3,0x9447,0xD4A9,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xCCA9,0x8447,0x1B62,0x0320,0x0320,0x43E4,0xD468,0xD467,0xD467,0xD467,0xD467,0xC488,0x1B83,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x6BE4,0xDC88,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0x2BA3,0x0320,0x0320,0x1B82,0x8447,0xCCA9,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xDC88,0x6426,0x0320,0x0320,0x0B41,0x6C06,0xC4A9,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD488,0xA468,0x3BA3,0x0320,0x0320,0x7C47,0xDCA9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xCCA9,0x33A3,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1341,0xB488,0xD4A9,0xD4A9,0xD4A9,0xDCC9,0xA468,0x0B41,0xAC88,0xDCA9,0xD4A9,0xD4A9,0xD4A9,0xD4C9,0x4C05,0x0320,0x0320,0x0320,0x3BA3,0x9467,0xCCA9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xCCA9,0x2BA3,0x2BA3,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xBCA9,0x1B82,0x0320,0x0320,0x1B62,0x7426,0xBCA9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xAC88,0x53E4,0x0320,0x0320,0x0320,0x4BC4,0xDCCA,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xAC88,0x5BE5,0x0B40,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x5BE4,0xD488,0xDC67,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xCC88,0x1341,0x0320,0x43C4,0xCC88,0xDC67,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xDC87,0xB467,0x2382,0x0320,0x43E4,0xD467,0xD446,0xD446,0xD446,0xD446,0xC488,0x1B83,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x6BE4,0xDC87,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD447,0x2BA3,0x0320,0x2BA3,0xBC67,0xDC87,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xDC67,0x6426,0x0320,0x1341,0xA447,0xDC87,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xDC67,0xD488,0x53C4,0x0320,0x1B61,0xC467,0xDC46,0xD446,0xD446,0xD446,0xDC67,0x9C47,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x7C26,0xDC87,0xD446,0xD446,0xD446,0xD467,0x3BA3,0x0320,0xAC47,0xDC66,0xD446,0xD446,0xD446,0xD467,0x5405,0x0320,0x0320,0x6405,0xD487,0xDC67,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD447,0x2BA3,0x2BA3,0xD447,0xD446,0xD446,0xD446,0xD446,0xC467,0x1B82,0x0320,0x2B82,0xBC88,0xDC87,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xDC66,0xDC87,0x9C47,0x1361,0x0320,0x4BC4,0xDC88,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xDC66,0xDC87,0x9C47,0x1341,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x3BA3,0xD488,0xD466,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xCC88,0x1341,0x1B62,0xC468,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC67,0xA447,0x0320,0x3BC4,0xD467,0xD447,0xD447,0xD447,0xD446,0xC488,0x1B83,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x6BE4,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0x2BA3,0x0B40,0xAC47,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC67,0x6426,0x0320,0x8C26,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xD488,0x33A3,0x0320,0x63E5,0xDC87,0xD447,0xD447,0xD447,0xD447,0xDC87,0x4BC4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x3BA3,0xD467,0xD447,0xD447,0xD447,0xDC87,0x8426,0x0320,0x0340,0xAC47,0xDC67,0xD447,0xD447,0xD447,0xD467,0x4C05,0x0320,0x4BC4,0xD467,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xCC67,0x2BA3,0x2BA3,0xD447,0xD447,0xD447,0xD447,0xD447,0xBC67,0x1382,0x1361,0xBC68,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC87,0x8426,0x0320,0x4BC4,0xDCA8,0xD446,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xDC87,0x9447,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xA467,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC66,0xCC88,0x0B41,0x7405,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xD446,0xD447,0xD447,0xD447,0xD447,0xD446,0xDC87,0x43C4,0x3BC4,0xD467,0xD447,0xD447,0xD447,0xD446,0xC488,0x1B83,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x6BE4,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC87,0xDC87,0xDC87,0xDC87,0xDC87,0xDC87,0xDC87,0xDC87,0xDC87,0xDC87,0xDC87,0xDC87,0xDC87,0x2BA3,0x4BC4,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC87,0x5C06,0x2B83,0xD467,0xD446,0xD447,0xD447,0xD447,0xD447,0xD446,0xD467,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xD446,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC67,0x9C47,0x0320,0x0B40,0xAC67,0xDC67,0xD447,0xD447,0xD447,0xDC67,0xB467,0x0B41,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1341,0xAC47,0xDC67,0xD447,0xD447,0xD467,0xC467,0x1B62,0x0320,0x0340,0xAC47,0xDC67,0xD447,0xD447,0xD447,0xD467,0x4C05,0x0320,0xB467,0xDC67,0xD447,0xD447,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD447,0x2BA3,0x2BA3,0xD447,0xD447,0xD447,0xD447,0xD447,0xBC67,0x1362,0x6C05,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xD467,0x2B82,0x4BC4,0xDCA8,0xD446,0xD447,0xD447,0xD447,0xD447,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xD467,0x43C4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xD488,0xD446,0xD447,0xD447,0xD447,0xD447,0xDC67,0xCC68,0xBC47,0xBC47,0xBC47,0xBC47,0xBC47,0xBC47,0xBC47,0xBC47,0xBC47,0xBC47,0xB468,0x1B62,0xAC88,0xDC46,0xD447,0xD447,0xD447,0xD447,0xDC67,0xD467,0xBC47,0xBC47,0xBC47,0xBC47,0xBC47,0xBC47,0xBC47,0xBC47,0xD467,0xD446,0xD447,0xD447,0xD447,0xD447,0xDC67,0x7C26,0x3BE5,0xD467,0xD447,0xD447,0xD447,0xD446,0xC488,0x1B83,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x6BE4,0xDC87,0xD447,0xD447,0xD447,0xD467,0xB468,0x53C3,0x53C3,0x53C3,0x53C3,0x53C3,0x53C3,0x53C3,0x53C3,0x53C3,0x53C3,0x53C3,0x53C3,0x53C3,0x1361,0x8C47,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD446,0xD467,0xBC47,0xBC47,0xBC47,0xBC47,0xBC47,0xBC47,0xBC47,0xBC47,0xBC47,0xBC47,0xC467,0x5405,0x5BC4,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD446,0xDC87,0xC467,0xBC47,0xBC47,0xBC47,0xBC47,0xBC47,0xBC47,0xBC47,0xCC68,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD446,0xD4A9,0x0320,0x0320,0x3BA3,0xD467,0xD447,0xD447,0xD447,0xD447,0xDC87,0x63E5,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x7C26,0xDC87,0xD447,0xD447,0xD447,0xDC87,0x63E5,0x0320,0x0320,0x0340,0xAC47,0xDC67,0xD447,0xD447,0xD447,0xD467,0x4BE5,0x33A3,0xD467,0xD446,0xD447,0xD446,0xDC67,0xD488,0xD488,0xD488,0xD488,0xD488,0xD488,0xD488,0xD488,0xD488,0xD488,0xD488,0xD488,0xD488,0xD488,0xD488,0x2BA3,0x2BA3,0xD447,0xD447,0xD447,0xD447,0xD447,0xBC67,0x1BA3,0xA426,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC88,0xD488,0xD488,0xD488,0xD488,0xD488,0xD488,0xD488,0xD488,0xDC67,0xD446,0xD447,0xD447,0xD447,0xD447,0xDC87,0x7426,0x43C4,0xDCA8,0xD446,0xD447,0xD447,0xD447,0xD447,0xD488,0xD488,0xD488,0xD488,0xD488,0xD488,0xD488,0xD488,0xD488,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC87,0x7C06,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xD467,0xD446,0xD447,0xD447,0xD447,0xDC67,0xA447,0x2BA3,0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,0x0B41,0xC488,0xD446,0xD447,0xD447,0xD447,0xD467,0xB467,0x3BC4,0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,0x1382,0x4BE5,0xCC67,0xD447,0xD447,0xD447,0xD447,0xDC67,0x9467,0x43E5,0xD467,0xD447,0xD447,0xD447,0xD446,0xC488,0x1B83,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x6BE4,0xDC87,0xD447,0xD447,0xD447,0xDC67,0x9C88,0x0B61,0x0B61,0x0B61,0x0B61,0x0B61,0x0B61,0x0B61,0x0B61,0x0B61,0x0B61,0x0B61,0x0B61,0x0B61,0x0340,0xAC88,0xDC67,0xD447,0xD447,0xD447,0xD447,0xCC67,0x4BE4,0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,0x1382,0x0320,0x6C05,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD467,0x6C06,0x1B82,0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,0x33A3,0xA447,0xDC67,0xD447,0xD447,0xD447,0xD446,0xD467,0x0320,0x0320,0x0320,0x8C26,0xDC67,0xD447,0xD447,0xD447,0xD447,0xC467,0x1B62,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x43C4,0xD467,0xD446,0xD447,0xD447,0xDC67,0xAC47,0x0B41,0x0320,0x0320,0x0340,0xAC47,0xDC67,0xD447,0xD447,0xD447,0xD467,0x43E5,0x53E5,0xDC88,0xD446,0xD446,0xD467,0x7426,0x33C4,0x33C4,0x33C4,0x33C4,0x33C4,0x33C4,0x33C4,0x33C4,0x33C4,0x33C4,0x33C4,0x33C4,0x3BC4,0x3BC4,0x3BC4,0x0B40,0x2BA3,0xD447,0xD447,0xD447,0xD447,0xD447,0xBC47,0x2BE5,0xBC67,0xD446,0xD447,0xD447,0xD447,0xD467,0xC467,0x53E4,0x3BC4,0x3BC4,0x3BC4,0x3BC4,0x3BC4,0x3BC4,0x3BC4,0x3BC4,0x7426,0xD467,0xD447,0xD447,0xD447,0xD447,0xDC87,0x8406,0x43C4,0xDCA8,0xD446,0xD447,0xD447,0xD447,0xC488,0x3BE4,0x3BC4,0x3BC4,0x3BC4,0x3BC4,0x3BC4,0x3BC4,0x3BC4,0x3BC4,0x6C05,0xD467,0xD447,0xD447,0xD447,0xD447,0xDC66,0x9447,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xD467,0xD446,0xD447,0xD447,0xD446,0xD488,0x3BC4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0B40,0xC488,0xD446,0xD447,0xD447,0xD446,0xDC87,0x53E4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x7C26,0xDC67,0xD447,0xD447,0xD447,0xDC67,0x8C47,0x43E5,0xD467,0xD447,0xD447,0xD447,0xD446,0xC488,0x1B83,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x6BE4,0xDC87,0xD447,0xD447,0xD447,0xD446,0xCC68,0xBC88,0xBC88,0xBC88,0xBC88,0xBC88,0xBC88,0xBC88,0xBC88,0xBC88,0xBC88,0xBC88,0xC488,0xBC88,0x2BC4,0xA468,0xDC67,0xD447,0xD447,0xD447,0xDC67,0x7405,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x7405,0xDC67,0xD447,0xD447,0xD447,0xDC67,0xA468,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x3BC4,0xD488,0xD446,0xD447,0xD447,0xD446,0xD467,0x0320,0x0320,0x0320,0x2382,0xCC67,0xD447,0xD447,0xD447,0xD447,0xDC67,0x8426,0x0320,0x0320,0x0320,0x0320,0x0320,0x1341,0xB467,0xDC67,0xD447,0xD447,0xD447,0xD467,0x43C4,0x0320,0x0320,0x0320,0x0340,0xAC47,0xDC67,0xD447,0xD447,0xD447,0xD467,0x43E5,0x43E4,0xD488,0xD446,0xD447,0xD467,0x7426,0x2B62,0x3382,0x3382,0x3382,0x2B82,0x2361,0x2361,0x2361,0x2361,0x2361,0x2361,0x1B62,0x0320,0x0320,0x0320,0x0320,0x33A3,0xD447,0xD447,0xD447,0xD447,0xD447,0xBC47,0x2BE5,0xBC67,0xD446,0xD447,0xD447,0xD447,0xDC67,0x5C05,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x9C47,0xDC67,0xD447,0xD447,0xD447,0xDC87,0x8406,0x43C4,0xDCA8,0xD446,0xD447,0xD447,0xD467,0xBC68,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x8C47,0xDC67,0xD447,0xD447,0xD447,0xDC67,0x8C47,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xD467,0xD446,0xD447,0xD447,0xD446,0xD488,0x33C4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0B40,0xC488,0xD446,0xD447,0xD447,0xD446,0xDC88,0x4BC4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x63E5,0xDC67,0xD447,0xD447,0xD447,0xDC67,0x8C47,0x43E5,0xD467,0xD447,0xD447,0xD447,0xD446,0xC488,0x1B83,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x6BE4,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD447,0x33C4,0xA468,0xDC67,0xD447,0xD447,0xD447,0xDC87,0x5BC4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x7405,0xDC67,0xD447,0xD447,0xD447,0xDC67,0x9C88,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x33C4,0xD488,0xD446,0xD447,0xD447,0xD446,0xD467,0x0320,0x0320,0x0320,0x0320,0x6C05,0xDC87,0xD447,0xD447,0xD447,0xD446,0xD487,0x33A3,0x0320,0x0320,0x0320,0x0320,0x7C26,0xDC87,0xD447,0xD447,0xD447,0xDC67,0x9446,0x0320,0x0320,0x0320,0x0320,0x0340,0xAC47,0xDC67,0xD447,0xD447,0xD447,0xD467,0x4BE5,0x1341,0xC467,0xD467,0xD447,0xD447,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC88,0xDC88,0xDC88,0xDC88,0xDC88,0xDC88,0xCC88,0x8C47,0x2382,0x0320,0x0320,0x33A3,0xD447,0xD447,0xD447,0xD447,0xD447,0xBC47,0x2BE5,0xBC67,0xD446,0xD447,0xD447,0xD447,0xD447,0x33A3,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x8C47,0xDC67,0xD447,0xD447,0xD447,0xDC87,0x8406,0x43C4,0xDCA8,0xD446,0xD447,0xD447,0xD467,0xBC68,0x0B20,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x6C26,0xDC67,0xD447,0xD447,0xD447,0xDC67,0x8C47,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xD467,0xD446,0xD447,0xD447,0xD446,0xD488,0x33C4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0B40,0xC488,0xD446,0xD447,0xD447,0xD446,0xDC88,0x4BC4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x6BE5,0xDC67,0xD447,0xD447,0xD447,0xDC67,0x8C47,0x43E5,0xD467,0xD447,0xD447,0xD447,0xD446,0xC488,0x1B83,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x6BE4,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0x33C4,0xA468,0xDC67,0xD447,0xD447,0xD447,0xDC87,0x5BC4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x7405,0xDC67,0xD447,0xD447,0xD447,0xDC67,0xA488,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x33C4,0xD488,0xD446,0xD447,0xD447,0xD446,0xD467,0x0320,0x0320,0x0320,0x0320,0x1341,0xB467,0xDC67,0xD447,0xD447,0xD447,0xDC67,0x9C47,0x0320,0x0320,0x0320,0x43C4,0xD487,0xD446,0xD447,0xD447,0xD446,0xCC67,0x2382,0x0320,0x0320,0x0320,0x0320,0x0340,0xAC47,0xDC67,0xD447,0xD447,0xD447,0xD467,0x4C05,0x0320,0x7C26,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xDC87,0xC467,0x2B82,0x0320,0x33A3,0xD447,0xD447,0xD447,0xD447,0xD447,0xBC47,0x2BE5,0xBC67,0xD446,0xD447,0xD447,0xD447,0xD447,0x33A3,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x9447,0xDC67,0xD447,0xD447,0xD447,0xDC87,0x8406,0x43C4,0xDCA8,0xD446,0xD447,0xD447,0xD467,0xBC68,0x0B20,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x7426,0xDC67,0xD447,0xD447,0xD447,0xDC67,0x8C47,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xD467,0xD446,0xD447,0xD447,0xD446,0xD488,0x33C4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0B40,0xC488,0xD446,0xD447,0xD447,0xD446,0xDC88,0x4BC4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x6BE5,0xDC67,0xD447,0xD447,0xD447,0xDC67,0x8C47,0x43E5,0xD467,0xD447,0xD447,0xD447,0xD446,0xC488,0x1B83,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x6BE4,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0x33C4,0xA468,0xDC67,0xD447,0xD447,0xD447,0xDC87,0x5BC4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x7405,0xDC67,0xD447,0xD447,0xD447,0xDC67,0xA488,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x33C4,0xD488,0xD446,0xD447,0xD447,0xD446,0xD467,0x0320,0x0320,0x0320,0x0320,0x0320,0x43C4,0xDC67,0xD446,0xD447,0xD447,0xD446,0xDC87,0x4BC4,0x0320,0x1341,0xB467,0xDC67,0xD447,0xD447,0xD447,0xDC87,0x6C05,0x0320,0x0320,0x0320,0x0320,0x0320,0x0340,0xAC47,0xDC67,0xD447,0xD447,0xD447,0xD467,0x4C05,0x0320,0x1361,0xAC68,0xDC87,0xD446,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC67,0xB467,0x0B41,0x2BA3,0xD447,0xD447,0xD447,0xD447,0xD447,0xBC47,0x2BE5,0xBC67,0xD446,0xD447,0xD447,0xD447,0xD447,0x33A3,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x9447,0xDC67,0xD447,0xD447,0xD447,0xDC87,0x8406,0x43C4,0xDCA8,0xD446,0xD447,0xD447,0xD467,0xBC68,0x0B20,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x7426,0xDC67,0xD447,0xD447,0xD447,0xDC67,0x8C47,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xD467,0xD446,0xD447,0xD447,0xD446,0xD488,0x33C4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0B40,0xC488,0xD446,0xD447,0xD447,0xD446,0xDC88,0x4BC4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x63E5,0xDC67,0xD447,0xD447,0xD447,0xDC67,0x8C47,0x43E5,0xD467,0xD447,0xD447,0xD447,0xD446,0xC468,0x1B83,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x6BE4,0xDC87,0xD447,0xD447,0xD447,0xD447,0xC488,0x9447,0x9447,0x9447,0x9447,0x9447,0x9447,0x9447,0x9447,0x9447,0x9447,0x9447,0x8C47,0x8C47,0x2383,0xA468,0xDC67,0xD447,0xD447,0xD447,0xDC87,0x5BC4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x7405,0xDC67,0xD447,0xD447,0xD447,0xDC67,0x9C88,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x33C4,0xD488,0xD446,0xD447,0xD447,0xD446,0xD467,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x9C26,0xDC67,0xD447,0xD447,0xD447,0xDC67,0xB467,0x0B41,0x7C26,0xDC87,0xD447,0xD447,0xD447,0xDC67,0xB467,0x0B41,0x0320,0x0320,0x0320,0x0320,0x0320,0x0340,0xAC47,0xDC67,0xD447,0xD447,0xD447,0xD467,0x4C05,0x0320,0x0320,0x1361,0x8446,0xCC88,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xD447,0xD447,0xD446,0xDC87,0x53C4,0x2BA3,0xD447,0xD447,0xD447,0xD447,0xD447,0xBC47,0x2BE5,0xBC67,0xD446,0xD447,0xD447,0xD447,0xD447,0x33A3,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x8C47,0xDC67,0xD447,0xD447,0xD447,0xDC87,0x8406,0x43C4,0xDCA8,0xD446,0xD447,0xD447,0xD467,0xBC68,0x0B20,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x7426,0xDC67,0xD447,0xD447,0xD447,0xDC67,0x8C47,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xD467,0xD446,0xD447,0xD447,0xD446,0xD488,0x43C4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0B40,0xC488,0xD446,0xD447,0xD447,0xD447,0xDC87,0x63E5,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x8C26,0xDC67,0xD447,0xD447,0xD447,0xDC67,0x8C47,0x43E5,0xD467,0xD447,0xD447,0xD447,0xD446,0xCC88,0x2BA3,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x6BE4,0xDC87,0xD447,0xD447,0xD447,0xDC67,0xAC68,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xA488,0xDC67,0xD447,0xD447,0xD447,0xDC67,0x8426,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x7405,0xDC67,0xD447,0xD447,0xD447,0xDC67,0xAC68,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x43C4,0xDC88,0xD446,0xD447,0xD447,0xD446,0xD467,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x2B82,0xCC67,0xD447,0xD447,0xD447,0xD447,0xD447,0x9467,0xCC67,0xD446,0xD447,0xD447,0xD447,0xD467,0x4BC4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0340,0xAC47,0xDC67,0xD447,0xD447,0xD447,0xD467,0x4C05,0x0320,0x0320,0x0320,0x0320,0x1B62,0x3BC3,0x53E5,0x4BE5,0x4BE5,0x4BE5,0x4BE5,0x4BE5,0x4BE5,0x4BE5,0x4BE5,0x4BE5,0x9C46,0xDC67,0xD447,0xD447,0xDC67,0x8406,0x2BC4,0xD447,0xD447,0xD447,0xD447,0xD447,0xBC47,0x2BE5,0xBC67,0xD446,0xD447,0xD447,0xD447,0xDC67,0x5405,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x9447,0xDC67,0xD447,0xD447,0xD447,0xDC87,0x8406,0x43C4,0xDCA8,0xD446,0xD447,0xD447,0xD467,0xBC68,0x0B20,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x7426,0xDC67,0xD447,0xD447,0xD447,0xDC67,0x8C47,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xD467,0xD446,0xD447,0xD447,0xD447,0xDC67,0xB447,0x4BC4,0x3BC4,0x3BC4,0x3BC4,0x3BC4,0x3BC4,0x3BC4,0x3BC4,0x3BC4,0x3BC4,0x3BC4,0x33C4,0x1341,0xC488,0xD446,0xD447,0xD447,0xD447,0xD446,0xC467,0x5BE5,0x3BC4,0x3BC4,0x3BC4,0x3BC4,0x3BC4,0x3BC4,0x3BC4,0x3BC4,0x6C05,0xD468,0xD446,0xD447,0xD447,0xD447,0xDC67,0x9467,0x33C4,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC67,0xA447,0x43C4,0x3BC4,0x3BC4,0x3BC4,0x3BC4,0x3BC4,0x3BC4,0x2BA3,0x6BE5,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD467,0x8426,0x3BC4,0x3BC4,0x3BC4,0x3BC4,0x3BC4,0x3BC4,0x3BC4,0x3BC4,0x3BC4,0x3BC4,0x3BC4,0x3BC4,0x0B61,0xA488,0xDC66,0xD447,0xD447,0xD447,0xD446,0xD468,0x6C05,0x3BC4,0x3BC4,0x3BC4,0x3BC4,0x3BC4,0x3BC4,0x3BC4,0x3BC4,0x3BC4,0x3BC4,0x3BC4,0x1361,0x6BE5,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD467,0x7C06,0x3BC4,0x3BC4,0x3BC4,0x3BC4,0x3BC4,0x3BC4,0x3BC4,0x3BC4,0x4BE4,0xB447,0xDC67,0xD447,0xD447,0xD447,0xD446,0xD468,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x7406,0xDC67,0xD447,0xD447,0xD447,0xD447,0xDC67,0xD447,0xD447,0xD447,0xD447,0xDC67,0x9C46,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0340,0xAC47,0xDC67,0xD447,0xD447,0xD447,0xD467,0x4C05,0x0320,0x1362,0x1362,0x1362,0x0B61,0x0B41,0x0B41,0x0B41,0x0B41,0x0B41,0x0B41,0x0B41,0x0B41,0x0B41,0x0B41,0x0B41,0x7405,0xDC87,0xD447,0xD447,0xDC66,0x9C68,0x33E4,0xCC47,0xD447,0xD447,0xD447,0xD447,0xBC47,0x33E5,0xBC67,0xD446,0xD447,0xD447,0xD447,0xDC67,0xBC68,0x3BC4,0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,0x1B82,0x5BE5,0xCC67,0xD447,0xD447,0xD447,0xD447,0xDC87,0x8406,0x43C4,0xDCA8,0xD446,0xD447,0xD447,0xD467,0xBC68,0x0B20,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x7426,0xDC67,0xD447,0xD447,0xD447,0xDC67,0x8C47,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xD488,0xD446,0xD447,0xD447,0xD447,0xD447,0xDC67,0xDC88,0xD488,0xD488,0xD488,0xD488,0xD488,0xD488,0xD488,0xD488,0xD488,0xD488,0xC489,0x1B62,0xA468,0xDC66,0xD447,0xD447,0xD447,0xD447,0xD446,0xDC87,0xD488,0xD488,0xD488,0xD488,0xD488,0xD488,0xD488,0xD488,0xDC87,0xD446,0xD447,0xD447,0xD447,0xD447,0xDC87,0x7C06,0x1B62,0xD467,0xD446,0xD447,0xD447,0xD447,0xD447,0xDC67,0xDC88,0xD488,0xD488,0xD488,0xD488,0xD488,0xD488,0xBC88,0x6C26,0xDC87,0xD446,0xD447,0xD447,0xD447,0xD447,0xDC67,0xD488,0xD488,0xD488,0xD488,0xD488,0xD488,0xD488,0xD488,0xD488,0xD488,0xD488,0xD488,0x2BC4,0x8426,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD446,0xDC87,0xD488,0xD488,0xD488,0xD488,0xD488,0xD488,0xD488,0xD488,0xD488,0xD488,0xDCA9,0x5C26,0x53C4,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC67,0xD488,0xD488,0xD488,0xD488,0xD488,0xD488,0xD488,0xD488,0xDC88,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD446,0xD4A9,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1361,0xBC67,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xCC68,0x2B82,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0340,0xAC47,0xDC67,0xD447,0xD447,0xD447,0xD467,0x4BE5,0x0B61,0xB447,0xBC67,0xBC47,0xBC47,0xBC47,0xBC47,0xBC47,0xBC47,0xBC47,0xBC47,0xBC47,0xBC47,0xBC47,0xBC47,0xBC47,0xD467,0xD447,0xD447,0xD447,0xDC67,0x7C05,0x2BC4,0xD447,0xD447,0xD447,0xD447,0xD447,0xBC67,0x1BA3,0xAC26,0xDC67,0xD447,0xD447,0xD447,0xD447,0xDC67,0xD468,0xBC47,0xBC47,0xBC47,0xBC47,0xBC47,0xBC47,0xBC47,0xBC47,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC87,0x7C26,0x43C4,0xDCA8,0xD446,0xD447,0xD447,0xD467,0xBC68,0x0B20,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x7426,0xDC67,0xD447,0xD447,0xD447,0xDC67,0x8C47,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x9447,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xCC88,0x0B41,0x63E4,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xD487,0x3BA3,0x0320,0xA447,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xCC88,0x2BA3,0xC467,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD447,0x2383,0x43C3,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xDC67,0x5C06,0x1B82,0xCC67,0xD446,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC67,0x8C47,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x53E4,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC87,0x7406,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0340,0xAC47,0xDC67,0xD447,0xD447,0xD447,0xD467,0x4BE5,0x1361,0xCC47,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xD446,0xD447,0xD447,0xD446,0xDC87,0x4BC4,0x2BA3,0xD447,0xD447,0xD447,0xD447,0xD447,0xBC67,0x1362,0x7C26,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xD467,0xD446,0xD447,0xD447,0xD447,0xD447,0xD446,0xD467,0x33A3,0x4BC4,0xDCA8,0xD446,0xD447,0xD447,0xD467,0xBC68,0x0B20,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x7426,0xDC67,0xD447,0xD447,0xD447,0xDC67,0x8C47,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x2B82,0xCC88,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xCC88,0x1341,0x0B41,0xAC47,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xDC87,0x9426,0x0320,0x0320,0x3BA3,0xD488,0xD446,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xCC88,0x0B41,0x6C05,0xDC87,0xD446,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0x2BA3,0x0320,0x9C47,0xDC87,0xD446,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC67,0x6426,0x0320,0x7426,0xDC87,0xD446,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC67,0xC488,0x2382,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xA447,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC67,0xBC67,0x1341,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0340,0xAC47,0xDC67,0xD447,0xD447,0xD447,0xD467,0x4BE5,0x1361,0xC447,0xD467,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC67,0xA447,0x0B40,0x2BA3,0xD447,0xD447,0xD447,0xD447,0xD447,0xBC67,0x1382,0x1B61,0xC467,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xDC87,0x9447,0x0320,0x4BC4,0xDCA8,0xD446,0xD447,0xD447,0xD467,0xBC68,0x0B20,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x7426,0xDC67,0xD447,0xD447,0xD447,0xDC67,0x8C47,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x43C4,0xC488,0xDC87,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xCC88,0x1341,0x0320,0x2B82,0xB467,0xDC87,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xDC66,0xDC88,0x9C47,0x1341,0x0320,0x0320,0x0320,0x53E4,0xCC88,0xDC67,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xCC88,0x1341,0x0340,0x8447,0xDC67,0xDC67,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD447,0x2BA3,0x0320,0x1341,0xA447,0xDC87,0xDC66,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xDC67,0x6426,0x0320,0x0B40,0x8C47,0xDC87,0xDC66,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xDC87,0xC488,0x43C4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x3383,0xD467,0xD446,0xD446,0xD446,0xD446,0xD446,0xDC87,0x53E4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0340,0xAC46,0xDC66,0xD446,0xD446,0xD446,0xD467,0x4BE5,0x1361,0xC446,0xD466,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xDC87,0xB467,0x2362,0x0320,0x33A3,0xD447,0xD446,0xD446,0xD446,0xD446,0xBC67,0x1B82,0x0320,0x3BA3,0xC467,0xDC67,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xDC87,0xAC68,0x1B62,0x0320,0x4BC4,0xDCA8,0xD446,0xD446,0xD446,0xD466,0xBC68,0x0B20,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x7426,0xDC67,0xD446,0xD446,0xD446,0xDC66,0x8C47,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x2382,0x7C26,0xC4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xC4A9,0x1341,0x0320,0x0320,0x1361,0x6C06,0xBCA9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xAC88,0x5BE5,0x0340,0x0320,0x0320,0x0320,0x0320,0x0320,0x2BA3,0x8447,0xC4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xC4A9,0x1341,0x0320,0x0320,0x43C4,0x9C68,0xCCA9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0x2BA3,0x0320,0x0320,0x0B41,0x5BE5,0xAC89,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xDCC9,0x5C26,0x0320,0x0320,0x0320,0x4BE4,0xA468,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xC4A9,0x7C26,0x2382,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x7C26,0xDC88,0xD468,0xD468,0xD468,0xDC88,0xA447,0x0340,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0340,0xAC67,0xDC88,0xD468,0xD468,0xD468,0xDC88,0x4BE5,0x1361,0xC467,0xDC88,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xCCA9,0x7C26,0x1361,0x0320,0x0320,0x33C4,0xD468,0xD468,0xD468,0xD468,0xDC88,0xBC88,0x1B82,0x0320,0x0320,0x2B82,0x9467,0xD489,0xD467,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xD467,0xC4A9,0x7426,0x1361,0x0320,0x0320,0x4BC4,0xDCA9,0xD467,0xD468,0xD468,0xDC88,0xBC88,0x0B20,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x7426,0xDC88,0xD468,0xD468,0xD468,0xDC88,0x9467,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
+    0x40, 0x01, 0x20, 0x00, 0x8b, 0x00, 0x20, 0x03, 0x40, 0x03, 0x20, 0x0b, 0x40, 0x0b, 0x41, 0x0b,
+    0x61, 0x0b, 0x41, 0x13, 0x61, 0x13, 0x62, 0x13, 0x82, 0x13, 0x61, 0x1b, 0x62, 0x1b, 0x82, 0x1b,
+    0x83, 0x1b, 0xa3, 0x1b, 0x61, 0x23, 0x62, 0x23, 0x82, 0x23, 0x83, 0x23, 0x62, 0x2b, 0x82, 0x2b,
+    0x83, 0x2b, 0xa3, 0x2b, 0xc4, 0x2b, 0xe5, 0x2b, 0x82, 0x33, 0x83, 0x33, 0xa3, 0x33, 0xc4, 0x33,
+    0xe4, 0x33, 0xe5, 0x33, 0xa3, 0x3b, 0xc3, 0x3b, 0xc4, 0x3b, 0xe4, 0x3b, 0xe5, 0x3b, 0xc3, 0x43,
+    0xc4, 0x43, 0xe4, 0x43, 0xe5, 0x43, 0xc4, 0x4b, 0xe4, 0x4b, 0xe5, 0x4b, 0x05, 0x4c, 0xc3, 0x53,
+    0xc4, 0x53, 0xe4, 0x53, 0xe5, 0x53, 0x05, 0x54, 0xc4, 0x5b, 0xe4, 0x5b, 0xe5, 0x5b, 0x05, 0x5c,
+    0x06, 0x5c, 0x26, 0x5c, 0xe4, 0x63, 0xe5, 0x63, 0x05, 0x64, 0x26, 0x64, 0xe4, 0x6b, 0xe5, 0x6b,
+    0x05, 0x6c, 0x06, 0x6c, 0x26, 0x6c, 0x05, 0x74, 0x06, 0x74, 0x26, 0x74, 0x05, 0x7c, 0x06, 0x7c,
+    0x26, 0x7c, 0x47, 0x7c, 0x06, 0x84, 0x26, 0x84, 0x46, 0x84, 0x47, 0x84, 0x26, 0x8c, 0x47, 0x8c,
+    0x26, 0x94, 0x46, 0x94, 0x47, 0x94, 0x67, 0x94, 0x26, 0x9c, 0x46, 0x9c, 0x47, 0x9c, 0x68, 0x9c,
+    0x88, 0x9c, 0x26, 0xa4, 0x47, 0xa4, 0x67, 0xa4, 0x68, 0xa4, 0x88, 0xa4, 0x26, 0xac, 0x46, 0xac,
+    0x47, 0xac, 0x67, 0xac, 0x68, 0xac, 0x88, 0xac, 0x89, 0xac, 0x47, 0xb4, 0x67, 0xb4, 0x68, 0xb4,
+    0x88, 0xb4, 0x47, 0xbc, 0x67, 0xbc, 0x68, 0xbc, 0x88, 0xbc, 0xa9, 0xbc, 0x46, 0xc4, 0x47, 0xc4,
+    0x67, 0xc4, 0x68, 0xc4, 0x88, 0xc4, 0x89, 0xc4, 0xa9, 0xc4, 0x47, 0xcc, 0x67, 0xcc, 0x68, 0xcc,
+    0x88, 0xcc, 0x89, 0xcc, 0xa9, 0xcc, 0x46, 0xd4, 0x47, 0xd4, 0x66, 0xd4, 0x67, 0xd4, 0x68, 0xd4,
+    0x87, 0xd4, 0x88, 0xd4, 0x89, 0xd4, 0xa9, 0xd4, 0xc9, 0xd4, 0x46, 0xdc, 0x66, 0xdc, 0x67, 0xdc,
+    0x87, 0xdc, 0x88, 0xdc, 0xa8, 0xdc, 0xa9, 0xdc, 0xc9, 0xdc, 0xca, 0xdc, 0xff, 0x00, 0xff, 0x00,
+    0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xcd, 0x00, 0x00, 0x1f,
+    0x00, 0x5a, 0x00, 0x7e, 0x0c, 0x7b, 0x00, 0x76, 0x00, 0x06, 0x01, 0x00, 0x00, 0x16, 0x00, 0x4f,
+    0x00, 0x80, 0x0d, 0x7b, 0x00, 0x77, 0x00, 0x4a, 0x00, 0x0b, 0x01, 0x00, 0x00, 0x26, 0x00, 0x7c,
+    0x03, 0x7b, 0x00, 0x6f, 0x00, 0x0d, 0x07, 0x00, 0x00, 0x3b, 0x00, 0x86, 0x11, 0x7b, 0x00, 0x16,
+    0x01, 0x00, 0x00, 0x0c, 0x00, 0x4a, 0x00, 0x77, 0x0c, 0x7b, 0x00, 0x86, 0x00, 0x3a, 0x01, 0x00,
+    0x00, 0x04, 0x00, 0x3e, 0x00, 0x71, 0x0d, 0x7b, 0x00, 0x7e, 0x00, 0x59, 0x00, 0x1f, 0x01, 0x00,
+    0x00, 0x46, 0x00, 0x88, 0x03, 0x80, 0x00, 0x77, 0x00, 0x1b, 0x0b, 0x00, 0x00, 0x06, 0x00, 0x65,
+    0x02, 0x80, 0x00, 0x89, 0x00, 0x59, 0x00, 0x04, 0x00, 0x60, 0x00, 0x88, 0x02, 0x80, 0x00, 0x81,
+    0x00, 0x2b, 0x02, 0x00, 0x00, 0x1f, 0x00, 0x50, 0x00, 0x77, 0x0d, 0x80, 0x00, 0x77, 0x01, 0x16,
+    0x04, 0x80, 0x00, 0x6a, 0x00, 0x0c, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x42, 0x00, 0x6a, 0x0d, 0x80,
+    0x00, 0x60, 0x00, 0x2e, 0x02, 0x00, 0x00, 0x28, 0x00, 0x8a, 0x10, 0x80, 0x00, 0x60, 0x00, 0x33,
+    0x00, 0x03, 0x54, 0x00, 0x00, 0x32, 0x00, 0x7e, 0x00, 0x84, 0x0d, 0x78, 0x00, 0x75, 0x00, 0x06,
+    0x00, 0x00, 0x00, 0x25, 0x00, 0x75, 0x00, 0x84, 0x0f, 0x78, 0x00, 0x85, 0x00, 0x63, 0x00, 0x11,
+    0x00, 0x00, 0x00, 0x26, 0x00, 0x7b, 0x03, 0x78, 0x00, 0x6f, 0x00, 0x0d, 0x07, 0x00, 0x00, 0x3b,
+    0x00, 0x85, 0x10, 0x78, 0x00, 0x79, 0x00, 0x16, 0x00, 0x00, 0x00, 0x16, 0x00, 0x67, 0x00, 0x85,
+    0x0d, 0x78, 0x00, 0x84, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x57, 0x00, 0x85, 0x0f, 0x78,
+    0x00, 0x84, 0x00, 0x7e, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x6d, 0x00, 0x82, 0x02, 0x78,
+    0x00, 0x84, 0x00, 0x53, 0x0b, 0x00, 0x00, 0x45, 0x00, 0x85, 0x02, 0x78, 0x00, 0x7b, 0x00, 0x1f,
+    0x00, 0x00, 0x00, 0x5d, 0x00, 0x83, 0x02, 0x78, 0x00, 0x7b, 0x00, 0x30, 0x01, 0x00, 0x00, 0x39,
+    0x00, 0x7d, 0x00, 0x84, 0x0e, 0x78, 0x00, 0x79, 0x01, 0x16, 0x00, 0x79, 0x03, 0x78, 0x00, 0x6d,
+    0x00, 0x0c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x69, 0x00, 0x85, 0x0e, 0x78, 0x00, 0x83, 0x00, 0x85,
+    0x00, 0x53, 0x00, 0x07, 0x00, 0x00, 0x00, 0x28, 0x00, 0x86, 0x10, 0x78, 0x00, 0x83, 0x00, 0x85,
+    0x00, 0x53, 0x00, 0x06, 0x52, 0x00, 0x00, 0x1f, 0x00, 0x7e, 0x00, 0x7a, 0x0d, 0x79, 0x00, 0x78,
+    0x00, 0x75, 0x00, 0x06, 0x00, 0x0b, 0x00, 0x6e, 0x00, 0x84, 0x11, 0x79, 0x00, 0x84, 0x00, 0x57,
+    0x00, 0x00, 0x00, 0x21, 0x00, 0x7b, 0x02, 0x79, 0x00, 0x78, 0x00, 0x6f, 0x00, 0x0d, 0x07, 0x00,
+    0x00, 0x3b, 0x00, 0x85, 0x11, 0x79, 0x00, 0x16, 0x00, 0x03, 0x00, 0x5d, 0x00, 0x84, 0x0e, 0x79,
+    0x00, 0x84, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x85, 0x11, 0x79, 0x00, 0x78, 0x00, 0x7e,
+    0x00, 0x1b, 0x00, 0x00, 0x00, 0x38, 0x00, 0x85, 0x03, 0x79, 0x00, 0x85, 0x00, 0x28, 0x09, 0x00,
+    0x00, 0x1f, 0x00, 0x7b, 0x02, 0x79, 0x00, 0x85, 0x00, 0x48, 0x00, 0x00, 0x00, 0x01, 0x00, 0x5d,
+    0x00, 0x84, 0x02, 0x79, 0x00, 0x7b, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x28, 0x00, 0x7b, 0x10, 0x79,
+    0x00, 0x73, 0x01, 0x16, 0x04, 0x79, 0x00, 0x67, 0x00, 0x09, 0x00, 0x07, 0x00, 0x68, 0x00, 0x84,
+    0x11, 0x79, 0x00, 0x85, 0x00, 0x48, 0x00, 0x00, 0x00, 0x28, 0x00, 0x87, 0x00, 0x78, 0x10, 0x79,
+    0x00, 0x78, 0x00, 0x85, 0x00, 0x4f, 0x52, 0x00, 0x00, 0x58, 0x00, 0x84, 0x04, 0x79, 0x00, 0x78,
+    0x08, 0x84, 0x00, 0x83, 0x00, 0x75, 0x00, 0x04, 0x00, 0x40, 0x00, 0x85, 0x04, 0x79, 0x00, 0x78,
+    0x07, 0x84, 0x00, 0x78, 0x03, 0x79, 0x00, 0x78, 0x00, 0x85, 0x00, 0x25, 0x00, 0x21, 0x00, 0x7b,
+    0x02, 0x79, 0x00, 0x78, 0x00, 0x6f, 0x00, 0x0d, 0x07, 0x00, 0x00, 0x3b, 0x00, 0x85, 0x04, 0x79,
+    0x0c, 0x85, 0x00, 0x16, 0x00, 0x28, 0x00, 0x85, 0x04, 0x79, 0x00, 0x78, 0x09, 0x84, 0x00, 0x85,
+    0x00, 0x35, 0x00, 0x15, 0x00, 0x7b, 0x00, 0x78, 0x03, 0x79, 0x00, 0x78, 0x00, 0x7b, 0x06, 0x84,
+    0x00, 0x78, 0x04, 0x79, 0x00, 0x84, 0x00, 0x53, 0x00, 0x00, 0x00, 0x03, 0x00, 0x5e, 0x00, 0x84,
+    0x02, 0x79, 0x00, 0x84, 0x00, 0x63, 0x00, 0x04, 0x07, 0x00, 0x00, 0x06, 0x00, 0x5d, 0x00, 0x84,
+    0x01, 0x79, 0x00, 0x7b, 0x00, 0x6d, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x5d, 0x00, 0x84,
+    0x02, 0x79, 0x00, 0x7b, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x63, 0x00, 0x84, 0x01, 0x79, 0x0e, 0x78,
+    0x00, 0x79, 0x01, 0x16, 0x04, 0x79, 0x00, 0x67, 0x00, 0x08, 0x00, 0x3d, 0x00, 0x85, 0x04, 0x79,
+    0x08, 0x78, 0x04, 0x79, 0x00, 0x78, 0x00, 0x7b, 0x00, 0x14, 0x00, 0x28, 0x00, 0x87, 0x00, 0x78,
+    0x03, 0x79, 0x08, 0x78, 0x04, 0x79, 0x00, 0x78, 0x00, 0x7b, 0x00, 0x25, 0x51, 0x00, 0x00, 0x7e,
+    0x00, 0x78, 0x03, 0x79, 0x00, 0x84, 0x00, 0x74, 0x09, 0x66, 0x00, 0x64, 0x00, 0x0b, 0x00, 0x60,
+    0x00, 0x82, 0x03, 0x79, 0x00, 0x84, 0x00, 0x7b, 0x07, 0x66, 0x00, 0x7b, 0x00, 0x78, 0x03, 0x79,
+    0x00, 0x84, 0x00, 0x45, 0x00, 0x23, 0x00, 0x7b, 0x02, 0x79, 0x00, 0x78, 0x00, 0x6f, 0x00, 0x0d,
+    0x07, 0x00, 0x00, 0x3b, 0x00, 0x85, 0x02, 0x79, 0x00, 0x7b, 0x00, 0x64, 0x0c, 0x2c, 0x00, 0x07,
+    0x00, 0x4c, 0x00, 0x84, 0x03, 0x79, 0x00, 0x78, 0x00, 0x7b, 0x09, 0x66, 0x00, 0x6d, 0x00, 0x30,
+    0x00, 0x31, 0x00, 0x85, 0x03, 0x79, 0x00, 0x78, 0x00, 0x85, 0x00, 0x6d, 0x06, 0x66, 0x00, 0x74,
+    0x00, 0x84, 0x03, 0x79, 0x00, 0x78, 0x00, 0x80, 0x01, 0x00, 0x00, 0x1f, 0x00, 0x7b, 0x03, 0x79,
+    0x00, 0x85, 0x00, 0x38, 0x07, 0x00, 0x00, 0x45, 0x00, 0x85, 0x02, 0x79, 0x00, 0x85, 0x00, 0x38,
+    0x01, 0x00, 0x00, 0x01, 0x00, 0x5d, 0x00, 0x84, 0x02, 0x79, 0x00, 0x7b, 0x00, 0x2a, 0x00, 0x1b,
+    0x00, 0x7b, 0x00, 0x78, 0x00, 0x79, 0x00, 0x78, 0x00, 0x84, 0x0e, 0x7e, 0x01, 0x16, 0x04, 0x79,
+    0x00, 0x67, 0x00, 0x0e, 0x00, 0x56, 0x00, 0x84, 0x04, 0x79, 0x00, 0x86, 0x07, 0x7e, 0x00, 0x84,
+    0x00, 0x78, 0x03, 0x79, 0x00, 0x85, 0x00, 0x42, 0x00, 0x25, 0x00, 0x87, 0x00, 0x78, 0x03, 0x79,
+    0x08, 0x7e, 0x00, 0x85, 0x04, 0x79, 0x00, 0x85, 0x00, 0x44, 0x51, 0x00, 0x00, 0x7b, 0x00, 0x78,
+    0x02, 0x79, 0x00, 0x84, 0x00, 0x57, 0x00, 0x16, 0x0a, 0x08, 0x00, 0x04, 0x00, 0x6f, 0x00, 0x78,
+    0x02, 0x79, 0x00, 0x7b, 0x00, 0x63, 0x00, 0x21, 0x06, 0x08, 0x00, 0x09, 0x00, 0x2a, 0x00, 0x73,
+    0x03, 0x79, 0x00, 0x84, 0x00, 0x50, 0x00, 0x27, 0x00, 0x7b, 0x02, 0x79, 0x00, 0x78, 0x00, 0x6f,
+    0x00, 0x0d, 0x07, 0x00, 0x00, 0x3b, 0x00, 0x85, 0x02, 0x79, 0x00, 0x84, 0x00, 0x55, 0x0c, 0x05,
+    0x00, 0x01, 0x00, 0x60, 0x00, 0x84, 0x03, 0x79, 0x00, 0x73, 0x00, 0x29, 0x09, 0x08, 0x00, 0x09,
+    0x00, 0x00, 0x00, 0x3d, 0x00, 0x84, 0x03, 0x79, 0x00, 0x7b, 0x00, 0x3e, 0x00, 0x0c, 0x06, 0x08,
+    0x00, 0x1b, 0x00, 0x57, 0x00, 0x84, 0x02, 0x79, 0x00, 0x78, 0x00, 0x7b, 0x02, 0x00, 0x00, 0x4b,
+    0x00, 0x84, 0x03, 0x79, 0x00, 0x6d, 0x00, 0x0b, 0x05, 0x00, 0x00, 0x25, 0x00, 0x7b, 0x00, 0x78,
+    0x01, 0x79, 0x00, 0x84, 0x00, 0x5d, 0x00, 0x04, 0x01, 0x00, 0x00, 0x01, 0x00, 0x5d, 0x00, 0x84,
+    0x02, 0x79, 0x00, 0x7b, 0x00, 0x27, 0x00, 0x2f, 0x00, 0x86, 0x01, 0x78, 0x00, 0x7b, 0x00, 0x42,
+    0x0b, 0x1c, 0x02, 0x21, 0x00, 0x03, 0x00, 0x16, 0x04, 0x79, 0x00, 0x66, 0x00, 0x18, 0x00, 0x67,
+    0x00, 0x78, 0x02, 0x79, 0x00, 0x7b, 0x00, 0x6d, 0x00, 0x2e, 0x07, 0x21, 0x00, 0x42, 0x00, 0x7b,
+    0x03, 0x79, 0x00, 0x85, 0x00, 0x47, 0x00, 0x25, 0x00, 0x87, 0x00, 0x78, 0x02, 0x79, 0x00, 0x6f,
+    0x00, 0x22, 0x07, 0x21, 0x00, 0x3d, 0x00, 0x7b, 0x03, 0x79, 0x00, 0x83, 0x00, 0x4f, 0x51, 0x00,
+    0x00, 0x7b, 0x00, 0x78, 0x01, 0x79, 0x00, 0x78, 0x00, 0x7e, 0x00, 0x21, 0x0b, 0x00, 0x00, 0x03,
+    0x00, 0x6f, 0x00, 0x78, 0x01, 0x79, 0x00, 0x78, 0x00, 0x85, 0x00, 0x2e, 0x09, 0x00, 0x00, 0x45,
+    0x00, 0x84, 0x02, 0x79, 0x00, 0x84, 0x00, 0x4c, 0x00, 0x27, 0x00, 0x7b, 0x02, 0x79, 0x00, 0x78,
+    0x00, 0x6f, 0x00, 0x0d, 0x07, 0x00, 0x00, 0x3b, 0x00, 0x85, 0x02, 0x79, 0x00, 0x78, 0x00, 0x74,
+    0x0a, 0x69, 0x00, 0x6f, 0x00, 0x69, 0x00, 0x17, 0x00, 0x59, 0x00, 0x84, 0x02, 0x79, 0x00, 0x84,
+    0x00, 0x40, 0x0c, 0x00, 0x00, 0x40, 0x00, 0x84, 0x02, 0x79, 0x00, 0x84, 0x00, 0x59, 0x09, 0x00,
+    0x00, 0x21, 0x00, 0x7e, 0x00, 0x78, 0x01, 0x79, 0x00, 0x78, 0x00, 0x7b, 0x02, 0x00, 0x00, 0x11,
+    0x00, 0x73, 0x03, 0x79, 0x00, 0x84, 0x00, 0x48, 0x04, 0x00, 0x00, 0x06, 0x00, 0x63, 0x00, 0x84,
+    0x02, 0x79, 0x00, 0x7b, 0x00, 0x25, 0x02, 0x00, 0x00, 0x01, 0x00, 0x5d, 0x00, 0x84, 0x02, 0x79,
+    0x00, 0x7b, 0x00, 0x27, 0x00, 0x26, 0x00, 0x7e, 0x00, 0x78, 0x00, 0x79, 0x00, 0x7b, 0x00, 0x42,
+    0x00, 0x13, 0x02, 0x19, 0x00, 0x14, 0x05, 0x0f, 0x00, 0x0b, 0x03, 0x00, 0x00, 0x1b, 0x04, 0x79,
+    0x00, 0x66, 0x00, 0x18, 0x00, 0x67, 0x00, 0x78, 0x02, 0x79, 0x00, 0x84, 0x00, 0x34, 0x09, 0x00,
+    0x00, 0x53, 0x00, 0x84, 0x02, 0x79, 0x00, 0x85, 0x00, 0x47, 0x00, 0x25, 0x00, 0x87, 0x00, 0x78,
+    0x01, 0x79, 0x00, 0x7b, 0x00, 0x68, 0x09, 0x00, 0x00, 0x4c, 0x00, 0x84, 0x02, 0x79, 0x00, 0x84,
+    0x00, 0x4c, 0x51, 0x00, 0x00, 0x7b, 0x00, 0x78, 0x01, 0x79, 0x00, 0x78, 0x00, 0x7e, 0x00, 0x1c,
+    0x0b, 0x00, 0x00, 0x03, 0x00, 0x6f, 0x00, 0x78, 0x01, 0x79, 0x00, 0x78, 0x00, 0x86, 0x00, 0x28,
+    0x09, 0x00, 0x00, 0x38, 0x00, 0x84, 0x02, 0x79, 0x00, 0x84, 0x00, 0x4c, 0x00, 0x27, 0x00, 0x7b,
+    0x02, 0x79, 0x00, 0x78, 0x00, 0x6f, 0x00, 0x0d, 0x07, 0x00, 0x00, 0x3b, 0x00, 0x85, 0x03, 0x79,
+    0x0c, 0x78, 0x00, 0x79, 0x00, 0x1c, 0x00, 0x59, 0x00, 0x84, 0x02, 0x79, 0x00, 0x85, 0x00, 0x31,
+    0x0c, 0x00, 0x00, 0x40, 0x00, 0x84, 0x02, 0x79, 0x00, 0x84, 0x00, 0x55, 0x09, 0x00, 0x00, 0x1c,
+    0x00, 0x7e, 0x00, 0x78, 0x01, 0x79, 0x00, 0x78, 0x00, 0x7b, 0x03, 0x00, 0x00, 0x3d, 0x00, 0x85,
+    0x02, 0x79, 0x00, 0x78, 0x00, 0x7d, 0x00, 0x1b, 0x03, 0x00, 0x00, 0x45, 0x00, 0x85, 0x02, 0x79,
+    0x00, 0x84, 0x00, 0x4e, 0x03, 0x00, 0x00, 0x01, 0x00, 0x5d, 0x00, 0x84, 0x02, 0x79, 0x00, 0x7b,
+    0x00, 0x2a, 0x00, 0x06, 0x00, 0x6d, 0x00, 0x7b, 0x01, 0x79, 0x05, 0x84, 0x05, 0x86, 0x00, 0x75,
+    0x00, 0x4c, 0x00, 0x11, 0x01, 0x00, 0x00, 0x1b, 0x04, 0x79, 0x00, 0x66, 0x00, 0x18, 0x00, 0x67,
+    0x00, 0x78, 0x03, 0x79, 0x00, 0x1b, 0x09, 0x00, 0x00, 0x4c, 0x00, 0x84, 0x02, 0x79, 0x00, 0x85,
+    0x00, 0x47, 0x00, 0x25, 0x00, 0x87, 0x00, 0x78, 0x01, 0x79, 0x00, 0x7b, 0x00, 0x68, 0x00, 0x02,
+    0x08, 0x00, 0x00, 0x3f, 0x00, 0x84, 0x02, 0x79, 0x00, 0x84, 0x00, 0x4c, 0x51, 0x00, 0x00, 0x7b,
+    0x00, 0x78, 0x01, 0x79, 0x00, 0x78, 0x00, 0x7e, 0x00, 0x1c, 0x0b, 0x00, 0x00, 0x03, 0x00, 0x6f,
+    0x00, 0x78, 0x01, 0x79, 0x00, 0x78, 0x00, 0x86, 0x00, 0x28, 0x09, 0x00, 0x00, 0x3c, 0x00, 0x84,
+    0x02, 0x79, 0x00, 0x84, 0x00, 0x4c, 0x00, 0x27, 0x00, 0x7b, 0x02, 0x79, 0x00, 0x78, 0x00, 0x6f,
+    0x00, 0x0d, 0x07, 0x00, 0x00, 0x3b, 0x00, 0x85, 0x11, 0x79, 0x00, 0x1c, 0x00, 0x59, 0x00, 0x84,
+    0x02, 0x79, 0x00, 0x85, 0x00, 0x31, 0x0c, 0x00, 0x00, 0x40, 0x00, 0x84, 0x02, 0x79, 0x00, 0x84,
+    0x00, 0x5a, 0x09, 0x00, 0x00, 0x1c, 0x00, 0x7e, 0x00, 0x78, 0x01, 0x79, 0x00, 0x78, 0x00, 0x7b,
+    0x03, 0x00, 0x00, 0x06, 0x00, 0x63, 0x00, 0x84, 0x02, 0x79, 0x00, 0x84, 0x00, 0x53, 0x02, 0x00,
+    0x00, 0x25, 0x00, 0x7d, 0x00, 0x78, 0x01, 0x79, 0x00, 0x78, 0x00, 0x73, 0x00, 0x11, 0x03, 0x00,
+    0x00, 0x01, 0x00, 0x5d, 0x00, 0x84, 0x02, 0x79, 0x00, 0x7b, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x45,
+    0x00, 0x85, 0x07, 0x79, 0x06, 0x78, 0x00, 0x85, 0x00, 0x6d, 0x00, 0x14, 0x00, 0x00, 0x00, 0x1b,
+    0x04, 0x79, 0x00, 0x66, 0x00, 0x18, 0x00, 0x67, 0x00, 0x78, 0x03, 0x79, 0x00, 0x1b, 0x09, 0x00,
+    0x00, 0x4f, 0x00, 0x84, 0x02, 0x79, 0x00, 0x85, 0x00, 0x47, 0x00, 0x25, 0x00, 0x87, 0x00, 0x78,
+    0x01, 0x79, 0x00, 0x7b, 0x00, 0x68, 0x00, 0x02, 0x08, 0x00, 0x00, 0x42, 0x00, 0x84, 0x02, 0x79,
+    0x00, 0x84, 0x00, 0x4c, 0x51, 0x00, 0x00, 0x7b, 0x00, 0x78, 0x01, 0x79, 0x00, 0x78, 0x00, 0x7e,
+    0x00, 0x1c, 0x0b, 0x00, 0x00, 0x03, 0x00, 0x6f, 0x00, 0x78, 0x01, 0x79, 0x00, 0x78, 0x00, 0x86,
+    0x00, 0x28, 0x09, 0x00, 0x00, 0x3c, 0x00, 0x84, 0x02, 0x79, 0x00, 0x84, 0x00, 0x4c, 0x00, 0x27,
+    0x00, 0x7b, 0x02, 0x79, 0x00, 0x78, 0x00, 0x6f, 0x00, 0x0d, 0x07, 0x00, 0x00, 0x3b, 0x00, 0x85,
+    0x04, 0x79, 0x0c, 0x84, 0x00, 0x1c, 0x00, 0x59, 0x00, 0x84, 0x02, 0x79, 0x00, 0x85, 0x00, 0x31,
+    0x0c, 0x00, 0x00, 0x40, 0x00, 0x84, 0x02, 0x79, 0x00, 0x84, 0x00, 0x5a, 0x09, 0x00, 0x00, 0x1c,
+    0x00, 0x7e, 0x00, 0x78, 0x01, 0x79, 0x00, 0x78, 0x00, 0x7b, 0x04, 0x00, 0x00, 0x25, 0x00, 0x84,
+    0x00, 0x78, 0x01, 0x79, 0x00, 0x78, 0x00, 0x85, 0x00, 0x28, 0x00, 0x00, 0x00, 0x06, 0x00, 0x63,
+    0x00, 0x84, 0x02, 0x79, 0x00, 0x85, 0x00, 0x3d, 0x04, 0x00, 0x00, 0x01, 0x00, 0x5d, 0x00, 0x84,
+    0x02, 0x79, 0x00, 0x7b, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x5f, 0x00, 0x85, 0x00, 0x78,
+    0x0d, 0x79, 0x00, 0x84, 0x00, 0x63, 0x00, 0x04, 0x00, 0x16, 0x04, 0x79, 0x00, 0x66, 0x00, 0x18,
+    0x00, 0x67, 0x00, 0x78, 0x03, 0x79, 0x00, 0x1b, 0x09, 0x00, 0x00, 0x4f, 0x00, 0x84, 0x02, 0x79,
+    0x00, 0x85, 0x00, 0x47, 0x00, 0x25, 0x00, 0x87, 0x00, 0x78, 0x01, 0x79, 0x00, 0x7b, 0x00, 0x68,
+    0x00, 0x02, 0x08, 0x00, 0x00, 0x42, 0x00, 0x84, 0x02, 0x79, 0x00, 0x84, 0x00, 0x4c, 0x51, 0x00,
+    0x00, 0x7b, 0x00, 0x78, 0x01, 0x79, 0x00, 0x78, 0x00, 0x7e, 0x00, 0x1c, 0x0b, 0x00, 0x00, 0x03,
+    0x00, 0x6f, 0x00, 0x78, 0x01, 0x79, 0x00, 0x78, 0x00, 0x86, 0x00, 0x28, 0x09, 0x00, 0x00, 0x38,
+    0x00, 0x84, 0x02, 0x79, 0x00, 0x84, 0x00, 0x4c, 0x00, 0x27, 0x00, 0x7b, 0x02, 0x79, 0x00, 0x78,
+    0x00, 0x6e, 0x00, 0x0d, 0x07, 0x00, 0x00, 0x3b, 0x00, 0x85, 0x03, 0x79, 0x00, 0x6f, 0x0a, 0x4f,
+    0x01, 0x4c, 0x00, 0x12, 0x00, 0x59, 0x00, 0x84, 0x02, 0x79, 0x00, 0x85, 0x00, 0x31, 0x0c, 0x00,
+    0x00, 0x40, 0x00, 0x84, 0x02, 0x79, 0x00, 0x84, 0x00, 0x55, 0x09, 0x00, 0x00, 0x1c, 0x00, 0x7e,
+    0x00, 0x78, 0x01, 0x79, 0x00, 0x78, 0x00, 0x7b, 0x05, 0x00, 0x00, 0x51, 0x00, 0x84, 0x02, 0x79,
+    0x00, 0x84, 0x00, 0x63, 0x00, 0x04, 0x00, 0x45, 0x00, 0x85, 0x02, 0x79, 0x00, 0x84, 0x00, 0x63,
+    0x00, 0x04, 0x04, 0x00, 0x00, 0x01, 0x00, 0x5d, 0x00, 0x84, 0x02, 0x79, 0x00, 0x7b, 0x00, 0x2b,
+    0x01, 0x00, 0x00, 0x07, 0x00, 0x49, 0x00, 0x75, 0x0b, 0x84, 0x01, 0x79, 0x00, 0x78, 0x00, 0x85,
+    0x00, 0x2d, 0x00, 0x16, 0x04, 0x79, 0x00, 0x66, 0x00, 0x18, 0x00, 0x67, 0x00, 0x78, 0x03, 0x79,
+    0x00, 0x1b, 0x09, 0x00, 0x00, 0x4c, 0x00, 0x84, 0x02, 0x79, 0x00, 0x85, 0x00, 0x47, 0x00, 0x25,
+    0x00, 0x87, 0x00, 0x78, 0x01, 0x79, 0x00, 0x7b, 0x00, 0x68, 0x00, 0x02, 0x08, 0x00, 0x00, 0x42,
+    0x00, 0x84, 0x02, 0x79, 0x00, 0x84, 0x00, 0x4c, 0x51, 0x00, 0x00, 0x7b, 0x00, 0x78, 0x01, 0x79,
+    0x00, 0x78, 0x00, 0x7e, 0x00, 0x25, 0x0b, 0x00, 0x00, 0x03, 0x00, 0x6f, 0x00, 0x78, 0x02, 0x79,
+    0x00, 0x85, 0x00, 0x38, 0x09, 0x00, 0x00, 0x4b, 0x00, 0x84, 0x02, 0x79, 0x00, 0x84, 0x00, 0x4c,
+    0x00, 0x27, 0x00, 0x7b, 0x02, 0x79, 0x00, 0x78, 0x00, 0x75, 0x00, 0x16, 0x07, 0x00, 0x00, 0x3b,
+    0x00, 0x85, 0x02, 0x79, 0x00, 0x84, 0x00, 0x5f, 0x0d, 0x00, 0x00, 0x5a, 0x00, 0x84, 0x02, 0x79,
+    0x00, 0x84, 0x00, 0x48, 0x0c, 0x00, 0x00, 0x40, 0x00, 0x84, 0x02, 0x79, 0x00, 0x84, 0x00, 0x5f,
+    0x09, 0x00, 0x00, 0x25, 0x00, 0x86, 0x00, 0x78, 0x01, 0x79, 0x00, 0x78, 0x00, 0x7b, 0x05, 0x00,
+    0x00, 0x14, 0x00, 0x73, 0x04, 0x79, 0x00, 0x50, 0x00, 0x73, 0x00, 0x78, 0x02, 0x79, 0x00, 0x7b,
+    0x00, 0x28, 0x05, 0x00, 0x00, 0x01, 0x00, 0x5d, 0x00, 0x84, 0x02, 0x79, 0x00, 0x7b, 0x00, 0x2b,
+    0x03, 0x00, 0x00, 0x0b, 0x00, 0x20, 0x00, 0x2f, 0x08, 0x2a, 0x00, 0x52, 0x00, 0x84, 0x01, 0x79,
+    0x00, 0x84, 0x00, 0x47, 0x00, 0x17, 0x04, 0x79, 0x00, 0x66, 0x00, 0x18, 0x00, 0x67, 0x00, 0x78,
+    0x02, 0x79, 0x00, 0x84, 0x00, 0x30, 0x09, 0x00, 0x00, 0x4f, 0x00, 0x84, 0x02, 0x79, 0x00, 0x85,
+    0x00, 0x47, 0x00, 0x25, 0x00, 0x87, 0x00, 0x78, 0x01, 0x79, 0x00, 0x7b, 0x00, 0x68, 0x00, 0x02,
+    0x08, 0x00, 0x00, 0x42, 0x00, 0x84, 0x02, 0x79, 0x00, 0x84, 0x00, 0x4c, 0x51, 0x00, 0x00, 0x7b,
+    0x00, 0x78, 0x02, 0x79, 0x00, 0x84, 0x00, 0x62, 0x00, 0x28, 0x09, 0x21, 0x00, 0x1c, 0x00, 0x06,
+    0x00, 0x6f, 0x00, 0x78, 0x02, 0x79, 0x00, 0x78, 0x00, 0x6d, 0x00, 0x33, 0x07, 0x21, 0x00, 0x3d,
+    0x00, 0x7c, 0x00, 0x78, 0x02, 0x79, 0x00, 0x84, 0x00, 0x50, 0x00, 0x1c, 0x04, 0x79, 0x00, 0x84,
+    0x00, 0x57, 0x00, 0x25, 0x05, 0x21, 0x00, 0x16, 0x00, 0x3c, 0x00, 0x85, 0x03, 0x79, 0x00, 0x7b,
+    0x00, 0x48, 0x0b, 0x21, 0x00, 0x05, 0x00, 0x5a, 0x00, 0x83, 0x02, 0x79, 0x00, 0x78, 0x00, 0x7c,
+    0x00, 0x3d, 0x0a, 0x21, 0x00, 0x07, 0x00, 0x3c, 0x00, 0x84, 0x03, 0x79, 0x00, 0x7b, 0x00, 0x44,
+    0x07, 0x21, 0x00, 0x29, 0x00, 0x62, 0x00, 0x84, 0x02, 0x79, 0x00, 0x78, 0x00, 0x7c, 0x06, 0x00,
+    0x00, 0x41, 0x00, 0x84, 0x03, 0x79, 0x00, 0x84, 0x03, 0x79, 0x00, 0x84, 0x00, 0x52, 0x06, 0x00,
+    0x00, 0x01, 0x00, 0x5d, 0x00, 0x84, 0x02, 0x79, 0x00, 0x7b, 0x00, 0x2b, 0x00, 0x00, 0x02, 0x08,
+    0x00, 0x05, 0x0a, 0x04, 0x00, 0x40, 0x00, 0x85, 0x01, 0x79, 0x00, 0x83, 0x00, 0x54, 0x00, 0x1d,
+    0x00, 0x72, 0x03, 0x79, 0x00, 0x66, 0x00, 0x1e, 0x00, 0x67, 0x00, 0x78, 0x02, 0x79, 0x00, 0x84,
+    0x00, 0x68, 0x00, 0x21, 0x06, 0x08, 0x00, 0x0c, 0x00, 0x33, 0x00, 0x73, 0x03, 0x79, 0x00, 0x85,
+    0x00, 0x47, 0x00, 0x25, 0x00, 0x87, 0x00, 0x78, 0x01, 0x79, 0x00, 0x7b, 0x00, 0x68, 0x00, 0x02,
+    0x08, 0x00, 0x00, 0x42, 0x00, 0x84, 0x02, 0x79, 0x00, 0x84, 0x00, 0x4c, 0x51, 0x00, 0x00, 0x7e,
+    0x00, 0x78, 0x03, 0x79, 0x00, 0x84, 0x00, 0x86, 0x09, 0x7e, 0x00, 0x70, 0x00, 0x0b, 0x00, 0x59,
+    0x00, 0x83, 0x03, 0x79, 0x00, 0x78, 0x00, 0x85, 0x07, 0x7e, 0x00, 0x85, 0x00, 0x78, 0x03, 0x79,
+    0x00, 0x85, 0x00, 0x44, 0x00, 0x0b, 0x00, 0x7b, 0x00, 0x78, 0x03, 0x79, 0x00, 0x84, 0x00, 0x86,
+    0x05, 0x7e, 0x00, 0x69, 0x00, 0x3f, 0x00, 0x85, 0x00, 0x78, 0x03, 0x79, 0x00, 0x84, 0x0b, 0x7e,
+    0x00, 0x17, 0x00, 0x48, 0x00, 0x84, 0x03, 0x79, 0x00, 0x78, 0x00, 0x85, 0x09, 0x7e, 0x00, 0x88,
+    0x00, 0x36, 0x00, 0x2d, 0x00, 0x85, 0x04, 0x79, 0x00, 0x84, 0x07, 0x7e, 0x00, 0x86, 0x00, 0x84,
+    0x03, 0x79, 0x00, 0x78, 0x00, 0x80, 0x06, 0x00, 0x00, 0x07, 0x00, 0x67, 0x00, 0x84, 0x06, 0x79,
+    0x00, 0x78, 0x00, 0x74, 0x00, 0x14, 0x06, 0x00, 0x00, 0x01, 0x00, 0x5d, 0x00, 0x84, 0x02, 0x79,
+    0x00, 0x7b, 0x00, 0x2a, 0x00, 0x05, 0x00, 0x62, 0x00, 0x67, 0x0c, 0x66, 0x00, 0x7b, 0x02, 0x79,
+    0x00, 0x84, 0x00, 0x43, 0x00, 0x17, 0x04, 0x79, 0x00, 0x67, 0x00, 0x0e, 0x00, 0x5b, 0x00, 0x84,
+    0x03, 0x79, 0x00, 0x84, 0x00, 0x7c, 0x07, 0x66, 0x00, 0x84, 0x04, 0x79, 0x00, 0x85, 0x00, 0x45,
+    0x00, 0x25, 0x00, 0x87, 0x00, 0x78, 0x01, 0x79, 0x00, 0x7b, 0x00, 0x68, 0x00, 0x02, 0x08, 0x00,
+    0x00, 0x42, 0x00, 0x84, 0x02, 0x79, 0x00, 0x84, 0x00, 0x4c, 0x51, 0x00, 0x00, 0x4f, 0x00, 0x84,
+    0x04, 0x79, 0x0a, 0x78, 0x00, 0x75, 0x00, 0x04, 0x00, 0x37, 0x00, 0x85, 0x04, 0x79, 0x08, 0x78,
+    0x04, 0x79, 0x00, 0x78, 0x00, 0x7d, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x57, 0x00, 0x84, 0x04, 0x79,
+    0x06, 0x78, 0x00, 0x75, 0x00, 0x16, 0x00, 0x6d, 0x05, 0x79, 0x0a, 0x78, 0x00, 0x79, 0x00, 0x12,
+    0x00, 0x24, 0x00, 0x85, 0x05, 0x79, 0x09, 0x78, 0x00, 0x84, 0x00, 0x35, 0x00, 0x0c, 0x00, 0x73,
+    0x00, 0x78, 0x04, 0x79, 0x08, 0x78, 0x04, 0x79, 0x00, 0x84, 0x00, 0x4c, 0x07, 0x00, 0x00, 0x2e,
+    0x00, 0x85, 0x06, 0x79, 0x00, 0x85, 0x00, 0x41, 0x07, 0x00, 0x00, 0x01, 0x00, 0x5d, 0x00, 0x84,
+    0x02, 0x79, 0x00, 0x7b, 0x00, 0x2a, 0x00, 0x07, 0x00, 0x72, 0x0d, 0x84, 0x00, 0x78, 0x01, 0x79,
+    0x00, 0x78, 0x00, 0x85, 0x00, 0x28, 0x00, 0x16, 0x04, 0x79, 0x00, 0x67, 0x00, 0x08, 0x00, 0x45,
+    0x00, 0x85, 0x04, 0x79, 0x00, 0x78, 0x06, 0x84, 0x00, 0x7b, 0x00, 0x78, 0x03, 0x79, 0x00, 0x78,
+    0x00, 0x7b, 0x00, 0x1b, 0x00, 0x28, 0x00, 0x87, 0x00, 0x78, 0x01, 0x79, 0x00, 0x7b, 0x00, 0x68,
+    0x00, 0x02, 0x08, 0x00, 0x00, 0x42, 0x00, 0x84, 0x02, 0x79, 0x00, 0x84, 0x00, 0x4c, 0x51, 0x00,
+    0x00, 0x14, 0x00, 0x75, 0x00, 0x84, 0x0d, 0x79, 0x00, 0x78, 0x00, 0x75, 0x00, 0x06, 0x00, 0x04,
+    0x00, 0x5d, 0x00, 0x84, 0x10, 0x79, 0x00, 0x78, 0x00, 0x85, 0x00, 0x4d, 0x01, 0x00, 0x00, 0x1f,
+    0x00, 0x7e, 0x00, 0x78, 0x09, 0x79, 0x00, 0x78, 0x00, 0x75, 0x00, 0x04, 0x00, 0x3d, 0x00, 0x85,
+    0x00, 0x78, 0x0f, 0x79, 0x00, 0x16, 0x00, 0x00, 0x00, 0x53, 0x00, 0x85, 0x00, 0x78, 0x0d, 0x79,
+    0x00, 0x84, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x42, 0x00, 0x85, 0x00, 0x78, 0x10, 0x79, 0x00, 0x84,
+    0x00, 0x6f, 0x00, 0x11, 0x08, 0x00, 0x00, 0x57, 0x00, 0x84, 0x04, 0x79, 0x00, 0x84, 0x00, 0x67,
+    0x00, 0x06, 0x07, 0x00, 0x00, 0x01, 0x00, 0x5d, 0x00, 0x84, 0x02, 0x79, 0x00, 0x7b, 0x00, 0x2a,
+    0x00, 0x07, 0x00, 0x6c, 0x00, 0x7b, 0x0f, 0x79, 0x00, 0x84, 0x00, 0x57, 0x00, 0x03, 0x00, 0x16,
+    0x04, 0x79, 0x00, 0x67, 0x00, 0x09, 0x00, 0x0a, 0x00, 0x6d, 0x00, 0x84, 0x10, 0x79, 0x00, 0x78,
+    0x00, 0x85, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x28, 0x00, 0x87, 0x00, 0x78, 0x01, 0x79, 0x00, 0x7b,
+    0x00, 0x68, 0x00, 0x02, 0x08, 0x00, 0x00, 0x42, 0x00, 0x84, 0x02, 0x79, 0x00, 0x84, 0x00, 0x4c,
+    0x52, 0x00, 0x00, 0x25, 0x00, 0x6f, 0x00, 0x85, 0x0d, 0x78, 0x00, 0x75, 0x00, 0x06, 0x00, 0x00,
+    0x00, 0x14, 0x00, 0x63, 0x00, 0x85, 0x0e, 0x78, 0x00, 0x83, 0x00, 0x86, 0x00, 0x53, 0x00, 0x06,
+    0x02, 0x00, 0x00, 0x2e, 0x00, 0x75, 0x00, 0x84, 0x09, 0x78, 0x00, 0x75, 0x00, 0x06, 0x00, 0x01,
+    0x00, 0x4a, 0x01, 0x84, 0x0d, 0x78, 0x00, 0x79, 0x00, 0x16, 0x00, 0x00, 0x00, 0x06, 0x00, 0x57,
+    0x00, 0x85, 0x00, 0x83, 0x0c, 0x78, 0x00, 0x84, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x4c,
+    0x00, 0x85, 0x00, 0x83, 0x0e, 0x78, 0x00, 0x85, 0x00, 0x6f, 0x00, 0x25, 0x09, 0x00, 0x00, 0x1a,
+    0x00, 0x7b, 0x04, 0x78, 0x00, 0x85, 0x00, 0x2e, 0x08, 0x00, 0x00, 0x01, 0x00, 0x5c, 0x00, 0x83,
+    0x02, 0x78, 0x00, 0x7b, 0x00, 0x2a, 0x00, 0x07, 0x00, 0x6b, 0x00, 0x7a, 0x0e, 0x78, 0x00, 0x85,
+    0x00, 0x63, 0x00, 0x10, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x79, 0x03, 0x78, 0x00, 0x67, 0x00, 0x0c,
+    0x00, 0x00, 0x00, 0x1f, 0x00, 0x6d, 0x00, 0x84, 0x0f, 0x78, 0x00, 0x85, 0x00, 0x5f, 0x00, 0x0b,
+    0x00, 0x00, 0x00, 0x28, 0x00, 0x87, 0x02, 0x78, 0x00, 0x7a, 0x00, 0x68, 0x00, 0x02, 0x08, 0x00,
+    0x00, 0x42, 0x00, 0x84, 0x02, 0x78, 0x00, 0x83, 0x00, 0x4c, 0x53, 0x00, 0x00, 0x11, 0x00, 0x45,
+    0x00, 0x71, 0x0c, 0x80, 0x00, 0x71, 0x00, 0x06, 0x01, 0x00, 0x00, 0x07, 0x00, 0x3e, 0x00, 0x6a,
+    0x0d, 0x80, 0x00, 0x60, 0x00, 0x33, 0x00, 0x01, 0x04, 0x00, 0x00, 0x16, 0x00, 0x4a, 0x00, 0x71,
+    0x08, 0x80, 0x00, 0x71, 0x00, 0x06, 0x01, 0x00, 0x00, 0x25, 0x00, 0x54, 0x00, 0x77, 0x0d, 0x80,
+    0x00, 0x16, 0x01, 0x00, 0x00, 0x04, 0x00, 0x33, 0x00, 0x61, 0x0c, 0x80, 0x00, 0x89, 0x00, 0x36,
+    0x02, 0x00, 0x00, 0x29, 0x00, 0x59, 0x0d, 0x80, 0x00, 0x71, 0x00, 0x45, 0x00, 0x11, 0x0b, 0x00,
+    0x00, 0x45, 0x00, 0x86, 0x02, 0x7c, 0x00, 0x86, 0x00, 0x57, 0x00, 0x01, 0x08, 0x00, 0x00, 0x01,
+    0x00, 0x5e, 0x00, 0x86, 0x02, 0x7c, 0x00, 0x86, 0x00, 0x2a, 0x00, 0x07, 0x00, 0x6d, 0x00, 0x86,
+    0x0d, 0x7c, 0x00, 0x77, 0x00, 0x45, 0x00, 0x07, 0x01, 0x00, 0x00, 0x1c, 0x03, 0x7c, 0x00, 0x86,
+    0x00, 0x69, 0x00, 0x0c, 0x01, 0x00, 0x00, 0x14, 0x00, 0x50, 0x00, 0x7f, 0x00, 0x7b, 0x0b, 0x7c,
+    0x00, 0x7b, 0x00, 0x71, 0x00, 0x42, 0x00, 0x07, 0x01, 0x00, 0x00, 0x28, 0x00, 0x88, 0x00, 0x7b,
+    0x01, 0x7c, 0x00, 0x86, 0x00, 0x69, 0x00, 0x02, 0x08, 0x00, 0x00, 0x42, 0x00, 0x86, 0x02, 0x7c,
+    0x00, 0x86, 0x00, 0x50, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
+    0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x05, 0x00,
 #else
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x8163,0xBBA8,0xD488,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD469,0x6861,0x6000,0x6000,0x7923,0xB347,0xD489,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD489,0xAAE7,0x68A2,0x6000,0x6000,0x81A4,0xD468,0xD467,0xD467,0xD467,0xD467,0xCC48,0x70E3,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A44,0xDC88,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0x7923,0x6000,0x6000,0x70A2,0xAB07,0xD469,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xDC88,0x9A66,0x6000,0x6000,0x6041,0x9A66,0xCC49,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD488,0xBB88,0x8163,0x6000,0x6000,0xAAE7,0xDCA9,0xD489,0xD489,0xD489,0xD489,0xD469,0x7923,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6861,0xC3E8,0xDCA9,0xD489,0xD489,0xDCA9,0xBBA8,0x6041,0xC3C8,0xDCA9,0xD489,0xD489,0xD489,0xDCA9,0x89E5,0x6000,0x6000,0x6000,0x8163,0xB367,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD469,0x7903,0x7923,0xD489,0xD489,0xD489,0xD489,0xDCA9,0xCC29,0x68A2,0x6000,0x6000,0x68A2,0xA286,0xCC49,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xC3C8,0x91E4,0x6020,0x6000,0x6000,0x89C4,0xDCCA,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD4A9,0xC3E8,0x9225,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9204,0xDC68,0xDC67,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD448,0x6861,0x6000,0x81A4,0xD448,0xDC67,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xDC87,0xC3E7,0x70E2,0x6000,0x81A4,0xD447,0xD446,0xD446,0xD446,0xD446,0xCC28,0x70E3,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A44,0xDC87,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD447,0x7923,0x6000,0x7903,0xC3E7,0xDC87,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xDC67,0x9A66,0x6000,0x6861,0xBB67,0xDC87,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xDC67,0xD468,0x91E4,0x6000,0x70A1,0xCC07,0xDC46,0xD446,0xD446,0xD446,0xDC67,0xB367,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xA2C6,0xDC87,0xD446,0xD446,0xD446,0xD467,0x8143,0x6000,0xC3A7,0xDC66,0xD446,0xD446,0xD446,0xD467,0x8A05,0x6000,0x6000,0x9A45,0xD467,0xDC67,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD447,0x7923,0x7923,0xD447,0xD446,0xD446,0xD446,0xD446,0xCC07,0x70C2,0x6000,0x7902,0xCC08,0xDC87,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xDC66,0xDC87,0xB367,0x6881,0x6000,0x89C4,0xDC88,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xDC66,0xDC87,0xBB67,0x6861,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x8143,0xD468,0xD466,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xD448,0x6861,0x68A2,0xCC28,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC67,0xBB87,0x6020,0x8184,0xD447,0xD447,0xD447,0xD447,0xD446,0xCC28,0x70E3,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A44,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0x7903,0x6040,0xBBA7,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC67,0x9A46,0x6000,0xAB06,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xD468,0x7943,0x6000,0x9245,0xDC87,0xD447,0xD447,0xD447,0xD447,0xDC87,0x89A4,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x8163,0xD467,0xD447,0xD447,0xD447,0xDC87,0xAAE6,0x6000,0x6020,0xC3A7,0xDC67,0xD447,0xD447,0xD447,0xD467,0x89E5,0x6000,0x89A4,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0x7923,0x7923,0xD447,0xD447,0xD447,0xD447,0xD447,0xCC07,0x68A2,0x6881,0xCC08,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC87,0xAAE6,0x6000,0x89C4,0xDCA8,0xD446,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xDC87,0xB347,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xBB87,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC66,0xD468,0x6861,0x9A85,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xD446,0xD447,0xD447,0xD447,0xD447,0xD446,0xDC87,0x89A4,0x8164,0xD447,0xD447,0xD447,0xD447,0xD446,0xCC28,0x70E3,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A44,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC87,0xDC87,0xDC87,0xDC87,0xDC87,0xDC87,0xDC87,0xDC87,0xDC87,0xDC87,0xDC87,0xDC87,0xDC87,0x7903,0x89C4,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC87,0x9246,0x7903,0xD467,0xD446,0xD447,0xD447,0xD447,0xD447,0xD446,0xD467,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xD446,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC67,0xBB67,0x6000,0x6040,0xC3C7,0xDC67,0xD447,0xD447,0xD447,0xDC67,0xC3C7,0x6041,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6861,0xC3C7,0xDC67,0xD447,0xD447,0xD467,0xCC27,0x70A2,0x6000,0x6020,0xC3A7,0xDC67,0xD447,0xD447,0xD447,0xD467,0x89E5,0x6000,0xC3E7,0xDC67,0xD447,0xD447,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD447,0x7923,0x7923,0xD447,0xD447,0xD447,0xD447,0xD447,0xCC07,0x6882,0x9A65,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xD467,0x70E2,0x89A4,0xDCA8,0xD446,0xD447,0xD447,0xD447,0xD447,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xD467,0x8184,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xD488,0xD446,0xD447,0xD447,0xD447,0xD447,0xDC67,0xD448,0xC3E7,0xCBE7,0xCBE7,0xCBE7,0xCBE7,0xCBE7,0xCBE7,0xCBE7,0xCBE7,0xCBE7,0xC3E8,0x68A2,0xC3E8,0xDC46,0xD447,0xD447,0xD447,0xD447,0xDC67,0xD467,0xCBE7,0xCBE7,0xCBE7,0xCBE7,0xCBE7,0xCBE7,0xCBE7,0xCC07,0xD467,0xD446,0xD447,0xD447,0xD447,0xD447,0xDC67,0xA2C6,0x8185,0xD447,0xD447,0xD447,0xD447,0xD446,0xCC28,0x70E3,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A44,0xDC87,0xD447,0xD447,0xD447,0xD467,0xC3E8,0x89C3,0x89C3,0x89C3,0x89C3,0x89C3,0x89C3,0x89C3,0x89C3,0x89C3,0x89C3,0x89C3,0x89C3,0x89C3,0x6861,0xB327,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD446,0xD467,0xCC07,0xCBE7,0xCBE7,0xCBE7,0xCBE7,0xCBE7,0xCBE7,0xCBE7,0xCBE7,0xCBE7,0xCC27,0x89E5,0x91E4,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD446,0xDC87,0xCC07,0xCBE7,0xCBE7,0xCBE7,0xCBE7,0xCBE7,0xCBE7,0xCBE7,0xD448,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD446,0xD489,0x6000,0x6000,0x8183,0xD467,0xD447,0xD447,0xD447,0xD447,0xDC87,0x9A45,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xA2C6,0xDC87,0xD447,0xD447,0xD447,0xDC87,0x9245,0x6000,0x6000,0x6020,0xC3A7,0xDC67,0xD447,0xD447,0xD447,0xD467,0x89C5,0x7943,0xD467,0xD446,0xD447,0xD446,0xDC67,0xD488,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xD488,0xD468,0x7923,0x7923,0xD447,0xD447,0xD447,0xD447,0xD447,0xCC07,0x70C3,0xBB86,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC88,0xD488,0xD468,0xD468,0xD468,0xD468,0xD468,0xD488,0xD488,0xDC67,0xD446,0xD447,0xD447,0xD447,0xD447,0xDC87,0xA2A6,0x81A4,0xDCA8,0xD446,0xD447,0xD447,0xD447,0xD447,0xD468,0xD488,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC87,0xA2C6,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xD467,0xD446,0xD447,0xD447,0xD447,0xDC67,0xBB87,0x7923,0x6882,0x6882,0x6882,0x6882,0x6882,0x6882,0x6882,0x6882,0x6882,0x6882,0x6882,0x6841,0xCC28,0xD446,0xD447,0xD447,0xD447,0xD467,0xC3E7,0x8164,0x6882,0x6882,0x6882,0x6882,0x6882,0x6882,0x6882,0x68A2,0x89E5,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC67,0xB347,0x81A5,0xD447,0xD447,0xD447,0xD447,0xD446,0xCC28,0x70E3,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A44,0xDC87,0xD447,0xD447,0xD447,0xDC67,0xBB88,0x6861,0x6861,0x6861,0x6861,0x6861,0x6861,0x6861,0x6861,0x6861,0x6861,0x6861,0x6861,0x6861,0x6020,0xBBC8,0xDC67,0xD447,0xD447,0xD447,0xD447,0xCC27,0x89C4,0x6882,0x6882,0x6882,0x6882,0x6882,0x6882,0x6882,0x6882,0x6882,0x6882,0x68A2,0x6020,0x9A65,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD467,0x9A66,0x70C2,0x6882,0x6882,0x6882,0x6882,0x6882,0x6882,0x6882,0x7923,0xBB87,0xDC67,0xD447,0xD447,0xD447,0xD446,0xD467,0x6000,0x6000,0x6000,0xAB26,0xDC67,0xD447,0xD447,0xD447,0xD447,0xCC27,0x70C2,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x8184,0xD467,0xD446,0xD447,0xD447,0xDC67,0xC3A7,0x6041,0x6000,0x6000,0x6020,0xC3A7,0xDC67,0xD447,0xD447,0xD447,0xD467,0x89C5,0x89E5,0xDC88,0xD446,0xD446,0xDC67,0xA2A6,0x7944,0x7944,0x7944,0x7944,0x7944,0x7944,0x7944,0x7944,0x7944,0x7944,0x7944,0x7944,0x8164,0x8164,0x8164,0x6020,0x7923,0xD447,0xD447,0xD447,0xD447,0xD447,0xCBE7,0x7965,0xC3E7,0xD446,0xD447,0xD447,0xD447,0xD467,0xCC07,0x89E4,0x8164,0x8164,0x8164,0x8164,0x8164,0x8164,0x8164,0x8164,0xA286,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC87,0xAAC6,0x8184,0xDCA8,0xD446,0xD447,0xD447,0xD447,0xCC28,0x81A4,0x8164,0x8164,0x8164,0x8164,0x8164,0x8164,0x8164,0x8164,0x9A65,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC66,0xB347,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xD467,0xD446,0xD447,0xD447,0xD446,0xD488,0x8164,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6040,0xCC28,0xD446,0xD447,0xD447,0xD446,0xDC87,0x91E4,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xA2C6,0xDC67,0xD447,0xD447,0xD447,0xDC67,0xB347,0x81A5,0xD447,0xD447,0xD447,0xD447,0xD446,0xCC28,0x70E3,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A44,0xDC87,0xD447,0xD447,0xD447,0xD446,0xD448,0xCC28,0xCC28,0xCC28,0xCC28,0xCC28,0xCC28,0xCC28,0xCC28,0xCC28,0xCC28,0xCC28,0xCC28,0xCC28,0x7924,0xBBA8,0xDC67,0xD447,0xD447,0xD447,0xDC67,0xA285,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A85,0xDC67,0xD447,0xD447,0xD447,0xDC67,0xBBA8,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x8164,0xDC88,0xD446,0xD447,0xD447,0xD446,0xD467,0x6000,0x6000,0x6000,0x70C2,0xCC27,0xD447,0xD447,0xD447,0xD447,0xDC67,0xAAE6,0x6000,0x6000,0x6000,0x6000,0x6000,0x6861,0xC3C7,0xDC67,0xD447,0xD447,0xD447,0xDC67,0x8184,0x6000,0x6000,0x6000,0x6020,0xC3A7,0xDC67,0xD447,0xD447,0xD447,0xD467,0x89C5,0x89A4,0xDC88,0xD446,0xD447,0xDC67,0xA2A6,0x78E2,0x7902,0x7902,0x7902,0x7902,0x70C1,0x70C1,0x70C1,0x70C1,0x70C1,0x70C1,0x68A2,0x6000,0x6000,0x6000,0x6000,0x7943,0xD447,0xD447,0xD447,0xD447,0xD447,0xCBE7,0x7965,0xC3E7,0xD446,0xD447,0xD447,0xD447,0xDC67,0x9225,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xB367,0xDC67,0xD447,0xD447,0xD447,0xDC87,0xAAC6,0x8184,0xDCA8,0xD446,0xD447,0xD447,0xD467,0xCC08,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xAB27,0xDC67,0xD447,0xD447,0xD447,0xDC67,0xB327,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xD467,0xD446,0xD447,0xD447,0xD446,0xD468,0x7944,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6040,0xCC28,0xD446,0xD447,0xD447,0xD446,0xDC88,0x89A4,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A45,0xDC67,0xD447,0xD447,0xD447,0xDC67,0xB347,0x81A5,0xD447,0xD447,0xD447,0xD447,0xD446,0xCC28,0x70E3,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A44,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD447,0x7944,0xBBA8,0xDC67,0xD447,0xD447,0xD447,0xDC87,0x91E4,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A85,0xDC67,0xD447,0xD447,0xD447,0xDC67,0xBBA8,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x7944,0xD468,0xD446,0xD447,0xD447,0xD446,0xD467,0x6000,0x6000,0x6000,0x6000,0x9A65,0xDC87,0xD447,0xD447,0xD447,0xD446,0xD467,0x7923,0x6000,0x6000,0x6000,0x6000,0xA2C6,0xDC87,0xD447,0xD447,0xD447,0xDC67,0xB326,0x6000,0x6000,0x6000,0x6000,0x6020,0xC3A7,0xDC67,0xD447,0xD447,0xD447,0xD467,0x89E5,0x6861,0xCC27,0xD467,0xD447,0xD447,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC88,0xDC88,0xDC88,0xDC88,0xDC88,0xDC88,0xD448,0xB327,0x70C2,0x6000,0x6000,0x7943,0xD447,0xD447,0xD447,0xD447,0xD447,0xCBE7,0x7965,0xC3E7,0xD446,0xD447,0xD447,0xD447,0xD447,0x7943,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xB327,0xDC67,0xD447,0xD447,0xD447,0xDC87,0xAAC6,0x8184,0xDCA8,0xD446,0xD447,0xD447,0xD467,0xCC08,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A86,0xDC67,0xD447,0xD447,0xD447,0xDC67,0xB327,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xD467,0xD446,0xD447,0xD447,0xD446,0xD468,0x7964,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6040,0xCC28,0xD446,0xD447,0xD447,0xD446,0xDC88,0x89C4,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A45,0xDC67,0xD447,0xD447,0xD447,0xDC67,0xB347,0x81A5,0xD447,0xD447,0xD447,0xD447,0xD446,0xCC28,0x70E3,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A44,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0x7944,0xBBA8,0xDC67,0xD447,0xD447,0xD447,0xDC87,0x9204,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A85,0xDC67,0xD447,0xD447,0xD447,0xDC67,0xBBA8,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x7944,0xD468,0xD446,0xD447,0xD447,0xD446,0xD467,0x6000,0x6000,0x6000,0x6000,0x6861,0xC3E7,0xDC67,0xD447,0xD447,0xD447,0xDC67,0xBB67,0x6020,0x6000,0x6000,0x8184,0xD467,0xD446,0xD447,0xD447,0xD446,0xD427,0x70C2,0x6000,0x6000,0x6000,0x6000,0x6020,0xC3A7,0xDC67,0xD447,0xD447,0xD447,0xD467,0x89E5,0x6000,0xA2C6,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xDC87,0xCC07,0x7902,0x6000,0x7943,0xD447,0xD447,0xD447,0xD447,0xD447,0xCBE7,0x7965,0xC3E7,0xD446,0xD447,0xD447,0xD447,0xD447,0x7943,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xB327,0xDC67,0xD447,0xD447,0xD447,0xDC87,0xAAC6,0x8184,0xDCA8,0xD446,0xD447,0xD447,0xD467,0xCC08,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xA2A6,0xDC67,0xD447,0xD447,0xD447,0xDC67,0xB327,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xD467,0xD446,0xD447,0xD447,0xD446,0xD468,0x7964,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6040,0xCC28,0xD446,0xD447,0xD447,0xD446,0xDC88,0x89C4,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A45,0xDC67,0xD447,0xD447,0xD447,0xDC67,0xB347,0x81A5,0xD447,0xD447,0xD447,0xD447,0xD446,0xCC28,0x70E3,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A44,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0x7964,0xBBA8,0xDC67,0xD447,0xD447,0xD447,0xDC87,0x9204,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A85,0xDC67,0xD447,0xD447,0xD447,0xDC67,0xBBA8,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x7944,0xD468,0xD446,0xD447,0xD447,0xD446,0xD467,0x6000,0x6000,0x6000,0x6000,0x6000,0x89A4,0xDC67,0xD446,0xD447,0xD447,0xD446,0xDC87,0x89C4,0x6000,0x6861,0xC3C7,0xDC67,0xD447,0xD447,0xD447,0xDC87,0x9A65,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0xC3A7,0xDC67,0xD447,0xD447,0xD447,0xD467,0x89E5,0x6000,0x6881,0xC3C8,0xDC87,0xD446,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC67,0xC3C7,0x6041,0x7923,0xD447,0xD447,0xD447,0xD447,0xD447,0xCBE7,0x7965,0xC3E7,0xD446,0xD447,0xD447,0xD447,0xD447,0x7943,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xB327,0xDC67,0xD447,0xD447,0xD447,0xDC87,0xAAC6,0x8184,0xDCA8,0xD446,0xD447,0xD447,0xD467,0xCC08,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xA2A6,0xDC67,0xD447,0xD447,0xD447,0xDC67,0xB327,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xD467,0xD446,0xD447,0xD447,0xD446,0xD468,0x7944,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6040,0xCC28,0xD446,0xD447,0xD447,0xD446,0xDC88,0x89A4,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A45,0xDC67,0xD447,0xD447,0xD447,0xDC67,0xB347,0x81A5,0xD447,0xD447,0xD447,0xD447,0xD446,0xCC28,0x70C3,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A44,0xDC87,0xD447,0xD447,0xD447,0xD447,0xCC28,0xB347,0xB347,0xB347,0xB347,0xB347,0xB347,0xB347,0xB347,0xB347,0xB347,0xB347,0xB347,0xAB27,0x70E3,0xBBA8,0xDC67,0xD447,0xD447,0xD447,0xDC87,0x91E4,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A85,0xDC67,0xD447,0xD447,0xD447,0xDC67,0xBBA8,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x7944,0xD468,0xD446,0xD447,0xD447,0xD446,0xD467,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xB346,0xDC67,0xD447,0xD447,0xD447,0xDC67,0xC3E7,0x6041,0xA2C6,0xDC87,0xD447,0xD447,0xD447,0xDC67,0xC3E7,0x6861,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0xC3A7,0xDC67,0xD447,0xD447,0xD447,0xD467,0x89E5,0x6000,0x6000,0x6881,0xAB06,0xD468,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xD447,0xD447,0xD446,0xDC87,0x89E4,0x7903,0xD447,0xD447,0xD447,0xD447,0xD447,0xCBE7,0x7965,0xC3E7,0xD446,0xD447,0xD447,0xD447,0xD447,0x7943,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xB327,0xDC67,0xD447,0xD447,0xD447,0xDC87,0xAAC6,0x8184,0xDCA8,0xD446,0xD447,0xD447,0xD467,0xCC08,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xA2A6,0xDC67,0xD447,0xD447,0xD447,0xDC67,0xB327,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xD467,0xD446,0xD447,0xD447,0xD446,0xDC88,0x8184,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6040,0xCC28,0xD446,0xD447,0xD447,0xD447,0xDC87,0x9225,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xAB06,0xDC67,0xD447,0xD447,0xD447,0xDC67,0xB347,0x81C5,0xD447,0xD447,0xD447,0xD447,0xD446,0xD468,0x7903,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A44,0xDC87,0xD447,0xD447,0xD447,0xDC67,0xC3C8,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xBBC8,0xDC67,0xD447,0xD447,0xD447,0xDC67,0xAAC6,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xA285,0xDC67,0xD447,0xD447,0xD447,0xDC67,0xC3C8,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x89A4,0xDC88,0xD446,0xD447,0xD447,0xD446,0xD467,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x7902,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xB347,0xCC27,0xD446,0xD447,0xD447,0xD447,0xDC67,0x89A4,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0xC3A7,0xDC67,0xD447,0xD447,0xD447,0xD467,0x89E5,0x6000,0x6000,0x6000,0x6000,0x70C2,0x8183,0x89E5,0x89E5,0x89E5,0x89E5,0x89E5,0x89E5,0x89E5,0x89E5,0x89E5,0x89E5,0xB346,0xDC67,0xD447,0xD447,0xDC67,0xAAC6,0x7924,0xD447,0xD447,0xD447,0xD447,0xD447,0xCBE7,0x7965,0xC3E7,0xD446,0xD447,0xD447,0xD447,0xDC67,0x9205,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xB347,0xDC67,0xD447,0xD447,0xD447,0xDC87,0xAAC6,0x8184,0xDCA8,0xD446,0xD447,0xD447,0xD467,0xCC08,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xA2A6,0xDC67,0xD447,0xD447,0xD447,0xDC67,0xB327,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xD467,0xD446,0xD447,0xD447,0xD447,0xDC67,0xC3C7,0x89A4,0x8164,0x8164,0x8164,0x8164,0x8164,0x8164,0x8164,0x8164,0x8164,0x8164,0x7944,0x6861,0xCC28,0xD446,0xD447,0xD447,0xD447,0xD446,0xCC27,0x9205,0x8164,0x8164,0x8164,0x8164,0x8164,0x8164,0x8164,0x8164,0x9A65,0xD468,0xD446,0xD447,0xD447,0xD447,0xDC67,0xB347,0x8164,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC67,0xBB87,0x8184,0x8164,0x8164,0x8164,0x8164,0x8164,0x8164,0x7923,0x9A45,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD467,0xAAE6,0x8184,0x8164,0x8164,0x8164,0x8164,0x8164,0x8164,0x8164,0x8164,0x8164,0x8164,0x8164,0x6861,0xBBC8,0xDC66,0xD447,0xD447,0xD447,0xD446,0xD468,0x9A65,0x8164,0x8164,0x8164,0x8164,0x8164,0x8164,0x8164,0x8164,0x8164,0x8164,0x8184,0x6881,0x9A65,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD467,0xA2C6,0x8184,0x8164,0x8164,0x8164,0x8164,0x8164,0x8164,0x8164,0x89C4,0xC3C7,0xDC67,0xD447,0xD447,0xD447,0xD446,0xD468,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xA2A6,0xDC67,0xD447,0xD447,0xD447,0xD447,0xDC67,0xD447,0xD447,0xD447,0xD447,0xDC67,0xB346,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0xC3A7,0xDC67,0xD447,0xD447,0xD447,0xD467,0x89E5,0x6000,0x6882,0x6882,0x6882,0x6861,0x6061,0x6041,0x6041,0x6041,0x6041,0x6041,0x6041,0x6041,0x6041,0x6041,0x6061,0x9A65,0xDC87,0xD447,0xD447,0xDC66,0xBB88,0x8164,0xD447,0xD447,0xD447,0xD447,0xD447,0xCBE7,0x7965,0xC3E7,0xD446,0xD447,0xD447,0xD447,0xDC67,0xC3E8,0x8184,0x6882,0x6882,0x6882,0x6882,0x6882,0x6882,0x6882,0x68A2,0x9205,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC87,0xAAC6,0x8184,0xDCA8,0xD446,0xD447,0xD447,0xD467,0xCC08,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xA2A6,0xDC67,0xD447,0xD447,0xD447,0xDC67,0xB327,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xD488,0xD446,0xD447,0xD447,0xD447,0xD447,0xDC67,0xDC88,0xD488,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xD488,0xCC49,0x68A2,0xBBA8,0xDC66,0xD447,0xD447,0xD447,0xD447,0xD446,0xDC87,0xD488,0xD468,0xD468,0xD468,0xD468,0xD468,0xD488,0xD488,0xDC87,0xD446,0xD447,0xD447,0xD447,0xD447,0xDC87,0xA2A6,0x68A2,0xD467,0xD446,0xD447,0xD447,0xD447,0xD447,0xDC67,0xDC88,0xD468,0xD468,0xD468,0xD468,0xD468,0xD488,0xCC28,0x9A86,0xDC87,0xD446,0xD447,0xD447,0xD447,0xD447,0xDC67,0xD488,0xD488,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0x7924,0xAAE6,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD446,0xDC87,0xD488,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xDCA9,0x9226,0x91E4,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC67,0xD488,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xDC88,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD446,0xD489,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6881,0xCBE7,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xD448,0x7902,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0xC3A7,0xDC67,0xD447,0xD447,0xD447,0xD467,0x89E5,0x6861,0xC3C7,0xCC07,0xCBE7,0xCBE7,0xCBE7,0xCBE7,0xCBE7,0xCBE7,0xCBE7,0xCBE7,0xCBE7,0xCBE7,0xCBE7,0xCBE7,0xCBE7,0xD467,0xD447,0xD447,0xD447,0xDC67,0xA2C5,0x7924,0xD447,0xD447,0xD447,0xD447,0xD447,0xCC07,0x70E3,0xBB86,0xDC67,0xD447,0xD447,0xD447,0xD447,0xDC67,0xD468,0xCBE7,0xCBE7,0xCBE7,0xCBE7,0xCBE7,0xCBE7,0xCBE7,0xCC07,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC87,0xA2C6,0x81A4,0xDCA8,0xD446,0xD447,0xD447,0xD467,0xCC08,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xA2A6,0xDC67,0xD447,0xD447,0xD447,0xDC67,0xB327,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xB327,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD448,0x6041,0x9224,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xDC67,0x8163,0x6000,0xBB87,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xCC48,0x7923,0xCC27,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD447,0x7103,0x8183,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xDC67,0x9246,0x70C2,0xD447,0xD446,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC67,0xAB07,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x89E4,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC87,0xA2A6,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0xC3A7,0xDC67,0xD447,0xD447,0xD447,0xD467,0x89E5,0x6881,0xCC27,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xD446,0xD447,0xD447,0xD446,0xDC87,0x89C4,0x7903,0xD447,0xD447,0xD447,0xD447,0xD447,0xCC07,0x6882,0xA2A6,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xD467,0xD446,0xD447,0xD447,0xD447,0xD447,0xD446,0xD467,0x7923,0x89A4,0xDCA8,0xD446,0xD447,0xD447,0xD467,0xCC08,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xA2A6,0xDC67,0xD447,0xD447,0xD447,0xDC67,0xB327,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x7102,0xD448,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xD448,0x6861,0x6841,0xC3C7,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xDC87,0xB346,0x6020,0x6000,0x8163,0xD468,0xD446,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xD448,0x6861,0x9A65,0xDC87,0xD446,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0x7923,0x6000,0xB347,0xDC87,0xD446,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC67,0x9A46,0x6000,0xA2A6,0xDC87,0xD446,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC67,0xCC48,0x70C2,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xBB87,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC67,0xCC07,0x6861,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0xC3A7,0xDC67,0xD447,0xD447,0xD447,0xD467,0x89E5,0x6861,0xCC07,0xD467,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC67,0xBB87,0x6020,0x7923,0xD447,0xD447,0xD447,0xD447,0xD447,0xCC07,0x68A2,0x70A1,0xCC07,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xDC87,0xB367,0x6000,0x89C4,0xDCA8,0xD446,0xD447,0xD447,0xD467,0xCC08,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xA2A6,0xDC67,0xD447,0xD447,0xD447,0xDC67,0xB327,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x89A4,0xCC28,0xDC87,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD448,0x6861,0x6000,0x7102,0xC3C7,0xDC87,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xDC66,0xDC88,0xBB67,0x6861,0x6000,0x6000,0x6000,0x91E4,0xD448,0xDC67,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD448,0x6861,0x6020,0xAB07,0xDC67,0xDC67,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD447,0x7923,0x6000,0x6881,0xBB87,0xDC87,0xDC66,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xDC67,0x9A66,0x6000,0x6040,0xAB07,0xDC87,0xDC66,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xDC87,0xCC28,0x8184,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x7923,0xD467,0xD446,0xD446,0xD446,0xD446,0xD446,0xDC87,0x89E4,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0xC3A6,0xDC66,0xD446,0xD446,0xD446,0xD467,0x89E5,0x6861,0xCC06,0xD466,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xDC87,0xC3C7,0x70C2,0x6000,0x7943,0xD447,0xD446,0xD446,0xD446,0xD446,0xCC07,0x70C2,0x6000,0x8163,0xCC27,0xDC67,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xDC87,0xC3C8,0x70A2,0x6000,0x89C4,0xDCA8,0xD446,0xD446,0xD446,0xD466,0xCC08,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xA2A6,0xDC67,0xD446,0xD446,0xD446,0xDC66,0xB327,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x70E2,0xA2C6,0xCC49,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xCC69,0x6861,0x6000,0x6000,0x6881,0x9A86,0xCC29,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xC3C8,0x9205,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x7923,0xAB07,0xCC69,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xCC69,0x6861,0x6000,0x6000,0x89A4,0xBB88,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0x7923,0x6000,0x6000,0x6041,0x9225,0xC3E9,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xDCA9,0x9246,0x6000,0x6000,0x6000,0x89C4,0xBB88,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xD489,0xCC49,0xA2C6,0x70C2,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xA2C6,0xDC88,0xD468,0xD468,0xD468,0xDC88,0xBB87,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0xC3C7,0xDC88,0xD468,0xD468,0xD468,0xDC88,0x89E5,0x6861,0xCC27,0xDC88,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xD469,0xA2C6,0x6881,0x6000,0x6000,0x7944,0xD468,0xD468,0xD468,0xD468,0xDC88,0xCC28,0x70C2,0x6000,0x6000,0x7102,0xB347,0xD489,0xD467,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xD468,0xD467,0xD449,0xA286,0x6861,0x6000,0x6000,0x89C4,0xDCA9,0xD467,0xD468,0xD468,0xDC88,0xCC28,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xA2A6,0xDC88,0xD468,0xD468,0xD468,0xDC88,0xB347,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
+    0x40, 0x01, 0x20, 0x00, 0x79, 0x00, 0x00, 0x60, 0x20, 0x60, 0x40, 0x60, 0x41, 0x60, 0x61, 0x60,
+    0x41, 0x68, 0x61, 0x68, 0x81, 0x68, 0x82, 0x68, 0xa2, 0x68, 0xa1, 0x70, 0xa2, 0x70, 0xc1, 0x70,
+    0xc2, 0x70, 0xc3, 0x70, 0xe2, 0x70, 0xe3, 0x70, 0x02, 0x71, 0x03, 0x71, 0xe2, 0x78, 0x02, 0x79,
+    0x03, 0x79, 0x23, 0x79, 0x24, 0x79, 0x43, 0x79, 0x44, 0x79, 0x64, 0x79, 0x65, 0x79, 0x43, 0x81,
+    0x63, 0x81, 0x64, 0x81, 0x83, 0x81, 0x84, 0x81, 0x85, 0x81, 0xa4, 0x81, 0xa5, 0x81, 0xc5, 0x81,
+    0xa4, 0x89, 0xc3, 0x89, 0xc4, 0x89, 0xc5, 0x89, 0xe4, 0x89, 0xe5, 0x89, 0x05, 0x8a, 0xe4, 0x91,
+    0x04, 0x92, 0x05, 0x92, 0x24, 0x92, 0x25, 0x92, 0x26, 0x92, 0x45, 0x92, 0x46, 0x92, 0x44, 0x9a,
+    0x45, 0x9a, 0x46, 0x9a, 0x65, 0x9a, 0x66, 0x9a, 0x85, 0x9a, 0x86, 0x9a, 0x85, 0xa2, 0x86, 0xa2,
+    0xa6, 0xa2, 0xc5, 0xa2, 0xc6, 0xa2, 0xc6, 0xaa, 0xe6, 0xaa, 0xe7, 0xaa, 0x06, 0xab, 0x07, 0xab,
+    0x26, 0xab, 0x27, 0xab, 0x26, 0xb3, 0x27, 0xb3, 0x46, 0xb3, 0x47, 0xb3, 0x67, 0xb3, 0x67, 0xbb,
+    0x86, 0xbb, 0x87, 0xbb, 0x88, 0xbb, 0xa7, 0xbb, 0xa8, 0xbb, 0xc8, 0xbb, 0xa6, 0xc3, 0xa7, 0xc3,
+    0xc7, 0xc3, 0xc8, 0xc3, 0xe7, 0xc3, 0xe8, 0xc3, 0xe9, 0xc3, 0xe7, 0xcb, 0x06, 0xcc, 0x07, 0xcc,
+    0x08, 0xcc, 0x27, 0xcc, 0x28, 0xcc, 0x29, 0xcc, 0x48, 0xcc, 0x49, 0xcc, 0x69, 0xcc, 0x27, 0xd4,
+    0x46, 0xd4, 0x47, 0xd4, 0x48, 0xd4, 0x49, 0xd4, 0x66, 0xd4, 0x67, 0xd4, 0x68, 0xd4, 0x69, 0xd4,
+    0x88, 0xd4, 0x89, 0xd4, 0xa9, 0xd4, 0x46, 0xdc, 0x66, 0xdc, 0x67, 0xdc, 0x68, 0xdc, 0x87, 0xdc,
+    0x88, 0xdc, 0xa8, 0xdc, 0xa9, 0xdc, 0xca, 0xdc, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
+    0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xcd, 0x00, 0x00, 0x1d, 0x00, 0x51, 0x00, 0x6d,
+    0x0c, 0x6a, 0x00, 0x6c, 0x00, 0x06, 0x01, 0x00, 0x00, 0x16, 0x00, 0x4a, 0x00, 0x6e, 0x0d, 0x6a,
+    0x00, 0x6e, 0x00, 0x42, 0x00, 0x09, 0x01, 0x00, 0x00, 0x22, 0x00, 0x6b, 0x03, 0x6a, 0x00, 0x61,
+    0x00, 0x10, 0x07, 0x00, 0x00, 0x34, 0x00, 0x75, 0x11, 0x6a, 0x00, 0x16, 0x01, 0x00, 0x00, 0x0b,
+    0x00, 0x44, 0x00, 0x6c, 0x0c, 0x6a, 0x00, 0x75, 0x00, 0x38, 0x01, 0x00, 0x00, 0x03, 0x00, 0x38,
+    0x00, 0x62, 0x0d, 0x6a, 0x00, 0x6d, 0x00, 0x4f, 0x00, 0x1d, 0x01, 0x00, 0x00, 0x42, 0x00, 0x77,
+    0x03, 0x6e, 0x00, 0x6c, 0x00, 0x16, 0x0b, 0x00, 0x00, 0x06, 0x00, 0x58, 0x00, 0x77, 0x01, 0x6e,
+    0x00, 0x77, 0x00, 0x51, 0x00, 0x03, 0x00, 0x56, 0x00, 0x77, 0x02, 0x6e, 0x00, 0x77, 0x00, 0x2a,
+    0x02, 0x00, 0x00, 0x1d, 0x00, 0x4b, 0x0e, 0x6e, 0x00, 0x6c, 0x00, 0x15, 0x00, 0x16, 0x03, 0x6e,
+    0x00, 0x77, 0x00, 0x60, 0x00, 0x09, 0x01, 0x00, 0x00, 0x09, 0x00, 0x3c, 0x00, 0x62, 0x0d, 0x6e,
+    0x00, 0x56, 0x00, 0x2c, 0x00, 0x01, 0x01, 0x00, 0x00, 0x27, 0x00, 0x78, 0x0f, 0x6e, 0x00, 0x6f,
+    0x00, 0x58, 0x00, 0x30, 0x00, 0x01, 0x54, 0x00, 0x00, 0x2d, 0x00, 0x73, 0x00, 0x72, 0x0d, 0x65,
+    0x00, 0x67, 0x00, 0x06, 0x00, 0x00, 0x00, 0x22, 0x00, 0x67, 0x00, 0x72, 0x0f, 0x65, 0x00, 0x74,
+    0x00, 0x57, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x22, 0x00, 0x66, 0x03, 0x65, 0x00, 0x5f, 0x00, 0x10,
+    0x07, 0x00, 0x00, 0x34, 0x00, 0x74, 0x10, 0x65, 0x00, 0x66, 0x00, 0x16, 0x00, 0x00, 0x00, 0x15,
+    0x00, 0x57, 0x00, 0x74, 0x0d, 0x65, 0x00, 0x72, 0x00, 0x38, 0x00, 0x00, 0x00, 0x06, 0x00, 0x4c,
+    0x00, 0x74, 0x0f, 0x65, 0x00, 0x72, 0x00, 0x6b, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x5c,
+    0x00, 0x70, 0x02, 0x65, 0x00, 0x72, 0x00, 0x4b, 0x0b, 0x00, 0x00, 0x3f, 0x00, 0x74, 0x02, 0x65,
+    0x00, 0x6a, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x54, 0x00, 0x71, 0x02, 0x65, 0x00, 0x6a, 0x00, 0x2b,
+    0x01, 0x00, 0x00, 0x35, 0x00, 0x6a, 0x00, 0x72, 0x0e, 0x65, 0x00, 0x66, 0x01, 0x16, 0x00, 0x66,
+    0x03, 0x65, 0x00, 0x5c, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x14, 0x00, 0x5d, 0x00, 0x74, 0x0e, 0x65,
+    0x00, 0x71, 0x00, 0x74, 0x00, 0x4b, 0x00, 0x07, 0x00, 0x00, 0x00, 0x27, 0x00, 0x75, 0x10, 0x65,
+    0x00, 0x71, 0x00, 0x74, 0x00, 0x4c, 0x00, 0x06, 0x52, 0x00, 0x00, 0x1c, 0x00, 0x6b, 0x00, 0x69,
+    0x0d, 0x66, 0x00, 0x65, 0x00, 0x67, 0x00, 0x06, 0x00, 0x09, 0x00, 0x5f, 0x00, 0x72, 0x11, 0x66,
+    0x00, 0x72, 0x00, 0x4e, 0x00, 0x01, 0x00, 0x20, 0x03, 0x66, 0x00, 0x65, 0x00, 0x5f, 0x00, 0x10,
+    0x07, 0x00, 0x00, 0x34, 0x00, 0x74, 0x11, 0x66, 0x00, 0x15, 0x00, 0x02, 0x00, 0x50, 0x00, 0x72,
+    0x0e, 0x66, 0x00, 0x72, 0x00, 0x36, 0x00, 0x00, 0x00, 0x43, 0x00, 0x74, 0x11, 0x66, 0x00, 0x65,
+    0x00, 0x6b, 0x00, 0x18, 0x00, 0x00, 0x00, 0x32, 0x00, 0x74, 0x03, 0x66, 0x00, 0x74, 0x00, 0x25,
+    0x09, 0x00, 0x00, 0x1d, 0x00, 0x6a, 0x02, 0x66, 0x00, 0x74, 0x00, 0x41, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x54, 0x00, 0x72, 0x02, 0x66, 0x00, 0x6a, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x25, 0x00, 0x72,
+    0x11, 0x66, 0x01, 0x16, 0x04, 0x66, 0x00, 0x5c, 0x00, 0x09, 0x00, 0x07, 0x00, 0x5d, 0x00, 0x72,
+    0x11, 0x66, 0x00, 0x74, 0x00, 0x41, 0x00, 0x00, 0x00, 0x27, 0x00, 0x76, 0x00, 0x65, 0x10, 0x66,
+    0x00, 0x65, 0x00, 0x74, 0x00, 0x4a, 0x00, 0x01, 0x51, 0x00, 0x00, 0x4e, 0x00, 0x72, 0x04, 0x66,
+    0x00, 0x65, 0x08, 0x72, 0x00, 0x71, 0x00, 0x6b, 0x00, 0x06, 0x00, 0x39, 0x00, 0x74, 0x04, 0x66,
+    0x00, 0x65, 0x07, 0x72, 0x00, 0x65, 0x03, 0x66, 0x00, 0x65, 0x00, 0x74, 0x00, 0x25, 0x00, 0x1e,
+    0x03, 0x66, 0x00, 0x65, 0x00, 0x5f, 0x00, 0x10, 0x07, 0x00, 0x00, 0x34, 0x00, 0x74, 0x04, 0x66,
+    0x0c, 0x74, 0x00, 0x15, 0x00, 0x27, 0x00, 0x74, 0x04, 0x66, 0x00, 0x65, 0x09, 0x72, 0x00, 0x74,
+    0x00, 0x33, 0x00, 0x15, 0x00, 0x6a, 0x00, 0x65, 0x03, 0x66, 0x00, 0x65, 0x00, 0x6a, 0x06, 0x72,
+    0x00, 0x65, 0x04, 0x66, 0x00, 0x72, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x55, 0x00, 0x72,
+    0x02, 0x66, 0x00, 0x72, 0x00, 0x55, 0x00, 0x03, 0x07, 0x00, 0x00, 0x06, 0x00, 0x55, 0x00, 0x72,
+    0x01, 0x66, 0x00, 0x6a, 0x00, 0x5e, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x54, 0x00, 0x72,
+    0x02, 0x66, 0x00, 0x6a, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x57, 0x00, 0x72, 0x01, 0x66, 0x0e, 0x65,
+    0x00, 0x66, 0x01, 0x16, 0x04, 0x66, 0x00, 0x5c, 0x00, 0x08, 0x00, 0x37, 0x00, 0x74, 0x04, 0x66,
+    0x08, 0x65, 0x04, 0x66, 0x00, 0x65, 0x00, 0x6a, 0x00, 0x0f, 0x00, 0x25, 0x00, 0x76, 0x00, 0x65,
+    0x03, 0x66, 0x08, 0x65, 0x04, 0x66, 0x00, 0x65, 0x00, 0x6a, 0x00, 0x20, 0x51, 0x00, 0x00, 0x6d,
+    0x00, 0x65, 0x03, 0x66, 0x00, 0x72, 0x00, 0x67, 0x00, 0x57, 0x08, 0x5a, 0x00, 0x58, 0x00, 0x09,
+    0x00, 0x58, 0x00, 0x70, 0x03, 0x66, 0x00, 0x72, 0x00, 0x6a, 0x06, 0x5a, 0x00, 0x5c, 0x00, 0x6a,
+    0x00, 0x65, 0x03, 0x66, 0x00, 0x72, 0x00, 0x3f, 0x00, 0x21, 0x03, 0x66, 0x00, 0x65, 0x00, 0x5f,
+    0x00, 0x10, 0x07, 0x00, 0x00, 0x34, 0x00, 0x74, 0x02, 0x66, 0x00, 0x6a, 0x00, 0x58, 0x0c, 0x26,
+    0x00, 0x06, 0x00, 0x48, 0x00, 0x72, 0x03, 0x66, 0x00, 0x65, 0x00, 0x6a, 0x00, 0x5c, 0x08, 0x5a,
+    0x00, 0x5e, 0x00, 0x2a, 0x00, 0x2c, 0x00, 0x74, 0x03, 0x66, 0x00, 0x65, 0x00, 0x74, 0x00, 0x5c,
+    0x06, 0x5a, 0x00, 0x67, 0x00, 0x72, 0x03, 0x66, 0x00, 0x65, 0x00, 0x6e, 0x01, 0x00, 0x00, 0x1f,
+    0x00, 0x6a, 0x03, 0x66, 0x00, 0x74, 0x00, 0x35, 0x07, 0x00, 0x00, 0x3f, 0x00, 0x74, 0x02, 0x66,
+    0x00, 0x74, 0x00, 0x32, 0x01, 0x00, 0x00, 0x01, 0x00, 0x54, 0x00, 0x72, 0x02, 0x66, 0x00, 0x6a,
+    0x00, 0x28, 0x00, 0x18, 0x00, 0x6a, 0x00, 0x65, 0x00, 0x66, 0x00, 0x65, 0x00, 0x72, 0x00, 0x6d,
+    0x0b, 0x6b, 0x00, 0x6d, 0x00, 0x6b, 0x01, 0x16, 0x04, 0x66, 0x00, 0x5c, 0x00, 0x0e, 0x00, 0x4d,
+    0x00, 0x72, 0x04, 0x66, 0x00, 0x75, 0x00, 0x6d, 0x04, 0x6b, 0x01, 0x6d, 0x00, 0x72, 0x00, 0x65,
+    0x03, 0x66, 0x00, 0x74, 0x00, 0x3d, 0x00, 0x22, 0x00, 0x76, 0x00, 0x65, 0x03, 0x66, 0x00, 0x6b,
+    0x00, 0x6d, 0x06, 0x6b, 0x00, 0x74, 0x04, 0x66, 0x00, 0x74, 0x00, 0x3f, 0x51, 0x00, 0x00, 0x6a,
+    0x00, 0x65, 0x02, 0x66, 0x00, 0x72, 0x00, 0x4e, 0x00, 0x16, 0x0a, 0x08, 0x00, 0x05, 0x00, 0x5f,
+    0x00, 0x65, 0x02, 0x66, 0x00, 0x6a, 0x00, 0x57, 0x00, 0x1e, 0x06, 0x08, 0x00, 0x09, 0x00, 0x2a,
+    0x04, 0x66, 0x00, 0x72, 0x00, 0x4a, 0x00, 0x23, 0x03, 0x66, 0x00, 0x65, 0x00, 0x5f, 0x00, 0x10,
+    0x07, 0x00, 0x00, 0x34, 0x00, 0x74, 0x02, 0x66, 0x00, 0x72, 0x00, 0x4f, 0x0c, 0x06, 0x00, 0x01,
+    0x00, 0x52, 0x00, 0x72, 0x03, 0x66, 0x00, 0x5e, 0x00, 0x27, 0x09, 0x08, 0x00, 0x09, 0x00, 0x01,
+    0x00, 0x37, 0x00, 0x72, 0x03, 0x66, 0x00, 0x6a, 0x00, 0x38, 0x00, 0x0d, 0x06, 0x08, 0x00, 0x16,
+    0x00, 0x4e, 0x00, 0x72, 0x02, 0x66, 0x00, 0x65, 0x00, 0x6a, 0x02, 0x00, 0x00, 0x45, 0x00, 0x72,
+    0x03, 0x66, 0x00, 0x5e, 0x00, 0x0d, 0x05, 0x00, 0x00, 0x20, 0x00, 0x6a, 0x00, 0x65, 0x01, 0x66,
+    0x00, 0x72, 0x00, 0x54, 0x00, 0x03, 0x01, 0x00, 0x00, 0x01, 0x00, 0x54, 0x00, 0x72, 0x02, 0x66,
+    0x00, 0x6a, 0x00, 0x28, 0x00, 0x2a, 0x00, 0x75, 0x01, 0x65, 0x00, 0x72, 0x00, 0x3d, 0x0b, 0x19,
+    0x02, 0x1e, 0x00, 0x01, 0x00, 0x16, 0x04, 0x66, 0x00, 0x5a, 0x00, 0x1b, 0x00, 0x57, 0x00, 0x65,
+    0x02, 0x66, 0x00, 0x6a, 0x00, 0x5c, 0x00, 0x29, 0x07, 0x1e, 0x00, 0x3c, 0x04, 0x66, 0x00, 0x74,
+    0x00, 0x40, 0x00, 0x20, 0x00, 0x76, 0x00, 0x65, 0x02, 0x66, 0x00, 0x5f, 0x00, 0x22, 0x07, 0x1e,
+    0x00, 0x37, 0x04, 0x66, 0x00, 0x71, 0x00, 0x4a, 0x51, 0x00, 0x00, 0x6a, 0x00, 0x65, 0x01, 0x66,
+    0x00, 0x65, 0x00, 0x6d, 0x00, 0x1e, 0x0b, 0x00, 0x00, 0x02, 0x00, 0x5f, 0x00, 0x65, 0x01, 0x66,
+    0x00, 0x65, 0x00, 0x74, 0x00, 0x2c, 0x09, 0x00, 0x00, 0x3f, 0x00, 0x72, 0x02, 0x66, 0x00, 0x72,
+    0x00, 0x4a, 0x00, 0x23, 0x03, 0x66, 0x00, 0x65, 0x00, 0x5f, 0x00, 0x10, 0x07, 0x00, 0x00, 0x34,
+    0x00, 0x74, 0x02, 0x66, 0x00, 0x65, 0x00, 0x67, 0x0c, 0x5f, 0x00, 0x17, 0x00, 0x51, 0x00, 0x72,
+    0x02, 0x66, 0x00, 0x72, 0x00, 0x3b, 0x0c, 0x00, 0x00, 0x39, 0x00, 0x72, 0x02, 0x66, 0x00, 0x72,
+    0x00, 0x51, 0x09, 0x00, 0x00, 0x1e, 0x00, 0x75, 0x00, 0x65, 0x01, 0x66, 0x00, 0x65, 0x00, 0x6a,
+    0x02, 0x00, 0x00, 0x0d, 0x00, 0x5e, 0x03, 0x66, 0x00, 0x72, 0x00, 0x41, 0x04, 0x00, 0x00, 0x06,
+    0x00, 0x55, 0x00, 0x72, 0x02, 0x66, 0x00, 0x72, 0x00, 0x20, 0x02, 0x00, 0x00, 0x01, 0x00, 0x54,
+    0x00, 0x72, 0x02, 0x66, 0x00, 0x6a, 0x00, 0x28, 0x00, 0x25, 0x00, 0x75, 0x00, 0x65, 0x00, 0x66,
+    0x00, 0x72, 0x00, 0x3d, 0x00, 0x13, 0x03, 0x14, 0x05, 0x0c, 0x00, 0x09, 0x03, 0x00, 0x00, 0x18,
+    0x04, 0x66, 0x00, 0x5a, 0x00, 0x1b, 0x00, 0x57, 0x00, 0x65, 0x02, 0x66, 0x00, 0x72, 0x00, 0x30,
+    0x09, 0x00, 0x00, 0x4b, 0x00, 0x72, 0x02, 0x66, 0x00, 0x74, 0x00, 0x40, 0x00, 0x20, 0x00, 0x76,
+    0x00, 0x65, 0x01, 0x66, 0x00, 0x6a, 0x00, 0x5d, 0x09, 0x00, 0x00, 0x46, 0x00, 0x72, 0x02, 0x66,
+    0x00, 0x72, 0x00, 0x48, 0x51, 0x00, 0x00, 0x6a, 0x00, 0x65, 0x01, 0x66, 0x00, 0x65, 0x00, 0x6b,
+    0x00, 0x19, 0x0b, 0x00, 0x00, 0x02, 0x00, 0x5f, 0x00, 0x65, 0x01, 0x66, 0x00, 0x65, 0x00, 0x75,
+    0x00, 0x25, 0x09, 0x00, 0x00, 0x35, 0x00, 0x72, 0x02, 0x66, 0x00, 0x72, 0x00, 0x4a, 0x00, 0x23,
+    0x03, 0x66, 0x00, 0x65, 0x00, 0x5f, 0x00, 0x10, 0x07, 0x00, 0x00, 0x34, 0x00, 0x74, 0x03, 0x66,
+    0x0c, 0x65, 0x00, 0x66, 0x00, 0x19, 0x00, 0x51, 0x00, 0x72, 0x02, 0x66, 0x00, 0x74, 0x00, 0x2c,
+    0x0c, 0x00, 0x00, 0x39, 0x00, 0x72, 0x02, 0x66, 0x00, 0x72, 0x00, 0x51, 0x09, 0x00, 0x00, 0x19,
+    0x00, 0x6b, 0x00, 0x65, 0x01, 0x66, 0x00, 0x65, 0x00, 0x6a, 0x03, 0x00, 0x00, 0x37, 0x00, 0x74,
+    0x02, 0x66, 0x00, 0x65, 0x00, 0x6a, 0x00, 0x16, 0x03, 0x00, 0x00, 0x3f, 0x00, 0x74, 0x02, 0x66,
+    0x00, 0x72, 0x00, 0x47, 0x03, 0x00, 0x00, 0x01, 0x00, 0x54, 0x00, 0x72, 0x02, 0x66, 0x00, 0x6a,
+    0x00, 0x2a, 0x00, 0x06, 0x00, 0x5e, 0x00, 0x6a, 0x01, 0x66, 0x05, 0x72, 0x05, 0x75, 0x00, 0x67,
+    0x00, 0x48, 0x00, 0x0d, 0x01, 0x00, 0x00, 0x18, 0x04, 0x66, 0x00, 0x5a, 0x00, 0x1b, 0x00, 0x57,
+    0x00, 0x65, 0x03, 0x66, 0x00, 0x18, 0x09, 0x00, 0x00, 0x48, 0x00, 0x72, 0x02, 0x66, 0x00, 0x74,
+    0x00, 0x40, 0x00, 0x20, 0x00, 0x76, 0x00, 0x65, 0x01, 0x66, 0x00, 0x6a, 0x00, 0x5d, 0x00, 0x01,
+    0x08, 0x00, 0x00, 0x3a, 0x00, 0x72, 0x02, 0x66, 0x00, 0x72, 0x00, 0x48, 0x51, 0x00, 0x00, 0x6a,
+    0x00, 0x65, 0x01, 0x66, 0x00, 0x65, 0x00, 0x6b, 0x00, 0x1a, 0x0b, 0x00, 0x00, 0x02, 0x00, 0x5f,
+    0x00, 0x65, 0x01, 0x66, 0x00, 0x65, 0x00, 0x75, 0x00, 0x27, 0x09, 0x00, 0x00, 0x35, 0x00, 0x72,
+    0x02, 0x66, 0x00, 0x72, 0x00, 0x4a, 0x00, 0x23, 0x03, 0x66, 0x00, 0x65, 0x00, 0x5f, 0x00, 0x10,
+    0x07, 0x00, 0x00, 0x34, 0x00, 0x74, 0x11, 0x66, 0x00, 0x19, 0x00, 0x51, 0x00, 0x72, 0x02, 0x66,
+    0x00, 0x74, 0x00, 0x2d, 0x0c, 0x00, 0x00, 0x39, 0x00, 0x72, 0x02, 0x66, 0x00, 0x72, 0x00, 0x51,
+    0x09, 0x00, 0x00, 0x19, 0x00, 0x6b, 0x00, 0x65, 0x01, 0x66, 0x00, 0x65, 0x00, 0x6a, 0x03, 0x00,
+    0x00, 0x06, 0x00, 0x57, 0x00, 0x72, 0x02, 0x66, 0x00, 0x72, 0x00, 0x4c, 0x00, 0x01, 0x01, 0x00,
+    0x00, 0x20, 0x00, 0x6a, 0x00, 0x65, 0x01, 0x66, 0x00, 0x65, 0x00, 0x64, 0x00, 0x0d, 0x03, 0x00,
+    0x00, 0x01, 0x00, 0x54, 0x00, 0x72, 0x02, 0x66, 0x00, 0x6a, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x3f,
+    0x00, 0x74, 0x07, 0x66, 0x06, 0x65, 0x00, 0x74, 0x00, 0x5c, 0x00, 0x14, 0x00, 0x00, 0x00, 0x18,
+    0x04, 0x66, 0x00, 0x5a, 0x00, 0x1b, 0x00, 0x57, 0x00, 0x65, 0x03, 0x66, 0x00, 0x18, 0x09, 0x00,
+    0x00, 0x48, 0x00, 0x72, 0x02, 0x66, 0x00, 0x74, 0x00, 0x40, 0x00, 0x20, 0x00, 0x76, 0x00, 0x65,
+    0x01, 0x66, 0x00, 0x6a, 0x00, 0x5d, 0x00, 0x01, 0x08, 0x00, 0x00, 0x3d, 0x00, 0x72, 0x02, 0x66,
+    0x00, 0x72, 0x00, 0x48, 0x51, 0x00, 0x00, 0x6a, 0x00, 0x65, 0x01, 0x66, 0x00, 0x65, 0x00, 0x6b,
+    0x00, 0x1a, 0x0b, 0x00, 0x00, 0x02, 0x00, 0x5f, 0x00, 0x65, 0x01, 0x66, 0x00, 0x65, 0x00, 0x75,
+    0x00, 0x27, 0x09, 0x00, 0x00, 0x35, 0x00, 0x72, 0x02, 0x66, 0x00, 0x72, 0x00, 0x4a, 0x00, 0x23,
+    0x03, 0x66, 0x00, 0x65, 0x00, 0x5f, 0x00, 0x10, 0x07, 0x00, 0x00, 0x34, 0x00, 0x74, 0x04, 0x66,
+    0x0c, 0x72, 0x00, 0x1a, 0x00, 0x51, 0x00, 0x72, 0x02, 0x66, 0x00, 0x74, 0x00, 0x2d, 0x0c, 0x00,
+    0x00, 0x39, 0x00, 0x72, 0x02, 0x66, 0x00, 0x72, 0x00, 0x51, 0x09, 0x00, 0x00, 0x19, 0x00, 0x6b,
+    0x00, 0x65, 0x01, 0x66, 0x00, 0x65, 0x00, 0x6a, 0x04, 0x00, 0x00, 0x25, 0x00, 0x72, 0x00, 0x65,
+    0x01, 0x66, 0x00, 0x65, 0x00, 0x74, 0x00, 0x27, 0x00, 0x00, 0x00, 0x06, 0x00, 0x55, 0x00, 0x72,
+    0x02, 0x66, 0x00, 0x74, 0x00, 0x37, 0x04, 0x00, 0x00, 0x01, 0x00, 0x54, 0x00, 0x72, 0x02, 0x66,
+    0x00, 0x6a, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x56, 0x00, 0x74, 0x00, 0x65, 0x0d, 0x66,
+    0x00, 0x72, 0x00, 0x55, 0x00, 0x03, 0x00, 0x16, 0x04, 0x66, 0x00, 0x5a, 0x00, 0x1b, 0x00, 0x57,
+    0x00, 0x65, 0x03, 0x66, 0x00, 0x18, 0x09, 0x00, 0x00, 0x48, 0x00, 0x72, 0x02, 0x66, 0x00, 0x74,
+    0x00, 0x40, 0x00, 0x20, 0x00, 0x76, 0x00, 0x65, 0x01, 0x66, 0x00, 0x6a, 0x00, 0x5d, 0x00, 0x01,
+    0x08, 0x00, 0x00, 0x3d, 0x00, 0x72, 0x02, 0x66, 0x00, 0x72, 0x00, 0x48, 0x51, 0x00, 0x00, 0x6a,
+    0x00, 0x65, 0x01, 0x66, 0x00, 0x65, 0x00, 0x6b, 0x00, 0x19, 0x0b, 0x00, 0x00, 0x02, 0x00, 0x5f,
+    0x00, 0x65, 0x01, 0x66, 0x00, 0x65, 0x00, 0x75, 0x00, 0x25, 0x09, 0x00, 0x00, 0x35, 0x00, 0x72,
+    0x02, 0x66, 0x00, 0x72, 0x00, 0x4a, 0x00, 0x23, 0x03, 0x66, 0x00, 0x65, 0x00, 0x5f, 0x00, 0x0e,
+    0x07, 0x00, 0x00, 0x34, 0x00, 0x74, 0x03, 0x66, 0x00, 0x5f, 0x0b, 0x4a, 0x00, 0x46, 0x00, 0x10,
+    0x00, 0x51, 0x00, 0x72, 0x02, 0x66, 0x00, 0x74, 0x00, 0x2c, 0x0c, 0x00, 0x00, 0x39, 0x00, 0x72,
+    0x02, 0x66, 0x00, 0x72, 0x00, 0x51, 0x09, 0x00, 0x00, 0x19, 0x00, 0x6b, 0x00, 0x65, 0x01, 0x66,
+    0x00, 0x65, 0x00, 0x6a, 0x05, 0x00, 0x00, 0x49, 0x00, 0x72, 0x02, 0x66, 0x00, 0x72, 0x00, 0x57,
+    0x00, 0x03, 0x00, 0x3f, 0x00, 0x74, 0x02, 0x66, 0x00, 0x72, 0x00, 0x57, 0x00, 0x06, 0x04, 0x00,
+    0x00, 0x01, 0x00, 0x54, 0x00, 0x72, 0x02, 0x66, 0x00, 0x6a, 0x00, 0x2a, 0x01, 0x00, 0x00, 0x07,
+    0x00, 0x43, 0x00, 0x6b, 0x0b, 0x72, 0x01, 0x66, 0x00, 0x65, 0x00, 0x74, 0x00, 0x29, 0x00, 0x15,
+    0x04, 0x66, 0x00, 0x5a, 0x00, 0x1b, 0x00, 0x57, 0x00, 0x65, 0x03, 0x66, 0x00, 0x18, 0x09, 0x00,
+    0x00, 0x48, 0x00, 0x72, 0x02, 0x66, 0x00, 0x74, 0x00, 0x40, 0x00, 0x20, 0x00, 0x76, 0x00, 0x65,
+    0x01, 0x66, 0x00, 0x6a, 0x00, 0x5d, 0x00, 0x01, 0x08, 0x00, 0x00, 0x3d, 0x00, 0x72, 0x02, 0x66,
+    0x00, 0x72, 0x00, 0x48, 0x51, 0x00, 0x00, 0x6a, 0x00, 0x65, 0x01, 0x66, 0x00, 0x65, 0x00, 0x75,
+    0x00, 0x20, 0x0b, 0x00, 0x00, 0x02, 0x00, 0x5f, 0x00, 0x65, 0x02, 0x66, 0x00, 0x74, 0x00, 0x30,
+    0x09, 0x00, 0x00, 0x43, 0x00, 0x72, 0x02, 0x66, 0x00, 0x72, 0x00, 0x4a, 0x00, 0x24, 0x03, 0x66,
+    0x00, 0x65, 0x00, 0x6b, 0x00, 0x15, 0x07, 0x00, 0x00, 0x34, 0x00, 0x74, 0x02, 0x66, 0x00, 0x72,
+    0x00, 0x56, 0x0d, 0x00, 0x00, 0x52, 0x00, 0x72, 0x02, 0x66, 0x00, 0x72, 0x00, 0x40, 0x0c, 0x00,
+    0x00, 0x3b, 0x00, 0x72, 0x02, 0x66, 0x00, 0x72, 0x00, 0x56, 0x09, 0x00, 0x00, 0x25, 0x00, 0x75,
+    0x00, 0x65, 0x01, 0x66, 0x00, 0x65, 0x00, 0x6a, 0x05, 0x00, 0x00, 0x14, 0x05, 0x66, 0x00, 0x4a,
+    0x00, 0x5e, 0x00, 0x65, 0x02, 0x66, 0x00, 0x72, 0x00, 0x25, 0x05, 0x00, 0x00, 0x01, 0x00, 0x54,
+    0x00, 0x72, 0x02, 0x66, 0x00, 0x6a, 0x00, 0x2a, 0x03, 0x00, 0x00, 0x0d, 0x00, 0x1f, 0x09, 0x2a,
+    0x00, 0x49, 0x00, 0x72, 0x01, 0x66, 0x00, 0x72, 0x00, 0x40, 0x00, 0x17, 0x04, 0x66, 0x00, 0x5a,
+    0x00, 0x1b, 0x00, 0x57, 0x00, 0x65, 0x02, 0x66, 0x00, 0x72, 0x00, 0x2e, 0x09, 0x00, 0x00, 0x4a,
+    0x00, 0x72, 0x02, 0x66, 0x00, 0x74, 0x00, 0x40, 0x00, 0x20, 0x00, 0x76, 0x00, 0x65, 0x01, 0x66,
+    0x00, 0x6a, 0x00, 0x5d, 0x00, 0x01, 0x08, 0x00, 0x00, 0x3d, 0x00, 0x72, 0x02, 0x66, 0x00, 0x72,
+    0x00, 0x48, 0x51, 0x00, 0x00, 0x6a, 0x00, 0x65, 0x02, 0x66, 0x00, 0x72, 0x00, 0x55, 0x00, 0x25,
+    0x09, 0x1e, 0x00, 0x19, 0x00, 0x06, 0x00, 0x5f, 0x00, 0x65, 0x02, 0x66, 0x00, 0x65, 0x00, 0x5e,
+    0x00, 0x2e, 0x07, 0x1e, 0x00, 0x37, 0x00, 0x6b, 0x00, 0x65, 0x02, 0x66, 0x00, 0x72, 0x00, 0x4a,
+    0x00, 0x1e, 0x04, 0x66, 0x00, 0x72, 0x00, 0x4e, 0x00, 0x20, 0x05, 0x1e, 0x00, 0x16, 0x00, 0x35,
+    0x00, 0x74, 0x03, 0x66, 0x00, 0x6a, 0x00, 0x41, 0x00, 0x20, 0x0a, 0x1e, 0x00, 0x06, 0x00, 0x52,
+    0x00, 0x71, 0x02, 0x66, 0x00, 0x65, 0x00, 0x6b, 0x00, 0x37, 0x09, 0x1e, 0x00, 0x20, 0x00, 0x07,
+    0x00, 0x37, 0x00, 0x72, 0x03, 0x66, 0x00, 0x6a, 0x00, 0x3f, 0x00, 0x20, 0x06, 0x1e, 0x00, 0x27,
+    0x00, 0x55, 0x00, 0x72, 0x02, 0x66, 0x00, 0x65, 0x00, 0x6b, 0x06, 0x00, 0x00, 0x3d, 0x00, 0x72,
+    0x03, 0x66, 0x00, 0x72, 0x03, 0x66, 0x00, 0x72, 0x00, 0x49, 0x06, 0x00, 0x00, 0x01, 0x00, 0x54,
+    0x00, 0x72, 0x02, 0x66, 0x00, 0x6a, 0x00, 0x2a, 0x00, 0x00, 0x02, 0x08, 0x00, 0x06, 0x00, 0x04,
+    0x08, 0x03, 0x00, 0x04, 0x00, 0x37, 0x00, 0x74, 0x01, 0x66, 0x00, 0x71, 0x00, 0x4f, 0x00, 0x1e,
+    0x04, 0x66, 0x00, 0x5a, 0x00, 0x1b, 0x00, 0x57, 0x00, 0x65, 0x02, 0x66, 0x00, 0x72, 0x00, 0x58,
+    0x00, 0x20, 0x06, 0x08, 0x00, 0x09, 0x00, 0x2e, 0x04, 0x66, 0x00, 0x74, 0x00, 0x40, 0x00, 0x20,
+    0x00, 0x76, 0x00, 0x65, 0x01, 0x66, 0x00, 0x6a, 0x00, 0x5d, 0x00, 0x01, 0x08, 0x00, 0x00, 0x3d,
+    0x00, 0x72, 0x02, 0x66, 0x00, 0x72, 0x00, 0x48, 0x51, 0x00, 0x00, 0x6d, 0x00, 0x65, 0x03, 0x66,
+    0x00, 0x72, 0x00, 0x75, 0x00, 0x6d, 0x07, 0x6b, 0x00, 0x6d, 0x00, 0x62, 0x00, 0x09, 0x00, 0x51,
+    0x00, 0x71, 0x03, 0x66, 0x00, 0x65, 0x00, 0x74, 0x00, 0x6d, 0x04, 0x6b, 0x01, 0x6d, 0x00, 0x74,
+    0x00, 0x65, 0x03, 0x66, 0x00, 0x74, 0x00, 0x3d, 0x00, 0x09, 0x00, 0x6a, 0x00, 0x65, 0x03, 0x66,
+    0x00, 0x72, 0x00, 0x75, 0x04, 0x6b, 0x00, 0x6d, 0x00, 0x5f, 0x00, 0x3a, 0x00, 0x74, 0x00, 0x65,
+    0x03, 0x66, 0x00, 0x72, 0x01, 0x6d, 0x09, 0x6b, 0x00, 0x17, 0x00, 0x41, 0x00, 0x72, 0x03, 0x66,
+    0x00, 0x65, 0x00, 0x74, 0x00, 0x6d, 0x08, 0x6b, 0x00, 0x77, 0x00, 0x31, 0x00, 0x2c, 0x00, 0x74,
+    0x04, 0x66, 0x00, 0x72, 0x00, 0x6d, 0x06, 0x6b, 0x00, 0x75, 0x00, 0x72, 0x03, 0x66, 0x00, 0x65,
+    0x00, 0x6e, 0x06, 0x00, 0x00, 0x07, 0x00, 0x5a, 0x00, 0x72, 0x06, 0x66, 0x00, 0x65, 0x00, 0x67,
+    0x00, 0x14, 0x06, 0x00, 0x00, 0x01, 0x00, 0x54, 0x00, 0x72, 0x02, 0x66, 0x00, 0x6a, 0x00, 0x2a,
+    0x00, 0x06, 0x00, 0x55, 0x00, 0x5c, 0x0c, 0x5a, 0x00, 0x6a, 0x02, 0x66, 0x00, 0x72, 0x00, 0x3e,
+    0x00, 0x17, 0x04, 0x66, 0x00, 0x5c, 0x00, 0x10, 0x00, 0x4d, 0x00, 0x72, 0x03, 0x66, 0x00, 0x72,
+    0x00, 0x6b, 0x06, 0x5a, 0x00, 0x5c, 0x00, 0x72, 0x04, 0x66, 0x00, 0x74, 0x00, 0x3f, 0x00, 0x22,
+    0x00, 0x76, 0x00, 0x65, 0x01, 0x66, 0x00, 0x6a, 0x00, 0x5d, 0x00, 0x01, 0x08, 0x00, 0x00, 0x3d,
+    0x00, 0x72, 0x02, 0x66, 0x00, 0x72, 0x00, 0x48, 0x51, 0x00, 0x00, 0x48, 0x00, 0x72, 0x04, 0x66,
+    0x0a, 0x65, 0x00, 0x67, 0x00, 0x03, 0x00, 0x2f, 0x00, 0x74, 0x04, 0x66, 0x08, 0x65, 0x04, 0x66,
+    0x00, 0x65, 0x00, 0x72, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x72, 0x04, 0x66, 0x06, 0x65,
+    0x00, 0x61, 0x00, 0x16, 0x00, 0x5e, 0x05, 0x66, 0x0a, 0x65, 0x00, 0x66, 0x00, 0x12, 0x00, 0x1f,
+    0x00, 0x74, 0x05, 0x66, 0x09, 0x65, 0x00, 0x72, 0x00, 0x33, 0x00, 0x0d, 0x00, 0x66, 0x00, 0x65,
+    0x04, 0x66, 0x08, 0x65, 0x04, 0x66, 0x00, 0x72, 0x00, 0x44, 0x07, 0x00, 0x00, 0x29, 0x00, 0x74,
+    0x06, 0x66, 0x00, 0x74, 0x00, 0x3d, 0x07, 0x00, 0x00, 0x01, 0x00, 0x54, 0x00, 0x72, 0x02, 0x66,
+    0x00, 0x6a, 0x00, 0x2a, 0x00, 0x07, 0x00, 0x5e, 0x0d, 0x72, 0x00, 0x65, 0x01, 0x66, 0x00, 0x65,
+    0x00, 0x74, 0x00, 0x27, 0x00, 0x15, 0x04, 0x66, 0x00, 0x5c, 0x00, 0x08, 0x00, 0x3d, 0x00, 0x74,
+    0x04, 0x66, 0x00, 0x65, 0x06, 0x72, 0x00, 0x6a, 0x00, 0x65, 0x03, 0x66, 0x00, 0x65, 0x00, 0x6a,
+    0x00, 0x16, 0x00, 0x25, 0x00, 0x76, 0x00, 0x65, 0x01, 0x66, 0x00, 0x6a, 0x00, 0x5d, 0x00, 0x01,
+    0x08, 0x00, 0x00, 0x3d, 0x00, 0x72, 0x02, 0x66, 0x00, 0x72, 0x00, 0x48, 0x51, 0x00, 0x00, 0x11,
+    0x00, 0x67, 0x00, 0x72, 0x0d, 0x66, 0x00, 0x65, 0x00, 0x67, 0x00, 0x06, 0x00, 0x05, 0x00, 0x55,
+    0x00, 0x72, 0x10, 0x66, 0x00, 0x65, 0x00, 0x74, 0x00, 0x49, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1d,
+    0x00, 0x6b, 0x00, 0x65, 0x09, 0x66, 0x00, 0x65, 0x00, 0x67, 0x00, 0x06, 0x00, 0x37, 0x00, 0x74,
+    0x00, 0x65, 0x0f, 0x66, 0x00, 0x16, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x74, 0x00, 0x65, 0x0d, 0x66,
+    0x00, 0x72, 0x00, 0x36, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x74, 0x00, 0x65, 0x10, 0x66, 0x00, 0x72,
+    0x00, 0x61, 0x00, 0x0d, 0x08, 0x00, 0x00, 0x4e, 0x00, 0x72, 0x04, 0x66, 0x00, 0x72, 0x00, 0x5c,
+    0x00, 0x06, 0x07, 0x00, 0x00, 0x01, 0x00, 0x54, 0x00, 0x72, 0x02, 0x66, 0x00, 0x6a, 0x00, 0x2a,
+    0x00, 0x06, 0x00, 0x5c, 0x00, 0x6a, 0x0f, 0x66, 0x00, 0x72, 0x00, 0x4e, 0x00, 0x01, 0x00, 0x16,
+    0x04, 0x66, 0x00, 0x5c, 0x00, 0x09, 0x00, 0x0a, 0x00, 0x5c, 0x00, 0x72, 0x10, 0x66, 0x00, 0x65,
+    0x00, 0x74, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x27, 0x00, 0x76, 0x00, 0x65, 0x01, 0x66, 0x00, 0x6a,
+    0x00, 0x5d, 0x00, 0x01, 0x08, 0x00, 0x00, 0x3d, 0x00, 0x72, 0x02, 0x66, 0x00, 0x72, 0x00, 0x48,
+    0x52, 0x00, 0x00, 0x25, 0x00, 0x5f, 0x00, 0x74, 0x0d, 0x65, 0x00, 0x67, 0x00, 0x06, 0x00, 0x00,
+    0x00, 0x11, 0x00, 0x55, 0x00, 0x74, 0x0e, 0x65, 0x00, 0x71, 0x00, 0x75, 0x00, 0x4c, 0x00, 0x06,
+    0x02, 0x00, 0x00, 0x2c, 0x00, 0x67, 0x00, 0x72, 0x09, 0x65, 0x00, 0x67, 0x00, 0x06, 0x00, 0x01,
+    0x00, 0x44, 0x01, 0x72, 0x0d, 0x65, 0x00, 0x66, 0x00, 0x16, 0x00, 0x00, 0x00, 0x07, 0x00, 0x4e,
+    0x00, 0x74, 0x00, 0x71, 0x0c, 0x65, 0x00, 0x72, 0x00, 0x38, 0x00, 0x00, 0x00, 0x02, 0x00, 0x44,
+    0x00, 0x74, 0x00, 0x71, 0x0e, 0x65, 0x00, 0x74, 0x00, 0x5f, 0x00, 0x20, 0x09, 0x00, 0x00, 0x16,
+    0x00, 0x6a, 0x04, 0x65, 0x00, 0x74, 0x00, 0x29, 0x08, 0x00, 0x00, 0x01, 0x00, 0x53, 0x00, 0x71,
+    0x02, 0x65, 0x00, 0x6a, 0x00, 0x2a, 0x00, 0x06, 0x00, 0x5b, 0x00, 0x69, 0x0e, 0x65, 0x00, 0x74,
+    0x00, 0x55, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x18, 0x00, 0x66, 0x03, 0x65, 0x00, 0x5c, 0x00, 0x0d,
+    0x00, 0x00, 0x00, 0x1d, 0x00, 0x5e, 0x00, 0x72, 0x0f, 0x65, 0x00, 0x74, 0x00, 0x56, 0x00, 0x0b,
+    0x00, 0x00, 0x00, 0x27, 0x00, 0x76, 0x02, 0x65, 0x00, 0x69, 0x00, 0x5d, 0x00, 0x01, 0x08, 0x00,
+    0x00, 0x3d, 0x00, 0x72, 0x02, 0x65, 0x00, 0x71, 0x00, 0x48, 0x53, 0x00, 0x00, 0x0f, 0x00, 0x3f,
+    0x00, 0x62, 0x0c, 0x6e, 0x00, 0x63, 0x00, 0x06, 0x01, 0x00, 0x00, 0x07, 0x00, 0x3a, 0x00, 0x60,
+    0x0d, 0x6e, 0x00, 0x56, 0x00, 0x2e, 0x00, 0x01, 0x04, 0x00, 0x00, 0x16, 0x00, 0x44, 0x00, 0x63,
+    0x08, 0x6e, 0x00, 0x63, 0x00, 0x06, 0x01, 0x00, 0x00, 0x25, 0x00, 0x4f, 0x0e, 0x6e, 0x00, 0x16,
+    0x01, 0x00, 0x00, 0x03, 0x00, 0x30, 0x00, 0x59, 0x0c, 0x6e, 0x00, 0x77, 0x00, 0x33, 0x02, 0x00,
+    0x00, 0x27, 0x00, 0x4f, 0x0d, 0x6e, 0x00, 0x62, 0x00, 0x3f, 0x00, 0x0d, 0x0b, 0x00, 0x00, 0x3f,
+    0x00, 0x75, 0x02, 0x6b, 0x00, 0x75, 0x00, 0x4e, 0x00, 0x01, 0x08, 0x00, 0x00, 0x01, 0x00, 0x55,
+    0x00, 0x75, 0x02, 0x6b, 0x00, 0x75, 0x00, 0x2a, 0x00, 0x06, 0x00, 0x5e, 0x00, 0x75, 0x0d, 0x6b,
+    0x00, 0x6c, 0x00, 0x3f, 0x00, 0x07, 0x01, 0x00, 0x00, 0x19, 0x03, 0x6b, 0x00, 0x75, 0x00, 0x5f,
+    0x00, 0x0d, 0x01, 0x00, 0x00, 0x11, 0x00, 0x4a, 0x00, 0x6e, 0x00, 0x6a, 0x0b, 0x6b, 0x00, 0x6a,
+    0x00, 0x68, 0x00, 0x3c, 0x00, 0x06, 0x01, 0x00, 0x00, 0x27, 0x00, 0x77, 0x00, 0x6a, 0x01, 0x6b,
+    0x00, 0x75, 0x00, 0x5f, 0x00, 0x01, 0x08, 0x00, 0x00, 0x3d, 0x00, 0x75, 0x02, 0x6b, 0x00, 0x75,
+    0x00, 0x4a, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
+    0xff, 0x00, 0xff, 0x00, 0x05, 0x00,
 #endif /* GNW_TARGET_ZELDA */
 };
@@ -1,73 +1,300 @@
+// Packed bitmap, see bitmaps.h. Generated by tools/img2bin.py --lut8-rle
 #if !defined(GNW_TARGET_ZELDA)
 #define GNW_TARGET_ZELDA 0
 #endif /* GNW_TARGET_ZELDA */
 
-const unsigned short header_gb[] = {
+const unsigned char header_gb[] __attribute__((aligned(4))) = {
 #if GNW_TARGET_ZELDA != 0
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0B20,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0B20,0x0B20,0x0B20,0x0B20,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0B20,0x0B20,0x0B20,0x0320,0x0320,0x0320,0x0320,0x0320,0x0B20,0x0B20,0x0B20,0x0B20,0x0320,0x0320,0x0320,0x1320,0x1B41,0x1B41,0x1B41,0x1B41,0x1B41,0x1B41,0x1B41,0x1B41,0x1320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0B20,0x0B20,0x0B20,0x0B20,0x0B20,0x0B20,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0B20,0x0B20,0x0320,0x0320,0x0320,0x0B20,0x0B20,0x0B20,0x0B20,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x3361,0x6BA3,0x93E5,0xB425,0xBC26,0xBC26,0xAC05,0x93E4,0x2341,0x0320,0x0320,0x3361,0xC446,0xBC26,0xBC26,0xC446,0x93E4,0x0320,0x0320,0x0320,0x0320,0x0320,0x83C4,0xC446,0xBC26,0xC446,0x2B61,0x0320,0x0320,0x0320,0x4382,0xC446,0xBC26,0xBC26,0xB406,0x1320,0x0320,0x0320,0x8BE4,0xD467,0xCC46,0xCC46,0xCC46,0xCC46,0xCC46,0xCC46,0xDC67,0x5B83,0x0320,0x0320,0x0320,0x0320,0x8BE4,0xC446,0xBC26,0xBC26,0xBC26,0xBC26,0xBC26,0x9C05,0x5382,0x0320,0x0320,0x0320,0x0320,0x0320,0x0B20,0x5BA3,0x9C05,0xBC26,0xC426,0xB426,0x83E4,0x2341,0x3361,0xC446,0xBC26,0xC446,0x6BA3,0x0320,0x0320,0x0320,0x1320,0xAC05,0xB426,0xBC26,0x9BE5,0x0B20,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x4B82,0xAC25,0xD447,0xDC87,0xDC87,0xDC67,0xDC67,0xDC67,0xDC67,0xE487,0x3361,0x0320,0x0320,0x8BE4,0xE487,0xDC67,0xDC67,0xDC87,0xB426,0x0320,0x0320,0x0320,0x0320,0x1320,0xC446,0xDC67,0xDC67,0xE487,0x5383,0x0320,0x0320,0x0320,0x9C05,0xDC87,0xDC67,0xDC67,0xCC46,0x1B40,0x0320,0x0320,0xAC05,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC67,0x3B62,0x0320,0x0320,0x0320,0x0320,0xB426,0xDC87,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC87,0x7BC4,0x0320,0x0320,0x0320,0x2341,0xAC25,0xDC87,0xDC67,0xDC67,0xD467,0xDC67,0xDC87,0xCC46,0x4B82,0xAC05,0xDC87,0xDC67,0xC426,0x0B20,0x0320,0x0320,0x83C4,0xE487,0xDC67,0xDC87,0x4382,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1320,0x93E5,0xDC67,0xDC67,0xD447,0xD467,0xDC87,0xDC87,0xDC67,0xDC67,0xDC87,0xD447,0x1B41,0x0320,0x1B40,0xCC46,0xD447,0xD447,0xD447,0xD467,0xC426,0x0B20,0x0320,0x0320,0x0320,0x4B82,0xDC67,0xD447,0xD447,0xDC87,0x7BC4,0x0320,0x0320,0x2341,0xD447,0xD447,0xD447,0xD447,0xCC46,0x1B41,0x0320,0x0B20,0xC426,0xD467,0xD447,0xDC67,0xDC87,0xDC87,0xDC87,0xDC87,0xD447,0x1B41,0x0320,0x0320,0x0320,0x1320,0xC426,0xD467,0xD447,0xDC67,0xDC87,0xDC87,0xD467,0xD447,0xD447,0xDC67,0x3B62,0x0320,0x1B40,0xBC26,0xDC87,0xD447,0xDC67,0xDC87,0xDC67,0xDC67,0xD447,0xDC67,0xC426,0x7BC4,0xDC67,0xD447,0xDC87,0x5BA3,0x0320,0x3B62,0xD467,0xD447,0xDC87,0x8BE4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1320,0xA405,0xE487,0xD447,0xD447,0xDC87,0xC426,0x8BE4,0x5BA3,0x4382,0x4B82,0x63A3,0x7BC4,0x0B20,0x0320,0x63A3,0xDC87,0xD447,0xD447,0xD447,0xD447,0xCC46,0x1B41,0x0320,0x0320,0x0320,0x93E4,0xDC87,0xD447,0xD447,0xDC67,0x9BE5,0x0320,0x0320,0x6BA3,0xDC87,0xD447,0xD447,0xD447,0xD447,0x2341,0x0320,0x2341,0xD446,0xD447,0xD467,0xA405,0x83C4,0x83C4,0x83C4,0x8BE4,0x7BC4,0x0320,0x0320,0x0320,0x0320,0x2341,0xD447,0xD447,0xD467,0xA405,0x83C4,0x8BE4,0xC426,0xD467,0xD447,0xDC87,0x73C3,0x0320,0x8BE4,0xDC87,0xD447,0xDC67,0xAC05,0x5BA3,0x4382,0x8BE4,0xDC67,0xD447,0xDC87,0x93E5,0xB426,0xDC67,0xDC67,0xB405,0x1320,0xB406,0xDC67,0xDC67,0xC446,0x1340,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x8BE4,0xE487,0xD447,0xD467,0xD447,0x6BC3,0x1320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xAC05,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0x2B41,0x0320,0x0320,0x1320,0xC426,0xD467,0xD447,0xD447,0xDC67,0xB426,0x0320,0x0B20,0xBC26,0xDC67,0xD447,0xD447,0xD447,0xD467,0x2B61,0x0320,0x3B62,0xDC67,0xD447,0xD467,0x2B61,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x3B62,0xDC67,0xD447,0xDC67,0x3B62,0x0320,0x0320,0x3B62,0xDC67,0xD447,0xDC87,0x6BA3,0x2341,0xD467,0xD447,0xDC67,0x93E5,0x0B20,0x0320,0x0320,0x0320,0x9BE5,0xDC67,0xD467,0xB426,0x7BC4,0xDC87,0xD447,0xD447,0xAC05,0xD467,0xD447,0xDC67,0x5382,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x3361,0xD467,0xD447,0xD467,0xD446,0x3B62,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x3B62,0xDC67,0xD447,0xD447,0x9BE5,0xD446,0xD447,0xDC67,0x3B62,0x0320,0x0320,0x4382,0xDC67,0xD447,0xD447,0xD447,0xD447,0xCC46,0x1320,0x3B62,0xDC67,0xD447,0xD447,0xD447,0xD447,0xDC67,0x3361,0x0320,0x5382,0xDC87,0xD447,0xCC46,0x2341,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x5382,0xDC87,0xD447,0xCC46,0x1B41,0x0320,0x0320,0x63A3,0xDC67,0xD447,0xDC87,0x4362,0x6BA3,0xDC87,0xD447,0xCC46,0x1340,0x0320,0x0320,0x0320,0x0320,0x4B82,0xDC67,0xD447,0xD446,0x4362,0xC426,0xD447,0xD447,0xDC67,0xD447,0xDC87,0x9BE5,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x83C4,0xDC87,0xD447,0xDC67,0x4B82,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x8BE4,0xDC87,0xD467,0xBC26,0x4382,0xD447,0xD447,0xDC87,0x5382,0x0320,0x0320,0x8BE4,0xDC87,0xD447,0xD467,0xD447,0xD447,0xDC67,0x2B61,0x8BE4,0xDC67,0xD447,0xD447,0xD447,0xD447,0xDC67,0x4362,0x0320,0x73C4,0xDC87,0xD447,0xD447,0xBC26,0xB426,0xB426,0xBC26,0x9BE5,0x0320,0x0320,0x0320,0x0320,0x0320,0x73C3,0xDC87,0xD447,0xCC46,0x9C05,0x9BE5,0xAC05,0xD447,0xD447,0xDC67,0xB405,0x0B20,0xAC05,0xDC67,0xDC87,0x8BE4,0x0320,0x0320,0x0320,0x0320,0x0320,0x3361,0xD447,0xD447,0xDC67,0x3361,0x7BC4,0xDC87,0xD447,0xD447,0xD467,0xCC46,0x1B41,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xB406,0xDC67,0xDC67,0x9C05,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1B40,0xCC46,0xD447,0xDC67,0x83C4,0x2341,0xCC46,0xD447,0xDC87,0x6BA3,0x0320,0x1320,0xC426,0xD467,0xD447,0xBC26,0xD446,0xD447,0xDC67,0x73C4,0xC426,0xD447,0xDC67,0xA405,0xC426,0xD447,0xDC67,0x4B82,0x0320,0x93E5,0xDC67,0xD447,0xD447,0xDC67,0xDC67,0xDC67,0xE487,0xA405,0x0320,0x0320,0x0320,0x0320,0x0320,0x8BE4,0xDC87,0xD447,0xD447,0xDC67,0xDC67,0xDC67,0xD447,0xD447,0xDC67,0x4382,0x0320,0xC426,0xD467,0xDC87,0x5BA3,0x0320,0x0320,0x0320,0x0320,0x0320,0x3361,0xD447,0xD447,0xDC67,0x3361,0x2341,0xD446,0xD447,0xD447,0xDC67,0x5BA3,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xCC46,0xD447,0xDC87,0x5B83,0x0320,0x0320,0x1320,0x9BE5,0xA405,0xA405,0xA405,0xA405,0xA405,0x1320,0x5BA3,0xDC87,0xD447,0xD447,0xBC26,0xB406,0xD447,0xD447,0xDC87,0x83C4,0x0320,0x4382,0xDC67,0xD447,0xD447,0x63A3,0xC446,0xD447,0xD447,0xCC26,0xD447,0xD447,0xD467,0x4382,0xBC26,0xD467,0xDC87,0x5383,0x0320,0xAC05,0xDC67,0xD447,0xDC67,0xDC67,0xDC67,0xDC67,0xE4A7,0x7BC4,0x0320,0x0320,0x0320,0x0320,0x0320,0xAC05,0xDC67,0xD447,0xDC67,0xDC67,0xDC67,0xDC67,0xD447,0xD447,0xDC67,0xA405,0x2B41,0xCC46,0xD447,0xDC67,0x4362,0x0320,0x0320,0x0320,0x0320,0x0320,0x4382,0xDC67,0xD447,0xD447,0x2B41,0x0B20,0xC426,0xD447,0xDC67,0xA405,0x0320,0x0320,0x0320,0x0320,0x0320,0x0300,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xD447,0xD447,0xDC87,0x5B83,0x0320,0x0320,0x2341,0xD447,0xDC67,0xDC67,0xDC67,0xDC67,0xD447,0x1B41,0xAC05,0xDC67,0xD447,0xD447,0xD467,0xDC67,0xD447,0xD447,0xDC67,0x93E5,0x0320,0x8BE4,0xDC87,0xD447,0xC426,0x1B41,0xBC26,0xDC67,0xD447,0xD447,0xD447,0xDC67,0xAC05,0x0B20,0xBC26,0xDC67,0xDC87,0x5BA3,0x0320,0xC426,0xD467,0xD447,0xBC26,0xAC05,0xAC05,0xAC05,0xB426,0x4B82,0x0320,0x0320,0x0320,0x0320,0x0B20,0xBC26,0xD467,0xD447,0xBC26,0xA405,0xA405,0xAC05,0xD446,0xD447,0xD447,0xD447,0x63A3,0xCC46,0xD447,0xDC67,0x3B62,0x0320,0x0320,0x0320,0x0320,0x0320,0x73C3,0xDC87,0xD447,0xC446,0x0B20,0x2341,0xD446,0xD447,0xDC87,0x6BA3,0x0320,0x0320,0x0320,0x0320,0x0320,0x0AE0,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xCC26,0xD447,0xDC67,0x9BE5,0x0320,0x0320,0x3361,0xDC87,0xDC67,0xD447,0xD447,0xD467,0xBC26,0x4382,0xD467,0xD447,0xD447,0xDC67,0xDC67,0xDC67,0xD467,0xD447,0xDC67,0xA405,0x1320,0xC426,0xD467,0xDC87,0x8BE4,0x0320,0x9C05,0xDC67,0xD447,0xD447,0xD447,0xDC87,0x5BA3,0x0320,0xAC05,0xDC67,0xDC87,0x63A3,0x1B40,0xCC46,0xD447,0xDC67,0x4382,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1B41,0xCC46,0xD447,0xDC67,0x3B62,0x0320,0x0320,0x0320,0x5BA3,0xDC67,0xD447,0xDC67,0x7BC4,0xC446,0xD447,0xDC87,0x5B83,0x0320,0x0320,0x0320,0x0320,0x0B20,0xBC26,0xDC67,0xDC67,0x9C05,0x0320,0x3B62,0xDC67,0xD447,0xDC87,0x5382,0x0320,0x0320,0x0320,0x0320,0x0320,0x0B00,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xA405,0xDC67,0xD447,0xDC67,0x5383,0x0320,0x0B20,0x3B82,0x3B61,0x9C05,0xDC67,0xDC67,0xAC05,0x8BE4,0xDC87,0xDC67,0xBC26,0x3361,0x3361,0x3361,0x8BE4,0xDC67,0xDC67,0xB405,0x4B82,0xDC67,0xD447,0xDC87,0x4B82,0x0320,0x7BC4,0xDC87,0xD447,0xD447,0xD467,0xC446,0x1320,0x0320,0xA405,0xDC67,0xDC87,0x6BA3,0x3361,0xDC67,0xD447,0xD467,0x2B41,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x3361,0xD467,0xD447,0xCC46,0x1320,0x0320,0x0320,0x0320,0x5BA3,0xDC67,0xD447,0xDC67,0x5B83,0xBC26,0xD467,0xDC67,0xAC05,0x0320,0x0320,0x0320,0x0320,0x8BE4,0xDC67,0xD447,0xDC87,0x4B82,0x0320,0x5B83,0xDC87,0xD447,0xDC67,0x3361,0x0320,0x0320,0x0320,0x0320,0x0320,0x0300,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x5382,0xDC87,0xD447,0xD447,0xD467,0x7BC4,0x3B61,0x2B41,0x4B82,0xBC26,0xDC67,0xD467,0xBC26,0xC426,0xD447,0xDC87,0x73A3,0x0320,0x0320,0x0320,0x5BA3,0xDC87,0xD447,0xC426,0x9BE5,0xDC67,0xD447,0xCC46,0x1320,0x0320,0x5382,0xDC87,0xD447,0xD447,0xDC87,0x83C4,0x0320,0x0320,0x93E5,0xDC87,0xDC87,0x73C4,0x4B82,0xDC87,0xD447,0xD447,0x83C4,0x73C3,0x73C3,0x73C3,0x73C4,0x4382,0x0320,0x0320,0x0320,0x0320,0x4B82,0xDC87,0xD447,0xCC46,0x7BC4,0x73C4,0x73C4,0x8BE4,0xCC46,0xD447,0xD447,0xD447,0x1B41,0x8BE4,0xDC87,0xD447,0xDC67,0x9C05,0x4B82,0x5382,0xA405,0xDC67,0xD447,0xDC87,0x9C05,0x0320,0x0320,0x73C4,0xDC87,0xD447,0xD446,0x2341,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x93E5,0xE487,0xD447,0xD447,0xDC87,0xDC67,0xD467,0xDC67,0xD467,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0x2B41,0x0320,0x0320,0x0320,0x4382,0xDC67,0xD447,0xD447,0xD447,0xD447,0xDC67,0x9BE5,0x0320,0x0320,0x3361,0xD467,0xD447,0xD447,0xD467,0x3361,0x0320,0x0320,0x8BE4,0xDC87,0xDC87,0x7BC4,0x6BA3,0xDC87,0xD447,0xD447,0xDC67,0xDC87,0xDC87,0xDC87,0xECA7,0x7BC4,0x0320,0x0320,0x0320,0x0320,0x6BA3,0xDC87,0xD447,0xD447,0xDC87,0xDC87,0xDC87,0xDC87,0xD447,0xD447,0xE487,0x8BE4,0x0320,0x3361,0xD447,0xDC67,0xD447,0xDC67,0xDC67,0xDC67,0xDC67,0xD447,0xDC87,0xB426,0x1B40,0x0320,0x0320,0x93E5,0xDC87,0xD467,0xC426,0x0B20,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0B20,0x83C4,0xD467,0xDC87,0xDC67,0xD447,0xD447,0xD447,0xDC67,0xDC87,0xDC67,0xDC67,0xDC67,0xE487,0xA405,0x0320,0x0320,0x0320,0x0320,0x2B41,0xD467,0xD447,0xD447,0xD447,0xD447,0xDC87,0x5382,0x0320,0x0320,0x1320,0xCC46,0xD467,0xDC67,0xA405,0x0320,0x0320,0x0320,0x7BC4,0xE487,0xDC87,0x8BE4,0x8BE4,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC87,0x5B83,0x0320,0x0320,0x0320,0x0320,0x8BE4,0xE487,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC87,0xDC67,0x93E5,0x0B20,0x0320,0x0320,0x4B82,0xCC46,0xDC87,0xDC67,0xD447,0xDC67,0xDC87,0xDC67,0x93E5,0x1B40,0x0320,0x0320,0x0320,0xAC05,0xDC87,0xDC87,0xB406,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x3361,0x83E4,0xBC26,0xCC46,0xD447,0xD446,0xBC26,0x83E4,0x73C4,0xBC26,0xB426,0xBC46,0x5382,0x0320,0x0320,0x0320,0x0320,0x1340,0xBC26,0xCC46,0xCC46,0xCC46,0xCC46,0xC426,0x1B40,0x0320,0x0320,0x0320,0xA405,0xCC46,0xD467,0x5382,0x0320,0x0320,0x0320,0x6BA3,0xD467,0xD466,0x93E5,0xA405,0xCC46,0xCC46,0xCC46,0xCC46,0xCC46,0xCC46,0xCC46,0xCC46,0x3B62,0x0320,0x0320,0x0320,0x0320,0x8BE4,0xBC46,0xB426,0xB426,0xB426,0xB426,0xB426,0xAC05,0x83E4,0x3B62,0x0320,0x0320,0x0320,0x0320,0x0320,0x2341,0x83E4,0xBC26,0xCC46,0xBC26,0x93E5,0x3B62,0x0320,0x0320,0x0320,0x0320,0x0B20,0xA405,0xBC26,0xBC46,0x83C4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1B41,0x2B61,0x2341,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1320,0x1340,0x1320,0x1320,0x1340,0x1320,0x0320,0x0320,0x0320,0x0320,0x0B20,0x1340,0x1320,0x0320,0x0320,0x0320,0x0320,0x0B20,0x1340,0x1340,0x1320,0x1320,0x1340,0x1320,0x1320,0x1320,0x1320,0x1320,0x1320,0x1320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1340,0x0B20,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
+    0x40, 0x01, 0x20, 0x00, 0x3b, 0x00, 0x00, 0x03, 0x20, 0x03, 0xe0, 0x0a, 0x00, 0x0b, 0x20, 0x0b,
+    0x20, 0x13, 0x40, 0x13, 0x40, 0x1b, 0x41, 0x1b, 0x41, 0x23, 0x41, 0x2b, 0x61, 0x2b, 0x61, 0x33,
+    0x61, 0x3b, 0x62, 0x3b, 0x82, 0x3b, 0x62, 0x43, 0x82, 0x43, 0x82, 0x4b, 0x82, 0x53, 0x83, 0x53,
+    0x83, 0x5b, 0xa3, 0x5b, 0xa3, 0x63, 0xa3, 0x6b, 0xc3, 0x6b, 0xa3, 0x73, 0xc3, 0x73, 0xc4, 0x73,
+    0xc4, 0x7b, 0xc4, 0x83, 0xe4, 0x83, 0xe4, 0x8b, 0xe4, 0x93, 0xe5, 0x93, 0xe5, 0x9b, 0x05, 0x9c,
+    0x05, 0xa4, 0x05, 0xac, 0x25, 0xac, 0x05, 0xb4, 0x06, 0xb4, 0x25, 0xb4, 0x26, 0xb4, 0x26, 0xbc,
+    0x46, 0xbc, 0x26, 0xc4, 0x46, 0xc4, 0x26, 0xcc, 0x46, 0xcc, 0x46, 0xd4, 0x47, 0xd4, 0x66, 0xd4,
+    0x67, 0xd4, 0x67, 0xdc, 0x87, 0xdc, 0x87, 0xe4, 0xa7, 0xe4, 0xa7, 0xec, 0xff, 0x01, 0xff, 0x01,
+    0xff, 0x01, 0xff, 0x01, 0xff, 0x01, 0xff, 0x01, 0xff, 0x01, 0xff, 0x01, 0xd5, 0x01, 0x00, 0x04,
+    0x06, 0x01, 0x03, 0x04, 0x06, 0x01, 0x02, 0x04, 0x04, 0x01, 0x03, 0x04, 0x02, 0x01, 0x00, 0x05,
+    0x07, 0x08, 0x00, 0x05, 0x04, 0x01, 0x05, 0x04, 0x09, 0x01, 0x01, 0x04, 0x02, 0x01, 0x03, 0x04,
+    0xf1, 0x01, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x22, 0x00, 0x2a, 0x01, 0x2c, 0x00, 0x26, 0x00, 0x21,
+    0x00, 0x09, 0x01, 0x01, 0x00, 0x0c, 0x00, 0x2f, 0x01, 0x2c, 0x00, 0x2f, 0x00, 0x21, 0x04, 0x01,
+    0x00, 0x1e, 0x00, 0x2f, 0x00, 0x2c, 0x00, 0x2f, 0x00, 0x0b, 0x02, 0x01, 0x00, 0x11, 0x00, 0x2f,
+    0x01, 0x2c, 0x00, 0x29, 0x00, 0x05, 0x01, 0x01, 0x00, 0x20, 0x00, 0x35, 0x05, 0x31, 0x00, 0x36,
+    0x00, 0x15, 0x03, 0x01, 0x00, 0x20, 0x00, 0x2f, 0x04, 0x2c, 0x00, 0x24, 0x00, 0x13, 0x04, 0x01,
+    0x00, 0x04, 0x00, 0x16, 0x00, 0x24, 0x00, 0x2c, 0x00, 0x2e, 0x00, 0x2b, 0x00, 0x1f, 0x00, 0x09,
+    0x00, 0x0c, 0x00, 0x2f, 0x00, 0x2c, 0x00, 0x2f, 0x00, 0x18, 0x02, 0x01, 0x00, 0x05, 0x00, 0x26,
+    0x00, 0x2b, 0x00, 0x2c, 0x00, 0x23, 0x00, 0x04, 0xe5, 0x01, 0x00, 0x12, 0x00, 0x27, 0x00, 0x33,
+    0x01, 0x37, 0x03, 0x36, 0x00, 0x38, 0x00, 0x0c, 0x01, 0x01, 0x00, 0x20, 0x00, 0x38, 0x01, 0x36,
+    0x00, 0x37, 0x00, 0x2b, 0x03, 0x01, 0x00, 0x05, 0x00, 0x2f, 0x01, 0x36, 0x00, 0x38, 0x00, 0x14,
+    0x02, 0x01, 0x00, 0x24, 0x00, 0x37, 0x01, 0x36, 0x00, 0x31, 0x00, 0x07, 0x01, 0x01, 0x00, 0x26,
+    0x00, 0x36, 0x05, 0x33, 0x00, 0x36, 0x00, 0x0e, 0x03, 0x01, 0x00, 0x2b, 0x00, 0x37, 0x05, 0x36,
+    0x00, 0x37, 0x00, 0x1d, 0x02, 0x01, 0x00, 0x09, 0x00, 0x27, 0x00, 0x37, 0x01, 0x36, 0x00, 0x35,
+    0x00, 0x36, 0x00, 0x37, 0x00, 0x31, 0x00, 0x12, 0x00, 0x26, 0x00, 0x37, 0x00, 0x36, 0x00, 0x2e,
+    0x00, 0x04, 0x01, 0x01, 0x00, 0x1e, 0x00, 0x38, 0x00, 0x36, 0x00, 0x37, 0x00, 0x11, 0xe4, 0x01,
+    0x00, 0x05, 0x00, 0x22, 0x01, 0x36, 0x00, 0x33, 0x00, 0x35, 0x01, 0x37, 0x01, 0x36, 0x00, 0x37,
+    0x00, 0x33, 0x00, 0x08, 0x00, 0x01, 0x00, 0x07, 0x00, 0x31, 0x02, 0x33, 0x00, 0x35, 0x00, 0x2e,
+    0x00, 0x04, 0x02, 0x01, 0x00, 0x12, 0x00, 0x36, 0x01, 0x33, 0x00, 0x37, 0x00, 0x1d, 0x01, 0x01,
+    0x00, 0x09, 0x03, 0x33, 0x00, 0x31, 0x00, 0x08, 0x00, 0x01, 0x00, 0x04, 0x00, 0x2e, 0x00, 0x35,
+    0x00, 0x33, 0x00, 0x36, 0x03, 0x37, 0x00, 0x33, 0x00, 0x08, 0x02, 0x01, 0x00, 0x05, 0x00, 0x2e,
+    0x00, 0x35, 0x00, 0x33, 0x00, 0x36, 0x01, 0x37, 0x00, 0x35, 0x01, 0x33, 0x00, 0x36, 0x00, 0x0e,
+    0x00, 0x01, 0x00, 0x07, 0x00, 0x2c, 0x00, 0x37, 0x00, 0x33, 0x00, 0x36, 0x00, 0x37, 0x01, 0x36,
+    0x00, 0x33, 0x00, 0x36, 0x00, 0x2e, 0x00, 0x1d, 0x00, 0x36, 0x00, 0x33, 0x00, 0x37, 0x00, 0x16,
+    0x00, 0x01, 0x00, 0x0e, 0x00, 0x35, 0x00, 0x33, 0x00, 0x37, 0x00, 0x20, 0xe4, 0x01, 0x00, 0x05,
+    0x00, 0x25, 0x00, 0x38, 0x01, 0x33, 0x00, 0x37, 0x00, 0x2e, 0x00, 0x20, 0x00, 0x16, 0x00, 0x11,
+    0x00, 0x12, 0x00, 0x17, 0x00, 0x1d, 0x00, 0x04, 0x00, 0x01, 0x00, 0x17, 0x00, 0x37, 0x03, 0x33,
+    0x00, 0x31, 0x00, 0x08, 0x02, 0x01, 0x00, 0x21, 0x00, 0x37, 0x01, 0x33, 0x00, 0x36, 0x00, 0x23,
+    0x01, 0x01, 0x00, 0x18, 0x00, 0x37, 0x03, 0x33, 0x00, 0x09, 0x00, 0x01, 0x00, 0x09, 0x00, 0x32,
+    0x00, 0x33, 0x00, 0x35, 0x00, 0x25, 0x02, 0x1e, 0x00, 0x20, 0x00, 0x1d, 0x03, 0x01, 0x00, 0x09,
+    0x01, 0x33, 0x00, 0x35, 0x00, 0x25, 0x00, 0x1e, 0x00, 0x20, 0x00, 0x2e, 0x00, 0x35, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x1b, 0x00, 0x01, 0x00, 0x20, 0x00, 0x37, 0x00, 0x33, 0x00, 0x36, 0x00, 0x26,
+    0x00, 0x16, 0x00, 0x11, 0x00, 0x20, 0x00, 0x36, 0x00, 0x33, 0x00, 0x37, 0x00, 0x22, 0x00, 0x2b,
+    0x01, 0x36, 0x00, 0x28, 0x00, 0x05, 0x00, 0x29, 0x01, 0x36, 0x00, 0x2f, 0x00, 0x06, 0xe4, 0x01,
+    0x00, 0x20, 0x00, 0x38, 0x00, 0x33, 0x00, 0x35, 0x00, 0x33, 0x00, 0x19, 0x00, 0x05, 0x07, 0x01,
+    0x00, 0x26, 0x00, 0x36, 0x04, 0x33, 0x00, 0x0a, 0x01, 0x01, 0x00, 0x05, 0x00, 0x2e, 0x00, 0x35,
+    0x01, 0x33, 0x00, 0x36, 0x00, 0x2b, 0x00, 0x01, 0x00, 0x04, 0x00, 0x2c, 0x00, 0x36, 0x02, 0x33,
+    0x00, 0x35, 0x00, 0x0b, 0x00, 0x01, 0x00, 0x0e, 0x00, 0x36, 0x00, 0x33, 0x00, 0x35, 0x00, 0x0b,
+    0x08, 0x01, 0x00, 0x0e, 0x00, 0x36, 0x00, 0x33, 0x00, 0x36, 0x00, 0x0e, 0x01, 0x01, 0x00, 0x0e,
+    0x00, 0x36, 0x00, 0x33, 0x00, 0x37, 0x00, 0x18, 0x00, 0x09, 0x00, 0x35, 0x00, 0x33, 0x00, 0x36,
+    0x00, 0x22, 0x00, 0x04, 0x02, 0x01, 0x00, 0x23, 0x00, 0x36, 0x00, 0x35, 0x00, 0x2b, 0x00, 0x1d,
+    0x00, 0x37, 0x01, 0x33, 0x00, 0x26, 0x00, 0x35, 0x00, 0x33, 0x00, 0x36, 0x00, 0x13, 0xe4, 0x01,
+    0x00, 0x0c, 0x00, 0x35, 0x00, 0x33, 0x00, 0x35, 0x00, 0x32, 0x00, 0x0e, 0x08, 0x01, 0x00, 0x0e,
+    0x00, 0x36, 0x01, 0x33, 0x00, 0x23, 0x00, 0x32, 0x00, 0x33, 0x00, 0x36, 0x00, 0x0e, 0x01, 0x01,
+    0x00, 0x11, 0x00, 0x36, 0x03, 0x33, 0x00, 0x31, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x36, 0x03, 0x33,
+    0x00, 0x36, 0x00, 0x0c, 0x00, 0x01, 0x00, 0x13, 0x00, 0x37, 0x00, 0x33, 0x00, 0x31, 0x00, 0x09,
+    0x08, 0x01, 0x00, 0x13, 0x00, 0x37, 0x00, 0x33, 0x00, 0x31, 0x00, 0x08, 0x01, 0x01, 0x00, 0x17,
+    0x00, 0x36, 0x00, 0x33, 0x00, 0x37, 0x00, 0x10, 0x00, 0x18, 0x00, 0x37, 0x00, 0x33, 0x00, 0x31,
+    0x00, 0x06, 0x03, 0x01, 0x00, 0x12, 0x00, 0x36, 0x00, 0x33, 0x00, 0x32, 0x00, 0x10, 0x00, 0x2e,
+    0x01, 0x33, 0x00, 0x36, 0x00, 0x33, 0x00, 0x37, 0x00, 0x23, 0xe5, 0x01, 0x00, 0x1e, 0x00, 0x37,
+    0x00, 0x33, 0x00, 0x36, 0x00, 0x12, 0x09, 0x01, 0x00, 0x20, 0x00, 0x37, 0x00, 0x35, 0x00, 0x2c,
+    0x00, 0x11, 0x01, 0x33, 0x00, 0x37, 0x00, 0x13, 0x01, 0x01, 0x00, 0x20, 0x00, 0x37, 0x00, 0x33,
+    0x00, 0x35, 0x01, 0x33, 0x00, 0x36, 0x00, 0x0b, 0x00, 0x20, 0x00, 0x36, 0x03, 0x33, 0x00, 0x36,
+    0x00, 0x10, 0x00, 0x01, 0x00, 0x1c, 0x00, 0x37, 0x01, 0x33, 0x00, 0x2c, 0x01, 0x2b, 0x00, 0x2c,
+    0x00, 0x23, 0x04, 0x01, 0x00, 0x1b, 0x00, 0x37, 0x00, 0x33, 0x00, 0x31, 0x00, 0x24, 0x00, 0x23,
+    0x00, 0x26, 0x01, 0x33, 0x00, 0x36, 0x00, 0x28, 0x00, 0x04, 0x00, 0x26, 0x00, 0x36, 0x00, 0x37,
+    0x00, 0x20, 0x04, 0x01, 0x00, 0x0c, 0x01, 0x33, 0x00, 0x36, 0x00, 0x0c, 0x00, 0x1d, 0x00, 0x37,
+    0x01, 0x33, 0x00, 0x35, 0x00, 0x31, 0x00, 0x08, 0xe5, 0x01, 0x00, 0x29, 0x01, 0x36, 0x00, 0x24,
+    0x09, 0x01, 0x00, 0x07, 0x00, 0x31, 0x00, 0x33, 0x00, 0x36, 0x00, 0x1e, 0x00, 0x09, 0x00, 0x31,
+    0x00, 0x33, 0x00, 0x37, 0x00, 0x18, 0x00, 0x01, 0x00, 0x05, 0x00, 0x2e, 0x00, 0x35, 0x00, 0x33,
+    0x00, 0x2c, 0x00, 0x32, 0x00, 0x33, 0x00, 0x36, 0x00, 0x1c, 0x00, 0x2e, 0x00, 0x33, 0x00, 0x36,
+    0x00, 0x25, 0x00, 0x2e, 0x00, 0x33, 0x00, 0x36, 0x00, 0x12, 0x00, 0x01, 0x00, 0x22, 0x00, 0x36,
+    0x01, 0x33, 0x02, 0x36, 0x00, 0x38, 0x00, 0x25, 0x04, 0x01, 0x00, 0x20, 0x00, 0x37, 0x01, 0x33,
+    0x02, 0x36, 0x01, 0x33, 0x00, 0x36, 0x00, 0x11, 0x00, 0x01, 0x00, 0x2e, 0x00, 0x35, 0x00, 0x37,
+    0x00, 0x16, 0x04, 0x01, 0x00, 0x0c, 0x01, 0x33, 0x00, 0x36, 0x00, 0x0c, 0x00, 0x09, 0x00, 0x32,
+    0x01, 0x33, 0x00, 0x36, 0x00, 0x16, 0xe6, 0x01, 0x00, 0x31, 0x00, 0x33, 0x00, 0x37, 0x00, 0x15,
+    0x01, 0x01, 0x00, 0x05, 0x00, 0x23, 0x04, 0x25, 0x00, 0x05, 0x00, 0x16, 0x00, 0x37, 0x01, 0x33,
+    0x00, 0x2c, 0x00, 0x29, 0x01, 0x33, 0x00, 0x37, 0x00, 0x1e, 0x00, 0x01, 0x00, 0x11, 0x00, 0x36,
+    0x01, 0x33, 0x00, 0x17, 0x00, 0x2f, 0x01, 0x33, 0x00, 0x30, 0x01, 0x33, 0x00, 0x35, 0x00, 0x11,
+    0x00, 0x2c, 0x00, 0x35, 0x00, 0x37, 0x00, 0x14, 0x00, 0x01, 0x00, 0x26, 0x00, 0x36, 0x00, 0x33,
+    0x03, 0x36, 0x00, 0x39, 0x00, 0x1d, 0x04, 0x01, 0x00, 0x26, 0x00, 0x36, 0x00, 0x33, 0x03, 0x36,
+    0x01, 0x33, 0x00, 0x36, 0x00, 0x25, 0x00, 0x0a, 0x00, 0x31, 0x00, 0x33, 0x00, 0x36, 0x00, 0x10,
+    0x04, 0x01, 0x00, 0x11, 0x00, 0x36, 0x01, 0x33, 0x00, 0x0a, 0x00, 0x04, 0x00, 0x2e, 0x00, 0x33,
+    0x00, 0x36, 0x00, 0x25, 0x04, 0x01, 0x00, 0x00, 0xe1, 0x01, 0x01, 0x33, 0x00, 0x37, 0x00, 0x15,
+    0x01, 0x01, 0x00, 0x09, 0x00, 0x33, 0x03, 0x36, 0x00, 0x33, 0x00, 0x08, 0x00, 0x26, 0x00, 0x36,
+    0x01, 0x33, 0x00, 0x35, 0x00, 0x36, 0x01, 0x33, 0x00, 0x36, 0x00, 0x22, 0x00, 0x01, 0x00, 0x20,
+    0x00, 0x37, 0x00, 0x33, 0x00, 0x2e, 0x00, 0x08, 0x00, 0x2c, 0x00, 0x36, 0x02, 0x33, 0x00, 0x36,
+    0x00, 0x26, 0x00, 0x04, 0x00, 0x2c, 0x00, 0x36, 0x00, 0x37, 0x00, 0x16, 0x00, 0x01, 0x00, 0x2e,
+    0x00, 0x35, 0x00, 0x33, 0x00, 0x2c, 0x02, 0x26, 0x00, 0x2b, 0x00, 0x12, 0x03, 0x01, 0x00, 0x04,
+    0x00, 0x2c, 0x00, 0x35, 0x00, 0x33, 0x00, 0x2c, 0x01, 0x25, 0x00, 0x26, 0x00, 0x32, 0x02, 0x33,
+    0x00, 0x17, 0x00, 0x31, 0x00, 0x33, 0x00, 0x36, 0x00, 0x0e, 0x04, 0x01, 0x00, 0x1b, 0x00, 0x37,
+    0x00, 0x33, 0x00, 0x2f, 0x00, 0x04, 0x00, 0x09, 0x00, 0x32, 0x00, 0x33, 0x00, 0x37, 0x00, 0x18,
+    0x04, 0x01, 0x00, 0x02, 0xe1, 0x01, 0x00, 0x30, 0x00, 0x33, 0x00, 0x36, 0x00, 0x23, 0x01, 0x01,
+    0x00, 0x0c, 0x00, 0x37, 0x00, 0x36, 0x01, 0x33, 0x00, 0x35, 0x00, 0x2c, 0x00, 0x11, 0x00, 0x35,
+    0x01, 0x33, 0x02, 0x36, 0x00, 0x35, 0x00, 0x33, 0x00, 0x36, 0x00, 0x25, 0x00, 0x05, 0x00, 0x2e,
+    0x00, 0x35, 0x00, 0x37, 0x00, 0x20, 0x00, 0x01, 0x00, 0x24, 0x00, 0x36, 0x02, 0x33, 0x00, 0x37,
+    0x00, 0x16, 0x00, 0x01, 0x00, 0x26, 0x00, 0x36, 0x00, 0x37, 0x00, 0x17, 0x00, 0x07, 0x00, 0x31,
+    0x00, 0x33, 0x00, 0x36, 0x00, 0x11, 0x08, 0x01, 0x00, 0x08, 0x00, 0x31, 0x00, 0x33, 0x00, 0x36,
+    0x00, 0x0e, 0x02, 0x01, 0x00, 0x16, 0x00, 0x36, 0x00, 0x33, 0x00, 0x36, 0x00, 0x1d, 0x00, 0x2f,
+    0x00, 0x33, 0x00, 0x37, 0x00, 0x15, 0x03, 0x01, 0x00, 0x04, 0x00, 0x2c, 0x01, 0x36, 0x00, 0x24,
+    0x00, 0x01, 0x00, 0x0e, 0x00, 0x36, 0x00, 0x33, 0x00, 0x37, 0x00, 0x13, 0x04, 0x01, 0x00, 0x03,
+    0xe1, 0x01, 0x00, 0x25, 0x00, 0x36, 0x00, 0x33, 0x00, 0x36, 0x00, 0x14, 0x00, 0x01, 0x00, 0x04,
+    0x00, 0x0f, 0x00, 0x0d, 0x00, 0x24, 0x01, 0x36, 0x00, 0x26, 0x00, 0x20, 0x00, 0x37, 0x00, 0x36,
+    0x00, 0x2c, 0x02, 0x0c, 0x00, 0x20, 0x01, 0x36, 0x00, 0x28, 0x00, 0x12, 0x00, 0x36, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x12, 0x00, 0x01, 0x00, 0x1d, 0x00, 0x37, 0x01, 0x33, 0x00, 0x35, 0x00, 0x2f,
+    0x00, 0x05, 0x00, 0x01, 0x00, 0x25, 0x00, 0x36, 0x00, 0x37, 0x00, 0x18, 0x00, 0x0c, 0x00, 0x36,
+    0x00, 0x33, 0x00, 0x35, 0x00, 0x0a, 0x08, 0x01, 0x00, 0x0c, 0x00, 0x35, 0x00, 0x33, 0x00, 0x31,
+    0x00, 0x05, 0x02, 0x01, 0x00, 0x16, 0x00, 0x36, 0x00, 0x33, 0x00, 0x36, 0x00, 0x15, 0x00, 0x2c,
+    0x00, 0x35, 0x00, 0x36, 0x00, 0x26, 0x03, 0x01, 0x00, 0x20, 0x00, 0x36, 0x00, 0x33, 0x00, 0x37,
+    0x00, 0x12, 0x00, 0x01, 0x00, 0x15, 0x00, 0x37, 0x00, 0x33, 0x00, 0x36, 0x00, 0x0c, 0x04, 0x01,
+    0x00, 0x00, 0xe1, 0x01, 0x00, 0x13, 0x00, 0x37, 0x01, 0x33, 0x00, 0x35, 0x00, 0x1d, 0x00, 0x0d,
+    0x00, 0x0a, 0x00, 0x12, 0x00, 0x2c, 0x00, 0x36, 0x00, 0x35, 0x00, 0x2c, 0x00, 0x2e, 0x00, 0x33,
+    0x00, 0x37, 0x00, 0x1a, 0x02, 0x01, 0x00, 0x16, 0x00, 0x37, 0x00, 0x33, 0x00, 0x2e, 0x00, 0x23,
+    0x00, 0x36, 0x00, 0x33, 0x00, 0x31, 0x00, 0x05, 0x00, 0x01, 0x00, 0x13, 0x00, 0x37, 0x01, 0x33,
+    0x00, 0x37, 0x00, 0x1e, 0x01, 0x01, 0x00, 0x22, 0x01, 0x37, 0x00, 0x1c, 0x00, 0x12, 0x00, 0x37,
+    0x01, 0x33, 0x00, 0x1e, 0x02, 0x1b, 0x00, 0x1c, 0x00, 0x11, 0x03, 0x01, 0x00, 0x12, 0x00, 0x37,
+    0x00, 0x33, 0x00, 0x31, 0x00, 0x1d, 0x01, 0x1c, 0x00, 0x20, 0x00, 0x31, 0x02, 0x33, 0x00, 0x08,
+    0x00, 0x20, 0x00, 0x37, 0x00, 0x33, 0x00, 0x36, 0x00, 0x24, 0x00, 0x12, 0x00, 0x13, 0x00, 0x25,
+    0x00, 0x36, 0x00, 0x33, 0x00, 0x37, 0x00, 0x24, 0x01, 0x01, 0x00, 0x1c, 0x00, 0x37, 0x00, 0x33,
+    0x00, 0x32, 0x00, 0x09, 0xe8, 0x01, 0x00, 0x22, 0x00, 0x38, 0x01, 0x33, 0x00, 0x37, 0x00, 0x36,
+    0x00, 0x35, 0x00, 0x36, 0x00, 0x35, 0x05, 0x33, 0x00, 0x0a, 0x02, 0x01, 0x00, 0x11, 0x00, 0x36,
+    0x03, 0x33, 0x00, 0x36, 0x00, 0x23, 0x01, 0x01, 0x00, 0x0c, 0x00, 0x35, 0x01, 0x33, 0x00, 0x35,
+    0x00, 0x0c, 0x01, 0x01, 0x00, 0x20, 0x01, 0x37, 0x00, 0x1d, 0x00, 0x18, 0x00, 0x37, 0x01, 0x33,
+    0x00, 0x36, 0x02, 0x37, 0x00, 0x3a, 0x00, 0x1d, 0x03, 0x01, 0x00, 0x18, 0x00, 0x37, 0x01, 0x33,
+    0x03, 0x37, 0x01, 0x33, 0x00, 0x38, 0x00, 0x20, 0x00, 0x01, 0x00, 0x0c, 0x00, 0x33, 0x00, 0x36,
+    0x00, 0x33, 0x03, 0x36, 0x00, 0x33, 0x00, 0x37, 0x00, 0x2b, 0x00, 0x07, 0x01, 0x01, 0x00, 0x22,
+    0x00, 0x37, 0x00, 0x35, 0x00, 0x2e, 0x00, 0x04, 0xe8, 0x01, 0x00, 0x04, 0x00, 0x1e, 0x00, 0x35,
+    0x00, 0x37, 0x00, 0x36, 0x02, 0x33, 0x00, 0x36, 0x00, 0x37, 0x02, 0x36, 0x00, 0x38, 0x00, 0x25,
+    0x03, 0x01, 0x00, 0x0a, 0x00, 0x35, 0x03, 0x33, 0x00, 0x37, 0x00, 0x13, 0x01, 0x01, 0x00, 0x05,
+    0x00, 0x31, 0x00, 0x35, 0x00, 0x36, 0x00, 0x25, 0x02, 0x01, 0x00, 0x1d, 0x00, 0x38, 0x00, 0x37,
+    0x01, 0x20, 0x00, 0x37, 0x05, 0x33, 0x00, 0x37, 0x00, 0x15, 0x03, 0x01, 0x00, 0x20, 0x00, 0x38,
+    0x05, 0x36, 0x00, 0x37, 0x00, 0x36, 0x00, 0x22, 0x00, 0x04, 0x01, 0x01, 0x00, 0x12, 0x00, 0x31,
+    0x00, 0x37, 0x00, 0x36, 0x00, 0x33, 0x00, 0x36, 0x00, 0x37, 0x00, 0x36, 0x00, 0x22, 0x00, 0x07,
+    0x02, 0x01, 0x00, 0x26, 0x01, 0x37, 0x00, 0x29, 0xeb, 0x01, 0x00, 0x0c, 0x00, 0x1f, 0x00, 0x2c,
+    0x00, 0x31, 0x00, 0x33, 0x00, 0x32, 0x00, 0x2c, 0x00, 0x1f, 0x00, 0x1c, 0x00, 0x2c, 0x00, 0x2b,
+    0x00, 0x2d, 0x00, 0x13, 0x03, 0x01, 0x00, 0x06, 0x00, 0x2c, 0x03, 0x31, 0x00, 0x2e, 0x00, 0x07,
+    0x02, 0x01, 0x00, 0x25, 0x00, 0x31, 0x00, 0x35, 0x00, 0x13, 0x02, 0x01, 0x00, 0x18, 0x00, 0x35,
+    0x00, 0x34, 0x00, 0x22, 0x00, 0x25, 0x07, 0x31, 0x00, 0x0e, 0x03, 0x01, 0x00, 0x20, 0x00, 0x2d,
+    0x04, 0x2b, 0x00, 0x26, 0x00, 0x1f, 0x00, 0x0e, 0x04, 0x01, 0x00, 0x09, 0x00, 0x1f, 0x00, 0x2c,
+    0x00, 0x31, 0x00, 0x2c, 0x00, 0x22, 0x00, 0x0e, 0x03, 0x01, 0x00, 0x04, 0x00, 0x25, 0x00, 0x2c,
+    0x00, 0x2d, 0x00, 0x1e, 0xee, 0x01, 0x00, 0x08, 0x00, 0x0b, 0x00, 0x09, 0x0b, 0x01, 0x00, 0x05,
+    0x00, 0x06, 0x01, 0x05, 0x00, 0x06, 0x00, 0x05, 0x03, 0x01, 0x00, 0x04, 0x00, 0x06, 0x00, 0x05,
+    0x03, 0x01, 0x00, 0x04, 0x01, 0x06, 0x01, 0x05, 0x00, 0x06, 0x06, 0x05, 0x16, 0x01, 0x00, 0x06,
+    0x00, 0x04, 0xff, 0x01, 0xff, 0x01, 0xff, 0x01, 0xff, 0x01, 0xff, 0x01, 0xff, 0x01, 0xff, 0x01,
+    0xff, 0x01, 0xff, 0x01, 0xa7, 0x01,
 #else
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0x6020,0x6020,0x6020,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0x6020,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0x6020,0x6020,0x6020,0x6000,0x6000,0x6000,0x6860,0x70A1,0x6881,0x6881,0x6881,0x6881,0x6881,0x6881,0x70A1,0x6840,0x6000,0x6000,0x6000,0x6000,0x6020,0x6020,0x6020,0x6020,0x6020,0x6020,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0x6040,0x6000,0x6000,0x6000,0x6020,0x6020,0x6020,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x7901,0x9A23,0xB305,0xC385,0xC3C6,0xC3C6,0xBB65,0xB2E4,0x70C1,0x6000,0x6000,0x7901,0xCBE6,0xC3C6,0xC3C6,0xCC06,0xAAE4,0x6000,0x6000,0x6000,0x6000,0x6000,0xAAA4,0xCC06,0xC3C6,0xCBE6,0x78E1,0x6000,0x6000,0x6000,0x8162,0xCC06,0xC3C6,0xCBE6,0xC386,0x6840,0x6000,0x6000,0xAAE4,0xDC67,0xD426,0xD426,0xD426,0xD426,0xD426,0xD426,0xDC67,0x91C3,0x6000,0x6000,0x6000,0x6000,0xAAC4,0xCC06,0xC3C6,0xC3C6,0xC3C6,0xC3C6,0xC3C6,0xBB45,0x89A2,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0x91E3,0xBB45,0xC3C6,0xCBE6,0xC3A6,0xAAA4,0x70A1,0x7901,0xCBE6,0xC3C6,0xCC06,0x9A23,0x6000,0x6000,0x6000,0x6860,0xBB65,0xC3A6,0xCBC6,0xB305,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x8982,0xBB65,0xD447,0xDC87,0xDC87,0xDC67,0xDC67,0xDC67,0xDC67,0xE487,0x7901,0x6000,0x6000,0xAAC4,0xE487,0xDC67,0xDC67,0xDC87,0xC3A6,0x6000,0x6000,0x6000,0x6000,0x6860,0xCC06,0xDC67,0xDC67,0xE487,0x89C3,0x6000,0x6000,0x6000,0xB325,0xDC87,0xDC67,0xDC67,0xD426,0x6880,0x6000,0x6000,0xBB85,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC67,0x7922,0x6000,0x6000,0x6000,0x6000,0xC3A6,0xDC87,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC87,0xA284,0x6000,0x6000,0x6000,0x70C1,0xC385,0xDC87,0xDC67,0xDC67,0xD467,0xDC67,0xDC87,0xD426,0x8982,0xBB85,0xDC87,0xDC67,0xCBE6,0x6040,0x6000,0x6000,0xAAA4,0xE487,0xDC67,0xDC87,0x8162,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6860,0xB2E5,0xDC67,0xDC67,0xD447,0xD467,0xDC87,0xDC87,0xDC67,0xDC67,0xDC87,0xD447,0x6881,0x6000,0x6880,0xCC26,0xD447,0xD447,0xD447,0xD467,0xCBE6,0x6040,0x6000,0x6000,0x6000,0x8982,0xDC67,0xD447,0xD447,0xDC87,0xA284,0x6000,0x6000,0x70A1,0xD447,0xD447,0xD447,0xD447,0xD426,0x70A1,0x6000,0x6040,0xCBE6,0xD467,0xD447,0xDC67,0xDC87,0xDC87,0xDC87,0xDC87,0xD447,0x6881,0x6000,0x6000,0x6000,0x6840,0xCC06,0xD467,0xD447,0xDC67,0xDC87,0xDC87,0xD467,0xD447,0xD447,0xDC67,0x7922,0x6000,0x6880,0xC3C6,0xDC87,0xD447,0xDC67,0xDC87,0xDC67,0xDC67,0xD447,0xDC67,0xCBE6,0xA264,0xDC67,0xD447,0xDC87,0x91E3,0x6000,0x8142,0xDC67,0xD447,0xDC87,0xAAC4,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6840,0xBB65,0xE487,0xD447,0xD447,0xDC87,0xCBE6,0xAAC4,0x91C3,0x8162,0x8982,0x9A03,0xA284,0x6020,0x6000,0x91E3,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD426,0x6881,0x6000,0x6000,0x6000,0xAAE4,0xDC87,0xD447,0xD447,0xDC67,0xB325,0x6000,0x6000,0x9A23,0xDC87,0xD447,0xD447,0xD447,0xD447,0x70C1,0x6000,0x70A1,0xD446,0xD447,0xD467,0xB345,0xAAA4,0xAAA4,0xAAA4,0xAAC4,0xA264,0x6020,0x6000,0x6000,0x6000,0x70A1,0xD447,0xD447,0xD467,0xBB65,0xAAA4,0xAAE4,0xCBE6,0xD467,0xD447,0xDC87,0x9A43,0x6000,0xAAE4,0xDC87,0xD447,0xDC67,0xBB85,0x91C3,0x8162,0xAAE4,0xDC67,0xD447,0xDC87,0xAAE5,0xC3A6,0xDC67,0xDC67,0xC3A5,0x6860,0xC3A6,0xDC67,0xDC67,0xCC06,0x6860,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xAAC4,0xE487,0xD447,0xD467,0xD447,0x9A43,0x6860,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0xBB85,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0x70E1,0x6000,0x6000,0x6840,0xCC06,0xD467,0xD447,0xD447,0xDC67,0xC3A6,0x6020,0x6020,0xC3C6,0xDC67,0xD447,0xD447,0xD447,0xD467,0x78E1,0x6000,0x7922,0xDC67,0xD447,0xD467,0x78E1,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x8122,0xDC67,0xD447,0xDC67,0x8122,0x6000,0x6000,0x7922,0xDC67,0xD447,0xDC87,0x9A23,0x70C1,0xD447,0xD447,0xDC67,0xB305,0x6020,0x6000,0x6000,0x6000,0xB325,0xDC67,0xD467,0xC3A6,0xA284,0xDC87,0xD447,0xD447,0xBB65,0xD467,0xD447,0xDC67,0x89A2,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x7901,0xD447,0xD447,0xD467,0xD426,0x8142,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x7922,0xDC67,0xD447,0xD447,0xB325,0xD446,0xD447,0xDC67,0x8142,0x6000,0x6000,0x8162,0xDC67,0xD447,0xD447,0xD447,0xD447,0xCC26,0x6840,0x8122,0xDC67,0xD447,0xD447,0xD447,0xD447,0xDC67,0x7901,0x6000,0x89C2,0xDC87,0xD447,0xD426,0x70A1,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x89C2,0xDC87,0xD447,0xCC26,0x6881,0x6000,0x6000,0x9203,0xDC67,0xD447,0xDC87,0x8142,0x9A43,0xDC87,0xD447,0xCC06,0x6860,0x6000,0x6000,0x6000,0x6000,0x8982,0xDC67,0xD447,0xD446,0x8162,0xCBE6,0xD447,0xD447,0xDC67,0xD447,0xDC87,0xB305,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xA2A4,0xDC87,0xD447,0xDC67,0x8982,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xAAC4,0xDC87,0xD467,0xC3E6,0x8162,0xD447,0xD447,0xDC87,0x89C2,0x6000,0x6000,0xAAE4,0xDC87,0xD447,0xD467,0xD447,0xD447,0xDC67,0x78E1,0xAAC4,0xDC67,0xD447,0xD447,0xD447,0xD447,0xDC67,0x8142,0x6000,0x9A64,0xDC87,0xD447,0xD447,0xC3C6,0xC3A6,0xC3A6,0xC3C6,0xB325,0x6020,0x6000,0x6000,0x6000,0x6000,0x9A43,0xDC87,0xD447,0xD426,0xB325,0xB325,0xBB65,0xD447,0xD447,0xDC67,0xC3A5,0x6040,0xBB65,0xDC67,0xDC87,0xAAC4,0x6000,0x6000,0x6000,0x6000,0x6000,0x7901,0xD447,0xD447,0xDC67,0x7901,0xA264,0xDC87,0xD447,0xD447,0xD467,0xCC06,0x70A1,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xC386,0xDC67,0xDC67,0xB325,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6880,0xCC06,0xD447,0xDC67,0xA2A4,0x70A1,0xD426,0xD447,0xDC87,0x9A23,0x6000,0x6840,0xCC06,0xD467,0xD447,0xCBE6,0xD446,0xD447,0xDC67,0x9A64,0xCBE6,0xD447,0xDC67,0xBB45,0xCBE6,0xD447,0xDC67,0x8182,0x6000,0xAAE5,0xDC67,0xD447,0xD447,0xDC67,0xDC67,0xDC67,0xE487,0xB345,0x6000,0x6000,0x6000,0x6000,0x6000,0xAAE4,0xDC87,0xD447,0xD447,0xDC67,0xDC67,0xDC67,0xD447,0xD447,0xDC67,0x8162,0x6020,0xCBE6,0xD467,0xDC87,0x91C3,0x6000,0x6000,0x6000,0x6000,0x6000,0x7901,0xD447,0xD447,0xDC67,0x7901,0x70A1,0xD446,0xD447,0xD447,0xDC67,0x91E3,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xD426,0xD447,0xDC87,0x91C3,0x6000,0x6000,0x6840,0xB305,0xBB45,0xBB45,0xBB45,0xBB45,0xBB45,0x6860,0x91E3,0xDC87,0xD447,0xD447,0xC3C6,0xC3A6,0xD447,0xD447,0xDC87,0xA2A4,0x6000,0x8162,0xDC67,0xD447,0xD447,0x9203,0xCC06,0xD447,0xD447,0xCC06,0xD447,0xD447,0xD447,0x8162,0xC3C6,0xD467,0xDC87,0x89C3,0x6000,0xBB85,0xDC67,0xD447,0xDC67,0xDC67,0xDC67,0xDC67,0xE4A7,0xA284,0x6000,0x6000,0x6000,0x6000,0x6000,0xBB65,0xDC67,0xD447,0xDC67,0xDC67,0xDC67,0xDC67,0xD447,0xD447,0xDC67,0xBB65,0x70C1,0xCC26,0xD447,0xDC67,0x8142,0x6000,0x6000,0x6000,0x6000,0x6000,0x8162,0xDC67,0xD447,0xD447,0x70C1,0x6020,0xCBE6,0xD447,0xDC67,0xBB45,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xD447,0xD447,0xDC87,0x89C3,0x6000,0x6000,0x70A1,0xD447,0xDC67,0xDC67,0xDC67,0xDC67,0xD447,0x6881,0xBB85,0xDC67,0xD447,0xD447,0xD467,0xDC67,0xD447,0xD447,0xDC67,0xB305,0x6000,0xAAC4,0xDC87,0xD447,0xCBE6,0x6881,0xC3A6,0xDC67,0xD447,0xD447,0xD447,0xDC67,0xBB85,0x6020,0xC3C6,0xDC67,0xDC87,0x91E3,0x6020,0xCBE6,0xD467,0xD447,0xC3C6,0xBB85,0xBB85,0xBB85,0xC3A6,0x8982,0x6000,0x6000,0x6000,0x6000,0x6040,0xC3C6,0xD467,0xD447,0xC3A6,0xBB65,0xBB65,0xBB85,0xD446,0xD447,0xD447,0xD447,0x91E3,0xCC26,0xD447,0xDC67,0x8142,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A43,0xDC87,0xD447,0xCC06,0x6040,0x70A1,0xD446,0xD447,0xDC87,0x9A23,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xCC06,0xD447,0xDC67,0xB325,0x6000,0x6000,0x7901,0xDC87,0xDC67,0xD447,0xD447,0xD467,0xC3C6,0x8162,0xDC47,0xD447,0xD447,0xDC67,0xDC67,0xDC67,0xD467,0xD447,0xDC67,0xBB65,0x6840,0xCBE6,0xD467,0xDC87,0xAAE4,0x6000,0xB325,0xDC67,0xD447,0xD447,0xD447,0xDC87,0x91E3,0x6000,0xC385,0xDC67,0xDC87,0x9203,0x6880,0xD426,0xD447,0xDC67,0x8162,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x70A1,0xCC26,0xD447,0xDC67,0x7922,0x6000,0x6000,0x6000,0x91E3,0xDC67,0xD447,0xDC67,0xA264,0xCC06,0xD447,0xDC87,0x91C3,0x6000,0x6000,0x6000,0x6000,0x6040,0xC3C6,0xDC67,0xDC67,0xB325,0x6000,0x8142,0xDC67,0xD447,0xDC87,0x89A2,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xBB45,0xDC67,0xD447,0xDC67,0x89A3,0x6000,0x6040,0x8122,0x7921,0xB325,0xDC67,0xDC67,0xBB85,0xAAE4,0xDC87,0xDC67,0xC3A6,0x7901,0x7901,0x7901,0xAAC4,0xDC67,0xDC67,0xC385,0x8982,0xDC67,0xD447,0xDC87,0x8982,0x6000,0xA264,0xDC87,0xD447,0xD447,0xD467,0xCC06,0x6860,0x6000,0xBB45,0xDC67,0xDC87,0x9A23,0x7901,0xDC67,0xD447,0xD467,0x70C1,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x7901,0xD467,0xD447,0xCC26,0x6860,0x6000,0x6000,0x6000,0x91E3,0xDC67,0xD447,0xDC67,0x91C3,0xC3C6,0xD467,0xDC67,0xBB65,0x6020,0x6000,0x6000,0x6000,0xAAC4,0xDC67,0xD447,0xDC87,0x8982,0x6000,0x91C3,0xDC87,0xD447,0xDC67,0x7901,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x89A2,0xDC87,0xD447,0xD447,0xD447,0xA284,0x7921,0x70E1,0x8162,0xC3C6,0xDC67,0xD467,0xC3E6,0xCC06,0xD447,0xDC87,0x9A43,0x6000,0x6000,0x6000,0x91C3,0xDC87,0xD447,0xCBE6,0xB325,0xDC67,0xD447,0xCC06,0x6860,0x6000,0x89A2,0xDC87,0xD447,0xD447,0xDC87,0xAAA4,0x6000,0x6000,0xB305,0xDC87,0xDC87,0x9A64,0x89A2,0xDC87,0xD447,0xD447,0xA284,0x9A43,0x9A43,0x9A43,0xA264,0x8162,0x6000,0x6000,0x6000,0x6000,0x89A2,0xDC87,0xD447,0xCC26,0xA284,0xA264,0xA264,0xAAE4,0xD426,0xD447,0xD447,0xD447,0x7081,0xAAE4,0xDC87,0xD447,0xDC67,0xB325,0x8982,0x89A2,0xBB65,0xDC67,0xD447,0xDC87,0xB325,0x6000,0x6000,0xA264,0xDC87,0xD447,0xD446,0x70A1,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xAAE5,0xE487,0xD447,0xD447,0xDC87,0xDC67,0xD467,0xDC67,0xD467,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0x70C1,0x6000,0x6000,0x6000,0x8162,0xDC67,0xD447,0xD447,0xD447,0xD447,0xDC67,0xB305,0x6000,0x6000,0x78E1,0xD467,0xD447,0xD447,0xD447,0x78E1,0x6000,0x6000,0xAAC4,0xDC87,0xDC87,0xA284,0x9A43,0xDC87,0xD447,0xD447,0xDC67,0xDC87,0xDC87,0xDC87,0xECA7,0xA284,0x6000,0x6000,0x6000,0x6000,0x9A23,0xDC87,0xD447,0xD447,0xDC87,0xDC87,0xDC87,0xDC87,0xD447,0xD447,0xE487,0xAAC4,0x6000,0x78E1,0xD447,0xDC67,0xD447,0xDC67,0xDC67,0xDC67,0xDC67,0xD447,0xDC87,0xC3A6,0x6880,0x6000,0x6000,0xAAE5,0xDC87,0xD467,0xCBE6,0x6040,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6040,0xA2A4,0xD447,0xDC87,0xDC67,0xD447,0xD447,0xD447,0xDC67,0xDC87,0xDC67,0xDC67,0xDC67,0xE487,0xBB65,0x6000,0x6000,0x6000,0x6000,0x78E1,0xD467,0xD447,0xD447,0xD447,0xD447,0xDC87,0x89A2,0x6000,0x6000,0x6860,0xCC26,0xD467,0xDC67,0xBB65,0x6000,0x6000,0x6000,0xA284,0xE487,0xDC87,0xAAE4,0xAAE4,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC87,0x89C3,0x6000,0x6000,0x6000,0x6000,0xAAC4,0xE487,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC87,0xDC67,0xB305,0x6840,0x6000,0x6000,0x8982,0xD426,0xDC87,0xDC67,0xD447,0xDC67,0xDC87,0xDC67,0xB305,0x6880,0x6000,0x6000,0x6000,0xBB85,0xDC87,0xDC87,0xC386,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x7901,0xAAC4,0xC3C6,0xD426,0xD447,0xD426,0xC3C6,0xAAA4,0xA264,0xC3C6,0xC3A6,0xCBC6,0x89A2,0x6000,0x6000,0x6000,0x6000,0x6860,0xC3E6,0xCC06,0xCC06,0xCC06,0xCC06,0xCBE6,0x6880,0x6000,0x6000,0x6000,0xBB65,0xD426,0xD447,0x89A2,0x6000,0x6000,0x6000,0x9A23,0xD447,0xD446,0xB305,0xB345,0xD426,0xCC06,0xCC06,0xCC06,0xCC06,0xCC06,0xCC06,0xD426,0x7922,0x6000,0x6000,0x6000,0x6000,0xAAC4,0xCBC6,0xC3A6,0xC3A6,0xC3A6,0xC3A6,0xC3A6,0xBB65,0xAAA4,0x8142,0x6000,0x6000,0x6000,0x6000,0x6000,0x70C1,0xAAA4,0xC3A6,0xCC06,0xCBE6,0xB2E5,0x8142,0x6000,0x6000,0x6000,0x6000,0x6020,0xBB45,0xC3C6,0xCBC6,0xA2A4,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0x7081,0x78E1,0x70A1,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6860,0x6860,0x6860,0x6860,0x6860,0x6860,0x6000,0x6000,0x6000,0x6000,0x6840,0x6860,0x6860,0x6000,0x6000,0x6000,0x6000,0x6020,0x6860,0x6860,0x6840,0x6860,0x6860,0x6860,0x6860,0x6860,0x6860,0x6860,0x6860,0x6860,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0x6860,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
+    0x40, 0x01, 0x20, 0x00, 0x42, 0x00, 0x00, 0x60, 0x20, 0x60, 0x40, 0x60, 0x40, 0x68, 0x60, 0x68,
+    0x80, 0x68, 0x81, 0x68, 0x81, 0x70, 0xa1, 0x70, 0xc1, 0x70, 0xe1, 0x70, 0xe1, 0x78, 0x01, 0x79,
+    0x21, 0x79, 0x22, 0x79, 0x22, 0x81, 0x42, 0x81, 0x62, 0x81, 0x82, 0x81, 0x82, 0x89, 0xa2, 0x89,
+    0xa3, 0x89, 0xc2, 0x89, 0xc3, 0x89, 0xc3, 0x91, 0xe3, 0x91, 0x03, 0x92, 0x03, 0x9a, 0x23, 0x9a,
+    0x43, 0x9a, 0x64, 0x9a, 0x64, 0xa2, 0x84, 0xa2, 0xa4, 0xa2, 0xa4, 0xaa, 0xc4, 0xaa, 0xe4, 0xaa,
+    0xe5, 0xaa, 0xe4, 0xb2, 0xe5, 0xb2, 0x05, 0xb3, 0x25, 0xb3, 0x45, 0xb3, 0x45, 0xbb, 0x65, 0xbb,
+    0x85, 0xbb, 0x85, 0xc3, 0x86, 0xc3, 0xa5, 0xc3, 0xa6, 0xc3, 0xc6, 0xc3, 0xe6, 0xc3, 0xc6, 0xcb,
+    0xe6, 0xcb, 0x06, 0xcc, 0x26, 0xcc, 0x26, 0xd4, 0x46, 0xd4, 0x47, 0xd4, 0x67, 0xd4, 0x47, 0xdc,
+    0x67, 0xdc, 0x87, 0xdc, 0x87, 0xe4, 0xa7, 0xe4, 0xa7, 0xec, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
+    0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xd5, 0x00, 0x01, 0x01, 0x05, 0x00,
+    0x04, 0x01, 0x05, 0x00, 0x02, 0x01, 0x04, 0x00, 0x03, 0x01, 0x02, 0x00, 0x00, 0x04, 0x00, 0x08,
+    0x05, 0x06, 0x00, 0x08, 0x00, 0x03, 0x03, 0x00, 0x06, 0x01, 0x09, 0x00, 0x00, 0x01, 0x00, 0x02,
+    0x02, 0x00, 0x03, 0x01, 0x07, 0x00, 0x00, 0x01, 0xe8, 0x00, 0x00, 0x0c, 0x00, 0x1c, 0x00, 0x28,
+    0x00, 0x2e, 0x01, 0x32, 0x00, 0x2c, 0x00, 0x26, 0x00, 0x09, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x35,
+    0x01, 0x32, 0x00, 0x36, 0x00, 0x24, 0x04, 0x00, 0x00, 0x22, 0x00, 0x36, 0x00, 0x32, 0x00, 0x35,
+    0x00, 0x0b, 0x02, 0x00, 0x00, 0x11, 0x00, 0x36, 0x00, 0x32, 0x00, 0x35, 0x00, 0x2f, 0x00, 0x03,
+    0x01, 0x00, 0x00, 0x24, 0x00, 0x3d, 0x05, 0x38, 0x00, 0x3d, 0x00, 0x18, 0x03, 0x00, 0x00, 0x23,
+    0x00, 0x36, 0x04, 0x32, 0x00, 0x2b, 0x00, 0x14, 0x04, 0x00, 0x00, 0x01, 0x00, 0x19, 0x00, 0x2b,
+    0x00, 0x32, 0x00, 0x35, 0x00, 0x31, 0x00, 0x22, 0x00, 0x08, 0x00, 0x0c, 0x00, 0x35, 0x00, 0x32,
+    0x00, 0x36, 0x00, 0x1c, 0x02, 0x00, 0x00, 0x04, 0x00, 0x2c, 0x00, 0x31, 0x00, 0x34, 0x00, 0x28,
+    0x00, 0x01, 0xe5, 0x00, 0x00, 0x13, 0x00, 0x2c, 0x00, 0x3a, 0x01, 0x3e, 0x03, 0x3d, 0x00, 0x3f,
+    0x00, 0x0c, 0x01, 0x00, 0x00, 0x23, 0x00, 0x3f, 0x01, 0x3d, 0x00, 0x3e, 0x00, 0x31, 0x03, 0x00,
+    0x00, 0x04, 0x00, 0x36, 0x01, 0x3d, 0x00, 0x3f, 0x00, 0x17, 0x02, 0x00, 0x00, 0x29, 0x00, 0x3e,
+    0x01, 0x3d, 0x00, 0x38, 0x00, 0x05, 0x01, 0x00, 0x00, 0x2d, 0x00, 0x3d, 0x05, 0x3a, 0x00, 0x3d,
+    0x00, 0x0e, 0x03, 0x00, 0x00, 0x31, 0x00, 0x3e, 0x05, 0x3d, 0x00, 0x3e, 0x00, 0x20, 0x02, 0x00,
+    0x00, 0x09, 0x00, 0x2e, 0x00, 0x3e, 0x01, 0x3d, 0x00, 0x3b, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x38,
+    0x00, 0x13, 0x00, 0x2d, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x35, 0x00, 0x02, 0x01, 0x00, 0x00, 0x22,
+    0x00, 0x3f, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x11, 0xe4, 0x00, 0x00, 0x04, 0x00, 0x27, 0x01, 0x3d,
+    0x00, 0x3a, 0x00, 0x3b, 0x01, 0x3e, 0x01, 0x3d, 0x00, 0x3e, 0x00, 0x3a, 0x00, 0x06, 0x00, 0x00,
+    0x00, 0x05, 0x00, 0x37, 0x02, 0x3a, 0x00, 0x3b, 0x00, 0x35, 0x00, 0x02, 0x02, 0x00, 0x00, 0x13,
+    0x00, 0x3d, 0x01, 0x3a, 0x00, 0x3e, 0x00, 0x20, 0x01, 0x00, 0x00, 0x08, 0x03, 0x3a, 0x00, 0x38,
+    0x00, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x35, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x3d, 0x03, 0x3e,
+    0x00, 0x3a, 0x00, 0x06, 0x02, 0x00, 0x00, 0x03, 0x00, 0x36, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x3d,
+    0x01, 0x3e, 0x00, 0x3b, 0x01, 0x3a, 0x00, 0x3d, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x05, 0x00, 0x32,
+    0x00, 0x3e, 0x00, 0x3a, 0x00, 0x3d, 0x00, 0x3e, 0x01, 0x3d, 0x00, 0x3a, 0x00, 0x3d, 0x00, 0x35,
+    0x00, 0x1f, 0x00, 0x3d, 0x00, 0x3a, 0x00, 0x3e, 0x00, 0x19, 0x00, 0x00, 0x00, 0x10, 0x00, 0x3d,
+    0x00, 0x3a, 0x00, 0x3e, 0x00, 0x23, 0xe4, 0x00, 0x00, 0x03, 0x00, 0x2c, 0x00, 0x3f, 0x01, 0x3a,
+    0x00, 0x3e, 0x00, 0x35, 0x00, 0x23, 0x00, 0x18, 0x00, 0x11, 0x00, 0x13, 0x00, 0x1b, 0x00, 0x20,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x3e, 0x03, 0x3a, 0x00, 0x38, 0x00, 0x06, 0x02, 0x00,
+    0x00, 0x24, 0x00, 0x3e, 0x01, 0x3a, 0x00, 0x3d, 0x00, 0x29, 0x01, 0x00, 0x00, 0x1c, 0x00, 0x3e,
+    0x03, 0x3a, 0x00, 0x09, 0x00, 0x00, 0x00, 0x08, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x2a,
+    0x02, 0x22, 0x00, 0x23, 0x00, 0x1f, 0x00, 0x01, 0x02, 0x00, 0x00, 0x08, 0x01, 0x3a, 0x00, 0x3b,
+    0x00, 0x2c, 0x00, 0x22, 0x00, 0x24, 0x00, 0x35, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x3e, 0x00, 0x1d,
+    0x00, 0x00, 0x00, 0x24, 0x00, 0x3e, 0x00, 0x3a, 0x00, 0x3d, 0x00, 0x2d, 0x00, 0x18, 0x00, 0x11,
+    0x00, 0x24, 0x00, 0x3d, 0x00, 0x3a, 0x00, 0x3e, 0x00, 0x25, 0x00, 0x31, 0x01, 0x3d, 0x00, 0x30,
+    0x00, 0x04, 0x00, 0x31, 0x01, 0x3d, 0x00, 0x36, 0x00, 0x04, 0xe4, 0x00, 0x00, 0x23, 0x00, 0x3f,
+    0x00, 0x3a, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x1d, 0x00, 0x04, 0x06, 0x00, 0x00, 0x01, 0x00, 0x2d,
+    0x00, 0x3d, 0x04, 0x3a, 0x00, 0x0a, 0x01, 0x00, 0x00, 0x03, 0x00, 0x36, 0x00, 0x3b, 0x01, 0x3a,
+    0x00, 0x3d, 0x00, 0x31, 0x01, 0x01, 0x00, 0x32, 0x00, 0x3d, 0x02, 0x3a, 0x00, 0x3b, 0x00, 0x0b,
+    0x00, 0x00, 0x00, 0x0e, 0x00, 0x3d, 0x00, 0x3a, 0x00, 0x3b, 0x00, 0x0b, 0x08, 0x00, 0x00, 0x0f,
+    0x00, 0x3d, 0x00, 0x3a, 0x00, 0x3d, 0x00, 0x0f, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x3d, 0x00, 0x3a,
+    0x00, 0x3e, 0x00, 0x1c, 0x00, 0x09, 0x01, 0x3a, 0x00, 0x3d, 0x00, 0x28, 0x00, 0x01, 0x02, 0x00,
+    0x00, 0x29, 0x00, 0x3d, 0x00, 0x3b, 0x00, 0x31, 0x00, 0x20, 0x00, 0x3e, 0x01, 0x3a, 0x00, 0x2c,
+    0x00, 0x3b, 0x00, 0x3a, 0x00, 0x3d, 0x00, 0x14, 0xe4, 0x00, 0x00, 0x0c, 0x01, 0x3a, 0x00, 0x3b,
+    0x00, 0x38, 0x00, 0x10, 0x08, 0x00, 0x00, 0x0e, 0x00, 0x3d, 0x01, 0x3a, 0x00, 0x29, 0x00, 0x39,
+    0x00, 0x3a, 0x00, 0x3d, 0x00, 0x10, 0x01, 0x00, 0x00, 0x11, 0x00, 0x3d, 0x03, 0x3a, 0x00, 0x37,
+    0x00, 0x03, 0x00, 0x0f, 0x00, 0x3d, 0x03, 0x3a, 0x00, 0x3d, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x16,
+    0x00, 0x3e, 0x00, 0x3a, 0x00, 0x38, 0x00, 0x08, 0x08, 0x00, 0x00, 0x16, 0x00, 0x3e, 0x00, 0x3a,
+    0x00, 0x37, 0x00, 0x06, 0x01, 0x00, 0x00, 0x1a, 0x00, 0x3d, 0x00, 0x3a, 0x00, 0x3e, 0x00, 0x10,
+    0x00, 0x1d, 0x00, 0x3e, 0x00, 0x3a, 0x00, 0x36, 0x00, 0x04, 0x03, 0x00, 0x00, 0x13, 0x00, 0x3d,
+    0x00, 0x3a, 0x00, 0x39, 0x00, 0x11, 0x00, 0x35, 0x01, 0x3a, 0x00, 0x3d, 0x00, 0x3a, 0x00, 0x3e,
+    0x00, 0x28, 0xe5, 0x00, 0x00, 0x21, 0x00, 0x3e, 0x00, 0x3a, 0x00, 0x3d, 0x00, 0x13, 0x09, 0x00,
+    0x00, 0x23, 0x00, 0x3e, 0x00, 0x3b, 0x00, 0x33, 0x00, 0x11, 0x01, 0x3a, 0x00, 0x3e, 0x00, 0x16,
+    0x01, 0x00, 0x00, 0x24, 0x00, 0x3e, 0x00, 0x3a, 0x00, 0x3b, 0x01, 0x3a, 0x00, 0x3d, 0x00, 0x0b,
+    0x00, 0x23, 0x00, 0x3d, 0x03, 0x3a, 0x00, 0x3d, 0x00, 0x10, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x3e,
+    0x01, 0x3a, 0x00, 0x32, 0x01, 0x31, 0x00, 0x32, 0x00, 0x29, 0x00, 0x01, 0x03, 0x00, 0x00, 0x1d,
+    0x00, 0x3e, 0x00, 0x3a, 0x00, 0x38, 0x01, 0x29, 0x00, 0x2c, 0x01, 0x3a, 0x00, 0x3d, 0x00, 0x30,
+    0x00, 0x02, 0x00, 0x2c, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x23, 0x04, 0x00, 0x00, 0x0c, 0x01, 0x3a,
+    0x00, 0x3d, 0x00, 0x0c, 0x00, 0x1f, 0x00, 0x3e, 0x01, 0x3a, 0x00, 0x3b, 0x00, 0x36, 0x00, 0x08,
+    0xe5, 0x00, 0x00, 0x2f, 0x01, 0x3d, 0x00, 0x29, 0x09, 0x00, 0x00, 0x05, 0x00, 0x36, 0x00, 0x3a,
+    0x00, 0x3d, 0x00, 0x21, 0x00, 0x08, 0x00, 0x38, 0x00, 0x3a, 0x00, 0x3e, 0x00, 0x1c, 0x00, 0x00,
+    0x00, 0x03, 0x00, 0x36, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x35, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x3d,
+    0x00, 0x1e, 0x00, 0x35, 0x00, 0x3a, 0x00, 0x3d, 0x00, 0x2b, 0x00, 0x35, 0x00, 0x3a, 0x00, 0x3d,
+    0x00, 0x12, 0x00, 0x00, 0x00, 0x25, 0x00, 0x3d, 0x01, 0x3a, 0x02, 0x3d, 0x00, 0x3f, 0x00, 0x2a,
+    0x04, 0x00, 0x00, 0x24, 0x00, 0x3e, 0x01, 0x3a, 0x02, 0x3d, 0x01, 0x3a, 0x00, 0x3d, 0x00, 0x11,
+    0x00, 0x01, 0x00, 0x35, 0x00, 0x3b, 0x00, 0x3e, 0x00, 0x18, 0x04, 0x00, 0x00, 0x0c, 0x01, 0x3a,
+    0x00, 0x3d, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x39, 0x01, 0x3a, 0x00, 0x3d, 0x00, 0x19, 0xe6, 0x00,
+    0x00, 0x38, 0x00, 0x3a, 0x00, 0x3e, 0x00, 0x18, 0x01, 0x00, 0x00, 0x03, 0x00, 0x28, 0x04, 0x2b,
+    0x00, 0x04, 0x00, 0x19, 0x00, 0x3e, 0x01, 0x3a, 0x00, 0x32, 0x00, 0x31, 0x01, 0x3a, 0x00, 0x3e,
+    0x00, 0x21, 0x00, 0x00, 0x00, 0x11, 0x00, 0x3d, 0x01, 0x3a, 0x00, 0x1a, 0x00, 0x36, 0x01, 0x3a,
+    0x00, 0x36, 0x02, 0x3a, 0x00, 0x11, 0x00, 0x32, 0x00, 0x3b, 0x00, 0x3e, 0x00, 0x17, 0x00, 0x00,
+    0x00, 0x2d, 0x00, 0x3d, 0x00, 0x3a, 0x03, 0x3d, 0x00, 0x40, 0x00, 0x20, 0x04, 0x00, 0x00, 0x2c,
+    0x00, 0x3d, 0x00, 0x3a, 0x03, 0x3d, 0x01, 0x3a, 0x00, 0x3d, 0x00, 0x2c, 0x00, 0x09, 0x00, 0x37,
+    0x00, 0x3a, 0x00, 0x3d, 0x00, 0x10, 0x04, 0x00, 0x00, 0x11, 0x00, 0x3d, 0x01, 0x3a, 0x00, 0x09,
+    0x00, 0x01, 0x00, 0x35, 0x00, 0x3a, 0x00, 0x3d, 0x00, 0x2b, 0x00, 0x01, 0xe6, 0x00, 0x01, 0x3a,
+    0x00, 0x3e, 0x00, 0x17, 0x01, 0x00, 0x00, 0x08, 0x00, 0x3a, 0x03, 0x3d, 0x00, 0x3a, 0x00, 0x06,
+    0x00, 0x2d, 0x00, 0x3d, 0x01, 0x3a, 0x00, 0x3b, 0x00, 0x3d, 0x01, 0x3a, 0x00, 0x3d, 0x00, 0x28,
+    0x00, 0x00, 0x00, 0x23, 0x00, 0x3e, 0x00, 0x3a, 0x00, 0x35, 0x00, 0x06, 0x00, 0x31, 0x00, 0x3d,
+    0x02, 0x3a, 0x00, 0x3d, 0x00, 0x2d, 0x00, 0x01, 0x00, 0x32, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x19,
+    0x00, 0x01, 0x00, 0x35, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x32, 0x02, 0x2d, 0x00, 0x31, 0x00, 0x13,
+    0x03, 0x00, 0x00, 0x02, 0x00, 0x32, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x31, 0x01, 0x2c, 0x00, 0x2d,
+    0x00, 0x39, 0x02, 0x3a, 0x00, 0x19, 0x00, 0x37, 0x00, 0x3a, 0x00, 0x3d, 0x00, 0x10, 0x04, 0x00,
+    0x00, 0x1d, 0x00, 0x3e, 0x00, 0x3a, 0x00, 0x36, 0x00, 0x02, 0x00, 0x08, 0x00, 0x39, 0x00, 0x3a,
+    0x00, 0x3e, 0x00, 0x1c, 0xe7, 0x00, 0x00, 0x36, 0x00, 0x3a, 0x00, 0x3d, 0x00, 0x29, 0x01, 0x00,
+    0x00, 0x0c, 0x00, 0x3e, 0x00, 0x3d, 0x01, 0x3a, 0x00, 0x3b, 0x00, 0x32, 0x00, 0x11, 0x00, 0x3c,
+    0x01, 0x3a, 0x02, 0x3d, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x3d, 0x00, 0x2c, 0x00, 0x03, 0x00, 0x35,
+    0x00, 0x3b, 0x00, 0x3e, 0x00, 0x24, 0x00, 0x00, 0x00, 0x29, 0x00, 0x3d, 0x02, 0x3a, 0x00, 0x3e,
+    0x00, 0x19, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x1a, 0x00, 0x05, 0x00, 0x38,
+    0x00, 0x3a, 0x00, 0x3d, 0x00, 0x11, 0x08, 0x00, 0x00, 0x08, 0x00, 0x37, 0x00, 0x3a, 0x00, 0x3d,
+    0x00, 0x0e, 0x02, 0x00, 0x00, 0x19, 0x00, 0x3d, 0x00, 0x3a, 0x00, 0x3d, 0x00, 0x1f, 0x00, 0x36,
+    0x00, 0x3a, 0x00, 0x3e, 0x00, 0x18, 0x03, 0x00, 0x00, 0x02, 0x00, 0x32, 0x01, 0x3d, 0x00, 0x29,
+    0x00, 0x00, 0x00, 0x10, 0x00, 0x3d, 0x00, 0x3a, 0x00, 0x3e, 0x00, 0x14, 0xe7, 0x00, 0x00, 0x2b,
+    0x00, 0x3d, 0x00, 0x3a, 0x00, 0x3d, 0x00, 0x15, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0f, 0x00, 0x0d,
+    0x00, 0x29, 0x01, 0x3d, 0x00, 0x2d, 0x00, 0x24, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x31, 0x02, 0x0c,
+    0x00, 0x23, 0x01, 0x3d, 0x00, 0x2e, 0x00, 0x13, 0x00, 0x3d, 0x00, 0x3a, 0x00, 0x3e, 0x00, 0x13,
+    0x00, 0x00, 0x00, 0x1f, 0x00, 0x3e, 0x01, 0x3a, 0x00, 0x3b, 0x00, 0x36, 0x00, 0x04, 0x00, 0x00,
+    0x00, 0x2b, 0x00, 0x3d, 0x00, 0x3e, 0x00, 0x1c, 0x00, 0x0c, 0x00, 0x3d, 0x00, 0x3a, 0x00, 0x3b,
+    0x00, 0x09, 0x08, 0x00, 0x00, 0x0c, 0x00, 0x3b, 0x00, 0x3a, 0x00, 0x37, 0x00, 0x04, 0x02, 0x00,
+    0x00, 0x19, 0x00, 0x3d, 0x00, 0x3a, 0x00, 0x3d, 0x00, 0x18, 0x00, 0x32, 0x00, 0x3b, 0x00, 0x3d,
+    0x00, 0x2c, 0x00, 0x01, 0x02, 0x00, 0x00, 0x23, 0x00, 0x3d, 0x00, 0x3a, 0x00, 0x3e, 0x00, 0x13,
+    0x00, 0x00, 0x00, 0x18, 0x00, 0x3e, 0x00, 0x3a, 0x00, 0x3d, 0x00, 0x0c, 0xe7, 0x00, 0x00, 0x14,
+    0x00, 0x3e, 0x02, 0x3a, 0x00, 0x20, 0x00, 0x0d, 0x00, 0x0a, 0x00, 0x11, 0x00, 0x32, 0x00, 0x3d,
+    0x00, 0x3b, 0x00, 0x33, 0x00, 0x36, 0x00, 0x3a, 0x00, 0x3e, 0x00, 0x1d, 0x02, 0x00, 0x00, 0x18,
+    0x00, 0x3e, 0x00, 0x3a, 0x00, 0x35, 0x00, 0x29, 0x00, 0x3d, 0x00, 0x3a, 0x00, 0x36, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x14, 0x00, 0x3e, 0x01, 0x3a, 0x00, 0x3e, 0x00, 0x22, 0x01, 0x00, 0x00, 0x28,
+    0x01, 0x3e, 0x00, 0x1e, 0x00, 0x14, 0x00, 0x3e, 0x01, 0x3a, 0x00, 0x20, 0x02, 0x1d, 0x00, 0x1f,
+    0x00, 0x11, 0x03, 0x00, 0x00, 0x14, 0x00, 0x3e, 0x00, 0x3a, 0x00, 0x37, 0x00, 0x20, 0x01, 0x1f,
+    0x00, 0x24, 0x00, 0x38, 0x02, 0x3a, 0x00, 0x07, 0x00, 0x24, 0x00, 0x3e, 0x00, 0x3a, 0x00, 0x3d,
+    0x00, 0x29, 0x00, 0x13, 0x00, 0x14, 0x00, 0x2c, 0x00, 0x3d, 0x00, 0x3a, 0x00, 0x3e, 0x00, 0x29,
+    0x01, 0x00, 0x00, 0x1f, 0x00, 0x3e, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x08, 0xe8, 0x00, 0x00, 0x25,
+    0x00, 0x3f, 0x01, 0x3a, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3b, 0x00, 0x3d, 0x00, 0x3b, 0x05, 0x3a,
+    0x00, 0x09, 0x02, 0x00, 0x00, 0x11, 0x00, 0x3d, 0x03, 0x3a, 0x00, 0x3d, 0x00, 0x28, 0x01, 0x00,
+    0x00, 0x0b, 0x00, 0x3b, 0x02, 0x3a, 0x00, 0x0b, 0x01, 0x00, 0x00, 0x23, 0x01, 0x3e, 0x00, 0x20,
+    0x00, 0x1d, 0x00, 0x3e, 0x01, 0x3a, 0x00, 0x3d, 0x02, 0x3e, 0x00, 0x41, 0x00, 0x20, 0x03, 0x00,
+    0x00, 0x1c, 0x00, 0x3e, 0x01, 0x3a, 0x03, 0x3e, 0x01, 0x3a, 0x00, 0x3f, 0x00, 0x23, 0x00, 0x00,
+    0x00, 0x0b, 0x00, 0x3a, 0x00, 0x3d, 0x00, 0x3a, 0x03, 0x3d, 0x00, 0x3a, 0x00, 0x3e, 0x00, 0x31,
+    0x00, 0x05, 0x01, 0x00, 0x00, 0x25, 0x00, 0x3e, 0x00, 0x3b, 0x00, 0x35, 0x00, 0x02, 0xe8, 0x00,
+    0x00, 0x02, 0x00, 0x21, 0x00, 0x3a, 0x00, 0x3e, 0x00, 0x3d, 0x02, 0x3a, 0x00, 0x3d, 0x00, 0x3e,
+    0x02, 0x3d, 0x00, 0x3f, 0x00, 0x2c, 0x03, 0x00, 0x00, 0x0b, 0x00, 0x3b, 0x03, 0x3a, 0x00, 0x3e,
+    0x00, 0x14, 0x01, 0x00, 0x00, 0x04, 0x00, 0x37, 0x00, 0x3b, 0x00, 0x3d, 0x00, 0x2c, 0x02, 0x00,
+    0x00, 0x20, 0x00, 0x3f, 0x00, 0x3e, 0x01, 0x24, 0x00, 0x3e, 0x05, 0x3a, 0x00, 0x3e, 0x00, 0x17,
+    0x03, 0x00, 0x00, 0x23, 0x00, 0x3f, 0x05, 0x3d, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x28, 0x00, 0x03,
+    0x01, 0x00, 0x00, 0x13, 0x00, 0x38, 0x00, 0x3e, 0x00, 0x3d, 0x00, 0x3a, 0x00, 0x3d, 0x00, 0x3e,
+    0x00, 0x3d, 0x00, 0x28, 0x00, 0x05, 0x02, 0x00, 0x00, 0x2d, 0x01, 0x3e, 0x00, 0x2f, 0xeb, 0x00,
+    0x00, 0x0c, 0x00, 0x23, 0x00, 0x32, 0x00, 0x38, 0x00, 0x3a, 0x00, 0x38, 0x00, 0x32, 0x00, 0x22,
+    0x00, 0x1f, 0x00, 0x32, 0x00, 0x31, 0x00, 0x34, 0x00, 0x14, 0x03, 0x00, 0x00, 0x04, 0x00, 0x33,
+    0x03, 0x36, 0x00, 0x35, 0x00, 0x05, 0x02, 0x00, 0x00, 0x2c, 0x00, 0x38, 0x00, 0x3a, 0x00, 0x14,
+    0x02, 0x00, 0x00, 0x1c, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x28, 0x00, 0x2a, 0x00, 0x38, 0x05, 0x36,
+    0x00, 0x38, 0x00, 0x0e, 0x03, 0x00, 0x00, 0x23, 0x00, 0x34, 0x04, 0x31, 0x00, 0x2c, 0x00, 0x22,
+    0x00, 0x10, 0x04, 0x00, 0x00, 0x09, 0x00, 0x22, 0x00, 0x31, 0x00, 0x36, 0x00, 0x35, 0x00, 0x27,
+    0x00, 0x10, 0x03, 0x00, 0x00, 0x01, 0x00, 0x2b, 0x00, 0x32, 0x00, 0x34, 0x00, 0x21, 0xed, 0x00,
+    0x00, 0x01, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x08, 0x00, 0x01, 0x0a, 0x00, 0x05, 0x04, 0x03, 0x00,
+    0x00, 0x03, 0x01, 0x04, 0x03, 0x00, 0x00, 0x01, 0x01, 0x04, 0x00, 0x03, 0x08, 0x04, 0x0a, 0x00,
+    0x00, 0x01, 0x09, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
+    0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xa7, 0x00,
 #endif /* GNW_TARGET_ZELDA */
 };
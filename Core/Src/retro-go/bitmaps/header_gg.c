@@ -1,73 +1,506 @@
+// Packed bitmap, see bitmaps.h. Generated by tools/img2bin.py --lut8-rle
 #if !defined(GNW_TARGET_ZELDA)
 #define GNW_TARGET_ZELDA 0
 #endif /* GNW_TARGET_ZELDA */
 
-const unsigned short header_gg[] = {
+const unsigned char header_gg[] __attribute__((aligned(4))) = {
 #if GNW_TARGET_ZELDA != 0
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x43E4,0x9468,0xA4A9,0x33A3,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x2BA3,0x7C47,0xB4C9,0x5BE5,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1362,0x6405,0xACA9,0x8447,0x0B41,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x53E5,0xA4A9,0xD4A9,0xD488,0xD4A9,0xACA9,0x5BE5,0x0B41,0x0320,0x0320,0x0320,0x0320,0x0320,0x53E5,0x8C67,0x8447,0x8C67,0x43E5,0x0320,0x0320,0x0320,0x2382,0x7C47,0x7426,0x7426,0x7C46,0x4BE5,0x0320,0x0320,0x0320,0x0320,0x3BC4,0x8467,0x7C26,0x7C26,0x7C26,0x43E5,0x7C47,0x7C27,0x7C46,0x7C46,0x7C46,0x7C46,0x7C46,0x8447,0x6C06,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x4BE4,0xA489,0xD4A9,0xD488,0xD4A9,0xB4A9,0x5C05,0x0B41,0x0320,0x0320,0x0320,0x7426,0x8447,0x7C46,0x7C46,0x7C46,0x7C46,0x7C46,0x7C47,0x7C47,0x0B41,0x0320,0x0320,0x2B83,0x8447,0x8447,0x8447,0x6C47,0x0320,0x0320,0x0320,0x0B40,0x6426,0x8447,0x7C46,0x7C46,0x7C26,0x7C26,0x7426,0x53E5,0x0B41,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1361,0x9467,0xDC88,0xDC67,0xDC66,0xB447,0x0B41,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x6405,0xD488,0xDC87,0xDC46,0xDC87,0x33A3,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x33C4,0xBC88,0xDC87,0xDC46,0xE4A7,0x7405,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1361,0x9C68,0xDC88,0xDC66,0xD446,0xD446,0xD446,0xDC46,0xDC87,0xA467,0x1B82,0x0320,0x0320,0x0320,0x1B62,0xC488,0xDC66,0xDC67,0xE4A7,0x8C68,0x0320,0x0320,0x0320,0x4BC4,0xE4C8,0xDC67,0xDC67,0xE4A7,0x9C47,0x0320,0x0320,0x0320,0x0320,0xA467,0xE487,0xDC67,0xDC66,0xDC88,0x7C68,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xE487,0xAC68,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0B41,0x9C67,0xDC88,0xDC66,0xD446,0xD446,0xD446,0xDC46,0xDC87,0xA467,0x1361,0x0320,0x2BC4,0xD467,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC66,0xD4A9,0x1361,0x0320,0x0320,0x8C26,0xE487,0xDC67,0xDC87,0xC488,0x0320,0x0320,0x0320,0x1B61,0xDCA9,0xDC66,0xDC67,0xDC67,0xDC67,0xDC67,0xDC87,0xDCA8,0xA488,0x1361,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1B62,0xAC47,0xDC87,0xD446,0xD447,0xD446,0xD488,0x3BE5,0x0320,0x0320,0x0320,0x0320,0x0320,0x7C26,0xDC87,0xD446,0xD447,0xD447,0xDC67,0x7C68,0x0320,0x0320,0x0320,0x0320,0x0320,0x53E5,0xCC67,0xDC67,0xD446,0xD447,0xDC66,0xAC88,0x0B41,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1361,0xAC88,0xDC87,0xD446,0xD447,0xD447,0xD467,0xD447,0xD447,0xD446,0xDC87,0x9C47,0x0320,0x0320,0x0320,0x5BE5,0xDC87,0xD447,0xD447,0xDC87,0x9447,0x0320,0x0320,0x0320,0x6405,0xDC87,0xD447,0xD447,0xDC67,0x9C26,0x0320,0x0320,0x0320,0x33A3,0xD488,0xD447,0xD447,0xD446,0xBC88,0x7CA9,0xD446,0xD447,0xD447,0xD446,0xD446,0xD446,0xD446,0xDC67,0x8C88,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0B41,0xA467,0xE487,0xD446,0xD447,0xD447,0xD467,0xD447,0xD447,0xD446,0xDC87,0x9C47,0x0340,0x5406,0xDC88,0xD446,0xD447,0xD447,0xD446,0xD446,0xD446,0xDC66,0xAC88,0x0B41,0x0320,0x1B62,0xCC88,0xD446,0xD447,0xD467,0xC447,0x0B41,0x0320,0x0320,0x33A3,0xD467,0xD447,0xD447,0xD446,0xD446,0xD446,0xD447,0xD446,0xE487,0x8447,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1341,0xAC47,0xDC87,0xD447,0xD447,0xD447,0xD446,0xD488,0x43E5,0x0320,0x0320,0x0320,0x0320,0x7406,0xDC87,0xD447,0xD447,0xD447,0xD447,0xDC67,0x8468,0x0320,0x0320,0x0320,0x0320,0x43C4,0xD488,0xDC66,0xD447,0xD447,0xD447,0xDC66,0xB489,0x1362,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x7426,0xDC87,0xD447,0xD447,0xDC67,0xD467,0xC446,0xD467,0xDC67,0xD447,0xD446,0xDC88,0x3BA3,0x0320,0x0320,0xB488,0xDC67,0xD447,0xD447,0xDC67,0x9C26,0x0320,0x0320,0x0320,0x9C88,0xDC67,0xD447,0xD447,0xDC67,0xA426,0x0320,0x0320,0x0320,0x7C26,0xDC87,0xD447,0xD447,0xDC67,0xA447,0x94CA,0xDC67,0xD447,0xD447,0xDC87,0xDCA8,0xDCA8,0xDCA8,0xE4C8,0x6426,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x6C26,0xDC87,0xD446,0xD447,0xDC67,0xD467,0xC446,0xD467,0xDC67,0xD447,0xD446,0xDC88,0x3BA3,0x63E5,0xDC88,0xD447,0xD447,0xDC87,0xDCA8,0xDCA8,0xDCA8,0xECC8,0x8426,0x0320,0x0320,0x6C26,0xDC67,0xD447,0xD447,0xD447,0xCC67,0x2BA3,0x0320,0x0320,0x6447,0xDC67,0xD447,0xD447,0xD467,0xD468,0xDC88,0xD447,0xD447,0xD446,0xD4A9,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0B40,0x9447,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD446,0xCC88,0x2BC4,0x0320,0x0320,0x0320,0x5BE4,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC67,0x6426,0x0320,0x0320,0x0320,0x2361,0xC467,0xDC67,0xD447,0xD447,0xD447,0xD447,0xDC67,0x9447,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x2382,0xD488,0xD446,0xD447,0xDC67,0xA447,0x43E5,0x1341,0x3BE4,0xB468,0xDC67,0xD447,0xDC67,0x8468,0x0320,0x3BC4,0xD467,0xD447,0xD447,0xD447,0xDC66,0xAC47,0x0B41,0x0320,0x0320,0xBC89,0xD467,0xD447,0xD447,0xDC67,0xAC67,0x0B61,0x0320,0x0B61,0xC468,0xD467,0xD447,0xD447,0xDC67,0x9C67,0xA468,0xDC67,0xD446,0xCC88,0x7426,0x6C05,0x6C05,0x6C05,0x6C05,0x1B62,0x0320,0x0320,0x0320,0x0320,0x0320,0x2383,0xCC68,0xD446,0xD447,0xDC67,0xAC47,0x43E5,0x1341,0x3BC4,0xAC47,0xDC67,0xD447,0xDC67,0x6405,0x6BC4,0xDC87,0xD447,0xD467,0x8447,0x6C05,0x6C05,0x6C05,0x6C05,0x33A3,0x0320,0x0B41,0xAC47,0xDC67,0xD447,0xD447,0xD447,0xD488,0x4C05,0x0320,0x0320,0x8C68,0xDC87,0xD446,0xDC88,0x6C47,0x4405,0x5C26,0xCC88,0xD447,0xD446,0xD468,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x6405,0xDC87,0xD446,0xD447,0xD447,0xD447,0xD447,0xDC67,0xB447,0x0340,0x0320,0x0320,0x2BA3,0xD488,0xD446,0xD447,0xD447,0xD447,0xD447,0xD446,0xDC88,0x3382,0x0320,0x0320,0x0340,0xAC68,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC87,0x7C06,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x8426,0xDC87,0xD447,0xDC67,0xBC88,0x1362,0x0320,0x0320,0x0320,0x4BE5,0xDC87,0xDC67,0xE487,0xAC88,0x0320,0x8426,0xDC87,0xD446,0xD467,0xD447,0xD446,0xC488,0x1B83,0x0320,0x0B41,0xC447,0xD467,0xD447,0xD447,0xDC46,0xBC88,0x1B82,0x0320,0x5BE5,0xDC87,0xD446,0xD447,0xD447,0xDC67,0x8CAA,0xAC46,0xDC67,0xDC67,0x9C46,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x7426,0xDC87,0xD447,0xDC67,0xBC68,0x1361,0x0320,0x0320,0x0320,0x4C06,0xDC88,0xDC67,0xDC87,0x9CA9,0x8C47,0xDC66,0xDC67,0xBC47,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x3BA3,0xDC88,0xD446,0xD467,0xD467,0xD446,0xDC88,0x5C26,0x0320,0x0320,0x9426,0xDC67,0xD446,0xCCA9,0x2383,0x0320,0x0320,0x9C89,0xDC67,0xD446,0xD467,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x2B83,0xCC68,0xD446,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC67,0x8C68,0x0320,0x0320,0x0B41,0xA447,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xBC88,0x1362,0x0320,0x0320,0x6405,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD467,0x43E5,0x0320,0x0320,0x0320,0x0320,0x0320,0x0B61,0xB467,0xDC67,0xD446,0xDC87,0x4BE4,0x0320,0x0320,0x0320,0x0320,0x1B62,0x9C26,0x9C26,0xA446,0x7C26,0x0B41,0xCC88,0xD446,0xD467,0xACA9,0xD447,0xD446,0xD4A9,0x2BA3,0x0320,0x33C4,0xCC67,0xD447,0xD447,0xD447,0xD446,0xCCA9,0x23A3,0x0320,0xA467,0xDC67,0xD446,0xD447,0xD447,0xD447,0x7CA9,0xBC68,0xD446,0xDC67,0x9C47,0x33A3,0x33A3,0x33A3,0x33A3,0x1341,0x0320,0x0320,0x0320,0x0320,0x0320,0x1361,0xB488,0xDC66,0xD447,0xDC87,0x5BE5,0x0320,0x0320,0x0320,0x0320,0x23A3,0x9C26,0x9C26,0x9C26,0x8468,0xBCA9,0xD446,0xDC67,0xBC88,0x2BA3,0x33A3,0x33A3,0x33A3,0x1361,0x0320,0x0320,0x8C47,0xDC67,0xD446,0xBC88,0xC4C9,0xD446,0xDCA8,0x6C05,0x0320,0x0B41,0xAC67,0xDC67,0xDC67,0xAC47,0x0340,0x0320,0x0B41,0xBC89,0xD466,0xD446,0xD4A9,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x9447,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xDC88,0x3BA3,0x0320,0x0320,0x53E5,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC87,0x8426,0x0320,0x0320,0x2382,0xCC68,0xD446,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC46,0xBC88,0x0B40,0x0320,0x0320,0x0320,0x0320,0x0320,0x2BA3,0xD4A9,0xD446,0xD446,0xC488,0x1B82,0x0320,0x0B41,0x2B83,0x2B82,0x2B82,0x1B41,0x1B41,0x1B61,0x0B40,0x5C05,0xDC67,0xD446,0xC468,0x43E4,0xD446,0xD446,0xDCA8,0x3383,0x0320,0x5C26,0xDC88,0xD446,0xD4A9,0xCCA9,0xD446,0xD4A9,0x2BA3,0x2383,0xD467,0xD446,0xD4CA,0xD488,0xD446,0xCC47,0x7468,0xD488,0xD446,0xD447,0xD468,0xDCA9,0xDCA9,0xDCA9,0xDCA9,0x3BC4,0x0320,0x0320,0x0320,0x0320,0x0320,0x1B61,0xD488,0xD446,0xD467,0xBC67,0x1B82,0x0320,0x0B41,0x2BA3,0x2B82,0x2B82,0x1B41,0x1B41,0x1B41,0x2B83,0xD468,0xD447,0xD446,0xD467,0xDCA9,0xDCA9,0xDCA9,0xE4C9,0x5BE4,0x0320,0x1B82,0xC467,0xDC67,0xDC87,0x6C26,0xAC67,0xDC67,0xDC87,0x73E5,0x0320,0x23A3,0xCCA9,0xD446,0xDC67,0xAC47,0x3BE5,0x5C26,0xA468,0xD447,0xD447,0xDC87,0x8447,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x3BA3,0xDC88,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC67,0xB447,0x0B41,0x0320,0x0B41,0xBC68,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD467,0x33A3,0x0320,0x0320,0x8426,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xDC87,0x6C05,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x3B83,0xDC88,0xD447,0xDC67,0x9C26,0x0320,0x0320,0x5406,0xDC88,0xD467,0xD467,0xD467,0xD467,0xDC67,0x4BE4,0x9426,0xDC67,0xDC67,0x9C47,0x1341,0xD467,0xD446,0xDC87,0x3BA3,0x0320,0x6BE5,0xDC87,0xD446,0xBCEB,0xAC89,0xDC46,0xDCA8,0x2B82,0x7C26,0xDC87,0xD467,0xACCA,0xD488,0xD446,0xCC89,0x7447,0xDC67,0xD447,0xD447,0xD446,0xD446,0xD446,0xD446,0xD488,0x1B61,0x0320,0x0320,0x0320,0x0320,0x0320,0x33A3,0xD467,0xD447,0xDC67,0xAC67,0x0320,0x0320,0x43C4,0xDCA8,0xD467,0xD467,0xD467,0xD467,0xDC68,0xB4CB,0xCC67,0xD447,0xD447,0xD446,0xD446,0xD446,0xD446,0xDC88,0x4BC4,0x0320,0x5BE5,0xDC87,0xD446,0xCC67,0x1B82,0xAC88,0xDC67,0xDC67,0x8C47,0x0320,0x3382,0xDCA8,0xD446,0xD447,0xD447,0xD467,0xDC67,0xDC67,0xD447,0xDC67,0xC468,0x1B62,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x9C67,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC87,0x5C05,0x0320,0x0320,0x5BE5,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC67,0x9C47,0x0320,0x0320,0x1B62,0xCC88,0xD446,0xD447,0xD447,0xD447,0xD447,0xD447,0xD466,0xC468,0x1B82,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x4BC4,0xDC67,0xD447,0xDC87,0x9467,0x0320,0x0320,0x6405,0xDCA8,0xD446,0xD447,0xD447,0xD446,0xD468,0x5BE5,0xCC68,0xD446,0xDC67,0x4BE4,0x1341,0xD489,0xD446,0xDC67,0x5C05,0x0320,0x8426,0xDC67,0xDC66,0x94A9,0x8406,0xDC67,0xDC87,0x43C4,0xB468,0xDC66,0xB468,0x6C47,0xDC67,0xDC46,0xAC89,0x8489,0xDC66,0xD447,0xD446,0xDC67,0xDC87,0xDC87,0xDC87,0xCCAA,0x1B62,0x0320,0x0320,0x0320,0x0320,0x0320,0x5406,0xDC67,0xD447,0xDC67,0x9C89,0x0320,0x0320,0x53C4,0xDC87,0xD446,0xD447,0xD447,0xD446,0xCC68,0xAD0C,0xD447,0xD447,0xD446,0xDC67,0xDC87,0xDC87,0xDC87,0xD488,0x33C4,0x0320,0xB468,0xDC66,0xDC67,0x9C68,0x0320,0xA489,0xDC67,0xDC66,0xAC89,0x0320,0x43C4,0xDC67,0xD447,0xD447,0xD446,0xD447,0xD447,0xD447,0xD447,0xC488,0x3382,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x23A3,0xCC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC66,0xB467,0x0B41,0x0320,0x0320,0xA468,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xD468,0x33A3,0x0320,0x0320,0x7426,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC87,0x7426,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x4BE4,0xDC67,0xD447,0xDC87,0x8C68,0x0320,0x0320,0x8426,0xE4A7,0xDC67,0xD447,0xD447,0xD446,0xC488,0x9CCA,0xD446,0xD446,0xCCA9,0x43E5,0x3BE5,0xCCA9,0xD446,0xDC67,0x7C68,0x0320,0xB489,0xDC66,0xDC67,0x6C26,0x73C4,0xDC87,0xD468,0x9C89,0xD467,0xDC67,0x8405,0x8468,0xDC67,0xDC67,0x9447,0xA4AA,0xDC66,0xD446,0xD468,0x9C67,0x9447,0x9447,0x9C47,0x7426,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x5C26,0xDC67,0xD447,0xDC67,0x9489,0x0320,0x0320,0x8447,0xE487,0xDC67,0xD446,0xD447,0xD446,0xC467,0xAD0C,0xD447,0xD446,0xD467,0xA468,0x9447,0x9447,0x9447,0x8426,0x0B41,0x3BC4,0xD467,0xD446,0xDC88,0x7447,0x2BC4,0x9C89,0xDC67,0xD446,0xC4A9,0x0B41,0x7C67,0xDC67,0xD447,0xD446,0xDC87,0xD447,0xD447,0xD446,0xD4A9,0x33A3,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x63E5,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC88,0x43C4,0x0320,0x0320,0x2382,0xD467,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC87,0x8447,0x0320,0x0320,0x0320,0xAC47,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC67,0xB468,0x0B41,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x43A3,0xDC87,0xD447,0xDC87,0x9426,0x0320,0x0320,0x5C26,0x8468,0x7447,0xBC68,0xDC46,0xD446,0xC4A9,0xCCA9,0xD446,0xD446,0xD467,0xCC88,0xCC88,0xD467,0xD446,0xDC67,0x9C88,0x0B41,0xCCA9,0xD446,0xDC87,0x43A3,0x73E5,0xDC87,0xD447,0xDC88,0xD446,0xD467,0x33C3,0xA426,0xDC67,0xDC87,0x8C47,0xB468,0xDC67,0xDC66,0xAC89,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x4BE5,0xD467,0xD447,0xDC67,0xA468,0x0320,0x0320,0x5C47,0x8468,0x7468,0xBC88,0xD446,0xD446,0xBC89,0xAC89,0xDC67,0xD446,0xBC68,0x1382,0x0320,0x0320,0x0320,0x0320,0x0320,0x8426,0xDC87,0xD446,0xD447,0xCC88,0xCC89,0xD468,0xD446,0xD446,0xCC89,0x1341,0x9C88,0xDC67,0xD446,0xD488,0x4BC4,0xAC47,0xDC67,0xD447,0xDC87,0x5405,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xACA9,0xDC46,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC67,0x8426,0x0320,0x0320,0x0320,0x6C47,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC67,0xBC67,0x1361,0x0320,0x0320,0x2BA3,0xD4A9,0xD446,0xD447,0xD447,0xD447,0xD447,0xD446,0xD487,0x43C4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x33A3,0xDCA8,0xD446,0xD446,0xC468,0x1B82,0x0320,0x0320,0x0320,0x2382,0xC467,0xD446,0xD447,0xCCEB,0xD467,0xD446,0xD447,0xD446,0xD446,0xD446,0xD446,0xD447,0xDC67,0xA468,0x1361,0xD467,0xD446,0xDCA8,0x3382,0x6C06,0xDC87,0xD447,0xD446,0xDC66,0xB467,0x2BC4,0xBC47,0xDC66,0xD467,0x7CA9,0xBC26,0xD467,0xDC87,0x7C05,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x2382,0xD467,0xD446,0xD467,0xC467,0x1B82,0x0320,0x0320,0x0320,0x2BA3,0xCC67,0xD447,0xDC66,0x8489,0xA467,0xDC66,0xDC67,0xA426,0x0320,0x0320,0x0320,0x0320,0x0320,0x1361,0xCC88,0xD446,0xD447,0xD446,0xD446,0xD446,0xD446,0xD447,0xD447,0xCC67,0x1340,0xAC26,0xDC67,0xD446,0xC4A9,0x0340,0x6426,0xDC67,0xD447,0xDC67,0xA447,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xD4A9,0xD446,0xD447,0xD447,0xD447,0xD447,0xDC67,0xB488,0x1361,0x0320,0x0320,0x0320,0x8C26,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD446,0xD488,0x3BC4,0x0320,0x0320,0x0320,0x3BA3,0xDC87,0xD446,0xD447,0xD447,0xD447,0xD446,0xDC67,0x7426,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1B62,0xBC88,0xDC66,0xD447,0xDC67,0x9447,0x2BA3,0x1362,0x53E5,0xBC88,0xDC67,0xD446,0xD488,0xCCCA,0xD446,0xD447,0xD467,0xDC67,0xDC67,0xDC67,0xD467,0xD447,0xDC67,0xA425,0x3BE4,0xD467,0xD446,0xDCA9,0x33A3,0x6426,0xDC88,0xD446,0xD447,0xDC87,0x63E5,0x3BC4,0xD4A8,0xD446,0xCC46,0x74A9,0xCC68,0xD446,0xDC67,0x9C67,0x6406,0x6405,0x6405,0x6C05,0x53E5,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1361,0xC489,0xD446,0xD447,0xDC67,0x9C46,0x33C4,0x1361,0x4BE5,0xBC67,0xDC67,0xD446,0xD467,0x4BE5,0xCC88,0xD446,0xDC67,0xB489,0x6405,0x6405,0x6405,0x6C06,0x53C4,0x6427,0xDC67,0xD447,0xD467,0xDC67,0xDC67,0xDC67,0xD467,0xD447,0xD447,0xCC46,0x2BA3,0xAC26,0xDC67,0xDC67,0x9C47,0x0320,0x2362,0xCC88,0xD446,0xD446,0xD488,0x33A3,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xD468,0xD446,0xD447,0xD447,0xD447,0xDC67,0xCC88,0x2BA3,0x0320,0x0320,0x0320,0x0320,0x9426,0xDC67,0xD447,0xD447,0xD447,0xD446,0xDCA8,0x6406,0x0320,0x0320,0x0320,0x0320,0x5C06,0xDC67,0xD447,0xD447,0xD447,0xD446,0xDC87,0x9C68,0x0B41,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x8426,0xDC87,0xD447,0xD447,0xDC67,0xCC67,0xC447,0xD467,0xDC67,0xD446,0xD467,0xB4CA,0xCC88,0xD446,0xDC67,0xA468,0x6447,0x6447,0x6447,0xAC47,0xDC67,0xDC67,0xAC25,0x6C68,0xDC67,0xD446,0xCC88,0x1BA3,0x5C26,0xDC67,0xD446,0xD447,0xCC68,0x1362,0x4BA3,0xDC87,0xD446,0xC447,0x7C68,0xDC88,0xD446,0xD447,0xDC67,0xDCA8,0xDCA8,0xDCA8,0xE4C8,0x9C47,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x7C06,0xDC87,0xD447,0xD447,0xDC67,0xCC67,0xC446,0xD467,0xDC67,0xD447,0xDC87,0x8C26,0x2B82,0xDC87,0xD446,0xD447,0xD467,0xDCA8,0xDCA8,0xDCA8,0xE4A8,0xC4A9,0xAC89,0xDC67,0xD447,0xC447,0x6C47,0x6447,0x6447,0x8468,0xDC87,0xD446,0xCC46,0x6C89,0xC467,0xD446,0xDC87,0x7C05,0x0320,0x0320,0x9447,0xDC67,0xD447,0xDC87,0x7426,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xDC88,0xD446,0xD447,0xD446,0xDC67,0xCC88,0x33A3,0x0320,0x0320,0x0320,0x0320,0x0320,0x9426,0xDC67,0xD447,0xD447,0xDC66,0xDCA8,0x6C06,0x0320,0x0320,0x0320,0x0320,0x0320,0x53E5,0xDC67,0xD447,0xD447,0xD446,0xDC87,0xA488,0x1341,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1B82,0xC488,0xDC67,0xD447,0xD447,0xD447,0xD467,0xD447,0xD446,0xDC87,0xAC68,0x7447,0xDC87,0xD446,0xD467,0x43C4,0x0320,0x0320,0x0320,0x73E5,0xDC87,0xD446,0xC467,0xACEB,0xD467,0xDC67,0xB447,0x0340,0x43E5,0xD467,0xD447,0xDC67,0x9447,0x0320,0x7C27,0xDC67,0xD446,0xBCA9,0x7C26,0xDC67,0xD447,0xD447,0xD447,0xD446,0xD446,0xD446,0xDC87,0x7C05,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1361,0xBC67,0xDC67,0xD447,0xD447,0xD447,0xD467,0xD447,0xD446,0xDC67,0xC488,0x1B82,0x5C26,0xDC67,0xD447,0xD447,0xD447,0xD446,0xD446,0xD446,0xD446,0xCCEB,0xD488,0xD446,0xDC67,0x8C47,0x0320,0x0320,0x0320,0x33A3,0xDCA9,0xD446,0xD447,0xB50C,0xD488,0xD446,0xDC88,0x6C27,0x0320,0x0320,0x4BE5,0xDC67,0xD447,0xDC67,0xBC67,0x0B41,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xB4A9,0xDC66,0xDC46,0xDC87,0xAC88,0x2BA3,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x7426,0xE4A7,0xD446,0xDC87,0xC468,0x5405,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x2B82,0xD488,0xDC46,0xDC67,0xD488,0x8447,0x0B41,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x33A3,0xC488,0xDC87,0xD446,0xD446,0xD446,0xD446,0xDC87,0xA468,0x2B83,0xBC67,0xDC67,0xE487,0xBC88,0x0320,0x0320,0x0320,0x0320,0x7C26,0xE4A7,0xDC66,0xDC87,0xDCA9,0xDC66,0xE487,0xAC46,0x0320,0x2BA3,0xD467,0xDC66,0xDCA8,0x43C4,0x0320,0xB4A9,0xE486,0xE486,0x9C89,0x9C89,0xE486,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC66,0xE4A8,0x6C47,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x2B83,0xBC88,0xDC87,0xD446,0xD446,0xD446,0xD446,0xDC87,0xAC88,0x2382,0x0320,0x9468,0xE487,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC87,0xDC67,0xDC66,0xDCA8,0x33A3,0x0320,0x0320,0x0320,0x33C4,0xDCA9,0xDC66,0xDC67,0xDC88,0xDC67,0xDC66,0xDC67,0x4405,0x0320,0x0320,0x0B41,0xC488,0xDC66,0xDC66,0xE4A8,0x53E5,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x2382,0xACA9,0xACA9,0x5C05,0x0B41,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0B41,0x8447,0xBCCA,0x7C26,0x2383,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x5BE5,0xBCCA,0x9468,0x3BC4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1B82,0x7426,0xC4CA,0xD488,0xD488,0xBCA9,0x5C05,0x0B41,0x2BC4,0x8467,0x7C47,0x8447,0x4BE5,0x0320,0x0320,0x0320,0x0320,0x3BC4,0x8C67,0x7C47,0x8447,0x8447,0x7C47,0x8467,0x5C05,0x0320,0x0B41,0x7C26,0x8447,0x6C26,0x0B41,0x0320,0x7447,0x8447,0x8447,0x4C05,0x6C47,0x8447,0x7C47,0x7C47,0x7C47,0x7C47,0x7C47,0x8447,0x8447,0x2BA3,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1B62,0x7426,0xC4CA,0xD488,0xD488,0xBCA9,0x6405,0x0B61,0x0320,0x0320,0x6426,0x8C67,0x8447,0x8447,0x8447,0x8447,0x8447,0x8447,0x8447,0x8447,0x8447,0x8447,0x7447,0x0B41,0x0320,0x0320,0x0320,0x1362,0x7C47,0x8447,0x8447,0x8447,0x8447,0x8447,0x7C47,0x0B41,0x0320,0x0320,0x0320,0x4BE5,0x8C67,0x8447,0x8C67,0x5426,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
+    0x40, 0x01, 0x20, 0x00, 0xcc, 0x00, 0x20, 0x03, 0x40, 0x03, 0x40, 0x0b, 0x41, 0x0b, 0x61, 0x0b,
+    0x40, 0x13, 0x41, 0x13, 0x61, 0x13, 0x62, 0x13, 0x82, 0x13, 0x41, 0x1b, 0x61, 0x1b, 0x62, 0x1b,
+    0x82, 0x1b, 0x83, 0x1b, 0xa3, 0x1b, 0x61, 0x23, 0x62, 0x23, 0x82, 0x23, 0x83, 0x23, 0xa3, 0x23,
+    0x82, 0x2b, 0x83, 0x2b, 0xa3, 0x2b, 0xc4, 0x2b, 0x82, 0x33, 0x83, 0x33, 0xa3, 0x33, 0xc3, 0x33,
+    0xc4, 0x33, 0x83, 0x3b, 0xa3, 0x3b, 0xc4, 0x3b, 0xe4, 0x3b, 0xe5, 0x3b, 0xa3, 0x43, 0xc4, 0x43,
+    0xe4, 0x43, 0xe5, 0x43, 0x05, 0x44, 0xa3, 0x4b, 0xc4, 0x4b, 0xe4, 0x4b, 0xe5, 0x4b, 0x05, 0x4c,
+    0x06, 0x4c, 0xc4, 0x53, 0xe5, 0x53, 0x05, 0x54, 0x06, 0x54, 0x26, 0x54, 0xe4, 0x5b, 0xe5, 0x5b,
+    0x05, 0x5c, 0x06, 0x5c, 0x26, 0x5c, 0x47, 0x5c, 0xe5, 0x63, 0x05, 0x64, 0x06, 0x64, 0x26, 0x64,
+    0x27, 0x64, 0x47, 0x64, 0xc4, 0x6b, 0xe5, 0x6b, 0x05, 0x6c, 0x06, 0x6c, 0x26, 0x6c, 0x27, 0x6c,
+    0x47, 0x6c, 0x68, 0x6c, 0x89, 0x6c, 0xc4, 0x73, 0xe5, 0x73, 0x05, 0x74, 0x06, 0x74, 0x26, 0x74,
+    0x47, 0x74, 0x68, 0x74, 0xa9, 0x74, 0x05, 0x7c, 0x06, 0x7c, 0x26, 0x7c, 0x27, 0x7c, 0x46, 0x7c,
+    0x47, 0x7c, 0x67, 0x7c, 0x68, 0x7c, 0xa9, 0x7c, 0x05, 0x84, 0x06, 0x84, 0x26, 0x84, 0x47, 0x84,
+    0x67, 0x84, 0x68, 0x84, 0x89, 0x84, 0x26, 0x8c, 0x47, 0x8c, 0x67, 0x8c, 0x68, 0x8c, 0x88, 0x8c,
+    0xaa, 0x8c, 0x26, 0x94, 0x47, 0x94, 0x67, 0x94, 0x68, 0x94, 0x89, 0x94, 0xa9, 0x94, 0xca, 0x94,
+    0x26, 0x9c, 0x46, 0x9c, 0x47, 0x9c, 0x67, 0x9c, 0x68, 0x9c, 0x88, 0x9c, 0x89, 0x9c, 0xa9, 0x9c,
+    0xca, 0x9c, 0x25, 0xa4, 0x26, 0xa4, 0x46, 0xa4, 0x47, 0xa4, 0x67, 0xa4, 0x68, 0xa4, 0x88, 0xa4,
+    0x89, 0xa4, 0xa9, 0xa4, 0xaa, 0xa4, 0x25, 0xac, 0x26, 0xac, 0x46, 0xac, 0x47, 0xac, 0x67, 0xac,
+    0x68, 0xac, 0x88, 0xac, 0x89, 0xac, 0xa9, 0xac, 0xca, 0xac, 0xeb, 0xac, 0x0c, 0xad, 0x47, 0xb4,
+    0x67, 0xb4, 0x68, 0xb4, 0x88, 0xb4, 0x89, 0xb4, 0xa9, 0xb4, 0xc9, 0xb4, 0xca, 0xb4, 0xcb, 0xb4,
+    0x0c, 0xb5, 0x26, 0xbc, 0x47, 0xbc, 0x67, 0xbc, 0x68, 0xbc, 0x88, 0xbc, 0x89, 0xbc, 0xa9, 0xbc,
+    0xca, 0xbc, 0xeb, 0xbc, 0x46, 0xc4, 0x47, 0xc4, 0x67, 0xc4, 0x68, 0xc4, 0x88, 0xc4, 0x89, 0xc4,
+    0xa9, 0xc4, 0xc9, 0xc4, 0xca, 0xc4, 0x46, 0xcc, 0x47, 0xcc, 0x67, 0xcc, 0x68, 0xcc, 0x88, 0xcc,
+    0x89, 0xcc, 0xa9, 0xcc, 0xaa, 0xcc, 0xca, 0xcc, 0xeb, 0xcc, 0x46, 0xd4, 0x47, 0xd4, 0x66, 0xd4,
+    0x67, 0xd4, 0x68, 0xd4, 0x87, 0xd4, 0x88, 0xd4, 0x89, 0xd4, 0xa8, 0xd4, 0xa9, 0xd4, 0xca, 0xd4,
+    0x46, 0xdc, 0x66, 0xdc, 0x67, 0xdc, 0x68, 0xdc, 0x87, 0xdc, 0x88, 0xdc, 0xa8, 0xdc, 0xa9, 0xdc,
+    0x86, 0xe4, 0x87, 0xe4, 0xa7, 0xe4, 0xa8, 0xe4, 0xc8, 0xe4, 0xc9, 0xe4, 0xc8, 0xec, 0xff, 0x00,
+    0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xd3, 0x00,
+    0x00, 0x25, 0x00, 0x69, 0x00, 0x7e, 0x00, 0x1b, 0x07, 0x00, 0x00, 0x17, 0x00, 0x55, 0x00, 0x92,
+    0x00, 0x34, 0x07, 0x00, 0x00, 0x08, 0x00, 0x3a, 0x00, 0x88, 0x00, 0x5c, 0x00, 0x03, 0x09, 0x00,
+    0x00, 0x2f, 0x00, 0x7e, 0x00, 0xbb, 0x00, 0xb8, 0x00, 0xbb, 0x00, 0x88, 0x00, 0x34, 0x00, 0x03,
+    0x04, 0x00, 0x00, 0x2f, 0x00, 0x62, 0x00, 0x5c, 0x00, 0x62, 0x00, 0x26, 0x02, 0x00, 0x00, 0x12,
+    0x00, 0x55, 0x01, 0x4c, 0x00, 0x54, 0x00, 0x2b, 0x03, 0x00, 0x00, 0x20, 0x00, 0x5d, 0x02, 0x52,
+    0x00, 0x26, 0x00, 0x55, 0x00, 0x53, 0x04, 0x54, 0x00, 0x5c, 0x00, 0x42, 0x08, 0x00, 0x00, 0x2a,
+    0x00, 0x7d, 0x00, 0xbb, 0x00, 0xb8, 0x00, 0xbb, 0x00, 0x91, 0x00, 0x35, 0x00, 0x03, 0x02, 0x00,
+    0x00, 0x4c, 0x00, 0x5c, 0x04, 0x54, 0x01, 0x55, 0x00, 0x03, 0x01, 0x00, 0x00, 0x16, 0x02, 0x5c,
+    0x00, 0x45, 0x02, 0x00, 0x00, 0x02, 0x00, 0x3c, 0x00, 0x5c, 0x01, 0x54, 0x01, 0x52, 0x00, 0x4c,
+    0x00, 0x2f, 0x00, 0x03, 0xb6, 0x00, 0x00, 0x07, 0x00, 0x68, 0x00, 0xc2, 0x00, 0xbf, 0x00, 0xbe,
+    0x00, 0x8c, 0x00, 0x03, 0x05, 0x00, 0x00, 0x3a, 0x00, 0xb8, 0x00, 0xc1, 0x00, 0xbd, 0x00, 0xc1,
+    0x00, 0x1b, 0x05, 0x00, 0x00, 0x1d, 0x00, 0x9a, 0x00, 0xc1, 0x00, 0xbd, 0x00, 0xc7, 0x00, 0x4a,
+    0x07, 0x00, 0x00, 0x07, 0x00, 0x71, 0x00, 0xc2, 0x00, 0xbe, 0x02, 0xb2, 0x00, 0xbd, 0x00, 0xc1,
+    0x00, 0x7a, 0x00, 0x0d, 0x02, 0x00, 0x00, 0x0c, 0x00, 0xa3, 0x00, 0xbe, 0x00, 0xbf, 0x00, 0xc7,
+    0x00, 0x63, 0x02, 0x00, 0x00, 0x29, 0x00, 0xc9, 0x01, 0xbf, 0x00, 0xc7, 0x00, 0x6f, 0x03, 0x00,
+    0x00, 0x7a, 0x00, 0xc6, 0x00, 0xbf, 0x00, 0xbe, 0x00, 0xc2, 0x00, 0x57, 0x06, 0xbf, 0x00, 0xc6,
+    0x00, 0x85, 0x06, 0x00, 0x00, 0x03, 0x00, 0x70, 0x00, 0xc2, 0x00, 0xbe, 0x02, 0xb2, 0x00, 0xbd,
+    0x00, 0xc1, 0x00, 0x7a, 0x00, 0x07, 0x00, 0x00, 0x00, 0x18, 0x00, 0xb5, 0x05, 0xbf, 0x00, 0xbe,
+    0x00, 0xbb, 0x00, 0x07, 0x01, 0x00, 0x00, 0x60, 0x00, 0xc6, 0x00, 0xbf, 0x00, 0xc1, 0x00, 0xa3,
+    0x02, 0x00, 0x00, 0x0b, 0x00, 0xc4, 0x00, 0xbe, 0x03, 0xbf, 0x00, 0xc1, 0x00, 0xc3, 0x00, 0x7c,
+    0x00, 0x07, 0xb4, 0x00, 0x00, 0x0c, 0x00, 0x83, 0x00, 0xc1, 0x00, 0xb2, 0x00, 0xb3, 0x00, 0xb2,
+    0x00, 0xb8, 0x00, 0x22, 0x04, 0x00, 0x00, 0x52, 0x00, 0xc1, 0x00, 0xb2, 0x01, 0xb3, 0x00, 0xbf,
+    0x00, 0x57, 0x04, 0x00, 0x00, 0x2f, 0x00, 0xaa, 0x00, 0xbf, 0x00, 0xb2, 0x00, 0xb3, 0x00, 0xbe,
+    0x00, 0x86, 0x00, 0x03, 0x05, 0x00, 0x00, 0x07, 0x00, 0x86, 0x00, 0xc1, 0x00, 0xb2, 0x01, 0xb3,
+    0x00, 0xb5, 0x01, 0xb3, 0x00, 0xb2, 0x00, 0xc1, 0x00, 0x6f, 0x02, 0x00, 0x00, 0x34, 0x00, 0xc1,
+    0x01, 0xb3, 0x00, 0xc1, 0x00, 0x67, 0x02, 0x00, 0x00, 0x3a, 0x00, 0xc1, 0x01, 0xb3, 0x00, 0xbf,
+    0x00, 0x6d, 0x02, 0x00, 0x00, 0x1b, 0x00, 0xb8, 0x01, 0xb3, 0x00, 0xb2, 0x00, 0x9a, 0x00, 0x58,
+    0x00, 0xb2, 0x01, 0xb3, 0x03, 0xb2, 0x00, 0xbf, 0x00, 0x64, 0x05, 0x00, 0x00, 0x03, 0x00, 0x7a,
+    0x00, 0xc6, 0x00, 0xb2, 0x01, 0xb3, 0x00, 0xb5, 0x01, 0xb3, 0x00, 0xb2, 0x00, 0xc1, 0x00, 0x6f,
+    0x00, 0x01, 0x00, 0x31, 0x00, 0xc2, 0x00, 0xb2, 0x01, 0xb3, 0x02, 0xb2, 0x00, 0xbe, 0x00, 0x86,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x0c, 0x00, 0xac, 0x00, 0xb2, 0x00, 0xb3, 0x00, 0xb5, 0x00, 0xa0,
+    0x00, 0x03, 0x01, 0x00, 0x00, 0x1b, 0x00, 0xb5, 0x01, 0xb3, 0x02, 0xb2, 0x00, 0xb3, 0x00, 0xb2,
+    0x00, 0xc6, 0x00, 0x5c, 0xb3, 0x00, 0x00, 0x06, 0x00, 0x83, 0x00, 0xc1, 0x02, 0xb3, 0x00, 0xb2,
+    0x00, 0xb8, 0x00, 0x26, 0x03, 0x00, 0x00, 0x4b, 0x00, 0xc1, 0x03, 0xb3, 0x00, 0xbf, 0x00, 0x5e,
+    0x03, 0x00, 0x00, 0x24, 0x00, 0xb8, 0x00, 0xbe, 0x02, 0xb3, 0x00, 0xbe, 0x00, 0x90, 0x00, 0x08,
+    0x05, 0x00, 0x00, 0x4c, 0x00, 0xc1, 0x01, 0xb3, 0x00, 0xbf, 0x00, 0xb5, 0x00, 0x9f, 0x00, 0xb5,
+    0x00, 0xbf, 0x00, 0xb3, 0x00, 0xb2, 0x00, 0xc2, 0x00, 0x1f, 0x01, 0x00, 0x00, 0x8f, 0x00, 0xbf,
+    0x01, 0xb3, 0x00, 0xbf, 0x00, 0x6d, 0x02, 0x00, 0x00, 0x72, 0x00, 0xbf, 0x01, 0xb3, 0x00, 0xbf,
+    0x00, 0x77, 0x02, 0x00, 0x00, 0x52, 0x00, 0xc1, 0x01, 0xb3, 0x00, 0xbf, 0x00, 0x79, 0x00, 0x6c,
+    0x00, 0xbf, 0x01, 0xb3, 0x00, 0xc1, 0x02, 0xc3, 0x00, 0xc9, 0x00, 0x3c, 0x05, 0x00, 0x00, 0x43,
+    0x00, 0xc1, 0x00, 0xb2, 0x00, 0xb3, 0x00, 0xbf, 0x00, 0xb5, 0x00, 0x9f, 0x00, 0xb5, 0x00, 0xbf,
+    0x00, 0xb3, 0x00, 0xb2, 0x00, 0xc2, 0x00, 0x1f, 0x00, 0x39, 0x00, 0xc2, 0x01, 0xb3, 0x00, 0xc1,
+    0x02, 0xc3, 0x00, 0xcb, 0x00, 0x5b, 0x01, 0x00, 0x00, 0x43, 0x00, 0xbf, 0x02, 0xb3, 0x00, 0xaa,
+    0x00, 0x17, 0x01, 0x00, 0x00, 0x3e, 0x00, 0xbf, 0x01, 0xb3, 0x00, 0xb5, 0x00, 0xb6, 0x00, 0xc2,
+    0x01, 0xb3, 0x00, 0xb2, 0x00, 0xbb, 0xb2, 0x00, 0x00, 0x02, 0x00, 0x67, 0x00, 0xc1, 0x03, 0xb3,
+    0x00, 0xb2, 0x00, 0xac, 0x00, 0x18, 0x02, 0x00, 0x00, 0x33, 0x00, 0xc1, 0x04, 0xb3, 0x00, 0xbf,
+    0x00, 0x3c, 0x02, 0x00, 0x00, 0x10, 0x00, 0xa1, 0x00, 0xbf, 0x03, 0xb3, 0x00, 0xbf, 0x00, 0x67,
+    0x05, 0x00, 0x00, 0x12, 0x00, 0xb8, 0x00, 0xb2, 0x00, 0xb3, 0x00, 0xbf, 0x00, 0x79, 0x00, 0x26,
+    0x00, 0x06, 0x00, 0x21, 0x00, 0x8e, 0x00, 0xbf, 0x00, 0xb3, 0x00, 0xbf, 0x00, 0x5e, 0x00, 0x00,
+    0x00, 0x20, 0x00, 0xb5, 0x02, 0xb3, 0x00, 0xbe, 0x00, 0x83, 0x00, 0x03, 0x01, 0x00, 0x00, 0x9b,
+    0x00, 0xb5, 0x01, 0xb3, 0x00, 0xbf, 0x00, 0x84, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0xa2,
+    0x00, 0xb5, 0x01, 0xb3, 0x00, 0xbf, 0x00, 0x70, 0x00, 0x7b, 0x00, 0xbf, 0x00, 0xb2, 0x00, 0xac,
+    0x00, 0x4c, 0x03, 0x41, 0x00, 0x0c, 0x04, 0x00, 0x00, 0x13, 0x00, 0xab, 0x00, 0xb2, 0x00, 0xb3,
+    0x00, 0xbf, 0x00, 0x83, 0x00, 0x26, 0x00, 0x06, 0x00, 0x20, 0x00, 0x83, 0x00, 0xbf, 0x00, 0xb3,
+    0x00, 0xbf, 0x00, 0x3a, 0x00, 0x3f, 0x00, 0xc1, 0x00, 0xb3, 0x00, 0xb5, 0x00, 0x5c, 0x03, 0x41,
+    0x00, 0x1b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x83, 0x00, 0xbf, 0x02, 0xb3, 0x00, 0xb8, 0x00, 0x2c,
+    0x01, 0x00, 0x00, 0x63, 0x00, 0xc1, 0x00, 0xb2, 0x00, 0xc2, 0x00, 0x45, 0x00, 0x27, 0x00, 0x37,
+    0x00, 0xac, 0x00, 0xb3, 0x00, 0xb2, 0x00, 0xb6, 0xb2, 0x00, 0x00, 0x3a, 0x00, 0xc1, 0x00, 0xb2,
+    0x03, 0xb3, 0x00, 0xbf, 0x00, 0x8c, 0x00, 0x01, 0x01, 0x00, 0x00, 0x17, 0x00, 0xb8, 0x00, 0xb2,
+    0x03, 0xb3, 0x00, 0xb2, 0x00, 0xc2, 0x00, 0x19, 0x01, 0x00, 0x00, 0x01, 0x00, 0x85, 0x00, 0xbf,
+    0x04, 0xb3, 0x00, 0xc1, 0x00, 0x51, 0x05, 0x00, 0x00, 0x5b, 0x00, 0xc1, 0x00, 0xb3, 0x00, 0xbf,
+    0x00, 0x9a, 0x00, 0x08, 0x02, 0x00, 0x00, 0x2b, 0x00, 0xc1, 0x00, 0xbf, 0x00, 0xc6, 0x00, 0x86,
+    0x00, 0x00, 0x00, 0x5b, 0x00, 0xc1, 0x00, 0xb2, 0x00, 0xb5, 0x00, 0xb3, 0x00, 0xb2, 0x00, 0xa3,
+    0x00, 0x0e, 0x00, 0x00, 0x00, 0x03, 0x00, 0xa0, 0x00, 0xb5, 0x01, 0xb3, 0x00, 0xbd, 0x00, 0x9a,
+    0x00, 0x0d, 0x00, 0x00, 0x00, 0x34, 0x00, 0xc1, 0x00, 0xb2, 0x01, 0xb3, 0x00, 0xbf, 0x00, 0x65,
+    0x00, 0x82, 0x01, 0xbf, 0x00, 0x6e, 0x0a, 0x00, 0x00, 0x4c, 0x00, 0xc1, 0x00, 0xb3, 0x00, 0xbf,
+    0x00, 0x99, 0x00, 0x07, 0x02, 0x00, 0x00, 0x2d, 0x00, 0xc2, 0x00, 0xbf, 0x00, 0xc1, 0x00, 0x74,
+    0x00, 0x61, 0x00, 0xbe, 0x00, 0xbf, 0x00, 0x97, 0x06, 0x00, 0x00, 0x1f, 0x00, 0xc2, 0x00, 0xb2,
+    0x01, 0xb5, 0x00, 0xb2, 0x00, 0xc2, 0x00, 0x37, 0x01, 0x00, 0x00, 0x66, 0x00, 0xbf, 0x00, 0xb2,
+    0x00, 0xae, 0x00, 0x13, 0x01, 0x00, 0x00, 0x73, 0x00, 0xbf, 0x00, 0xb2, 0x00, 0xb5, 0xb1, 0x00,
+    0x00, 0x16, 0x00, 0xab, 0x00, 0xb2, 0x04, 0xb3, 0x00, 0xbf, 0x00, 0x63, 0x01, 0x00, 0x00, 0x03,
+    0x00, 0x79, 0x00, 0xbf, 0x04, 0xb3, 0x00, 0xb2, 0x00, 0x9a, 0x00, 0x08, 0x01, 0x00, 0x00, 0x3a,
+    0x00, 0xc1, 0x05, 0xb3, 0x00, 0xb5, 0x00, 0x26, 0x04, 0x00, 0x00, 0x04, 0x00, 0x8d, 0x00, 0xbf,
+    0x00, 0xb2, 0x00, 0xc1, 0x00, 0x2a, 0x03, 0x00, 0x00, 0x0c, 0x01, 0x6d, 0x00, 0x78, 0x00, 0x52,
+    0x00, 0x03, 0x00, 0xac, 0x00, 0xb2, 0x00, 0xb5, 0x00, 0x88, 0x00, 0xb3, 0x00, 0xb2, 0x00, 0xbb,
+    0x00, 0x17, 0x00, 0x00, 0x00, 0x1d, 0x00, 0xaa, 0x02, 0xb3, 0x00, 0xb2, 0x00, 0xae, 0x00, 0x14,
+    0x00, 0x00, 0x00, 0x7a, 0x00, 0xbf, 0x00, 0xb2, 0x02, 0xb3, 0x00, 0x58, 0x00, 0x99, 0x00, 0xb2,
+    0x00, 0xbf, 0x00, 0x6f, 0x03, 0x1b, 0x00, 0x06, 0x04, 0x00, 0x00, 0x07, 0x00, 0x8f, 0x00, 0xbe,
+    0x00, 0xb3, 0x00, 0xc1, 0x00, 0x34, 0x03, 0x00, 0x00, 0x14, 0x02, 0x6d, 0x00, 0x5e, 0x00, 0x9c,
+    0x00, 0xb2, 0x00, 0xbf, 0x00, 0x9a, 0x00, 0x17, 0x02, 0x1b, 0x00, 0x07, 0x01, 0x00, 0x00, 0x61,
+    0x00, 0xbf, 0x00, 0xb2, 0x00, 0x9a, 0x00, 0xa6, 0x00, 0xb2, 0x00, 0xc3, 0x00, 0x41, 0x00, 0x00,
+    0x00, 0x03, 0x00, 0x84, 0x01, 0xbf, 0x00, 0x83, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x9b,
+    0x00, 0xb4, 0x00, 0xb2, 0x00, 0xbb, 0xb1, 0x00, 0x00, 0x67, 0x00, 0xbf, 0x04, 0xb3, 0x00, 0xb2,
+    0x00, 0xc2, 0x00, 0x1f, 0x01, 0x00, 0x00, 0x2f, 0x00, 0xc1, 0x05, 0xb3, 0x00, 0xc1, 0x00, 0x5b,
+    0x01, 0x00, 0x00, 0x12, 0x00, 0xab, 0x00, 0xb2, 0x04, 0xb3, 0x00, 0xbd, 0x00, 0x9a, 0x00, 0x02,
+    0x04, 0x00, 0x00, 0x17, 0x00, 0xbb, 0x01, 0xb2, 0x00, 0xa3, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x16, 0x01, 0x15, 0x01, 0x0a, 0x00, 0x0b, 0x00, 0x02, 0x00, 0x35, 0x00, 0xbf, 0x00, 0xb2,
+    0x00, 0xa2, 0x00, 0x25, 0x01, 0xb2, 0x00, 0xc3, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x37, 0x00, 0xc2,
+    0x00, 0xb2, 0x00, 0xbb, 0x00, 0xae, 0x00, 0xb2, 0x00, 0xbb, 0x00, 0x17, 0x00, 0x13, 0x00, 0xb5,
+    0x00, 0xb2, 0x00, 0xbc, 0x00, 0xb8, 0x00, 0xb2, 0x00, 0xa9, 0x00, 0x4e, 0x00, 0xb8, 0x00, 0xb2,
+    0x00, 0xb3, 0x00, 0xb6, 0x03, 0xc4, 0x00, 0x20, 0x04, 0x00, 0x00, 0x0b, 0x00, 0xb8, 0x00, 0xb2,
+    0x00, 0xb5, 0x00, 0x98, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x17, 0x01, 0x15, 0x02, 0x0a,
+    0x00, 0x16, 0x00, 0xb6, 0x00, 0xb3, 0x00, 0xb2, 0x00, 0xb5, 0x02, 0xc4, 0x00, 0xca, 0x00, 0x33,
+    0x00, 0x00, 0x00, 0x0d, 0x00, 0xa1, 0x00, 0xbf, 0x00, 0xc1, 0x00, 0x43, 0x00, 0x84, 0x00, 0xbf,
+    0x00, 0xc1, 0x00, 0x49, 0x00, 0x00, 0x00, 0x14, 0x00, 0xae, 0x00, 0xb2, 0x00, 0xbf, 0x00, 0x83,
+    0x00, 0x22, 0x00, 0x37, 0x00, 0x7b, 0x01, 0xb3, 0x00, 0xc1, 0x00, 0x5c, 0xb0, 0x00, 0x00, 0x1f,
+    0x00, 0xc2, 0x05, 0xb3, 0x00, 0xbf, 0x00, 0x8c, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x99,
+    0x00, 0xbf, 0x05, 0xb3, 0x00, 0xb5, 0x00, 0x1b, 0x01, 0x00, 0x00, 0x5b, 0x00, 0xc1, 0x04, 0xb3,
+    0x00, 0xb2, 0x00, 0xc1, 0x00, 0x41, 0x05, 0x00, 0x00, 0x1e, 0x00, 0xc2, 0x00, 0xb3, 0x00, 0xbf,
+    0x00, 0x6d, 0x01, 0x00, 0x00, 0x31, 0x00, 0xc2, 0x03, 0xb5, 0x00, 0xbf, 0x00, 0x2a, 0x00, 0x66,
+    0x01, 0xbf, 0x00, 0x6f, 0x00, 0x06, 0x00, 0xb5, 0x00, 0xb2, 0x00, 0xc1, 0x00, 0x1f, 0x00, 0x00,
+    0x00, 0x40, 0x00, 0xc1, 0x00, 0xb2, 0x00, 0x9e, 0x00, 0x87, 0x00, 0xbd, 0x00, 0xc3, 0x00, 0x15,
+    0x00, 0x52, 0x00, 0xc1, 0x00, 0xb5, 0x00, 0x89, 0x00, 0xb8, 0x00, 0xb2, 0x00, 0xad, 0x00, 0x4d,
+    0x00, 0xbf, 0x01, 0xb3, 0x03, 0xb2, 0x00, 0xb8, 0x00, 0x0b, 0x04, 0x00, 0x00, 0x1b, 0x00, 0xb5,
+    0x00, 0xb3, 0x00, 0xbf, 0x00, 0x84, 0x01, 0x00, 0x00, 0x24, 0x00, 0xc3, 0x03, 0xb5, 0x00, 0xc0,
+    0x00, 0x94, 0x00, 0xaa, 0x01, 0xb3, 0x03, 0xb2, 0x00, 0xc2, 0x00, 0x29, 0x00, 0x00, 0x00, 0x34,
+    0x00, 0xc1, 0x00, 0xb2, 0x00, 0xaa, 0x00, 0x0d, 0x00, 0x86, 0x01, 0xbf, 0x00, 0x61, 0x00, 0x00,
+    0x00, 0x19, 0x00, 0xc3, 0x00, 0xb2, 0x01, 0xb3, 0x00, 0xb5, 0x01, 0xbf, 0x00, 0xb3, 0x00, 0xbf,
+    0x00, 0xa2, 0x00, 0x0c, 0xb0, 0x00, 0x00, 0x70, 0x00, 0xbf, 0x05, 0xb3, 0x00, 0xc1, 0x00, 0x35,
+    0x01, 0x00, 0x00, 0x34, 0x00, 0xc1, 0x05, 0xb3, 0x00, 0xbf, 0x00, 0x6f, 0x01, 0x00, 0x00, 0x0c,
+    0x00, 0xac, 0x00, 0xb2, 0x04, 0xb3, 0x00, 0xb4, 0x00, 0xa2, 0x00, 0x0d, 0x05, 0x00, 0x00, 0x29,
+    0x00, 0xbf, 0x00, 0xb3, 0x00, 0xc1, 0x00, 0x68, 0x01, 0x00, 0x00, 0x3a, 0x00, 0xc3, 0x00, 0xb2,
+    0x01, 0xb3, 0x00, 0xb2, 0x00, 0xb6, 0x00, 0x34, 0x00, 0xab, 0x00, 0xb2, 0x00, 0xbf, 0x00, 0x2a,
+    0x00, 0x06, 0x00, 0xb9, 0x00, 0xb2, 0x00, 0xbf, 0x00, 0x35, 0x00, 0x00, 0x00, 0x5b, 0x00, 0xbf,
+    0x00, 0xbe, 0x00, 0x6b, 0x00, 0x5a, 0x00, 0xbf, 0x00, 0xc1, 0x00, 0x24, 0x00, 0x8e, 0x00, 0xbe,
+    0x00, 0x8e, 0x00, 0x45, 0x00, 0xbf, 0x00, 0xbd, 0x00, 0x87, 0x00, 0x5f, 0x00, 0xbe, 0x00, 0xb3,
+    0x00, 0xb2, 0x00, 0xbf, 0x02, 0xc1, 0x00, 0xaf, 0x00, 0x0c, 0x04, 0x00, 0x00, 0x31, 0x00, 0xbf,
+    0x00, 0xb3, 0x00, 0xbf, 0x00, 0x73, 0x01, 0x00, 0x00, 0x2e, 0x00, 0xc1, 0x00, 0xb2, 0x01, 0xb3,
+    0x00, 0xb2, 0x00, 0xab, 0x00, 0x8b, 0x01, 0xb3, 0x00, 0xb2, 0x00, 0xbf, 0x02, 0xc1, 0x00, 0xb8,
+    0x00, 0x1d, 0x00, 0x00, 0x00, 0x8e, 0x00, 0xbe, 0x00, 0xbf, 0x00, 0x71, 0x00, 0x00, 0x00, 0x7d,
+    0x00, 0xbf, 0x00, 0xbe, 0x00, 0x87, 0x00, 0x00, 0x00, 0x24, 0x00, 0xbf, 0x01, 0xb3, 0x00, 0xb2,
+    0x03, 0xb3, 0x00, 0xa3, 0x00, 0x19, 0xb0, 0x00, 0x00, 0x14, 0x00, 0xaa, 0x05, 0xb3, 0x00, 0xbe,
+    0x00, 0x8d, 0x00, 0x03, 0x01, 0x00, 0x00, 0x7b, 0x00, 0xbf, 0x04, 0xb3, 0x00, 0xb2, 0x00, 0xb6,
+    0x00, 0x1b, 0x01, 0x00, 0x00, 0x4c, 0x00, 0xbf, 0x05, 0xb3, 0x00, 0xc1, 0x00, 0x4c, 0x06, 0x00,
+    0x00, 0x2a, 0x00, 0xbf, 0x00, 0xb3, 0x00, 0xc1, 0x00, 0x63, 0x01, 0x00, 0x00, 0x5b, 0x00, 0xc7,
+    0x00, 0xbf, 0x01, 0xb3, 0x00, 0xb2, 0x00, 0xa3, 0x00, 0x75, 0x01, 0xb2, 0x00, 0xae, 0x00, 0x26,
+    0x00, 0x22, 0x00, 0xae, 0x00, 0xb2, 0x00, 0xbf, 0x00, 0x57, 0x00, 0x00, 0x00, 0x90, 0x00, 0xbe,
+    0x00, 0xbf, 0x00, 0x43, 0x00, 0x48, 0x00, 0xc1, 0x00, 0xb6, 0x00, 0x73, 0x00, 0xb5, 0x00, 0xbf,
+    0x00, 0x59, 0x00, 0x5e, 0x01, 0xbf, 0x00, 0x67, 0x00, 0x7f, 0x00, 0xbe, 0x00, 0xb2, 0x00, 0xb6,
+    0x00, 0x70, 0x01, 0x67, 0x00, 0x6f, 0x00, 0x4c, 0x05, 0x00, 0x00, 0x37, 0x00, 0xbf, 0x00, 0xb3,
+    0x00, 0xbf, 0x00, 0x6a, 0x01, 0x00, 0x00, 0x5c, 0x00, 0xc6, 0x00, 0xbf, 0x00, 0xb2, 0x00, 0xb3,
+    0x00, 0xb2, 0x00, 0xa1, 0x00, 0x8b, 0x00, 0xb3, 0x00, 0xb2, 0x00, 0xb5, 0x00, 0x7b, 0x02, 0x67,
+    0x00, 0x5b, 0x00, 0x03, 0x00, 0x20, 0x00, 0xb5, 0x00, 0xb2, 0x00, 0xc2, 0x00, 0x4d, 0x00, 0x18,
+    0x00, 0x73, 0x00, 0xbf, 0x00, 0xb2, 0x00, 0xa5, 0x00, 0x03, 0x00, 0x56, 0x00, 0xbf, 0x00, 0xb3,
+    0x00, 0xb2, 0x00, 0xc1, 0x01, 0xb3, 0x00, 0xb2, 0x00, 0xbb, 0x00, 0x1b, 0xb1, 0x00, 0x00, 0x39,
+    0x00, 0xc1, 0x05, 0xb3, 0x00, 0xc2, 0x00, 0x24, 0x01, 0x00, 0x00, 0x12, 0x00, 0xb5, 0x05, 0xb3,
+    0x00, 0xc1, 0x00, 0x5c, 0x02, 0x00, 0x00, 0x83, 0x00, 0xbf, 0x04, 0xb3, 0x00, 0xbf, 0x00, 0x8e,
+    0x00, 0x03, 0x06, 0x00, 0x00, 0x23, 0x00, 0xc1, 0x00, 0xb3, 0x00, 0xc1, 0x00, 0x66, 0x01, 0x00,
+    0x00, 0x37, 0x00, 0x5e, 0x00, 0x4d, 0x00, 0x99, 0x00, 0xbd, 0x00, 0xb2, 0x00, 0xa5, 0x00, 0xae,
+    0x01, 0xb2, 0x00, 0xb5, 0x01, 0xac, 0x00, 0xb5, 0x00, 0xb2, 0x00, 0xbf, 0x00, 0x72, 0x00, 0x03,
+    0x00, 0xae, 0x00, 0xb2, 0x00, 0xc1, 0x00, 0x23, 0x00, 0x49, 0x00, 0xc1, 0x00, 0xb3, 0x00, 0xc2,
+    0x00, 0xb2, 0x00, 0xb5, 0x00, 0x1c, 0x00, 0x77, 0x00, 0xbf, 0x00, 0xc1, 0x00, 0x61, 0x00, 0x8e,
+    0x00, 0xbf, 0x00, 0xbe, 0x00, 0x87, 0x0a, 0x00, 0x00, 0x2b, 0x00, 0xb5, 0x00, 0xb3, 0x00, 0xbf,
+    0x00, 0x7b, 0x01, 0x00, 0x00, 0x38, 0x00, 0x5e, 0x00, 0x4e, 0x00, 0x9a, 0x01, 0xb2, 0x00, 0x9b,
+    0x00, 0x87, 0x00, 0xbf, 0x00, 0xb2, 0x00, 0x99, 0x00, 0x09, 0x04, 0x00, 0x00, 0x5b, 0x00, 0xc1,
+    0x00, 0xb2, 0x00, 0xb3, 0x00, 0xac, 0x00, 0xad, 0x00, 0xb6, 0x01, 0xb2, 0x00, 0xad, 0x00, 0x06,
+    0x00, 0x72, 0x00, 0xbf, 0x00, 0xb2, 0x00, 0xb8, 0x00, 0x29, 0x00, 0x83, 0x00, 0xbf, 0x00, 0xb3,
+    0x00, 0xc1, 0x00, 0x30, 0xb1, 0x00, 0x00, 0x88, 0x00, 0xbd, 0x04, 0xb3, 0x00, 0xbf, 0x00, 0x5b,
+    0x02, 0x00, 0x00, 0x45, 0x00, 0xbf, 0x04, 0xb3, 0x00, 0xbf, 0x00, 0x98, 0x00, 0x07, 0x01, 0x00,
+    0x00, 0x17, 0x00, 0xbb, 0x00, 0xb2, 0x03, 0xb3, 0x00, 0xb2, 0x00, 0xb7, 0x00, 0x24, 0x07, 0x00,
+    0x00, 0x1b, 0x00, 0xc3, 0x01, 0xb2, 0x00, 0xa2, 0x00, 0x0d, 0x02, 0x00, 0x00, 0x12, 0x00, 0xa1,
+    0x00, 0xb2, 0x00, 0xb3, 0x00, 0xb1, 0x00, 0xb5, 0x00, 0xb2, 0x00, 0xb3, 0x03, 0xb2, 0x00, 0xb3,
+    0x00, 0xbf, 0x00, 0x7b, 0x00, 0x07, 0x00, 0xb5, 0x00, 0xb2, 0x00, 0xc3, 0x00, 0x19, 0x00, 0x42,
+    0x00, 0xc1, 0x00, 0xb3, 0x00, 0xb2, 0x00, 0xbe, 0x00, 0x8d, 0x00, 0x18, 0x00, 0x97, 0x00, 0xbe,
+    0x00, 0xb5, 0x00, 0x58, 0x00, 0x96, 0x00, 0xb5, 0x00, 0xc1, 0x00, 0x50, 0x0a, 0x00, 0x00, 0x12,
+    0x00, 0xb5, 0x00, 0xb2, 0x00, 0xb5, 0x00, 0xa1, 0x00, 0x0d, 0x02, 0x00, 0x00, 0x17, 0x00, 0xaa,
+    0x00, 0xb3, 0x00, 0xbe, 0x00, 0x5f, 0x00, 0x7a, 0x00, 0xbe, 0x00, 0xbf, 0x00, 0x77, 0x04, 0x00,
+    0x00, 0x07, 0x00, 0xac, 0x00, 0xb2, 0x00, 0xb3, 0x03, 0xb2, 0x01, 0xb3, 0x00, 0xaa, 0x00, 0x05,
+    0x00, 0x81, 0x00, 0xbf, 0x00, 0xb2, 0x00, 0xa5, 0x00, 0x01, 0x00, 0x3c, 0x00, 0xbf, 0x00, 0xb3,
+    0x00, 0xbf, 0x00, 0x79, 0xb1, 0x00, 0x00, 0xbb, 0x00, 0xb2, 0x03, 0xb3, 0x00, 0xbf, 0x00, 0x8f,
+    0x00, 0x07, 0x02, 0x00, 0x00, 0x60, 0x00, 0xc1, 0x03, 0xb3, 0x00, 0xb2, 0x00, 0xb8, 0x00, 0x20,
+    0x02, 0x00, 0x00, 0x1f, 0x00, 0xc1, 0x00, 0xb2, 0x02, 0xb3, 0x00, 0xb2, 0x00, 0xbf, 0x00, 0x4c,
+    0x08, 0x00, 0x00, 0x0c, 0x00, 0x9a, 0x00, 0xbe, 0x00, 0xb3, 0x00, 0xbf, 0x00, 0x67, 0x00, 0x17,
+    0x00, 0x08, 0x00, 0x2f, 0x00, 0x9a, 0x00, 0xbf, 0x00, 0xb2, 0x00, 0xb8, 0x00, 0xb0, 0x00, 0xb2,
+    0x00, 0xb3, 0x00, 0xb5, 0x02, 0xbf, 0x00, 0xb5, 0x00, 0xb3, 0x00, 0xbf, 0x00, 0x76, 0x00, 0x21,
+    0x00, 0xb5, 0x00, 0xb2, 0x00, 0xc4, 0x00, 0x1b, 0x00, 0x3c, 0x00, 0xc2, 0x00, 0xb2, 0x00, 0xb3,
+    0x00, 0xc1, 0x00, 0x39, 0x00, 0x20, 0x00, 0xba, 0x00, 0xb2, 0x00, 0xa8, 0x00, 0x4f, 0x00, 0xab,
+    0x00, 0xb2, 0x00, 0xbf, 0x00, 0x70, 0x00, 0x3b, 0x01, 0x3a, 0x00, 0x41, 0x00, 0x2f, 0x05, 0x00,
+    0x00, 0x07, 0x00, 0xa4, 0x00, 0xb2, 0x00, 0xb3, 0x00, 0xbf, 0x00, 0x6e, 0x00, 0x1d, 0x00, 0x07,
+    0x00, 0x2b, 0x00, 0x98, 0x00, 0xbf, 0x00, 0xb2, 0x00, 0xb5, 0x00, 0x2b, 0x00, 0xac, 0x00, 0xb2,
+    0x00, 0xbf, 0x00, 0x90, 0x02, 0x3a, 0x00, 0x42, 0x00, 0x2e, 0x00, 0x3d, 0x00, 0xbf, 0x00, 0xb3,
+    0x00, 0xb5, 0x02, 0xbf, 0x00, 0xb5, 0x01, 0xb3, 0x00, 0xa8, 0x00, 0x17, 0x00, 0x81, 0x01, 0xbf,
+    0x00, 0x6f, 0x00, 0x00, 0x00, 0x11, 0x00, 0xac, 0x01, 0xb2, 0x00, 0xb8, 0x00, 0x1b, 0xb0, 0x00,
+    0x00, 0xb6, 0x00, 0xb2, 0x02, 0xb3, 0x00, 0xbf, 0x00, 0xac, 0x00, 0x17, 0x03, 0x00, 0x00, 0x66,
+    0x00, 0xbf, 0x02, 0xb3, 0x00, 0xb2, 0x00, 0xc3, 0x00, 0x3b, 0x03, 0x00, 0x00, 0x36, 0x00, 0xbf,
+    0x02, 0xb3, 0x00, 0xb2, 0x00, 0xc1, 0x00, 0x71, 0x00, 0x03, 0x09, 0x00, 0x00, 0x5b, 0x00, 0xc1,
+    0x01, 0xb3, 0x00, 0xbf, 0x00, 0xaa, 0x00, 0xa0, 0x00, 0xb5, 0x00, 0xbf, 0x00, 0xb2, 0x00, 0xb5,
+    0x00, 0x93, 0x00, 0xac, 0x00, 0xb2, 0x00, 0xbf, 0x00, 0x7b, 0x02, 0x3e, 0x00, 0x83, 0x01, 0xbf,
+    0x00, 0x80, 0x00, 0x46, 0x00, 0xbf, 0x00, 0xb2, 0x00, 0xac, 0x00, 0x0f, 0x00, 0x37, 0x00, 0xbf,
+    0x00, 0xb2, 0x00, 0xb3, 0x00, 0xab, 0x00, 0x08, 0x00, 0x28, 0x00, 0xc1, 0x00, 0xb2, 0x00, 0xa0,
+    0x00, 0x57, 0x00, 0xc2, 0x00, 0xb2, 0x00, 0xb3, 0x00, 0xbf, 0x02, 0xc3, 0x00, 0xc9, 0x00, 0x6f,
+    0x06, 0x00, 0x00, 0x51, 0x00, 0xc1, 0x01, 0xb3, 0x00, 0xbf, 0x00, 0xaa, 0x00, 0x9f, 0x00, 0xb5,
+    0x00, 0xbf, 0x00, 0xb3, 0x00, 0xc1, 0x00, 0x60, 0x00, 0x15, 0x00, 0xc1, 0x00, 0xb2, 0x00, 0xb3,
+    0x00, 0xb5, 0x02, 0xc3, 0x00, 0xc8, 0x00, 0xa5, 0x00, 0x87, 0x00, 0xbf, 0x00, 0xb3, 0x00, 0xa0,
+    0x00, 0x45, 0x01, 0x3e, 0x00, 0x5e, 0x00, 0xc1, 0x00, 0xb2, 0x00, 0xa8, 0x00, 0x47, 0x00, 0xa1,
+    0x00, 0xb2, 0x00, 0xc1, 0x00, 0x50, 0x01, 0x00, 0x00, 0x67, 0x00, 0xbf, 0x00, 0xb3, 0x00, 0xc1,
+    0x00, 0x4c, 0xb0, 0x00, 0x00, 0xc2, 0x00, 0xb2, 0x00, 0xb3, 0x00, 0xb2, 0x00, 0xbf, 0x00, 0xac,
+    0x00, 0x1b, 0x04, 0x00, 0x00, 0x66, 0x00, 0xbf, 0x01, 0xb3, 0x00, 0xbe, 0x00, 0xc3, 0x00, 0x42,
+    0x04, 0x00, 0x00, 0x2f, 0x00, 0xbf, 0x01, 0xb3, 0x00, 0xb2, 0x00, 0xc1, 0x00, 0x7c, 0x00, 0x06,
+    0x0a, 0x00, 0x00, 0x0d, 0x00, 0xa3, 0x00, 0xbf, 0x02, 0xb3, 0x00, 0xb5, 0x00, 0xb3, 0x00, 0xb2,
+    0x00, 0xc1, 0x00, 0x85, 0x00, 0x4d, 0x00, 0xc1, 0x00, 0xb2, 0x00, 0xb5, 0x00, 0x24, 0x02, 0x00,
+    0x00, 0x49, 0x00, 0xc1, 0x00, 0xb2, 0x00, 0xa1, 0x00, 0x8a, 0x00, 0xb5, 0x00, 0xbf, 0x00, 0x8c,
+    0x00, 0x01, 0x00, 0x26, 0x00, 0xb5, 0x00, 0xb3, 0x00, 0xbf, 0x00, 0x67, 0x00, 0x00, 0x00, 0x53,
+    0x00, 0xbf, 0x00, 0xb2, 0x00, 0x9c, 0x00, 0x52, 0x00, 0xbf, 0x02, 0xb3, 0x02, 0xb2, 0x00, 0xc1,
+    0x00, 0x50, 0x06, 0x00, 0x00, 0x07, 0x00, 0x98, 0x00, 0xbf, 0x02, 0xb3, 0x00, 0xb5, 0x00, 0xb3,
+    0x00, 0xb2, 0x00, 0xbf, 0x00, 0xa3, 0x00, 0x0d, 0x00, 0x37, 0x00, 0xbf, 0x02, 0xb3, 0x03, 0xb2,
+    0x00, 0xb1, 0x00, 0xb8, 0x00, 0xb2, 0x00, 0xbf, 0x00, 0x61, 0x02, 0x00, 0x00, 0x1b, 0x00, 0xc4,
+    0x00, 0xb2, 0x00, 0xb3, 0x00, 0x95, 0x00, 0xb8, 0x00, 0xb2, 0x00, 0xc2, 0x00, 0x44, 0x01, 0x00,
+    0x00, 0x2b, 0x00, 0xbf, 0x00, 0xb3, 0x00, 0xbf, 0x00, 0x98, 0x00, 0x03, 0xaf, 0x00, 0x00, 0x91,
+    0x00, 0xbe, 0x00, 0xbd, 0x00, 0xc1, 0x00, 0x86, 0x00, 0x17, 0x05, 0x00, 0x00, 0x4c, 0x00, 0xc7,
+    0x00, 0xb2, 0x00, 0xc1, 0x00, 0xa2, 0x00, 0x30, 0x05, 0x00, 0x00, 0x15, 0x00, 0xb8, 0x00, 0xbd,
+    0x00, 0xbf, 0x00, 0xb8, 0x00, 0x5c, 0x00, 0x03, 0x0c, 0x00, 0x00, 0x1b, 0x00, 0xa3, 0x00, 0xc1,
+    0x03, 0xb2, 0x00, 0xc1, 0x00, 0x7b, 0x00, 0x16, 0x00, 0x98, 0x00, 0xbf, 0x00, 0xc6, 0x00, 0x9a,
+    0x03, 0x00, 0x00, 0x52, 0x00, 0xc7, 0x00, 0xbe, 0x00, 0xc1, 0x00, 0xc4, 0x00, 0xbe, 0x00, 0xc6,
+    0x00, 0x82, 0x00, 0x00, 0x00, 0x17, 0x00, 0xb5, 0x00, 0xbe, 0x00, 0xc3, 0x00, 0x24, 0x00, 0x00,
+    0x00, 0x91, 0x01, 0xc5, 0x01, 0x73, 0x00, 0xc5, 0x04, 0xbf, 0x00, 0xbe, 0x00, 0xc8, 0x00, 0x45,
+    0x07, 0x00, 0x00, 0x16, 0x00, 0x9a, 0x00, 0xc1, 0x03, 0xb2, 0x00, 0xc1, 0x00, 0x86, 0x00, 0x12,
+    0x00, 0x00, 0x00, 0x69, 0x00, 0xc6, 0x06, 0xbf, 0x00, 0xc1, 0x00, 0xbf, 0x00, 0xbe, 0x00, 0xc3,
+    0x00, 0x1b, 0x02, 0x00, 0x00, 0x1d, 0x00, 0xc4, 0x00, 0xbe, 0x00, 0xbf, 0x00, 0xc2, 0x00, 0xbf,
+    0x00, 0xbe, 0x00, 0xbf, 0x00, 0x27, 0x01, 0x00, 0x00, 0x03, 0x00, 0xa3, 0x01, 0xbe, 0x00, 0xc8,
+    0x00, 0x2f, 0xaf, 0x00, 0x00, 0x12, 0x01, 0x88, 0x00, 0x35, 0x00, 0x03, 0x06, 0x00, 0x00, 0x03,
+    0x00, 0x5c, 0x00, 0x9d, 0x00, 0x52, 0x00, 0x13, 0x07, 0x00, 0x00, 0x34, 0x00, 0x9d, 0x00, 0x69,
+    0x00, 0x20, 0x0f, 0x00, 0x00, 0x0d, 0x00, 0x4c, 0x00, 0xa7, 0x01, 0xb8, 0x00, 0x9c, 0x00, 0x35,
+    0x00, 0x03, 0x00, 0x18, 0x00, 0x5d, 0x00, 0x55, 0x00, 0x5c, 0x00, 0x2b, 0x03, 0x00, 0x00, 0x20,
+    0x00, 0x62, 0x00, 0x55, 0x01, 0x5c, 0x00, 0x55, 0x00, 0x5d, 0x00, 0x35, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x52, 0x00, 0x5c, 0x00, 0x43, 0x00, 0x03, 0x00, 0x00, 0x00, 0x4d, 0x01, 0x5c, 0x00, 0x2c,
+    0x00, 0x45, 0x00, 0x5c, 0x04, 0x55, 0x01, 0x5c, 0x00, 0x17, 0x08, 0x00, 0x00, 0x0c, 0x00, 0x4c,
+    0x00, 0xa7, 0x01, 0xb8, 0x00, 0x9c, 0x00, 0x3a, 0x00, 0x04, 0x01, 0x00, 0x00, 0x3c, 0x00, 0x62,
+    0x09, 0x5c, 0x00, 0x4d, 0x00, 0x03, 0x02, 0x00, 0x00, 0x08, 0x00, 0x55, 0x04, 0x5c, 0x00, 0x55,
+    0x00, 0x03, 0x02, 0x00, 0x00, 0x2b, 0x00, 0x62, 0x00, 0x5c, 0x00, 0x62, 0x00, 0x32, 0xff, 0x00,
+    0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
+    0x63, 0x00,
 #else
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x89A4,0xB368,0xBBC9,0x7943,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x7923,0xAAE7,0xC409,0x9205,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6882,0x9A45,0xC3E9,0xAAE7,0x6861,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0x89E5,0xBBC9,0xD489,0xD488,0xDCA9,0xC3E9,0x9205,0x6041,0x6000,0x6000,0x6000,0x6000,0x6000,0x89E5,0xAB27,0xAAE7,0xAB27,0x81A5,0x6000,0x6000,0x6000,0x70E2,0xA2C7,0xA2A6,0xA2A6,0xA2C6,0x89C5,0x6000,0x6000,0x6000,0x6000,0x8164,0xAB07,0xA2C6,0xA2C6,0xA2C6,0x89C5,0xA2E7,0xA2E7,0xA2E6,0xA2E6,0xA2E6,0xA2E6,0xA2E6,0xAAE7,0x9A66,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x89E4,0xBBC9,0xD4A9,0xD488,0xD489,0xC409,0x9225,0x6041,0x6000,0x6000,0x6020,0xA2A6,0xAAE7,0xA2E6,0xA2E6,0xA2E6,0xA2E6,0xA2E6,0xAAE7,0xA2E7,0x6841,0x6000,0x6000,0x7903,0xAAE7,0xAAE7,0xAB07,0x9A87,0x6000,0x6000,0x6000,0x6040,0x9A66,0xAAE7,0xA2E6,0xA2E6,0xA2C6,0xA2C6,0xA2A6,0x89E5,0x6041,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6881,0xB347,0xDC88,0xDC67,0xDC66,0xC3C7,0x6861,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A45,0xD468,0xDC87,0xDC46,0xDC67,0x7943,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x8164,0xCC08,0xDC87,0xDC46,0xE4A7,0xA285,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6881,0xBB88,0xDC88,0xDC66,0xD446,0xD446,0xD446,0xDC46,0xDC87,0xBB87,0x70C2,0x6000,0x6000,0x6000,0x68A2,0xCC48,0xDC66,0xDC67,0xE4A7,0xB348,0x6000,0x6000,0x6000,0x89C4,0xE4C8,0xDC67,0xDC67,0xE4A7,0xB367,0x6000,0x6000,0x6000,0x6000,0xBBA7,0xE487,0xDC67,0xDC66,0xDC88,0xAB08,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xE487,0xC3C8,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6861,0xB367,0xDC88,0xDC66,0xD446,0xD446,0xD446,0xDC46,0xDC87,0xBBA7,0x6881,0x6000,0x7924,0xD447,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC66,0xD489,0x6881,0x6000,0x6000,0xAB06,0xE487,0xDC67,0xDC87,0xCC48,0x6020,0x6000,0x6000,0x70A1,0xDCA9,0xDC66,0xDC67,0xDC67,0xDC67,0xDC67,0xDC87,0xDCA8,0xBBC8,0x6881,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x68A2,0xBBA7,0xDC87,0xD446,0xD447,0xD446,0xD488,0x81A5,0x6000,0x6000,0x6000,0x6000,0x6020,0xA2C6,0xDC87,0xD446,0xD447,0xD447,0xDC67,0xA308,0x6000,0x6000,0x6000,0x6000,0x6000,0x89E5,0xD447,0xDC67,0xD446,0xD447,0xDC66,0xC3C8,0x6041,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6881,0xC3C8,0xDC87,0xD446,0xD447,0xD447,0xD467,0xD447,0xD447,0xD446,0xDC87,0xB367,0x6020,0x6000,0x6000,0x9205,0xDC87,0xD447,0xD447,0xDC87,0xB347,0x6000,0x6000,0x6000,0x9A45,0xDC87,0xD447,0xD447,0xDC67,0xB346,0x6000,0x6000,0x6000,0x7923,0xD468,0xD447,0xD447,0xD446,0xCC28,0xAB29,0xD446,0xD447,0xD447,0xD446,0xD446,0xD446,0xD446,0xDC67,0xB368,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6041,0xBB87,0xE487,0xD446,0xD447,0xD447,0xD467,0xD447,0xD447,0xD446,0xDC87,0xBB67,0x6020,0x9226,0xDC88,0xD446,0xD447,0xD447,0xD446,0xD446,0xD446,0xDC66,0xBBC8,0x6041,0x6000,0x70A2,0xD468,0xD446,0xD447,0xD467,0xCC07,0x6861,0x6000,0x6000,0x7923,0xD467,0xD447,0xD447,0xD446,0xD446,0xD446,0xD447,0xD446,0xE487,0xAB07,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6861,0xBB87,0xDC87,0xD447,0xD447,0xD447,0xD446,0xD488,0x81A5,0x6000,0x6000,0x6000,0x6000,0xA2A6,0xDC87,0xD447,0xD447,0xD447,0xD447,0xDC67,0xAB28,0x6000,0x6000,0x6000,0x6000,0x81A4,0xD448,0xDC66,0xD447,0xD447,0xD447,0xDC66,0xC409,0x6882,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xA2A6,0xDC87,0xD447,0xD447,0xDC67,0xD467,0xCC06,0xD447,0xDC67,0xD447,0xD446,0xDC88,0x8163,0x6000,0x6000,0xC3E8,0xDC67,0xD447,0xD447,0xDC67,0xB346,0x6000,0x6000,0x6000,0xB388,0xDC67,0xD447,0xD447,0xDC67,0xBB66,0x6000,0x6000,0x6000,0xA2C6,0xDC87,0xD447,0xD447,0xDC67,0xBB87,0xB3AA,0xDC67,0xD447,0xD447,0xDC87,0xDCA8,0xDCA8,0xDCA8,0xE4C8,0x9A66,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A86,0xDC87,0xD446,0xD447,0xDC67,0xD467,0xCC06,0xD447,0xDC67,0xD447,0xD446,0xDC88,0x8143,0x9225,0xDC88,0xD447,0xD447,0xDC87,0xDCA8,0xDCA8,0xDCA8,0xECC8,0xAAE6,0x6000,0x6000,0x9A66,0xDC67,0xD447,0xD447,0xD447,0xD427,0x7923,0x6000,0x6000,0x9A67,0xDC67,0xD447,0xD447,0xD467,0xD468,0xDC88,0xD447,0xD447,0xD446,0xD489,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6040,0xB347,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD446,0xD448,0x7944,0x6000,0x6000,0x6000,0x9204,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC67,0x9A66,0x6000,0x6000,0x6000,0x70C1,0xCC07,0xDC67,0xD447,0xD447,0xD447,0xD447,0xDC67,0xB347,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x70E2,0xD468,0xD446,0xD447,0xDC67,0xBB87,0x81A5,0x6861,0x8184,0xC3E8,0xDC67,0xD447,0xDC67,0xAB28,0x6000,0x8164,0xD467,0xD447,0xD447,0xD447,0xDC66,0xC3A7,0x6041,0x6000,0x6000,0xC429,0xD467,0xD447,0xD447,0xDC67,0xC3C7,0x6861,0x6000,0x6861,0xCC28,0xD467,0xD447,0xD447,0xDC67,0xBB67,0xBBA8,0xDC67,0xD446,0xD448,0xA2C6,0x9A65,0x9A65,0x9A65,0x9A85,0x70C2,0x6000,0x6000,0x6000,0x6000,0x6000,0x70E3,0xD448,0xD446,0xD447,0xDC67,0xBB87,0x81A5,0x6861,0x8164,0xBBA7,0xDC67,0xD447,0xDC67,0x9245,0x9A24,0xDC87,0xD447,0xD447,0xAB07,0x9A65,0x9A65,0x9A65,0x9A85,0x7923,0x6000,0x6861,0xC3A7,0xDC67,0xD447,0xD447,0xD447,0xD468,0x89C5,0x6000,0x6000,0xAB28,0xDC87,0xD446,0xDC88,0x9A87,0x89C5,0x9246,0xCC48,0xD447,0xD446,0xD468,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A45,0xDC87,0xD446,0xD447,0xD447,0xD447,0xD447,0xDC67,0xC3C7,0x6020,0x6000,0x6000,0x7923,0xD468,0xD446,0xD447,0xD447,0xD447,0xD447,0xD446,0xDC88,0x7922,0x6000,0x6000,0x6020,0xBBC8,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC87,0xA2A6,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xAAE6,0xDC87,0xD447,0xDC67,0xC408,0x6882,0x6000,0x6000,0x6000,0x89C5,0xDC87,0xDC67,0xE487,0xC3C8,0x6000,0xAAE6,0xDC87,0xD446,0xD467,0xD447,0xD446,0xCC48,0x70E3,0x6000,0x6861,0xCC07,0xD467,0xD447,0xD447,0xDC46,0xCC28,0x70C2,0x6000,0x9205,0xDC87,0xD446,0xD447,0xD447,0xDC67,0xB38A,0xBBA6,0xDC67,0xDC67,0xB366,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xA2A6,0xDC87,0xD447,0xDC67,0xCC08,0x6881,0x6000,0x6000,0x6000,0x8A06,0xDC88,0xDC67,0xDC87,0xBBA9,0xAB27,0xDC66,0xDC67,0xC3E7,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x8163,0xDC88,0xD446,0xD467,0xD467,0xD446,0xDC88,0x9246,0x6000,0x6000,0xB326,0xDC67,0xD446,0xD489,0x70E3,0x6000,0x6000,0xB3A9,0xDC67,0xD446,0xD467,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x7903,0xD448,0xD446,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC67,0xB348,0x6000,0x6000,0x6041,0xBB87,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xCC08,0x6882,0x6000,0x6000,0x9A45,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD467,0x89C5,0x6000,0x6000,0x6000,0x6000,0x6000,0x6861,0xC3C7,0xDC67,0xD446,0xDC87,0x89C4,0x6000,0x6000,0x6000,0x6000,0x70A2,0xB366,0xB346,0xBB66,0xA2C6,0x6861,0xCC48,0xD446,0xD467,0xC409,0xD447,0xD446,0xD489,0x7923,0x6000,0x7964,0xD447,0xD447,0xD447,0xD447,0xD446,0xD469,0x7103,0x6000,0xBB87,0xDC67,0xD446,0xD447,0xD447,0xD447,0xAB29,0xCC28,0xD446,0xDC67,0xB367,0x7923,0x7923,0x7923,0x7923,0x6861,0x6000,0x6000,0x6000,0x6000,0x6000,0x6861,0xC3E8,0xDC66,0xD447,0xDC87,0x9205,0x6000,0x6000,0x6000,0x6000,0x70E3,0xB346,0xB346,0xBB46,0xAB28,0xCC49,0xD446,0xDC67,0xCC28,0x7923,0x7923,0x7923,0x7943,0x6881,0x6000,0x6000,0xB347,0xDC67,0xD446,0xC408,0xCC69,0xD446,0xDCA8,0x9A65,0x6000,0x6861,0xC3C7,0xDC67,0xDC67,0xBBA7,0x6020,0x6000,0x6041,0xC409,0xD466,0xD446,0xD489,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0xB347,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xDC88,0x8163,0x6000,0x6000,0x9205,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC87,0xAAE6,0x6000,0x6000,0x70C2,0xD448,0xD446,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC46,0xCC08,0x6040,0x6000,0x6000,0x6000,0x6000,0x6000,0x7923,0xDC89,0xD446,0xD446,0xCC28,0x68A2,0x6000,0x6041,0x7903,0x7902,0x70E2,0x6881,0x6881,0x70A1,0x6040,0x9245,0xDC67,0xD446,0xCC28,0x89A4,0xD426,0xD446,0xDCA8,0x7923,0x6000,0x9246,0xDC88,0xD446,0xD489,0xD489,0xD446,0xD489,0x7903,0x70E3,0xD467,0xD446,0xD4AA,0xD468,0xD446,0xD447,0xA2E8,0xD488,0xD446,0xD447,0xD468,0xDCA9,0xDCA9,0xDCA9,0xDCA9,0x8164,0x6000,0x6000,0x6000,0x6000,0x6000,0x70C1,0xD488,0xD446,0xD467,0xCC07,0x68A2,0x6000,0x6041,0x7923,0x7902,0x70E2,0x6881,0x6881,0x6881,0x7903,0xD468,0xD447,0xD446,0xD467,0xDCA9,0xDCA9,0xDCA9,0xE4C9,0x9204,0x6000,0x70C2,0xCC27,0xDC67,0xDC87,0x9A86,0xC3C7,0xDC67,0xDC87,0xA265,0x6000,0x7103,0xD469,0xD446,0xDC67,0xBBA7,0x81A5,0x9246,0xBBA8,0xD447,0xD447,0xDC87,0xAB07,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x8163,0xDC88,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC67,0xC3C7,0x6861,0x6000,0x6041,0xC408,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD467,0x7923,0x6000,0x6000,0xAAE6,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xDC87,0x9A65,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x8143,0xDC88,0xD447,0xDC67,0xB346,0x6000,0x6000,0x8A06,0xDC88,0xD467,0xD467,0xD467,0xD467,0xDC67,0x89C4,0xB326,0xDC67,0xDC67,0xB367,0x6881,0xD467,0xD446,0xDC87,0x8163,0x6000,0x9A45,0xDC87,0xD446,0xCC6B,0xC3E9,0xDC46,0xDCA8,0x7102,0xA2A6,0xDC87,0xD467,0xC40A,0xD468,0xD446,0xD469,0xA2C7,0xDC67,0xD447,0xD447,0xD446,0xD446,0xD446,0xD446,0xD488,0x70A1,0x6000,0x6000,0x6000,0x6000,0x6000,0x7943,0xD467,0xD447,0xDC67,0xBBA7,0x6000,0x6000,0x89A4,0xDCA8,0xD467,0xD467,0xD467,0xD467,0xDC68,0xC42B,0xD447,0xD447,0xD447,0xD446,0xD446,0xD446,0xD446,0xDC88,0x89A4,0x6000,0x9225,0xDC87,0xD446,0xD447,0x70C2,0xC3E8,0xDC67,0xDC67,0xAB27,0x6000,0x7922,0xDCA8,0xD446,0xD447,0xD447,0xD467,0xDC67,0xDC67,0xD447,0xDC67,0xCC28,0x70C2,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xB367,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC87,0x9225,0x6000,0x6000,0x9205,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC67,0xB367,0x6020,0x6000,0x70C2,0xD448,0xD446,0xD447,0xD447,0xD447,0xD447,0xD447,0xD466,0xCC28,0x70C2,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x89A4,0xDC67,0xD447,0xDC87,0xB347,0x6000,0x6000,0x9A45,0xDCA8,0xD446,0xD447,0xD447,0xD446,0xD468,0x9205,0xD448,0xD446,0xDC67,0x89E4,0x6861,0xD489,0xD446,0xDC67,0x9225,0x6000,0xAAE6,0xDC67,0xDC66,0xB389,0xAAE6,0xDC67,0xDC87,0x89A4,0xC3E8,0xDC66,0xC3E8,0x9AA7,0xDC67,0xDC46,0xC3E9,0xAB49,0xDC66,0xD447,0xD446,0xDC67,0xDC87,0xDC87,0xDC87,0xD48A,0x68A2,0x6000,0x6000,0x6000,0x6000,0x6000,0x9206,0xDC67,0xD447,0xDC67,0xBBA9,0x6000,0x6000,0x89C4,0xDC87,0xD446,0xD447,0xD447,0xD446,0xD468,0xC42C,0xD447,0xD447,0xD446,0xDC67,0xDC87,0xDC87,0xDC87,0xD488,0x7964,0x6000,0xC3E8,0xDC66,0xDC67,0xBB88,0x6000,0xBBC9,0xDC67,0xDC66,0xC3E9,0x6000,0x89A4,0xDC67,0xD447,0xD447,0xD446,0xD447,0xD447,0xD447,0xD447,0xD428,0x7922,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x7103,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC66,0xC3E7,0x6861,0x6000,0x6020,0xBBA8,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xD468,0x7943,0x6000,0x6000,0xA2A6,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC87,0xA2A6,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x89C4,0xDC67,0xD447,0xDC87,0xB348,0x6000,0x6000,0xAAE6,0xE4A7,0xDC67,0xD447,0xD447,0xD446,0xCC28,0xBBCA,0xD446,0xD446,0xD469,0x81A5,0x81A5,0xD489,0xD446,0xDC67,0xAB08,0x6020,0xC409,0xDC66,0xDC67,0x9A86,0xA264,0xDC87,0xD468,0xBBA9,0xD467,0xDC67,0xAAC5,0xAB28,0xDC67,0xDC67,0xB327,0xBBCA,0xDC66,0xD446,0xD468,0xB367,0xB347,0xB347,0xB347,0xA2A6,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x9246,0xDC67,0xD447,0xDC67,0xB389,0x6000,0x6000,0xAB07,0xE487,0xDC67,0xD446,0xD447,0xD446,0xCC27,0xC44C,0xD447,0xD446,0xD467,0xBBA8,0xB347,0xB347,0xB347,0xAAE6,0x6041,0x8164,0xD467,0xD446,0xDC88,0xA2C7,0x7924,0xBBA9,0xDC67,0xD446,0xCC49,0x6041,0xA2E7,0xDC67,0xD447,0xD446,0xDC87,0xD447,0xD447,0xD446,0xDC89,0x7943,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A45,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC88,0x89A4,0x6000,0x6000,0x70E2,0xD467,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC87,0xAAE7,0x6000,0x6000,0x6020,0xBBA7,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC67,0xC3E8,0x6861,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x8163,0xDC87,0xD447,0xDC87,0xB326,0x6000,0x6000,0x9246,0xAB08,0xA2C7,0xC3E8,0xDC46,0xD446,0xD469,0xD489,0xD446,0xD446,0xD447,0xD468,0xD468,0xD467,0xD446,0xDC67,0xB388,0x6861,0xD469,0xD446,0xDC87,0x8183,0xA265,0xDC87,0xD447,0xDC88,0xD446,0xD467,0x7943,0xBB86,0xDC67,0xDC87,0xAB27,0xC3E8,0xDC67,0xDC66,0xC3E9,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x89C5,0xD467,0xD447,0xDC67,0xBBA8,0x6000,0x6000,0x9267,0xAB08,0xA2E8,0xCC08,0xD446,0xD446,0xCC29,0xC3E9,0xDC67,0xD446,0xCC08,0x68A2,0x6000,0x6000,0x6000,0x6000,0x6000,0xAAE6,0xDC87,0xD446,0xD447,0xD468,0xD469,0xD468,0xD446,0xD446,0xD469,0x6861,0xBBA8,0xDC67,0xD446,0xD488,0x89C4,0xC3A7,0xDC67,0xD447,0xDC87,0x9205,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xC3E9,0xDC46,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC67,0xAAE6,0x6000,0x6000,0x6000,0x9AA7,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC67,0xC3E7,0x6881,0x6000,0x6000,0x7903,0xD489,0xD446,0xD447,0xD447,0xD447,0xD447,0xD446,0xDC67,0x89A4,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x7923,0xDCA8,0xD446,0xD446,0xCC28,0x70A2,0x6000,0x6000,0x6000,0x70E2,0xCC27,0xD446,0xD447,0xD4AB,0xD467,0xD446,0xD447,0xD446,0xD446,0xD446,0xD446,0xD447,0xDC67,0xBBA8,0x6881,0xD447,0xD446,0xDCA8,0x7922,0x9A86,0xDC87,0xD447,0xD446,0xDC66,0xC3C7,0x7924,0xCC07,0xDC66,0xD467,0xAB29,0xC3C6,0xD467,0xDC87,0xA2A5,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x70E2,0xD467,0xD446,0xD467,0xCC07,0x70C2,0x6000,0x6000,0x6000,0x7103,0xD447,0xD447,0xDC66,0xAB29,0xBB87,0xDC66,0xDC67,0xBB66,0x6000,0x6000,0x6000,0x6000,0x6000,0x6881,0xCC48,0xD446,0xD447,0xD446,0xD446,0xD446,0xD446,0xD447,0xD447,0xD447,0x6840,0xBB86,0xDC67,0xD446,0xCC49,0x6020,0x9A66,0xDC67,0xD447,0xDC67,0xBB87,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xD4A9,0xD446,0xD447,0xD447,0xD447,0xD447,0xDC67,0xC408,0x6881,0x6000,0x6000,0x6000,0xAB06,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD446,0xD468,0x8164,0x6000,0x6000,0x6000,0x8163,0xDC87,0xD446,0xD447,0xD447,0xD447,0xD446,0xDC67,0xA2A6,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x68A2,0xCC28,0xDC66,0xD447,0xDC67,0xB347,0x7923,0x6882,0x89E5,0xCC28,0xDC67,0xD446,0xD488,0xD4AA,0xD446,0xD447,0xD467,0xDC67,0xDC67,0xDC67,0xD467,0xD447,0xDC67,0xBB65,0x8184,0xD447,0xD446,0xDCA9,0x7923,0x9A66,0xDC88,0xD446,0xD447,0xDC87,0x9225,0x8164,0xDC88,0xD446,0xCC26,0xA309,0xD448,0xD446,0xDC67,0xBB87,0x9A66,0x9A65,0x9A65,0x9A65,0x89E5,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x6881,0xCC29,0xD446,0xD447,0xDC67,0xB346,0x7944,0x6881,0x89E5,0xC3E7,0xDC67,0xD446,0xD447,0x89E5,0xCC48,0xD446,0xDC67,0xC409,0x9A65,0x9A65,0x9A65,0x9A66,0x89E4,0x9A67,0xDC67,0xD447,0xD467,0xDC67,0xDC67,0xDC67,0xD467,0xD447,0xD447,0xD426,0x7903,0xC3A6,0xDC67,0xDC67,0xB347,0x6000,0x70C2,0xD468,0xD446,0xD446,0xD468,0x7923,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xD468,0xD446,0xD447,0xD447,0xD447,0xDC67,0xD448,0x7923,0x6000,0x6000,0x6000,0x6000,0xB326,0xDC67,0xD447,0xD447,0xD447,0xD446,0xDCA8,0x9A66,0x6000,0x6000,0x6000,0x6000,0x9226,0xDC67,0xD447,0xD447,0xD447,0xD446,0xDC87,0xB388,0x6041,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xAAE6,0xDC87,0xD447,0xD447,0xDC67,0xCC27,0xCC07,0xD467,0xDC67,0xD446,0xD467,0xC44A,0xD468,0xD446,0xDC67,0xBBA8,0x9A87,0x9A67,0x9A87,0xBBA7,0xDC67,0xDC67,0xBB65,0x9AC8,0xDC67,0xD446,0xD448,0x70E3,0x9226,0xDC67,0xD446,0xD447,0xD448,0x68A2,0x89A3,0xDC87,0xD446,0xCC07,0xA2E8,0xDC88,0xD446,0xD447,0xDC67,0xDCA8,0xDCA8,0xDCA8,0xE4C8,0xBB67,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xA2A6,0xDC87,0xD447,0xD447,0xDC67,0xD447,0xCC06,0xD467,0xDC67,0xD447,0xDC87,0xAB06,0x7902,0xDC87,0xD446,0xD447,0xD467,0xDCA8,0xDCA8,0xDCA8,0xE4A8,0xCC49,0xC3E9,0xDC67,0xD447,0xCC07,0x9AA7,0x9A87,0x9A67,0xAB28,0xDC87,0xD446,0xD426,0x9AC9,0xCC27,0xD446,0xDC87,0xA2A5,0x6000,0x6000,0xB347,0xDC67,0xD447,0xDC87,0xA2A6,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xDC88,0xD446,0xD447,0xD446,0xDC67,0xD448,0x7923,0x6000,0x6000,0x6000,0x6000,0x6000,0xB326,0xDC67,0xD447,0xD447,0xDC66,0xDC88,0x9A66,0x6000,0x6000,0x6000,0x6000,0x6000,0x9205,0xDC67,0xD447,0xD447,0xD446,0xDC87,0xBBA8,0x6861,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x70C2,0xCC28,0xDC67,0xD447,0xD447,0xD447,0xD467,0xD447,0xD446,0xDC87,0xBBA8,0xA2C7,0xDC67,0xD446,0xD467,0x8184,0x6000,0x6000,0x6000,0xA285,0xDC87,0xD446,0xCC07,0xC42B,0xD467,0xDC67,0xC3C7,0x6020,0x89C5,0xD467,0xD447,0xDC67,0xB347,0x6000,0xA2C7,0xDC67,0xD446,0xCC29,0xA2C6,0xDC67,0xD447,0xD447,0xD447,0xD446,0xD446,0xD446,0xDC87,0xA2A5,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6881,0xCBE7,0xDC67,0xD447,0xD447,0xD447,0xD467,0xD447,0xD446,0xDC67,0xCC28,0x70C2,0x9246,0xDC67,0xD447,0xD447,0xD447,0xD446,0xD446,0xD446,0xD446,0xD4AB,0xD468,0xD446,0xDC67,0xAB27,0x6000,0x6000,0x6000,0x7943,0xDCA9,0xD446,0xD447,0xCC6C,0xD468,0xD446,0xDC88,0x9A87,0x6000,0x6000,0x89E5,0xDC67,0xD447,0xDC67,0xC407,0x6041,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xC429,0xDC66,0xDC46,0xDC87,0xC3C8,0x7903,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xA286,0xE4A7,0xD446,0xDC87,0xCC28,0x9205,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x7902,0xDC88,0xDC46,0xDC67,0xDC68,0xAAE7,0x6041,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x7923,0xCC28,0xDC87,0xD446,0xD446,0xD446,0xD446,0xDC87,0xBBA8,0x7903,0xCC07,0xDC67,0xE487,0xCC08,0x6020,0x6000,0x6000,0x6000,0xA2C6,0xE4A7,0xDC66,0xDC87,0xDCA9,0xDC66,0xE487,0xBB86,0x6000,0x7923,0xD467,0xDC66,0xDCA8,0x8184,0x6000,0xC409,0xE486,0xE486,0xBBA9,0xBBA9,0xE486,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC66,0xE4A8,0x9AA7,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x7903,0xCC08,0xDC87,0xD446,0xD446,0xD446,0xD446,0xDC87,0xC3E8,0x70E2,0x6000,0xB368,0xE487,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC87,0xDC67,0xDC66,0xDCA8,0x7943,0x6000,0x6000,0x6000,0x8164,0xDCA9,0xDC66,0xDC67,0xDC88,0xDC67,0xDC66,0xDC67,0x89C5,0x6000,0x6000,0x6841,0xCC28,0xDC66,0xDC66,0xE4A8,0x9205,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x70E2,0xC3E9,0xC409,0x9225,0x6041,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6041,0xAB07,0xCC6A,0xA2C6,0x70E3,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9205,0xCC6A,0xB368,0x8184,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x70A2,0xA2A6,0xCC6A,0xD488,0xD488,0xCC29,0x9225,0x6041,0x7924,0xAB27,0xAAE7,0xAB07,0x89C5,0x6000,0x6000,0x6000,0x6000,0x8184,0xAB27,0xAAE7,0xAAE7,0xAB07,0xAAE7,0xAB27,0x9225,0x6000,0x6861,0xA2C6,0xAB07,0x9A86,0x6041,0x6000,0xA2C7,0xAB07,0xAB07,0x89E5,0x9AA7,0xAB07,0xAAE7,0xAAE7,0xAAE7,0xAAE7,0xAAE7,0xAAE7,0xAB07,0x7923,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x68A2,0xA2A6,0xCC4A,0xD488,0xD488,0xCC49,0x9245,0x6861,0x6000,0x6000,0x9A66,0xAB27,0xAB07,0xAB07,0xAB07,0xAB07,0xAB07,0xAB07,0xAB07,0xAB07,0xAAE7,0xAB07,0xA2C7,0x6041,0x6000,0x6000,0x6000,0x68A2,0xAAE7,0xAB07,0xAAE7,0xAB07,0xAAE7,0xAB07,0xA2E7,0x6861,0x6000,0x6000,0x6000,0x89C5,0xB327,0xAAE7,0xB327,0x9226,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
+    0x40, 0x01, 0x20, 0x00, 0xad, 0x00, 0x00, 0x60, 0x20, 0x60, 0x40, 0x60, 0x41, 0x60, 0x40, 0x68,
+    0x41, 0x68, 0x61, 0x68, 0x81, 0x68, 0x82, 0x68, 0xa2, 0x68, 0xa1, 0x70, 0xa2, 0x70, 0xc1, 0x70,
+    0xc2, 0x70, 0xe2, 0x70, 0xe3, 0x70, 0x02, 0x71, 0x03, 0x71, 0x02, 0x79, 0x03, 0x79, 0x22, 0x79,
+    0x23, 0x79, 0x24, 0x79, 0x43, 0x79, 0x44, 0x79, 0x64, 0x79, 0x43, 0x81, 0x63, 0x81, 0x64, 0x81,
+    0x83, 0x81, 0x84, 0x81, 0xa4, 0x81, 0xa5, 0x81, 0xa3, 0x89, 0xa4, 0x89, 0xc4, 0x89, 0xc5, 0x89,
+    0xe4, 0x89, 0xe5, 0x89, 0x06, 0x8a, 0x04, 0x92, 0x05, 0x92, 0x06, 0x92, 0x25, 0x92, 0x26, 0x92,
+    0x45, 0x92, 0x46, 0x92, 0x67, 0x92, 0x24, 0x9a, 0x45, 0x9a, 0x65, 0x9a, 0x66, 0x9a, 0x67, 0x9a,
+    0x85, 0x9a, 0x86, 0x9a, 0x87, 0x9a, 0xa7, 0x9a, 0xc8, 0x9a, 0xc9, 0x9a, 0x64, 0xa2, 0x65, 0xa2,
+    0x85, 0xa2, 0x86, 0xa2, 0xa5, 0xa2, 0xa6, 0xa2, 0xc6, 0xa2, 0xc7, 0xa2, 0xe6, 0xa2, 0xe7, 0xa2,
+    0xe8, 0xa2, 0x08, 0xa3, 0x09, 0xa3, 0xc5, 0xaa, 0xe6, 0xaa, 0xe7, 0xaa, 0x06, 0xab, 0x07, 0xab,
+    0x08, 0xab, 0x27, 0xab, 0x28, 0xab, 0x29, 0xab, 0x49, 0xab, 0x26, 0xb3, 0x27, 0xb3, 0x46, 0xb3,
+    0x47, 0xb3, 0x48, 0xb3, 0x66, 0xb3, 0x67, 0xb3, 0x68, 0xb3, 0x88, 0xb3, 0x89, 0xb3, 0x8a, 0xb3,
+    0xa9, 0xb3, 0xaa, 0xb3, 0x46, 0xbb, 0x65, 0xbb, 0x66, 0xbb, 0x67, 0xbb, 0x86, 0xbb, 0x87, 0xbb,
+    0x88, 0xbb, 0xa6, 0xbb, 0xa7, 0xbb, 0xa8, 0xbb, 0xa9, 0xbb, 0xc8, 0xbb, 0xc9, 0xbb, 0xca, 0xbb,
+    0xa6, 0xc3, 0xa7, 0xc3, 0xc6, 0xc3, 0xc7, 0xc3, 0xc8, 0xc3, 0xe7, 0xc3, 0xe8, 0xc3, 0xe9, 0xc3,
+    0x07, 0xc4, 0x08, 0xc4, 0x09, 0xc4, 0x0a, 0xc4, 0x29, 0xc4, 0x2b, 0xc4, 0x2c, 0xc4, 0x4a, 0xc4,
+    0x4c, 0xc4, 0xe7, 0xcb, 0x06, 0xcc, 0x07, 0xcc, 0x08, 0xcc, 0x26, 0xcc, 0x27, 0xcc, 0x28, 0xcc,
+    0x29, 0xcc, 0x48, 0xcc, 0x49, 0xcc, 0x4a, 0xcc, 0x69, 0xcc, 0x6a, 0xcc, 0x6b, 0xcc, 0x6c, 0xcc,
+    0x26, 0xd4, 0x27, 0xd4, 0x28, 0xd4, 0x46, 0xd4, 0x47, 0xd4, 0x48, 0xd4, 0x66, 0xd4, 0x67, 0xd4,
+    0x68, 0xd4, 0x69, 0xd4, 0x88, 0xd4, 0x89, 0xd4, 0x8a, 0xd4, 0xa9, 0xd4, 0xaa, 0xd4, 0xab, 0xd4,
+    0x46, 0xdc, 0x66, 0xdc, 0x67, 0xdc, 0x68, 0xdc, 0x87, 0xdc, 0x88, 0xdc, 0x89, 0xdc, 0xa8, 0xdc,
+    0xa9, 0xdc, 0x86, 0xe4, 0x87, 0xe4, 0xa7, 0xe4, 0xa8, 0xe4, 0xc8, 0xe4, 0xc9, 0xe4, 0xc8, 0xec,
+    0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
+    0xd3, 0x00, 0x00, 0x22, 0x00, 0x59, 0x00, 0x6b, 0x00, 0x17, 0x07, 0x00, 0x00, 0x15, 0x00, 0x4a,
+    0x00, 0x77, 0x00, 0x29, 0x07, 0x00, 0x00, 0x08, 0x00, 0x31, 0x00, 0x74, 0x00, 0x4a, 0x00, 0x06,
+    0x08, 0x00, 0x00, 0x01, 0x00, 0x26, 0x00, 0x6b, 0x00, 0x98, 0x00, 0x97, 0x00, 0xa5, 0x00, 0x74,
+    0x00, 0x29, 0x00, 0x03, 0x04, 0x00, 0x00, 0x26, 0x00, 0x4e, 0x00, 0x4a, 0x00, 0x4e, 0x00, 0x20,
+    0x02, 0x00, 0x00, 0x0e, 0x00, 0x42, 0x01, 0x40, 0x00, 0x41, 0x00, 0x24, 0x03, 0x00, 0x00, 0x1c,
+    0x00, 0x4c, 0x02, 0x41, 0x00, 0x24, 0x01, 0x44, 0x04, 0x43, 0x00, 0x4a, 0x00, 0x33, 0x08, 0x00,
+    0x00, 0x25, 0x00, 0x6b, 0x00, 0x9a, 0x00, 0x97, 0x00, 0x98, 0x00, 0x77, 0x00, 0x2b, 0x00, 0x03,
+    0x01, 0x00, 0x00, 0x01, 0x00, 0x40, 0x00, 0x4a, 0x04, 0x43, 0x00, 0x4a, 0x00, 0x44, 0x00, 0x05,
+    0x01, 0x00, 0x00, 0x13, 0x01, 0x4a, 0x00, 0x4c, 0x00, 0x37, 0x02, 0x00, 0x00, 0x02, 0x00, 0x33,
+    0x00, 0x4a, 0x01, 0x43, 0x01, 0x41, 0x00, 0x40, 0x00, 0x26, 0x00, 0x03, 0xb6, 0x00, 0x00, 0x07,
+    0x00, 0x55, 0x00, 0xa2, 0x00, 0x9f, 0x00, 0x9e, 0x00, 0x70, 0x00, 0x06, 0x05, 0x00, 0x00, 0x31,
+    0x00, 0x95, 0x00, 0xa1, 0x00, 0x9d, 0x00, 0x9f, 0x00, 0x17, 0x05, 0x00, 0x00, 0x1c, 0x00, 0x81,
+    0x00, 0xa1, 0x00, 0x9d, 0x00, 0xa8, 0x00, 0x3d, 0x07, 0x00, 0x00, 0x07, 0x00, 0x65, 0x00, 0xa2,
+    0x00, 0x9e, 0x02, 0x90, 0x00, 0x9d, 0x00, 0xa1, 0x00, 0x64, 0x00, 0x0d, 0x02, 0x00, 0x00, 0x09,
+    0x00, 0x86, 0x00, 0x9e, 0x00, 0x9f, 0x00, 0xa8, 0x00, 0x56, 0x02, 0x00, 0x00, 0x23, 0x00, 0xaa,
+    0x01, 0x9f, 0x00, 0xa8, 0x00, 0x58, 0x03, 0x00, 0x00, 0x67, 0x00, 0xa7, 0x00, 0x9f, 0x00, 0x9e,
+    0x00, 0xa2, 0x00, 0x4d, 0x06, 0x9f, 0x00, 0xa7, 0x00, 0x71, 0x06, 0x00, 0x00, 0x06, 0x00, 0x58,
+    0x00, 0xa2, 0x00, 0x9e, 0x02, 0x90, 0x00, 0x9d, 0x00, 0xa1, 0x00, 0x67, 0x00, 0x07, 0x00, 0x00,
+    0x00, 0x16, 0x00, 0x91, 0x05, 0x9f, 0x00, 0x9e, 0x00, 0x98, 0x00, 0x07, 0x01, 0x00, 0x00, 0x4b,
+    0x00, 0xa7, 0x00, 0x9f, 0x00, 0xa1, 0x00, 0x86, 0x00, 0x01, 0x01, 0x00, 0x00, 0x0a, 0x00, 0xa5,
+    0x00, 0x9e, 0x03, 0x9f, 0x00, 0xa1, 0x00, 0xa4, 0x00, 0x6a, 0x00, 0x07, 0xb4, 0x00, 0x00, 0x09,
+    0x00, 0x67, 0x00, 0xa1, 0x00, 0x90, 0x00, 0x91, 0x00, 0x90, 0x00, 0x97, 0x00, 0x20, 0x03, 0x00,
+    0x00, 0x01, 0x00, 0x41, 0x00, 0xa1, 0x00, 0x90, 0x01, 0x91, 0x00, 0x9f, 0x00, 0x46, 0x04, 0x00,
+    0x00, 0x26, 0x00, 0x91, 0x00, 0x9f, 0x00, 0x90, 0x00, 0x91, 0x00, 0x9e, 0x00, 0x71, 0x00, 0x03,
+    0x05, 0x00, 0x00, 0x07, 0x00, 0x71, 0x00, 0xa1, 0x00, 0x90, 0x01, 0x91, 0x00, 0x94, 0x01, 0x91,
+    0x00, 0x90, 0x00, 0xa1, 0x00, 0x58, 0x00, 0x01, 0x01, 0x00, 0x00, 0x29, 0x00, 0xa1, 0x01, 0x91,
+    0x00, 0xa1, 0x00, 0x55, 0x02, 0x00, 0x00, 0x31, 0x00, 0xa1, 0x01, 0x91, 0x00, 0x9f, 0x00, 0x54,
+    0x02, 0x00, 0x00, 0x15, 0x00, 0x95, 0x01, 0x91, 0x00, 0x90, 0x00, 0x84, 0x00, 0x50, 0x00, 0x90,
+    0x01, 0x91, 0x03, 0x90, 0x00, 0x9f, 0x00, 0x59, 0x05, 0x00, 0x00, 0x03, 0x00, 0x64, 0x00, 0xa7,
+    0x00, 0x90, 0x01, 0x91, 0x00, 0x94, 0x01, 0x91, 0x00, 0x90, 0x00, 0xa1, 0x00, 0x62, 0x00, 0x01,
+    0x00, 0x2c, 0x00, 0xa2, 0x00, 0x90, 0x01, 0x91, 0x02, 0x90, 0x00, 0x9e, 0x00, 0x6a, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x0b, 0x00, 0x95, 0x00, 0x90, 0x00, 0x91, 0x00, 0x94, 0x00, 0x80, 0x00, 0x06,
+    0x01, 0x00, 0x00, 0x15, 0x00, 0x94, 0x01, 0x91, 0x02, 0x90, 0x00, 0x91, 0x00, 0x90, 0x00, 0xa7,
+    0x00, 0x4c, 0xb3, 0x00, 0x00, 0x06, 0x00, 0x64, 0x00, 0xa1, 0x02, 0x91, 0x00, 0x90, 0x00, 0x97,
+    0x00, 0x20, 0x03, 0x00, 0x00, 0x40, 0x00, 0xa1, 0x03, 0x91, 0x00, 0x9f, 0x00, 0x4f, 0x03, 0x00,
+    0x00, 0x1f, 0x00, 0x92, 0x00, 0x9e, 0x02, 0x91, 0x00, 0x9e, 0x00, 0x77, 0x00, 0x08, 0x05, 0x00,
+    0x00, 0x40, 0x00, 0xa1, 0x01, 0x91, 0x00, 0x9f, 0x00, 0x94, 0x00, 0x7f, 0x00, 0x91, 0x00, 0x9f,
+    0x00, 0x91, 0x00, 0x90, 0x00, 0xa2, 0x00, 0x1b, 0x01, 0x00, 0x00, 0x73, 0x00, 0x9f, 0x01, 0x91,
+    0x00, 0x9f, 0x00, 0x54, 0x02, 0x00, 0x00, 0x5a, 0x00, 0x9f, 0x01, 0x91, 0x00, 0x9f, 0x00, 0x61,
+    0x02, 0x00, 0x00, 0x41, 0x00, 0xa1, 0x01, 0x91, 0x00, 0x9f, 0x00, 0x64, 0x00, 0x5e, 0x00, 0x9f,
+    0x01, 0x91, 0x00, 0xa1, 0x02, 0xa4, 0x00, 0xaa, 0x00, 0x33, 0x05, 0x00, 0x00, 0x36, 0x00, 0xa1,
+    0x00, 0x90, 0x00, 0x91, 0x00, 0x9f, 0x00, 0x94, 0x00, 0x7f, 0x00, 0x91, 0x00, 0x9f, 0x00, 0x91,
+    0x00, 0x90, 0x00, 0xa2, 0x00, 0x1a, 0x00, 0x2b, 0x00, 0xa2, 0x01, 0x91, 0x00, 0xa1, 0x02, 0xa4,
+    0x00, 0xac, 0x00, 0x49, 0x01, 0x00, 0x00, 0x33, 0x00, 0x9f, 0x02, 0x91, 0x00, 0x8e, 0x00, 0x15,
+    0x01, 0x00, 0x00, 0x34, 0x00, 0x9f, 0x01, 0x91, 0x00, 0x94, 0x00, 0x95, 0x00, 0xa2, 0x01, 0x91,
+    0x00, 0x90, 0x00, 0x98, 0xb2, 0x00, 0x00, 0x02, 0x00, 0x55, 0x00, 0xa1, 0x03, 0x91, 0x00, 0x90,
+    0x00, 0x92, 0x00, 0x18, 0x02, 0x00, 0x00, 0x28, 0x00, 0xa1, 0x04, 0x91, 0x00, 0x9f, 0x00, 0x33,
+    0x02, 0x00, 0x00, 0x0c, 0x00, 0x80, 0x00, 0x9f, 0x03, 0x91, 0x00, 0x9f, 0x00, 0x55, 0x00, 0x01,
+    0x04, 0x00, 0x00, 0x0e, 0x00, 0x95, 0x00, 0x90, 0x00, 0x91, 0x00, 0x9f, 0x00, 0x64, 0x00, 0x20,
+    0x00, 0x06, 0x00, 0x1e, 0x00, 0x73, 0x00, 0x9f, 0x00, 0x91, 0x00, 0x9f, 0x00, 0x4f, 0x00, 0x00,
+    0x00, 0x1c, 0x00, 0x94, 0x02, 0x91, 0x00, 0x9e, 0x00, 0x6e, 0x00, 0x03, 0x01, 0x00, 0x00, 0x79,
+    0x00, 0x94, 0x01, 0x91, 0x00, 0x9f, 0x00, 0x70, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x84,
+    0x00, 0x94, 0x01, 0x91, 0x00, 0x9f, 0x00, 0x62, 0x00, 0x68, 0x00, 0x9f, 0x00, 0x90, 0x00, 0x92,
+    0x00, 0x41, 0x02, 0x32, 0x00, 0x35, 0x00, 0x0d, 0x04, 0x00, 0x00, 0x0f, 0x00, 0x92, 0x00, 0x90,
+    0x00, 0x91, 0x00, 0x9f, 0x00, 0x64, 0x00, 0x20, 0x00, 0x06, 0x00, 0x1c, 0x00, 0x67, 0x00, 0x9f,
+    0x00, 0x91, 0x00, 0x9f, 0x00, 0x2d, 0x00, 0x30, 0x00, 0xa1, 0x01, 0x91, 0x00, 0x4c, 0x02, 0x32,
+    0x00, 0x35, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x6e, 0x00, 0x9f, 0x02, 0x91, 0x00, 0x95,
+    0x00, 0x24, 0x01, 0x00, 0x00, 0x4f, 0x00, 0xa1, 0x00, 0x90, 0x00, 0xa2, 0x00, 0x37, 0x00, 0x24,
+    0x00, 0x2e, 0x00, 0x86, 0x00, 0x91, 0x00, 0x90, 0x00, 0x95, 0xb2, 0x00, 0x00, 0x31, 0x00, 0xa1,
+    0x00, 0x90, 0x03, 0x91, 0x00, 0x9f, 0x00, 0x70, 0x00, 0x01, 0x01, 0x00, 0x00, 0x15, 0x00, 0x95,
+    0x00, 0x90, 0x03, 0x91, 0x00, 0x90, 0x00, 0xa2, 0x00, 0x14, 0x01, 0x00, 0x00, 0x01, 0x00, 0x6a,
+    0x00, 0x9f, 0x04, 0x91, 0x00, 0xa1, 0x00, 0x40, 0x05, 0x00, 0x00, 0x49, 0x00, 0xa1, 0x00, 0x91,
+    0x00, 0x9f, 0x00, 0x76, 0x00, 0x08, 0x02, 0x00, 0x00, 0x24, 0x00, 0xa1, 0x00, 0x9f, 0x00, 0xa7,
+    0x00, 0x71, 0x00, 0x00, 0x00, 0x49, 0x00, 0xa1, 0x00, 0x90, 0x00, 0x94, 0x00, 0x91, 0x00, 0x90,
+    0x00, 0x86, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x06, 0x00, 0x80, 0x00, 0x94, 0x01, 0x91, 0x00, 0x9d,
+    0x00, 0x84, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x29, 0x00, 0xa1, 0x00, 0x90, 0x01, 0x91, 0x00, 0x9f,
+    0x00, 0x5c, 0x00, 0x66, 0x01, 0x9f, 0x00, 0x57, 0x0a, 0x00, 0x00, 0x40, 0x00, 0xa1, 0x00, 0x91,
+    0x00, 0x9f, 0x00, 0x81, 0x00, 0x07, 0x02, 0x00, 0x00, 0x27, 0x00, 0xa2, 0x00, 0x9f, 0x00, 0xa1,
+    0x00, 0x69, 0x00, 0x4e, 0x00, 0x9e, 0x00, 0x9f, 0x00, 0x72, 0x06, 0x00, 0x00, 0x1b, 0x00, 0xa2,
+    0x00, 0x90, 0x01, 0x94, 0x00, 0x90, 0x00, 0xa2, 0x00, 0x2e, 0x01, 0x00, 0x00, 0x52, 0x00, 0x9f,
+    0x00, 0x90, 0x00, 0x98, 0x00, 0x0f, 0x01, 0x00, 0x00, 0x5d, 0x00, 0x9f, 0x00, 0x90, 0x00, 0x94,
+    0xb1, 0x00, 0x00, 0x13, 0x00, 0x92, 0x00, 0x90, 0x04, 0x91, 0x00, 0x9f, 0x00, 0x56, 0x01, 0x00,
+    0x00, 0x03, 0x00, 0x64, 0x00, 0x9f, 0x04, 0x91, 0x00, 0x90, 0x00, 0x81, 0x00, 0x08, 0x01, 0x00,
+    0x00, 0x31, 0x00, 0xa1, 0x05, 0x91, 0x00, 0x94, 0x00, 0x24, 0x04, 0x00, 0x00, 0x06, 0x00, 0x70,
+    0x00, 0x9f, 0x00, 0x90, 0x00, 0xa1, 0x00, 0x23, 0x03, 0x00, 0x00, 0x0b, 0x00, 0x57, 0x00, 0x54,
+    0x00, 0x61, 0x00, 0x41, 0x00, 0x06, 0x00, 0x86, 0x00, 0x90, 0x00, 0x94, 0x00, 0x77, 0x00, 0x91,
+    0x00, 0x90, 0x00, 0x98, 0x00, 0x15, 0x00, 0x00, 0x00, 0x19, 0x03, 0x91, 0x00, 0x90, 0x00, 0x96,
+    0x00, 0x11, 0x00, 0x00, 0x00, 0x64, 0x00, 0x9f, 0x00, 0x90, 0x02, 0x91, 0x00, 0x50, 0x00, 0x84,
+    0x00, 0x90, 0x00, 0x9f, 0x00, 0x58, 0x03, 0x15, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, 0x00, 0x73,
+    0x00, 0x9e, 0x00, 0x91, 0x00, 0xa1, 0x00, 0x29, 0x03, 0x00, 0x00, 0x0f, 0x01, 0x54, 0x00, 0x5f,
+    0x00, 0x4f, 0x00, 0x87, 0x00, 0x90, 0x00, 0x9f, 0x00, 0x84, 0x02, 0x15, 0x00, 0x17, 0x00, 0x07,
+    0x01, 0x00, 0x00, 0x55, 0x00, 0x9f, 0x00, 0x90, 0x00, 0x76, 0x00, 0x89, 0x00, 0x90, 0x00, 0xa4,
+    0x00, 0x32, 0x00, 0x00, 0x00, 0x06, 0x00, 0x70, 0x01, 0x9f, 0x00, 0x67, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x03, 0x00, 0x77, 0x00, 0x93, 0x00, 0x90, 0x00, 0x98, 0xb0, 0x00, 0x00, 0x01, 0x00, 0x55,
+    0x00, 0x9f, 0x04, 0x91, 0x00, 0x90, 0x00, 0xa2, 0x00, 0x1b, 0x01, 0x00, 0x00, 0x29, 0x00, 0xa1,
+    0x05, 0x91, 0x00, 0xa1, 0x00, 0x49, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x92, 0x00, 0x90, 0x04, 0x91,
+    0x00, 0x9d, 0x00, 0x81, 0x00, 0x02, 0x04, 0x00, 0x00, 0x15, 0x00, 0xa3, 0x01, 0x90, 0x00, 0x84,
+    0x00, 0x09, 0x00, 0x00, 0x00, 0x03, 0x00, 0x13, 0x00, 0x12, 0x00, 0x0e, 0x01, 0x07, 0x00, 0x0a,
+    0x00, 0x02, 0x00, 0x2d, 0x00, 0x9f, 0x00, 0x90, 0x00, 0x84, 0x00, 0x22, 0x00, 0x8d, 0x00, 0x90,
+    0x00, 0xa4, 0x00, 0x15, 0x00, 0x00, 0x00, 0x2e, 0x00, 0xa2, 0x00, 0x90, 0x01, 0x98, 0x00, 0x90,
+    0x00, 0x98, 0x00, 0x13, 0x00, 0x0f, 0x00, 0x94, 0x00, 0x90, 0x00, 0x9b, 0x00, 0x95, 0x00, 0x90,
+    0x00, 0x91, 0x00, 0x45, 0x00, 0x97, 0x00, 0x90, 0x00, 0x91, 0x00, 0x95, 0x03, 0xa5, 0x00, 0x1c,
+    0x04, 0x00, 0x00, 0x0c, 0x00, 0x97, 0x00, 0x90, 0x00, 0x94, 0x00, 0x80, 0x00, 0x09, 0x00, 0x00,
+    0x00, 0x03, 0x00, 0x15, 0x00, 0x12, 0x00, 0x0e, 0x02, 0x07, 0x00, 0x13, 0x00, 0x95, 0x00, 0x91,
+    0x00, 0x90, 0x00, 0x94, 0x02, 0xa5, 0x00, 0xab, 0x00, 0x28, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x83,
+    0x00, 0x9f, 0x00, 0xa1, 0x00, 0x36, 0x00, 0x70, 0x00, 0x9f, 0x00, 0xa1, 0x00, 0x3c, 0x00, 0x00,
+    0x00, 0x11, 0x00, 0x96, 0x00, 0x90, 0x00, 0x9f, 0x00, 0x67, 0x00, 0x20, 0x00, 0x2e, 0x00, 0x68,
+    0x01, 0x91, 0x00, 0xa1, 0x00, 0x4c, 0xb0, 0x00, 0x00, 0x1b, 0x00, 0xa2, 0x05, 0x91, 0x00, 0x9f,
+    0x00, 0x70, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x76, 0x00, 0x9f, 0x05, 0x91, 0x00, 0x94,
+    0x00, 0x15, 0x01, 0x00, 0x00, 0x49, 0x00, 0xa1, 0x04, 0x91, 0x00, 0x90, 0x00, 0xa1, 0x00, 0x32,
+    0x05, 0x00, 0x00, 0x1a, 0x00, 0xa2, 0x00, 0x91, 0x00, 0x9f, 0x00, 0x54, 0x01, 0x00, 0x00, 0x27,
+    0x00, 0xa2, 0x03, 0x94, 0x00, 0x9f, 0x00, 0x23, 0x00, 0x52, 0x01, 0x9f, 0x00, 0x58, 0x00, 0x07,
+    0x00, 0x94, 0x00, 0x90, 0x00, 0xa1, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x31, 0x00, 0xa1, 0x00, 0x90,
+    0x00, 0x8b, 0x00, 0x74, 0x00, 0x9d, 0x00, 0xa4, 0x00, 0x10, 0x00, 0x40, 0x00, 0xa1, 0x00, 0x94,
+    0x00, 0x78, 0x00, 0x95, 0x00, 0x90, 0x00, 0x96, 0x00, 0x42, 0x00, 0x9f, 0x01, 0x91, 0x03, 0x90,
+    0x00, 0x97, 0x00, 0x0a, 0x04, 0x00, 0x00, 0x17, 0x00, 0x94, 0x00, 0x91, 0x00, 0x9f, 0x00, 0x67,
+    0x01, 0x00, 0x00, 0x22, 0x00, 0xa4, 0x03, 0x94, 0x00, 0xa0, 0x00, 0x7a, 0x02, 0x91, 0x03, 0x90,
+    0x00, 0xa2, 0x00, 0x22, 0x00, 0x00, 0x00, 0x2b, 0x00, 0xa1, 0x00, 0x90, 0x00, 0x91, 0x00, 0x0d,
+    0x00, 0x73, 0x01, 0x9f, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x14, 0x00, 0xa4, 0x00, 0x90, 0x01, 0x91,
+    0x00, 0x94, 0x01, 0x9f, 0x00, 0x91, 0x00, 0x9f, 0x00, 0x84, 0x00, 0x0d, 0xb0, 0x00, 0x00, 0x58,
+    0x00, 0x9f, 0x05, 0x91, 0x00, 0xa1, 0x00, 0x2b, 0x01, 0x00, 0x00, 0x29, 0x00, 0xa1, 0x05, 0x91,
+    0x00, 0x9f, 0x00, 0x58, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x92, 0x00, 0x90, 0x04, 0x91,
+    0x00, 0x93, 0x00, 0x84, 0x00, 0x0d, 0x05, 0x00, 0x00, 0x22, 0x00, 0x9f, 0x00, 0x91, 0x00, 0xa1,
+    0x00, 0x55, 0x01, 0x00, 0x00, 0x31, 0x00, 0xa4, 0x00, 0x90, 0x01, 0x91, 0x00, 0x90, 0x00, 0x95,
+    0x00, 0x29, 0x00, 0x92, 0x00, 0x90, 0x00, 0x9f, 0x00, 0x25, 0x00, 0x06, 0x00, 0x98, 0x00, 0x90,
+    0x00, 0x9f, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x49, 0x00, 0x9f, 0x00, 0x9e, 0x00, 0x5b, 0x00, 0x49,
+    0x00, 0x9f, 0x00, 0xa1, 0x00, 0x22, 0x00, 0x73, 0x00, 0x9e, 0x00, 0x73, 0x00, 0x38, 0x00, 0x9f,
+    0x00, 0x9d, 0x00, 0x74, 0x00, 0x51, 0x00, 0x9e, 0x00, 0x91, 0x00, 0x90, 0x00, 0x9f, 0x02, 0xa1,
+    0x00, 0x99, 0x00, 0x09, 0x04, 0x00, 0x00, 0x2a, 0x00, 0x9f, 0x00, 0x91, 0x00, 0x9f, 0x00, 0x69,
+    0x01, 0x00, 0x00, 0x23, 0x00, 0xa1, 0x00, 0x90, 0x01, 0x91, 0x00, 0x90, 0x00, 0x95, 0x00, 0x7b,
+    0x01, 0x91, 0x00, 0x90, 0x00, 0x9f, 0x02, 0xa1, 0x00, 0x97, 0x00, 0x19, 0x00, 0x00, 0x00, 0x73,
+    0x00, 0x9e, 0x00, 0x9f, 0x00, 0x65, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x9f, 0x00, 0x9e, 0x00, 0x74,
+    0x00, 0x00, 0x00, 0x22, 0x00, 0x9f, 0x01, 0x91, 0x00, 0x90, 0x03, 0x91, 0x00, 0x8f, 0x00, 0x14,
+    0xb0, 0x00, 0x00, 0x11, 0x06, 0x91, 0x00, 0x9e, 0x00, 0x72, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x68, 0x00, 0x9f, 0x04, 0x91, 0x00, 0x90, 0x00, 0x95, 0x00, 0x17, 0x01, 0x00, 0x00, 0x40,
+    0x00, 0x9f, 0x05, 0x91, 0x00, 0xa1, 0x00, 0x40, 0x06, 0x00, 0x00, 0x23, 0x00, 0x9f, 0x00, 0x91,
+    0x00, 0xa1, 0x00, 0x56, 0x01, 0x00, 0x00, 0x49, 0x00, 0xa8, 0x00, 0x9f, 0x01, 0x91, 0x00, 0x90,
+    0x00, 0x84, 0x00, 0x6c, 0x01, 0x90, 0x00, 0x96, 0x01, 0x20, 0x00, 0x98, 0x00, 0x90, 0x00, 0x9f,
+    0x00, 0x4d, 0x00, 0x01, 0x00, 0x77, 0x00, 0x9e, 0x00, 0x9f, 0x00, 0x36, 0x00, 0x3b, 0x00, 0xa1,
+    0x00, 0x95, 0x00, 0x69, 0x00, 0x94, 0x00, 0x9f, 0x00, 0x48, 0x00, 0x4f, 0x01, 0x9f, 0x00, 0x53,
+    0x00, 0x6c, 0x00, 0x9e, 0x00, 0x90, 0x00, 0x95, 0x00, 0x58, 0x02, 0x55, 0x00, 0x40, 0x00, 0x01,
+    0x04, 0x00, 0x00, 0x2e, 0x00, 0x9f, 0x00, 0x91, 0x00, 0x9f, 0x00, 0x5b, 0x01, 0x00, 0x00, 0x4c,
+    0x00, 0xa7, 0x00, 0x9f, 0x00, 0x90, 0x00, 0x91, 0x00, 0x90, 0x00, 0x83, 0x00, 0x7d, 0x00, 0x91,
+    0x00, 0x90, 0x00, 0x94, 0x00, 0x68, 0x02, 0x55, 0x00, 0x49, 0x00, 0x03, 0x00, 0x1c, 0x00, 0x94,
+    0x00, 0x90, 0x00, 0xa2, 0x00, 0x42, 0x00, 0x16, 0x00, 0x69, 0x00, 0x9f, 0x00, 0x90, 0x00, 0x87,
+    0x00, 0x03, 0x00, 0x44, 0x00, 0x9f, 0x00, 0x91, 0x00, 0x90, 0x00, 0xa1, 0x01, 0x91, 0x00, 0x90,
+    0x00, 0xa3, 0x00, 0x17, 0xb1, 0x00, 0x00, 0x31, 0x00, 0xa1, 0x05, 0x91, 0x00, 0xa2, 0x00, 0x22,
+    0x01, 0x00, 0x00, 0x0e, 0x00, 0x94, 0x05, 0x91, 0x00, 0xa1, 0x00, 0x4a, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x67, 0x00, 0x9f, 0x04, 0x91, 0x00, 0x9f, 0x00, 0x73, 0x00, 0x06, 0x06, 0x00, 0x00, 0x1b,
+    0x00, 0xa1, 0x00, 0x91, 0x00, 0xa1, 0x00, 0x52, 0x01, 0x00, 0x00, 0x2e, 0x00, 0x4d, 0x00, 0x42,
+    0x00, 0x73, 0x00, 0x9d, 0x00, 0x90, 0x00, 0x96, 0x00, 0x98, 0x01, 0x90, 0x00, 0x91, 0x01, 0x95,
+    0x00, 0x94, 0x00, 0x90, 0x00, 0x9f, 0x00, 0x5a, 0x00, 0x06, 0x00, 0x96, 0x00, 0x90, 0x00, 0xa1,
+    0x00, 0x1d, 0x00, 0x3c, 0x00, 0xa1, 0x00, 0x91, 0x00, 0xa2, 0x00, 0x90, 0x00, 0x94, 0x00, 0x17,
+    0x00, 0x63, 0x00, 0x9f, 0x00, 0xa1, 0x00, 0x4e, 0x00, 0x73, 0x00, 0x9f, 0x00, 0x9e, 0x00, 0x74,
+    0x0a, 0x00, 0x00, 0x24, 0x00, 0x94, 0x00, 0x91, 0x00, 0x9f, 0x00, 0x68, 0x01, 0x00, 0x00, 0x2f,
+    0x00, 0x4d, 0x00, 0x45, 0x00, 0x81, 0x01, 0x90, 0x00, 0x85, 0x00, 0x74, 0x00, 0x9f, 0x00, 0x90,
+    0x00, 0x81, 0x00, 0x09, 0x04, 0x00, 0x00, 0x49, 0x00, 0xa1, 0x00, 0x90, 0x00, 0x91, 0x00, 0x95,
+    0x00, 0x96, 0x00, 0x95, 0x01, 0x90, 0x00, 0x96, 0x00, 0x06, 0x00, 0x68, 0x00, 0x9f, 0x00, 0x90,
+    0x00, 0x97, 0x00, 0x23, 0x00, 0x6e, 0x00, 0x9f, 0x00, 0x91, 0x00, 0xa1, 0x00, 0x29, 0xb1, 0x00,
+    0x00, 0x74, 0x00, 0x9d, 0x04, 0x91, 0x00, 0x9f, 0x00, 0x49, 0x02, 0x00, 0x00, 0x38, 0x00, 0x9f,
+    0x04, 0x91, 0x00, 0x9f, 0x00, 0x72, 0x00, 0x07, 0x01, 0x00, 0x00, 0x13, 0x00, 0x98, 0x00, 0x90,
+    0x03, 0x91, 0x00, 0x90, 0x00, 0x9f, 0x00, 0x22, 0x07, 0x00, 0x00, 0x15, 0x00, 0xa4, 0x01, 0x90,
+    0x00, 0x84, 0x00, 0x0b, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x83, 0x00, 0x90, 0x00, 0x91, 0x00, 0x9c,
+    0x00, 0x94, 0x00, 0x90, 0x00, 0x91, 0x03, 0x90, 0x00, 0x91, 0x00, 0x9f, 0x00, 0x68, 0x00, 0x07,
+    0x00, 0x91, 0x00, 0x90, 0x00, 0xa4, 0x00, 0x14, 0x00, 0x36, 0x00, 0xa1, 0x00, 0x91, 0x00, 0x90,
+    0x00, 0x9e, 0x00, 0x70, 0x00, 0x16, 0x00, 0x80, 0x00, 0x9e, 0x00, 0x94, 0x00, 0x50, 0x00, 0x6f,
+    0x00, 0x94, 0x00, 0xa1, 0x00, 0x3f, 0x0a, 0x00, 0x00, 0x0e, 0x00, 0x94, 0x00, 0x90, 0x00, 0x94,
+    0x00, 0x80, 0x00, 0x0d, 0x02, 0x00, 0x00, 0x11, 0x01, 0x91, 0x00, 0x9e, 0x00, 0x50, 0x00, 0x64,
+    0x00, 0x9e, 0x00, 0x9f, 0x00, 0x61, 0x04, 0x00, 0x00, 0x07, 0x00, 0x86, 0x00, 0x90, 0x00, 0x91,
+    0x03, 0x90, 0x02, 0x91, 0x00, 0x04, 0x00, 0x63, 0x00, 0x9f, 0x00, 0x90, 0x00, 0x87, 0x00, 0x01,
+    0x00, 0x33, 0x00, 0x9f, 0x00, 0x91, 0x00, 0x9f, 0x00, 0x64, 0xb1, 0x00, 0x00, 0x9a, 0x00, 0x90,
+    0x03, 0x91, 0x00, 0x9f, 0x00, 0x76, 0x00, 0x07, 0x02, 0x00, 0x00, 0x4b, 0x00, 0xa1, 0x03, 0x91,
+    0x00, 0x90, 0x00, 0x95, 0x00, 0x1c, 0x02, 0x00, 0x00, 0x1b, 0x00, 0xa1, 0x00, 0x90, 0x02, 0x91,
+    0x00, 0x90, 0x00, 0x9f, 0x00, 0x40, 0x08, 0x00, 0x00, 0x09, 0x00, 0x84, 0x00, 0x9e, 0x00, 0x91,
+    0x00, 0x9f, 0x00, 0x55, 0x00, 0x15, 0x00, 0x08, 0x00, 0x26, 0x00, 0x84, 0x00, 0x9f, 0x00, 0x90,
+    0x00, 0x97, 0x00, 0x9b, 0x00, 0x90, 0x00, 0x91, 0x00, 0x94, 0x02, 0x9f, 0x00, 0x94, 0x00, 0x91,
+    0x00, 0x9f, 0x00, 0x60, 0x00, 0x1e, 0x00, 0x91, 0x00, 0x90, 0x00, 0xa5, 0x00, 0x15, 0x00, 0x33,
+    0x00, 0xa2, 0x00, 0x90, 0x00, 0x91, 0x00, 0xa1, 0x00, 0x2b, 0x00, 0x1c, 0x00, 0xa2, 0x00, 0x90,
+    0x00, 0x82, 0x00, 0x47, 0x00, 0x92, 0x00, 0x90, 0x00, 0x9f, 0x00, 0x64, 0x00, 0x33, 0x02, 0x32,
+    0x00, 0x26, 0x00, 0x01, 0x04, 0x00, 0x00, 0x07, 0x00, 0x85, 0x00, 0x90, 0x00, 0x91, 0x00, 0x9f,
+    0x00, 0x54, 0x00, 0x18, 0x00, 0x07, 0x00, 0x26, 0x00, 0x72, 0x00, 0x9f, 0x00, 0x90, 0x00, 0x91,
+    0x00, 0x26, 0x00, 0x86, 0x00, 0x90, 0x00, 0x9f, 0x00, 0x77, 0x02, 0x32, 0x00, 0x33, 0x00, 0x25,
+    0x00, 0x34, 0x00, 0x9f, 0x00, 0x91, 0x00, 0x94, 0x02, 0x9f, 0x00, 0x94, 0x01, 0x91, 0x00, 0x8d,
+    0x00, 0x13, 0x00, 0x6d, 0x01, 0x9f, 0x00, 0x55, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x95, 0x01, 0x90,
+    0x00, 0x95, 0x00, 0x15, 0xb0, 0x00, 0x00, 0x95, 0x00, 0x90, 0x02, 0x91, 0x00, 0x9f, 0x00, 0x92,
+    0x00, 0x15, 0x03, 0x00, 0x00, 0x52, 0x00, 0x9f, 0x02, 0x91, 0x00, 0x90, 0x00, 0xa4, 0x00, 0x33,
+    0x03, 0x00, 0x00, 0x2c, 0x00, 0x9f, 0x02, 0x91, 0x00, 0x90, 0x00, 0xa1, 0x00, 0x5a, 0x00, 0x03,
+    0x09, 0x00, 0x00, 0x49, 0x00, 0xa1, 0x01, 0x91, 0x00, 0x9f, 0x00, 0x83, 0x00, 0x80, 0x00, 0x94,
+    0x00, 0x9f, 0x00, 0x90, 0x00, 0x94, 0x00, 0x7c, 0x00, 0x95, 0x00, 0x90, 0x00, 0x9f, 0x00, 0x68,
+    0x00, 0x37, 0x00, 0x34, 0x00, 0x37, 0x00, 0x67, 0x01, 0x9f, 0x00, 0x60, 0x00, 0x39, 0x00, 0x9f,
+    0x00, 0x90, 0x00, 0x92, 0x00, 0x0f, 0x00, 0x2c, 0x00, 0x9f, 0x00, 0x90, 0x00, 0x91, 0x00, 0x92,
+    0x00, 0x09, 0x00, 0x21, 0x00, 0xa1, 0x00, 0x90, 0x00, 0x80, 0x00, 0x45, 0x00, 0xa2, 0x00, 0x90,
+    0x00, 0x91, 0x00, 0x9f, 0x02, 0xa4, 0x00, 0xaa, 0x00, 0x62, 0x00, 0x01, 0x05, 0x00, 0x00, 0x40,
+    0x00, 0xa1, 0x01, 0x91, 0x00, 0x9f, 0x00, 0x91, 0x00, 0x7f, 0x00, 0x94, 0x00, 0x9f, 0x00, 0x91,
+    0x00, 0xa1, 0x00, 0x4b, 0x00, 0x12, 0x00, 0xa1, 0x00, 0x90, 0x00, 0x91, 0x00, 0x94, 0x02, 0xa4,
+    0x00, 0xa9, 0x00, 0x87, 0x00, 0x74, 0x00, 0x9f, 0x00, 0x91, 0x00, 0x80, 0x00, 0x38, 0x00, 0x37,
+    0x00, 0x34, 0x00, 0x4f, 0x00, 0xa1, 0x00, 0x90, 0x00, 0x8d, 0x00, 0x3a, 0x00, 0x83, 0x00, 0x90,
+    0x00, 0xa1, 0x00, 0x3f, 0x01, 0x00, 0x00, 0x55, 0x00, 0x9f, 0x00, 0x91, 0x00, 0xa1, 0x00, 0x40,
+    0xb0, 0x00, 0x00, 0xa2, 0x00, 0x90, 0x00, 0x91, 0x00, 0x90, 0x00, 0x9f, 0x00, 0x92, 0x00, 0x15,
+    0x04, 0x00, 0x00, 0x52, 0x00, 0x9f, 0x01, 0x91, 0x00, 0x9e, 0x00, 0xa2, 0x00, 0x33, 0x04, 0x00,
+    0x00, 0x29, 0x00, 0x9f, 0x01, 0x91, 0x00, 0x90, 0x00, 0xa1, 0x00, 0x68, 0x00, 0x06, 0x0a, 0x00,
+    0x00, 0x0d, 0x00, 0x84, 0x00, 0x9f, 0x02, 0x91, 0x00, 0x94, 0x00, 0x91, 0x00, 0x90, 0x00, 0xa1,
+    0x00, 0x68, 0x00, 0x42, 0x00, 0x9f, 0x00, 0x90, 0x00, 0x94, 0x00, 0x1e, 0x02, 0x00, 0x00, 0x3d,
+    0x00, 0xa1, 0x00, 0x90, 0x00, 0x80, 0x00, 0x7a, 0x00, 0x94, 0x00, 0x9f, 0x00, 0x70, 0x00, 0x01,
+    0x00, 0x24, 0x00, 0x94, 0x00, 0x91, 0x00, 0x9f, 0x00, 0x55, 0x00, 0x00, 0x00, 0x42, 0x00, 0x9f,
+    0x00, 0x90, 0x00, 0x85, 0x00, 0x41, 0x00, 0x9f, 0x02, 0x91, 0x02, 0x90, 0x00, 0xa1, 0x00, 0x3f,
+    0x06, 0x00, 0x00, 0x07, 0x00, 0x7e, 0x00, 0x9f, 0x02, 0x91, 0x00, 0x94, 0x00, 0x91, 0x00, 0x90,
+    0x00, 0x9f, 0x00, 0x84, 0x00, 0x0d, 0x00, 0x2e, 0x00, 0x9f, 0x02, 0x91, 0x03, 0x90, 0x00, 0x9c,
+    0x00, 0x95, 0x00, 0x90, 0x00, 0x9f, 0x00, 0x4e, 0x02, 0x00, 0x00, 0x17, 0x00, 0xa5, 0x00, 0x90,
+    0x00, 0x91, 0x00, 0x8c, 0x00, 0x95, 0x00, 0x90, 0x00, 0xa2, 0x00, 0x37, 0x01, 0x00, 0x00, 0x26,
+    0x00, 0x9f, 0x00, 0x91, 0x00, 0x9f, 0x00, 0x75, 0x00, 0x03, 0xaf, 0x00, 0x00, 0x79, 0x00, 0x9e,
+    0x00, 0x9d, 0x00, 0xa1, 0x00, 0x71, 0x00, 0x13, 0x05, 0x00, 0x00, 0x3e, 0x00, 0xa8, 0x00, 0x90,
+    0x00, 0xa1, 0x00, 0x84, 0x00, 0x29, 0x05, 0x00, 0x00, 0x12, 0x00, 0xa2, 0x00, 0x9d, 0x00, 0x9f,
+    0x00, 0xa0, 0x00, 0x4a, 0x00, 0x03, 0x0c, 0x00, 0x00, 0x15, 0x00, 0x84, 0x00, 0xa1, 0x03, 0x90,
+    0x00, 0xa1, 0x00, 0x68, 0x00, 0x13, 0x00, 0x80, 0x00, 0x9f, 0x00, 0xa7, 0x00, 0x81, 0x00, 0x01,
+    0x02, 0x00, 0x00, 0x41, 0x00, 0xa8, 0x00, 0x9e, 0x00, 0xa1, 0x00, 0xa5, 0x00, 0x9e, 0x00, 0xa7,
+    0x00, 0x63, 0x00, 0x00, 0x00, 0x15, 0x00, 0x94, 0x00, 0x9e, 0x00, 0xa4, 0x00, 0x1e, 0x00, 0x00,
+    0x00, 0x77, 0x01, 0xa6, 0x01, 0x69, 0x00, 0xa6, 0x04, 0x9f, 0x00, 0x9e, 0x00, 0xa9, 0x00, 0x38,
+    0x07, 0x00, 0x00, 0x13, 0x00, 0x81, 0x00, 0xa1, 0x03, 0x90, 0x00, 0xa1, 0x00, 0x73, 0x00, 0x0e,
+    0x00, 0x00, 0x00, 0x59, 0x00, 0xa7, 0x06, 0x9f, 0x00, 0xa1, 0x00, 0x9f, 0x00, 0x9e, 0x00, 0xa4,
+    0x00, 0x17, 0x02, 0x00, 0x00, 0x1c, 0x00, 0xa5, 0x00, 0x9e, 0x00, 0x9f, 0x00, 0xa2, 0x00, 0x9f,
+    0x00, 0x9e, 0x00, 0x9f, 0x00, 0x24, 0x01, 0x00, 0x00, 0x05, 0x00, 0x84, 0x01, 0x9e, 0x00, 0xa9,
+    0x00, 0x29, 0xaf, 0x00, 0x00, 0x0e, 0x00, 0x74, 0x00, 0x77, 0x00, 0x2b, 0x00, 0x03, 0x06, 0x00,
+    0x00, 0x03, 0x00, 0x4c, 0x00, 0x8a, 0x00, 0x41, 0x00, 0x0f, 0x07, 0x00, 0x00, 0x29, 0x00, 0x8a,
+    0x00, 0x59, 0x00, 0x1e, 0x0f, 0x00, 0x00, 0x0b, 0x00, 0x40, 0x00, 0x8a, 0x01, 0x97, 0x00, 0x85,
+    0x00, 0x2b, 0x00, 0x03, 0x00, 0x16, 0x00, 0x4e, 0x00, 0x4a, 0x00, 0x4c, 0x00, 0x24, 0x03, 0x00,
+    0x00, 0x1e, 0x00, 0x4e, 0x01, 0x4a, 0x00, 0x4c, 0x00, 0x4a, 0x00, 0x4e, 0x00, 0x2b, 0x00, 0x00,
+    0x00, 0x06, 0x00, 0x41, 0x00, 0x4c, 0x00, 0x36, 0x00, 0x03, 0x00, 0x00, 0x00, 0x42, 0x01, 0x4c,
+    0x00, 0x26, 0x00, 0x38, 0x00, 0x4c, 0x05, 0x4a, 0x00, 0x4c, 0x00, 0x15, 0x08, 0x00, 0x00, 0x09,
+    0x00, 0x40, 0x00, 0x88, 0x01, 0x97, 0x00, 0x87, 0x00, 0x2d, 0x00, 0x06, 0x01, 0x00, 0x00, 0x33,
+    0x00, 0x4e, 0x07, 0x4c, 0x00, 0x4a, 0x00, 0x4c, 0x00, 0x42, 0x00, 0x03, 0x02, 0x00, 0x00, 0x09,
+    0x00, 0x4a, 0x00, 0x4c, 0x00, 0x4a, 0x00, 0x4c, 0x00, 0x4a, 0x00, 0x4c, 0x00, 0x44, 0x00, 0x06,
+    0x02, 0x00, 0x00, 0x24, 0x00, 0x53, 0x00, 0x4a, 0x00, 0x53, 0x00, 0x2c, 0xff, 0x00, 0xff, 0x00,
+    0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x63, 0x00,
 #endif /* GNW_TARGET_ZELDA */
 };
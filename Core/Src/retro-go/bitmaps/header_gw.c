@@ -1,75 +1,548 @@
+// Packed bitmap, see bitmaps.h. Generated by tools/img2bin.py --lut8-rle
 #if !defined(GNW_TARGET_ZELDA)
 #define GNW_TARGET_ZELDA 0
 #endif /* GNW_TARGET_ZELDA */
 
-const unsigned short header_gw[] = {
+const unsigned char header_gw[] __attribute__((aligned(4))) = {
 #if GNW_TARGET_ZELDA != 0
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x43C4,0x7C47,0xC4CA,0xD488,0xD489,0xBCCA,0x7C26,0x3BC4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x8C88,0xBCEA,0xBCEB,0x43E5,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x8C89,0xBCEA,0xBCEB,0x5C47,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1362,0xA4A9,0xBCEA,0xBCCA,0x23A3,0x0320,0x5C27,0xBCEB,0xB4CA,0xB4CA,0xB4CA,0xB4CA,0xB4CA,0xB4CA,0xBCEB,0x5C27,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1B82,0x53C4,0x7426,0x63E5,0x33A3,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x2382,0x4BC4,0x4BC3,0x2B82,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x43C4,0x4BC3,0x4BC4,0x1341,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0B41,0x4BC4,0x4BC4,0x53C3,0x2BA3,0x0320,0x3BA3,0x4BC3,0x4BC4,0x1341,0x2362,0x4BC3,0x4BC4,0x4BC4,0x4BC4,0x4BC4,0x4BC4,0x4BC4,0x4BC4,0x43A3,0x0B41,0x0320,0x0320,0x0320,0x33A3,0x6405,0xB4CA,0xD4A9,0xD489,0xC4CA,0x8467,0x43C4,0x0340,0x0320,0x0320,0x0320,0x0B41,0x4BA3,0x4BC4,0x3BA3,0x0340,0x0320,0x0320,0x0320,0x0B41,0x43A3,0x4BC3,0x4BC4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x2382,0x9C68,0xD488,0xDC67,0xD446,0xD446,0xD446,0xD446,0xDC67,0xD488,0x9447,0x2382,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x6426,0xDC67,0xD446,0xDC66,0x53C4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x5C06,0xDC88,0xD446,0xDC67,0x7C88,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x8C67,0xDC87,0xD446,0xD447,0x33C4,0x0320,0x7447,0xDC66,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xDC87,0x7C68,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x33A3,0xBC88,0xDC88,0xDC66,0xE487,0xCCA8,0x63E5,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x6C47,0xE4C8,0xE4C8,0x8488,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x4BE5,0xDCA9,0xE4A8,0xE4E9,0x3BA3,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x7C47,0xE4C9,0xE4A8,0xDCC9,0x2BA3,0x3BC4,0xD4A9,0xE4A8,0xECE9,0x43A3,0x6C26,0xE4C8,0xDCA8,0xDCA8,0xDCA8,0xDCA8,0xDCA8,0xDCA8,0xE4A8,0xD4CA,0x2BC4,0x0320,0x1361,0x7C26,0xCC88,0xDC87,0xD446,0xD446,0xD446,0xD446,0xDC66,0xDC88,0xA468,0x33A3,0x0320,0x0320,0x2BC4,0xD488,0xE4C8,0xBCA9,0x1B82,0x0320,0x0320,0x0320,0x2383,0xCCCA,0xE4A8,0xDCC9,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x33A3,0xC467,0xDC87,0xDC66,0xDC67,0xD4A9,0xBCA9,0xBCA9,0xD4A9,0xDC67,0xDC66,0xDC87,0xC488,0x2B82,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x2BA3,0xCC88,0xD446,0xD447,0xDC67,0x53C4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x2382,0xC488,0xDC46,0xD447,0xDC67,0x7C68,0x0320,0x0320,0x0320,0x0320,0x0320,0x4BE5,0xDC88,0xD446,0xD447,0xD447,0x2BA3,0x0320,0x7427,0xDC67,0xD447,0xDC67,0xDC87,0xDC87,0xDC87,0xDC87,0xE4A8,0x7C68,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0B41,0xBC88,0xDC67,0xD467,0xDCA8,0xDC87,0xD446,0xDCA8,0x43C4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x6426,0xDC67,0xDC67,0x8468,0x0320,0x0320,0x0320,0x0320,0x0320,0x1361,0xBC68,0xDC66,0xD446,0xDC87,0x3BA3,0x0320,0x0320,0x0320,0x0320,0x0320,0x3BC4,0xD488,0xD446,0xDC67,0x6405,0x0320,0xAC68,0xDC66,0xD446,0xDC87,0x43A3,0x6C26,0xE487,0xDC66,0xDC46,0xD446,0xD446,0xD446,0xDC66,0xDC66,0xD4C9,0x2BA3,0x1B62,0xB489,0xDC87,0xDC66,0xDC67,0xDC88,0xD4A9,0xCCCA,0xDCA9,0xDC67,0xDC66,0xDC67,0xCC67,0x4BE5,0x0320,0x2BC4,0xCC47,0xDC66,0xB488,0x1B82,0x0320,0x0320,0x0320,0x2383,0xC4A9,0xD446,0xD468,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x2BA3,0xC467,0xDC46,0xDC67,0xBC67,0x5C05,0x2B82,0x1B82,0x1B82,0x2B82,0x6406,0xC488,0xDC67,0xDC67,0xC488,0x2382,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0B41,0xA468,0xDC67,0xD447,0xD447,0xDC67,0x53C4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x9C68,0xDC67,0xD447,0xD447,0xDC67,0x7C68,0x0320,0x0320,0x0320,0x0320,0x1B82,0xBC88,0xDC46,0xD447,0xD447,0xD447,0x2BA3,0x0320,0x7427,0xDC67,0xDC67,0x8C68,0x3362,0x3BA3,0x3BA3,0x3BA3,0x3BA3,0x1B82,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x4C26,0xD467,0xDC67,0x9C67,0x2B82,0x6C05,0xD488,0xDC67,0x9489,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x6426,0xDC67,0xDC67,0x8468,0x0320,0x0320,0x0320,0x0320,0x0320,0x8C68,0xDC87,0xD446,0xD446,0xDC87,0x3BA3,0x0320,0x0320,0x0320,0x0320,0x1361,0xB488,0xDC66,0xDC67,0xA468,0x0320,0x7C47,0xDC87,0xD446,0xD446,0xDC88,0x43A3,0x4C05,0xB4A9,0xA4A9,0xB4A9,0xD447,0xD446,0xCCA9,0xA4A9,0xACA9,0x9CA9,0x2BC4,0xAC88,0xDC67,0xD446,0xD488,0x9468,0x3BA3,0x2B83,0x23A3,0x2B82,0x6C26,0xBC68,0xDC67,0xD446,0xCC67,0x3BA3,0x23A3,0xCC47,0xDC66,0xB488,0x1B82,0x0320,0x0320,0x0320,0x2383,0xC4A9,0xD446,0xD488,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1361,0xAC88,0xDC67,0xDC87,0xA468,0x1361,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1B82,0xAC47,0xDC87,0xE487,0xA488,0x0B61,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x6426,0xDC87,0xD446,0xD446,0xD447,0xDC67,0x53C4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x5C05,0xDC67,0xD446,0xD446,0xD447,0xDC67,0x7C68,0x0320,0x0320,0x0320,0x0320,0x8C47,0xDC67,0xD446,0xD446,0xD447,0xD447,0x2BA3,0x0320,0x7427,0xDC67,0xDC67,0x6C47,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x6447,0xDC67,0xDC87,0x7447,0x0320,0x2BC4,0xC488,0xDC87,0xA489,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x6426,0xDC67,0xDC67,0x8468,0x0320,0x0320,0x0320,0x0320,0x43E5,0xD487,0xD446,0xD446,0xD446,0xDC87,0x3BA3,0x0320,0x0320,0x0320,0x0320,0x7C47,0xDC87,0xD446,0xCC88,0x2382,0x33A3,0xD488,0xD446,0xD446,0xD446,0xDC88,0x4BC4,0x0320,0x0320,0x0320,0x3BC4,0xDC67,0xDC46,0xA4A9,0x0320,0x0320,0x0320,0x7447,0xDC87,0xD446,0xCCA8,0x5405,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1B82,0xA468,0xDCC9,0xDCCA,0xAC68,0x1BA3,0xC446,0xDC66,0xB488,0x1B82,0x0320,0x0320,0x0320,0x2383,0xC4A9,0xD446,0xD488,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x4BE5,0xDCA8,0xDC46,0xB488,0x1341,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1B82,0x8488,0x8C89,0x8C89,0x1B83,0x0320,0x0320,0x0320,0x0320,0x0320,0x2BA3,0xCC88,0xD446,0xD468,0xCC88,0xD446,0xDC67,0x53C4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x2BA3,0xC488,0xDC66,0xD447,0xD4A9,0xD447,0xDC67,0x7C68,0x0320,0x0320,0x0320,0x53E5,0xD488,0xD446,0xD488,0xCC88,0xD446,0xD447,0x2BA3,0x0320,0x7427,0xDC67,0xDC67,0x7467,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x23A3,0xCC68,0xDC66,0xCC88,0x53E5,0x9447,0xDC67,0xDC67,0x7447,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x6426,0xDC67,0xDC67,0x8468,0x0320,0x0320,0x0320,0x1B82,0xBC88,0xDC67,0xD467,0xD467,0xD446,0xDC87,0x3BA3,0x0320,0x0320,0x0320,0x43C4,0xD488,0xD446,0xDC87,0x6426,0x0B61,0xB488,0xDC67,0xD467,0xD467,0xD446,0xDC88,0x4BC4,0x0320,0x0320,0x0320,0x3BC4,0xDC67,0xD446,0xA4A9,0x0B41,0x0320,0x2BA3,0xC488,0xDC66,0xD487,0x5C06,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0B41,0x2362,0x2362,0x1B61,0x2BC4,0xCC47,0xDC66,0xB488,0x1B82,0x0320,0x0320,0x0320,0x2383,0xC4A9,0xD446,0xD488,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xA4A9,0xDC46,0xDC88,0x4BE5,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xA468,0xDC67,0xDC67,0x9C68,0x8CA9,0xDC66,0xDC67,0x53C4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x9C68,0xDC67,0xDC66,0xAC88,0x8447,0xDC87,0xDC67,0x7C68,0x0320,0x0320,0x1B82,0xC488,0xD466,0xDC67,0x8489,0x9C88,0xDC66,0xD447,0x2BA3,0x0320,0x7427,0xDC67,0xDC67,0x6C47,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x7426,0xD467,0xD446,0xDC88,0xDC67,0xD446,0xC488,0x1B62,0x0320,0x6406,0x8405,0x8C26,0x2B83,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x6426,0xDC67,0xDC67,0x8468,0x0320,0x0320,0x0320,0x8447,0xDC67,0xD446,0xBCA9,0xB4A9,0xD446,0xDC87,0x3BA3,0x0320,0x0320,0x0B41,0xB488,0xDC67,0xDC67,0xA488,0x0320,0x7426,0xDC87,0xD446,0xBCA9,0xB4CA,0xD446,0xDC88,0x4BC4,0x0320,0x0320,0x0320,0x3BC4,0xDC67,0xD446,0xA4A9,0x0B41,0x0320,0x5BE5,0xDC88,0xDC67,0xA488,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x2BC4,0xCC47,0xDC66,0xB488,0x0B61,0x0320,0x0320,0x0320,0x1B83,0xC4A9,0xD446,0xD488,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xD4CA,0xD446,0xC4A9,0x1B82,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x6C26,0xDC87,0xD446,0xD488,0x33C4,0x8C88,0xDC67,0xDC67,0x53C4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x6426,0xDC88,0xD446,0xD488,0x3383,0x63A3,0xDC87,0xDC67,0x7C68,0x0320,0x0B41,0x9468,0xDC67,0xDC67,0xBC88,0x2BA4,0xA488,0xDC46,0xD447,0x2BA3,0x0320,0x7427,0xDC67,0xD446,0xACA9,0x7447,0x8468,0x8468,0x8468,0x8C89,0x3BE5,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0B41,0xB467,0xDC67,0xD446,0xD446,0xC467,0x2BC4,0x0320,0x23A3,0xCC68,0xE4A7,0xC488,0x2382,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x6426,0xDC67,0xDC67,0x8468,0x0320,0x0320,0x4BE5,0xD488,0xD446,0xDC88,0x4BE5,0x9CA9,0xDC66,0xDC87,0x3BA3,0x0320,0x0320,0x7C47,0xDC87,0xDC46,0xCC88,0x2382,0x3BC4,0xD488,0xD446,0xDC87,0x5C05,0x94A9,0xDC67,0xDC88,0x4BC4,0x0320,0x0320,0x0320,0x3BC4,0xDC67,0xD446,0xA4A9,0x0340,0x0320,0x9488,0xDC66,0xDC87,0x4BE5,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x2BC4,0xCC47,0xDC46,0xCC88,0x6C26,0x6C27,0x6C47,0x6C27,0x6C26,0xCC88,0xD446,0xD488,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xD468,0xDC66,0x9C47,0x0340,0x0320,0x0320,0x0320,0x0320,0x0320,0x33E4,0x3BE5,0x3BE5,0x3BE5,0x3BE5,0x3BE5,0x3BE5,0x3BE5,0x33E5,0x0320,0x0320,0x0320,0x2BA3,0xCC88,0xD446,0xDC87,0x7C47,0x0320,0x94A9,0xDC67,0xDC67,0x53C4,0x0320,0x0320,0x0320,0x0320,0x0320,0x2382,0xC488,0xDC46,0xDC87,0x8467,0x0320,0x73E5,0xDC87,0xDC67,0x7C68,0x0320,0x4BE5,0xD488,0xD446,0xDC88,0x53E5,0x0B41,0xB4A9,0xDC46,0xD447,0x2BA3,0x0320,0x7427,0xDC67,0xD447,0xD446,0xDC67,0xDC67,0xDC67,0xDC67,0xE487,0x7C68,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0B41,0x9447,0xD467,0xD467,0xDC87,0xD446,0xCC47,0x7426,0x0320,0x7426,0xDC87,0xDC67,0x7447,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x6426,0xDC67,0xDC67,0x8468,0x0320,0x1B61,0xBC88,0xDC46,0xDC67,0x9468,0x0B61,0xACAA,0xD446,0xDC87,0x3BA3,0x0320,0x3BC4,0xD488,0xD446,0xDC87,0x6406,0x0320,0xB488,0xDC66,0xDC67,0xA488,0x0B41,0xA4A9,0xDC67,0xDC88,0x4BC4,0x0320,0x0320,0x0320,0x3BC4,0xDC67,0xD446,0xA4A9,0x0340,0x0320,0xB4AA,0xD446,0xDCA9,0x2B82,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x2BC4,0xCC47,0xD447,0xD446,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xD446,0xD446,0xD488,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xD468,0xDC66,0x9C47,0x0340,0x0320,0x0320,0x0320,0x0320,0x0B20,0xC488,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xCCC9,0x1341,0x0320,0x0B61,0xA488,0xDC67,0xDC67,0xA468,0x0B41,0x0320,0x9489,0xDC67,0xDC67,0x53C4,0x0320,0x0320,0x0320,0x0320,0x0320,0x9C68,0xDC67,0xDC66,0xBC88,0x0B61,0x0320,0x73E5,0xDC87,0xDC67,0x7468,0x1B82,0xC489,0xD446,0xDC67,0x9468,0x0320,0x1362,0xB4A9,0xDC46,0xD447,0x2BA3,0x0320,0x7427,0xDC67,0xD447,0xD446,0xDC67,0xDC67,0xDC67,0xDC67,0xE4A7,0x7C88,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0B41,0x9447,0xE487,0xDC67,0xC468,0x8C67,0xCC88,0xDC66,0xDC67,0x8C68,0xB467,0xDC66,0xCC88,0x1B82,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x6426,0xDC67,0xDC67,0x8468,0x0320,0x8C67,0xDC87,0xD446,0xC488,0x1B62,0x0320,0xB4AA,0xD446,0xDC87,0x3383,0x1362,0xB488,0xDC66,0xDC67,0xA468,0x0320,0x7C47,0xDC87,0xD446,0xCC88,0x2382,0x0320,0xA4AA,0xDC67,0xDC88,0x4BC4,0x0320,0x0320,0x0320,0x3BC4,0xDC67,0xD446,0xA4A9,0x0340,0x0320,0xB4CA,0xD446,0xDCA9,0x2B82,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x2BC4,0xCC47,0xD447,0xD446,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xD446,0xD446,0xD488,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xD4C9,0xD446,0xC4A9,0x1B82,0x0320,0x0320,0x0320,0x0320,0x0B20,0xD488,0xDC87,0xDC67,0xDC67,0xDC87,0xDC67,0xD447,0xD446,0xC4CA,0x0B41,0x0320,0x6406,0xDC87,0xD446,0xD488,0x6C47,0x4C06,0x4405,0xACA9,0xD446,0xDC67,0x53C4,0x0320,0x0320,0x0320,0x0320,0x5C06,0xDC87,0xD446,0xD488,0x4BE5,0x0320,0x0320,0x73E5,0xDC87,0xDC67,0x6467,0x7C05,0xDC87,0xDC67,0xC488,0x1B82,0x0320,0x1362,0xB4A9,0xDC46,0xD447,0x2BA3,0x0320,0x7427,0xDC67,0xDC67,0x9C88,0x53E4,0x6426,0x5C06,0x5C06,0x6426,0x33C4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x3BC4,0xDCA8,0xDC46,0xC488,0x2B82,0x0320,0x5406,0xCC88,0xDC66,0xDC67,0xDC67,0xDC67,0x7C47,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x6426,0xDC67,0xDC67,0x6C47,0x43C4,0xD487,0xD446,0xD488,0x5C06,0x0320,0x0340,0xB4AA,0xD446,0xDC87,0x2B62,0x6C05,0xDC87,0xD446,0xCC88,0x23A3,0x33A3,0xD488,0xD446,0xD488,0x7468,0x1361,0x1361,0xA4AA,0xDC67,0xDC88,0x4BC4,0x0320,0x0320,0x0320,0x3BC4,0xDC67,0xD446,0xA4A9,0x0340,0x0320,0x9489,0xDC66,0xDC87,0x4BE4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x2BC4,0xCC47,0xDC46,0xCC88,0x6C47,0x6C47,0x7447,0x6C47,0x7447,0xCC88,0xD446,0xD488,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xACCA,0xDC46,0xDC88,0x4BE4,0x0320,0x0320,0x0320,0x0320,0x0320,0x8447,0x9446,0x8C26,0x9446,0x83E5,0xBC68,0xD467,0xDC67,0x8447,0x0320,0x33A3,0xD4A9,0xD446,0xD447,0xD447,0xD467,0xD467,0xD467,0xD447,0xD447,0xDC67,0x53C4,0x0320,0x0320,0x0320,0x23A3,0xCC88,0xD446,0xDC87,0x8447,0x0320,0x0320,0x0320,0x73E5,0xDC87,0xD446,0xACCA,0xCC88,0xD446,0xDC88,0x5405,0x0320,0x0320,0x1362,0xB4A9,0xDC46,0xD447,0x2BA3,0x0320,0x7427,0xDC67,0xDC67,0x6C47,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x8468,0xDC66,0xDC88,0x4BE4,0x0320,0x0320,0x0320,0x3BC4,0xBC67,0xD447,0xD446,0xDCA9,0x3BC4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x6426,0xDC67,0xDC67,0x7C88,0xAC88,0xDC66,0xDC67,0x9467,0x0320,0x0320,0x0340,0xB4AA,0xD446,0xD488,0x7447,0xCC88,0xD446,0xDC87,0x6406,0x0340,0xB488,0xDC67,0xD446,0xD467,0xBCCA,0xC4CA,0xC4CA,0xD488,0xD446,0xDC88,0x4BC4,0x0320,0x0320,0x0320,0x3BC4,0xDC67,0xD446,0xA4A9,0x0B41,0x0320,0x5BE5,0xDC87,0xDC67,0x9C88,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x2BC4,0xCC47,0xDC66,0xB488,0x1362,0x0320,0x0320,0x0320,0x1B83,0xC4A9,0xD446,0xD488,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x53E5,0xDC88,0xDC46,0xB488,0x0B40,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0B41,0xB468,0xDC66,0xD488,0x43C4,0x0320,0xA467,0xDC67,0xD446,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xD446,0xD447,0xDC67,0x53C4,0x0320,0x0320,0x0B40,0x9C68,0xDC67,0xDC66,0xBC88,0x1362,0x0320,0x0320,0x0320,0x73E5,0xDC87,0xD447,0xDC67,0xD447,0xDC87,0x9468,0x0320,0x0320,0x0320,0x1362,0xB4A9,0xDC46,0xD447,0x2BA3,0x0320,0x7427,0xDC67,0xDC67,0x7447,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x9CA9,0xDC66,0xD4A9,0x3BC4,0x0320,0x0320,0x0320,0x0320,0x6426,0xDC88,0xD446,0xD467,0xB488,0x1B62,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x6426,0xDC67,0xD447,0xCC88,0xD467,0xD446,0xC489,0x2383,0x0320,0x0320,0x0340,0xB4AA,0xD446,0xD467,0xD489,0xD446,0xDC67,0xA468,0x0320,0x7C47,0xDC67,0xD447,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xDC88,0x4BC4,0x0320,0x0320,0x0320,0x3BC4,0xDC67,0xD446,0xA4A9,0x0B41,0x0320,0x2BA3,0xCC88,0xDC66,0xD468,0x4C05,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0340,0x1B82,0x1B82,0x1B62,0x2BE4,0xCC47,0xDC66,0xB488,0x1B82,0x0320,0x0320,0x0320,0x2383,0xC4A9,0xD446,0xD488,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1362,0xB488,0xDC67,0xDC67,0x9C68,0x0B41,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1341,0xA447,0xDC67,0xDC67,0xA468,0x0320,0x6C26,0xDC88,0xD446,0xD468,0x8C47,0x8C47,0x8C47,0x8C47,0x8426,0xC488,0xD446,0xDC67,0x53C4,0x0320,0x0320,0x5C06,0xDC88,0xD446,0xD488,0x43E4,0x0320,0x0320,0x0320,0x0320,0x73E5,0xDC87,0xD447,0xD446,0xDC66,0xBC88,0x1B62,0x0320,0x0320,0x0320,0x1362,0xB4A9,0xDC46,0xD447,0x2BA3,0x0320,0x7427,0xDC67,0xDC67,0x6C47,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x7447,0xDC67,0xDC88,0x53E5,0x0320,0x0320,0x0320,0x0B41,0xAC68,0xDC66,0xDC67,0xDC67,0xDC67,0xBC88,0x2382,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x6426,0xDC67,0xD447,0xD446,0xD446,0xD488,0x5405,0x0320,0x0320,0x0320,0x0340,0xB4AA,0xD446,0xD446,0xD446,0xDC66,0xC488,0x2382,0x33C4,0xD488,0xD446,0xDC67,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD4A9,0xD468,0xD446,0xDC88,0x4BC4,0x0320,0x0320,0x0320,0x3BC4,0xDC67,0xD446,0xA4A9,0x0B41,0x0320,0x0320,0x8447,0xDC87,0xD446,0xC488,0x43E5,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0B41,0x9468,0xD4CA,0xCCCA,0xAC88,0x23A3,0xC446,0xDC66,0xB488,0x1B82,0x0320,0x0320,0x0320,0x2383,0xC4A9,0xD446,0xD488,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x33C4,0xCC67,0xD446,0xDC87,0xAC68,0x4BE4,0x2383,0x1362,0x1362,0x2383,0x53E5,0xB467,0xDC67,0xD446,0xC488,0x2382,0x2BA3,0xCC88,0xD446,0xDC87,0x7C47,0x0320,0x0320,0x0320,0x0320,0x0320,0x94A9,0xDC67,0xDC67,0x53C4,0x0320,0x2BA3,0xCC88,0xD446,0xDC67,0x8447,0x0320,0x0320,0x0320,0x0320,0x0320,0x73E5,0xDC87,0xD447,0xD446,0xDC88,0x5405,0x0320,0x0320,0x0320,0x0320,0x1362,0xB4A9,0xDC46,0xD447,0x2BA3,0x0320,0x7427,0xDC67,0xD446,0xC4A9,0xA4A9,0xACA9,0xACA9,0xACA9,0xB4A9,0x5426,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x33A3,0xDCA8,0xD446,0xC467,0x43C4,0x2B83,0x2B82,0x9467,0xDC87,0xDC67,0xA488,0xA489,0xDC67,0xDC67,0xBC67,0x3BC4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x6426,0xDC67,0xD447,0xD447,0xDC67,0x9468,0x0340,0x0320,0x0320,0x0320,0x0340,0xB4AA,0xD446,0xD447,0xD446,0xDC88,0x6426,0x0B41,0xB488,0xDC66,0xDC67,0xA468,0x2362,0x2361,0x2361,0x2361,0x2362,0xACA9,0xDC47,0xDC88,0x4BC4,0x0320,0x0320,0x0320,0x3BC4,0xDC67,0xD446,0xA4A9,0x0B41,0x0320,0x0320,0x1B62,0xB488,0xDC67,0xD446,0xD488,0x8447,0x2B82,0x2383,0x1B82,0x2B83,0x53E5,0xB467,0xDC87,0xD446,0xD467,0x53E5,0x23A3,0xCC47,0xDC66,0xB488,0x1B82,0x0320,0x0320,0x0320,0x2383,0xC4A9,0xD446,0xD488,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x4C05,0xCC67,0xDC67,0xDC66,0xDC88,0xCCA9,0xA488,0xAC88,0xCCA9,0xDC87,0xDC66,0xDC87,0xC488,0x3382,0x0B41,0xAC88,0xDC67,0xDC67,0xAC68,0x1341,0x0320,0x0320,0x0320,0x0320,0x0320,0x94A9,0xDC66,0xDC67,0x4BC4,0x0320,0x9C67,0xDC67,0xDC46,0xBC88,0x1361,0x0320,0x0320,0x0320,0x0320,0x0320,0x73E5,0xDC67,0xD446,0xDC67,0x8C47,0x0320,0x0320,0x0320,0x0320,0x0320,0x1362,0xB4A9,0xDC46,0xD447,0x2BA3,0x0320,0x7447,0xDC66,0xD446,0xD446,0xDC66,0xDC66,0xDC66,0xDC66,0xDC87,0x7C88,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0B41,0x8C68,0xE487,0xDC46,0xDC87,0xD4AA,0xDCA9,0xDC67,0xDC66,0xC467,0x2382,0x0B41,0xA488,0xDC87,0xDC66,0xB489,0x1382,0x0320,0x0320,0x0320,0x0320,0x0320,0x6426,0xDC67,0xD447,0xD466,0xC488,0x1B82,0x0320,0x0320,0x0320,0x0320,0x0340,0xB4AA,0xD446,0xD447,0xDC67,0x9C67,0x0320,0x7C47,0xDC87,0xDC46,0xCC88,0x23A3,0x0320,0x0320,0x0320,0x0320,0x0320,0xA4A9,0xDC67,0xDC88,0x4BC4,0x0320,0x0320,0x0320,0x3BC4,0xDC67,0xD446,0xA4A9,0x0B41,0x0320,0x0320,0x0320,0x2362,0xBCA8,0xDC87,0xDC46,0xDC67,0xDCA8,0xC4A9,0xC4A9,0xD4A9,0xDC87,0xDC66,0xDC67,0xD467,0x6C47,0x0320,0x2BC4,0xCC47,0xDC66,0xB488,0x1B82,0x0320,0x0320,0x0320,0x2383,0xC4A9,0xD446,0xD488,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x2BA3,0xAC68,0xDC88,0xDC66,0xD446,0xDC66,0xDC66,0xD446,0xDC66,0xDC88,0xA468,0x2B82,0x0320,0x7C67,0xE4C8,0xE4A8,0xD4A9,0x3BC4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x9CA9,0xE4C8,0xE4E8,0x43A3,0x5BE5,0xE4E9,0xE4A8,0xD4A9,0x43E4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x7C26,0xECE8,0xE4A8,0xBCA9,0x2383,0x0320,0x0320,0x0320,0x0320,0x0320,0x1362,0xBCCA,0xE4A8,0xDCA8,0x33C4,0x0320,0x7447,0xECC8,0xDCA8,0xDCA8,0xDCA8,0xDCA8,0xDCA8,0xDCA8,0xE4C8,0x7C88,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0B40,0x8C68,0xD488,0xDC87,0xDC46,0xDC66,0xDCA8,0xBC88,0x33A3,0x0320,0x0320,0x0B41,0x9C88,0xCCA9,0x33C4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x6C26,0xDC66,0xD446,0xDC88,0x5405,0x0320,0x0320,0x0320,0x0320,0x0320,0x0B41,0xB4CA,0xDC46,0xDC66,0xCC88,0x23A3,0x43C3,0xD488,0xDC46,0xDC87,0x6426,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xA4AA,0xDC66,0xE487,0x4BC4,0x0320,0x0320,0x0320,0x43C4,0xDC66,0xDC46,0xACA9,0x0B41,0x0320,0x0320,0x0320,0x0320,0x1B62,0x8C47,0xD488,0xDC67,0xD446,0xD446,0xD446,0xD446,0xDC46,0xDC88,0xB487,0x43E4,0x0320,0x0320,0x2BC4,0xCC47,0xDC66,0xB488,0x1B83,0x0320,0x0320,0x0320,0x2383,0xCCA9,0xDC46,0xDC87,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0B41,0x4BC4,0x9488,0xD4CA,0xD468,0xD488,0xCCCA,0x8C68,0x43C4,0x0320,0x0320,0x0320,0x4BC4,0x4BA3,0x4BC4,0x3BC4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x33A3,0x4BA3,0x4BC4,0x1361,0x33A3,0x4BC3,0x4BC4,0x3BA3,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x2B82,0x4BC4,0x4BC3,0x33A3,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x3BA3,0x4BC3,0x4BC4,0x0B41,0x0320,0x2382,0x4BC4,0x4BC4,0x4BC4,0x4BC4,0x4BC4,0x4BC4,0x4BC4,0x4BA3,0x2382,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x3BC3,0x6C26,0x94A9,0x8467,0x53C4,0x1B82,0x0320,0x0320,0x0320,0x0320,0x1341,0x33C4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x5426,0xBCEB,0xBCEA,0x8468,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x8CAA,0xBCEA,0xBCEB,0x5C26,0x0320,0x9CCA,0xBCEA,0xBCCA,0x8C89,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x7C89,0xBCEA,0xBCEB,0x3BC4,0x0320,0x0320,0x0320,0x33C4,0xBCEB,0xBCCA,0x84A9,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x3BA3,0x7C47,0xC4CA,0xD4A8,0xD468,0xD4CA,0xA4A9,0x53C4,0x1362,0x0320,0x0320,0x0320,0x23A3,0xACCA,0xBCEA,0x94AA,0x0B41,0x0320,0x0320,0x0320,0x1362,0xA4CA,0xBCCA,0xB4CA,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
+    0x40, 0x01, 0x20, 0x00, 0xc6, 0x00, 0x20, 0x03, 0x40, 0x03, 0x20, 0x0b, 0x40, 0x0b, 0x41, 0x0b,
+    0x61, 0x0b, 0x41, 0x13, 0x61, 0x13, 0x62, 0x13, 0x82, 0x13, 0x61, 0x1b, 0x62, 0x1b, 0x82, 0x1b,
+    0x83, 0x1b, 0xa3, 0x1b, 0x61, 0x23, 0x62, 0x23, 0x82, 0x23, 0x83, 0x23, 0xa3, 0x23, 0x62, 0x2b,
+    0x82, 0x2b, 0x83, 0x2b, 0xa3, 0x2b, 0xa4, 0x2b, 0xc4, 0x2b, 0xe4, 0x2b, 0x62, 0x33, 0x82, 0x33,
+    0x83, 0x33, 0xa3, 0x33, 0xc4, 0x33, 0xe4, 0x33, 0xe5, 0x33, 0xa3, 0x3b, 0xc3, 0x3b, 0xc4, 0x3b,
+    0xe5, 0x3b, 0xa3, 0x43, 0xc3, 0x43, 0xc4, 0x43, 0xe4, 0x43, 0xe5, 0x43, 0x05, 0x44, 0xa3, 0x4b,
+    0xc3, 0x4b, 0xc4, 0x4b, 0xe4, 0x4b, 0xe5, 0x4b, 0x05, 0x4c, 0x06, 0x4c, 0x26, 0x4c, 0xc3, 0x53,
+    0xc4, 0x53, 0xe4, 0x53, 0xe5, 0x53, 0x05, 0x54, 0x06, 0x54, 0x26, 0x54, 0xe5, 0x5b, 0x05, 0x5c,
+    0x06, 0x5c, 0x26, 0x5c, 0x27, 0x5c, 0x47, 0x5c, 0xa3, 0x63, 0xe5, 0x63, 0x05, 0x64, 0x06, 0x64,
+    0x26, 0x64, 0x47, 0x64, 0x67, 0x64, 0x05, 0x6c, 0x26, 0x6c, 0x27, 0x6c, 0x47, 0x6c, 0xe5, 0x73,
+    0x26, 0x74, 0x27, 0x74, 0x47, 0x74, 0x67, 0x74, 0x68, 0x74, 0x05, 0x7c, 0x26, 0x7c, 0x47, 0x7c,
+    0x67, 0x7c, 0x68, 0x7c, 0x88, 0x7c, 0x89, 0x7c, 0xe5, 0x83, 0x05, 0x84, 0x26, 0x84, 0x47, 0x84,
+    0x67, 0x84, 0x68, 0x84, 0x88, 0x84, 0x89, 0x84, 0xa9, 0x84, 0x26, 0x8c, 0x47, 0x8c, 0x67, 0x8c,
+    0x68, 0x8c, 0x88, 0x8c, 0x89, 0x8c, 0xa9, 0x8c, 0xaa, 0x8c, 0x46, 0x94, 0x47, 0x94, 0x67, 0x94,
+    0x68, 0x94, 0x88, 0x94, 0x89, 0x94, 0xa9, 0x94, 0xaa, 0x94, 0x47, 0x9c, 0x67, 0x9c, 0x68, 0x9c,
+    0x88, 0x9c, 0xa9, 0x9c, 0xca, 0x9c, 0x47, 0xa4, 0x67, 0xa4, 0x68, 0xa4, 0x88, 0xa4, 0x89, 0xa4,
+    0xa9, 0xa4, 0xaa, 0xa4, 0xca, 0xa4, 0x47, 0xac, 0x68, 0xac, 0x88, 0xac, 0xa9, 0xac, 0xaa, 0xac,
+    0xca, 0xac, 0x67, 0xb4, 0x68, 0xb4, 0x87, 0xb4, 0x88, 0xb4, 0x89, 0xb4, 0xa9, 0xb4, 0xaa, 0xb4,
+    0xca, 0xb4, 0x67, 0xbc, 0x68, 0xbc, 0x88, 0xbc, 0xa8, 0xbc, 0xa9, 0xbc, 0xca, 0xbc, 0xea, 0xbc,
+    0xeb, 0xbc, 0x46, 0xc4, 0x67, 0xc4, 0x68, 0xc4, 0x88, 0xc4, 0x89, 0xc4, 0xa9, 0xc4, 0xca, 0xc4,
+    0x47, 0xcc, 0x67, 0xcc, 0x68, 0xcc, 0x88, 0xcc, 0xa8, 0xcc, 0xa9, 0xcc, 0xc9, 0xcc, 0xca, 0xcc,
+    0x46, 0xd4, 0x47, 0xd4, 0x66, 0xd4, 0x67, 0xd4, 0x68, 0xd4, 0x87, 0xd4, 0x88, 0xd4, 0x89, 0xd4,
+    0xa8, 0xd4, 0xa9, 0xd4, 0xaa, 0xd4, 0xc9, 0xd4, 0xca, 0xd4, 0x46, 0xdc, 0x47, 0xdc, 0x66, 0xdc,
+    0x67, 0xdc, 0x87, 0xdc, 0x88, 0xdc, 0xa8, 0xdc, 0xa9, 0xdc, 0xc9, 0xdc, 0xca, 0xdc, 0x87, 0xe4,
+    0xa7, 0xe4, 0xa8, 0xe4, 0xc8, 0xe4, 0xc9, 0xe4, 0xe8, 0xe4, 0xe9, 0xe4, 0xc8, 0xec, 0xe8, 0xec,
+    0xe9, 0xec, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
+    0xff, 0x00, 0xd0, 0x00, 0x00, 0x28, 0x00, 0x54, 0x00, 0x9c, 0x00, 0xab, 0x00, 0xac, 0x00, 0x93,
+    0x00, 0x53, 0x00, 0x24, 0x0d, 0x00, 0x00, 0x66, 0x00, 0x94, 0x00, 0x95, 0x00, 0x2a, 0x0a, 0x00,
+    0x00, 0x67, 0x00, 0x94, 0x00, 0x95, 0x00, 0x40, 0x05, 0x00, 0x00, 0x08, 0x00, 0x7d, 0x00, 0x94,
+    0x00, 0x93, 0x00, 0x13, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x95, 0x05, 0x8d, 0x00, 0x95, 0x00, 0x3f,
+    0x08, 0x00, 0x00, 0x0c, 0x00, 0x35, 0x00, 0x4d, 0x00, 0x42, 0x00, 0x1e, 0x0d, 0x00, 0x00, 0x11,
+    0x00, 0x2e, 0x00, 0x2d, 0x00, 0x15, 0x06, 0x00, 0x00, 0x28, 0x00, 0x2d, 0x00, 0x2e, 0x00, 0x06,
+    0x05, 0x00, 0x00, 0x04, 0x01, 0x2e, 0x00, 0x34, 0x00, 0x17, 0x00, 0x00, 0x00, 0x22, 0x00, 0x2d,
+    0x00, 0x2e, 0x00, 0x06, 0x00, 0x10, 0x00, 0x2d, 0x06, 0x2e, 0x00, 0x26, 0x00, 0x04, 0x02, 0x00,
+    0x00, 0x1e, 0x00, 0x43, 0x00, 0x8d, 0x00, 0xae, 0x00, 0xac, 0x00, 0x9c, 0x00, 0x5d, 0x00, 0x28,
+    0x00, 0x01, 0x02, 0x00, 0x00, 0x04, 0x00, 0x2c, 0x00, 0x2e, 0x00, 0x22, 0x00, 0x01, 0x02, 0x00,
+    0x00, 0x04, 0x00, 0x26, 0x00, 0x2d, 0x00, 0x2e, 0x9d, 0x00, 0x00, 0x11, 0x00, 0x74, 0x00, 0xab,
+    0x00, 0xb5, 0x03, 0xa5, 0x00, 0xb5, 0x00, 0xab, 0x00, 0x6b, 0x00, 0x11, 0x0a, 0x00, 0x00, 0x45,
+    0x00, 0xb5, 0x00, 0xa5, 0x00, 0xb4, 0x00, 0x35, 0x09, 0x00, 0x00, 0x3d, 0x00, 0xb7, 0x00, 0xa5,
+    0x00, 0xb5, 0x00, 0x57, 0x05, 0x00, 0x00, 0x64, 0x00, 0xb6, 0x00, 0xa5, 0x00, 0xa6, 0x00, 0x1f,
+    0x00, 0x00, 0x00, 0x4f, 0x00, 0xb4, 0x05, 0xa5, 0x00, 0xb6, 0x00, 0x56, 0x07, 0x00, 0x00, 0x1e,
+    0x00, 0x90, 0x00, 0xb7, 0x00, 0xb4, 0x00, 0xbc, 0x00, 0xa1, 0x00, 0x42, 0x0c, 0x00, 0x00, 0x4b,
+    0x01, 0xbf, 0x00, 0x5f, 0x05, 0x00, 0x00, 0x30, 0x00, 0xb9, 0x00, 0xbe, 0x00, 0xc2, 0x00, 0x22,
+    0x05, 0x00, 0x00, 0x54, 0x00, 0xc0, 0x00, 0xbe, 0x00, 0xba, 0x00, 0x17, 0x00, 0x24, 0x00, 0xae,
+    0x00, 0xbe, 0x00, 0xc5, 0x00, 0x26, 0x00, 0x49, 0x00, 0xbf, 0x05, 0xb8, 0x00, 0xbe, 0x00, 0xb1,
+    0x00, 0x19, 0x00, 0x00, 0x00, 0x07, 0x00, 0x53, 0x00, 0xa0, 0x00, 0xb6, 0x03, 0xa5, 0x00, 0xb4,
+    0x00, 0xb7, 0x00, 0x7a, 0x00, 0x1e, 0x01, 0x00, 0x00, 0x19, 0x00, 0xab, 0x00, 0xbf, 0x00, 0x92,
+    0x00, 0x0c, 0x02, 0x00, 0x00, 0x12, 0x00, 0xa4, 0x00, 0xbe, 0x00, 0xba, 0x9c, 0x00, 0x00, 0x1e,
+    0x00, 0x97, 0x00, 0xb6, 0x00, 0xb4, 0x00, 0xb5, 0x00, 0xae, 0x01, 0x92, 0x00, 0xae, 0x00, 0xb5,
+    0x00, 0xb4, 0x00, 0xb6, 0x00, 0x99, 0x00, 0x15, 0x08, 0x00, 0x00, 0x17, 0x00, 0xa0, 0x00, 0xa5,
+    0x00, 0xa6, 0x00, 0xb5, 0x00, 0x35, 0x08, 0x00, 0x00, 0x11, 0x00, 0x99, 0x00, 0xb2, 0x00, 0xa6,
+    0x00, 0xb5, 0x00, 0x56, 0x04, 0x00, 0x00, 0x30, 0x00, 0xb7, 0x00, 0xa5, 0x01, 0xa6, 0x00, 0x17,
+    0x00, 0x00, 0x00, 0x4e, 0x00, 0xb5, 0x00, 0xa6, 0x00, 0xb5, 0x03, 0xb6, 0x00, 0xbe, 0x00, 0x56,
+    0x06, 0x00, 0x00, 0x04, 0x00, 0x90, 0x00, 0xb5, 0x00, 0xa8, 0x00, 0xb8, 0x00, 0xb6, 0x00, 0xa5,
+    0x00, 0xb8, 0x00, 0x28, 0x0b, 0x00, 0x00, 0x45, 0x01, 0xb5, 0x00, 0x5e, 0x04, 0x00, 0x00, 0x07,
+    0x00, 0x8f, 0x00, 0xb4, 0x00, 0xa5, 0x00, 0xb6, 0x00, 0x22, 0x04, 0x00, 0x00, 0x24, 0x00, 0xab,
+    0x00, 0xa5, 0x00, 0xb5, 0x00, 0x43, 0x00, 0x00, 0x00, 0x81, 0x00, 0xb4, 0x00, 0xa5, 0x00, 0xb6,
+    0x00, 0x26, 0x00, 0x49, 0x00, 0xbc, 0x00, 0xb4, 0x00, 0xb2, 0x02, 0xa5, 0x01, 0xb4, 0x00, 0xb0,
+    0x00, 0x17, 0x00, 0x0b, 0x00, 0x8a, 0x00, 0xb6, 0x00, 0xb4, 0x00, 0xb5, 0x00, 0xb7, 0x00, 0xae,
+    0x00, 0xa4, 0x00, 0xb9, 0x00, 0xb5, 0x00, 0xb4, 0x00, 0xb5, 0x00, 0x9e, 0x00, 0x30, 0x00, 0x00,
+    0x00, 0x19, 0x00, 0x9d, 0x00, 0xb4, 0x00, 0x89, 0x00, 0x0c, 0x02, 0x00, 0x00, 0x12, 0x00, 0x9b,
+    0x00, 0xa5, 0x00, 0xa9, 0x9b, 0x00, 0x00, 0x17, 0x00, 0x97, 0x00, 0xb2, 0x00, 0xb5, 0x00, 0x8e,
+    0x00, 0x3c, 0x00, 0x15, 0x01, 0x0c, 0x00, 0x15, 0x00, 0x44, 0x00, 0x99, 0x01, 0xb5, 0x00, 0x99,
+    0x00, 0x11, 0x06, 0x00, 0x00, 0x04, 0x00, 0x7a, 0x00, 0xb5, 0x01, 0xa6, 0x00, 0xb5, 0x00, 0x35,
+    0x08, 0x00, 0x00, 0x74, 0x00, 0xb5, 0x01, 0xa6, 0x00, 0xb5, 0x00, 0x56, 0x03, 0x00, 0x00, 0x0c,
+    0x00, 0x90, 0x00, 0xb2, 0x02, 0xa6, 0x00, 0x17, 0x00, 0x00, 0x00, 0x4e, 0x01, 0xb5, 0x00, 0x65,
+    0x00, 0x1b, 0x03, 0x22, 0x00, 0x0c, 0x06, 0x00, 0x00, 0x33, 0x00, 0xa8, 0x00, 0xb5, 0x00, 0x73,
+    0x00, 0x15, 0x00, 0x48, 0x00, 0xab, 0x00, 0xb5, 0x00, 0x6f, 0x0b, 0x00, 0x00, 0x45, 0x01, 0xb5,
+    0x00, 0x5e, 0x04, 0x00, 0x00, 0x65, 0x00, 0xb6, 0x01, 0xa5, 0x00, 0xb6, 0x00, 0x22, 0x03, 0x00,
+    0x00, 0x07, 0x00, 0x89, 0x00, 0xb4, 0x00, 0xb5, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x54, 0x00, 0xb6,
+    0x01, 0xa5, 0x00, 0xb7, 0x00, 0x26, 0x00, 0x31, 0x00, 0x8b, 0x00, 0x7d, 0x00, 0x8b, 0x00, 0xa6,
+    0x00, 0xa5, 0x00, 0xa2, 0x00, 0x7d, 0x00, 0x83, 0x00, 0x76, 0x00, 0x19, 0x00, 0x82, 0x00, 0xb5,
+    0x00, 0xa5, 0x00, 0xab, 0x00, 0x6d, 0x00, 0x22, 0x00, 0x16, 0x00, 0x13, 0x00, 0x15, 0x00, 0x49,
+    0x00, 0x8f, 0x00, 0xb5, 0x00, 0xa5, 0x00, 0x9e, 0x00, 0x22, 0x00, 0x13, 0x00, 0x9d, 0x00, 0xb4,
+    0x00, 0x89, 0x00, 0x0c, 0x02, 0x00, 0x00, 0x12, 0x00, 0x9b, 0x00, 0xa5, 0x00, 0xab, 0x9a, 0x00,
+    0x00, 0x07, 0x00, 0x82, 0x00, 0xb5, 0x00, 0xb6, 0x00, 0x7a, 0x00, 0x07, 0x05, 0x00, 0x00, 0x0c,
+    0x00, 0x80, 0x00, 0xb6, 0x00, 0xbc, 0x00, 0x7b, 0x00, 0x05, 0x05, 0x00, 0x00, 0x45, 0x00, 0xb6,
+    0x01, 0xa5, 0x00, 0xa6, 0x00, 0xb5, 0x00, 0x35, 0x07, 0x00, 0x00, 0x3c, 0x00, 0xb5, 0x01, 0xa5,
+    0x00, 0xa6, 0x00, 0xb5, 0x00, 0x56, 0x03, 0x00, 0x00, 0x63, 0x00, 0xb5, 0x01, 0xa5, 0x01, 0xa6,
+    0x00, 0x17, 0x00, 0x00, 0x00, 0x4e, 0x01, 0xb5, 0x00, 0x4b, 0x0c, 0x00, 0x00, 0x46, 0x00, 0xb5,
+    0x00, 0xb6, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x19, 0x00, 0x99, 0x00, 0xb6, 0x00, 0x7c, 0x0b, 0x00,
+    0x00, 0x45, 0x01, 0xb5, 0x00, 0x5e, 0x03, 0x00, 0x00, 0x2a, 0x00, 0xaa, 0x02, 0xa5, 0x00, 0xb6,
+    0x00, 0x22, 0x03, 0x00, 0x00, 0x54, 0x00, 0xb6, 0x00, 0xa5, 0x00, 0xa0, 0x00, 0x11, 0x00, 0x1e,
+    0x00, 0xab, 0x02, 0xa5, 0x00, 0xb7, 0x00, 0x2e, 0x02, 0x00, 0x00, 0x24, 0x00, 0xb5, 0x00, 0xb2,
+    0x00, 0x7d, 0x02, 0x00, 0x00, 0x4f, 0x00, 0xb6, 0x00, 0xa5, 0x00, 0xa1, 0x00, 0x38, 0x05, 0x00,
+    0x00, 0x0c, 0x00, 0x7a, 0x00, 0xba, 0x00, 0xbb, 0x00, 0x81, 0x00, 0x0e, 0x00, 0x96, 0x00, 0xb4,
+    0x00, 0x89, 0x00, 0x0c, 0x02, 0x00, 0x00, 0x12, 0x00, 0x9b, 0x00, 0xa5, 0x00, 0xab, 0x9a, 0x00,
+    0x00, 0x30, 0x00, 0xb8, 0x00, 0xb2, 0x00, 0x89, 0x00, 0x06, 0x07, 0x00, 0x00, 0x0c, 0x00, 0x5f,
+    0x01, 0x67, 0x00, 0x0d, 0x04, 0x00, 0x00, 0x17, 0x00, 0xa0, 0x00, 0xa5, 0x00, 0xa9, 0x00, 0xa0,
+    0x00, 0xa5, 0x00, 0xb5, 0x00, 0x35, 0x06, 0x00, 0x00, 0x17, 0x00, 0x99, 0x00, 0xb4, 0x00, 0xa6,
+    0x00, 0xae, 0x00, 0xa6, 0x00, 0xb5, 0x00, 0x56, 0x02, 0x00, 0x00, 0x37, 0x00, 0xab, 0x00, 0xa5,
+    0x00, 0xab, 0x00, 0xa0, 0x00, 0xa5, 0x00, 0xa6, 0x00, 0x17, 0x00, 0x00, 0x00, 0x4e, 0x01, 0xb5,
+    0x00, 0x50, 0x0c, 0x00, 0x00, 0x13, 0x00, 0x9f, 0x00, 0xb4, 0x00, 0xa0, 0x00, 0x37, 0x00, 0x6b,
+    0x01, 0xb5, 0x00, 0x4f, 0x0b, 0x00, 0x00, 0x45, 0x01, 0xb5, 0x00, 0x5e, 0x02, 0x00, 0x00, 0x0c,
+    0x00, 0x90, 0x00, 0xb5, 0x01, 0xa8, 0x00, 0xa5, 0x00, 0xb6, 0x00, 0x22, 0x02, 0x00, 0x00, 0x28,
+    0x00, 0xab, 0x00, 0xa5, 0x00, 0xb6, 0x00, 0x45, 0x00, 0x05, 0x00, 0x89, 0x00, 0xb5, 0x01, 0xa8,
+    0x00, 0xa5, 0x00, 0xb7, 0x00, 0x2e, 0x02, 0x00, 0x00, 0x24, 0x00, 0xb5, 0x00, 0xa5, 0x00, 0x7d,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x17, 0x00, 0x99, 0x00, 0xb4, 0x00, 0xaa, 0x00, 0x3d, 0x07, 0x00,
+    0x00, 0x04, 0x01, 0x10, 0x00, 0x0a, 0x00, 0x19, 0x00, 0x9d, 0x00, 0xb4, 0x00, 0x89, 0x00, 0x0c,
+    0x02, 0x00, 0x00, 0x12, 0x00, 0x9b, 0x00, 0xa5, 0x00, 0xab, 0x9a, 0x00, 0x00, 0x7d, 0x00, 0xb2,
+    0x00, 0xb7, 0x00, 0x30, 0x12, 0x00, 0x00, 0x7a, 0x01, 0xb5, 0x00, 0x74, 0x00, 0x68, 0x00, 0xb4,
+    0x00, 0xb5, 0x00, 0x35, 0x06, 0x00, 0x00, 0x74, 0x00, 0xb5, 0x00, 0xb4, 0x00, 0x82, 0x00, 0x5c,
+    0x00, 0xb6, 0x00, 0xb5, 0x00, 0x56, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x99, 0x00, 0xa7, 0x00, 0xb5,
+    0x00, 0x60, 0x00, 0x75, 0x00, 0xb4, 0x00, 0xa6, 0x00, 0x17, 0x00, 0x00, 0x00, 0x4e, 0x01, 0xb5,
+    0x00, 0x4b, 0x0d, 0x00, 0x00, 0x4d, 0x00, 0xa8, 0x00, 0xa5, 0x00, 0xb7, 0x00, 0xb5, 0x00, 0xa5,
+    0x00, 0x99, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x44, 0x00, 0x5a, 0x00, 0x62, 0x00, 0x16, 0x06, 0x00,
+    0x00, 0x45, 0x01, 0xb5, 0x00, 0x5e, 0x02, 0x00, 0x00, 0x5c, 0x00, 0xb5, 0x00, 0xa5, 0x00, 0x92,
+    0x00, 0x8b, 0x00, 0xa5, 0x00, 0xb6, 0x00, 0x22, 0x01, 0x00, 0x00, 0x04, 0x00, 0x89, 0x01, 0xb5,
+    0x00, 0x7b, 0x00, 0x00, 0x00, 0x4d, 0x00, 0xb6, 0x00, 0xa5, 0x00, 0x92, 0x00, 0x8d, 0x00, 0xa5,
+    0x00, 0xb7, 0x00, 0x2e, 0x02, 0x00, 0x00, 0x24, 0x00, 0xb5, 0x00, 0xa5, 0x00, 0x7d, 0x00, 0x04,
+    0x00, 0x00, 0x00, 0x3b, 0x00, 0xb7, 0x00, 0xb5, 0x00, 0x7b, 0x0c, 0x00, 0x00, 0x19, 0x00, 0x9d,
+    0x00, 0xb4, 0x00, 0x89, 0x00, 0x05, 0x02, 0x00, 0x00, 0x0d, 0x00, 0x9b, 0x00, 0xa5, 0x00, 0xab,
+    0x9a, 0x00, 0x00, 0xb1, 0x00, 0xa5, 0x00, 0x9b, 0x00, 0x0c, 0x11, 0x00, 0x00, 0x49, 0x00, 0xb6,
+    0x00, 0xa5, 0x00, 0xab, 0x00, 0x1f, 0x00, 0x66, 0x01, 0xb5, 0x00, 0x35, 0x05, 0x00, 0x00, 0x45,
+    0x00, 0xb7, 0x00, 0xa5, 0x00, 0xab, 0x00, 0x1d, 0x00, 0x41, 0x00, 0xb6, 0x00, 0xb5, 0x00, 0x56,
+    0x00, 0x00, 0x00, 0x04, 0x00, 0x6d, 0x01, 0xb5, 0x00, 0x90, 0x00, 0x18, 0x00, 0x7b, 0x00, 0xb2,
+    0x00, 0xa6, 0x00, 0x17, 0x00, 0x00, 0x00, 0x4e, 0x00, 0xb5, 0x00, 0xa5, 0x00, 0x83, 0x00, 0x4f,
+    0x02, 0x5e, 0x00, 0x67, 0x00, 0x25, 0x07, 0x00, 0x00, 0x04, 0x00, 0x86, 0x00, 0xb5, 0x01, 0xa5,
+    0x00, 0x97, 0x00, 0x19, 0x00, 0x00, 0x00, 0x13, 0x00, 0x9f, 0x00, 0xbd, 0x00, 0x99, 0x00, 0x11,
+    0x06, 0x00, 0x00, 0x45, 0x01, 0xb5, 0x00, 0x5e, 0x01, 0x00, 0x00, 0x30, 0x00, 0xab, 0x00, 0xa5,
+    0x00, 0xb7, 0x00, 0x30, 0x00, 0x76, 0x00, 0xb4, 0x00, 0xb6, 0x00, 0x22, 0x01, 0x00, 0x00, 0x54,
+    0x00, 0xb6, 0x00, 0xb2, 0x00, 0xa0, 0x00, 0x11, 0x00, 0x24, 0x00, 0xab, 0x00, 0xa5, 0x00, 0xb6,
+    0x00, 0x3c, 0x00, 0x70, 0x00, 0xb5, 0x00, 0xb7, 0x00, 0x2e, 0x02, 0x00, 0x00, 0x24, 0x00, 0xb5,
+    0x00, 0xa5, 0x00, 0x7d, 0x00, 0x01, 0x00, 0x00, 0x00, 0x6e, 0x00, 0xb4, 0x00, 0xb6, 0x00, 0x30,
+    0x0c, 0x00, 0x00, 0x19, 0x00, 0x9d, 0x00, 0xb2, 0x00, 0xa0, 0x00, 0x49, 0x00, 0x4a, 0x00, 0x4b,
+    0x00, 0x4a, 0x00, 0x49, 0x00, 0xa0, 0x00, 0xa5, 0x00, 0xab, 0x9a, 0x00, 0x00, 0xa9, 0x00, 0xb4,
+    0x00, 0x72, 0x00, 0x01, 0x04, 0x00, 0x00, 0x20, 0x06, 0x25, 0x00, 0x21, 0x02, 0x00, 0x00, 0x17,
+    0x00, 0xa0, 0x00, 0xa5, 0x00, 0xb6, 0x00, 0x54, 0x00, 0x00, 0x00, 0x70, 0x01, 0xb5, 0x00, 0x35,
+    0x04, 0x00, 0x00, 0x11, 0x00, 0x99, 0x00, 0xb2, 0x00, 0xb6, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x4c,
+    0x00, 0xb6, 0x00, 0xb5, 0x00, 0x56, 0x00, 0x00, 0x00, 0x30, 0x00, 0xab, 0x00, 0xa5, 0x00, 0xb7,
+    0x00, 0x37, 0x00, 0x04, 0x00, 0x8b, 0x00, 0xb2, 0x00, 0xa6, 0x00, 0x17, 0x00, 0x00, 0x00, 0x4e,
+    0x00, 0xb5, 0x00, 0xa6, 0x00, 0xa5, 0x03, 0xb5, 0x00, 0xbc, 0x00, 0x56, 0x06, 0x00, 0x00, 0x04,
+    0x00, 0x6b, 0x01, 0xa8, 0x00, 0xb6, 0x00, 0xa5, 0x00, 0x9d, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x4d,
+    0x00, 0xb6, 0x00, 0xb5, 0x00, 0x4f, 0x07, 0x00, 0x00, 0x45, 0x01, 0xb5, 0x00, 0x5e, 0x00, 0x00,
+    0x00, 0x0a, 0x00, 0x90, 0x00, 0xb2, 0x00, 0xb5, 0x00, 0x6d, 0x00, 0x05, 0x00, 0x84, 0x00, 0xa5,
+    0x00, 0xb6, 0x00, 0x22, 0x00, 0x00, 0x00, 0x24, 0x00, 0xab, 0x00, 0xa5, 0x00, 0xb6, 0x00, 0x44,
+    0x00, 0x00, 0x00, 0x89, 0x00, 0xb4, 0x00, 0xb5, 0x00, 0x7b, 0x00, 0x04, 0x00, 0x7d, 0x00, 0xb5,
+    0x00, 0xb7, 0x00, 0x2e, 0x02, 0x00, 0x00, 0x24, 0x00, 0xb5, 0x00, 0xa5, 0x00, 0x7d, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x8c, 0x00, 0xa5, 0x00, 0xb9, 0x00, 0x15, 0x0c, 0x00, 0x00, 0x19, 0x00, 0x9d,
+    0x00, 0xa6, 0x00, 0xa5, 0x04, 0xb5, 0x01, 0xa5, 0x00, 0xab, 0x9a, 0x00, 0x00, 0xa9, 0x00, 0xb4,
+    0x00, 0x72, 0x00, 0x01, 0x03, 0x00, 0x00, 0x02, 0x00, 0x99, 0x06, 0xa8, 0x00, 0xa3, 0x00, 0x06,
+    0x00, 0x00, 0x00, 0x05, 0x00, 0x7b, 0x01, 0xb5, 0x00, 0x7a, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6f,
+    0x01, 0xb5, 0x00, 0x35, 0x04, 0x00, 0x00, 0x74, 0x00, 0xb5, 0x00, 0xb4, 0x00, 0x90, 0x00, 0x05,
+    0x00, 0x00, 0x00, 0x4c, 0x00, 0xb6, 0x00, 0xb5, 0x00, 0x51, 0x00, 0x0c, 0x00, 0x9a, 0x00, 0xa5,
+    0x00, 0xb5, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x08, 0x00, 0x8b, 0x00, 0xb2, 0x00, 0xa6, 0x00, 0x17,
+    0x00, 0x00, 0x00, 0x4e, 0x00, 0xb5, 0x00, 0xa6, 0x00, 0xa5, 0x03, 0xb5, 0x00, 0xbd, 0x00, 0x57,
+    0x05, 0x00, 0x00, 0x04, 0x00, 0x6b, 0x00, 0xbc, 0x00, 0xb5, 0x00, 0x98, 0x00, 0x64, 0x00, 0xa0,
+    0x00, 0xb4, 0x00, 0xb5, 0x00, 0x65, 0x00, 0x86, 0x00, 0xb4, 0x00, 0xa0, 0x00, 0x0c, 0x07, 0x00,
+    0x00, 0x45, 0x01, 0xb5, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x64, 0x00, 0xb6, 0x00, 0xa5, 0x00, 0x99,
+    0x00, 0x0b, 0x00, 0x00, 0x00, 0x8c, 0x00, 0xa5, 0x00, 0xb6, 0x00, 0x1d, 0x00, 0x08, 0x00, 0x89,
+    0x00, 0xb4, 0x00, 0xb5, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x54, 0x00, 0xb6, 0x00, 0xa5, 0x00, 0xa0,
+    0x00, 0x11, 0x00, 0x00, 0x00, 0x7e, 0x00, 0xb5, 0x00, 0xb7, 0x00, 0x2e, 0x02, 0x00, 0x00, 0x24,
+    0x00, 0xb5, 0x00, 0xa5, 0x00, 0x7d, 0x00, 0x01, 0x00, 0x00, 0x00, 0x8d, 0x00, 0xa5, 0x00, 0xb9,
+    0x00, 0x15, 0x0c, 0x00, 0x00, 0x19, 0x00, 0x9d, 0x00, 0xa6, 0x00, 0xa5, 0x04, 0xb5, 0x01, 0xa5,
+    0x00, 0xab, 0x9a, 0x00, 0x00, 0xb0, 0x00, 0xa5, 0x00, 0x9b, 0x00, 0x0c, 0x03, 0x00, 0x00, 0x02,
+    0x00, 0xab, 0x00, 0xb6, 0x01, 0xb5, 0x00, 0xb6, 0x00, 0xb5, 0x00, 0xa6, 0x00, 0xa5, 0x00, 0x9c,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x44, 0x00, 0xb6, 0x00, 0xa5, 0x00, 0xab, 0x00, 0x4b, 0x00, 0x32,
+    0x00, 0x2b, 0x00, 0x83, 0x00, 0xa5, 0x00, 0xb5, 0x00, 0x35, 0x03, 0x00, 0x00, 0x3d, 0x00, 0xb6,
+    0x00, 0xa5, 0x00, 0xab, 0x00, 0x30, 0x01, 0x00, 0x00, 0x4c, 0x00, 0xb6, 0x00, 0xb5, 0x00, 0x47,
+    0x00, 0x52, 0x00, 0xb6, 0x00, 0xb5, 0x00, 0x99, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x8b,
+    0x00, 0xb2, 0x00, 0xa6, 0x00, 0x17, 0x00, 0x00, 0x00, 0x4e, 0x01, 0xb5, 0x00, 0x75, 0x00, 0x36,
+    0x00, 0x45, 0x01, 0x3d, 0x00, 0x45, 0x00, 0x1f, 0x05, 0x00, 0x00, 0x24, 0x00, 0xb8, 0x00, 0xb2,
+    0x00, 0x99, 0x00, 0x15, 0x00, 0x00, 0x00, 0x39, 0x00, 0xa0, 0x00, 0xb4, 0x02, 0xb5, 0x00, 0x54,
+    0x08, 0x00, 0x00, 0x45, 0x01, 0xb5, 0x00, 0x4b, 0x00, 0x28, 0x00, 0xaa, 0x00, 0xa5, 0x00, 0xab,
+    0x00, 0x3d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x8c, 0x00, 0xa5, 0x00, 0xb6, 0x00, 0x14, 0x00, 0x48,
+    0x00, 0xb6, 0x00, 0xa5, 0x00, 0xa0, 0x00, 0x13, 0x00, 0x1e, 0x00, 0xab, 0x00, 0xa5, 0x00, 0xab,
+    0x00, 0x51, 0x01, 0x07, 0x00, 0x7e, 0x00, 0xb5, 0x00, 0xb7, 0x00, 0x2e, 0x02, 0x00, 0x00, 0x24,
+    0x00, 0xb5, 0x00, 0xa5, 0x00, 0x7d, 0x00, 0x01, 0x00, 0x00, 0x00, 0x6f, 0x00, 0xb4, 0x00, 0xb6,
+    0x00, 0x2f, 0x0c, 0x00, 0x00, 0x19, 0x00, 0x9d, 0x00, 0xb2, 0x00, 0xa0, 0x01, 0x4b, 0x00, 0x4f,
+    0x00, 0x4b, 0x00, 0x4f, 0x00, 0xa0, 0x00, 0xa5, 0x00, 0xab, 0x9a, 0x00, 0x00, 0x85, 0x00, 0xb2,
+    0x00, 0xb7, 0x00, 0x2f, 0x04, 0x00, 0x00, 0x5c, 0x00, 0x6a, 0x00, 0x62, 0x00, 0x6a, 0x00, 0x59,
+    0x00, 0x8f, 0x00, 0xa8, 0x00, 0xb5, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x1e, 0x00, 0xae, 0x00, 0xa5,
+    0x01, 0xa6, 0x02, 0xa8, 0x01, 0xa6, 0x00, 0xb5, 0x00, 0x35, 0x02, 0x00, 0x00, 0x13, 0x00, 0xa0,
+    0x00, 0xa5, 0x00, 0xb6, 0x00, 0x5c, 0x02, 0x00, 0x00, 0x4c, 0x00, 0xb6, 0x00, 0xa5, 0x00, 0x85,
+    0x00, 0xa0, 0x00, 0xa5, 0x00, 0xb7, 0x00, 0x38, 0x01, 0x00, 0x00, 0x08, 0x00, 0x8b, 0x00, 0xb2,
+    0x00, 0xa6, 0x00, 0x17, 0x00, 0x00, 0x00, 0x4e, 0x01, 0xb5, 0x00, 0x4b, 0x0b, 0x00, 0x00, 0x5e,
+    0x00, 0xb4, 0x00, 0xb7, 0x00, 0x2f, 0x02, 0x00, 0x00, 0x24, 0x00, 0x8e, 0x00, 0xa6, 0x00, 0xa5,
+    0x00, 0xb9, 0x00, 0x24, 0x08, 0x00, 0x00, 0x45, 0x01, 0xb5, 0x00, 0x57, 0x00, 0x82, 0x00, 0xb4,
+    0x00, 0xb5, 0x00, 0x6c, 0x01, 0x00, 0x00, 0x01, 0x00, 0x8c, 0x00, 0xa5, 0x00, 0xab, 0x00, 0x4f,
+    0x00, 0xa0, 0x00, 0xa5, 0x00, 0xb6, 0x00, 0x44, 0x00, 0x01, 0x00, 0x89, 0x00, 0xb5, 0x00, 0xa5,
+    0x00, 0xa8, 0x00, 0x93, 0x01, 0x9c, 0x00, 0xab, 0x00, 0xa5, 0x00, 0xb7, 0x00, 0x2e, 0x02, 0x00,
+    0x00, 0x24, 0x00, 0xb5, 0x00, 0xa5, 0x00, 0x7d, 0x00, 0x04, 0x00, 0x00, 0x00, 0x3b, 0x00, 0xb6,
+    0x00, 0xb5, 0x00, 0x75, 0x0c, 0x00, 0x00, 0x19, 0x00, 0x9d, 0x00, 0xb4, 0x00, 0x89, 0x00, 0x08,
+    0x02, 0x00, 0x00, 0x0d, 0x00, 0x9b, 0x00, 0xa5, 0x00, 0xab, 0x9a, 0x00, 0x00, 0x37, 0x00, 0xb7,
+    0x00, 0xb2, 0x00, 0x89, 0x00, 0x03, 0x07, 0x00, 0x00, 0x04, 0x00, 0x87, 0x00, 0xb4, 0x00, 0xab,
+    0x00, 0x28, 0x00, 0x00, 0x00, 0x79, 0x00, 0xb5, 0x00, 0xa5, 0x04, 0xb5, 0x00, 0xa5, 0x00, 0xa6,
+    0x00, 0xb5, 0x00, 0x35, 0x01, 0x00, 0x00, 0x03, 0x00, 0x74, 0x00, 0xb5, 0x00, 0xb4, 0x00, 0x90,
+    0x00, 0x08, 0x02, 0x00, 0x00, 0x4c, 0x00, 0xb6, 0x00, 0xa6, 0x00, 0xb5, 0x00, 0xa6, 0x00, 0xb6,
+    0x00, 0x6d, 0x02, 0x00, 0x00, 0x08, 0x00, 0x8b, 0x00, 0xb2, 0x00, 0xa6, 0x00, 0x17, 0x00, 0x00,
+    0x00, 0x4e, 0x01, 0xb5, 0x00, 0x4f, 0x0b, 0x00, 0x00, 0x76, 0x00, 0xb4, 0x00, 0xae, 0x00, 0x24,
+    0x03, 0x00, 0x00, 0x45, 0x00, 0xb7, 0x00, 0xa5, 0x00, 0xa8, 0x00, 0x89, 0x00, 0x0b, 0x07, 0x00,
+    0x00, 0x45, 0x00, 0xb5, 0x00, 0xa6, 0x00, 0xa0, 0x00, 0xa8, 0x00, 0xa5, 0x00, 0x9a, 0x00, 0x12,
+    0x01, 0x00, 0x00, 0x01, 0x00, 0x8c, 0x00, 0xa5, 0x00, 0xa8, 0x00, 0xac, 0x00, 0xa5, 0x00, 0xb5,
+    0x00, 0x7a, 0x00, 0x00, 0x00, 0x54, 0x00, 0xb5, 0x00, 0xa6, 0x06, 0xa5, 0x00, 0xb7, 0x00, 0x2e,
+    0x02, 0x00, 0x00, 0x24, 0x00, 0xb5, 0x00, 0xa5, 0x00, 0x7d, 0x00, 0x04, 0x00, 0x00, 0x00, 0x17,
+    0x00, 0xa0, 0x00, 0xb4, 0x00, 0xa9, 0x00, 0x31, 0x07, 0x00, 0x00, 0x01, 0x01, 0x0c, 0x00, 0x0b,
+    0x00, 0x1a, 0x00, 0x9d, 0x00, 0xb4, 0x00, 0x89, 0x00, 0x0c, 0x02, 0x00, 0x00, 0x12, 0x00, 0x9b,
+    0x00, 0xa5, 0x00, 0xab, 0x9a, 0x00, 0x00, 0x08, 0x00, 0x89, 0x01, 0xb5, 0x00, 0x74, 0x00, 0x04,
+    0x05, 0x00, 0x00, 0x06, 0x00, 0x78, 0x01, 0xb5, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x49, 0x00, 0xb7,
+    0x00, 0xa5, 0x00, 0xa9, 0x03, 0x63, 0x00, 0x5b, 0x00, 0x99, 0x00, 0xa5, 0x00, 0xb5, 0x00, 0x35,
+    0x01, 0x00, 0x00, 0x3d, 0x00, 0xb7, 0x00, 0xa5, 0x00, 0xab, 0x00, 0x29, 0x03, 0x00, 0x00, 0x4c,
+    0x00, 0xb6, 0x00, 0xa6, 0x00, 0xa5, 0x00, 0xb4, 0x00, 0x90, 0x00, 0x0b, 0x02, 0x00, 0x00, 0x08,
+    0x00, 0x8b, 0x00, 0xb2, 0x00, 0xa6, 0x00, 0x17, 0x00, 0x00, 0x00, 0x4e, 0x01, 0xb5, 0x00, 0x4b,
+    0x0b, 0x00, 0x00, 0x4f, 0x00, 0xb5, 0x00, 0xb7, 0x00, 0x37, 0x02, 0x00, 0x00, 0x04, 0x00, 0x81,
+    0x00, 0xb4, 0x02, 0xb5, 0x00, 0x90, 0x00, 0x11, 0x06, 0x00, 0x00, 0x45, 0x00, 0xb5, 0x00, 0xa6,
+    0x01, 0xa5, 0x00, 0xab, 0x00, 0x38, 0x02, 0x00, 0x00, 0x01, 0x00, 0x8c, 0x02, 0xa5, 0x00, 0xb4,
+    0x00, 0x99, 0x00, 0x11, 0x00, 0x1f, 0x00, 0xab, 0x00, 0xa5, 0x00, 0xb5, 0x04, 0xae, 0x00, 0xa9,
+    0x00, 0xa5, 0x00, 0xb7, 0x00, 0x2e, 0x02, 0x00, 0x00, 0x24, 0x00, 0xb5, 0x00, 0xa5, 0x00, 0x7d,
+    0x00, 0x04, 0x01, 0x00, 0x00, 0x5c, 0x00, 0xb6, 0x00, 0xa5, 0x00, 0x99, 0x00, 0x2a, 0x05, 0x00,
+    0x00, 0x04, 0x00, 0x6d, 0x00, 0xb1, 0x00, 0xa4, 0x00, 0x82, 0x00, 0x13, 0x00, 0x96, 0x00, 0xb4,
+    0x00, 0x89, 0x00, 0x0c, 0x02, 0x00, 0x00, 0x12, 0x00, 0x9b, 0x00, 0xa5, 0x00, 0xab, 0x9b, 0x00,
+    0x00, 0x1f, 0x00, 0x9e, 0x00, 0xa5, 0x00, 0xb6, 0x00, 0x81, 0x00, 0x2f, 0x00, 0x12, 0x01, 0x08,
+    0x00, 0x12, 0x00, 0x37, 0x00, 0x86, 0x00, 0xb5, 0x00, 0xa5, 0x00, 0x99, 0x00, 0x11, 0x00, 0x17,
+    0x00, 0xa0, 0x00, 0xa5, 0x00, 0xb6, 0x00, 0x54, 0x04, 0x00, 0x00, 0x70, 0x01, 0xb5, 0x00, 0x35,
+    0x00, 0x00, 0x00, 0x17, 0x00, 0xa0, 0x00, 0xa5, 0x00, 0xb5, 0x00, 0x5c, 0x04, 0x00, 0x00, 0x4c,
+    0x00, 0xb6, 0x00, 0xa6, 0x00, 0xa5, 0x00, 0xb7, 0x00, 0x38, 0x03, 0x00, 0x00, 0x08, 0x00, 0x8b,
+    0x00, 0xb2, 0x00, 0xa6, 0x00, 0x17, 0x00, 0x00, 0x00, 0x4e, 0x00, 0xb5, 0x00, 0xa5, 0x00, 0x9b,
+    0x00, 0x7d, 0x02, 0x83, 0x00, 0x8b, 0x00, 0x3a, 0x05, 0x00, 0x00, 0x1e, 0x00, 0xb8, 0x00, 0xa5,
+    0x00, 0x97, 0x00, 0x28, 0x00, 0x16, 0x00, 0x15, 0x00, 0x6c, 0x00, 0xb6, 0x00, 0xb5, 0x00, 0x7b,
+    0x00, 0x7c, 0x01, 0xb5, 0x00, 0x8e, 0x00, 0x24, 0x05, 0x00, 0x00, 0x45, 0x00, 0xb5, 0x01, 0xa6,
+    0x00, 0xb5, 0x00, 0x6d, 0x00, 0x01, 0x02, 0x00, 0x00, 0x01, 0x00, 0x8c, 0x00, 0xa5, 0x00, 0xa6,
+    0x00, 0xa5, 0x00, 0xb7, 0x00, 0x45, 0x00, 0x04, 0x00, 0x89, 0x00, 0xb4, 0x00, 0xb5, 0x00, 0x7a,
+    0x00, 0x10, 0x02, 0x0f, 0x00, 0x10, 0x00, 0x83, 0x00, 0xb3, 0x00, 0xb7, 0x00, 0x2e, 0x02, 0x00,
+    0x00, 0x24, 0x00, 0xb5, 0x00, 0xa5, 0x00, 0x7d, 0x00, 0x04, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x89,
+    0x00, 0xb5, 0x00, 0xa5, 0x00, 0xab, 0x00, 0x5c, 0x00, 0x15, 0x00, 0x12, 0x00, 0x0c, 0x00, 0x16,
+    0x00, 0x37, 0x00, 0x86, 0x00, 0xb6, 0x00, 0xa5, 0x00, 0xa8, 0x00, 0x37, 0x00, 0x13, 0x00, 0x9d,
+    0x00, 0xb4, 0x00, 0x89, 0x00, 0x0c, 0x02, 0x00, 0x00, 0x12, 0x00, 0x9b, 0x00, 0xa5, 0x00, 0xab,
+    0x9c, 0x00, 0x00, 0x31, 0x00, 0x9e, 0x00, 0xb5, 0x00, 0xb4, 0x00, 0xb7, 0x00, 0xa2, 0x00, 0x7b,
+    0x00, 0x82, 0x00, 0xa2, 0x00, 0xb6, 0x00, 0xb4, 0x00, 0xb6, 0x00, 0x99, 0x00, 0x1c, 0x00, 0x04,
+    0x00, 0x82, 0x01, 0xb5, 0x00, 0x81, 0x00, 0x06, 0x04, 0x00, 0x00, 0x70, 0x00, 0xb4, 0x00, 0xb5,
+    0x00, 0x2e, 0x00, 0x00, 0x00, 0x73, 0x00, 0xb5, 0x00, 0xb2, 0x00, 0x90, 0x00, 0x07, 0x04, 0x00,
+    0x00, 0x4c, 0x00, 0xb5, 0x00, 0xa5, 0x00, 0xb5, 0x00, 0x63, 0x04, 0x00, 0x00, 0x08, 0x00, 0x8b,
+    0x00, 0xb2, 0x00, 0xa6, 0x00, 0x17, 0x00, 0x00, 0x00, 0x4f, 0x00, 0xb4, 0x01, 0xa5, 0x03, 0xb4,
+    0x00, 0xb6, 0x00, 0x57, 0x05, 0x00, 0x00, 0x04, 0x00, 0x65, 0x00, 0xbc, 0x00, 0xb2, 0x00, 0xb6,
+    0x00, 0xaf, 0x00, 0xb9, 0x00, 0xb5, 0x00, 0xb4, 0x00, 0x97, 0x00, 0x11, 0x00, 0x04, 0x00, 0x7b,
+    0x00, 0xb6, 0x00, 0xb4, 0x00, 0x8a, 0x00, 0x09, 0x04, 0x00, 0x00, 0x45, 0x00, 0xb5, 0x00, 0xa6,
+    0x00, 0xa7, 0x00, 0x99, 0x00, 0x0c, 0x03, 0x00, 0x00, 0x01, 0x00, 0x8c, 0x00, 0xa5, 0x00, 0xa6,
+    0x00, 0xb5, 0x00, 0x73, 0x00, 0x00, 0x00, 0x54, 0x00, 0xb6, 0x00, 0xb2, 0x00, 0xa0, 0x00, 0x13,
+    0x04, 0x00, 0x00, 0x7d, 0x00, 0xb5, 0x00, 0xb7, 0x00, 0x2e, 0x02, 0x00, 0x00, 0x24, 0x00, 0xb5,
+    0x00, 0xa5, 0x00, 0x7d, 0x00, 0x04, 0x02, 0x00, 0x00, 0x10, 0x00, 0x91, 0x00, 0xb6, 0x00, 0xb2,
+    0x00, 0xb5, 0x00, 0xb8, 0x01, 0x9b, 0x00, 0xae, 0x00, 0xb6, 0x00, 0xb4, 0x00, 0xb5, 0x00, 0xa8,
+    0x00, 0x4b, 0x00, 0x00, 0x00, 0x19, 0x00, 0x9d, 0x00, 0xb4, 0x00, 0x89, 0x00, 0x0c, 0x02, 0x00,
+    0x00, 0x12, 0x00, 0x9b, 0x00, 0xa5, 0x00, 0xab, 0x9d, 0x00, 0x00, 0x17, 0x00, 0x81, 0x00, 0xb7,
+    0x00, 0xb4, 0x00, 0xa5, 0x01, 0xb4, 0x00, 0xa5, 0x00, 0xb4, 0x00, 0xb7, 0x00, 0x7a, 0x00, 0x15,
+    0x00, 0x00, 0x00, 0x55, 0x00, 0xbf, 0x00, 0xbe, 0x00, 0xae, 0x00, 0x24, 0x05, 0x00, 0x00, 0x76,
+    0x00, 0xbf, 0x00, 0xc1, 0x00, 0x26, 0x00, 0x3b, 0x00, 0xc2, 0x00, 0xbe, 0x00, 0xae, 0x00, 0x29,
+    0x05, 0x00, 0x00, 0x53, 0x00, 0xc4, 0x00, 0xbe, 0x00, 0x92, 0x00, 0x12, 0x04, 0x00, 0x00, 0x08,
+    0x00, 0x93, 0x00, 0xbe, 0x00, 0xb8, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x4f, 0x00, 0xc3, 0x05, 0xb8,
+    0x00, 0xbf, 0x00, 0x57, 0x06, 0x00, 0x00, 0x03, 0x00, 0x65, 0x00, 0xab, 0x00, 0xb6, 0x00, 0xb2,
+    0x00, 0xb4, 0x00, 0xb8, 0x00, 0x90, 0x00, 0x1e, 0x01, 0x00, 0x00, 0x04, 0x00, 0x75, 0x00, 0xa2,
+    0x00, 0x1f, 0x05, 0x00, 0x00, 0x49, 0x00, 0xb4, 0x00, 0xa5, 0x00, 0xb7, 0x00, 0x38, 0x04, 0x00,
+    0x00, 0x04, 0x00, 0x8d, 0x00, 0xb2, 0x00, 0xb4, 0x00, 0xa0, 0x00, 0x13, 0x00, 0x27, 0x00, 0xab,
+    0x00, 0xb2, 0x00, 0xb6, 0x00, 0x45, 0x05, 0x00, 0x00, 0x7e, 0x00, 0xb4, 0x00, 0xbc, 0x00, 0x2e,
+    0x02, 0x00, 0x00, 0x28, 0x00, 0xb4, 0x00, 0xb2, 0x00, 0x83, 0x00, 0x04, 0x03, 0x00, 0x00, 0x0b,
+    0x00, 0x63, 0x00, 0xab, 0x00, 0xb5, 0x03, 0xa5, 0x00, 0xb2, 0x00, 0xb7, 0x00, 0x88, 0x00, 0x29,
+    0x01, 0x00, 0x00, 0x19, 0x00, 0x9d, 0x00, 0xb4, 0x00, 0x89, 0x00, 0x0d, 0x02, 0x00, 0x00, 0x12,
+    0x00, 0xa2, 0x00, 0xb2, 0x00, 0xb6, 0x9e, 0x00, 0x00, 0x04, 0x00, 0x2e, 0x00, 0x6e, 0x00, 0xb1,
+    0x00, 0xa9, 0x00, 0xab, 0x00, 0xa4, 0x00, 0x65, 0x00, 0x28, 0x02, 0x00, 0x00, 0x2e, 0x00, 0x2c,
+    0x00, 0x2e, 0x00, 0x24, 0x06, 0x00, 0x00, 0x1e, 0x00, 0x2c, 0x00, 0x2e, 0x00, 0x07, 0x00, 0x1e,
+    0x00, 0x2d, 0x00, 0x2e, 0x00, 0x22, 0x06, 0x00, 0x00, 0x15, 0x00, 0x2e, 0x00, 0x2d, 0x00, 0x1e,
+    0x06, 0x00, 0x00, 0x22, 0x00, 0x2d, 0x00, 0x2e, 0x00, 0x04, 0x00, 0x00, 0x00, 0x11, 0x06, 0x2e,
+    0x00, 0x2c, 0x00, 0x11, 0x08, 0x00, 0x00, 0x23, 0x00, 0x49, 0x00, 0x70, 0x00, 0x5d, 0x00, 0x35,
+    0x00, 0x0c, 0x03, 0x00, 0x00, 0x06, 0x00, 0x1f, 0x06, 0x00, 0x00, 0x3a, 0x00, 0x95, 0x00, 0x94,
+    0x00, 0x5e, 0x06, 0x00, 0x00, 0x69, 0x00, 0x94, 0x00, 0x95, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x77,
+    0x00, 0x94, 0x00, 0x93, 0x00, 0x67, 0x06, 0x00, 0x00, 0x58, 0x00, 0x94, 0x00, 0x95, 0x00, 0x24,
+    0x02, 0x00, 0x00, 0x1f, 0x00, 0x95, 0x00, 0x93, 0x00, 0x61, 0x06, 0x00, 0x00, 0x22, 0x00, 0x54,
+    0x00, 0x9c, 0x00, 0xad, 0x00, 0xa9, 0x00, 0xb1, 0x00, 0x7d, 0x00, 0x35, 0x00, 0x08, 0x02, 0x00,
+    0x00, 0x13, 0x00, 0x85, 0x00, 0x94, 0x00, 0x71, 0x00, 0x04, 0x02, 0x00, 0x00, 0x08, 0x00, 0x7f,
+    0x00, 0x93, 0x00, 0x8d, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
+    0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x4e, 0x00,
 #else
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x8184,0xAAE7,0xCC6A,0xD488,0xD489,0xCC6A,0xA2C6,0x8164,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0xB368,0xCC6A,0xCC6B,0x81A5,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0xAB49,0xCC6A,0xCC6B,0x9247,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x68A2,0xC3E9,0xCC4A,0xCC4A,0x7103,0x6000,0x9267,0xCC6B,0xC42A,0xC42A,0xC42A,0xC42A,0xC42A,0xC42A,0xCC6B,0x9247,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x70C2,0x91E4,0xA2A6,0x9225,0x7943,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x70C2,0x89C4,0x89A3,0x70E2,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x8184,0x89A3,0x89C4,0x6881,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6041,0x89A4,0x89A4,0x89C3,0x7923,0x6000,0x8163,0x89C3,0x89C4,0x6881,0x70C2,0x89C3,0x89C4,0x89C4,0x89C4,0x89C4,0x89C4,0x89C4,0x89A4,0x8183,0x6841,0x6000,0x6000,0x6000,0x7943,0x9A45,0xC42A,0xD4A9,0xD489,0xD48A,0xAB27,0x89A4,0x6020,0x6000,0x6000,0x6000,0x6861,0x89A3,0x89C4,0x8163,0x6020,0x6000,0x6000,0x6000,0x6041,0x8183,0x89A3,0x89A4,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x70E2,0xBB88,0xD488,0xDC67,0xD446,0xD446,0xD446,0xD446,0xDC67,0xD468,0xB347,0x70C2,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A66,0xDC67,0xD446,0xDC66,0x89E4,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9246,0xDC88,0xD446,0xDC67,0xAB28,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xAB27,0xDC87,0xD446,0xD447,0x7944,0x6000,0xA2C7,0xDC66,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xDC87,0xA308,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x7943,0xCC28,0xDC88,0xDC66,0xE487,0xD468,0x9225,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9AA7,0xE4C8,0xE4C8,0xAB28,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x89E5,0xDCA9,0xE4A8,0xE4E9,0x8163,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xA2E7,0xE4C9,0xE4A8,0xDCC9,0x7923,0x8184,0xD489,0xE4A8,0xECE9,0x8183,0x9A86,0xE4C8,0xDCA8,0xDCA8,0xDCA8,0xDCA8,0xDCA8,0xDCA8,0xE4A8,0xD4AA,0x7944,0x6000,0x6881,0xA2C6,0xD448,0xDC87,0xD446,0xD446,0xD446,0xD446,0xDC66,0xDC88,0xBBA8,0x7923,0x6000,0x6000,0x7944,0xD488,0xE4C8,0xCC29,0x68A2,0x6000,0x6000,0x6000,0x70E3,0xD48A,0xE4A8,0xDCC9,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x7943,0xCC27,0xDC87,0xDC66,0xDC67,0xD489,0xCC29,0xCC49,0xD4A9,0xDC67,0xDC66,0xDC87,0xCC28,0x78E2,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x7923,0xD468,0xD446,0xD447,0xDC67,0x89C4,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x70C2,0xCC28,0xDC46,0xD447,0xDC67,0xA308,0x6000,0x6000,0x6000,0x6000,0x6000,0x89E5,0xDC88,0xD446,0xD447,0xD447,0x7923,0x6000,0xA2A7,0xDC67,0xD447,0xDC67,0xDC87,0xDC87,0xDC87,0xDC87,0xE4A8,0xA308,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6041,0xCC28,0xDC67,0xD467,0xDCA8,0xDC87,0xD446,0xDCA8,0x8184,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A66,0xDC67,0xDC67,0xAB28,0x6000,0x6000,0x6000,0x6000,0x6000,0x6881,0xC3E8,0xDC66,0xD446,0xDC87,0x8143,0x6000,0x6000,0x6000,0x6000,0x6000,0x8184,0xDC68,0xD446,0xDC67,0x9245,0x6020,0xC3C8,0xDC66,0xD446,0xDC87,0x8163,0x9A86,0xE487,0xDC66,0xDC46,0xD446,0xD446,0xD446,0xDC66,0xDC66,0xD4A9,0x7903,0x70A2,0xC409,0xDC87,0xDC66,0xDC67,0xDC88,0xD4A9,0xD48A,0xDCA9,0xDC67,0xDC66,0xDC67,0xD427,0x89E5,0x6000,0x7944,0xD427,0xDC66,0xC408,0x68A2,0x6000,0x6000,0x6000,0x70E3,0xCC69,0xD446,0xD468,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x7923,0xCC27,0xDC46,0xDC67,0xC3E7,0x9225,0x7102,0x70C2,0x70C2,0x7902,0x9A66,0xCC28,0xDC67,0xDC67,0xCC48,0x70E2,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6041,0xBBA8,0xDC67,0xD447,0xD447,0xDC67,0x89C4,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0xBB88,0xDC67,0xD447,0xD447,0xDC67,0xA308,0x6000,0x6000,0x6000,0x6000,0x70C2,0xCC28,0xDC46,0xD447,0xD447,0xD447,0x7923,0x6000,0xA2A7,0xDC67,0xDC67,0xB348,0x7902,0x8163,0x8143,0x8143,0x8163,0x70C2,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x8A06,0xD467,0xDC67,0xBB67,0x7902,0x9A65,0xD468,0xDC67,0xB389,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A66,0xDC67,0xDC67,0xAB08,0x6000,0x6000,0x6000,0x6000,0x6000,0xAB28,0xDC87,0xD446,0xD446,0xDC87,0x8143,0x6000,0x6000,0x6000,0x6000,0x6861,0xC3E8,0xDC66,0xDC67,0xBBA8,0x6020,0xA2E7,0xDC87,0xD446,0xD446,0xDC88,0x8163,0x89E5,0xC409,0xBBC9,0xC409,0xD447,0xD446,0xD469,0xBBE9,0xC3E9,0xBBA9,0x7944,0xC3C8,0xDC67,0xD446,0xD468,0xB368,0x8143,0x7903,0x7103,0x7902,0x9A86,0xCC28,0xDC67,0xD446,0xD447,0x8163,0x7103,0xD427,0xDC66,0xC408,0x68A2,0x6000,0x6000,0x6000,0x70E3,0xCC49,0xD446,0xD468,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6861,0xC3E8,0xDC67,0xDC87,0xBBA8,0x6881,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x70C2,0xBBA7,0xDC87,0xE487,0xBBC8,0x6861,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A66,0xDC87,0xD446,0xD446,0xD447,0xDC67,0x89C4,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9225,0xDC67,0xD446,0xD446,0xD447,0xDC67,0xA308,0x6000,0x6000,0x6000,0x6000,0xB327,0xDC67,0xD446,0xD446,0xD447,0xD447,0x7923,0x6000,0xA2A7,0xDC67,0xDC67,0xA2C7,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A67,0xDC67,0xDC87,0xA2C7,0x6000,0x7944,0xCC48,0xDC87,0xBBC9,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A66,0xDC67,0xDC67,0xAB08,0x6000,0x6000,0x6000,0x6000,0x89C5,0xDC67,0xD446,0xD446,0xD446,0xDC87,0x8143,0x6000,0x6000,0x6000,0x6000,0xA2C7,0xDC87,0xD446,0xD468,0x70E2,0x7923,0xD448,0xD446,0xD446,0xD446,0xDC88,0x89A4,0x6000,0x6000,0x6000,0x8164,0xDC67,0xDC46,0xBBC9,0x6000,0x6000,0x6000,0xA2C7,0xDC87,0xD446,0xD468,0x9205,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x70C2,0xBBA8,0xDCC9,0xDCCA,0xC3C8,0x70E3,0xCC06,0xDC66,0xC408,0x68A2,0x6000,0x6000,0x6000,0x70E3,0xCC49,0xD446,0xD468,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x89E5,0xDC88,0xDC46,0xC408,0x6861,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x70C2,0xAB28,0xB349,0xAB49,0x70C3,0x6000,0x6000,0x6000,0x6000,0x6000,0x7923,0xD468,0xD446,0xD468,0xD468,0xD446,0xDC67,0x89C4,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x7903,0xCC48,0xDC66,0xD447,0xD489,0xD447,0xDC67,0xA308,0x6000,0x6000,0x6000,0x89E5,0xDC68,0xD446,0xD488,0xD468,0xD446,0xD447,0x7923,0x6000,0xA2A7,0xDC67,0xDC67,0xA2C7,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x70E3,0xD448,0xDC66,0xCC48,0x89E5,0xB347,0xDC67,0xDC67,0xA2C7,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A66,0xDC67,0xDC67,0xAB08,0x6000,0x6000,0x6000,0x70C2,0xCC28,0xDC67,0xD467,0xD467,0xD446,0xDC87,0x8143,0x6000,0x6000,0x6000,0x8184,0xD468,0xD446,0xDC67,0x9A66,0x6861,0xC408,0xDC67,0xD467,0xD467,0xD446,0xDC88,0x89A4,0x6000,0x6000,0x6000,0x8184,0xDC67,0xD446,0xBBE9,0x6041,0x6000,0x7923,0xCC48,0xDC66,0xD467,0x9226,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6041,0x70C2,0x70C2,0x70A1,0x7944,0xCC27,0xDC66,0xC408,0x68A2,0x6000,0x6000,0x6000,0x70E3,0xCC49,0xD446,0xD468,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xBBE9,0xDC46,0xDC88,0x89E5,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0xBBA8,0xDC67,0xDC67,0xB388,0xB369,0xDC66,0xDC67,0x89C4,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xB368,0xDC67,0xDC66,0xC3E8,0xAB07,0xDC87,0xDC67,0xA308,0x6000,0x6000,0x68A2,0xCC28,0xD466,0xDC67,0xAB49,0xBBA8,0xDC66,0xD447,0x7923,0x6000,0xA2A7,0xDC67,0xDC67,0x9AA7,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xA2C6,0xDC67,0xD446,0xDC88,0xDC67,0xD446,0xCC28,0x68A2,0x6000,0x9A66,0xAAC5,0xAAE6,0x7903,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A66,0xDC67,0xDC67,0xAB08,0x6000,0x6000,0x6000,0xAB27,0xDC67,0xD446,0xCC49,0xC429,0xD446,0xDC87,0x8143,0x6000,0x6000,0x6041,0xC3E8,0xDC67,0xDC67,0xBBA8,0x6000,0xA2A6,0xDC87,0xD446,0xCC49,0xC42A,0xD446,0xDC88,0x89A4,0x6000,0x6000,0x6000,0x8184,0xDC67,0xD446,0xBBE9,0x6041,0x6000,0x9205,0xDC88,0xDC67,0xBBA8,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x7944,0xD427,0xDC66,0xC3E8,0x6861,0x6000,0x6000,0x6000,0x70C3,0xCC49,0xD446,0xD468,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xD4AA,0xD446,0xCC49,0x70C2,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A86,0xDC87,0xD446,0xD468,0x8164,0xAB48,0xDC67,0xDC67,0x89C4,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9246,0xDC88,0xD446,0xDC68,0x7923,0x91E3,0xDC87,0xDC67,0xA308,0x6000,0x6041,0xB348,0xDC67,0xDC67,0xCC28,0x7924,0xBBC8,0xDC46,0xD447,0x7923,0x6000,0xA2A7,0xDC67,0xD446,0xC3E9,0xA2C7,0xAB28,0xAB08,0xAB08,0xAB49,0x8185,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6041,0xC3C7,0xDC67,0xD446,0xD446,0xCC27,0x7944,0x6000,0x70E3,0xD448,0xE4A7,0xCC48,0x70C2,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A66,0xDC67,0xDC67,0xAB08,0x6000,0x6000,0x89E5,0xD488,0xD446,0xDC88,0x89E5,0xBBA9,0xDC66,0xDC87,0x8143,0x6000,0x6020,0xAAE7,0xDC87,0xDC46,0xD448,0x7102,0x8164,0xD468,0xD446,0xDC87,0x9225,0xB389,0xDC67,0xDC88,0x89A4,0x6000,0x6000,0x6000,0x8184,0xDC67,0xD446,0xBBE9,0x6020,0x6000,0xB368,0xDC66,0xDC87,0x89E5,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x7944,0xD427,0xDC46,0xCC48,0x9A86,0x9A87,0x9AA7,0x9A87,0x9A86,0xD468,0xD446,0xD468,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xD468,0xDC66,0xB367,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x7964,0x81A5,0x8185,0x8185,0x8185,0x8185,0x8185,0x81A5,0x7965,0x6000,0x6000,0x6000,0x7903,0xD468,0xD446,0xDC87,0xA2C7,0x6000,0xB389,0xDC67,0xDC67,0x89C4,0x6000,0x6000,0x6000,0x6000,0x6000,0x70E2,0xCC48,0xDC46,0xDC87,0xAB27,0x6020,0x9A65,0xDC87,0xDC67,0xA308,0x6000,0x89E5,0xDC68,0xD446,0xDC88,0x89E5,0x6041,0xC409,0xDC46,0xD447,0x7923,0x6000,0xA2A7,0xDC67,0xD447,0xD446,0xDC67,0xDC67,0xDC67,0xDC67,0xE487,0xAB08,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6041,0xB347,0xD467,0xD467,0xDC87,0xD446,0xD427,0xA2A6,0x6000,0xA2A6,0xDC87,0xDC67,0xA2C7,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A66,0xDC67,0xDC67,0xAB08,0x6000,0x68A1,0xCC08,0xDC46,0xDC67,0xB368,0x6861,0xC40A,0xD446,0xDC87,0x8143,0x6000,0x8184,0xD468,0xD446,0xDC87,0x9A66,0x6020,0xC3E8,0xDC66,0xDC67,0xBBC8,0x6061,0xBBC9,0xDC67,0xDC88,0x89A4,0x6000,0x6000,0x6000,0x8184,0xDC67,0xD446,0xBBE9,0x6020,0x6020,0xC42A,0xD446,0xDCA9,0x7902,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x7944,0xD427,0xD447,0xD446,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xD446,0xD446,0xD468,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xD468,0xDC66,0xB367,0x6020,0x6000,0x6000,0x6000,0x6000,0x6020,0xCC48,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD489,0x6861,0x6000,0x6861,0xBBC8,0xDC67,0xDC67,0xBBA8,0x6861,0x6000,0xB369,0xDC67,0xDC67,0x89C4,0x6000,0x6000,0x6000,0x6000,0x6000,0xBB88,0xDC67,0xDC66,0xCC08,0x6861,0x6000,0x9A65,0xDC87,0xDC67,0xA2E8,0x70A2,0xCC49,0xD446,0xDC67,0xB348,0x6000,0x6882,0xC409,0xDC46,0xD447,0x7923,0x6000,0xA2A7,0xDC67,0xD447,0xD446,0xDC67,0xDC67,0xDC67,0xDC67,0xE4A7,0xAB08,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6041,0xB347,0xE487,0xDC67,0xCC28,0xAB27,0xD468,0xDC66,0xDC67,0xAB28,0xC3C7,0xDC66,0xD448,0x70A2,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A66,0xDC67,0xDC67,0xAB08,0x6000,0xAB47,0xDC87,0xD446,0xCC48,0x68A2,0x6000,0xC40A,0xD446,0xDC87,0x7923,0x6882,0xC408,0xDC66,0xDC67,0xBB88,0x6000,0xA2E7,0xDC87,0xD446,0xD448,0x70E2,0x6000,0xBBCA,0xDC67,0xDC88,0x89A4,0x6000,0x6000,0x6000,0x8184,0xDC67,0xD446,0xBBE9,0x6020,0x6020,0xC42A,0xD446,0xDCA9,0x7902,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x7944,0xD427,0xD447,0xD446,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xD446,0xD446,0xD468,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xD4A9,0xD446,0xCC49,0x70C2,0x6000,0x6000,0x6000,0x6000,0x6020,0xD468,0xDC87,0xDC67,0xDC67,0xDC87,0xDC67,0xD447,0xD446,0xCC6A,0x6861,0x6000,0x9A66,0xDC87,0xD446,0xDC88,0x9AA7,0x89E6,0x89C5,0xC3E9,0xD446,0xDC67,0x89C4,0x6000,0x6000,0x6000,0x6000,0x9246,0xDC67,0xD446,0xD488,0x89C5,0x6000,0x6000,0x9A65,0xDC87,0xDC67,0x9A87,0xA2A5,0xDC87,0xDC67,0xCC28,0x70C2,0x6000,0x6882,0xC409,0xDC46,0xD447,0x7923,0x6000,0xA2A7,0xDC67,0xDC67,0xBBA8,0x89E4,0x9A46,0x9246,0x9246,0x9A86,0x7944,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x8164,0xDCA8,0xDC46,0xCC28,0x7902,0x6000,0x9206,0xD448,0xDC66,0xDC67,0xDC67,0xDC67,0xA2E7,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A66,0xDC67,0xDC67,0x9AA7,0x81A4,0xD467,0xD446,0xDC88,0x9226,0x6000,0x6020,0xC40A,0xD446,0xDC87,0x70E2,0x9A85,0xDC87,0xD446,0xD448,0x7103,0x7943,0xD468,0xD446,0xD468,0xA2C8,0x6881,0x6881,0xBBEA,0xDC67,0xDC88,0x89A4,0x6000,0x6000,0x6000,0x8184,0xDC67,0xD446,0xBBE9,0x6020,0x6000,0xB389,0xDC66,0xDC87,0x89C4,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x7944,0xD427,0xDC46,0xD448,0x9AA7,0xA2A7,0xA2C7,0xA2A7,0xA2A7,0xD468,0xD446,0xD468,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xC40A,0xDC46,0xDC88,0x89C4,0x6000,0x6000,0x6000,0x6000,0x6020,0xAB07,0xB326,0xB326,0xB326,0xA2A5,0xC408,0xD467,0xDC67,0xAB07,0x6000,0x7943,0xD489,0xD446,0xD447,0xD447,0xD447,0xD467,0xD467,0xD447,0xD447,0xDC67,0x89C4,0x6000,0x6000,0x6000,0x7103,0xD448,0xD446,0xDC87,0xAB07,0x6000,0x6000,0x6000,0x9A65,0xDC87,0xD446,0xC40A,0xD468,0xD446,0xDC88,0x8A05,0x6000,0x6000,0x6882,0xC409,0xDC46,0xD447,0x7923,0x6000,0xA2A7,0xDC67,0xDC67,0x9AA7,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xAB08,0xDC66,0xDC88,0x89C4,0x6000,0x6000,0x6000,0x8184,0xCC07,0xD447,0xD446,0xDCA9,0x8184,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A66,0xDC67,0xDC67,0xAB28,0xC3C8,0xDC66,0xDC67,0xB347,0x6000,0x6000,0x6020,0xC40A,0xD446,0xD488,0xA2C7,0xD468,0xD446,0xDC87,0x9246,0x6020,0xC408,0xDC67,0xD446,0xD447,0xCC4A,0xCC6A,0xCC6A,0xD468,0xD446,0xDC88,0x89A4,0x6000,0x6000,0x6000,0x8184,0xDC67,0xD446,0xBBE9,0x6041,0x6000,0x9225,0xDC87,0xDC67,0xBBA8,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x7944,0xD427,0xDC66,0xC3E8,0x6882,0x6000,0x6000,0x6000,0x70C3,0xCC49,0xD446,0xD468,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x91E5,0xDC88,0xDC46,0xC3E8,0x6040,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6041,0xC3C8,0xDC66,0xD488,0x81A4,0x6000,0xBB87,0xDC67,0xD446,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xD446,0xD447,0xDC67,0x89C4,0x6000,0x6000,0x6040,0xB388,0xDC67,0xDC66,0xCC08,0x68A2,0x6000,0x6000,0x6000,0x9A65,0xDC87,0xD447,0xDC67,0xD447,0xDC87,0xB348,0x6000,0x6000,0x6000,0x6882,0xC409,0xDC46,0xD447,0x7923,0x6000,0xA2A7,0xDC67,0xDC67,0xA2C7,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xB3A9,0xDC66,0xD489,0x8164,0x6000,0x6000,0x6000,0x6000,0x9A86,0xDC88,0xD446,0xD467,0xC3E8,0x70C2,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A66,0xDC67,0xD447,0xD468,0xD467,0xD446,0xCC49,0x70E3,0x6000,0x6000,0x6020,0xC40A,0xD446,0xD467,0xD489,0xD446,0xDC67,0xBBA8,0x6020,0xA2C7,0xDC67,0xD447,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xDC88,0x89A4,0x6000,0x6000,0x6000,0x8184,0xDC67,0xD446,0xBBE9,0x6041,0x6000,0x7923,0xD448,0xDC66,0xD468,0x89E5,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0x70C2,0x70C2,0x70A2,0x7944,0xCC27,0xDC66,0xC408,0x68A2,0x6000,0x6000,0x6000,0x70E3,0xCC49,0xD446,0xD468,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6882,0xC3E8,0xDC67,0xDC67,0xBB88,0x6841,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6861,0xBB87,0xDC67,0xDC67,0xBBA8,0x6000,0x9A86,0xDC88,0xD446,0xD468,0xAB07,0xAB27,0xB327,0xB347,0xAAE6,0xCC28,0xD446,0xDC67,0x89C4,0x6000,0x6000,0x9246,0xDC88,0xD446,0xD468,0x81A4,0x6000,0x6000,0x6000,0x6000,0x9A65,0xDC87,0xD447,0xD446,0xDC66,0xCC28,0x70C2,0x6000,0x6000,0x6000,0x6882,0xC409,0xDC46,0xD447,0x7923,0x6000,0xA2A7,0xDC67,0xDC67,0xA2A7,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xA2C7,0xDC67,0xDC88,0x89E5,0x6000,0x6000,0x6000,0x6041,0xBBA8,0xDC66,0xDC67,0xDC67,0xDC67,0xCC08,0x70E2,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A66,0xDC67,0xD447,0xD446,0xD446,0xDC88,0x9205,0x6000,0x6000,0x6000,0x6020,0xC40A,0xD446,0xD446,0xD446,0xDC66,0xCC48,0x70C2,0x8164,0xD468,0xD446,0xDC67,0xD489,0xD489,0xD489,0xD489,0xD4A9,0xD468,0xD446,0xDC88,0x89A4,0x6000,0x6000,0x6000,0x8184,0xDC67,0xD446,0xBBE9,0x6041,0x6000,0x6000,0xAB07,0xDC87,0xD446,0xCC48,0x89C5,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6861,0xB368,0xD4AA,0xD4AA,0xC3C8,0x7103,0xCC06,0xDC66,0xC408,0x68A2,0x6000,0x6000,0x6000,0x70E3,0xCC49,0xD446,0xD468,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x7944,0xD447,0xD446,0xDC87,0xC3C8,0x89C4,0x70E3,0x6882,0x6882,0x70E3,0x91E5,0xC3E7,0xDC67,0xD446,0xCC48,0x70E2,0x7903,0xD448,0xD446,0xDC87,0xA2E7,0x6000,0x6000,0x6000,0x6000,0x6000,0xB389,0xDC67,0xDC67,0x89C4,0x6000,0x7903,0xD448,0xD446,0xDC67,0xAB07,0x6020,0x6000,0x6000,0x6000,0x6000,0x9A65,0xDC87,0xD447,0xD446,0xDC88,0x9205,0x6000,0x6000,0x6000,0x6000,0x6882,0xC409,0xDC46,0xD447,0x7923,0x6000,0xA2A7,0xDC67,0xD446,0xCC49,0xBBE9,0xC3E9,0xBBE9,0xBBE9,0xC409,0x9226,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x7943,0xDC88,0xD446,0xCC07,0x89A4,0x7903,0x7902,0xB347,0xDC87,0xDC67,0xBBA8,0xBBC9,0xDC67,0xDC67,0xCC07,0x8164,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A66,0xDC67,0xD447,0xD447,0xDC67,0xB368,0x6020,0x6000,0x6000,0x6000,0x6020,0xC40A,0xD446,0xD447,0xD446,0xDC88,0x9A46,0x6041,0xC3E8,0xDC66,0xDC67,0xBBA8,0x70C2,0x70C1,0x70C1,0x70C1,0x70C2,0xC3E9,0xDC47,0xDC88,0x89A4,0x6000,0x6000,0x6000,0x8184,0xDC67,0xD446,0xBBE9,0x6041,0x6000,0x6000,0x68A2,0xC408,0xDC67,0xD446,0xD468,0xAB07,0x7902,0x70E3,0x70C2,0x7903,0x9205,0xC3E7,0xDC87,0xD446,0xDC67,0x9205,0x7103,0xCC27,0xDC66,0xC408,0x68A2,0x6000,0x6000,0x6000,0x70E3,0xCC49,0xD446,0xD468,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x89E5,0xD427,0xDC67,0xDC66,0xDC88,0xD469,0xBBC8,0xBBC8,0xD489,0xDC87,0xDC66,0xDC87,0xCC28,0x7922,0x6861,0xC3C8,0xDC67,0xDC67,0xC3C8,0x6861,0x6000,0x6000,0x6000,0x6000,0x6000,0xB389,0xDC66,0xDC67,0x89C4,0x6000,0xBB67,0xDC67,0xDC46,0xCC08,0x6861,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A65,0xDC67,0xD446,0xDC67,0xAB27,0x6000,0x6000,0x6000,0x6000,0x6000,0x6882,0xC409,0xDC46,0xD447,0x7923,0x6000,0xA2A7,0xDC66,0xD446,0xD446,0xDC66,0xDC66,0xDC66,0xDC66,0xDC87,0xAB08,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6041,0xB348,0xE487,0xDC46,0xDC87,0xDCAA,0xDCA9,0xDC67,0xDC66,0xCC27,0x70E2,0x6841,0xBBA8,0xDC87,0xDC66,0xC409,0x68A2,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A66,0xDC67,0xD447,0xD466,0xCC48,0x70C2,0x6000,0x6000,0x6000,0x6000,0x6020,0xC40A,0xD446,0xD447,0xDC67,0xB367,0x6000,0xA2C7,0xDC87,0xDC46,0xD448,0x7103,0x6000,0x6000,0x6000,0x6000,0x6000,0xBBC9,0xDC67,0xDC88,0x89A4,0x6000,0x6000,0x6000,0x8184,0xDC67,0xD446,0xBBE9,0x6041,0x6000,0x6000,0x6000,0x70C2,0xCC28,0xDC87,0xDC46,0xDC67,0xDCA8,0xD469,0xCC49,0xD489,0xDC87,0xDC66,0xDC67,0xD467,0x9AA7,0x6000,0x7944,0xD427,0xDC66,0xC408,0x68A2,0x6000,0x6000,0x6000,0x70E3,0xCC49,0xD446,0xD468,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x7923,0xC3C8,0xDC88,0xDC66,0xD446,0xDC66,0xDC66,0xD446,0xDC66,0xDC88,0xBBA8,0x70E2,0x6000,0xAB07,0xE4C8,0xE4A8,0xD489,0x8164,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xBBC9,0xE4C8,0xE4E8,0x8183,0x9225,0xE4E9,0xE4A8,0xDCA9,0x89A4,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xA2A6,0xECE8,0xE4A8,0xCC29,0x70E3,0x6000,0x6000,0x6000,0x6000,0x6000,0x6882,0xCC4A,0xE4A8,0xDCA8,0x7944,0x6000,0xA2C7,0xECC8,0xDCA8,0xDCA8,0xDCA8,0xDCA8,0xDCA8,0xDCA8,0xE4C8,0xA308,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6040,0xB348,0xD488,0xDC87,0xDC46,0xDC66,0xDCA8,0xCC08,0x7943,0x6000,0x6000,0x6861,0xBBA8,0xD469,0x7944,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A86,0xDC66,0xD446,0xDC88,0x9225,0x6000,0x6000,0x6000,0x6000,0x6000,0x6041,0xC42A,0xDC46,0xDC66,0xD448,0x7103,0x89A3,0xD488,0xDC46,0xDC87,0x9A66,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xBBEA,0xDC66,0xE487,0x89C4,0x6000,0x6000,0x6000,0x81A4,0xDC66,0xDC46,0xC3E9,0x6041,0x6000,0x6000,0x6000,0x6000,0x70A2,0xB327,0xD468,0xDC67,0xD446,0xD446,0xD446,0xD446,0xDC46,0xDC88,0xC3E7,0x81A4,0x6000,0x6000,0x7944,0xD427,0xDC66,0xC408,0x70C3,0x6000,0x6000,0x6000,0x70E3,0xD469,0xDC46,0xDC87,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6041,0x89A4,0xB388,0xD4AA,0xD468,0xD468,0xD4AA,0xB348,0x89A4,0x6000,0x6000,0x6000,0x89A4,0x89A3,0x89C4,0x8164,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x7923,0x89A3,0x89C4,0x6881,0x7943,0x89C3,0x89C4,0x8163,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x70E2,0x89C4,0x89C3,0x7923,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0x8163,0x89C3,0x89A4,0x6861,0x6000,0x70E2,0x89C4,0x89C4,0x89C4,0x89C4,0x89C4,0x89C4,0x89C4,0x89A3,0x70E2,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x8163,0x9A86,0xB389,0xAB07,0x89C4,0x70C2,0x6000,0x6000,0x6000,0x6000,0x6861,0x7964,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9226,0xCC6B,0xCC6A,0xAB08,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xB36A,0xCC6A,0xCC6B,0x9246,0x6000,0xBBEA,0xCC4A,0xCC4A,0xB369,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xAB29,0xCC6A,0xCC6B,0x8184,0x6000,0x6000,0x6000,0x7944,0xCC4B,0xCC4A,0xAB49,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x8163,0xA2E7,0xD48A,0xD488,0xD468,0xD4AA,0xBBC9,0x89E4,0x6882,0x6000,0x6000,0x6000,0x70E3,0xC42A,0xCC4A,0xB3AA,0x6861,0x6000,0x6000,0x6000,0x6882,0xBBEA,0xCC4A,0xC42A,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
+    0x40, 0x01, 0x20, 0x00, 0xaa, 0x00, 0x00, 0x60, 0x20, 0x60, 0x40, 0x60, 0x41, 0x60, 0x61, 0x60,
+    0x41, 0x68, 0x61, 0x68, 0x81, 0x68, 0x82, 0x68, 0xa1, 0x68, 0xa2, 0x68, 0xa1, 0x70, 0xa2, 0x70,
+    0xc1, 0x70, 0xc2, 0x70, 0xc3, 0x70, 0xe2, 0x70, 0xe3, 0x70, 0x02, 0x71, 0x03, 0x71, 0xe2, 0x78,
+    0x02, 0x79, 0x03, 0x79, 0x22, 0x79, 0x23, 0x79, 0x24, 0x79, 0x43, 0x79, 0x44, 0x79, 0x64, 0x79,
+    0x65, 0x79, 0x43, 0x81, 0x63, 0x81, 0x64, 0x81, 0x83, 0x81, 0x84, 0x81, 0x85, 0x81, 0xa4, 0x81,
+    0xa5, 0x81, 0xa3, 0x89, 0xa4, 0x89, 0xc3, 0x89, 0xc4, 0x89, 0xc5, 0x89, 0xe4, 0x89, 0xe5, 0x89,
+    0xe6, 0x89, 0x05, 0x8a, 0x06, 0x8a, 0xe3, 0x91, 0xe4, 0x91, 0xe5, 0x91, 0x05, 0x92, 0x06, 0x92,
+    0x25, 0x92, 0x26, 0x92, 0x45, 0x92, 0x46, 0x92, 0x47, 0x92, 0x67, 0x92, 0x45, 0x9a, 0x46, 0x9a,
+    0x65, 0x9a, 0x66, 0x9a, 0x67, 0x9a, 0x85, 0x9a, 0x86, 0x9a, 0x87, 0x9a, 0xa7, 0x9a, 0xa5, 0xa2,
+    0xa6, 0xa2, 0xa7, 0xa2, 0xc6, 0xa2, 0xc7, 0xa2, 0xc8, 0xa2, 0xe7, 0xa2, 0xe8, 0xa2, 0x08, 0xa3,
+    0xc5, 0xaa, 0xe6, 0xaa, 0xe7, 0xaa, 0x07, 0xab, 0x08, 0xab, 0x27, 0xab, 0x28, 0xab, 0x29, 0xab,
+    0x47, 0xab, 0x48, 0xab, 0x49, 0xab, 0x26, 0xb3, 0x27, 0xb3, 0x47, 0xb3, 0x48, 0xb3, 0x49, 0xb3,
+    0x67, 0xb3, 0x68, 0xb3, 0x69, 0xb3, 0x6a, 0xb3, 0x88, 0xb3, 0x89, 0xb3, 0xa9, 0xb3, 0xaa, 0xb3,
+    0x67, 0xbb, 0x87, 0xbb, 0x88, 0xbb, 0xa7, 0xbb, 0xa8, 0xbb, 0xa9, 0xbb, 0xc8, 0xbb, 0xc9, 0xbb,
+    0xca, 0xbb, 0xe9, 0xbb, 0xea, 0xbb, 0xc7, 0xc3, 0xc8, 0xc3, 0xe7, 0xc3, 0xe8, 0xc3, 0xe9, 0xc3,
+    0x08, 0xc4, 0x09, 0xc4, 0x0a, 0xc4, 0x29, 0xc4, 0x2a, 0xc4, 0x06, 0xcc, 0x07, 0xcc, 0x08, 0xcc,
+    0x27, 0xcc, 0x28, 0xcc, 0x29, 0xcc, 0x48, 0xcc, 0x49, 0xcc, 0x4a, 0xcc, 0x4b, 0xcc, 0x69, 0xcc,
+    0x6a, 0xcc, 0x6b, 0xcc, 0x27, 0xd4, 0x46, 0xd4, 0x47, 0xd4, 0x48, 0xd4, 0x66, 0xd4, 0x67, 0xd4,
+    0x68, 0xd4, 0x69, 0xd4, 0x88, 0xd4, 0x89, 0xd4, 0x8a, 0xd4, 0xa9, 0xd4, 0xaa, 0xd4, 0x46, 0xdc,
+    0x47, 0xdc, 0x66, 0xdc, 0x67, 0xdc, 0x68, 0xdc, 0x87, 0xdc, 0x88, 0xdc, 0xa8, 0xdc, 0xa9, 0xdc,
+    0xaa, 0xdc, 0xc9, 0xdc, 0xca, 0xdc, 0x87, 0xe4, 0xa7, 0xe4, 0xa8, 0xe4, 0xc8, 0xe4, 0xc9, 0xe4,
+    0xe8, 0xe4, 0xe9, 0xe4, 0xc8, 0xec, 0xe8, 0xec, 0xe9, 0xec, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
+    0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xd0, 0x00, 0x00, 0x22, 0x00, 0x4f,
+    0x00, 0x85, 0x00, 0x8f, 0x00, 0x90, 0x00, 0x85, 0x00, 0x47, 0x00, 0x20, 0x0c, 0x00, 0x00, 0x01,
+    0x00, 0x5e, 0x00, 0x85, 0x00, 0x86, 0x00, 0x25, 0x09, 0x00, 0x00, 0x01, 0x00, 0x57, 0x00, 0x85,
+    0x00, 0x86, 0x00, 0x39, 0x05, 0x00, 0x00, 0x0a, 0x00, 0x74, 0x01, 0x82, 0x00, 0x13, 0x00, 0x00,
+    0x00, 0x3a, 0x00, 0x86, 0x05, 0x79, 0x00, 0x86, 0x00, 0x39, 0x08, 0x00, 0x00, 0x0e, 0x00, 0x31,
+    0x00, 0x45, 0x00, 0x35, 0x00, 0x1a, 0x0d, 0x00, 0x00, 0x0e, 0x00, 0x29, 0x00, 0x26, 0x00, 0x10,
+    0x06, 0x00, 0x00, 0x22, 0x00, 0x26, 0x00, 0x29, 0x00, 0x07, 0x05, 0x00, 0x00, 0x03, 0x01, 0x27,
+    0x00, 0x28, 0x00, 0x18, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x28, 0x00, 0x29, 0x00, 0x07, 0x00, 0x0e,
+    0x00, 0x28, 0x05, 0x29, 0x00, 0x27, 0x00, 0x21, 0x00, 0x05, 0x02, 0x00, 0x00, 0x1a, 0x00, 0x3b,
+    0x00, 0x79, 0x00, 0x92, 0x00, 0x90, 0x00, 0x91, 0x00, 0x52, 0x00, 0x27, 0x00, 0x01, 0x02, 0x00,
+    0x00, 0x06, 0x00, 0x26, 0x00, 0x29, 0x00, 0x1f, 0x00, 0x01, 0x02, 0x00, 0x00, 0x03, 0x00, 0x21,
+    0x00, 0x26, 0x00, 0x27, 0x9d, 0x00, 0x00, 0x10, 0x00, 0x67, 0x00, 0x8f, 0x00, 0x97, 0x03, 0x88,
+    0x00, 0x97, 0x00, 0x8d, 0x00, 0x5a, 0x00, 0x0e, 0x0a, 0x00, 0x00, 0x3e, 0x00, 0x97, 0x00, 0x88,
+    0x00, 0x96, 0x00, 0x2b, 0x09, 0x00, 0x00, 0x38, 0x00, 0x9a, 0x00, 0x88, 0x00, 0x97, 0x00, 0x53,
+    0x05, 0x00, 0x00, 0x52, 0x00, 0x99, 0x00, 0x88, 0x00, 0x89, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x48,
+    0x00, 0x96, 0x05, 0x88, 0x00, 0x99, 0x00, 0x4c, 0x07, 0x00, 0x00, 0x1a, 0x00, 0x7e, 0x00, 0x9a,
+    0x00, 0x96, 0x00, 0xa0, 0x00, 0x8d, 0x00, 0x35, 0x0c, 0x00, 0x00, 0x43, 0x01, 0xa3, 0x00, 0x53,
+    0x05, 0x00, 0x00, 0x2c, 0x00, 0x9c, 0x00, 0xa2, 0x00, 0xa6, 0x00, 0x1f, 0x05, 0x00, 0x00, 0x4a,
+    0x00, 0xa4, 0x00, 0xa2, 0x00, 0x9e, 0x00, 0x18, 0x00, 0x22, 0x00, 0x90, 0x00, 0xa2, 0x00, 0xa9,
+    0x00, 0x21, 0x00, 0x41, 0x00, 0xa3, 0x05, 0x9b, 0x00, 0xa2, 0x00, 0x93, 0x00, 0x1b, 0x00, 0x00,
+    0x00, 0x07, 0x00, 0x47, 0x00, 0x8a, 0x00, 0x99, 0x03, 0x88, 0x00, 0x96, 0x00, 0x9a, 0x00, 0x69,
+    0x00, 0x18, 0x01, 0x00, 0x00, 0x1b, 0x00, 0x8f, 0x00, 0xa3, 0x00, 0x7f, 0x00, 0x0a, 0x02, 0x00,
+    0x00, 0x11, 0x00, 0x91, 0x00, 0xa2, 0x00, 0x9e, 0x9c, 0x00, 0x00, 0x1a, 0x00, 0x7d, 0x00, 0x99,
+    0x00, 0x96, 0x00, 0x97, 0x00, 0x90, 0x00, 0x7f, 0x00, 0x81, 0x00, 0x92, 0x00, 0x97, 0x00, 0x96,
+    0x00, 0x99, 0x00, 0x7e, 0x00, 0x14, 0x08, 0x00, 0x00, 0x18, 0x00, 0x8d, 0x00, 0x88, 0x00, 0x89,
+    0x00, 0x97, 0x00, 0x29, 0x08, 0x00, 0x00, 0x0e, 0x00, 0x7e, 0x00, 0x94, 0x00, 0x89, 0x00, 0x97,
+    0x00, 0x4c, 0x04, 0x00, 0x00, 0x2c, 0x00, 0x9a, 0x00, 0x88, 0x01, 0x89, 0x00, 0x18, 0x00, 0x00,
+    0x00, 0x46, 0x00, 0x97, 0x00, 0x89, 0x00, 0x97, 0x03, 0x99, 0x00, 0xa2, 0x00, 0x4c, 0x06, 0x00,
+    0x00, 0x03, 0x00, 0x7e, 0x00, 0x97, 0x00, 0x8c, 0x00, 0x9b, 0x00, 0x99, 0x00, 0x88, 0x00, 0x9b,
+    0x00, 0x22, 0x0b, 0x00, 0x00, 0x3e, 0x01, 0x97, 0x00, 0x53, 0x04, 0x00, 0x00, 0x07, 0x00, 0x73,
+    0x00, 0x96, 0x00, 0x88, 0x00, 0x99, 0x00, 0x1e, 0x04, 0x00, 0x00, 0x22, 0x00, 0x98, 0x00, 0x88,
+    0x00, 0x97, 0x00, 0x37, 0x00, 0x01, 0x00, 0x71, 0x00, 0x96, 0x00, 0x88, 0x00, 0x99, 0x00, 0x1f,
+    0x00, 0x41, 0x00, 0xa0, 0x00, 0x96, 0x00, 0x94, 0x02, 0x88, 0x01, 0x96, 0x00, 0x92, 0x00, 0x16,
+    0x00, 0x0c, 0x00, 0x76, 0x00, 0x99, 0x00, 0x96, 0x00, 0x97, 0x00, 0x9a, 0x00, 0x92, 0x00, 0x91,
+    0x00, 0x9c, 0x00, 0x97, 0x00, 0x96, 0x00, 0x97, 0x00, 0x87, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x1b,
+    0x00, 0x87, 0x00, 0x96, 0x00, 0x75, 0x00, 0x0a, 0x02, 0x00, 0x00, 0x11, 0x00, 0x84, 0x00, 0x88,
+    0x00, 0x8d, 0x9b, 0x00, 0x00, 0x18, 0x00, 0x7d, 0x00, 0x94, 0x00, 0x97, 0x00, 0x72, 0x00, 0x35,
+    0x00, 0x12, 0x01, 0x0e, 0x00, 0x15, 0x00, 0x3e, 0x00, 0x7e, 0x01, 0x97, 0x00, 0x80, 0x00, 0x10,
+    0x06, 0x00, 0x00, 0x03, 0x00, 0x69, 0x00, 0x97, 0x01, 0x89, 0x00, 0x97, 0x00, 0x29, 0x07, 0x00,
+    0x00, 0x01, 0x00, 0x67, 0x00, 0x97, 0x01, 0x89, 0x00, 0x97, 0x00, 0x4c, 0x03, 0x00, 0x00, 0x0e,
+    0x00, 0x7e, 0x00, 0x94, 0x02, 0x89, 0x00, 0x18, 0x00, 0x00, 0x00, 0x46, 0x01, 0x97, 0x00, 0x5b,
+    0x00, 0x15, 0x00, 0x1f, 0x01, 0x1e, 0x00, 0x1f, 0x00, 0x0e, 0x06, 0x00, 0x00, 0x2f, 0x00, 0x8c,
+    0x00, 0x97, 0x00, 0x65, 0x00, 0x15, 0x00, 0x3d, 0x00, 0x8d, 0x00, 0x97, 0x00, 0x62, 0x0b, 0x00,
+    0x00, 0x3e, 0x01, 0x97, 0x00, 0x51, 0x04, 0x00, 0x00, 0x53, 0x00, 0x99, 0x01, 0x88, 0x00, 0x99,
+    0x00, 0x1e, 0x03, 0x00, 0x00, 0x06, 0x00, 0x73, 0x00, 0x96, 0x00, 0x97, 0x00, 0x69, 0x00, 0x01,
+    0x00, 0x4a, 0x00, 0x99, 0x01, 0x88, 0x00, 0x9a, 0x00, 0x1f, 0x00, 0x2c, 0x00, 0x76, 0x00, 0x6c,
+    0x00, 0x76, 0x00, 0x89, 0x00, 0x88, 0x00, 0x8e, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x6a, 0x00, 0x1b,
+    0x00, 0x71, 0x00, 0x97, 0x00, 0x88, 0x00, 0x8d, 0x00, 0x5e, 0x00, 0x1e, 0x00, 0x16, 0x00, 0x13,
+    0x00, 0x15, 0x00, 0x41, 0x00, 0x7e, 0x00, 0x97, 0x00, 0x88, 0x00, 0x89, 0x00, 0x1f, 0x00, 0x13,
+    0x00, 0x87, 0x00, 0x96, 0x00, 0x75, 0x00, 0x0a, 0x02, 0x00, 0x00, 0x11, 0x00, 0x81, 0x00, 0x88,
+    0x00, 0x8d, 0x9a, 0x00, 0x00, 0x06, 0x00, 0x73, 0x00, 0x97, 0x00, 0x99, 0x00, 0x69, 0x00, 0x07,
+    0x05, 0x00, 0x00, 0x0e, 0x00, 0x68, 0x00, 0x99, 0x00, 0xa0, 0x00, 0x6b, 0x00, 0x06, 0x05, 0x00,
+    0x00, 0x3e, 0x00, 0x99, 0x01, 0x88, 0x00, 0x89, 0x00, 0x97, 0x00, 0x29, 0x07, 0x00, 0x00, 0x35,
+    0x00, 0x97, 0x01, 0x88, 0x00, 0x89, 0x00, 0x97, 0x00, 0x4c, 0x03, 0x00, 0x00, 0x59, 0x00, 0x97,
+    0x01, 0x88, 0x01, 0x89, 0x00, 0x18, 0x00, 0x00, 0x00, 0x46, 0x01, 0x97, 0x00, 0x48, 0x0c, 0x00,
+    0x00, 0x3f, 0x00, 0x97, 0x00, 0x99, 0x00, 0x48, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x80, 0x00, 0x99,
+    0x00, 0x6c, 0x0b, 0x00, 0x00, 0x3e, 0x01, 0x97, 0x00, 0x51, 0x03, 0x00, 0x00, 0x2a, 0x00, 0x97,
+    0x02, 0x88, 0x00, 0x99, 0x00, 0x1e, 0x03, 0x00, 0x00, 0x48, 0x00, 0x99, 0x00, 0x88, 0x00, 0x8d,
+    0x00, 0x10, 0x00, 0x18, 0x00, 0x8a, 0x02, 0x88, 0x00, 0x9a, 0x00, 0x27, 0x02, 0x00, 0x00, 0x20,
+    0x00, 0x97, 0x00, 0x94, 0x00, 0x6c, 0x02, 0x00, 0x00, 0x48, 0x00, 0x99, 0x00, 0x88, 0x00, 0x8d,
+    0x00, 0x33, 0x05, 0x00, 0x00, 0x0e, 0x00, 0x69, 0x00, 0x9e, 0x00, 0x9f, 0x00, 0x71, 0x00, 0x11,
+    0x00, 0x7a, 0x00, 0x96, 0x00, 0x75, 0x00, 0x0a, 0x02, 0x00, 0x00, 0x11, 0x00, 0x81, 0x00, 0x88,
+    0x00, 0x8d, 0x9a, 0x00, 0x00, 0x2c, 0x00, 0x9a, 0x00, 0x94, 0x00, 0x75, 0x00, 0x06, 0x07, 0x00,
+    0x00, 0x0e, 0x00, 0x53, 0x00, 0x5c, 0x00, 0x57, 0x00, 0x0f, 0x04, 0x00, 0x00, 0x18, 0x00, 0x8d,
+    0x00, 0x88, 0x01, 0x8d, 0x00, 0x88, 0x00, 0x97, 0x00, 0x29, 0x06, 0x00, 0x00, 0x16, 0x00, 0x80,
+    0x00, 0x96, 0x00, 0x89, 0x00, 0x90, 0x00, 0x89, 0x00, 0x97, 0x00, 0x4c, 0x02, 0x00, 0x00, 0x2c,
+    0x00, 0x98, 0x00, 0x88, 0x00, 0x8f, 0x00, 0x8d, 0x00, 0x88, 0x00, 0x89, 0x00, 0x18, 0x00, 0x00,
+    0x00, 0x46, 0x01, 0x97, 0x00, 0x48, 0x0c, 0x00, 0x00, 0x11, 0x00, 0x8a, 0x00, 0x96, 0x00, 0x80,
+    0x00, 0x2c, 0x00, 0x5a, 0x01, 0x97, 0x00, 0x48, 0x0b, 0x00, 0x00, 0x3e, 0x01, 0x97, 0x00, 0x51,
+    0x02, 0x00, 0x00, 0x0e, 0x00, 0x7e, 0x00, 0x97, 0x01, 0x8c, 0x00, 0x88, 0x00, 0x99, 0x00, 0x1e,
+    0x02, 0x00, 0x00, 0x22, 0x00, 0x8d, 0x00, 0x88, 0x00, 0x97, 0x00, 0x3e, 0x00, 0x06, 0x00, 0x75,
+    0x00, 0x97, 0x01, 0x8c, 0x00, 0x88, 0x00, 0x9a, 0x00, 0x27, 0x02, 0x00, 0x00, 0x22, 0x00, 0x97,
+    0x00, 0x88, 0x00, 0x6e, 0x00, 0x03, 0x00, 0x00, 0x00, 0x18, 0x00, 0x80, 0x00, 0x96, 0x00, 0x8c,
+    0x00, 0x36, 0x07, 0x00, 0x00, 0x03, 0x01, 0x0e, 0x00, 0x0b, 0x00, 0x1b, 0x00, 0x7d, 0x00, 0x96,
+    0x00, 0x75, 0x00, 0x0a, 0x02, 0x00, 0x00, 0x11, 0x00, 0x81, 0x00, 0x88, 0x00, 0x8d, 0x9a, 0x00,
+    0x00, 0x6e, 0x00, 0x94, 0x00, 0x9a, 0x00, 0x2c, 0x11, 0x00, 0x00, 0x01, 0x00, 0x69, 0x01, 0x97,
+    0x00, 0x61, 0x00, 0x5f, 0x00, 0x96, 0x00, 0x97, 0x00, 0x29, 0x06, 0x00, 0x00, 0x5e, 0x00, 0x97,
+    0x00, 0x96, 0x00, 0x73, 0x00, 0x50, 0x00, 0x99, 0x00, 0x97, 0x00, 0x4c, 0x01, 0x00, 0x00, 0x0a,
+    0x00, 0x7e, 0x00, 0x8b, 0x00, 0x97, 0x00, 0x57, 0x00, 0x69, 0x00, 0x96, 0x00, 0x89, 0x00, 0x18,
+    0x00, 0x00, 0x00, 0x46, 0x01, 0x97, 0x00, 0x43, 0x0d, 0x00, 0x00, 0x47, 0x00, 0x97, 0x00, 0x88,
+    0x00, 0x9a, 0x00, 0x97, 0x00, 0x88, 0x00, 0x7e, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x4d,
+    0x00, 0x4e, 0x00, 0x16, 0x06, 0x00, 0x00, 0x3e, 0x01, 0x97, 0x00, 0x51, 0x02, 0x00, 0x00, 0x52,
+    0x00, 0x97, 0x00, 0x88, 0x00, 0x81, 0x00, 0x78, 0x00, 0x88, 0x00, 0x99, 0x00, 0x1e, 0x01, 0x00,
+    0x00, 0x03, 0x00, 0x73, 0x01, 0x97, 0x00, 0x69, 0x00, 0x00, 0x00, 0x45, 0x00, 0x99, 0x00, 0x88,
+    0x00, 0x81, 0x00, 0x79, 0x00, 0x88, 0x00, 0x9a, 0x00, 0x27, 0x02, 0x00, 0x00, 0x22, 0x00, 0x97,
+    0x00, 0x88, 0x00, 0x6e, 0x00, 0x03, 0x00, 0x00, 0x00, 0x33, 0x00, 0x9a, 0x00, 0x97, 0x00, 0x69,
+    0x0c, 0x00, 0x00, 0x1b, 0x00, 0x87, 0x00, 0x96, 0x00, 0x73, 0x00, 0x06, 0x02, 0x00, 0x00, 0x0f,
+    0x00, 0x81, 0x00, 0x88, 0x00, 0x8d, 0x9a, 0x00, 0x00, 0x93, 0x00, 0x88, 0x00, 0x81, 0x00, 0x0e,
+    0x11, 0x00, 0x00, 0x41, 0x00, 0x99, 0x00, 0x88, 0x00, 0x8d, 0x00, 0x20, 0x00, 0x56, 0x01, 0x97,
+    0x00, 0x29, 0x05, 0x00, 0x00, 0x38, 0x00, 0x9a, 0x00, 0x88, 0x00, 0x98, 0x00, 0x18, 0x00, 0x30,
+    0x00, 0x99, 0x00, 0x97, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x5b, 0x01, 0x97, 0x00, 0x7e,
+    0x00, 0x19, 0x00, 0x6b, 0x00, 0x94, 0x00, 0x89, 0x00, 0x18, 0x00, 0x00, 0x00, 0x46, 0x00, 0x97,
+    0x00, 0x88, 0x00, 0x74, 0x00, 0x48, 0x00, 0x53, 0x01, 0x51, 0x00, 0x57, 0x00, 0x23, 0x07, 0x00,
+    0x00, 0x03, 0x00, 0x70, 0x00, 0x97, 0x01, 0x88, 0x00, 0x7d, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x11,
+    0x00, 0x8a, 0x00, 0xa1, 0x00, 0x80, 0x00, 0x0e, 0x06, 0x00, 0x00, 0x3e, 0x01, 0x97, 0x00, 0x51,
+    0x01, 0x00, 0x00, 0x2c, 0x00, 0x8f, 0x00, 0x88, 0x00, 0x9a, 0x00, 0x2c, 0x00, 0x6a, 0x00, 0x96,
+    0x00, 0x99, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x4f, 0x00, 0x99, 0x00, 0x94, 0x00, 0x8a,
+    0x00, 0x12, 0x00, 0x20, 0x00, 0x8d, 0x00, 0x88, 0x00, 0x99, 0x00, 0x35, 0x00, 0x62, 0x00, 0x97,
+    0x00, 0x9a, 0x00, 0x27, 0x02, 0x00, 0x00, 0x22, 0x00, 0x97, 0x00, 0x88, 0x00, 0x6e, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x5e, 0x00, 0x96, 0x00, 0x99, 0x00, 0x2c, 0x0c, 0x00, 0x00, 0x1b, 0x00, 0x87,
+    0x00, 0x94, 0x00, 0x80, 0x00, 0x41, 0x00, 0x42, 0x00, 0x43, 0x00, 0x42, 0x00, 0x41, 0x00, 0x8d,
+    0x00, 0x88, 0x00, 0x8d, 0x9a, 0x00, 0x00, 0x8d, 0x00, 0x96, 0x00, 0x5d, 0x00, 0x01, 0x04, 0x00,
+    0x00, 0x1c, 0x00, 0x25, 0x04, 0x23, 0x00, 0x25, 0x00, 0x1d, 0x02, 0x00, 0x00, 0x16, 0x00, 0x8d,
+    0x00, 0x88, 0x00, 0x99, 0x00, 0x48, 0x00, 0x00, 0x00, 0x62, 0x01, 0x97, 0x00, 0x29, 0x04, 0x00,
+    0x00, 0x10, 0x00, 0x80, 0x00, 0x94, 0x00, 0x99, 0x00, 0x52, 0x00, 0x01, 0x00, 0x3d, 0x00, 0x99,
+    0x00, 0x97, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x98, 0x00, 0x88, 0x00, 0x9a, 0x00, 0x2c,
+    0x00, 0x03, 0x00, 0x76, 0x00, 0x94, 0x00, 0x89, 0x00, 0x18, 0x00, 0x00, 0x00, 0x46, 0x00, 0x97,
+    0x00, 0x89, 0x00, 0x88, 0x03, 0x97, 0x00, 0xa0, 0x00, 0x51, 0x06, 0x00, 0x00, 0x03, 0x00, 0x5a,
+    0x01, 0x8c, 0x00, 0x99, 0x00, 0x88, 0x00, 0x87, 0x00, 0x45, 0x00, 0x00, 0x00, 0x45, 0x00, 0x99,
+    0x00, 0x97, 0x00, 0x48, 0x07, 0x00, 0x00, 0x3e, 0x01, 0x97, 0x00, 0x51, 0x00, 0x00, 0x00, 0x09,
+    0x00, 0x7c, 0x00, 0x94, 0x00, 0x97, 0x00, 0x5e, 0x00, 0x06, 0x00, 0x77, 0x00, 0x88, 0x00, 0x99,
+    0x00, 0x1e, 0x00, 0x00, 0x00, 0x22, 0x00, 0x8d, 0x00, 0x88, 0x00, 0x99, 0x00, 0x3e, 0x00, 0x01,
+    0x00, 0x73, 0x00, 0x96, 0x00, 0x97, 0x00, 0x6b, 0x00, 0x04, 0x00, 0x6c, 0x00, 0x97, 0x00, 0x9a,
+    0x00, 0x27, 0x02, 0x00, 0x00, 0x22, 0x00, 0x97, 0x00, 0x88, 0x00, 0x6e, 0x01, 0x01, 0x00, 0x79,
+    0x00, 0x88, 0x00, 0x9c, 0x00, 0x15, 0x0c, 0x00, 0x00, 0x1b, 0x00, 0x87, 0x00, 0x89, 0x00, 0x88,
+    0x04, 0x97, 0x01, 0x88, 0x00, 0x8d, 0x9a, 0x00, 0x00, 0x8d, 0x00, 0x96, 0x00, 0x5d, 0x00, 0x01,
+    0x03, 0x00, 0x00, 0x01, 0x00, 0x80, 0x06, 0x89, 0x00, 0x90, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06,
+    0x00, 0x6b, 0x01, 0x97, 0x00, 0x69, 0x00, 0x06, 0x00, 0x00, 0x00, 0x5f, 0x01, 0x97, 0x00, 0x29,
+    0x04, 0x00, 0x00, 0x67, 0x00, 0x97, 0x00, 0x96, 0x00, 0x7c, 0x00, 0x06, 0x00, 0x00, 0x00, 0x3d,
+    0x00, 0x99, 0x00, 0x97, 0x00, 0x4b, 0x00, 0x0c, 0x00, 0x81, 0x00, 0x88, 0x00, 0x97, 0x00, 0x5b,
+    0x00, 0x00, 0x00, 0x08, 0x00, 0x76, 0x00, 0x94, 0x00, 0x89, 0x00, 0x18, 0x00, 0x00, 0x00, 0x46,
+    0x00, 0x97, 0x00, 0x89, 0x00, 0x88, 0x03, 0x97, 0x00, 0xa1, 0x00, 0x51, 0x05, 0x00, 0x00, 0x03,
+    0x00, 0x5a, 0x00, 0xa0, 0x00, 0x97, 0x00, 0x7e, 0x00, 0x52, 0x00, 0x8d, 0x00, 0x96, 0x00, 0x97,
+    0x00, 0x53, 0x00, 0x70, 0x00, 0x96, 0x00, 0x8a, 0x00, 0x0c, 0x07, 0x00, 0x00, 0x3e, 0x01, 0x97,
+    0x00, 0x51, 0x00, 0x00, 0x00, 0x55, 0x00, 0x99, 0x00, 0x88, 0x00, 0x80, 0x00, 0x0a, 0x00, 0x00,
+    0x00, 0x77, 0x00, 0x88, 0x00, 0x99, 0x00, 0x18, 0x00, 0x08, 0x00, 0x75, 0x00, 0x96, 0x00, 0x97,
+    0x00, 0x67, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x99, 0x00, 0x88, 0x00, 0x8a, 0x00, 0x10, 0x00, 0x00,
+    0x00, 0x6d, 0x00, 0x97, 0x00, 0x9a, 0x00, 0x27, 0x02, 0x00, 0x00, 0x22, 0x00, 0x97, 0x00, 0x88,
+    0x00, 0x6e, 0x01, 0x01, 0x00, 0x79, 0x00, 0x88, 0x00, 0x9c, 0x00, 0x15, 0x0c, 0x00, 0x00, 0x1b,
+    0x00, 0x87, 0x00, 0x89, 0x00, 0x88, 0x04, 0x97, 0x01, 0x88, 0x00, 0x8d, 0x9a, 0x00, 0x00, 0x92,
+    0x00, 0x88, 0x00, 0x81, 0x00, 0x0e, 0x03, 0x00, 0x00, 0x01, 0x00, 0x8d, 0x00, 0x99, 0x01, 0x97,
+    0x00, 0x99, 0x00, 0x97, 0x00, 0x89, 0x00, 0x88, 0x00, 0x85, 0x00, 0x06, 0x00, 0x00, 0x00, 0x3e,
+    0x00, 0x99, 0x00, 0x88, 0x00, 0x9a, 0x00, 0x43, 0x00, 0x2d, 0x00, 0x2a, 0x00, 0x74, 0x00, 0x88,
+    0x00, 0x97, 0x00, 0x29, 0x03, 0x00, 0x00, 0x38, 0x00, 0x97, 0x00, 0x88, 0x00, 0x8f, 0x00, 0x2a,
+    0x01, 0x00, 0x00, 0x3d, 0x00, 0x99, 0x00, 0x97, 0x00, 0x42, 0x00, 0x44, 0x00, 0x99, 0x00, 0x97,
+    0x00, 0x7e, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x08, 0x00, 0x76, 0x00, 0x94, 0x00, 0x89, 0x00, 0x18,
+    0x00, 0x00, 0x00, 0x46, 0x01, 0x97, 0x00, 0x69, 0x00, 0x2b, 0x00, 0x3c, 0x01, 0x38, 0x00, 0x41,
+    0x00, 0x1b, 0x05, 0x00, 0x00, 0x20, 0x00, 0x9b, 0x00, 0x94, 0x00, 0x7e, 0x00, 0x15, 0x00, 0x00,
+    0x00, 0x34, 0x00, 0x8a, 0x00, 0x96, 0x02, 0x97, 0x00, 0x4a, 0x08, 0x00, 0x00, 0x3e, 0x01, 0x97,
+    0x00, 0x43, 0x00, 0x24, 0x00, 0x8c, 0x00, 0x88, 0x00, 0x9a, 0x00, 0x36, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x77, 0x00, 0x88, 0x00, 0x99, 0x00, 0x10, 0x00, 0x40, 0x00, 0x99, 0x00, 0x88, 0x00, 0x8a,
+    0x00, 0x13, 0x00, 0x1a, 0x00, 0x8d, 0x00, 0x88, 0x00, 0x8d, 0x00, 0x49, 0x01, 0x07, 0x00, 0x6f,
+    0x00, 0x97, 0x00, 0x9a, 0x00, 0x27, 0x02, 0x00, 0x00, 0x22, 0x00, 0x97, 0x00, 0x88, 0x00, 0x6e,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x62, 0x00, 0x96, 0x00, 0x99, 0x00, 0x29, 0x0c, 0x00, 0x00, 0x1b,
+    0x00, 0x87, 0x00, 0x94, 0x00, 0x8a, 0x00, 0x43, 0x00, 0x46, 0x00, 0x48, 0x01, 0x46, 0x00, 0x8d,
+    0x00, 0x88, 0x00, 0x8d, 0x9a, 0x00, 0x00, 0x77, 0x00, 0x94, 0x00, 0x9a, 0x00, 0x29, 0x03, 0x00,
+    0x00, 0x01, 0x00, 0x50, 0x02, 0x58, 0x00, 0x44, 0x00, 0x75, 0x00, 0x8c, 0x00, 0x97, 0x00, 0x50,
+    0x00, 0x00, 0x00, 0x1a, 0x00, 0x90, 0x00, 0x88, 0x02, 0x89, 0x01, 0x8c, 0x01, 0x89, 0x00, 0x97,
+    0x00, 0x29, 0x02, 0x00, 0x00, 0x13, 0x00, 0x8a, 0x00, 0x88, 0x00, 0x99, 0x00, 0x50, 0x02, 0x00,
+    0x00, 0x3d, 0x00, 0x99, 0x00, 0x88, 0x00, 0x77, 0x00, 0x8d, 0x00, 0x88, 0x00, 0x9a, 0x00, 0x2e,
+    0x01, 0x00, 0x00, 0x08, 0x00, 0x76, 0x00, 0x94, 0x00, 0x89, 0x00, 0x18, 0x00, 0x00, 0x00, 0x46,
+    0x01, 0x97, 0x00, 0x43, 0x0b, 0x00, 0x00, 0x51, 0x00, 0x96, 0x00, 0x9a, 0x00, 0x29, 0x02, 0x00,
+    0x00, 0x22, 0x00, 0x7b, 0x00, 0x89, 0x00, 0x88, 0x00, 0x9c, 0x00, 0x22, 0x08, 0x00, 0x00, 0x3e,
+    0x01, 0x97, 0x00, 0x53, 0x00, 0x71, 0x00, 0x96, 0x00, 0x97, 0x00, 0x5a, 0x01, 0x00, 0x00, 0x01,
+    0x00, 0x77, 0x00, 0x88, 0x00, 0x8f, 0x00, 0x48, 0x00, 0x8d, 0x00, 0x88, 0x00, 0x99, 0x00, 0x38,
+    0x00, 0x01, 0x00, 0x75, 0x00, 0x97, 0x00, 0x88, 0x00, 0x89, 0x00, 0x82, 0x01, 0x85, 0x00, 0x8d,
+    0x00, 0x88, 0x00, 0x9a, 0x00, 0x27, 0x02, 0x00, 0x00, 0x22, 0x00, 0x97, 0x00, 0x88, 0x00, 0x6e,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x35, 0x00, 0x99, 0x00, 0x97, 0x00, 0x69, 0x0c, 0x00, 0x00, 0x1b,
+    0x00, 0x87, 0x00, 0x96, 0x00, 0x73, 0x00, 0x08, 0x02, 0x00, 0x00, 0x0f, 0x00, 0x81, 0x00, 0x88,
+    0x00, 0x8d, 0x9a, 0x00, 0x00, 0x32, 0x00, 0x9a, 0x00, 0x94, 0x00, 0x73, 0x00, 0x02, 0x07, 0x00,
+    0x00, 0x03, 0x00, 0x71, 0x00, 0x96, 0x00, 0x8f, 0x00, 0x24, 0x00, 0x00, 0x00, 0x66, 0x00, 0x97,
+    0x00, 0x88, 0x04, 0x97, 0x00, 0x88, 0x00, 0x89, 0x00, 0x97, 0x00, 0x29, 0x01, 0x00, 0x00, 0x02,
+    0x00, 0x61, 0x00, 0x97, 0x00, 0x96, 0x00, 0x7c, 0x00, 0x0a, 0x02, 0x00, 0x00, 0x3d, 0x00, 0x99,
+    0x00, 0x89, 0x00, 0x97, 0x00, 0x89, 0x00, 0x99, 0x00, 0x5b, 0x02, 0x00, 0x00, 0x08, 0x00, 0x76,
+    0x00, 0x94, 0x00, 0x89, 0x00, 0x18, 0x00, 0x00, 0x00, 0x46, 0x01, 0x97, 0x00, 0x48, 0x0b, 0x00,
+    0x00, 0x63, 0x00, 0x96, 0x00, 0x90, 0x00, 0x20, 0x03, 0x00, 0x00, 0x41, 0x00, 0x9a, 0x00, 0x88,
+    0x00, 0x8c, 0x00, 0x73, 0x00, 0x0e, 0x07, 0x00, 0x00, 0x3e, 0x00, 0x97, 0x00, 0x89, 0x00, 0x8d,
+    0x00, 0x8c, 0x00, 0x88, 0x00, 0x81, 0x00, 0x11, 0x01, 0x00, 0x00, 0x01, 0x00, 0x77, 0x00, 0x88,
+    0x00, 0x8c, 0x00, 0x90, 0x00, 0x88, 0x00, 0x97, 0x00, 0x69, 0x00, 0x01, 0x00, 0x48, 0x00, 0x97,
+    0x00, 0x89, 0x06, 0x88, 0x00, 0x9a, 0x00, 0x27, 0x02, 0x00, 0x00, 0x22, 0x00, 0x97, 0x00, 0x88,
+    0x00, 0x6e, 0x00, 0x03, 0x00, 0x00, 0x00, 0x18, 0x00, 0x8a, 0x00, 0x96, 0x00, 0x8d, 0x00, 0x2c,
+    0x07, 0x00, 0x00, 0x01, 0x01, 0x0e, 0x00, 0x0c, 0x00, 0x1b, 0x00, 0x7d, 0x00, 0x96, 0x00, 0x75,
+    0x00, 0x0a, 0x02, 0x00, 0x00, 0x11, 0x00, 0x81, 0x00, 0x88, 0x00, 0x8d, 0x9a, 0x00, 0x00, 0x08,
+    0x00, 0x73, 0x01, 0x97, 0x00, 0x67, 0x00, 0x05, 0x05, 0x00, 0x00, 0x06, 0x00, 0x66, 0x01, 0x97,
+    0x00, 0x69, 0x00, 0x00, 0x00, 0x41, 0x00, 0x9a, 0x00, 0x88, 0x00, 0x8d, 0x00, 0x50, 0x00, 0x52,
+    0x00, 0x59, 0x00, 0x5a, 0x00, 0x4e, 0x00, 0x7e, 0x00, 0x88, 0x00, 0x97, 0x00, 0x29, 0x01, 0x00,
+    0x00, 0x38, 0x00, 0x9a, 0x00, 0x88, 0x00, 0x8d, 0x00, 0x24, 0x03, 0x00, 0x00, 0x3d, 0x00, 0x99,
+    0x00, 0x89, 0x00, 0x88, 0x00, 0x96, 0x00, 0x7e, 0x00, 0x0e, 0x02, 0x00, 0x00, 0x08, 0x00, 0x76,
+    0x00, 0x94, 0x00, 0x89, 0x00, 0x18, 0x00, 0x00, 0x00, 0x46, 0x01, 0x97, 0x00, 0x46, 0x0b, 0x00,
+    0x00, 0x48, 0x00, 0x97, 0x00, 0x9a, 0x00, 0x2c, 0x02, 0x00, 0x00, 0x03, 0x00, 0x69, 0x00, 0x96,
+    0x02, 0x97, 0x00, 0x7c, 0x00, 0x10, 0x06, 0x00, 0x00, 0x3e, 0x00, 0x97, 0x00, 0x89, 0x01, 0x88,
+    0x00, 0x9a, 0x00, 0x33, 0x02, 0x00, 0x00, 0x01, 0x00, 0x77, 0x02, 0x88, 0x00, 0x96, 0x00, 0x80,
+    0x00, 0x0e, 0x00, 0x20, 0x00, 0x8d, 0x00, 0x88, 0x00, 0x97, 0x03, 0x90, 0x00, 0x92, 0x00, 0x8d,
+    0x00, 0x88, 0x00, 0x9a, 0x00, 0x27, 0x02, 0x00, 0x00, 0x22, 0x00, 0x97, 0x00, 0x88, 0x00, 0x6e,
+    0x00, 0x03, 0x01, 0x00, 0x00, 0x50, 0x00, 0x99, 0x00, 0x88, 0x00, 0x80, 0x00, 0x2a, 0x05, 0x00,
+    0x00, 0x06, 0x00, 0x5e, 0x01, 0x93, 0x00, 0x71, 0x00, 0x13, 0x00, 0x7a, 0x00, 0x96, 0x00, 0x75,
+    0x00, 0x0a, 0x02, 0x00, 0x00, 0x11, 0x00, 0x81, 0x00, 0x88, 0x00, 0x8d, 0x9b, 0x00, 0x00, 0x1b,
+    0x00, 0x89, 0x00, 0x88, 0x00, 0x99, 0x00, 0x71, 0x00, 0x29, 0x00, 0x11, 0x01, 0x08, 0x00, 0x11,
+    0x00, 0x32, 0x00, 0x72, 0x00, 0x97, 0x00, 0x88, 0x00, 0x80, 0x00, 0x10, 0x00, 0x16, 0x00, 0x8a,
+    0x00, 0x88, 0x00, 0x99, 0x00, 0x4a, 0x04, 0x00, 0x00, 0x62, 0x01, 0x97, 0x00, 0x29, 0x00, 0x00,
+    0x00, 0x16, 0x00, 0x8a, 0x00, 0x88, 0x00, 0x97, 0x00, 0x50, 0x00, 0x01, 0x03, 0x00, 0x00, 0x3d,
+    0x00, 0x99, 0x00, 0x89, 0x00, 0x88, 0x00, 0x9a, 0x00, 0x33, 0x03, 0x00, 0x00, 0x08, 0x00, 0x76,
+    0x00, 0x94, 0x00, 0x89, 0x00, 0x18, 0x00, 0x00, 0x00, 0x46, 0x00, 0x97, 0x00, 0x88, 0x00, 0x81,
+    0x00, 0x6e, 0x00, 0x74, 0x01, 0x6e, 0x00, 0x76, 0x00, 0x36, 0x05, 0x00, 0x00, 0x1a, 0x00, 0x9a,
+    0x00, 0x88, 0x00, 0x7b, 0x00, 0x27, 0x00, 0x16, 0x00, 0x15, 0x00, 0x5a, 0x00, 0x99, 0x00, 0x97,
+    0x00, 0x69, 0x00, 0x6c, 0x01, 0x97, 0x00, 0x7b, 0x00, 0x20, 0x00, 0x01, 0x04, 0x00, 0x00, 0x3e,
+    0x00, 0x97, 0x01, 0x89, 0x00, 0x97, 0x00, 0x5e, 0x00, 0x01, 0x02, 0x00, 0x00, 0x01, 0x00, 0x77,
+    0x00, 0x88, 0x00, 0x89, 0x00, 0x88, 0x00, 0x9a, 0x00, 0x3c, 0x00, 0x03, 0x00, 0x73, 0x00, 0x96,
+    0x00, 0x97, 0x00, 0x69, 0x00, 0x0e, 0x02, 0x0d, 0x00, 0x0e, 0x00, 0x74, 0x00, 0x95, 0x00, 0x9a,
+    0x00, 0x27, 0x02, 0x00, 0x00, 0x22, 0x00, 0x97, 0x00, 0x88, 0x00, 0x6e, 0x00, 0x03, 0x01, 0x00,
+    0x00, 0x0a, 0x00, 0x75, 0x00, 0x97, 0x00, 0x88, 0x00, 0x8d, 0x00, 0x50, 0x00, 0x15, 0x00, 0x11,
+    0x00, 0x0e, 0x00, 0x16, 0x00, 0x33, 0x00, 0x72, 0x00, 0x99, 0x00, 0x88, 0x00, 0x97, 0x00, 0x33,
+    0x00, 0x13, 0x00, 0x7d, 0x00, 0x96, 0x00, 0x75, 0x00, 0x0a, 0x02, 0x00, 0x00, 0x11, 0x00, 0x81,
+    0x00, 0x88, 0x00, 0x8d, 0x9c, 0x00, 0x00, 0x2c, 0x00, 0x87, 0x00, 0x97, 0x00, 0x96, 0x00, 0x9a,
+    0x00, 0x8e, 0x01, 0x6b, 0x00, 0x90, 0x00, 0x99, 0x00, 0x96, 0x00, 0x99, 0x00, 0x7e, 0x00, 0x17,
+    0x00, 0x06, 0x00, 0x71, 0x01, 0x97, 0x00, 0x71, 0x00, 0x06, 0x04, 0x00, 0x00, 0x62, 0x00, 0x96,
+    0x00, 0x97, 0x00, 0x29, 0x00, 0x00, 0x00, 0x65, 0x00, 0x97, 0x00, 0x94, 0x00, 0x7c, 0x00, 0x06,
+    0x04, 0x00, 0x00, 0x3d, 0x00, 0x97, 0x00, 0x88, 0x00, 0x97, 0x00, 0x52, 0x04, 0x00, 0x00, 0x08,
+    0x00, 0x76, 0x00, 0x94, 0x00, 0x89, 0x00, 0x18, 0x00, 0x00, 0x00, 0x46, 0x00, 0x96, 0x01, 0x88,
+    0x03, 0x96, 0x00, 0x99, 0x00, 0x51, 0x05, 0x00, 0x00, 0x03, 0x00, 0x5b, 0x00, 0xa0, 0x00, 0x94,
+    0x00, 0x99, 0x00, 0x9d, 0x00, 0x9c, 0x00, 0x97, 0x00, 0x96, 0x00, 0x7d, 0x00, 0x10, 0x00, 0x05,
+    0x00, 0x69, 0x00, 0x99, 0x00, 0x96, 0x00, 0x76, 0x00, 0x0a, 0x04, 0x00, 0x00, 0x3e, 0x00, 0x97,
+    0x00, 0x89, 0x00, 0x8b, 0x00, 0x80, 0x00, 0x0e, 0x03, 0x00, 0x00, 0x01, 0x00, 0x77, 0x00, 0x88,
+    0x00, 0x89, 0x00, 0x97, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x48, 0x00, 0x99, 0x00, 0x94, 0x00, 0x8a,
+    0x00, 0x13, 0x04, 0x00, 0x00, 0x6c, 0x00, 0x97, 0x00, 0x9a, 0x00, 0x27, 0x02, 0x00, 0x00, 0x22,
+    0x00, 0x97, 0x00, 0x88, 0x00, 0x6e, 0x00, 0x03, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x7e, 0x00, 0x99,
+    0x00, 0x94, 0x00, 0x97, 0x00, 0x9b, 0x00, 0x8e, 0x00, 0x81, 0x00, 0x90, 0x00, 0x99, 0x00, 0x96,
+    0x00, 0x97, 0x00, 0x8c, 0x00, 0x43, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x87, 0x00, 0x96, 0x00, 0x75,
+    0x00, 0x0a, 0x02, 0x00, 0x00, 0x11, 0x00, 0x81, 0x00, 0x88, 0x00, 0x8d, 0x9d, 0x00, 0x00, 0x18,
+    0x00, 0x71, 0x00, 0x9a, 0x00, 0x96, 0x00, 0x88, 0x01, 0x96, 0x00, 0x88, 0x00, 0x96, 0x00, 0x9a,
+    0x00, 0x69, 0x00, 0x10, 0x00, 0x00, 0x00, 0x50, 0x00, 0xa3, 0x00, 0xa2, 0x00, 0x90, 0x00, 0x20,
+    0x05, 0x00, 0x00, 0x6c, 0x00, 0xa3, 0x00, 0xa5, 0x00, 0x21, 0x00, 0x35, 0x00, 0xa6, 0x00, 0xa2,
+    0x00, 0x9c, 0x00, 0x27, 0x05, 0x00, 0x00, 0x45, 0x00, 0xa8, 0x00, 0xa2, 0x00, 0x7f, 0x00, 0x11,
+    0x04, 0x00, 0x00, 0x08, 0x00, 0x82, 0x00, 0xa2, 0x00, 0x9b, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x48,
+    0x00, 0xa7, 0x05, 0x9b, 0x00, 0xa3, 0x00, 0x4c, 0x06, 0x00, 0x00, 0x02, 0x00, 0x5b, 0x00, 0x8f,
+    0x00, 0x99, 0x00, 0x94, 0x00, 0x96, 0x00, 0x9b, 0x00, 0x7c, 0x00, 0x1a, 0x01, 0x00, 0x00, 0x06,
+    0x00, 0x69, 0x00, 0x8e, 0x00, 0x1b, 0x05, 0x00, 0x00, 0x41, 0x00, 0x96, 0x00, 0x88, 0x00, 0x9a,
+    0x00, 0x35, 0x04, 0x00, 0x00, 0x03, 0x00, 0x79, 0x00, 0x94, 0x00, 0x96, 0x00, 0x8a, 0x00, 0x13,
+    0x00, 0x26, 0x00, 0x8f, 0x00, 0x94, 0x00, 0x99, 0x00, 0x3e, 0x05, 0x00, 0x00, 0x6f, 0x00, 0x96,
+    0x00, 0xa0, 0x00, 0x29, 0x02, 0x00, 0x00, 0x24, 0x00, 0x96, 0x00, 0x94, 0x00, 0x74, 0x00, 0x03,
+    0x03, 0x00, 0x00, 0x0c, 0x00, 0x59, 0x00, 0x8d, 0x00, 0x97, 0x03, 0x88, 0x00, 0x94, 0x00, 0x9a,
+    0x00, 0x72, 0x00, 0x24, 0x01, 0x00, 0x00, 0x1b, 0x00, 0x87, 0x00, 0x96, 0x00, 0x75, 0x00, 0x0f,
+    0x02, 0x00, 0x00, 0x11, 0x00, 0x8e, 0x00, 0x94, 0x00, 0x99, 0x9e, 0x00, 0x00, 0x03, 0x00, 0x27,
+    0x00, 0x61, 0x00, 0x93, 0x01, 0x8d, 0x00, 0x93, 0x00, 0x5b, 0x00, 0x27, 0x02, 0x00, 0x00, 0x27,
+    0x00, 0x26, 0x00, 0x29, 0x00, 0x20, 0x06, 0x00, 0x00, 0x18, 0x00, 0x26, 0x00, 0x29, 0x00, 0x07,
+    0x00, 0x1a, 0x00, 0x28, 0x00, 0x29, 0x00, 0x1f, 0x06, 0x00, 0x00, 0x10, 0x00, 0x29, 0x00, 0x28,
+    0x00, 0x18, 0x05, 0x00, 0x00, 0x01, 0x00, 0x1f, 0x00, 0x28, 0x00, 0x27, 0x00, 0x06, 0x00, 0x00,
+    0x00, 0x10, 0x06, 0x29, 0x00, 0x26, 0x00, 0x10, 0x08, 0x00, 0x00, 0x1f, 0x00, 0x41, 0x00, 0x62,
+    0x00, 0x50, 0x00, 0x29, 0x00, 0x0e, 0x03, 0x00, 0x00, 0x06, 0x00, 0x1c, 0x06, 0x00, 0x00, 0x36,
+    0x00, 0x86, 0x00, 0x85, 0x00, 0x51, 0x06, 0x00, 0x00, 0x60, 0x00, 0x85, 0x00, 0x86, 0x00, 0x38,
+    0x00, 0x00, 0x00, 0x6f, 0x01, 0x82, 0x00, 0x5f, 0x06, 0x00, 0x00, 0x54, 0x00, 0x85, 0x00, 0x86,
+    0x00, 0x22, 0x02, 0x00, 0x00, 0x1b, 0x00, 0x83, 0x00, 0x82, 0x00, 0x57, 0x00, 0x01, 0x05, 0x00,
+    0x00, 0x1f, 0x00, 0x4a, 0x00, 0x91, 0x00, 0x8f, 0x00, 0x8d, 0x00, 0x93, 0x00, 0x6c, 0x00, 0x2b,
+    0x00, 0x08, 0x02, 0x00, 0x00, 0x11, 0x00, 0x79, 0x00, 0x82, 0x00, 0x64, 0x00, 0x06, 0x02, 0x00,
+    0x00, 0x08, 0x00, 0x6f, 0x00, 0x82, 0x00, 0x79, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
+    0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x4e, 0x00,
 #endif /* GNW_TARGET_ZELDA */
 };
-
-
@@ -1,73 +1,383 @@
+// Packed bitmap, see bitmaps.h. Generated by tools/img2bin.py --lut8-rle
 #if !defined(GNW_TARGET_ZELDA)
 #define GNW_TARGET_ZELDA 0
 #endif /* GNW_TARGET_ZELDA */
 
-const unsigned short header_nes[] = {
+const unsigned char header_nes[] __attribute__((aligned(4))) = {
 #if GNW_TARGET_ZELDA != 0
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xCCA9,0xCCA9,0xCCC9,0x4BC4,0x0320,0x0320,0x0320,0x9C88,0xD4C9,0xC4A9,0x1B62,0x2BA3,0xCCA9,0xD4C9,0x9447,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1361,0x2382,0x2382,0x0B41,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x5BE5,0xD4C9,0xD4C9,0x6406,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xD467,0xD446,0xDC46,0xBC47,0x1341,0x0320,0x0320,0xA447,0xDC66,0xD446,0x1B61,0x2BA3,0xB468,0xC487,0x8406,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x8405,0xD488,0xD4A8,0x4BE4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x63C4,0xDC87,0xDC67,0x6C05,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xD467,0xD446,0xD467,0xDC87,0x7C05,0x0320,0x0320,0xA447,0xDC67,0xCC47,0x2362,0x0320,0x0B41,0x0B41,0x0B40,0x0320,0x0320,0x0340,0x0320,0x0320,0x0B41,0x2382,0x0B41,0x0320,0x1B61,0x9446,0xC447,0xDC66,0xDC67,0xAC67,0x7C26,0x0320,0x0320,0x0B40,0x2382,0x1B61,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0340,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1B82,0x0B40,0x5BC4,0xDC87,0xDC67,0x6405,0x0320,0x0320,0x0320,0x0B40,0x2382,0x1361,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xD467,0xDC66,0xAC47,0x9447,0xDC87,0x3BA3,0x0320,0xA447,0xDC67,0xCC47,0x1B61,0x2383,0xB468,0xBC88,0x8426,0x0320,0x8426,0xBC88,0xAC68,0x7C26,0xBC67,0xD467,0xBC67,0x5BE4,0x0B41,0x43C4,0xA447,0xDC67,0xDC67,0x7C47,0x33A3,0x0B40,0x6C05,0xB467,0x9468,0xAC67,0xA467,0x3BA3,0x0320,0x0B41,0x7C26,0x8405,0x7406,0x53C4,0xAC67,0xBC88,0x8C26,0x2362,0x0320,0x0320,0x43A3,0xB467,0xCC67,0xB468,0xAC47,0xD467,0xDC67,0x6405,0x0320,0x0B41,0x7405,0xB467,0x9467,0xAC67,0x9C47,0x33A3,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xD467,0xDC66,0xB447,0x2BA3,0xCC67,0xB447,0x0B41,0xA447,0xDC67,0xCC47,0x1B61,0x33A3,0xD467,0xE487,0x9C26,0x0320,0xA426,0xE487,0xDC67,0xA447,0x53C4,0xA446,0xDC67,0xDC87,0x5BE4,0x0320,0x8C05,0xDC67,0xDC87,0x4BE4,0x0320,0x9426,0xE4A7,0xA426,0x0320,0x33A3,0xDC87,0xD488,0x3BA3,0x1361,0xCC88,0xE487,0xDC87,0xAC68,0x8C26,0xCC67,0xE487,0xBC67,0x2362,0x2B82,0xCC67,0xE487,0x9426,0x2B82,0x9C26,0xDC67,0xDC67,0x6405,0x0320,0x9C46,0xE4A7,0x9426,0x0320,0x43C4,0xDC87,0xD488,0x3BA3,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xD467,0xDC66,0xB467,0x0320,0x5BC4,0xE4A7,0x6C05,0x9426,0xDC67,0xCC47,0x1B61,0x2BA3,0xD467,0xDC67,0x9C26,0x0320,0x9C26,0xDC67,0xD467,0x2BA3,0x0320,0x43A3,0xDC87,0xDC67,0xA467,0x0320,0x8C05,0xDC67,0xDC87,0x4BE4,0x3BA3,0xDC87,0xD467,0xBC47,0x8C05,0xA447,0xDC87,0xE4A7,0xAC47,0x1B83,0xC488,0xDC66,0xC467,0x1341,0x0320,0x7C26,0xDC67,0xDC87,0x5BE4,0x8426,0xDC67,0xDC67,0x53E5,0x0320,0x5BC4,0xDC87,0xDC67,0x6405,0x43C4,0xDC87,0xDC67,0x8405,0x0320,0x33A3,0xD467,0xDC66,0xB468,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xD467,0xDC66,0xB467,0x0B41,0x0320,0xA426,0xCC87,0xBC67,0xD467,0xCC47,0x1B61,0x2BA3,0xD467,0xDC67,0x9C26,0x0320,0x9C26,0xDC67,0xD467,0x33A3,0x0320,0x43A3,0xDC88,0xDC67,0x9C47,0x0320,0x8C05,0xDC67,0xDC87,0x4BE4,0x5BC3,0xDC87,0xD467,0xB447,0x7426,0x7405,0x6C05,0x6C05,0x6405,0x23A3,0xC468,0xDC66,0xC468,0x0B41,0x0320,0x7426,0xDC67,0xDC67,0x63E4,0x9C67,0xDC67,0xDC67,0x5BE5,0x0320,0x5BC4,0xDC87,0xDC67,0x5BE5,0x6C05,0xDC87,0xDC67,0x8405,0x0320,0x33A3,0xD467,0xD446,0xDCA8,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xD467,0xDC66,0xB467,0x0B61,0x0320,0x2B82,0xD467,0xDC67,0xD447,0xCC47,0x1B61,0x2BA3,0xD467,0xDC67,0x9C26,0x0320,0x9C26,0xDC67,0xD467,0x33A3,0x0320,0x43A3,0xDC88,0xDC67,0x9C47,0x0320,0x8C05,0xDC67,0xDC87,0x4BC4,0x3BA3,0xDC87,0xDC67,0x9405,0x0320,0x1361,0x8426,0x9426,0x63E4,0x1362,0xC488,0xDC66,0xC468,0x0B41,0x0320,0x7426,0xDC67,0xDC67,0x5BC4,0x5BE4,0xDC87,0xDC67,0x53E5,0x0320,0x5BC4,0xDC87,0xDC67,0x6405,0x3BA3,0xDC87,0xDC67,0x8405,0x0320,0x33A3,0xD467,0xDC67,0xAC67,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xDC88,0xE487,0xBC68,0x0B61,0x0320,0x0320,0x6BE5,0xE487,0xDC87,0xD467,0x1B61,0x33A3,0xDC88,0xE4A7,0xA426,0x0320,0xA426,0xE4A7,0xDC88,0x33C3,0x0320,0x43A3,0xE4A8,0xE4A7,0xA468,0x0320,0x9425,0xE4A7,0xE4A8,0x53E5,0x0320,0x8C26,0xE4A7,0xA426,0x1361,0x4BE4,0xE4A8,0xD487,0x3BA3,0x1361,0xCC88,0xDC66,0xC468,0x0B41,0x0320,0x7C26,0xDC87,0xDC87,0x63C4,0x0B40,0xAC46,0xE4A7,0xAC47,0x6C06,0xB447,0xE487,0xE4A7,0x6C06,0x0320,0x9426,0xE4A7,0x9C26,0x1361,0x53E4,0xDC87,0xCC67,0x33A3,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x8406,0x8426,0x6C05,0x0B40,0x0320,0x0320,0x0B40,0x7405,0x8426,0x7C05,0x1341,0x1B62,0x8426,0x8426,0x5BC4,0x0320,0x63E4,0x8426,0x8426,0x1B62,0x0320,0x2B62,0x8426,0x8426,0x5BE5,0x0320,0x53C4,0x8426,0x8426,0x33A3,0x0320,0x0320,0x63E5,0xBC88,0xBC88,0xCCA9,0x9C67,0x33A3,0x0320,0x1361,0xAC89,0xBCA8,0xA488,0x0B40,0x0320,0x6426,0xC4A9,0xC4A9,0x53E5,0x0320,0x1361,0x7C26,0xBC88,0xA467,0x7C26,0x8405,0x8426,0x3BC3,0x0320,0x0B40,0x63E5,0xC4A9,0xBC88,0xCCA9,0x9C47,0x2BA3,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xD467,0xD446,0xDC67,0xDC67,0xDC67,0xE487,0xA406,0x4BE4,0xDC87,0xD446,0xDC87,0xDC87,0xDC87,0xDC67,0xD487,0x4BE4,0x9425,0xE4A7,0xDC67,0xD447,0xD447,0xDC87,0xD467,0x6C47,0xCC47,0xD447,0xDC87,0xDC87,0xDC87,0xE4A7,0x7C47,0x6BC4,0xDC87,0xD447,0xDC87,0xDC87,0xDC67,0xDC67,0x6BE5,0x7405,0xE4A7,0xDC67,0xD447,0xD447,0xDC67,0xE4A7,0x7C26,0x63E4,0xDC67,0xDC67,0xDC87,0xDC87,0xDC67,0xC467,0x1B62,0x7426,0xE4A7,0x9C47,0x6C05,0xDC67,0xD447,0xDC87,0xDC87,0xDC87,0xDC67,0xC467,0x2362,0x7426,0xDC67,0xD447,0xDC87,0xDC67,0xD447,0xD447,0xDC87,0xDC67,0xD487,0x3BA3,0x43C4,0xDC67,0xD447,0xDC67,0xDC67,0xDC67,0xE487,0x8C68,0xAC68,0xDC67,0xDC67,0xDC87,0xDC87,0xDC87,0xDC67,0xA447,0x2BA3,0xCC88,0xDC87,0xDC67,0xD447,0xD467,0xDC87,0xDC87,0x0320,0x0320,0x0320,0x0320,0x6405,0xD488,0xDC67,0xDC87,0xDC87,0xDC87,0xDC87,0xB4A9,0xDC67,0x8C26,0x0320,0x0320,0x33A3,0xDC88,0xC468,0x3BC4,0xAC67,0xDC87,0xDC87,0xDC87,0xDC87,0xE4A7,0x9C26,0xAC68,0xE487,0xDC67,0xD447,0xD447,0xDC87,0xDC88,0x7C26,0xD447,0xD467,0xDC87,0xDC87,0xDC87,0xE4A7,0x63C3,0x8447,0xDC67,0xD467,0xDC87,0xD467,0xD447,0xD447,0xDC87,0xDC67,0xC488,0x2B82,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xD467,0xCC67,0x8C47,0x8447,0x8447,0x8467,0x5BE5,0x4BE4,0xDC87,0xCC47,0x8426,0x7C26,0x7C26,0xA447,0xDC87,0xA467,0x53E4,0x7C26,0x9426,0xDC67,0xC467,0x7C26,0x7426,0x5C26,0xD467,0xC467,0x7C26,0x7C06,0x7C06,0x8426,0x43C4,0x6BE4,0xE487,0xC467,0x7406,0x7426,0x9447,0xDC67,0xC447,0x53E5,0x7C26,0x8C47,0xD467,0xD467,0x8C47,0x7C26,0x53E5,0xC447,0xDC67,0x9447,0x7426,0x7426,0xBC67,0xE487,0x6BE5,0x6C26,0xE4A7,0x9C47,0x6C05,0xDC87,0xBC67,0x7C26,0x7C26,0x7C26,0xBC67,0xE487,0x6BE5,0x6C26,0xDC87,0xBC47,0x7C26,0xAC67,0xDC67,0xC447,0x7C26,0xAC47,0xE487,0x9405,0x43E4,0xDC67,0xC468,0x8447,0x8447,0x8447,0x8467,0x4BE5,0xAC68,0xDC67,0xA446,0x7C26,0x7C26,0x7C26,0xCC67,0xDC87,0x5C06,0x6C06,0x7C26,0xAC67,0xDC67,0xB447,0x7C26,0x7C26,0x0320,0x0320,0x0320,0x0320,0xDC87,0xCC67,0x8405,0x7C05,0x7C05,0x7BE5,0x73E5,0x9467,0xE487,0x8426,0x0320,0x0320,0x2B82,0xDC88,0xBC67,0x8426,0xE487,0xAC47,0x7C05,0x7C05,0x7C05,0x7C05,0x5BC4,0x63E5,0x8405,0xA447,0xDC67,0xC467,0x8405,0x7C05,0x63E5,0xDC87,0xBC46,0x7C26,0x7C06,0x7C06,0x8426,0x3382,0x8447,0xDC87,0xBC46,0x7C05,0xBC67,0xDC67,0xBC47,0x7C05,0xB447,0xE487,0x8405,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xD467,0xD447,0xB467,0xAC67,0xAC67,0xB488,0x4BC4,0x43E4,0xDC87,0xC447,0x0320,0x0320,0x0320,0x53E5,0xE4A7,0xB488,0x0320,0x0320,0x3BA3,0xE487,0xB447,0x0320,0x0320,0x4BE5,0xDC67,0xCC67,0x9426,0x9426,0x9426,0x9446,0x1B61,0x6BE4,0xE487,0xB467,0x2B82,0x2361,0x5BE5,0xDC87,0xC447,0x1341,0x0320,0x1B62,0xD468,0xD488,0x2382,0x0320,0x1341,0xCC47,0xDC67,0x5C05,0x2361,0x2B62,0xAC67,0xE4A7,0x73E5,0x6C26,0xE4A7,0x9C47,0x6C05,0xE487,0x9446,0x0320,0x0320,0x0320,0x8C47,0xE4A7,0x73E4,0x6C26,0xE487,0x9C26,0x0320,0x6C26,0xE487,0xA426,0x0320,0x5C05,0xE4A7,0x9405,0x43E5,0xDC67,0xCC67,0xAC67,0xAC67,0xAC67,0xB488,0x2B82,0xAC68,0xE4A7,0x5BC4,0x0320,0x0320,0x0320,0xBC88,0xE487,0x53E4,0x0320,0x0320,0x7C26,0xE4A7,0x8405,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xC467,0xDC67,0x9426,0x8C05,0x8C05,0x8405,0x33A3,0x63E4,0xE487,0xB447,0x6C26,0x6426,0x8427,0xDC67,0xC468,0x7406,0xE487,0xB447,0x8405,0x8C05,0x8C05,0x6BE5,0x0B40,0x0320,0x0320,0x5C05,0xE487,0xAC68,0x0320,0x0320,0x43A3,0xDC87,0xC447,0x9426,0x9426,0x9426,0x9426,0x1B62,0x8447,0xE4A7,0x8C05,0x0320,0x8447,0xE487,0x8C05,0x0320,0x7426,0xE4A7,0x8C05,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xD467,0xD467,0x9C26,0x9426,0x9426,0x9C46,0x3BA3,0x4BE4,0xDC87,0xC447,0x0B40,0x0320,0x0320,0x5BE5,0xE4A7,0xB468,0x0320,0x0320,0x43A3,0xE487,0xB467,0x0B41,0x0320,0x4BE5,0xDC67,0xCC67,0xAC67,0xAC67,0xAC67,0xB488,0x2362,0x6BE4,0xDC87,0xD467,0xE487,0xE4A7,0xDC87,0xDC67,0x9426,0x0320,0x0320,0x2382,0xD468,0xD488,0x2BA3,0x0320,0x1341,0xC447,0xD467,0xDC87,0xE487,0xE4A7,0xD467,0xDC87,0x73E5,0x6C26,0xE4A7,0x9C47,0x6C05,0xE487,0x9447,0x0320,0x0320,0x0320,0x8C47,0xE4A7,0x6BE4,0x6C26,0xE487,0xA426,0x0320,0x6C26,0xE487,0xA426,0x0320,0x6405,0xE4A7,0x9405,0x43E5,0xDC67,0xCC67,0x9426,0x9426,0x9426,0x9446,0x2B82,0xAC68,0xE487,0x63C4,0x0320,0x0320,0x0B41,0xBC88,0xDC87,0x53E5,0x0320,0x0320,0x7C26,0xE4A7,0x8405,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x2382,0x8C26,0x9C47,0x9C47,0x9C47,0xD468,0xCC67,0x5BE5,0xC467,0xDC88,0xDC87,0xDC67,0xDC88,0xDC88,0x8405,0x0B40,0x5BE4,0x9C46,0x9C47,0x9C46,0xB467,0xE4A8,0x8405,0x0320,0x0320,0x6405,0xE487,0xB468,0x0320,0x0320,0x43A3,0xDC87,0xCC67,0xAC67,0xAC67,0xAC67,0xAC67,0x2382,0x8447,0xE4A7,0x8C05,0x0320,0x8447,0xE487,0x8C05,0x0320,0x7C26,0xE4A7,0x8C05,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xDC87,0xCC67,0x8447,0x7C47,0x7C47,0x8447,0x53E4,0x4BE4,0xDC87,0xC447,0x0B40,0x0320,0x0320,0x5BE5,0xE4A7,0xB468,0x0320,0x0320,0x43A3,0xE487,0xB467,0x0B41,0x0320,0x4BE5,0xDC87,0xC468,0x7C47,0x7C47,0x7C47,0x7C67,0x3BC4,0x6BE4,0xE487,0xBC67,0x63E4,0x5BC3,0x8426,0xDC87,0xA447,0x0320,0x0320,0x2382,0xD468,0xD488,0x2BA3,0x0320,0x1341,0xCC47,0xDC67,0x8426,0x5BC4,0x63C4,0xB467,0xE487,0x73E5,0x6C26,0xE4A7,0x9C47,0x6C05,0xE487,0x9447,0x0320,0x0320,0x0320,0x8C47,0xE4A7,0x6BE4,0x6C26,0xE487,0xA426,0x0320,0x6C26,0xE487,0xA426,0x0320,0x6405,0xE4A7,0x9405,0x43E4,0xDC67,0xC467,0x7C47,0x7C47,0x7C47,0x7C47,0x4BE5,0xAC68,0xE487,0x63C4,0x0320,0x0320,0x0B41,0xBC88,0xDC87,0x53E5,0x0320,0x0320,0x7C26,0xE4A7,0x8405,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x7426,0x7C26,0x7C47,0x7C47,0x7C47,0xBC68,0xDC87,0x33A3,0x2382,0x5405,0xC468,0xDC67,0x7C26,0x43C4,0x0320,0x43C4,0x7C26,0x7C47,0x7C47,0x7C47,0x9467,0xDC87,0xA426,0x0320,0x0320,0x6405,0xE487,0xB468,0x0320,0x0320,0x4BA3,0xE4A7,0xBC67,0x7C47,0x7C47,0x7C47,0x7C67,0x33A3,0x8447,0xE4A7,0x8C05,0x0320,0x8447,0xE487,0x8C05,0x0320,0x7C26,0xE4A7,0x8C05,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x8427,0xDC67,0xDC67,0xDC87,0xDC87,0xE4A7,0xA426,0x4BE4,0xDC88,0xC447,0x0B40,0x0320,0x0320,0x5BE5,0xE4A7,0xB468,0x0340,0x0320,0x43A3,0xE487,0xB467,0x0B41,0x0320,0x1361,0xB467,0xDC67,0xDC67,0xDC67,0xDC67,0xE4A7,0x7C47,0x6BC4,0xE487,0xA468,0x0320,0x0320,0x33C4,0xDC88,0xA447,0x0320,0x0320,0x2382,0xD488,0xD488,0x2BA3,0x0320,0x1341,0xC446,0xDC88,0x43C4,0x0320,0x0320,0x9C67,0xE4A7,0x73E5,0x6C26,0xE4A7,0x9C47,0x6C05,0xE487,0x9447,0x0320,0x0320,0x0320,0x9447,0xE4A7,0x6BE4,0x7426,0xE487,0xA406,0x0320,0x6C26,0xE487,0xA426,0x0320,0x6405,0xE4A7,0x9C05,0x1361,0xAC68,0xDC67,0xDC87,0xDC87,0xDC87,0xE4A7,0x8C68,0xA467,0xE487,0x63C4,0x0320,0x0320,0x0B41,0xBC68,0xDC87,0x53E5,0x0320,0x0320,0x8446,0xE4A7,0x83E5,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xDC87,0xDC87,0xDC67,0xDC67,0xDC67,0xDC67,0x9C46,0x0B40,0x0320,0x0B41,0xBC88,0xE487,0x4BA3,0x0320,0x0320,0x7C06,0xE4A7,0xDC67,0xDC67,0xDC67,0xDC67,0xCC67,0x43A3,0x0320,0x0320,0x6405,0xE487,0xB467,0x0320,0x0320,0x1B61,0xBC68,0xDC67,0xDC67,0xDC67,0xDC67,0xE4A7,0x5BC3,0x8447,0xE4A7,0x8C05,0x0320,0x8C47,0xE487,0x8C05,0x0320,0x7C26,0xE4A7,0x8C05,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
+    0x40, 0x01, 0x20, 0x00, 0x95, 0x00, 0x20, 0x03, 0x40, 0x03, 0x40, 0x0b, 0x41, 0x0b, 0x61, 0x0b,
+    0x41, 0x13, 0x61, 0x13, 0x62, 0x13, 0x61, 0x1b, 0x62, 0x1b, 0x82, 0x1b, 0x83, 0x1b, 0x61, 0x23,
+    0x62, 0x23, 0x82, 0x23, 0x83, 0x23, 0xa3, 0x23, 0x62, 0x2b, 0x82, 0x2b, 0xa3, 0x2b, 0x82, 0x33,
+    0xa3, 0x33, 0xc3, 0x33, 0xc4, 0x33, 0xa3, 0x3b, 0xc3, 0x3b, 0xc4, 0x3b, 0xa3, 0x43, 0xc4, 0x43,
+    0xe4, 0x43, 0xe5, 0x43, 0xa3, 0x4b, 0xc4, 0x4b, 0xe4, 0x4b, 0xe5, 0x4b, 0xc4, 0x53, 0xe4, 0x53,
+    0xe5, 0x53, 0x05, 0x54, 0xc3, 0x5b, 0xc4, 0x5b, 0xe4, 0x5b, 0xe5, 0x5b, 0x05, 0x5c, 0x06, 0x5c,
+    0x26, 0x5c, 0xc3, 0x63, 0xc4, 0x63, 0xe4, 0x63, 0xe5, 0x63, 0x05, 0x64, 0x06, 0x64, 0x26, 0x64,
+    0xc4, 0x6b, 0xe4, 0x6b, 0xe5, 0x6b, 0x05, 0x6c, 0x06, 0x6c, 0x26, 0x6c, 0x47, 0x6c, 0xe4, 0x73,
+    0xe5, 0x73, 0x05, 0x74, 0x06, 0x74, 0x26, 0x74, 0xe5, 0x7b, 0x05, 0x7c, 0x06, 0x7c, 0x26, 0x7c,
+    0x47, 0x7c, 0x67, 0x7c, 0xe5, 0x83, 0x05, 0x84, 0x06, 0x84, 0x26, 0x84, 0x27, 0x84, 0x46, 0x84,
+    0x47, 0x84, 0x67, 0x84, 0x05, 0x8c, 0x26, 0x8c, 0x47, 0x8c, 0x68, 0x8c, 0x05, 0x94, 0x25, 0x94,
+    0x26, 0x94, 0x46, 0x94, 0x47, 0x94, 0x67, 0x94, 0x68, 0x94, 0x05, 0x9c, 0x26, 0x9c, 0x46, 0x9c,
+    0x47, 0x9c, 0x67, 0x9c, 0x88, 0x9c, 0x06, 0xa4, 0x26, 0xa4, 0x46, 0xa4, 0x47, 0xa4, 0x67, 0xa4,
+    0x68, 0xa4, 0x88, 0xa4, 0x46, 0xac, 0x47, 0xac, 0x67, 0xac, 0x68, 0xac, 0x89, 0xac, 0x47, 0xb4,
+    0x67, 0xb4, 0x68, 0xb4, 0x88, 0xb4, 0xa9, 0xb4, 0x46, 0xbc, 0x47, 0xbc, 0x67, 0xbc, 0x68, 0xbc,
+    0x88, 0xbc, 0xa8, 0xbc, 0x46, 0xc4, 0x47, 0xc4, 0x67, 0xc4, 0x68, 0xc4, 0x87, 0xc4, 0x88, 0xc4,
+    0xa9, 0xc4, 0x47, 0xcc, 0x67, 0xcc, 0x87, 0xcc, 0x88, 0xcc, 0xa9, 0xcc, 0xc9, 0xcc, 0x46, 0xd4,
+    0x47, 0xd4, 0x67, 0xd4, 0x68, 0xd4, 0x87, 0xd4, 0x88, 0xd4, 0xa8, 0xd4, 0xc9, 0xd4, 0x46, 0xdc,
+    0x66, 0xdc, 0x67, 0xdc, 0x87, 0xdc, 0x88, 0xdc, 0xa8, 0xdc, 0x87, 0xe4, 0xa7, 0xe4, 0xa8, 0xe4,
+    0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
+    0xcb, 0x00, 0x01, 0x82, 0x00, 0x83, 0x00, 0x20, 0x02, 0x00, 0x00, 0x5f, 0x00, 0x8b, 0x00, 0x7d,
+    0x00, 0x09, 0x00, 0x13, 0x00, 0x82, 0x00, 0x8b, 0x00, 0x57, 0x0a, 0x00, 0x00, 0x06, 0x01, 0x0e,
+    0x00, 0x03, 0x17, 0x00, 0x00, 0x2a, 0x01, 0x8b, 0x00, 0x33, 0xff, 0x00, 0x05, 0x00, 0x00, 0x86,
+    0x00, 0x84, 0x00, 0x8c, 0x00, 0x72, 0x00, 0x05, 0x01, 0x00, 0x00, 0x63, 0x00, 0x8d, 0x00, 0x84,
+    0x00, 0x08, 0x00, 0x13, 0x00, 0x6e, 0x00, 0x7b, 0x00, 0x49, 0x0a, 0x00, 0x00, 0x48, 0x00, 0x89,
+    0x00, 0x8a, 0x00, 0x21, 0x17, 0x00, 0x00, 0x2f, 0x00, 0x8f, 0x00, 0x8e, 0x00, 0x38, 0xff, 0x00,
+    0x05, 0x00, 0x00, 0x86, 0x00, 0x84, 0x00, 0x86, 0x00, 0x8f, 0x00, 0x42, 0x01, 0x00, 0x00, 0x63,
+    0x00, 0x8e, 0x00, 0x7e, 0x00, 0x0d, 0x00, 0x00, 0x01, 0x03, 0x00, 0x02, 0x01, 0x00, 0x00, 0x01,
+    0x01, 0x00, 0x00, 0x03, 0x00, 0x0e, 0x00, 0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x56, 0x00, 0x78,
+    0x00, 0x8d, 0x00, 0x8e, 0x00, 0x69, 0x00, 0x44, 0x01, 0x00, 0x00, 0x02, 0x00, 0x0e, 0x00, 0x08,
+    0x08, 0x00, 0x00, 0x01, 0x05, 0x00, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x28, 0x00, 0x8f, 0x00, 0x8e,
+    0x00, 0x32, 0x02, 0x00, 0x00, 0x02, 0x00, 0x0e, 0x00, 0x06, 0xff, 0x00, 0x00, 0x86, 0x00, 0x8d,
+    0x00, 0x68, 0x00, 0x57, 0x00, 0x8f, 0x00, 0x18, 0x00, 0x00, 0x00, 0x63, 0x00, 0x8e, 0x00, 0x7e,
+    0x00, 0x08, 0x00, 0x0f, 0x00, 0x6e, 0x00, 0x75, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x75,
+    0x00, 0x6a, 0x00, 0x44, 0x00, 0x73, 0x00, 0x86, 0x00, 0x73, 0x00, 0x29, 0x00, 0x03, 0x00, 0x1c,
+    0x00, 0x63, 0x01, 0x8e, 0x00, 0x45, 0x00, 0x15, 0x00, 0x02, 0x00, 0x38, 0x00, 0x6d, 0x00, 0x59,
+    0x00, 0x69, 0x00, 0x64, 0x00, 0x18, 0x00, 0x00, 0x00, 0x03, 0x00, 0x44, 0x00, 0x48, 0x00, 0x3f,
+    0x00, 0x23, 0x00, 0x69, 0x00, 0x75, 0x00, 0x50, 0x00, 0x0d, 0x01, 0x00, 0x00, 0x1b, 0x00, 0x6d,
+    0x00, 0x7f, 0x00, 0x6e, 0x00, 0x68, 0x00, 0x86, 0x00, 0x8e, 0x00, 0x32, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x3e, 0x00, 0x6d, 0x00, 0x58, 0x00, 0x69, 0x00, 0x5d, 0x00, 0x15, 0xfd, 0x00, 0x00, 0x86,
+    0x00, 0x8d, 0x00, 0x6c, 0x00, 0x13, 0x00, 0x7f, 0x00, 0x6c, 0x00, 0x03, 0x00, 0x63, 0x00, 0x8e,
+    0x00, 0x7e, 0x00, 0x08, 0x00, 0x15, 0x00, 0x86, 0x00, 0x92, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x61,
+    0x00, 0x92, 0x00, 0x8e, 0x00, 0x63, 0x00, 0x23, 0x00, 0x62, 0x00, 0x8e, 0x00, 0x8f, 0x00, 0x29,
+    0x00, 0x00, 0x00, 0x4f, 0x00, 0x8e, 0x00, 0x8f, 0x00, 0x21, 0x00, 0x00, 0x00, 0x55, 0x00, 0x93,
+    0x00, 0x61, 0x00, 0x00, 0x00, 0x15, 0x00, 0x8f, 0x00, 0x89, 0x00, 0x18, 0x00, 0x06, 0x00, 0x81,
+    0x00, 0x92, 0x00, 0x8f, 0x00, 0x6a, 0x00, 0x50, 0x00, 0x7f, 0x00, 0x92, 0x00, 0x73, 0x00, 0x0d,
+    0x00, 0x12, 0x00, 0x7f, 0x00, 0x92, 0x00, 0x55, 0x00, 0x12, 0x00, 0x5b, 0x01, 0x8e, 0x00, 0x32,
+    0x00, 0x00, 0x00, 0x5c, 0x00, 0x93, 0x00, 0x55, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x8f, 0x00, 0x89,
+    0x00, 0x18, 0xfc, 0x00, 0x00, 0x86, 0x00, 0x8d, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x28, 0x00, 0x93,
+    0x00, 0x38, 0x00, 0x55, 0x00, 0x8e, 0x00, 0x7e, 0x00, 0x08, 0x00, 0x13, 0x00, 0x86, 0x00, 0x8e,
+    0x00, 0x5b, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x8e, 0x00, 0x86, 0x00, 0x13, 0x00, 0x00, 0x00, 0x1b,
+    0x00, 0x8f, 0x00, 0x8e, 0x00, 0x64, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x8e, 0x00, 0x8f, 0x00, 0x21,
+    0x00, 0x18, 0x00, 0x8f, 0x00, 0x86, 0x00, 0x72, 0x00, 0x4f, 0x00, 0x63, 0x00, 0x8f, 0x00, 0x93,
+    0x00, 0x68, 0x00, 0x0b, 0x00, 0x7c, 0x00, 0x8d, 0x00, 0x79, 0x00, 0x05, 0x00, 0x00, 0x00, 0x44,
+    0x00, 0x8e, 0x00, 0x8f, 0x00, 0x29, 0x00, 0x4a, 0x01, 0x8e, 0x00, 0x25, 0x00, 0x00, 0x00, 0x28,
+    0x00, 0x8f, 0x00, 0x8e, 0x00, 0x32, 0x00, 0x1c, 0x00, 0x8f, 0x00, 0x8e, 0x00, 0x48, 0x00, 0x00,
+    0x00, 0x15, 0x00, 0x86, 0x00, 0x8d, 0x00, 0x6e, 0xfc, 0x00, 0x00, 0x86, 0x00, 0x8d, 0x00, 0x6d,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x61, 0x00, 0x80, 0x00, 0x73, 0x00, 0x86, 0x00, 0x7e, 0x00, 0x08,
+    0x00, 0x13, 0x00, 0x86, 0x00, 0x8e, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x8e, 0x00, 0x86,
+    0x00, 0x15, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x90, 0x00, 0x8e, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x4f,
+    0x00, 0x8e, 0x00, 0x8f, 0x00, 0x21, 0x00, 0x27, 0x00, 0x8f, 0x00, 0x86, 0x00, 0x6c, 0x00, 0x40,
+    0x00, 0x3e, 0x01, 0x38, 0x00, 0x32, 0x00, 0x10, 0x00, 0x7a, 0x00, 0x8d, 0x00, 0x7a, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x40, 0x01, 0x8e, 0x00, 0x30, 0x00, 0x5e, 0x01, 0x8e, 0x00, 0x2a, 0x00, 0x00,
+    0x00, 0x28, 0x00, 0x8f, 0x00, 0x8e, 0x00, 0x2a, 0x00, 0x38, 0x00, 0x8f, 0x00, 0x8e, 0x00, 0x48,
+    0x00, 0x00, 0x00, 0x15, 0x00, 0x86, 0x00, 0x84, 0x00, 0x91, 0xfc, 0x00, 0x00, 0x86, 0x00, 0x8d,
+    0x00, 0x6d, 0x00, 0x04, 0x00, 0x00, 0x00, 0x12, 0x00, 0x86, 0x00, 0x8e, 0x00, 0x85, 0x00, 0x7e,
+    0x00, 0x08, 0x00, 0x13, 0x00, 0x86, 0x00, 0x8e, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x5b, 0x00, 0x8e,
+    0x00, 0x86, 0x00, 0x15, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x90, 0x00, 0x8e, 0x00, 0x5d, 0x00, 0x00,
+    0x00, 0x4f, 0x00, 0x8e, 0x00, 0x8f, 0x00, 0x20, 0x00, 0x18, 0x00, 0x8f, 0x00, 0x8e, 0x00, 0x53,
+    0x00, 0x00, 0x00, 0x06, 0x00, 0x4a, 0x00, 0x55, 0x00, 0x30, 0x00, 0x07, 0x00, 0x7c, 0x00, 0x8d,
+    0x00, 0x7a, 0x00, 0x03, 0x00, 0x00, 0x00, 0x40, 0x01, 0x8e, 0x00, 0x28, 0x00, 0x29, 0x00, 0x8f,
+    0x00, 0x8e, 0x00, 0x25, 0x00, 0x00, 0x00, 0x28, 0x00, 0x8f, 0x00, 0x8e, 0x00, 0x32, 0x00, 0x18,
+    0x00, 0x8f, 0x00, 0x8e, 0x00, 0x48, 0x00, 0x00, 0x00, 0x15, 0x00, 0x86, 0x00, 0x8e, 0x00, 0x69,
+    0xfc, 0x00, 0x00, 0x90, 0x00, 0x92, 0x00, 0x74, 0x00, 0x04, 0x01, 0x00, 0x00, 0x37, 0x00, 0x92,
+    0x00, 0x8f, 0x00, 0x86, 0x00, 0x08, 0x00, 0x15, 0x00, 0x90, 0x00, 0x93, 0x00, 0x61, 0x00, 0x00,
+    0x00, 0x61, 0x00, 0x93, 0x00, 0x90, 0x00, 0x16, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x94, 0x00, 0x93,
+    0x00, 0x65, 0x00, 0x00, 0x00, 0x54, 0x00, 0x93, 0x00, 0x94, 0x00, 0x25, 0x00, 0x00, 0x00, 0x50,
+    0x00, 0x93, 0x00, 0x61, 0x00, 0x06, 0x00, 0x21, 0x00, 0x94, 0x00, 0x88, 0x00, 0x18, 0x00, 0x06,
+    0x00, 0x81, 0x00, 0x8d, 0x00, 0x7a, 0x00, 0x03, 0x00, 0x00, 0x00, 0x44, 0x01, 0x8f, 0x00, 0x2f,
+    0x00, 0x02, 0x00, 0x67, 0x00, 0x93, 0x00, 0x68, 0x00, 0x39, 0x00, 0x6c, 0x00, 0x92, 0x00, 0x93,
+    0x00, 0x39, 0x00, 0x00, 0x00, 0x55, 0x00, 0x93, 0x00, 0x5b, 0x00, 0x06, 0x00, 0x24, 0x00, 0x8f,
+    0x00, 0x7f, 0x00, 0x15, 0xfc, 0x00, 0x00, 0x49, 0x00, 0x4a, 0x00, 0x38, 0x00, 0x02, 0x01, 0x00,
+    0x00, 0x02, 0x00, 0x3e, 0x00, 0x4a, 0x00, 0x42, 0x00, 0x05, 0x00, 0x09, 0x01, 0x4a, 0x00, 0x28,
+    0x00, 0x00, 0x00, 0x30, 0x01, 0x4a, 0x00, 0x09, 0x00, 0x00, 0x00, 0x11, 0x01, 0x4a, 0x00, 0x2a,
+    0x00, 0x00, 0x00, 0x23, 0x01, 0x4a, 0x00, 0x15, 0x01, 0x00, 0x00, 0x31, 0x01, 0x75, 0x00, 0x82,
+    0x00, 0x5e, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x6b, 0x00, 0x76, 0x00, 0x66, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x34, 0x01, 0x7d, 0x00, 0x25, 0x00, 0x00, 0x00, 0x06, 0x00, 0x44, 0x00, 0x75,
+    0x00, 0x64, 0x00, 0x44, 0x00, 0x48, 0x00, 0x4a, 0x00, 0x19, 0x00, 0x00, 0x00, 0x02, 0x00, 0x31,
+    0x00, 0x7d, 0x00, 0x75, 0x00, 0x82, 0x00, 0x5d, 0x00, 0x13, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
+    0x7d, 0x00, 0x00, 0x86, 0x00, 0x84, 0x02, 0x8e, 0x00, 0x92, 0x00, 0x60, 0x00, 0x21, 0x00, 0x8f,
+    0x00, 0x84, 0x02, 0x8f, 0x00, 0x8e, 0x00, 0x88, 0x00, 0x21, 0x00, 0x54, 0x00, 0x93, 0x00, 0x8e,
+    0x01, 0x85, 0x00, 0x8f, 0x00, 0x86, 0x00, 0x3b, 0x00, 0x7e, 0x00, 0x85, 0x02, 0x8f, 0x00, 0x93,
+    0x00, 0x45, 0x00, 0x35, 0x00, 0x8f, 0x00, 0x85, 0x01, 0x8f, 0x01, 0x8e, 0x00, 0x37, 0x00, 0x3e,
+    0x00, 0x93, 0x00, 0x8e, 0x01, 0x85, 0x00, 0x8e, 0x00, 0x93, 0x00, 0x44, 0x00, 0x30, 0x01, 0x8e,
+    0x01, 0x8f, 0x00, 0x8e, 0x00, 0x79, 0x00, 0x09, 0x00, 0x40, 0x00, 0x93, 0x00, 0x5d, 0x00, 0x38,
+    0x00, 0x8e, 0x00, 0x85, 0x02, 0x8f, 0x00, 0x8e, 0x00, 0x79, 0x00, 0x0d, 0x00, 0x40, 0x00, 0x8e,
+    0x00, 0x85, 0x00, 0x8f, 0x00, 0x8e, 0x01, 0x85, 0x00, 0x8f, 0x00, 0x8e, 0x00, 0x88, 0x00, 0x18,
+    0x00, 0x1c, 0x00, 0x8e, 0x00, 0x85, 0x02, 0x8e, 0x00, 0x92, 0x00, 0x52, 0x00, 0x6a, 0x01, 0x8e,
+    0x02, 0x8f, 0x00, 0x8e, 0x00, 0x63, 0x00, 0x13, 0x00, 0x81, 0x00, 0x8f, 0x00, 0x8e, 0x00, 0x85,
+    0x00, 0x86, 0x01, 0x8f, 0x03, 0x00, 0x00, 0x32, 0x00, 0x89, 0x00, 0x8e, 0x03, 0x8f, 0x00, 0x70,
+    0x00, 0x8e, 0x00, 0x50, 0x01, 0x00, 0x00, 0x15, 0x00, 0x90, 0x00, 0x7a, 0x00, 0x1a, 0x00, 0x69,
+    0x03, 0x8f, 0x00, 0x93, 0x00, 0x5b, 0x00, 0x6a, 0x00, 0x92, 0x00, 0x8e, 0x01, 0x85, 0x00, 0x8f,
+    0x00, 0x90, 0x00, 0x44, 0x00, 0x85, 0x00, 0x86, 0x02, 0x8f, 0x00, 0x93, 0x00, 0x2e, 0x00, 0x4d,
+    0x00, 0x8e, 0x00, 0x86, 0x00, 0x8f, 0x00, 0x86, 0x01, 0x85, 0x00, 0x8f, 0x00, 0x8e, 0x00, 0x7c,
+    0x00, 0x12, 0xa4, 0x00, 0x00, 0x86, 0x00, 0x7f, 0x00, 0x51, 0x01, 0x4d, 0x00, 0x4e, 0x00, 0x2a,
+    0x00, 0x21, 0x00, 0x8f, 0x00, 0x7e, 0x00, 0x4a, 0x01, 0x44, 0x00, 0x63, 0x00, 0x8f, 0x00, 0x64,
+    0x00, 0x24, 0x00, 0x44, 0x00, 0x55, 0x00, 0x8e, 0x00, 0x79, 0x00, 0x44, 0x00, 0x40, 0x00, 0x2d,
+    0x00, 0x86, 0x00, 0x79, 0x00, 0x44, 0x01, 0x43, 0x00, 0x4a, 0x00, 0x1c, 0x00, 0x36, 0x00, 0x92,
+    0x00, 0x79, 0x00, 0x3f, 0x00, 0x40, 0x00, 0x57, 0x00, 0x8e, 0x00, 0x78, 0x00, 0x25, 0x00, 0x44,
+    0x00, 0x51, 0x01, 0x86, 0x00, 0x51, 0x00, 0x44, 0x00, 0x25, 0x00, 0x78, 0x00, 0x8e, 0x00, 0x57,
+    0x01, 0x40, 0x00, 0x73, 0x00, 0x92, 0x00, 0x37, 0x00, 0x3a, 0x00, 0x93, 0x00, 0x5d, 0x00, 0x38,
+    0x00, 0x8f, 0x00, 0x73, 0x02, 0x44, 0x00, 0x73, 0x00, 0x92, 0x00, 0x37, 0x00, 0x3a, 0x00, 0x8f,
+    0x00, 0x72, 0x00, 0x44, 0x00, 0x69, 0x00, 0x8e, 0x00, 0x78, 0x00, 0x44, 0x00, 0x68, 0x00, 0x92,
+    0x00, 0x53, 0x00, 0x1d, 0x00, 0x8e, 0x00, 0x7a, 0x02, 0x4d, 0x00, 0x4e, 0x00, 0x22, 0x00, 0x6a,
+    0x00, 0x8e, 0x00, 0x62, 0x02, 0x44, 0x00, 0x7f, 0x00, 0x8f, 0x00, 0x2c, 0x00, 0x39, 0x00, 0x44,
+    0x00, 0x69, 0x00, 0x8e, 0x00, 0x6c, 0x01, 0x44, 0x03, 0x00, 0x00, 0x8f, 0x00, 0x7f, 0x00, 0x48,
+    0x01, 0x42, 0x00, 0x41, 0x00, 0x3d, 0x00, 0x58, 0x00, 0x92, 0x00, 0x4a, 0x01, 0x00, 0x00, 0x12,
+    0x00, 0x90, 0x00, 0x73, 0x00, 0x4a, 0x00, 0x92, 0x00, 0x68, 0x03, 0x42, 0x00, 0x28, 0x00, 0x31,
+    0x00, 0x48, 0x00, 0x63, 0x00, 0x8e, 0x00, 0x79, 0x00, 0x48, 0x00, 0x42, 0x00, 0x31, 0x00, 0x8f,
+    0x00, 0x71, 0x00, 0x44, 0x01, 0x43, 0x00, 0x4a, 0x00, 0x14, 0x00, 0x4d, 0x00, 0x8f, 0x00, 0x71,
+    0x00, 0x42, 0x00, 0x73, 0x00, 0x8e, 0x00, 0x72, 0x00, 0x42, 0x00, 0x6c, 0x00, 0x92, 0x00, 0x48,
+    0xa4, 0x00, 0x00, 0x86, 0x00, 0x85, 0x00, 0x6d, 0x01, 0x69, 0x00, 0x6f, 0x00, 0x20, 0x00, 0x1d,
+    0x00, 0x8f, 0x00, 0x78, 0x02, 0x00, 0x00, 0x25, 0x00, 0x93, 0x00, 0x6f, 0x01, 0x00, 0x00, 0x18,
+    0x00, 0x92, 0x00, 0x6c, 0x01, 0x00, 0x00, 0x22, 0x00, 0x8e, 0x00, 0x7f, 0x02, 0x55, 0x00, 0x56,
+    0x00, 0x08, 0x00, 0x36, 0x00, 0x92, 0x00, 0x6d, 0x00, 0x12, 0x00, 0x0c, 0x00, 0x2a, 0x00, 0x8f,
+    0x00, 0x78, 0x00, 0x05, 0x00, 0x00, 0x00, 0x09, 0x00, 0x87, 0x00, 0x89, 0x00, 0x0e, 0x00, 0x00,
+    0x00, 0x05, 0x00, 0x7e, 0x00, 0x8e, 0x00, 0x2b, 0x00, 0x0c, 0x00, 0x11, 0x00, 0x69, 0x00, 0x93,
+    0x00, 0x3d, 0x00, 0x3a, 0x00, 0x93, 0x00, 0x5d, 0x00, 0x38, 0x00, 0x92, 0x00, 0x56, 0x02, 0x00,
+    0x00, 0x51, 0x00, 0x93, 0x00, 0x3c, 0x00, 0x3a, 0x00, 0x92, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x3a,
+    0x00, 0x92, 0x00, 0x61, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x93, 0x00, 0x53, 0x00, 0x1e, 0x00, 0x8e,
+    0x00, 0x7f, 0x02, 0x69, 0x00, 0x6f, 0x00, 0x12, 0x00, 0x6a, 0x00, 0x93, 0x00, 0x28, 0x02, 0x00,
+    0x00, 0x75, 0x00, 0x92, 0x00, 0x24, 0x01, 0x00, 0x00, 0x44, 0x00, 0x93, 0x00, 0x48, 0x05, 0x00,
+    0x00, 0x79, 0x00, 0x8e, 0x00, 0x55, 0x01, 0x4f, 0x00, 0x48, 0x00, 0x15, 0x00, 0x30, 0x00, 0x92,
+    0x00, 0x6c, 0x00, 0x3a, 0x00, 0x34, 0x00, 0x4b, 0x00, 0x8e, 0x00, 0x7a, 0x00, 0x3f, 0x00, 0x92,
+    0x00, 0x6c, 0x00, 0x48, 0x01, 0x4f, 0x00, 0x37, 0x00, 0x02, 0x01, 0x00, 0x00, 0x2b, 0x00, 0x92,
+    0x00, 0x6a, 0x01, 0x00, 0x00, 0x1b, 0x00, 0x8f, 0x00, 0x78, 0x03, 0x55, 0x00, 0x09, 0x00, 0x4d,
+    0x00, 0x93, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x92, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x93, 0x00, 0x4f, 0xa4, 0x00, 0x01, 0x86, 0x00, 0x5b, 0x01, 0x55, 0x00, 0x5c, 0x00, 0x18,
+    0x00, 0x21, 0x00, 0x8f, 0x00, 0x78, 0x00, 0x02, 0x01, 0x00, 0x00, 0x2a, 0x00, 0x93, 0x00, 0x6e,
+    0x01, 0x00, 0x00, 0x1b, 0x00, 0x92, 0x00, 0x6d, 0x00, 0x03, 0x00, 0x00, 0x00, 0x22, 0x00, 0x8e,
+    0x00, 0x7f, 0x02, 0x69, 0x00, 0x6f, 0x00, 0x0d, 0x00, 0x36, 0x00, 0x8f, 0x00, 0x86, 0x00, 0x92,
+    0x00, 0x93, 0x00, 0x8f, 0x00, 0x8e, 0x00, 0x55, 0x01, 0x00, 0x00, 0x0e, 0x00, 0x87, 0x00, 0x89,
+    0x00, 0x13, 0x00, 0x00, 0x00, 0x05, 0x00, 0x78, 0x00, 0x86, 0x00, 0x8f, 0x00, 0x92, 0x00, 0x93,
+    0x00, 0x86, 0x00, 0x8f, 0x00, 0x3d, 0x00, 0x3a, 0x00, 0x93, 0x00, 0x5d, 0x00, 0x38, 0x00, 0x92,
+    0x00, 0x57, 0x02, 0x00, 0x00, 0x51, 0x00, 0x93, 0x00, 0x36, 0x00, 0x3a, 0x00, 0x92, 0x00, 0x61,
+    0x00, 0x00, 0x00, 0x3a, 0x00, 0x92, 0x00, 0x61, 0x00, 0x00, 0x00, 0x32, 0x00, 0x93, 0x00, 0x53,
+    0x00, 0x1e, 0x00, 0x8e, 0x00, 0x7f, 0x02, 0x55, 0x00, 0x56, 0x00, 0x12, 0x00, 0x6a, 0x00, 0x92,
+    0x00, 0x2f, 0x01, 0x00, 0x00, 0x03, 0x00, 0x75, 0x00, 0x8f, 0x00, 0x25, 0x01, 0x00, 0x00, 0x44,
+    0x00, 0x93, 0x00, 0x48, 0x05, 0x00, 0x00, 0x0e, 0x00, 0x50, 0x02, 0x5d, 0x00, 0x87, 0x00, 0x7f,
+    0x00, 0x2a, 0x00, 0x79, 0x00, 0x90, 0x00, 0x8f, 0x00, 0x8e, 0x01, 0x90, 0x00, 0x48, 0x00, 0x02,
+    0x00, 0x29, 0x00, 0x5c, 0x00, 0x5d, 0x00, 0x5c, 0x00, 0x6d, 0x00, 0x94, 0x00, 0x48, 0x01, 0x00,
+    0x00, 0x32, 0x00, 0x92, 0x00, 0x6e, 0x01, 0x00, 0x00, 0x1b, 0x00, 0x8f, 0x00, 0x7f, 0x03, 0x69,
+    0x00, 0x0e, 0x00, 0x4d, 0x00, 0x93, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x92, 0x00, 0x4f,
+    0x00, 0x00, 0x00, 0x44, 0x00, 0x93, 0x00, 0x4f, 0xa4, 0x00, 0x00, 0x8f, 0x00, 0x7f, 0x00, 0x4d,
+    0x01, 0x45, 0x00, 0x4d, 0x00, 0x24, 0x00, 0x21, 0x00, 0x8f, 0x00, 0x78, 0x00, 0x02, 0x01, 0x00,
+    0x00, 0x2a, 0x00, 0x93, 0x00, 0x6e, 0x01, 0x00, 0x00, 0x1b, 0x00, 0x92, 0x00, 0x6d, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x22, 0x00, 0x8f, 0x00, 0x7a, 0x02, 0x45, 0x00, 0x46, 0x00, 0x1a, 0x00, 0x36,
+    0x00, 0x92, 0x00, 0x73, 0x00, 0x30, 0x00, 0x27, 0x00, 0x4a, 0x00, 0x8f, 0x00, 0x63, 0x01, 0x00,
+    0x00, 0x0e, 0x00, 0x87, 0x00, 0x89, 0x00, 0x13, 0x00, 0x00, 0x00, 0x05, 0x00, 0x7e, 0x00, 0x8e,
+    0x00, 0x4a, 0x00, 0x28, 0x00, 0x2f, 0x00, 0x6d, 0x00, 0x92, 0x00, 0x3d, 0x00, 0x3a, 0x00, 0x93,
+    0x00, 0x5d, 0x00, 0x38, 0x00, 0x92, 0x00, 0x57, 0x02, 0x00, 0x00, 0x51, 0x00, 0x93, 0x00, 0x36,
+    0x00, 0x3a, 0x00, 0x92, 0x00, 0x61, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x92, 0x00, 0x61, 0x00, 0x00,
+    0x00, 0x32, 0x00, 0x93, 0x00, 0x53, 0x00, 0x1d, 0x00, 0x8e, 0x00, 0x79, 0x03, 0x45, 0x00, 0x22,
+    0x00, 0x6a, 0x00, 0x92, 0x00, 0x2f, 0x01, 0x00, 0x00, 0x03, 0x00, 0x75, 0x00, 0x8f, 0x00, 0x25,
+    0x01, 0x00, 0x00, 0x44, 0x00, 0x93, 0x00, 0x48, 0x05, 0x00, 0x00, 0x40, 0x00, 0x44, 0x02, 0x45,
+    0x00, 0x74, 0x00, 0x8f, 0x00, 0x15, 0x00, 0x0e, 0x00, 0x26, 0x00, 0x7a, 0x00, 0x8e, 0x00, 0x44,
+    0x00, 0x1c, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x44, 0x02, 0x45, 0x00, 0x58, 0x00, 0x8f, 0x00, 0x61,
+    0x01, 0x00, 0x00, 0x32, 0x00, 0x92, 0x00, 0x6e, 0x01, 0x00, 0x00, 0x1f, 0x00, 0x93, 0x00, 0x73,
+    0x02, 0x45, 0x00, 0x46, 0x00, 0x15, 0x00, 0x4d, 0x00, 0x93, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x4d,
+    0x00, 0x92, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x44, 0x00, 0x93, 0x00, 0x4f, 0xa4, 0x00, 0x00, 0x4b,
+    0x01, 0x8e, 0x01, 0x8f, 0x00, 0x93, 0x00, 0x61, 0x00, 0x21, 0x00, 0x90, 0x00, 0x78, 0x00, 0x02,
+    0x01, 0x00, 0x00, 0x2a, 0x00, 0x93, 0x00, 0x6e, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x92,
+    0x00, 0x6d, 0x00, 0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 0x6d, 0x03, 0x8e, 0x00, 0x93, 0x00, 0x45,
+    0x00, 0x35, 0x00, 0x92, 0x00, 0x65, 0x01, 0x00, 0x00, 0x17, 0x00, 0x90, 0x00, 0x63, 0x01, 0x00,
+    0x00, 0x0e, 0x01, 0x89, 0x00, 0x13, 0x00, 0x00, 0x00, 0x05, 0x00, 0x77, 0x00, 0x90, 0x00, 0x1c,
+    0x01, 0x00, 0x00, 0x5e, 0x00, 0x93, 0x00, 0x3d, 0x00, 0x3a, 0x00, 0x93, 0x00, 0x5d, 0x00, 0x38,
+    0x00, 0x92, 0x00, 0x57, 0x02, 0x00, 0x00, 0x57, 0x00, 0x93, 0x00, 0x36, 0x00, 0x40, 0x00, 0x92,
+    0x00, 0x60, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x92, 0x00, 0x61, 0x00, 0x00, 0x00, 0x32, 0x00, 0x93,
+    0x00, 0x5a, 0x00, 0x06, 0x00, 0x6a, 0x00, 0x8e, 0x02, 0x8f, 0x00, 0x93, 0x00, 0x52, 0x00, 0x64,
+    0x00, 0x92, 0x00, 0x2f, 0x01, 0x00, 0x00, 0x03, 0x00, 0x74, 0x00, 0x8f, 0x00, 0x25, 0x01, 0x00,
+    0x00, 0x4c, 0x00, 0x93, 0x00, 0x47, 0x05, 0x00, 0x01, 0x8f, 0x03, 0x8e, 0x00, 0x5c, 0x00, 0x02,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x75, 0x00, 0x92, 0x00, 0x1f, 0x01, 0x00, 0x00, 0x43, 0x00, 0x93,
+    0x03, 0x8e, 0x00, 0x7f, 0x00, 0x1b, 0x01, 0x00, 0x00, 0x32, 0x00, 0x92, 0x00, 0x6d, 0x01, 0x00,
+    0x00, 0x08, 0x00, 0x74, 0x03, 0x8e, 0x00, 0x93, 0x00, 0x27, 0x00, 0x4d, 0x00, 0x93, 0x00, 0x4f,
+    0x00, 0x00, 0x00, 0x51, 0x00, 0x92, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x44, 0x00, 0x93, 0x00, 0x4f,
+    0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
+    0xff, 0x00, 0x58, 0x00,
 #else
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xD469,0xD469,0xD489,0x89C4,0x6000,0x6000,0x6000,0xBB88,0xD489,0xCC49,0x70A2,0x7923,0xD489,0xDCA9,0xB347,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6881,0x70E2,0x70E2,0x6041,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9205,0xDC89,0xD489,0x9246,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xD467,0xD446,0xDC46,0xCBE7,0x6881,0x6000,0x6000,0xBB87,0xDC66,0xD426,0x70A1,0x7903,0xC3E8,0xCC07,0xAAE6,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xAAE5,0xD468,0xD468,0x89C4,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9204,0xDC87,0xDC67,0x9A65,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xD467,0xD446,0xD447,0xDC87,0xA2C5,0x6000,0x6000,0xBB87,0xDC67,0xD427,0x70C2,0x6000,0x6861,0x6861,0x6040,0x6000,0x6020,0x6020,0x6020,0x6000,0x6041,0x70E2,0x6861,0x6000,0x70A1,0xB346,0xCC07,0xDC66,0xDC67,0xC3C7,0xA2C6,0x6000,0x6000,0x6040,0x70E2,0x6881,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0x70C2,0x6040,0x91E4,0xDC87,0xDC67,0x9A65,0x6000,0x6000,0x6000,0x6040,0x70E2,0x6881,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xD467,0xDC66,0xBBA7,0xB347,0xDC87,0x8143,0x6000,0xBB87,0xDC67,0xD427,0x70C1,0x7103,0xC3E8,0xCC08,0xAAE6,0x6000,0xAAE6,0xCC28,0xC3C8,0xA2C6,0xCBE7,0xD447,0xCC07,0x9204,0x6041,0x8184,0xBB87,0xDC67,0xDC67,0xA2C7,0x7943,0x6040,0x9A65,0xC3E7,0xB368,0xBBA7,0xBB87,0x8163,0x6000,0x6861,0xA2A6,0xAAC5,0xA2A6,0x89E4,0xC3A7,0xCC08,0xAB06,0x70C2,0x6000,0x6000,0x8183,0xC3C7,0xD447,0xC3E8,0xBBA7,0xD467,0xDC67,0x9A65,0x6000,0x6041,0xA285,0xC3E7,0xB347,0xC3C7,0xBB67,0x7943,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xD467,0xDC66,0xC3C7,0x7923,0xD447,0xC3C7,0x6861,0xBB87,0xDC67,0xD427,0x70A1,0x7923,0xD467,0xE487,0xBB46,0x6000,0xBB66,0xE487,0xDC67,0xBB87,0x89C4,0xBB86,0xDC67,0xDC87,0x9224,0x6000,0xAB05,0xDC67,0xDC87,0x89C4,0x6000,0xB326,0xE4A7,0xBB66,0x6000,0x7943,0xDC87,0xDC68,0x8163,0x6881,0xD468,0xE487,0xDC87,0xBBA8,0xAAE6,0xD447,0xE487,0xCC07,0x70C2,0x78E2,0xD447,0xE487,0xB326,0x7902,0xB346,0xDC67,0xDC67,0x9A45,0x6020,0xB346,0xE4A7,0xB326,0x6000,0x8184,0xDC87,0xD468,0x8163,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xD467,0xDC66,0xC3E7,0x6000,0x9204,0xE4A7,0x9A65,0xB346,0xDC67,0xD427,0x70A1,0x7923,0xD467,0xDC67,0xB346,0x6000,0xB346,0xDC67,0xD447,0x7923,0x6000,0x8163,0xDC87,0xDC67,0xBB87,0x6000,0xAB05,0xDC67,0xDC87,0x89C4,0x8163,0xDC87,0xD467,0xCBE7,0xAAE5,0xBB67,0xDC87,0xE4A7,0xC3C7,0x70E3,0xCC28,0xDC66,0xCC27,0x6861,0x6000,0xA2C6,0xDC67,0xDC87,0x9204,0xAAE6,0xDC67,0xDC67,0x9205,0x6000,0x91E4,0xDC87,0xDC67,0x9225,0x8184,0xDC87,0xDC67,0xAAC5,0x6000,0x7943,0xD447,0xDC66,0xC3E8,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xD467,0xDC66,0xC3E7,0x6041,0x6020,0xBB66,0xD447,0xCC07,0xD467,0xD427,0x70A1,0x7923,0xD467,0xDC67,0xB346,0x6000,0xB346,0xDC67,0xD447,0x7943,0x6000,0x8163,0xDC88,0xDC67,0xBB87,0x6000,0xAB05,0xDC67,0xDC87,0x89C4,0x91E3,0xDC87,0xD467,0xC3C7,0xA2A6,0xA285,0x9A45,0x9A65,0x9245,0x70E3,0xCC28,0xDC66,0xCC08,0x6041,0x6000,0xA2A6,0xDC67,0xDC67,0x9224,0xB367,0xDC67,0xDC67,0x9225,0x6000,0x9204,0xDC87,0xDC67,0x9225,0x9A65,0xDC87,0xDC67,0xAAE5,0x6000,0x8143,0xD447,0xD446,0xDCA8,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xD467,0xDC66,0xC3E7,0x6861,0x6000,0x7902,0xD447,0xDC67,0xD447,0xD427,0x70A1,0x7923,0xD467,0xDC67,0xB346,0x6000,0xB346,0xDC67,0xD447,0x7943,0x6000,0x8183,0xDC88,0xDC67,0xBB87,0x6000,0xAB05,0xDC67,0xDC87,0x89C4,0x8143,0xDC87,0xDC67,0xB305,0x6000,0x6881,0xAAE6,0xB326,0x9224,0x6882,0xCC28,0xDC66,0xCC28,0x6041,0x6000,0xA2A6,0xDC67,0xDC67,0x9204,0x9204,0xDC87,0xDC67,0x9205,0x6000,0x9204,0xDC87,0xDC67,0x9225,0x8163,0xDC87,0xDC67,0xAAC5,0x6000,0x7943,0xD447,0xDC67,0xC3C7,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xDC88,0xE487,0xCC08,0x6861,0x6000,0x6000,0x9A45,0xE487,0xDC87,0xD467,0x70C1,0x7943,0xDC88,0xE4A7,0xBB66,0x6000,0xBB66,0xE4A7,0xDC88,0x7943,0x6000,0x8183,0xE4A8,0xE4A7,0xBBA8,0x6000,0xB325,0xE4A7,0xE4A8,0x91E5,0x6000,0xAB26,0xE4A7,0xBB66,0x6881,0x89C4,0xE4A8,0xDC67,0x8163,0x6881,0xD448,0xDC66,0xCC28,0x6041,0x6000,0xA2C6,0xDC87,0xDC87,0x9224,0x6040,0xBB86,0xE4A7,0xBBA7,0x9A66,0xC3C7,0xE487,0xE4A7,0x9A66,0x6000,0xB326,0xE4A7,0xB346,0x6861,0x89E4,0xDC87,0xD447,0x7943,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xAAC6,0xAAE6,0x9A85,0x6040,0x6000,0x6000,0x6040,0xA285,0xAAE6,0xA2C5,0x6861,0x70A2,0xAAC6,0xAAE6,0x9204,0x6000,0x9224,0xAAE6,0xAAC6,0x70C2,0x6000,0x70E2,0xAAE6,0xAAE6,0x9225,0x6000,0x91E4,0xAAE6,0xAAE6,0x7923,0x6000,0x6020,0x9A45,0xCC28,0xCC28,0xD469,0xBB67,0x7923,0x6000,0x6881,0xC3E9,0xCC28,0xBBC8,0x6040,0x6000,0x9A66,0xCC49,0xCC49,0x9205,0x6000,0x6881,0xA2C6,0xCC08,0xBB87,0xA2C6,0xAAC5,0xAAE6,0x8183,0x6000,0x6040,0x9A45,0xCC49,0xCC28,0xD469,0xB367,0x7923,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xD467,0xD446,0xDC67,0xDC67,0xDC67,0xE487,0xBB46,0x89C4,0xDC87,0xD446,0xDC87,0xDC87,0xDC87,0xDC67,0xD467,0x89C4,0xB325,0xE4A7,0xDC67,0xD447,0xD447,0xDC87,0xD467,0x9A87,0xD427,0xD447,0xDC87,0xDC87,0xDC87,0xE4A7,0xA2E7,0x9A24,0xDC87,0xD447,0xDC87,0xDC87,0xDC67,0xDC67,0x9A45,0xA285,0xE4A7,0xDC67,0xD447,0xD447,0xDC67,0xE4A7,0xA2E6,0x9224,0xDC67,0xDC67,0xDC87,0xDC87,0xDC67,0xCC07,0x70A2,0xA2A6,0xE4A7,0xB367,0x9A85,0xDC67,0xD447,0xDC87,0xDC87,0xDC87,0xDC67,0xCC27,0x70C2,0xA2A6,0xDC67,0xD447,0xDC87,0xDC67,0xD447,0xD447,0xDC87,0xDC67,0xD447,0x8163,0x81A4,0xDC67,0xD447,0xDC67,0xDC67,0xDC67,0xE487,0xB348,0xBBA8,0xDC67,0xDC67,0xDC87,0xDC87,0xDC87,0xDC67,0xBB87,0x7903,0xD448,0xDC87,0xDC67,0xD447,0xD467,0xDC87,0xDC87,0x6000,0x6000,0x6000,0x6000,0x9A45,0xD468,0xDC67,0xDC87,0xDC87,0xDC87,0xDC87,0xC409,0xDC67,0xAB06,0x6000,0x6000,0x7943,0xDC88,0xCC48,0x8164,0xBBA7,0xDC87,0xDC87,0xDC87,0xDC87,0xE4A7,0xBB46,0xC3C8,0xE487,0xDC67,0xD447,0xD447,0xDC87,0xDC88,0xA2C6,0xD447,0xD467,0xDC87,0xDC87,0xDC87,0xE4A7,0x9203,0xAB07,0xDC67,0xD467,0xDC87,0xD467,0xD447,0xD447,0xDC87,0xDC67,0xCC28,0x7902,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xD467,0xD447,0xAB27,0xAB07,0xAB07,0xAB27,0x9205,0x89C4,0xDC87,0xD427,0xAAE6,0xA2C6,0xA2C6,0xBB87,0xDC87,0xBBA7,0x89E4,0xA2C6,0xB326,0xDC67,0xCC27,0xA2C6,0xA2A6,0x9226,0xD447,0xCC27,0xA2C6,0xA2C6,0xA2C6,0xAAE6,0x8184,0x9A44,0xE487,0xCC07,0xA2A6,0xA2A6,0xB327,0xDC67,0xCC27,0x9205,0xA2C6,0xAB07,0xD467,0xD467,0xAB27,0xA2C6,0x89E5,0xCC07,0xDC67,0xB347,0xA2A6,0xA2A6,0xCC07,0xE487,0x9A65,0x9A86,0xE4A7,0xB367,0x9A65,0xDC87,0xCBE7,0xA2C6,0xA2C6,0xA2C6,0xC3E7,0xE487,0x9A65,0x9A86,0xDC87,0xCBE7,0xA2C6,0xBBA7,0xDC67,0xCC07,0xA2C6,0xBBA7,0xE487,0xB305,0x81A4,0xDC67,0xCC28,0xAB07,0xAB07,0xAB07,0xAB27,0x89E5,0xBBA8,0xDC67,0xBB86,0xA2C6,0xA2C6,0xA2E6,0xD427,0xDC87,0x9226,0x9A66,0xA2C6,0xC3C7,0xDC67,0xC3C7,0xA2C6,0xA2C6,0x6000,0x6000,0x6000,0x6000,0xDC87,0xD447,0xAAC5,0xA2A5,0xA2A5,0xA2A5,0xA285,0xB367,0xE487,0xAAE6,0x6000,0x6000,0x7922,0xDC88,0xC3E7,0xAAC6,0xE487,0xBB87,0xA2A5,0xA2A5,0xA2A5,0xA2A5,0x9204,0x9225,0xAAC5,0xBBA7,0xDC67,0xCC27,0xA2C5,0xA2A5,0x9A45,0xDC87,0xC3C6,0xA2C6,0xA2C6,0xA2C6,0xAAE6,0x7922,0xAB07,0xDC87,0xC3E6,0xA2C5,0xC3E7,0xDC67,0xCBE7,0xA2A5,0xC3E7,0xE487,0xAAE5,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xD467,0xD447,0xC3C7,0xC3C7,0xC3C7,0xC3E8,0x89A4,0x89A4,0xDC87,0xCC07,0x6020,0x6000,0x6000,0x9205,0xE4A7,0xC408,0x6000,0x6000,0x8163,0xE487,0xC3C7,0x6000,0x6000,0x89C5,0xDC67,0xCC27,0xB326,0xB306,0xB306,0xB346,0x70A1,0x9A44,0xE487,0xC3C7,0x78E2,0x70E1,0x9205,0xDC67,0xCC07,0x6861,0x6000,0x70A2,0xD468,0xD468,0x70E2,0x6000,0x6861,0xCC27,0xDC67,0x9225,0x70E1,0x70E2,0xBBA7,0xE4A7,0xA285,0x9A86,0xE4A7,0xB367,0x9A65,0xE487,0xB326,0x6000,0x6000,0x6000,0xAB27,0xE4A7,0x9A64,0x9A86,0xE487,0xB346,0x6000,0x9A66,0xE487,0xBB66,0x6000,0x9225,0xE4A7,0xB325,0x81A5,0xDC67,0xD447,0xC3C7,0xC3C7,0xC3C7,0xC3E8,0x7922,0xBBA8,0xE4A7,0x9204,0x6000,0x6000,0x6000,0xC408,0xE487,0x91E4,0x6000,0x6000,0xA2C6,0xE4A7,0xAAC5,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xCC27,0xDC67,0xB326,0xAAE5,0xAAE5,0xAAE5,0x7923,0x9A44,0xE487,0xC3C7,0x9A66,0x9A66,0xAB07,0xDC67,0xCC28,0xA286,0xE487,0xC3C7,0xAAC5,0xAAE5,0xAAE5,0x9A65,0x6040,0x6000,0x6000,0x9225,0xE487,0xC3C8,0x6000,0x6000,0x8183,0xDC87,0xCC07,0xB306,0xB326,0xB326,0xB326,0x68A2,0xAB07,0xE4A7,0xAAE5,0x6000,0xAAE7,0xE487,0xAAE5,0x6000,0xA2A6,0xE4A7,0xAAE5,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xD467,0xD447,0xB346,0xB326,0xB326,0xBB46,0x8163,0x89C4,0xDC87,0xCC07,0x6840,0x6000,0x6000,0x9225,0xE4A7,0xC3E8,0x6020,0x6000,0x8183,0xE487,0xC3C7,0x6041,0x6000,0x89C5,0xDC67,0xD447,0xC3C7,0xC3C7,0xC3C7,0xC3E8,0x70C2,0x9A44,0xDC87,0xD467,0xE487,0xE4A7,0xDC87,0xDC67,0xB326,0x6000,0x6000,0x70E2,0xD468,0xD468,0x7903,0x6000,0x6881,0xCC27,0xD467,0xDC87,0xE487,0xE4A7,0xD467,0xDC87,0xA285,0x9A86,0xE4A7,0xB367,0x9A65,0xE487,0xB347,0x6000,0x6000,0x6000,0xB327,0xE4A7,0x9A64,0x9A86,0xE487,0xBB66,0x6000,0x9A86,0xE487,0xBB86,0x6000,0x9A45,0xE4A7,0xB305,0x81A5,0xDC67,0xD427,0xB326,0xB326,0xB326,0xB346,0x70E2,0xBBA8,0xE487,0x9A24,0x6000,0x6000,0x6041,0xCC08,0xDC87,0x91E5,0x6000,0x6000,0xA2E6,0xE4A7,0xAAC5,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x70E2,0xAAE6,0xBB67,0xB367,0xB367,0xD468,0xD427,0x9225,0xCC27,0xDC88,0xDC87,0xDC67,0xDC88,0xDC88,0xAAE5,0x6040,0x9224,0xBB46,0xBB67,0xB346,0xC3C7,0xE4A8,0xAAE5,0x6000,0x6000,0x9245,0xE487,0xC3C8,0x6020,0x6000,0x8183,0xDC87,0xCC27,0xBBC7,0xBBA7,0xC3C7,0xBBA7,0x70C2,0xAB07,0xE4A7,0xAB05,0x6000,0xAB07,0xE487,0xAB05,0x6000,0xA2C6,0xE4A7,0xAAE5,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xDC87,0xD447,0xAB07,0xA2C7,0xA2E7,0xAAE7,0x9204,0x89C4,0xDC87,0xCC07,0x6840,0x6000,0x6000,0x9225,0xE4A7,0xC3E8,0x6020,0x6000,0x8183,0xE487,0xC3C7,0x6041,0x6000,0x89C5,0xDC87,0xCC08,0xA2E7,0xA2E7,0xA2E7,0xAB07,0x8164,0x9A44,0xE487,0xCC07,0x9224,0x9203,0xAAE6,0xDC87,0xBB67,0x6000,0x6000,0x70E2,0xD468,0xD468,0x7903,0x6000,0x6881,0xCC07,0xDC67,0xAAE6,0x9204,0x9204,0xC3E7,0xE487,0xA285,0x9A86,0xE4A7,0xB367,0x9A65,0xE487,0xB347,0x6000,0x6000,0x6000,0xB327,0xE4A7,0x9A64,0x9A86,0xE487,0xBB66,0x6000,0x9A86,0xE487,0xBB86,0x6000,0x9A45,0xE4A7,0xB305,0x81A4,0xDC67,0xCC27,0xA2C7,0xA2C7,0xA2E7,0xAAE7,0x89C5,0xBBA8,0xE487,0x9A24,0x6000,0x6000,0x6041,0xCC08,0xDC87,0x91E5,0x6000,0x6000,0xA2E6,0xE4A7,0xAAC5,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xA2A6,0xA2C6,0xA2E7,0xA2E7,0xA2E7,0xCC08,0xDC87,0x7943,0x70E2,0x9205,0xCC28,0xDC67,0xA2C6,0x81A4,0x6020,0x8184,0xA2C6,0xA2E7,0xA2E7,0xA2E7,0xB367,0xDC87,0xBB46,0x6000,0x6000,0x9245,0xE487,0xC3C8,0x6020,0x6000,0x8983,0xE4A7,0xC3E7,0xA2E7,0xA2E7,0xA2E7,0xAB07,0x7923,0xAB07,0xE4A7,0xAB05,0x6000,0xAB07,0xE487,0xAB05,0x6000,0xA2C6,0xE4A7,0xAAE5,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xAB07,0xDC67,0xDC67,0xDC87,0xDC87,0xE4A7,0xBB66,0x89C4,0xDC88,0xCC07,0x6840,0x6000,0x6000,0x9225,0xE4A7,0xC3E8,0x6020,0x6000,0x8183,0xE487,0xC3E7,0x6041,0x6000,0x6881,0xC3C7,0xDC67,0xDC67,0xDC67,0xDC67,0xE4A7,0xA2E7,0x9A44,0xE487,0xBBA8,0x6000,0x6000,0x8164,0xDC88,0xBB87,0x6000,0x6000,0x70E2,0xD468,0xD468,0x7903,0x6000,0x6881,0xCC06,0xDC88,0x81A4,0x6000,0x6000,0xBB87,0xE4A7,0xA285,0x9A86,0xE4A7,0xB367,0x9A85,0xE487,0xB347,0x6000,0x6000,0x6000,0xB347,0xE4A7,0x9A64,0xA2A6,0xE487,0xBB46,0x6000,0x9A86,0xE487,0xBB86,0x6000,0x9A45,0xE4A7,0xB325,0x6861,0xBBA8,0xDC67,0xDC87,0xDC87,0xDC87,0xE4A7,0xB348,0xBBA7,0xE487,0x9A24,0x6000,0x6000,0x6041,0xCC08,0xDC87,0x9205,0x6000,0x6000,0xAAE6,0xE4A7,0xAAC5,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xDC87,0xDC87,0xDC67,0xDC67,0xDC67,0xDC67,0xB346,0x6040,0x6000,0x6041,0xCC08,0xE487,0x89A3,0x6000,0x6000,0xA2C6,0xE4A7,0xDC67,0xDC67,0xDC67,0xDC67,0xD447,0x8183,0x6000,0x6000,0x9A45,0xE487,0xC3C7,0x6020,0x6000,0x70A1,0xC3E8,0xDC67,0xDC67,0xDC67,0xDC67,0xE4A7,0x9203,0xAB07,0xE4A7,0xAAE5,0x6000,0xAB27,0xE487,0xAB05,0x6000,0xA2E6,0xE4A7,0xAAE5,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
+    0x40, 0x01, 0x20, 0x00, 0x87, 0x00, 0x00, 0x60, 0x20, 0x60, 0x40, 0x60, 0x41, 0x60, 0x40, 0x68,
+    0x61, 0x68, 0x81, 0x68, 0x82, 0x68, 0xa2, 0x68, 0xa1, 0x70, 0xa2, 0x70, 0xc1, 0x70, 0xc2, 0x70,
+    0xe1, 0x70, 0xe2, 0x70, 0xe3, 0x70, 0x03, 0x71, 0xe2, 0x78, 0x02, 0x79, 0x03, 0x79, 0x22, 0x79,
+    0x23, 0x79, 0x43, 0x79, 0x43, 0x81, 0x63, 0x81, 0x64, 0x81, 0x83, 0x81, 0x84, 0x81, 0xa4, 0x81,
+    0xa5, 0x81, 0x83, 0x89, 0xa3, 0x89, 0xa4, 0x89, 0xc4, 0x89, 0xc5, 0x89, 0xe4, 0x89, 0xe5, 0x89,
+    0xe3, 0x91, 0xe4, 0x91, 0xe5, 0x91, 0x03, 0x92, 0x04, 0x92, 0x05, 0x92, 0x24, 0x92, 0x25, 0x92,
+    0x26, 0x92, 0x45, 0x92, 0x46, 0x92, 0x24, 0x9a, 0x44, 0x9a, 0x45, 0x9a, 0x64, 0x9a, 0x65, 0x9a,
+    0x66, 0x9a, 0x85, 0x9a, 0x86, 0x9a, 0x87, 0x9a, 0x85, 0xa2, 0x86, 0xa2, 0xa5, 0xa2, 0xa6, 0xa2,
+    0xc5, 0xa2, 0xc6, 0xa2, 0xc7, 0xa2, 0xe6, 0xa2, 0xe7, 0xa2, 0xc5, 0xaa, 0xc6, 0xaa, 0xe5, 0xaa,
+    0xe6, 0xaa, 0xe7, 0xaa, 0x05, 0xab, 0x06, 0xab, 0x07, 0xab, 0x26, 0xab, 0x27, 0xab, 0x05, 0xb3,
+    0x06, 0xb3, 0x25, 0xb3, 0x26, 0xb3, 0x27, 0xb3, 0x46, 0xb3, 0x47, 0xb3, 0x48, 0xb3, 0x67, 0xb3,
+    0x68, 0xb3, 0x46, 0xbb, 0x66, 0xbb, 0x67, 0xbb, 0x86, 0xbb, 0x87, 0xbb, 0x88, 0xbb, 0xa7, 0xbb,
+    0xa8, 0xbb, 0xc7, 0xbb, 0xc8, 0xbb, 0xa7, 0xc3, 0xc6, 0xc3, 0xc7, 0xc3, 0xc8, 0xc3, 0xe6, 0xc3,
+    0xe7, 0xc3, 0xe8, 0xc3, 0xe9, 0xc3, 0x08, 0xc4, 0x09, 0xc4, 0xe7, 0xcb, 0x06, 0xcc, 0x07, 0xcc,
+    0x08, 0xcc, 0x27, 0xcc, 0x28, 0xcc, 0x48, 0xcc, 0x49, 0xcc, 0x26, 0xd4, 0x27, 0xd4, 0x46, 0xd4,
+    0x47, 0xd4, 0x48, 0xd4, 0x67, 0xd4, 0x68, 0xd4, 0x69, 0xd4, 0x89, 0xd4, 0x46, 0xdc, 0x66, 0xdc,
+    0x67, 0xdc, 0x68, 0xdc, 0x87, 0xdc, 0x88, 0xdc, 0x89, 0xdc, 0xa8, 0xdc, 0xa9, 0xdc, 0x87, 0xe4,
+    0xa7, 0xe4, 0xa8, 0xe4, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
+    0xff, 0x00, 0xff, 0x00, 0xcb, 0x00, 0x01, 0x79, 0x00, 0x7a, 0x00, 0x21, 0x02, 0x00, 0x00, 0x5b,
+    0x00, 0x7a, 0x00, 0x71, 0x00, 0x0a, 0x00, 0x15, 0x00, 0x7a, 0x00, 0x83, 0x00, 0x52, 0x0a, 0x00,
+    0x00, 0x06, 0x01, 0x0e, 0x00, 0x03, 0x17, 0x00, 0x00, 0x2a, 0x00, 0x81, 0x00, 0x7a, 0x00, 0x2f,
+    0xff, 0x00, 0x05, 0x00, 0x00, 0x77, 0x00, 0x74, 0x00, 0x7b, 0x00, 0x6a, 0x00, 0x06, 0x01, 0x00,
+    0x00, 0x5a, 0x00, 0x7c, 0x00, 0x72, 0x00, 0x09, 0x00, 0x13, 0x00, 0x66, 0x00, 0x6c, 0x00, 0x45,
+    0x0a, 0x00, 0x00, 0x44, 0x01, 0x78, 0x00, 0x21, 0x17, 0x00, 0x00, 0x29, 0x00, 0x7f, 0x00, 0x7d,
+    0x00, 0x34, 0xff, 0x00, 0x05, 0x00, 0x00, 0x77, 0x00, 0x74, 0x00, 0x75, 0x00, 0x7f, 0x00, 0x3d,
+    0x01, 0x00, 0x00, 0x5a, 0x00, 0x7d, 0x00, 0x73, 0x00, 0x0c, 0x00, 0x00, 0x01, 0x05, 0x00, 0x02,
+    0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0e, 0x00, 0x05, 0x00, 0x00, 0x00, 0x09,
+    0x00, 0x51, 0x00, 0x6c, 0x00, 0x7c, 0x00, 0x7d, 0x00, 0x62, 0x00, 0x3e, 0x01, 0x00, 0x00, 0x02,
+    0x00, 0x0e, 0x00, 0x06, 0x08, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x01, 0x00, 0x0c, 0x00, 0x02,
+    0x00, 0x26, 0x00, 0x7f, 0x00, 0x7d, 0x00, 0x34, 0x02, 0x00, 0x00, 0x02, 0x00, 0x0e, 0x00, 0x06,
+    0xff, 0x00, 0x00, 0x77, 0x00, 0x7c, 0x00, 0x5c, 0x00, 0x52, 0x00, 0x7f, 0x00, 0x17, 0x00, 0x00,
+    0x00, 0x5a, 0x00, 0x7d, 0x00, 0x73, 0x00, 0x0b, 0x00, 0x10, 0x00, 0x66, 0x00, 0x6d, 0x00, 0x45,
+    0x00, 0x00, 0x00, 0x45, 0x00, 0x6f, 0x00, 0x63, 0x00, 0x3e, 0x00, 0x6a, 0x00, 0x75, 0x00, 0x6c,
+    0x00, 0x29, 0x00, 0x03, 0x00, 0x1b, 0x00, 0x5a, 0x01, 0x7d, 0x00, 0x3f, 0x00, 0x16, 0x00, 0x02,
+    0x00, 0x34, 0x00, 0x65, 0x00, 0x55, 0x00, 0x5c, 0x00, 0x5a, 0x00, 0x18, 0x00, 0x00, 0x00, 0x05,
+    0x00, 0x3c, 0x00, 0x42, 0x00, 0x3c, 0x00, 0x23, 0x00, 0x60, 0x00, 0x6d, 0x00, 0x48, 0x00, 0x0c,
+    0x01, 0x00, 0x00, 0x1a, 0x00, 0x62, 0x00, 0x75, 0x00, 0x66, 0x00, 0x5c, 0x00, 0x77, 0x00, 0x7d,
+    0x00, 0x34, 0x00, 0x00, 0x00, 0x03, 0x00, 0x39, 0x00, 0x65, 0x00, 0x52, 0x00, 0x62, 0x00, 0x58,
+    0x00, 0x16, 0xfd, 0x00, 0x00, 0x77, 0x00, 0x7c, 0x00, 0x62, 0x00, 0x15, 0x00, 0x75, 0x00, 0x62,
+    0x00, 0x05, 0x00, 0x5a, 0x00, 0x7d, 0x00, 0x73, 0x00, 0x09, 0x00, 0x15, 0x00, 0x77, 0x00, 0x84,
+    0x00, 0x56, 0x00, 0x00, 0x00, 0x57, 0x00, 0x84, 0x00, 0x7d, 0x00, 0x5a, 0x00, 0x21, 0x00, 0x59,
+    0x00, 0x7d, 0x00, 0x7f, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x47, 0x00, 0x7d, 0x00, 0x7f, 0x00, 0x21,
+    0x00, 0x00, 0x00, 0x4f, 0x00, 0x85, 0x00, 0x57, 0x00, 0x00, 0x00, 0x16, 0x00, 0x7f, 0x00, 0x7e,
+    0x00, 0x18, 0x00, 0x06, 0x00, 0x78, 0x00, 0x84, 0x00, 0x7f, 0x00, 0x5d, 0x00, 0x45, 0x00, 0x75,
+    0x00, 0x84, 0x00, 0x6c, 0x00, 0x0c, 0x00, 0x11, 0x00, 0x75, 0x00, 0x84, 0x00, 0x4f, 0x00, 0x12,
+    0x00, 0x51, 0x01, 0x7d, 0x00, 0x32, 0x00, 0x01, 0x00, 0x51, 0x00, 0x85, 0x00, 0x4f, 0x00, 0x00,
+    0x00, 0x1b, 0x00, 0x7f, 0x00, 0x78, 0x00, 0x18, 0xfc, 0x00, 0x00, 0x77, 0x00, 0x7c, 0x00, 0x65,
+    0x00, 0x00, 0x00, 0x29, 0x00, 0x85, 0x00, 0x34, 0x00, 0x51, 0x00, 0x7d, 0x00, 0x73, 0x00, 0x09,
+    0x00, 0x15, 0x00, 0x77, 0x00, 0x7d, 0x00, 0x51, 0x00, 0x00, 0x00, 0x51, 0x00, 0x7d, 0x00, 0x75,
+    0x00, 0x15, 0x00, 0x00, 0x00, 0x18, 0x00, 0x7f, 0x00, 0x7d, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x47,
+    0x00, 0x7d, 0x00, 0x7f, 0x00, 0x21, 0x00, 0x18, 0x00, 0x7f, 0x00, 0x77, 0x00, 0x6a, 0x00, 0x44,
+    0x00, 0x58, 0x00, 0x7f, 0x00, 0x85, 0x00, 0x62, 0x00, 0x0f, 0x00, 0x6f, 0x00, 0x7c, 0x00, 0x6e,
+    0x00, 0x05, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x7d, 0x00, 0x7f, 0x00, 0x29, 0x00, 0x45, 0x01, 0x7d,
+    0x00, 0x2a, 0x00, 0x00, 0x00, 0x26, 0x00, 0x7f, 0x00, 0x7d, 0x00, 0x2c, 0x00, 0x1b, 0x00, 0x7f,
+    0x00, 0x7d, 0x00, 0x42, 0x00, 0x00, 0x00, 0x16, 0x00, 0x75, 0x00, 0x7c, 0x00, 0x66, 0xfc, 0x00,
+    0x00, 0x77, 0x00, 0x7c, 0x00, 0x65, 0x00, 0x03, 0x00, 0x01, 0x00, 0x57, 0x00, 0x75, 0x00, 0x6c,
+    0x00, 0x77, 0x00, 0x73, 0x00, 0x09, 0x00, 0x15, 0x00, 0x77, 0x00, 0x7d, 0x00, 0x51, 0x00, 0x00,
+    0x00, 0x51, 0x00, 0x7d, 0x00, 0x75, 0x00, 0x16, 0x00, 0x00, 0x00, 0x18, 0x00, 0x80, 0x00, 0x7d,
+    0x00, 0x5a, 0x00, 0x00, 0x00, 0x47, 0x00, 0x7d, 0x00, 0x7f, 0x00, 0x21, 0x00, 0x25, 0x00, 0x7f,
+    0x00, 0x77, 0x00, 0x62, 0x00, 0x3c, 0x00, 0x39, 0x00, 0x32, 0x00, 0x34, 0x00, 0x2e, 0x00, 0x0f,
+    0x00, 0x6f, 0x00, 0x7c, 0x00, 0x6d, 0x00, 0x03, 0x00, 0x00, 0x00, 0x3c, 0x01, 0x7d, 0x00, 0x2b,
+    0x00, 0x54, 0x01, 0x7d, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x29, 0x00, 0x7f, 0x00, 0x7d, 0x00, 0x2c,
+    0x00, 0x34, 0x00, 0x7f, 0x00, 0x7d, 0x00, 0x44, 0x00, 0x00, 0x00, 0x17, 0x00, 0x75, 0x00, 0x74,
+    0x00, 0x82, 0xfc, 0x00, 0x00, 0x77, 0x00, 0x7c, 0x00, 0x65, 0x00, 0x05, 0x00, 0x00, 0x00, 0x12,
+    0x00, 0x75, 0x00, 0x7d, 0x00, 0x75, 0x00, 0x73, 0x00, 0x09, 0x00, 0x15, 0x00, 0x77, 0x00, 0x7d,
+    0x00, 0x51, 0x00, 0x00, 0x00, 0x51, 0x00, 0x7d, 0x00, 0x75, 0x00, 0x16, 0x00, 0x00, 0x00, 0x1a,
+    0x00, 0x80, 0x00, 0x7d, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x47, 0x00, 0x7d, 0x00, 0x7f, 0x00, 0x21,
+    0x00, 0x17, 0x00, 0x7f, 0x00, 0x7d, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x06, 0x00, 0x45, 0x00, 0x4f,
+    0x00, 0x2b, 0x00, 0x07, 0x00, 0x6f, 0x00, 0x7c, 0x00, 0x6f, 0x00, 0x03, 0x00, 0x00, 0x00, 0x3c,
+    0x01, 0x7d, 0x01, 0x29, 0x00, 0x7f, 0x00, 0x7d, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x29, 0x00, 0x7f,
+    0x00, 0x7d, 0x00, 0x2c, 0x00, 0x18, 0x00, 0x7f, 0x00, 0x7d, 0x00, 0x42, 0x00, 0x00, 0x00, 0x16,
+    0x00, 0x75, 0x00, 0x7d, 0x00, 0x62, 0xfc, 0x00, 0x00, 0x80, 0x00, 0x84, 0x00, 0x6d, 0x00, 0x05,
+    0x01, 0x00, 0x00, 0x32, 0x00, 0x84, 0x00, 0x7f, 0x00, 0x77, 0x00, 0x0b, 0x00, 0x16, 0x00, 0x80,
+    0x00, 0x85, 0x00, 0x57, 0x00, 0x00, 0x00, 0x57, 0x00, 0x85, 0x00, 0x80, 0x00, 0x16, 0x00, 0x00,
+    0x00, 0x1a, 0x00, 0x86, 0x00, 0x85, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x4e, 0x00, 0x85, 0x00, 0x86,
+    0x00, 0x27, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x85, 0x00, 0x57, 0x00, 0x06, 0x00, 0x21, 0x00, 0x86,
+    0x00, 0x7d, 0x00, 0x18, 0x00, 0x06, 0x00, 0x76, 0x00, 0x7c, 0x00, 0x6f, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x3e, 0x01, 0x7f, 0x00, 0x2b, 0x00, 0x02, 0x00, 0x59, 0x00, 0x85, 0x00, 0x5c, 0x00, 0x35,
+    0x00, 0x62, 0x00, 0x84, 0x00, 0x85, 0x00, 0x35, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x85, 0x00, 0x51,
+    0x00, 0x05, 0x00, 0x23, 0x00, 0x7f, 0x00, 0x75, 0x00, 0x16, 0xfc, 0x00, 0x00, 0x43, 0x00, 0x45,
+    0x00, 0x36, 0x00, 0x02, 0x01, 0x00, 0x00, 0x02, 0x00, 0x39, 0x00, 0x45, 0x00, 0x3d, 0x00, 0x05,
+    0x00, 0x0a, 0x00, 0x43, 0x00, 0x45, 0x00, 0x29, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x45, 0x00, 0x43,
+    0x00, 0x0c, 0x00, 0x00, 0x00, 0x0e, 0x01, 0x45, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x26, 0x01, 0x45,
+    0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x32, 0x01, 0x6f, 0x00, 0x79, 0x00, 0x58, 0x00, 0x15,
+    0x00, 0x00, 0x00, 0x06, 0x00, 0x67, 0x00, 0x6f, 0x00, 0x5f, 0x00, 0x02, 0x00, 0x00, 0x00, 0x35,
+    0x01, 0x71, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x3e, 0x00, 0x6d, 0x00, 0x5a, 0x00, 0x3e,
+    0x00, 0x42, 0x00, 0x45, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x32, 0x00, 0x71, 0x00, 0x6f,
+    0x00, 0x79, 0x00, 0x54, 0x00, 0x15, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x7d, 0x00, 0x00, 0x77,
+    0x00, 0x74, 0x02, 0x7d, 0x00, 0x84, 0x00, 0x56, 0x00, 0x21, 0x00, 0x7f, 0x00, 0x74, 0x02, 0x7f,
+    0x00, 0x7d, 0x00, 0x77, 0x00, 0x21, 0x00, 0x4e, 0x00, 0x85, 0x00, 0x7d, 0x01, 0x75, 0x00, 0x7f,
+    0x00, 0x77, 0x00, 0x38, 0x00, 0x73, 0x00, 0x75, 0x02, 0x7f, 0x00, 0x85, 0x00, 0x41, 0x00, 0x30,
+    0x00, 0x7f, 0x00, 0x75, 0x01, 0x7f, 0x01, 0x7d, 0x00, 0x32, 0x00, 0x39, 0x00, 0x85, 0x00, 0x7d,
+    0x01, 0x75, 0x00, 0x7d, 0x00, 0x85, 0x00, 0x40, 0x00, 0x2b, 0x01, 0x7d, 0x01, 0x7f, 0x00, 0x7d,
+    0x00, 0x6c, 0x00, 0x0a, 0x00, 0x3c, 0x00, 0x85, 0x00, 0x54, 0x00, 0x36, 0x00, 0x7d, 0x00, 0x75,
+    0x02, 0x7f, 0x00, 0x7d, 0x00, 0x6e, 0x00, 0x0c, 0x00, 0x3c, 0x00, 0x7d, 0x00, 0x75, 0x00, 0x7f,
+    0x00, 0x7d, 0x01, 0x75, 0x00, 0x7f, 0x00, 0x7d, 0x00, 0x75, 0x00, 0x18, 0x00, 0x1c, 0x00, 0x7d,
+    0x00, 0x75, 0x02, 0x7d, 0x00, 0x84, 0x00, 0x53, 0x00, 0x5d, 0x01, 0x7d, 0x02, 0x7f, 0x00, 0x7d,
+    0x00, 0x5a, 0x00, 0x13, 0x00, 0x76, 0x00, 0x7f, 0x00, 0x7d, 0x00, 0x75, 0x00, 0x77, 0x01, 0x7f,
+    0x03, 0x00, 0x00, 0x32, 0x00, 0x78, 0x00, 0x7d, 0x03, 0x7f, 0x00, 0x69, 0x00, 0x7d, 0x00, 0x48,
+    0x01, 0x00, 0x00, 0x16, 0x00, 0x80, 0x00, 0x70, 0x00, 0x19, 0x00, 0x5c, 0x03, 0x7f, 0x00, 0x85,
+    0x00, 0x56, 0x00, 0x63, 0x00, 0x84, 0x00, 0x7d, 0x01, 0x75, 0x00, 0x7f, 0x00, 0x80, 0x00, 0x3e,
+    0x00, 0x75, 0x00, 0x77, 0x02, 0x7f, 0x00, 0x85, 0x00, 0x28, 0x00, 0x49, 0x00, 0x7d, 0x00, 0x77,
+    0x00, 0x7f, 0x00, 0x77, 0x01, 0x75, 0x00, 0x7f, 0x00, 0x7d, 0x00, 0x6f, 0x00, 0x12, 0xa4, 0x00,
+    0x00, 0x77, 0x00, 0x75, 0x00, 0x4b, 0x01, 0x49, 0x00, 0x4b, 0x00, 0x2a, 0x00, 0x21, 0x00, 0x7f,
+    0x00, 0x73, 0x00, 0x45, 0x01, 0x3e, 0x00, 0x5a, 0x00, 0x7f, 0x00, 0x5c, 0x00, 0x23, 0x00, 0x3e,
+    0x00, 0x4f, 0x00, 0x7d, 0x00, 0x6e, 0x00, 0x3e, 0x00, 0x3c, 0x00, 0x2d, 0x00, 0x75, 0x00, 0x6e,
+    0x02, 0x3e, 0x00, 0x45, 0x00, 0x1b, 0x00, 0x31, 0x00, 0x84, 0x00, 0x6c, 0x01, 0x3c, 0x00, 0x50,
+    0x00, 0x7d, 0x00, 0x6e, 0x00, 0x2a, 0x00, 0x3e, 0x00, 0x49, 0x01, 0x77, 0x00, 0x4b, 0x00, 0x3e,
+    0x00, 0x24, 0x00, 0x6c, 0x00, 0x7d, 0x00, 0x52, 0x01, 0x3c, 0x00, 0x6c, 0x00, 0x84, 0x00, 0x34,
+    0x00, 0x37, 0x00, 0x85, 0x00, 0x54, 0x00, 0x34, 0x00, 0x7f, 0x00, 0x6a, 0x02, 0x3e, 0x00, 0x65,
+    0x00, 0x84, 0x00, 0x34, 0x00, 0x37, 0x00, 0x7f, 0x00, 0x6a, 0x00, 0x3e, 0x00, 0x5c, 0x00, 0x7d,
+    0x00, 0x6c, 0x00, 0x3e, 0x00, 0x5c, 0x00, 0x84, 0x00, 0x4c, 0x00, 0x1c, 0x00, 0x7d, 0x00, 0x6f,
+    0x02, 0x49, 0x00, 0x4b, 0x00, 0x24, 0x00, 0x5d, 0x00, 0x7d, 0x00, 0x59, 0x01, 0x3e, 0x00, 0x40,
+    0x00, 0x73, 0x00, 0x7f, 0x00, 0x2d, 0x00, 0x35, 0x00, 0x3e, 0x00, 0x62, 0x00, 0x7d, 0x00, 0x62,
+    0x01, 0x3e, 0x03, 0x00, 0x00, 0x7f, 0x00, 0x75, 0x00, 0x42, 0x02, 0x3b, 0x00, 0x39, 0x00, 0x54,
+    0x00, 0x84, 0x00, 0x45, 0x01, 0x00, 0x00, 0x14, 0x00, 0x80, 0x00, 0x65, 0x00, 0x43, 0x00, 0x84,
+    0x00, 0x5a, 0x03, 0x3b, 0x00, 0x29, 0x00, 0x2c, 0x00, 0x42, 0x00, 0x5c, 0x00, 0x7d, 0x00, 0x6e,
+    0x00, 0x3d, 0x00, 0x3b, 0x00, 0x32, 0x00, 0x7f, 0x00, 0x61, 0x02, 0x3e, 0x00, 0x45, 0x00, 0x14,
+    0x00, 0x49, 0x00, 0x7f, 0x00, 0x64, 0x00, 0x3d, 0x00, 0x65, 0x00, 0x7d, 0x00, 0x6a, 0x00, 0x3b,
+    0x00, 0x65, 0x00, 0x84, 0x00, 0x44, 0xa4, 0x00, 0x00, 0x77, 0x00, 0x75, 0x02, 0x62, 0x00, 0x66,
+    0x01, 0x20, 0x00, 0x7f, 0x00, 0x6c, 0x00, 0x01, 0x01, 0x00, 0x00, 0x2a, 0x00, 0x85, 0x00, 0x68,
+    0x01, 0x00, 0x00, 0x18, 0x00, 0x84, 0x00, 0x62, 0x01, 0x00, 0x00, 0x22, 0x00, 0x7d, 0x00, 0x6e,
+    0x00, 0x4f, 0x01, 0x4d, 0x00, 0x51, 0x00, 0x09, 0x00, 0x31, 0x00, 0x84, 0x00, 0x62, 0x00, 0x11,
+    0x00, 0x0d, 0x00, 0x2a, 0x00, 0x7d, 0x00, 0x6c, 0x00, 0x05, 0x00, 0x00, 0x00, 0x0a, 0x01, 0x78,
+    0x00, 0x0e, 0x00, 0x00, 0x00, 0x05, 0x00, 0x6e, 0x00, 0x7d, 0x00, 0x2c, 0x00, 0x0d, 0x00, 0x0e,
+    0x00, 0x5c, 0x00, 0x85, 0x00, 0x39, 0x00, 0x37, 0x00, 0x85, 0x00, 0x54, 0x00, 0x34, 0x00, 0x84,
+    0x00, 0x4f, 0x02, 0x00, 0x00, 0x4b, 0x00, 0x85, 0x00, 0x33, 0x00, 0x37, 0x00, 0x84, 0x00, 0x51,
+    0x00, 0x00, 0x00, 0x35, 0x00, 0x84, 0x00, 0x57, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x85, 0x00, 0x4e,
+    0x00, 0x1d, 0x00, 0x7d, 0x00, 0x75, 0x02, 0x62, 0x00, 0x66, 0x00, 0x14, 0x00, 0x5d, 0x00, 0x85,
+    0x00, 0x29, 0x02, 0x00, 0x00, 0x68, 0x00, 0x84, 0x00, 0x26, 0x01, 0x00, 0x00, 0x3e, 0x00, 0x85,
+    0x00, 0x42, 0x05, 0x00, 0x00, 0x6e, 0x00, 0x7d, 0x00, 0x4f, 0x02, 0x44, 0x00, 0x15, 0x00, 0x31,
+    0x00, 0x84, 0x00, 0x62, 0x01, 0x35, 0x00, 0x49, 0x00, 0x7d, 0x00, 0x6f, 0x00, 0x3a, 0x00, 0x84,
+    0x00, 0x62, 0x00, 0x42, 0x01, 0x44, 0x00, 0x34, 0x00, 0x02, 0x01, 0x00, 0x00, 0x2c, 0x00, 0x84,
+    0x00, 0x63, 0x01, 0x00, 0x00, 0x1a, 0x00, 0x7f, 0x00, 0x6c, 0x00, 0x4d, 0x02, 0x4f, 0x00, 0x08,
+    0x00, 0x49, 0x00, 0x85, 0x00, 0x44, 0x00, 0x00, 0x00, 0x46, 0x00, 0x84, 0x00, 0x44, 0x00, 0x00,
+    0x00, 0x3c, 0x00, 0x85, 0x00, 0x44, 0xa4, 0x00, 0x00, 0x77, 0x00, 0x75, 0x00, 0x51, 0x01, 0x4f,
+    0x00, 0x56, 0x00, 0x18, 0x00, 0x21, 0x00, 0x7f, 0x00, 0x6c, 0x00, 0x04, 0x01, 0x00, 0x00, 0x2c,
+    0x00, 0x85, 0x00, 0x66, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x84, 0x00, 0x62, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x22, 0x00, 0x7d, 0x00, 0x75, 0x02, 0x62, 0x00, 0x66, 0x00, 0x0c, 0x00, 0x31,
+    0x00, 0x7f, 0x00, 0x77, 0x00, 0x84, 0x00, 0x85, 0x00, 0x7f, 0x00, 0x7d, 0x00, 0x4f, 0x01, 0x00,
+    0x00, 0x0e, 0x01, 0x78, 0x00, 0x13, 0x00, 0x00, 0x00, 0x06, 0x00, 0x6e, 0x00, 0x77, 0x00, 0x7f,
+    0x00, 0x84, 0x00, 0x85, 0x00, 0x77, 0x00, 0x7f, 0x00, 0x39, 0x00, 0x37, 0x00, 0x85, 0x00, 0x54,
+    0x00, 0x34, 0x00, 0x84, 0x00, 0x52, 0x02, 0x00, 0x00, 0x50, 0x00, 0x85, 0x00, 0x33, 0x00, 0x37,
+    0x00, 0x84, 0x00, 0x57, 0x00, 0x00, 0x00, 0x37, 0x00, 0x84, 0x00, 0x59, 0x00, 0x00, 0x00, 0x32,
+    0x00, 0x85, 0x00, 0x4c, 0x00, 0x1d, 0x00, 0x7d, 0x00, 0x73, 0x02, 0x4f, 0x00, 0x51, 0x00, 0x0e,
+    0x00, 0x5d, 0x00, 0x84, 0x00, 0x30, 0x01, 0x00, 0x00, 0x03, 0x00, 0x6d, 0x00, 0x7f, 0x00, 0x27,
+    0x01, 0x00, 0x00, 0x40, 0x00, 0x85, 0x00, 0x42, 0x05, 0x00, 0x00, 0x0e, 0x00, 0x45, 0x00, 0x58,
+    0x01, 0x54, 0x00, 0x78, 0x00, 0x73, 0x00, 0x2c, 0x00, 0x6e, 0x00, 0x80, 0x00, 0x7f, 0x00, 0x7d,
+    0x01, 0x80, 0x00, 0x44, 0x00, 0x02, 0x00, 0x2b, 0x00, 0x56, 0x00, 0x58, 0x00, 0x51, 0x00, 0x62,
+    0x00, 0x86, 0x00, 0x44, 0x01, 0x00, 0x00, 0x2e, 0x00, 0x84, 0x00, 0x63, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x1a, 0x00, 0x7f, 0x00, 0x6e, 0x00, 0x5e, 0x00, 0x5c, 0x00, 0x62, 0x00, 0x5c, 0x00, 0x0c,
+    0x00, 0x49, 0x00, 0x85, 0x00, 0x47, 0x00, 0x00, 0x00, 0x49, 0x00, 0x84, 0x00, 0x47, 0x00, 0x00,
+    0x00, 0x3e, 0x00, 0x85, 0x00, 0x44, 0xa4, 0x00, 0x00, 0x7f, 0x00, 0x75, 0x00, 0x49, 0x00, 0x3f,
+    0x00, 0x41, 0x00, 0x46, 0x00, 0x29, 0x00, 0x21, 0x00, 0x7f, 0x00, 0x6c, 0x00, 0x04, 0x01, 0x00,
+    0x00, 0x2c, 0x00, 0x85, 0x00, 0x66, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x84, 0x00, 0x62,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x22, 0x00, 0x7f, 0x00, 0x6d, 0x02, 0x41, 0x00, 0x49, 0x00, 0x19,
+    0x00, 0x31, 0x00, 0x84, 0x00, 0x6c, 0x00, 0x2b, 0x00, 0x28, 0x00, 0x45, 0x00, 0x7f, 0x00, 0x58,
+    0x01, 0x00, 0x00, 0x0e, 0x01, 0x78, 0x00, 0x13, 0x00, 0x00, 0x00, 0x06, 0x00, 0x6c, 0x00, 0x7d,
+    0x00, 0x45, 0x01, 0x29, 0x00, 0x65, 0x00, 0x84, 0x00, 0x39, 0x00, 0x37, 0x00, 0x85, 0x00, 0x54,
+    0x00, 0x34, 0x00, 0x84, 0x00, 0x52, 0x02, 0x00, 0x00, 0x50, 0x00, 0x85, 0x00, 0x33, 0x00, 0x37,
+    0x00, 0x84, 0x00, 0x57, 0x00, 0x00, 0x00, 0x37, 0x00, 0x84, 0x00, 0x59, 0x00, 0x00, 0x00, 0x32,
+    0x00, 0x85, 0x00, 0x4c, 0x00, 0x1c, 0x00, 0x7d, 0x00, 0x6e, 0x01, 0x3f, 0x00, 0x41, 0x00, 0x46,
+    0x00, 0x22, 0x00, 0x5d, 0x00, 0x84, 0x00, 0x30, 0x01, 0x00, 0x00, 0x03, 0x00, 0x6d, 0x00, 0x7f,
+    0x00, 0x27, 0x01, 0x00, 0x00, 0x40, 0x00, 0x85, 0x00, 0x42, 0x05, 0x00, 0x00, 0x3c, 0x00, 0x3e,
+    0x02, 0x41, 0x00, 0x6d, 0x00, 0x7f, 0x00, 0x16, 0x00, 0x0e, 0x00, 0x2a, 0x00, 0x6f, 0x00, 0x7d,
+    0x00, 0x3e, 0x00, 0x1c, 0x00, 0x01, 0x00, 0x1b, 0x00, 0x3e, 0x02, 0x41, 0x00, 0x54, 0x00, 0x7f,
+    0x00, 0x56, 0x01, 0x00, 0x00, 0x2e, 0x00, 0x84, 0x00, 0x63, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1e,
+    0x00, 0x85, 0x00, 0x65, 0x02, 0x41, 0x00, 0x49, 0x00, 0x15, 0x00, 0x49, 0x00, 0x85, 0x00, 0x47,
+    0x00, 0x00, 0x00, 0x49, 0x00, 0x84, 0x00, 0x47, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x85, 0x00, 0x44,
+    0xa4, 0x00, 0x00, 0x49, 0x01, 0x7d, 0x01, 0x7f, 0x00, 0x85, 0x00, 0x57, 0x00, 0x21, 0x00, 0x80,
+    0x00, 0x6c, 0x00, 0x04, 0x01, 0x00, 0x00, 0x2c, 0x00, 0x85, 0x00, 0x66, 0x00, 0x01, 0x00, 0x00,
+    0x00, 0x1a, 0x00, 0x84, 0x00, 0x65, 0x00, 0x03, 0x00, 0x00, 0x00, 0x06, 0x00, 0x62, 0x03, 0x7d,
+    0x00, 0x85, 0x00, 0x41, 0x00, 0x31, 0x00, 0x84, 0x00, 0x5d, 0x01, 0x00, 0x00, 0x19, 0x00, 0x80,
+    0x00, 0x5a, 0x01, 0x00, 0x00, 0x0e, 0x01, 0x78, 0x00, 0x13, 0x00, 0x00, 0x00, 0x06, 0x00, 0x6b,
+    0x00, 0x80, 0x00, 0x1c, 0x01, 0x00, 0x00, 0x5a, 0x00, 0x85, 0x00, 0x39, 0x00, 0x37, 0x00, 0x85,
+    0x00, 0x54, 0x00, 0x36, 0x00, 0x84, 0x00, 0x52, 0x02, 0x00, 0x00, 0x52, 0x00, 0x85, 0x00, 0x33,
+    0x00, 0x3c, 0x00, 0x84, 0x00, 0x56, 0x00, 0x00, 0x00, 0x37, 0x00, 0x84, 0x00, 0x59, 0x00, 0x00,
+    0x00, 0x32, 0x00, 0x85, 0x00, 0x4e, 0x00, 0x05, 0x00, 0x5d, 0x00, 0x7d, 0x02, 0x7f, 0x00, 0x85,
+    0x00, 0x53, 0x00, 0x5c, 0x00, 0x84, 0x00, 0x30, 0x01, 0x00, 0x00, 0x03, 0x00, 0x6d, 0x00, 0x7f,
+    0x00, 0x2a, 0x01, 0x00, 0x00, 0x45, 0x00, 0x85, 0x00, 0x42, 0x05, 0x00, 0x01, 0x7f, 0x03, 0x7d,
+    0x00, 0x51, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x6d, 0x00, 0x84, 0x00, 0x1f, 0x01, 0x00,
+    0x00, 0x3e, 0x00, 0x85, 0x03, 0x7d, 0x00, 0x75, 0x00, 0x1a, 0x01, 0x00, 0x00, 0x32, 0x00, 0x84,
+    0x00, 0x62, 0x00, 0x01, 0x00, 0x00, 0x00, 0x09, 0x00, 0x66, 0x03, 0x7d, 0x00, 0x85, 0x00, 0x28,
+    0x00, 0x49, 0x00, 0x85, 0x00, 0x44, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x84, 0x00, 0x47, 0x00, 0x00,
+    0x00, 0x40, 0x00, 0x85, 0x00, 0x44, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
+    0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x58, 0x00,
 #endif /* GNW_TARGET_ZELDA */
 };
@@ -1,73 +1,361 @@
+// Packed bitmap, see bitmaps.h. Generated by tools/img2bin.py --lut8-rle
 #if !defined(GNW_TARGET_ZELDA)
 #define GNW_TARGET_ZELDA 0
 #endif /* GNW_TARGET_ZELDA */
 
-const unsigned short header_pce[] = {
+const unsigned char header_pce[] __attribute__((aligned(4))) = {
 #if GNW_TARGET_ZELDA != 0
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x3BA3,0x43C4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x3BA3,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1341,0x63C4,0xA446,0x5BE4,0x0B20,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x8C25,0x5BC4,0x1362,0x0320,0x0320,0x0320,0x3382,0x8405,0xCC67,0xBC67,0x3B82,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x2362,0x3BA3,0x5BE4,0x7C05,0x9C26,0xCC68,0xD488,0x8C26,0x1341,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x5BC4,0xDC87,0x4BA3,0x1B61,0x5BC4,0xAC46,0xDC67,0xE4A7,0x9405,0x1341,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x2362,0x9426,0xCC67,0xDC67,0xDC87,0xDC87,0xDC67,0xD446,0xD446,0xE487,0x9C26,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x2B62,0xD467,0xCC47,0xC447,0xDC67,0xDC87,0xD467,0x63C4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1B61,0x2B82,0x53C4,0x6BE4,0x9426,0x7C05,0x2362,0x0320,0x0320,0x0320,0x43A3,0xCC67,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD467,0x2B82,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0B20,0x1B41,0x2341,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x4BA3,0xD467,0xD467,0xD447,0xDC67,0xBC47,0x3B82,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1361,0x2B82,0x4BA3,0x6BE4,0x9405,0x9C26,0x5BC4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x3382,0x53C4,0x7405,0x9426,0xB447,0xC467,0xD467,0xDC67,0xDC87,0xDC67,0xDC87,0xC467,0x2362,0x0320,0x2B82,0xCC67,0xDC67,0xD447,0xD447,0xDC67,0xDC67,0xDC67,0xD447,0xD447,0xD447,0xD447,0xDC67,0x43C3,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1341,0x2B82,0x43A3,0x63C4,0x8405,0xA426,0xBC46,0xD467,0x83C4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x73E4,0xD467,0xD447,0xD447,0xDC67,0xA426,0x1341,0x0320,0x0320,0x0320,0x0B40,0x1B61,0x2382,0x0320,0x0320,0x5BC3,0xB446,0xD467,0xDC87,0xDC87,0xD467,0xBC47,0xC446,0xE4A7,0x73E5,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x3382,0xDC67,0xDC87,0xDC87,0xDC67,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC87,0x8405,0x0320,0xA426,0xDC67,0xD447,0xD447,0xD467,0xBC47,0xA426,0x8405,0xC447,0xDC67,0xDC87,0xDC87,0xDC87,0x2B62,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x7BE5,0xCC67,0xDC67,0xE4A7,0xE4A7,0xD467,0xC447,0xAC26,0xD467,0x63A3,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1B61,0x9C26,0xDC87,0xDC67,0xD447,0xC447,0xE487,0x8405,0x2B82,0x63E4,0x8405,0xA426,0xC447,0xD467,0xDC87,0xA426,0x8C05,0xE4A7,0xB446,0x73E4,0x4BA3,0x2B62,0x1341,0x0320,0x1B61,0xC447,0xD488,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x5BC4,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD447,0xD467,0xD447,0xD447,0xD447,0xD447,0xDC67,0x9C26,0x43A3,0xD467,0xD447,0xD447,0xDC67,0x8C05,0x0B41,0x0320,0x0320,0x9426,0xAC47,0x8C05,0x6BE5,0x43A3,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x3382,0xDC87,0xB446,0x7C05,0x5BC4,0x3B82,0x1B61,0x0340,0x0B41,0xC447,0x4362,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x4383,0xC447,0xE487,0xC447,0x9426,0x7405,0x7405,0xAC26,0xB426,0x5BC4,0xDC88,0xC447,0xAC26,0x8C05,0x63C4,0x5BC4,0xC447,0xE487,0x8C05,0x0320,0x0320,0x0B41,0x2B62,0x3B82,0x0320,0x0320,0xBC47,0xC467,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x8405,0xDC67,0xD447,0xD447,0xD447,0xDC67,0xD467,0xC447,0xC446,0xD447,0xD447,0xD447,0xDC67,0x8C05,0x73E5,0xDC67,0xD447,0xD447,0xDC67,0x53C4,0x0320,0x0320,0x0320,0x0B41,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x5BC4,0xDC87,0x3382,0x0320,0x0320,0x0320,0x2361,0x3B82,0x73E4,0xCC46,0x2341,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x2361,0x4BA3,0x1B62,0x73E4,0xD487,0xBC67,0x8C26,0x8426,0x9C26,0xAC46,0xA447,0x7405,0xA426,0x2B82,0x1B61,0x0320,0x0320,0x0320,0x0320,0x0320,0x9C26,0xC447,0x0B40,0x1B61,0xA446,0xC467,0xC467,0x9C26,0x0320,0x2361,0xDC67,0x8C05,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x9C26,0xDC67,0xD447,0xD447,0xD447,0x5BE4,0x2B62,0x1341,0x63E4,0xDC67,0xD447,0xD447,0xDC67,0x6BE5,0x9426,0xDC67,0xD447,0xD447,0xD467,0x3382,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1341,0x8405,0xCC67,0x1341,0x1341,0x9C26,0xC447,0xD467,0xDC87,0xD467,0xA426,0x0320,0x0320,0x0320,0x0320,0x1341,0x2362,0x43A3,0x63E4,0x63E4,0x1B61,0x1341,0x8C05,0xBC67,0x7405,0x8C26,0x9C26,0x4BC4,0x43E4,0x3BA3,0xA426,0xBC47,0x0B40,0x3BA3,0xCC67,0x43A3,0x2B82,0x1B61,0x3BA3,0x5BC4,0x7BE5,0x1B41,0x0B40,0xC447,0x9405,0x0320,0x2B82,0x53C4,0x2B62,0x1341,0x0320,0x0320,0x83E5,0xD467,0x2B62,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0B41,0xBC47,0xDC67,0xD447,0xD447,0xC447,0x0B41,0x0320,0x0320,0x8405,0xDC67,0xD447,0xD447,0xD467,0x53E4,0xB446,0xD467,0xD447,0xD447,0xC447,0x1341,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x43A3,0x6405,0x2B82,0xAC26,0xB446,0x0320,0x3BA3,0xE487,0x9405,0x5BC4,0x43A3,0x33A3,0x1B61,0x5382,0x7BC4,0x9C05,0xAC46,0xCC47,0xDC67,0xDC87,0xD467,0xD467,0xC447,0xB446,0xBC46,0x4BC4,0x43C4,0x2361,0x0320,0x0320,0x0320,0x0320,0xAC26,0x9405,0x0320,0x63C4,0xCC67,0x0B40,0x1B61,0xCC67,0xDC87,0xDC87,0xDC87,0x2362,0x1B61,0xDC67,0x6BE4,0x0320,0x0320,0x0B40,0x2362,0x43A3,0x6BE4,0xA426,0xDC67,0xD467,0x3382,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x2362,0xCC67,0xD447,0xD447,0xDC67,0xA426,0x0320,0x0320,0x0320,0xA446,0xDC67,0xD447,0xD446,0xCC67,0x4BC4,0xCC47,0xD447,0xD447,0xDC67,0xAC26,0x0320,0x0320,0x0320,0x0B40,0x0B40,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1B61,0x5BE4,0xB467,0x8C26,0x1B41,0x1341,0xCC47,0x8C05,0x0320,0x63C4,0xDC87,0x8C06,0x9405,0xAC46,0x9C26,0x4BC3,0xDC87,0xD467,0xBC46,0x9C26,0x7BE5,0x5BC4,0x3B82,0x2361,0x2362,0xC446,0xD467,0x2B62,0x0320,0x1B61,0x3382,0x53C3,0x73E5,0x1341,0x0B41,0xCC67,0x6BE4,0x0320,0x9405,0xB446,0x0320,0x43A3,0xE4A7,0x63E4,0x9C26,0xC447,0x0B20,0x43A3,0xE487,0x43A3,0x0320,0x9426,0xCC67,0xD467,0xCC67,0xBC47,0xA426,0xC447,0xD467,0x2B62,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x4383,0xDC67,0xD447,0xD447,0xDC87,0x7C05,0x0320,0x0320,0x2382,0xC447,0xD447,0xD447,0xDC67,0xAC26,0x4BC4,0xDC67,0xD447,0xD447,0xDC67,0x8C06,0x0320,0x0320,0x0320,0x1B61,0xAC47,0x1341,0x0320,0x0320,0x0320,0x0320,0x0320,0x3382,0x8405,0xCC67,0xDC87,0x6BE4,0x0320,0x0320,0x2B82,0xDC87,0x63C4,0x0320,0x8C26,0xDC87,0xCC67,0xB446,0xD467,0x8C05,0x6BE4,0xDC67,0x3382,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xB426,0xAC26,0x0320,0x4BA3,0xCC67,0xDC87,0xDC87,0xCC47,0x0B40,0x2B62,0xDC87,0x43A3,0x0320,0xB446,0x8C05,0x0320,0x6BE4,0xDC87,0x2B82,0xAC26,0xAC26,0x0320,0x6BE4,0xD467,0x2361,0x0320,0x53A3,0x5BC4,0x3382,0x1B41,0x0320,0x0320,0xBC47,0xC447,0x0B41,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x63C4,0xDC87,0xD447,0xD447,0xDC67,0x9C26,0x8405,0xA426,0xC447,0xD447,0xD447,0xD447,0xDC87,0x5BC4,0x63C4,0xDC87,0xD447,0xD447,0xDC87,0x63C4,0x0320,0x0320,0x0B40,0x6405,0xA426,0xBC46,0x0320,0x23C4,0x1361,0x5BC4,0xA446,0xD467,0xE4A7,0xBC47,0x3B83,0x0320,0x0320,0x0320,0x4BA3,0xE487,0x43A3,0x0320,0x3382,0x2B62,0x0B41,0x0B41,0xC447,0x63E4,0x8C05,0xC447,0x0B20,0x1341,0x6BE4,0x8C05,0xAC26,0xAC46,0x0B40,0x1341,0xCC47,0x8405,0x0320,0x9426,0xBC47,0x4BC4,0xC447,0xA426,0x0320,0x4BA3,0xD467,0x1B61,0x1341,0xCC67,0x63C4,0x0320,0x9405,0xC447,0x2B82,0xCC67,0x8405,0x0320,0x9405,0xD467,0x2362,0x0320,0x0320,0x0320,0x0320,0x1B61,0x3B82,0x6BE4,0xDC67,0xA426,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x83E4,0xDC67,0xD447,0xD447,0xD447,0xDC67,0xDC67,0xDC67,0xD467,0xD447,0xD447,0xDC67,0xA426,0x0320,0x8C05,0xDC67,0xD447,0xD447,0xDC67,0x5BC4,0x2B82,0x4BC3,0x8C05,0xB447,0x7C06,0xE487,0xAC26,0x7C05,0xC467,0xDC87,0xDC67,0xDC87,0x9C26,0x1B61,0x0320,0x0320,0x0320,0x0320,0x73E4,0xD467,0x2361,0x0320,0x0320,0x1341,0x3382,0x63C4,0xDC67,0x4BC3,0xB426,0xA426,0x0320,0x4BA3,0xE4A7,0xC447,0xD467,0xBC47,0x0320,0x3382,0xDC87,0x5BC4,0x0320,0xB426,0xC447,0xA426,0xDC87,0x8405,0x0320,0x7BE5,0xC447,0x0320,0x3382,0xDC87,0x3B82,0x0320,0xB446,0xA426,0x3383,0xDC87,0x53C3,0x0320,0xB446,0xDC67,0xAC26,0x73E4,0x8405,0xAC26,0xC447,0xD467,0xDC87,0xD467,0xC467,0x6BE5,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xA405,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC87,0xAC26,0x1B41,0x0320,0xAC46,0xDC67,0xD447,0xD447,0xD447,0xCC47,0xD467,0xDC67,0xE487,0xB446,0x5BE5,0xD467,0xDC67,0xDC67,0xD467,0xDC67,0xD467,0x73E5,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x9C26,0xBC47,0x0320,0x2B62,0xB446,0xD467,0xDC87,0xD467,0xB446,0x33A3,0xCC67,0x7BE5,0x0320,0x73E5,0xD467,0x2B83,0xBC46,0x9C26,0x0320,0x5BC4,0xDC87,0x3382,0x1341,0xC467,0xCC67,0xBC47,0xA446,0x3B82,0x0320,0xA426,0x9C26,0x0320,0x53C3,0xD467,0x1361,0x1B61,0xD467,0x73E5,0x53C3,0xDC87,0xAC46,0xB447,0xDC67,0xD467,0xDC67,0xD467,0xC447,0xA426,0x8405,0x63C4,0x43A3,0x2362,0x0B41,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0B20,0xB426,0xDC67,0xD447,0xD447,0xD447,0xDC67,0xDC67,0xDC87,0xDC67,0xC467,0x7C05,0x0B41,0x0320,0x0B40,0xB446,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC67,0xA426,0x4BC4,0xA426,0xD467,0xD447,0xD447,0xDC67,0xC467,0x4BA3,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0B40,0xBC47,0x9C26,0x0320,0x5BC4,0xE487,0x73E5,0x4BC4,0x3BA3,0x3BA3,0x63E4,0xDC87,0x53C3,0x0320,0x9C26,0xBC46,0x2B82,0xD467,0x73E5,0x0320,0x8405,0xD467,0x1B41,0x0320,0x2B62,0x1B61,0x0320,0x0320,0x0320,0x0B40,0xBC47,0x8C05,0x3BA3,0x9C26,0xD467,0xA426,0xBC47,0xE4A7,0x53C3,0x7C05,0xCC67,0xB446,0x9C26,0x7405,0x3B82,0x2B62,0x1B61,0x0B40,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1B41,0xCC46,0xD467,0xD447,0xD447,0xCC47,0x9C26,0x7C05,0x5BC4,0x3BA3,0x1341,0x0320,0x0320,0x0320,0x0320,0x9426,0xDC87,0xD447,0xD447,0xD447,0xD467,0xDC67,0x8405,0x53C4,0xBC47,0xDC67,0xD447,0xD447,0xD467,0xC467,0x2382,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1B61,0xD467,0x73E5,0x0320,0x8405,0xDC87,0x9C26,0xAC26,0xC447,0xD467,0xDC67,0xD467,0x2B82,0x0320,0xBC47,0x9405,0x3BA3,0xE4A7,0x4BA3,0x0320,0xA426,0xCC67,0x2362,0x0320,0x0B41,0x2362,0x43A3,0x5BC4,0x0320,0x1B61,0xCC67,0xDC67,0xDC87,0xD467,0xBC46,0xAC46,0x9425,0x6BE4,0x1B41,0x1B61,0x1341,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x3361,0xD447,0xD447,0xD447,0xDC67,0x7405,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x2B82,0xC467,0xDC87,0xDC67,0xDC87,0xCC67,0x63E5,0x6C05,0xD467,0xDC67,0xDC67,0xDC67,0xCC67,0xDC67,0xC447,0x1341,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x3BA3,0xE4A7,0x4BA3,0x0320,0xA426,0xCC67,0xBC46,0x9C26,0x7BE5,0x53C3,0xA446,0xCC47,0x0B40,0x1B61,0xD467,0x6BE4,0x5BC4,0xDC87,0x43A3,0x3382,0xC446,0xDC67,0xBC47,0xB446,0xCC67,0xD467,0xE487,0xB446,0x0320,0x43A3,0xDC67,0x6BE4,0x43A3,0x2362,0x0B41,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x4B82,0xDC67,0xD447,0xD447,0xDC67,0x43A3,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x2362,0x7405,0x8426,0x5BC4,0x43C4,0x9426,0xDC87,0xDC87,0xD467,0xA426,0x53C3,0x2B82,0xAC26,0xE487,0x3B83,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x63E4,0xDC87,0x2B82,0x0320,0x2B62,0x1341,0x0320,0x0320,0x0320,0x0320,0xAC26,0xB447,0x2361,0x63E4,0xE487,0x43A3,0x8C05,0xE487,0xD467,0xDC87,0xD467,0xB426,0xA426,0x8C05,0x73E5,0xAC47,0xE487,0x63C4,0x0320,0x7BE5,0xC447,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x6BC3,0xDC87,0xD447,0xD447,0xD467,0x2362,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x3382,0xBC67,0xE4A7,0xC447,0x7C05,0x2B82,0x0320,0x0320,0x0320,0x1B61,0xBC67,0x6BE4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x9405,0xC447,0x0B40,0x0320,0x0320,0x0B41,0x2B62,0x43A3,0x6BE4,0x8C05,0xD447,0xDC67,0xD467,0xDC87,0xCC67,0x2B82,0x8405,0x8C25,0x6BE4,0x4BA3,0x3382,0x4BC4,0x63E4,0x8405,0xAC26,0xDC67,0x9405,0x0320,0x1B61,0xD467,0x7BE5,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x8BE4,0xDC67,0xD447,0xD467,0xBC47,0x0B41,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x6BE4,0xD488,0xAC46,0x53C4,0x1341,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x2B62,0x7405,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xBC47,0xC447,0x73E5,0x9426,0xB446,0xCC67,0xDC67,0xDC87,0xD467,0xBC47,0xA426,0x8405,0x63C4,0x43A3,0x2362,0x0320,0x0320,0x0320,0x0320,0x0320,0x1B61,0xCC67,0xE487,0xD467,0xBC67,0x6BE4,0x0320,0x0B40,0xA426,0xCC67,0x1B61,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xAC25,0xE487,0xDC67,0xDC67,0x9C26,0x0B41,0x0B41,0x0B41,0x0B41,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1B61,0x7C26,0x8C26,0x3382,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1361,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xCC68,0xD467,0xCC67,0xBC47,0x9C26,0x7BE5,0x53C4,0x3B82,0x1B61,0x0B40,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x43A3,0xDC87,0x6BE4,0x1B61,0x0320,0x0320,0x2361,0xAC46,0xDC87,0x4BA3,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x4382,0x6BC3,0x5382,0x3361,0x1340,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0B40,0x3BC4,0x1B61,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x2B82,0x3382,0x1361,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x6BE4,0xDC87,0x3382,0x1B61,0x3B82,0x7C05,0xD467,0xCC67,0x53A3,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x9405,0xE487,0xCC47,0xD467,0xDC87,0xCC67,0x8405,0x2361,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xA447,0xA446,0x8405,0x63E4,0x3B82,0x1341,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
+    0x40, 0x01, 0x20, 0x00, 0x70, 0x00, 0x20, 0x03, 0x40, 0x03, 0x20, 0x0b, 0x40, 0x0b, 0x41, 0x0b,
+    0x40, 0x13, 0x41, 0x13, 0x61, 0x13, 0x62, 0x13, 0x41, 0x1b, 0x61, 0x1b, 0x62, 0x1b, 0x41, 0x23,
+    0x61, 0x23, 0x62, 0x23, 0x82, 0x23, 0xc4, 0x23, 0x62, 0x2b, 0x82, 0x2b, 0x83, 0x2b, 0x61, 0x33,
+    0x82, 0x33, 0x83, 0x33, 0xa3, 0x33, 0x82, 0x3b, 0x83, 0x3b, 0xa3, 0x3b, 0xc4, 0x3b, 0x62, 0x43,
+    0x82, 0x43, 0x83, 0x43, 0xa3, 0x43, 0xc3, 0x43, 0xc4, 0x43, 0xe4, 0x43, 0x82, 0x4b, 0xa3, 0x4b,
+    0xc3, 0x4b, 0xc4, 0x4b, 0x82, 0x53, 0xa3, 0x53, 0xc3, 0x53, 0xc4, 0x53, 0xe4, 0x53, 0xc3, 0x5b,
+    0xc4, 0x5b, 0xe4, 0x5b, 0xe5, 0x5b, 0xa3, 0x63, 0xc4, 0x63, 0xe4, 0x63, 0xe5, 0x63, 0x05, 0x64,
+    0xc3, 0x6b, 0xe4, 0x6b, 0xe5, 0x6b, 0x05, 0x6c, 0xe4, 0x73, 0xe5, 0x73, 0x05, 0x74, 0xc4, 0x7b,
+    0xe5, 0x7b, 0x05, 0x7c, 0x06, 0x7c, 0x26, 0x7c, 0xc4, 0x83, 0xe4, 0x83, 0xe5, 0x83, 0x05, 0x84,
+    0x26, 0x84, 0xe4, 0x8b, 0x05, 0x8c, 0x06, 0x8c, 0x25, 0x8c, 0x26, 0x8c, 0x05, 0x94, 0x25, 0x94,
+    0x26, 0x94, 0x05, 0x9c, 0x26, 0x9c, 0x05, 0xa4, 0x26, 0xa4, 0x46, 0xa4, 0x47, 0xa4, 0x25, 0xac,
+    0x26, 0xac, 0x46, 0xac, 0x47, 0xac, 0x26, 0xb4, 0x46, 0xb4, 0x47, 0xb4, 0x67, 0xb4, 0x46, 0xbc,
+    0x47, 0xbc, 0x67, 0xbc, 0x46, 0xc4, 0x47, 0xc4, 0x67, 0xc4, 0x46, 0xcc, 0x47, 0xcc, 0x67, 0xcc,
+    0x68, 0xcc, 0x46, 0xd4, 0x47, 0xd4, 0x67, 0xd4, 0x87, 0xd4, 0x88, 0xd4, 0x67, 0xdc, 0x87, 0xdc,
+    0x88, 0xdc, 0x87, 0xe4, 0xa7, 0xe4, 0xff, 0x00, 0xff, 0x00, 0xdc, 0x00, 0x00, 0x1a, 0x00, 0x21,
+    0xff, 0x00, 0x32, 0x00, 0x00, 0x1a, 0x06, 0x00, 0x00, 0x06, 0x00, 0x31, 0x00, 0x52, 0x00, 0x2e,
+    0x00, 0x02, 0xff, 0x00, 0x32, 0x00, 0x00, 0x49, 0x00, 0x2d, 0x00, 0x08, 0x02, 0x00, 0x00, 0x15,
+    0x00, 0x44, 0x00, 0x64, 0x00, 0x5e, 0x00, 0x18, 0xff, 0x00, 0x03, 0x00, 0x00, 0x0e, 0x00, 0x1a,
+    0x00, 0x2e, 0x00, 0x3e, 0x00, 0x4f, 0x00, 0x65, 0x00, 0x6a, 0x00, 0x4a, 0x00, 0x06, 0x27, 0x00,
+    0x00, 0x2d, 0x00, 0x6c, 0x00, 0x24, 0x00, 0x0a, 0x00, 0x2d, 0x00, 0x56, 0x00, 0x6b, 0x00, 0x6f,
+    0x00, 0x4b, 0x00, 0x06, 0xff, 0x00, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x4d, 0x00, 0x64, 0x00, 0x6b,
+    0x01, 0x6c, 0x00, 0x6b, 0x01, 0x66, 0x00, 0x6e, 0x00, 0x4f, 0x27, 0x00, 0x00, 0x11, 0x00, 0x68,
+    0x00, 0x63, 0x00, 0x60, 0x00, 0x6b, 0x00, 0x6c, 0x00, 0x68, 0x00, 0x31, 0xf9, 0x00, 0x00, 0x0a,
+    0x00, 0x12, 0x00, 0x2a, 0x00, 0x36, 0x00, 0x4d, 0x00, 0x3e, 0x00, 0x0e, 0x02, 0x00, 0x00, 0x1f,
+    0x00, 0x64, 0x00, 0x6c, 0x07, 0x67, 0x00, 0x68, 0x00, 0x12, 0x10, 0x00, 0x00, 0x02, 0x00, 0x09,
+    0x00, 0x0c, 0x12, 0x00, 0x00, 0x24, 0x01, 0x68, 0x00, 0x67, 0x00, 0x6b, 0x00, 0x5d, 0x00, 0x18,
+    0x08, 0x00, 0x00, 0x07, 0x00, 0x12, 0x00, 0x24, 0x00, 0x36, 0x00, 0x4b, 0x00, 0x4f, 0x00, 0x2d,
+    0xe5, 0x00, 0x00, 0x15, 0x00, 0x2a, 0x00, 0x3b, 0x00, 0x4d, 0x00, 0x5a, 0x00, 0x61, 0x00, 0x68,
+    0x00, 0x6b, 0x00, 0x6c, 0x00, 0x6b, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x12,
+    0x00, 0x64, 0x00, 0x6b, 0x01, 0x67, 0x02, 0x6b, 0x03, 0x67, 0x00, 0x6b, 0x00, 0x20, 0x0a, 0x00,
+    0x00, 0x06, 0x00, 0x12, 0x00, 0x1f, 0x00, 0x31, 0x00, 0x44, 0x00, 0x51, 0x00, 0x5c, 0x00, 0x68,
+    0x00, 0x41, 0x11, 0x00, 0x00, 0x39, 0x00, 0x68, 0x01, 0x67, 0x00, 0x6b, 0x00, 0x51, 0x00, 0x06,
+    0x02, 0x00, 0x00, 0x03, 0x00, 0x0a, 0x00, 0x0f, 0x01, 0x00, 0x00, 0x2c, 0x00, 0x59, 0x00, 0x68,
+    0x01, 0x6c, 0x00, 0x68, 0x00, 0x5d, 0x00, 0x5f, 0x00, 0x6f, 0x00, 0x3a, 0xe3, 0x00, 0x00, 0x15,
+    0x00, 0x6b, 0x01, 0x6c, 0x01, 0x6b, 0x05, 0x67, 0x00, 0x6c, 0x00, 0x44, 0x00, 0x00, 0x00, 0x51,
+    0x00, 0x6b, 0x01, 0x67, 0x00, 0x68, 0x00, 0x5d, 0x00, 0x51, 0x00, 0x44, 0x00, 0x60, 0x00, 0x6b,
+    0x02, 0x6c, 0x00, 0x11, 0x09, 0x00, 0x00, 0x3d, 0x00, 0x64, 0x00, 0x6b, 0x01, 0x6f, 0x00, 0x68,
+    0x00, 0x60, 0x00, 0x55, 0x00, 0x68, 0x00, 0x30, 0x0f, 0x00, 0x00, 0x0a, 0x00, 0x4f, 0x00, 0x6c,
+    0x00, 0x6b, 0x00, 0x67, 0x00, 0x60, 0x00, 0x6e, 0x00, 0x44, 0x00, 0x12, 0x00, 0x32, 0x00, 0x44,
+    0x00, 0x51, 0x00, 0x60, 0x00, 0x68, 0x00, 0x6c, 0x00, 0x51, 0x00, 0x47, 0x00, 0x6f, 0x00, 0x59,
+    0x00, 0x39, 0x00, 0x24, 0x00, 0x11, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x60, 0x00, 0x6a,
+    0xe3, 0x00, 0x00, 0x2d, 0x00, 0x6c, 0x04, 0x67, 0x00, 0x68, 0x03, 0x67, 0x00, 0x6b, 0x00, 0x4f,
+    0x00, 0x1f, 0x00, 0x68, 0x01, 0x67, 0x00, 0x6b, 0x00, 0x47, 0x00, 0x04, 0x01, 0x00, 0x00, 0x4d,
+    0x00, 0x57, 0x00, 0x47, 0x00, 0x37, 0x00, 0x1f, 0x09, 0x00, 0x00, 0x15, 0x00, 0x6c, 0x00, 0x59,
+    0x00, 0x3e, 0x00, 0x2d, 0x00, 0x18, 0x00, 0x0a, 0x00, 0x01, 0x00, 0x04, 0x00, 0x60, 0x00, 0x1c,
+    0x0e, 0x00, 0x00, 0x1e, 0x00, 0x60, 0x00, 0x6e, 0x00, 0x60, 0x00, 0x4d, 0x01, 0x3b, 0x00, 0x55,
+    0x00, 0x58, 0x00, 0x2d, 0x00, 0x6d, 0x00, 0x60, 0x00, 0x55, 0x00, 0x47, 0x00, 0x31, 0x00, 0x2d,
+    0x00, 0x60, 0x00, 0x6e, 0x00, 0x47, 0x01, 0x00, 0x00, 0x04, 0x00, 0x11, 0x00, 0x18, 0x01, 0x00,
+    0x00, 0x5d, 0x00, 0x61, 0xe3, 0x00, 0x00, 0x44, 0x00, 0x6b, 0x02, 0x67, 0x00, 0x6b, 0x00, 0x68,
+    0x00, 0x60, 0x00, 0x5f, 0x02, 0x67, 0x00, 0x6b, 0x00, 0x47, 0x00, 0x3a, 0x00, 0x6b, 0x01, 0x67,
+    0x00, 0x6b, 0x00, 0x2a, 0x02, 0x00, 0x00, 0x04, 0x0d, 0x00, 0x00, 0x2d, 0x00, 0x6c, 0x00, 0x15,
+    0x02, 0x00, 0x00, 0x0d, 0x00, 0x18, 0x00, 0x39, 0x00, 0x62, 0x00, 0x0c, 0x0a, 0x00, 0x00, 0x0d,
+    0x00, 0x24, 0x00, 0x0b, 0x00, 0x39, 0x00, 0x69, 0x00, 0x5e, 0x00, 0x4a, 0x00, 0x45, 0x00, 0x4f,
+    0x00, 0x56, 0x00, 0x53, 0x00, 0x3b, 0x00, 0x51, 0x00, 0x12, 0x00, 0x0a, 0x04, 0x00, 0x00, 0x4f,
+    0x00, 0x60, 0x00, 0x03, 0x00, 0x0a, 0x00, 0x52, 0x01, 0x61, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x0d,
+    0x00, 0x6b, 0x00, 0x47, 0xe3, 0x00, 0x00, 0x4f, 0x00, 0x6b, 0x02, 0x67, 0x00, 0x2e, 0x00, 0x11,
+    0x00, 0x06, 0x00, 0x32, 0x00, 0x6b, 0x01, 0x67, 0x00, 0x6b, 0x00, 0x37, 0x00, 0x4d, 0x00, 0x6b,
+    0x01, 0x67, 0x00, 0x68, 0x00, 0x15, 0x10, 0x00, 0x00, 0x06, 0x00, 0x44, 0x00, 0x64, 0x01, 0x06,
+    0x00, 0x4f, 0x00, 0x60, 0x00, 0x68, 0x00, 0x6c, 0x00, 0x68, 0x00, 0x51, 0x03, 0x00, 0x00, 0x06,
+    0x00, 0x0e, 0x00, 0x1f, 0x01, 0x32, 0x00, 0x0a, 0x00, 0x06, 0x00, 0x47, 0x00, 0x5e, 0x00, 0x3b,
+    0x00, 0x4a, 0x00, 0x4f, 0x00, 0x26, 0x00, 0x22, 0x00, 0x1a, 0x00, 0x51, 0x00, 0x5d, 0x00, 0x03,
+    0x00, 0x1a, 0x00, 0x64, 0x00, 0x1f, 0x00, 0x12, 0x00, 0x0a, 0x00, 0x1a, 0x00, 0x2d, 0x00, 0x3d,
+    0x00, 0x09, 0x00, 0x03, 0x00, 0x60, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x12, 0x00, 0x2a, 0x00, 0x11,
+    0x00, 0x06, 0x01, 0x00, 0x00, 0x43, 0x00, 0x68, 0x00, 0x11, 0xe2, 0x00, 0x00, 0x04, 0x00, 0x5d,
+    0x00, 0x6b, 0x01, 0x67, 0x00, 0x60, 0x00, 0x04, 0x01, 0x00, 0x00, 0x44, 0x00, 0x6b, 0x01, 0x67,
+    0x00, 0x68, 0x00, 0x2b, 0x00, 0x59, 0x00, 0x68, 0x01, 0x67, 0x00, 0x60, 0x00, 0x06, 0x0e, 0x00,
+    0x00, 0x1f, 0x00, 0x34, 0x00, 0x12, 0x00, 0x55, 0x00, 0x59, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x6e,
+    0x00, 0x4b, 0x00, 0x2d, 0x00, 0x1f, 0x00, 0x17, 0x00, 0x0a, 0x00, 0x27, 0x00, 0x3c, 0x00, 0x4e,
+    0x00, 0x56, 0x00, 0x63, 0x00, 0x6b, 0x00, 0x6c, 0x01, 0x68, 0x00, 0x60, 0x00, 0x59, 0x00, 0x5c,
+    0x00, 0x26, 0x00, 0x21, 0x00, 0x0d, 0x03, 0x00, 0x00, 0x55, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x31,
+    0x00, 0x64, 0x00, 0x03, 0x00, 0x0a, 0x00, 0x64, 0x02, 0x6c, 0x00, 0x0e, 0x00, 0x0a, 0x00, 0x6b,
+    0x00, 0x36, 0x01, 0x00, 0x00, 0x03, 0x00, 0x0e, 0x00, 0x1f, 0x00, 0x36, 0x00, 0x51, 0x00, 0x6b,
+    0x00, 0x68, 0x00, 0x15, 0xe2, 0x00, 0x00, 0x0e, 0x00, 0x64, 0x01, 0x67, 0x00, 0x6b, 0x00, 0x51,
+    0x02, 0x00, 0x00, 0x52, 0x00, 0x6b, 0x00, 0x67, 0x00, 0x66, 0x00, 0x64, 0x00, 0x26, 0x00, 0x63,
+    0x01, 0x67, 0x00, 0x6b, 0x00, 0x55, 0x02, 0x00, 0x01, 0x03, 0x07, 0x00, 0x00, 0x0a, 0x00, 0x2e,
+    0x00, 0x5b, 0x00, 0x4a, 0x00, 0x09, 0x00, 0x06, 0x00, 0x63, 0x00, 0x47, 0x00, 0x00, 0x00, 0x31,
+    0x00, 0x6c, 0x00, 0x48, 0x00, 0x4b, 0x00, 0x56, 0x00, 0x4f, 0x00, 0x25, 0x00, 0x6c, 0x00, 0x68,
+    0x00, 0x5c, 0x00, 0x4f, 0x00, 0x3d, 0x00, 0x2d, 0x00, 0x18, 0x00, 0x0d, 0x00, 0x0e, 0x00, 0x5f,
+    0x00, 0x68, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x15, 0x00, 0x29, 0x00, 0x3a, 0x00, 0x06,
+    0x00, 0x04, 0x00, 0x64, 0x00, 0x36, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x59, 0x00, 0x00, 0x00, 0x1f,
+    0x00, 0x6f, 0x00, 0x32, 0x00, 0x4f, 0x00, 0x60, 0x00, 0x02, 0x00, 0x1f, 0x00, 0x6e, 0x00, 0x1f,
+    0x00, 0x00, 0x00, 0x4d, 0x00, 0x64, 0x00, 0x68, 0x00, 0x64, 0x00, 0x5d, 0x00, 0x51, 0x00, 0x60,
+    0x00, 0x68, 0x00, 0x11, 0xe2, 0x00, 0x00, 0x1e, 0x00, 0x6b, 0x01, 0x67, 0x00, 0x6c, 0x00, 0x3e,
+    0x01, 0x00, 0x00, 0x0f, 0x00, 0x60, 0x01, 0x67, 0x00, 0x6b, 0x00, 0x55, 0x00, 0x26, 0x00, 0x6b,
+    0x01, 0x67, 0x00, 0x6b, 0x00, 0x48, 0x02, 0x00, 0x00, 0x0a, 0x00, 0x57, 0x00, 0x06, 0x04, 0x00,
+    0x00, 0x15, 0x00, 0x44, 0x00, 0x64, 0x00, 0x6c, 0x00, 0x36, 0x01, 0x00, 0x00, 0x12, 0x00, 0x6c,
+    0x00, 0x31, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x6c, 0x00, 0x64, 0x00, 0x59, 0x00, 0x68, 0x00, 0x47,
+    0x00, 0x36, 0x00, 0x6b, 0x00, 0x15, 0x06, 0x00, 0x00, 0x58, 0x00, 0x55, 0x00, 0x00, 0x00, 0x24,
+    0x00, 0x64, 0x01, 0x6c, 0x00, 0x63, 0x00, 0x03, 0x00, 0x11, 0x00, 0x6c, 0x00, 0x1f, 0x00, 0x00,
+    0x00, 0x59, 0x00, 0x47, 0x00, 0x00, 0x00, 0x36, 0x00, 0x6c, 0x00, 0x12, 0x01, 0x55, 0x00, 0x00,
+    0x00, 0x36, 0x00, 0x68, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x28, 0x00, 0x2d, 0x00, 0x15, 0x00, 0x09,
+    0x01, 0x00, 0x00, 0x5d, 0x00, 0x60, 0x00, 0x04, 0xe2, 0x00, 0x00, 0x31, 0x00, 0x6c, 0x01, 0x67,
+    0x00, 0x6b, 0x00, 0x4f, 0x00, 0x44, 0x00, 0x51, 0x00, 0x60, 0x02, 0x67, 0x00, 0x6c, 0x00, 0x2d,
+    0x00, 0x31, 0x00, 0x6c, 0x01, 0x67, 0x00, 0x6c, 0x00, 0x31, 0x01, 0x00, 0x00, 0x03, 0x00, 0x34,
+    0x00, 0x51, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x07, 0x00, 0x2d, 0x00, 0x52, 0x00, 0x68,
+    0x00, 0x6f, 0x00, 0x5d, 0x00, 0x19, 0x02, 0x00, 0x00, 0x24, 0x00, 0x6e, 0x00, 0x1f, 0x00, 0x00,
+    0x00, 0x15, 0x00, 0x11, 0x01, 0x04, 0x00, 0x60, 0x00, 0x32, 0x00, 0x47, 0x00, 0x60, 0x00, 0x02,
+    0x00, 0x06, 0x00, 0x36, 0x00, 0x47, 0x00, 0x55, 0x00, 0x56, 0x00, 0x03, 0x00, 0x06, 0x00, 0x63,
+    0x00, 0x44, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x5d, 0x00, 0x26, 0x00, 0x60, 0x00, 0x51, 0x00, 0x00,
+    0x00, 0x24, 0x00, 0x68, 0x00, 0x0a, 0x00, 0x06, 0x00, 0x64, 0x00, 0x31, 0x00, 0x00, 0x00, 0x4b,
+    0x00, 0x60, 0x00, 0x12, 0x00, 0x64, 0x00, 0x44, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x68, 0x00, 0x0e,
+    0x03, 0x00, 0x00, 0x0a, 0x00, 0x18, 0x00, 0x36, 0x00, 0x6b, 0x00, 0x51, 0xe3, 0x00, 0x00, 0x42,
+    0x00, 0x6b, 0x02, 0x67, 0x02, 0x6b, 0x00, 0x68, 0x01, 0x67, 0x00, 0x6b, 0x00, 0x51, 0x00, 0x00,
+    0x00, 0x47, 0x00, 0x6b, 0x01, 0x67, 0x00, 0x6b, 0x00, 0x2d, 0x00, 0x12, 0x00, 0x25, 0x00, 0x47,
+    0x00, 0x5a, 0x00, 0x3f, 0x00, 0x6e, 0x00, 0x55, 0x00, 0x3e, 0x00, 0x61, 0x00, 0x6c, 0x00, 0x6b,
+    0x00, 0x6c, 0x00, 0x4f, 0x00, 0x0a, 0x03, 0x00, 0x00, 0x39, 0x00, 0x68, 0x00, 0x0d, 0x01, 0x00,
+    0x00, 0x06, 0x00, 0x15, 0x00, 0x31, 0x00, 0x6b, 0x00, 0x25, 0x00, 0x58, 0x00, 0x51, 0x00, 0x00,
+    0x00, 0x24, 0x00, 0x6f, 0x00, 0x60, 0x00, 0x68, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x15, 0x00, 0x6c,
+    0x00, 0x2d, 0x00, 0x00, 0x00, 0x58, 0x00, 0x60, 0x00, 0x51, 0x00, 0x6c, 0x00, 0x44, 0x00, 0x00,
+    0x00, 0x3d, 0x00, 0x60, 0x00, 0x00, 0x00, 0x15, 0x00, 0x6c, 0x00, 0x18, 0x00, 0x00, 0x00, 0x59,
+    0x00, 0x51, 0x00, 0x16, 0x00, 0x6c, 0x00, 0x29, 0x00, 0x00, 0x00, 0x59, 0x00, 0x6b, 0x00, 0x55,
+    0x00, 0x39, 0x00, 0x44, 0x00, 0x55, 0x00, 0x60, 0x00, 0x68, 0x00, 0x6c, 0x00, 0x68, 0x00, 0x61,
+    0x00, 0x37, 0xe3, 0x00, 0x00, 0x50, 0x00, 0x6b, 0x07, 0x67, 0x00, 0x6c, 0x00, 0x55, 0x00, 0x09,
+    0x00, 0x00, 0x00, 0x56, 0x00, 0x6b, 0x02, 0x67, 0x00, 0x63, 0x00, 0x68, 0x00, 0x6b, 0x00, 0x6e,
+    0x00, 0x59, 0x00, 0x2f, 0x00, 0x68, 0x01, 0x6b, 0x00, 0x68, 0x00, 0x6b, 0x00, 0x68, 0x00, 0x3a,
+    0x05, 0x00, 0x00, 0x4f, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x11, 0x00, 0x59, 0x00, 0x68, 0x00, 0x6c,
+    0x00, 0x68, 0x00, 0x59, 0x00, 0x17, 0x00, 0x64, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x68,
+    0x00, 0x13, 0x00, 0x5c, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x6c, 0x00, 0x15, 0x00, 0x06,
+    0x00, 0x61, 0x00, 0x64, 0x00, 0x5d, 0x00, 0x52, 0x00, 0x18, 0x00, 0x00, 0x00, 0x51, 0x00, 0x4f,
+    0x00, 0x00, 0x00, 0x29, 0x00, 0x68, 0x00, 0x07, 0x00, 0x0a, 0x00, 0x68, 0x00, 0x3a, 0x00, 0x29,
+    0x00, 0x6c, 0x00, 0x56, 0x00, 0x5a, 0x00, 0x6b, 0x00, 0x68, 0x00, 0x6b, 0x00, 0x68, 0x00, 0x60,
+    0x00, 0x51, 0x00, 0x44, 0x00, 0x31, 0x00, 0x1f, 0x00, 0x0e, 0x00, 0x04, 0xe3, 0x00, 0x00, 0x02,
+    0x00, 0x58, 0x00, 0x6b, 0x02, 0x67, 0x01, 0x6b, 0x00, 0x6c, 0x00, 0x6b, 0x00, 0x61, 0x00, 0x3e,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x03, 0x00, 0x59, 0x00, 0x6b, 0x04, 0x67, 0x00, 0x6b, 0x00, 0x51,
+    0x00, 0x26, 0x00, 0x51, 0x00, 0x68, 0x01, 0x67, 0x00, 0x6b, 0x00, 0x61, 0x00, 0x24, 0x05, 0x00,
+    0x00, 0x03, 0x00, 0x5d, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x6e, 0x00, 0x3a, 0x00, 0x26,
+    0x01, 0x1a, 0x00, 0x32, 0x00, 0x6c, 0x00, 0x29, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x5c, 0x00, 0x12,
+    0x00, 0x68, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x44, 0x00, 0x68, 0x00, 0x09, 0x00, 0x00, 0x00, 0x11,
+    0x00, 0x0a, 0x02, 0x00, 0x00, 0x03, 0x00, 0x5d, 0x00, 0x47, 0x00, 0x1a, 0x00, 0x4f, 0x00, 0x68,
+    0x00, 0x51, 0x00, 0x5d, 0x00, 0x6f, 0x00, 0x29, 0x00, 0x3e, 0x00, 0x64, 0x00, 0x59, 0x00, 0x4f,
+    0x00, 0x3b, 0x00, 0x18, 0x00, 0x11, 0x00, 0x0a, 0x00, 0x03, 0xe9, 0x00, 0x00, 0x09, 0x00, 0x62,
+    0x00, 0x68, 0x01, 0x67, 0x00, 0x63, 0x00, 0x4f, 0x00, 0x3e, 0x00, 0x2d, 0x00, 0x1a, 0x00, 0x06,
+    0x03, 0x00, 0x00, 0x4d, 0x00, 0x6c, 0x02, 0x67, 0x00, 0x68, 0x00, 0x6b, 0x00, 0x44, 0x00, 0x2a,
+    0x00, 0x5d, 0x00, 0x6b, 0x01, 0x67, 0x00, 0x68, 0x00, 0x61, 0x00, 0x0f, 0x06, 0x00, 0x00, 0x0a,
+    0x00, 0x68, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x44, 0x00, 0x6c, 0x00, 0x4f, 0x00, 0x55, 0x00, 0x60,
+    0x00, 0x68, 0x00, 0x6b, 0x00, 0x68, 0x00, 0x12, 0x00, 0x00, 0x00, 0x5d, 0x00, 0x4b, 0x00, 0x1a,
+    0x00, 0x6f, 0x00, 0x24, 0x00, 0x00, 0x00, 0x51, 0x00, 0x64, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x04,
+    0x00, 0x0e, 0x00, 0x1f, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x64, 0x00, 0x6b, 0x00, 0x6c,
+    0x00, 0x68, 0x00, 0x5c, 0x00, 0x56, 0x00, 0x4c, 0x00, 0x36, 0x00, 0x09, 0x00, 0x0a, 0x00, 0x06,
+    0xf0, 0x00, 0x00, 0x14, 0x02, 0x67, 0x00, 0x6b, 0x00, 0x3b, 0x08, 0x00, 0x00, 0x12, 0x00, 0x61,
+    0x00, 0x6c, 0x00, 0x6b, 0x00, 0x6c, 0x00, 0x64, 0x00, 0x33, 0x00, 0x38, 0x00, 0x68, 0x02, 0x6b,
+    0x00, 0x64, 0x00, 0x6b, 0x00, 0x60, 0x00, 0x06, 0x06, 0x00, 0x00, 0x1a, 0x00, 0x6f, 0x00, 0x24,
+    0x00, 0x00, 0x00, 0x51, 0x00, 0x64, 0x00, 0x5c, 0x00, 0x4f, 0x00, 0x3d, 0x00, 0x29, 0x00, 0x52,
+    0x00, 0x63, 0x00, 0x03, 0x00, 0x0a, 0x00, 0x68, 0x00, 0x36, 0x00, 0x2d, 0x00, 0x6c, 0x00, 0x1f,
+    0x00, 0x15, 0x00, 0x5f, 0x00, 0x6b, 0x00, 0x5d, 0x00, 0x59, 0x00, 0x64, 0x00, 0x68, 0x00, 0x6e,
+    0x00, 0x59, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x6b, 0x00, 0x36, 0x00, 0x1f, 0x00, 0x0e, 0x00, 0x04,
+    0xf6, 0x00, 0x00, 0x23, 0x00, 0x6b, 0x01, 0x67, 0x00, 0x6b, 0x00, 0x1f, 0x09, 0x00, 0x00, 0x0e,
+    0x00, 0x3b, 0x00, 0x45, 0x00, 0x2d, 0x00, 0x21, 0x00, 0x4d, 0x01, 0x6c, 0x00, 0x68, 0x00, 0x51,
+    0x00, 0x29, 0x00, 0x12, 0x00, 0x55, 0x00, 0x6e, 0x00, 0x19, 0x06, 0x00, 0x00, 0x32, 0x00, 0x6c,
+    0x00, 0x12, 0x00, 0x00, 0x00, 0x11, 0x00, 0x06, 0x03, 0x00, 0x00, 0x55, 0x00, 0x5a, 0x00, 0x0d,
+    0x00, 0x32, 0x00, 0x6e, 0x00, 0x1f, 0x00, 0x47, 0x00, 0x6e, 0x00, 0x68, 0x00, 0x6c, 0x00, 0x68,
+    0x00, 0x58, 0x00, 0x51, 0x00, 0x47, 0x00, 0x3a, 0x00, 0x57, 0x00, 0x6e, 0x00, 0x31, 0x00, 0x00,
+    0x00, 0x3d, 0x00, 0x60, 0xfa, 0x00, 0x00, 0x35, 0x00, 0x6c, 0x01, 0x67, 0x00, 0x68, 0x00, 0x0e,
+    0x0c, 0x00, 0x00, 0x15, 0x00, 0x5e, 0x00, 0x6f, 0x00, 0x60, 0x00, 0x3e, 0x00, 0x12, 0x02, 0x00,
+    0x00, 0x0a, 0x00, 0x5e, 0x00, 0x36, 0x06, 0x00, 0x00, 0x4b, 0x00, 0x60, 0x00, 0x03, 0x01, 0x00,
+    0x00, 0x04, 0x00, 0x11, 0x00, 0x1f, 0x00, 0x36, 0x00, 0x47, 0x00, 0x67, 0x00, 0x6b, 0x00, 0x68,
+    0x00, 0x6c, 0x00, 0x64, 0x00, 0x12, 0x00, 0x44, 0x00, 0x49, 0x00, 0x36, 0x00, 0x24, 0x00, 0x15,
+    0x00, 0x26, 0x00, 0x32, 0x00, 0x44, 0x00, 0x55, 0x00, 0x6b, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x0a,
+    0x00, 0x68, 0x00, 0x3d, 0xfa, 0x00, 0x00, 0x46, 0x00, 0x6b, 0x00, 0x67, 0x00, 0x68, 0x00, 0x5d,
+    0x00, 0x04, 0x0b, 0x00, 0x00, 0x36, 0x00, 0x6a, 0x00, 0x56, 0x00, 0x2a, 0x00, 0x06, 0x05, 0x00,
+    0x00, 0x11, 0x00, 0x3b, 0x06, 0x00, 0x00, 0x5d, 0x00, 0x60, 0x00, 0x3a, 0x00, 0x4d, 0x00, 0x59,
+    0x00, 0x64, 0x00, 0x6b, 0x00, 0x6c, 0x00, 0x68, 0x00, 0x5d, 0x00, 0x51, 0x00, 0x44, 0x00, 0x31,
+    0x00, 0x1f, 0x00, 0x0e, 0x04, 0x00, 0x00, 0x0a, 0x00, 0x64, 0x00, 0x6e, 0x00, 0x68, 0x00, 0x5e,
+    0x00, 0x36, 0x00, 0x00, 0x00, 0x03, 0x00, 0x51, 0x00, 0x64, 0x00, 0x0a, 0xfa, 0x00, 0x00, 0x54,
+    0x00, 0x6e, 0x01, 0x6b, 0x00, 0x4f, 0x03, 0x04, 0x06, 0x00, 0x00, 0x0a, 0x00, 0x40, 0x00, 0x4a,
+    0x00, 0x15, 0x09, 0x00, 0x00, 0x07, 0x06, 0x00, 0x00, 0x65, 0x00, 0x68, 0x00, 0x64, 0x00, 0x5d,
+    0x00, 0x4f, 0x00, 0x3d, 0x00, 0x2a, 0x00, 0x18, 0x00, 0x0a, 0x00, 0x03, 0x09, 0x00, 0x00, 0x1f,
+    0x00, 0x6c, 0x00, 0x36, 0x00, 0x0a, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x56, 0x00, 0x6c, 0x00, 0x24,
+    0xfb, 0x00, 0x00, 0x1d, 0x00, 0x35, 0x00, 0x27, 0x00, 0x14, 0x00, 0x05, 0x09, 0x00, 0x00, 0x03,
+    0x00, 0x1b, 0x00, 0x0a, 0x13, 0x00, 0x00, 0x12, 0x00, 0x15, 0x00, 0x07, 0x10, 0x00, 0x00, 0x36,
+    0x00, 0x6c, 0x00, 0x15, 0x00, 0x0a, 0x00, 0x18, 0x00, 0x3e, 0x00, 0x68, 0x00, 0x64, 0x00, 0x28,
+    0xff, 0x00, 0x36, 0x00, 0x00, 0x4b, 0x00, 0x6e, 0x00, 0x63, 0x00, 0x68, 0x00, 0x6c, 0x00, 0x64,
+    0x00, 0x44, 0x00, 0x0d, 0xff, 0x00, 0x37, 0x00, 0x00, 0x53, 0x00, 0x52, 0x00, 0x44, 0x00, 0x32,
+    0x00, 0x18, 0x00, 0x06, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xb3, 0x00,
 #else
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0x8143,0x8184,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0x8143,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6881,0x9204,0xBB86,0x9204,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xAAE5,0x91E4,0x6882,0x6000,0x6000,0x6020,0x7922,0xAAC5,0xD447,0xCBE7,0x8142,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x70C2,0x8163,0x9204,0xA2A5,0xBB66,0xCC48,0xD468,0xAAE6,0x6881,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9204,0xDC87,0x89A3,0x6881,0x9204,0xBB86,0xDC67,0xE4A7,0xB305,0x6881,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x70E2,0xB326,0xD447,0xDC67,0xDC87,0xDC87,0xDC67,0xD446,0xD446,0xE487,0xB346,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x70E2,0xD447,0xD427,0xCC07,0xDC67,0xDC87,0xD447,0x9A24,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0x6881,0x7902,0x89C4,0x9A64,0xB306,0xA2A5,0x70C2,0x6000,0x6000,0x6000,0x8183,0xD427,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD467,0x7902,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0x70A1,0x70A1,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x89A3,0xD447,0xD467,0xD447,0xDC67,0xCBE7,0x8142,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6881,0x7902,0x89A3,0x9A64,0xB305,0xBB46,0x91E4,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0x7922,0x91E4,0xA285,0xB326,0xC3C7,0xCC27,0xD467,0xDC67,0xDC87,0xDC67,0xDC87,0xCC07,0x70E2,0x6000,0x7902,0xD427,0xDC67,0xD447,0xD447,0xDC67,0xDC67,0xDC67,0xD447,0xD447,0xD447,0xD447,0xDC67,0x8183,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6861,0x70E2,0x8183,0x9224,0xAAE5,0xBB66,0xCBE6,0xDC47,0xA2A4,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0xA264,0xD467,0xD447,0xD447,0xDC67,0xBB66,0x6861,0x6000,0x6000,0x6000,0x6040,0x70A1,0x70E2,0x6020,0x6000,0x91E3,0xC3A6,0xD447,0xDC87,0xDC87,0xD447,0xC3E7,0xCC06,0xE4A7,0xA285,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x7922,0xDC67,0xDC87,0xDC87,0xDC67,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC87,0xAAC5,0x6020,0xBB86,0xDC67,0xD447,0xD447,0xD467,0xC3E7,0xBB66,0xAAC5,0xCC07,0xDC67,0xDC87,0xDC87,0xDC87,0x78E2,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0xA2A5,0xD427,0xDC67,0xE4A7,0xE4A7,0xD467,0xCC07,0xBB86,0xD447,0x91E3,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x70A1,0xB346,0xDC87,0xDC67,0xD447,0xCC07,0xE487,0xAAC5,0x7902,0x9A24,0xAAC5,0xBB86,0xCC07,0xD467,0xDC87,0xBB66,0xAB05,0xE4A7,0xC3C6,0xA264,0x89A3,0x78E2,0x6861,0x6020,0x70A1,0xCC07,0xD468,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9204,0xDC87,0xD447,0xD447,0xD447,0xD447,0xD447,0xD467,0xD447,0xD447,0xD447,0xD447,0xDC67,0xB346,0x8183,0xD467,0xD447,0xD447,0xDC67,0xAB05,0x6041,0x6000,0x6000,0xB346,0xC3A7,0xAAE5,0x9A65,0x8183,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x7922,0xDC87,0xC3A6,0xA2A5,0x9204,0x8142,0x70A1,0x6020,0x6041,0xCC07,0x8142,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x8163,0xCC07,0xE487,0xCC07,0xB326,0xA285,0x9A85,0xC386,0xC3A6,0x9204,0xDC88,0xCC07,0xBB86,0xAAE5,0x9A24,0x9204,0xCC07,0xE487,0xAAE5,0x6020,0x6000,0x6841,0x78E2,0x8142,0x6000,0x6020,0xC3E7,0xCC27,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xA2C5,0xDC67,0xD447,0xD447,0xD447,0xDC67,0xD467,0xCC07,0xCC06,0xD447,0xD447,0xD447,0xDC67,0xAB05,0xA285,0xDC67,0xD447,0xD447,0xDC67,0x89C4,0x6000,0x6000,0x6000,0x6841,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9204,0xDC87,0x7922,0x6000,0x6000,0x6020,0x70C1,0x8142,0x9A64,0xD426,0x70A1,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x70C1,0x89A3,0x70C2,0xA264,0xDC67,0xCBE7,0xB326,0xAAE6,0xBB66,0xBB86,0xBB87,0xA285,0xBB66,0x7902,0x70A1,0x6020,0x6000,0x6000,0x6000,0x6000,0xB346,0xCC07,0x6040,0x70A1,0xBB86,0xCC27,0xCC27,0xB346,0x6020,0x70C1,0xDC67,0xAAE5,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xBB66,0xDC67,0xD447,0xD447,0xD447,0x9204,0x70E2,0x6881,0x9A24,0xDC67,0xD447,0xD447,0xDC67,0x9A65,0xB326,0xDC67,0xD447,0xD447,0xD467,0x7922,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6861,0xAAC5,0xD447,0x6881,0x6861,0xB346,0xCC07,0xD467,0xDC87,0xD467,0xBB66,0x6000,0x6000,0x6000,0x6000,0x6861,0x70C2,0x8163,0x9A24,0x9A24,0x70A1,0x6861,0xAAE5,0xCBE7,0xA285,0xB326,0xB326,0x89A4,0x81A4,0x8163,0xBB66,0xCBE7,0x6040,0x8143,0xD427,0x8183,0x7902,0x70A1,0x8163,0x9204,0xA285,0x6881,0x6020,0xCC07,0xB325,0x6000,0x7902,0x91E4,0x7902,0x6861,0x6000,0x6000,0xA2A5,0xD447,0x78E2,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6841,0xCBE7,0xDC67,0xD447,0xD447,0xCC07,0x6841,0x6000,0x6000,0xAAC5,0xDC67,0xD447,0xD447,0xD467,0x91E4,0xC3A6,0xD467,0xD447,0xD447,0xCC07,0x6881,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0x8163,0x9A45,0x7102,0xBB86,0xC3C6,0x6000,0x8163,0xE487,0xB305,0x9204,0x8183,0x7943,0x70A1,0x89A2,0xA284,0xBB45,0xC3A6,0xCC27,0xDC67,0xDC87,0xD467,0xD467,0xCC07,0xC3C6,0xCBE6,0x89A4,0x89A4,0x70C1,0x6000,0x6000,0x6000,0x6000,0xBB86,0xB325,0x6000,0x9A24,0xD447,0x6840,0x70A1,0xD427,0xDC87,0xDC87,0xDC87,0x70E2,0x70A1,0xDC67,0x9A44,0x6000,0x6000,0x6040,0x70E2,0x8983,0x9A44,0xBB66,0xDC67,0xD447,0x7922,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x70E2,0xD447,0xD447,0xD447,0xDC67,0xBB86,0x6000,0x6000,0x6000,0xBB86,0xDC67,0xD447,0xD446,0xD447,0x89A4,0xCC27,0xD447,0xD447,0xDC67,0xBB86,0x6020,0x6000,0x6000,0x6040,0x6040,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6881,0x9204,0xC3C7,0xAB06,0x6881,0x6861,0xCC27,0xAB05,0x6000,0x9A24,0xDC87,0xAB06,0xB305,0xC3A6,0xB346,0x89A3,0xDC87,0xD467,0xC3E6,0xBB46,0xA2A5,0x91E4,0x8142,0x70C1,0x70E2,0xCBE6,0xD447,0x70E2,0x6000,0x6881,0x7922,0x89C3,0x9A65,0x6861,0x6841,0xD427,0x9A44,0x6000,0xB305,0xC3A6,0x6000,0x8183,0xE4A7,0x9A24,0xB346,0xCC07,0x6020,0x8183,0xE487,0x8183,0x6000,0xB326,0xD447,0xD467,0xD447,0xCBE7,0xBB66,0xCC07,0xD447,0x70E2,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x8163,0xDC67,0xD447,0xD447,0xDC87,0xA2A5,0x6000,0x6000,0x70E2,0xCC07,0xD447,0xD447,0xDC67,0xC3A6,0x89C4,0xDC67,0xD447,0xD447,0xDC67,0xAB06,0x6000,0x6000,0x6000,0x68A1,0xC3C7,0x6861,0x6000,0x6000,0x6020,0x6000,0x6000,0x7922,0xAAC5,0xD427,0xDC87,0x9A44,0x6000,0x6000,0x78E2,0xDC87,0x9A24,0x6000,0xAB06,0xDC87,0xCC27,0xC3C6,0xD467,0xAAE5,0x9A44,0xDC67,0x7942,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xC3A6,0xBB86,0x6000,0x89A3,0xD447,0xDC87,0xDC87,0xCC27,0x6040,0x70E2,0xDC87,0x8163,0x6000,0xC3C6,0xAB05,0x6000,0x9A44,0xDC87,0x70E2,0xC3A6,0xBB86,0x6000,0x9A64,0xDC67,0x70C1,0x6000,0x89C3,0x9204,0x7922,0x6881,0x6000,0x6000,0xC3E7,0xCC07,0x6841,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9224,0xDC87,0xD447,0xD447,0xDC67,0xB346,0xAAE5,0xBB66,0xCC07,0xD447,0xD447,0xD447,0xDC87,0x91E4,0x9224,0xDC87,0xD447,0xD447,0xDC87,0x9224,0x6000,0x6000,0x6040,0x9A45,0xBB66,0xCBC6,0x6020,0x7924,0x6881,0x91E4,0xBB86,0xD467,0xE4A7,0xCBE7,0x8143,0x6000,0x6000,0x6000,0x89A3,0xE487,0x8163,0x6000,0x7922,0x70E2,0x6841,0x6861,0xCC07,0x9A44,0xAAE5,0xCC07,0x6020,0x6861,0x9A44,0xAAE5,0xBB86,0xBBA6,0x6840,0x6861,0xD427,0xAAE5,0x6000,0xB326,0xCBE7,0x89C4,0xCC07,0xBB66,0x6000,0x89A3,0xD467,0x70A1,0x6861,0xD447,0x9224,0x6000,0xB325,0xCC07,0x70E2,0xD447,0xA2C5,0x6000,0xB325,0xD467,0x70E2,0x6000,0x6000,0x6000,0x6020,0x70A1,0x8142,0x9A44,0xDC67,0xBB66,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xAAA4,0xDC67,0xD447,0xD447,0xD447,0xDC67,0xDC67,0xDC67,0xD467,0xD447,0xD447,0xDC67,0xBB66,0x6020,0xAB05,0xDC67,0xD447,0xD447,0xDC67,0x9204,0x78E2,0x89A3,0xAAE5,0xC3C7,0xA2C6,0xE487,0xBB86,0xA2A5,0xCC07,0xDC87,0xDC67,0xDC87,0xB346,0x6881,0x6000,0x6000,0x6000,0x6000,0xA284,0xDC67,0x70C1,0x6000,0x6000,0x6881,0x7922,0x9A24,0xDC67,0x89A3,0xC3A6,0xBB66,0x6000,0x89A3,0xE4A7,0xCC07,0xD447,0xCBE7,0x6020,0x7902,0xDC87,0x9204,0x6000,0xC3C6,0xCC07,0xBB66,0xDC87,0xAAC5,0x6000,0xA285,0xCC07,0x6020,0x7902,0xDC87,0x8142,0x6000,0xC3C6,0xBB46,0x7943,0xDC87,0x89C3,0x6020,0xC3C6,0xDC67,0xC3A6,0x9A64,0xAAE5,0xBB86,0xCC07,0xD467,0xDC87,0xD467,0xD407,0x9A65,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xBB45,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC87,0xBB86,0x6881,0x6000,0xBBA6,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC67,0xE487,0xC3C6,0x9225,0xD447,0xDC67,0xDC67,0xD467,0xDC67,0xD467,0xA265,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0xB346,0xCC07,0x6020,0x70E2,0xC3C6,0xD447,0xDC87,0xD467,0xC3C6,0x7943,0xD447,0xA2A5,0x6000,0xA285,0xD467,0x7903,0xC3C6,0xB346,0x6000,0x91E4,0xDC87,0x7922,0x6861,0xCC27,0xD427,0xCBE7,0xBB66,0x8142,0x6000,0xBB66,0xB346,0x6000,0x91E3,0xD447,0x6881,0x6881,0xD447,0xA285,0x89E3,0xDC87,0xBB86,0xC3C7,0xDC67,0xD467,0xDC67,0xD467,0xCC07,0xBB66,0xAAC5,0x9224,0x8163,0x70C2,0x6861,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0xC3C6,0xDC67,0xD447,0xD447,0xD447,0xDC67,0xDC67,0xDC87,0xDC67,0xCC27,0xA2A5,0x6861,0x6000,0x6040,0xC3C6,0xDC67,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC67,0xBB86,0x89C4,0xBB66,0xD467,0xD447,0xD447,0xDC67,0xCC07,0x8983,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0xCBE7,0xB346,0x6000,0x91E4,0xE487,0xA285,0x89C4,0x8163,0x8143,0x9A44,0xDC87,0x89C3,0x6000,0xBB46,0xC3E6,0x70E2,0xD467,0xA285,0x6000,0xA2C5,0xD447,0x6881,0x6000,0x70E2,0x6881,0x6000,0x6000,0x6000,0x6040,0xCBE7,0xAAE5,0x8143,0xB346,0xD447,0xBB66,0xCBE7,0xE4A7,0x89C3,0xA2A5,0xD427,0xC3C6,0xB346,0xA285,0x8142,0x7902,0x70A1,0x6040,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x7081,0xCC06,0xD467,0xD447,0xD447,0xCC27,0xBB66,0xA2A5,0x9204,0x8163,0x6881,0x6000,0x6000,0x6000,0x6000,0xB326,0xDC87,0xD447,0xD447,0xD447,0xD467,0xDC67,0xAAE5,0x91E4,0xCBE7,0xDC67,0xD447,0xD447,0xD467,0xCC07,0x70E2,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x70A1,0xD467,0xA285,0x6000,0xA2C5,0xDC87,0xB346,0xBB86,0xCC07,0xD467,0xDC67,0xD467,0x7902,0x6020,0xCC07,0xB325,0x8163,0xE4A7,0x8983,0x6000,0xBB66,0xD447,0x70C2,0x6000,0x6041,0x70E2,0x8163,0x9204,0x6020,0x70A1,0xD447,0xDC67,0xDC87,0xD467,0xCBE6,0xC3A6,0xB305,0x9A44,0x6881,0x70A1,0x6881,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x7901,0xD447,0xD447,0xD447,0xDC67,0xA285,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x7902,0xCC27,0xDC87,0xDC67,0xDC87,0xD427,0x9A45,0x9A65,0xD447,0xDC67,0xDC67,0xDC67,0xD447,0xDC67,0xCC07,0x6861,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x8163,0xE4A7,0x89A3,0x6000,0xBB66,0xD447,0xC3C6,0xB346,0xA2A5,0x91E3,0xBB66,0xCC27,0x6040,0x68A1,0xD467,0x9A44,0x9204,0xDC87,0x8163,0x7922,0xCC06,0xDC67,0xCBE7,0xC3A6,0xCC27,0xD447,0xE487,0xC3C6,0x6000,0x8163,0xDC67,0x9A64,0x8183,0x70C2,0x6861,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x8982,0xDC67,0xD447,0xD447,0xDC67,0x8983,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x70C2,0xA285,0xAAE6,0x9204,0x81A4,0xB326,0xDC87,0xDC87,0xD447,0xBB66,0x89C3,0x70E2,0xC3A6,0xE487,0x8143,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A24,0xDC87,0x78E2,0x6000,0x70E2,0x6881,0x6000,0x6000,0x6000,0x6000,0xBB86,0xC3C7,0x70C1,0x9224,0xE487,0x8983,0xAAE5,0xE487,0xD467,0xDC87,0xD447,0xC3C6,0xBB66,0xAAE5,0x9A65,0xC3A7,0xE487,0x9204,0x6000,0xA2A5,0xCC07,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A23,0xDC87,0xD447,0xD447,0xD447,0x70E2,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x7922,0xCBE7,0xE4A7,0xCC07,0xA2A5,0x7902,0x6000,0x6000,0x6000,0x70A1,0xCBE7,0x9A44,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xB305,0xCC27,0x6020,0x6000,0x6000,0x6841,0x78E2,0x8983,0x9A44,0xB305,0xD447,0xDC67,0xD467,0xDC87,0xD447,0x70E2,0xAAC5,0xB305,0x9A44,0x89A3,0x7902,0x89C4,0x9A44,0xAAC5,0xBB86,0xDC67,0xB305,0x6020,0x70A1,0xD447,0xA285,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xAAC4,0xDC67,0xD447,0xD467,0xCBE7,0x6841,0x6000,0x6000,0x6000,0x6000,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0x9A44,0xD468,0xBB86,0x89C4,0x6861,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x70E2,0xA2A5,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xC3E7,0xCC07,0xA265,0xB326,0xC3A6,0xCC27,0xDC67,0xDC87,0xD447,0xCBE7,0xBB66,0xAAC5,0x9204,0x8163,0x70C2,0x6000,0x6000,0x6000,0x6000,0x6000,0x70A1,0xD447,0xE487,0xD467,0xCBE7,0x9A44,0x6020,0x6040,0xBB66,0xD427,0x70A1,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xBB85,0xE487,0xDC67,0xDC67,0xB346,0x6041,0x6041,0x6041,0x6041,0x6020,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x70A1,0xA2C6,0xAAE6,0x7922,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6881,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xD448,0xD467,0xD447,0xC3C7,0xB346,0xA285,0x91E4,0x8142,0x70A1,0x6040,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x8183,0xDC87,0x9A44,0x70A1,0x6020,0x6000,0x70C1,0xBB86,0xDC87,0x89A3,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x8162,0x9A23,0x89A2,0x78E1,0x6860,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6040,0x8184,0x70A1,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x7902,0x7902,0x6881,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A44,0xDC67,0x7922,0x70A1,0x8142,0xA2A5,0xD447,0xD447,0x89C3,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xB305,0xE487,0xCC27,0xD467,0xDC87,0xCC27,0xAAC5,0x70C1,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0xBB87,0xBB66,0xAAC5,0x9A24,0x8142,0x6861,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
+    0x40, 0x01, 0x20, 0x00, 0x6c, 0x00, 0x00, 0x60, 0x20, 0x60, 0x40, 0x60, 0x41, 0x60, 0x40, 0x68,
+    0x41, 0x68, 0x60, 0x68, 0x61, 0x68, 0x81, 0x68, 0x82, 0x68, 0xa1, 0x68, 0x81, 0x70, 0xa1, 0x70,
+    0xc1, 0x70, 0xc2, 0x70, 0xe2, 0x70, 0x02, 0x71, 0xe1, 0x78, 0xe2, 0x78, 0x01, 0x79, 0x02, 0x79,
+    0x03, 0x79, 0x22, 0x79, 0x24, 0x79, 0x42, 0x79, 0x43, 0x79, 0x42, 0x81, 0x43, 0x81, 0x62, 0x81,
+    0x63, 0x81, 0x83, 0x81, 0x84, 0x81, 0xa4, 0x81, 0x82, 0x89, 0x83, 0x89, 0xa2, 0x89, 0xa3, 0x89,
+    0xa4, 0x89, 0xc3, 0x89, 0xc4, 0x89, 0xe3, 0x89, 0xe3, 0x91, 0xe4, 0x91, 0x04, 0x92, 0x24, 0x92,
+    0x25, 0x92, 0x23, 0x9a, 0x24, 0x9a, 0x44, 0x9a, 0x45, 0x9a, 0x64, 0x9a, 0x65, 0x9a, 0x85, 0x9a,
+    0x64, 0xa2, 0x65, 0xa2, 0x84, 0xa2, 0x85, 0xa2, 0xa4, 0xa2, 0xa5, 0xa2, 0xc5, 0xa2, 0xc6, 0xa2,
+    0xa4, 0xaa, 0xc4, 0xaa, 0xc5, 0xaa, 0xe5, 0xaa, 0xe6, 0xaa, 0x05, 0xab, 0x06, 0xab, 0x05, 0xb3,
+    0x06, 0xb3, 0x25, 0xb3, 0x26, 0xb3, 0x46, 0xb3, 0x45, 0xbb, 0x46, 0xbb, 0x66, 0xbb, 0x85, 0xbb,
+    0x86, 0xbb, 0x87, 0xbb, 0xa6, 0xbb, 0x86, 0xc3, 0xa6, 0xc3, 0xa7, 0xc3, 0xc6, 0xc3, 0xc7, 0xc3,
+    0xe6, 0xc3, 0xe7, 0xc3, 0xc6, 0xcb, 0xe6, 0xcb, 0xe7, 0xcb, 0x06, 0xcc, 0x07, 0xcc, 0x27, 0xcc,
+    0x48, 0xcc, 0x07, 0xd4, 0x26, 0xd4, 0x27, 0xd4, 0x46, 0xd4, 0x47, 0xd4, 0x48, 0xd4, 0x67, 0xd4,
+    0x68, 0xd4, 0x47, 0xdc, 0x67, 0xdc, 0x87, 0xdc, 0x88, 0xdc, 0x87, 0xe4, 0xa7, 0xe4, 0xff, 0x00,
+    0xff, 0x00, 0xdb, 0x00, 0x00, 0x01, 0x00, 0x1b, 0x00, 0x1f, 0x00, 0x01, 0xff, 0x00, 0x30, 0x00,
+    0x00, 0x01, 0x00, 0x1b, 0x06, 0x00, 0x00, 0x08, 0x00, 0x2b, 0x00, 0x4d, 0x00, 0x2b, 0x00, 0x01,
+    0xff, 0x00, 0x32, 0x00, 0x00, 0x40, 0x00, 0x2a, 0x00, 0x09, 0x01, 0x00, 0x00, 0x01, 0x00, 0x16,
+    0x00, 0x3f, 0x00, 0x62, 0x00, 0x59, 0x00, 0x1a, 0xff, 0x00, 0x03, 0x00, 0x00, 0x0e, 0x00, 0x1d,
+    0x00, 0x2b, 0x00, 0x3a, 0x00, 0x4b, 0x00, 0x5d, 0x00, 0x65, 0x00, 0x41, 0x00, 0x08, 0x27, 0x00,
+    0x00, 0x2b, 0x00, 0x68, 0x00, 0x24, 0x00, 0x08, 0x00, 0x2b, 0x00, 0x4d, 0x00, 0x67, 0x00, 0x6b,
+    0x00, 0x44, 0x00, 0x08, 0xff, 0x00, 0x02, 0x00, 0x00, 0x0f, 0x00, 0x47, 0x00, 0x62, 0x00, 0x67,
+    0x01, 0x68, 0x00, 0x67, 0x01, 0x61, 0x00, 0x6a, 0x00, 0x48, 0x00, 0x01, 0x26, 0x00, 0x00, 0x0f,
+    0x00, 0x62, 0x00, 0x60, 0x00, 0x5b, 0x00, 0x67, 0x00, 0x68, 0x00, 0x62, 0x00, 0x2f, 0xf8, 0x00,
+    0x00, 0x01, 0x00, 0x08, 0x00, 0x14, 0x00, 0x27, 0x00, 0x32, 0x00, 0x45, 0x00, 0x3a, 0x00, 0x0e,
+    0x02, 0x00, 0x00, 0x1e, 0x00, 0x60, 0x00, 0x68, 0x07, 0x62, 0x00, 0x64, 0x00, 0x14, 0x10, 0x00,
+    0x00, 0x01, 0x01, 0x0c, 0x12, 0x00, 0x00, 0x24, 0x00, 0x62, 0x00, 0x64, 0x00, 0x62, 0x00, 0x67,
+    0x00, 0x59, 0x00, 0x1a, 0x08, 0x00, 0x00, 0x08, 0x00, 0x14, 0x00, 0x24, 0x00, 0x32, 0x00, 0x44,
+    0x00, 0x4a, 0x00, 0x2a, 0x00, 0x01, 0xe3, 0x00, 0x00, 0x01, 0x00, 0x16, 0x00, 0x2a, 0x00, 0x38,
+    0x00, 0x47, 0x00, 0x54, 0x00, 0x5c, 0x00, 0x64, 0x00, 0x67, 0x00, 0x68, 0x00, 0x67, 0x00, 0x68,
+    0x00, 0x5b, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x14, 0x00, 0x60, 0x00, 0x67, 0x01, 0x62, 0x02, 0x67,
+    0x03, 0x62, 0x00, 0x67, 0x00, 0x1e, 0x0a, 0x00, 0x00, 0x07, 0x00, 0x0f, 0x00, 0x1e, 0x00, 0x2c,
+    0x00, 0x40, 0x00, 0x4b, 0x00, 0x58, 0x00, 0x66, 0x00, 0x39, 0x10, 0x00, 0x00, 0x01, 0x00, 0x35,
+    0x00, 0x64, 0x01, 0x62, 0x00, 0x67, 0x00, 0x4b, 0x00, 0x07, 0x02, 0x00, 0x00, 0x02, 0x00, 0x0c,
+    0x00, 0x0f, 0x00, 0x01, 0x00, 0x00, 0x00, 0x29, 0x00, 0x51, 0x00, 0x62, 0x01, 0x68, 0x00, 0x62,
+    0x00, 0x56, 0x00, 0x5a, 0x00, 0x6b, 0x00, 0x38, 0xe3, 0x00, 0x00, 0x16, 0x00, 0x67, 0x01, 0x68,
+    0x01, 0x67, 0x05, 0x62, 0x00, 0x68, 0x00, 0x3f, 0x00, 0x01, 0x00, 0x4d, 0x00, 0x67, 0x01, 0x62,
+    0x00, 0x64, 0x00, 0x56, 0x00, 0x4b, 0x00, 0x3f, 0x00, 0x5b, 0x00, 0x67, 0x02, 0x68, 0x00, 0x12,
+    0x08, 0x00, 0x00, 0x01, 0x00, 0x3a, 0x00, 0x60, 0x00, 0x67, 0x01, 0x6b, 0x00, 0x64, 0x00, 0x5b,
+    0x00, 0x4d, 0x00, 0x62, 0x00, 0x29, 0x0f, 0x00, 0x00, 0x0c, 0x00, 0x48, 0x00, 0x68, 0x00, 0x67,
+    0x00, 0x62, 0x00, 0x5b, 0x00, 0x6a, 0x00, 0x3f, 0x00, 0x14, 0x00, 0x2f, 0x00, 0x3f, 0x00, 0x4d,
+    0x00, 0x5b, 0x00, 0x64, 0x00, 0x68, 0x00, 0x4b, 0x00, 0x42, 0x00, 0x6b, 0x00, 0x53, 0x00, 0x35,
+    0x00, 0x24, 0x00, 0x12, 0x00, 0x07, 0x00, 0x01, 0x00, 0x0c, 0x00, 0x5b, 0x00, 0x65, 0xe3, 0x00,
+    0x00, 0x2b, 0x00, 0x68, 0x04, 0x62, 0x00, 0x64, 0x03, 0x62, 0x00, 0x67, 0x00, 0x48, 0x00, 0x1e,
+    0x00, 0x64, 0x01, 0x62, 0x00, 0x67, 0x00, 0x42, 0x00, 0x03, 0x01, 0x00, 0x00, 0x48, 0x00, 0x52,
+    0x00, 0x40, 0x00, 0x33, 0x00, 0x1e, 0x00, 0x01, 0x08, 0x00, 0x00, 0x16, 0x00, 0x68, 0x00, 0x51,
+    0x00, 0x3a, 0x00, 0x2b, 0x00, 0x1a, 0x00, 0x0c, 0x00, 0x01, 0x00, 0x03, 0x00, 0x5b, 0x00, 0x1a,
+    0x0e, 0x00, 0x00, 0x1d, 0x00, 0x5b, 0x00, 0x6a, 0x00, 0x5b, 0x00, 0x47, 0x00, 0x38, 0x00, 0x34,
+    0x00, 0x50, 0x00, 0x51, 0x00, 0x2b, 0x00, 0x69, 0x00, 0x5b, 0x00, 0x4d, 0x00, 0x40, 0x00, 0x2f,
+    0x00, 0x2b, 0x00, 0x5b, 0x00, 0x6a, 0x00, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x12,
+    0x00, 0x1a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x56, 0x00, 0x5c, 0xe3, 0x00, 0x00, 0x3b, 0x00, 0x67,
+    0x02, 0x62, 0x00, 0x67, 0x00, 0x64, 0x00, 0x5b, 0x00, 0x5a, 0x02, 0x62, 0x00, 0x67, 0x00, 0x42,
+    0x00, 0x38, 0x00, 0x67, 0x01, 0x62, 0x00, 0x67, 0x00, 0x27, 0x02, 0x00, 0x00, 0x05, 0x0d, 0x00,
+    0x00, 0x2b, 0x00, 0x68, 0x00, 0x16, 0x01, 0x00, 0x00, 0x01, 0x00, 0x0d, 0x00, 0x1a, 0x00, 0x32,
+    0x00, 0x5f, 0x00, 0x0c, 0x0a, 0x00, 0x00, 0x0d, 0x00, 0x24, 0x00, 0x0e, 0x00, 0x35, 0x00, 0x67,
+    0x00, 0x59, 0x00, 0x47, 0x00, 0x41, 0x00, 0x4b, 0x00, 0x4d, 0x00, 0x4e, 0x00, 0x38, 0x00, 0x4b,
+    0x00, 0x14, 0x00, 0x0c, 0x00, 0x01, 0x03, 0x00, 0x00, 0x48, 0x00, 0x5b, 0x00, 0x02, 0x00, 0x0c,
+    0x00, 0x4d, 0x01, 0x5c, 0x00, 0x48, 0x00, 0x01, 0x00, 0x0d, 0x00, 0x67, 0x00, 0x40, 0xe3, 0x00,
+    0x00, 0x4b, 0x00, 0x67, 0x02, 0x62, 0x00, 0x2b, 0x00, 0x0f, 0x00, 0x08, 0x00, 0x2f, 0x00, 0x67,
+    0x01, 0x62, 0x00, 0x67, 0x00, 0x33, 0x00, 0x47, 0x00, 0x67, 0x01, 0x62, 0x00, 0x64, 0x00, 0x16,
+    0x10, 0x00, 0x00, 0x07, 0x00, 0x3f, 0x00, 0x62, 0x00, 0x08, 0x00, 0x07, 0x00, 0x48, 0x00, 0x5b,
+    0x00, 0x64, 0x00, 0x68, 0x00, 0x64, 0x00, 0x4b, 0x03, 0x00, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x1d,
+    0x01, 0x2f, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x40, 0x00, 0x59, 0x00, 0x38, 0x01, 0x47, 0x00, 0x25,
+    0x00, 0x20, 0x00, 0x1d, 0x00, 0x4b, 0x00, 0x59, 0x00, 0x02, 0x00, 0x1b, 0x00, 0x60, 0x00, 0x1e,
+    0x00, 0x14, 0x00, 0x0c, 0x00, 0x1d, 0x00, 0x2b, 0x00, 0x38, 0x00, 0x08, 0x00, 0x01, 0x00, 0x5b,
+    0x00, 0x46, 0x00, 0x00, 0x00, 0x14, 0x00, 0x2a, 0x00, 0x14, 0x00, 0x07, 0x01, 0x00, 0x00, 0x3a,
+    0x00, 0x62, 0x00, 0x12, 0xe2, 0x00, 0x00, 0x05, 0x00, 0x59, 0x00, 0x67, 0x01, 0x62, 0x00, 0x5b,
+    0x00, 0x05, 0x01, 0x00, 0x00, 0x3f, 0x00, 0x67, 0x01, 0x62, 0x00, 0x64, 0x00, 0x2a, 0x00, 0x51,
+    0x00, 0x64, 0x01, 0x62, 0x00, 0x5b, 0x00, 0x08, 0x0d, 0x00, 0x00, 0x01, 0x00, 0x1d, 0x00, 0x31,
+    0x00, 0x10, 0x00, 0x4d, 0x00, 0x53, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x6a, 0x00, 0x44, 0x00, 0x2b,
+    0x00, 0x1e, 0x00, 0x19, 0x00, 0x0c, 0x00, 0x23, 0x00, 0x37, 0x00, 0x49, 0x00, 0x51, 0x00, 0x5c,
+    0x00, 0x67, 0x00, 0x68, 0x01, 0x64, 0x00, 0x5b, 0x00, 0x53, 0x00, 0x58, 0x01, 0x25, 0x00, 0x0d,
+    0x03, 0x00, 0x00, 0x4d, 0x00, 0x46, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x62, 0x00, 0x04, 0x00, 0x0c,
+    0x00, 0x60, 0x02, 0x68, 0x00, 0x0f, 0x00, 0x0c, 0x00, 0x67, 0x00, 0x30, 0x01, 0x00, 0x00, 0x02,
+    0x00, 0x0f, 0x00, 0x22, 0x00, 0x30, 0x00, 0x4b, 0x00, 0x67, 0x00, 0x62, 0x00, 0x16, 0xe2, 0x00,
+    0x00, 0x0f, 0x02, 0x62, 0x00, 0x67, 0x00, 0x4d, 0x02, 0x00, 0x00, 0x4d, 0x00, 0x67, 0x00, 0x62,
+    0x00, 0x61, 0x00, 0x62, 0x00, 0x25, 0x00, 0x5c, 0x01, 0x62, 0x00, 0x67, 0x00, 0x4d, 0x00, 0x01,
+    0x01, 0x00, 0x01, 0x02, 0x07, 0x00, 0x00, 0x08, 0x00, 0x2b, 0x00, 0x54, 0x00, 0x43, 0x00, 0x08,
+    0x00, 0x07, 0x00, 0x5c, 0x00, 0x42, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x68, 0x00, 0x43, 0x00, 0x44,
+    0x00, 0x51, 0x00, 0x48, 0x00, 0x24, 0x00, 0x68, 0x00, 0x64, 0x00, 0x55, 0x00, 0x4a, 0x00, 0x3a,
+    0x00, 0x2a, 0x00, 0x1a, 0x00, 0x0d, 0x00, 0x0f, 0x00, 0x58, 0x00, 0x62, 0x00, 0x0f, 0x00, 0x00,
+    0x00, 0x08, 0x00, 0x16, 0x00, 0x26, 0x00, 0x33, 0x00, 0x07, 0x00, 0x05, 0x00, 0x60, 0x00, 0x30,
+    0x00, 0x00, 0x00, 0x44, 0x00, 0x51, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x6b, 0x00, 0x2f, 0x00, 0x48,
+    0x00, 0x5b, 0x00, 0x01, 0x00, 0x1e, 0x00, 0x6a, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x47, 0x00, 0x62,
+    0x00, 0x64, 0x00, 0x62, 0x00, 0x59, 0x00, 0x4b, 0x00, 0x5b, 0x00, 0x62, 0x00, 0x0f, 0xe2, 0x00,
+    0x00, 0x1d, 0x00, 0x67, 0x01, 0x62, 0x00, 0x68, 0x00, 0x3a, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x5b,
+    0x01, 0x62, 0x00, 0x67, 0x00, 0x51, 0x00, 0x27, 0x00, 0x67, 0x01, 0x62, 0x00, 0x67, 0x00, 0x43,
+    0x02, 0x00, 0x00, 0x0a, 0x00, 0x54, 0x00, 0x07, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x16,
+    0x00, 0x3f, 0x00, 0x60, 0x00, 0x68, 0x00, 0x30, 0x01, 0x00, 0x00, 0x12, 0x00, 0x68, 0x00, 0x2f,
+    0x00, 0x00, 0x00, 0x43, 0x00, 0x68, 0x00, 0x5c, 0x00, 0x53, 0x00, 0x64, 0x00, 0x40, 0x00, 0x30,
+    0x00, 0x67, 0x00, 0x18, 0x00, 0x01, 0x05, 0x00, 0x00, 0x51, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x24,
+    0x00, 0x62, 0x01, 0x68, 0x00, 0x5c, 0x00, 0x02, 0x00, 0x0f, 0x00, 0x68, 0x00, 0x1d, 0x00, 0x00,
+    0x00, 0x53, 0x00, 0x42, 0x00, 0x00, 0x00, 0x30, 0x00, 0x68, 0x00, 0x0f, 0x00, 0x51, 0x00, 0x4d,
+    0x00, 0x00, 0x00, 0x32, 0x00, 0x67, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x26, 0x00, 0x2b, 0x00, 0x16,
+    0x00, 0x08, 0x01, 0x00, 0x00, 0x56, 0x00, 0x5b, 0x00, 0x05, 0xe2, 0x00, 0x00, 0x2c, 0x00, 0x68,
+    0x01, 0x62, 0x00, 0x67, 0x00, 0x48, 0x00, 0x40, 0x00, 0x4b, 0x00, 0x5b, 0x02, 0x62, 0x00, 0x68,
+    0x00, 0x2a, 0x00, 0x2c, 0x00, 0x68, 0x01, 0x62, 0x00, 0x68, 0x00, 0x2c, 0x01, 0x00, 0x00, 0x02,
+    0x00, 0x31, 0x00, 0x4b, 0x00, 0x57, 0x00, 0x01, 0x00, 0x17, 0x00, 0x08, 0x00, 0x2a, 0x00, 0x4d,
+    0x00, 0x64, 0x00, 0x6b, 0x00, 0x59, 0x00, 0x1b, 0x02, 0x00, 0x00, 0x24, 0x00, 0x6a, 0x00, 0x1d,
+    0x00, 0x00, 0x00, 0x16, 0x00, 0x0f, 0x00, 0x05, 0x00, 0x07, 0x00, 0x5b, 0x00, 0x30, 0x00, 0x40,
+    0x00, 0x5b, 0x00, 0x01, 0x00, 0x07, 0x00, 0x30, 0x00, 0x40, 0x00, 0x4d, 0x00, 0x4f, 0x00, 0x04,
+    0x00, 0x07, 0x00, 0x60, 0x00, 0x40, 0x00, 0x00, 0x00, 0x47, 0x00, 0x59, 0x00, 0x27, 0x00, 0x5b,
+    0x00, 0x4b, 0x00, 0x00, 0x00, 0x24, 0x00, 0x64, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x62, 0x00, 0x2c,
+    0x00, 0x00, 0x00, 0x46, 0x00, 0x5b, 0x00, 0x0f, 0x00, 0x62, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x46,
+    0x00, 0x64, 0x00, 0x0f, 0x02, 0x00, 0x00, 0x01, 0x00, 0x0c, 0x00, 0x1a, 0x00, 0x30, 0x00, 0x67,
+    0x00, 0x4b, 0xe3, 0x00, 0x00, 0x3d, 0x00, 0x67, 0x02, 0x62, 0x02, 0x67, 0x00, 0x64, 0x01, 0x62,
+    0x00, 0x67, 0x00, 0x4b, 0x00, 0x01, 0x00, 0x42, 0x00, 0x67, 0x01, 0x62, 0x00, 0x67, 0x00, 0x2b,
+    0x00, 0x12, 0x00, 0x24, 0x00, 0x40, 0x00, 0x54, 0x00, 0x3c, 0x00, 0x6a, 0x00, 0x4d, 0x00, 0x3a,
+    0x00, 0x5b, 0x00, 0x68, 0x00, 0x67, 0x00, 0x68, 0x00, 0x48, 0x00, 0x08, 0x03, 0x00, 0x00, 0x37,
+    0x00, 0x67, 0x00, 0x0d, 0x01, 0x00, 0x00, 0x08, 0x00, 0x16, 0x00, 0x2f, 0x00, 0x67, 0x00, 0x24,
+    0x00, 0x51, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x24, 0x00, 0x6b, 0x00, 0x5b, 0x00, 0x62, 0x00, 0x59,
+    0x00, 0x01, 0x00, 0x14, 0x00, 0x68, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x53, 0x00, 0x5b, 0x00, 0x4b,
+    0x00, 0x68, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x38, 0x00, 0x5b, 0x00, 0x01, 0x00, 0x14, 0x00, 0x68,
+    0x00, 0x1a, 0x00, 0x00, 0x00, 0x53, 0x00, 0x4a, 0x00, 0x19, 0x00, 0x68, 0x00, 0x26, 0x00, 0x01,
+    0x00, 0x53, 0x00, 0x67, 0x00, 0x51, 0x00, 0x32, 0x00, 0x40, 0x00, 0x4d, 0x00, 0x5b, 0x00, 0x64,
+    0x00, 0x68, 0x00, 0x64, 0x00, 0x5e, 0x00, 0x33, 0xe3, 0x00, 0x00, 0x49, 0x00, 0x67, 0x07, 0x62,
+    0x00, 0x68, 0x00, 0x4d, 0x00, 0x08, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x67, 0x04, 0x62, 0x00, 0x67,
+    0x00, 0x6a, 0x00, 0x53, 0x00, 0x2d, 0x00, 0x62, 0x01, 0x67, 0x00, 0x64, 0x00, 0x67, 0x00, 0x64,
+    0x00, 0x36, 0x00, 0x01, 0x04, 0x00, 0x00, 0x48, 0x00, 0x5b, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x53,
+    0x00, 0x62, 0x00, 0x68, 0x00, 0x64, 0x00, 0x53, 0x00, 0x19, 0x00, 0x62, 0x00, 0x3a, 0x00, 0x00,
+    0x00, 0x38, 0x00, 0x64, 0x00, 0x15, 0x00, 0x53, 0x00, 0x48, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x68,
+    0x00, 0x16, 0x00, 0x07, 0x00, 0x5c, 0x00, 0x60, 0x00, 0x59, 0x00, 0x4b, 0x00, 0x1a, 0x00, 0x00,
+    0x00, 0x4b, 0x00, 0x48, 0x00, 0x00, 0x00, 0x29, 0x00, 0x62, 0x01, 0x08, 0x00, 0x62, 0x00, 0x38,
+    0x00, 0x28, 0x00, 0x68, 0x00, 0x4d, 0x00, 0x54, 0x00, 0x67, 0x00, 0x64, 0x00, 0x67, 0x00, 0x64,
+    0x00, 0x5b, 0x00, 0x4b, 0x00, 0x3f, 0x00, 0x2c, 0x00, 0x1d, 0x00, 0x0e, 0x00, 0x07, 0xe3, 0x00,
+    0x00, 0x01, 0x00, 0x53, 0x00, 0x67, 0x02, 0x62, 0x01, 0x67, 0x00, 0x68, 0x00, 0x67, 0x00, 0x5c,
+    0x00, 0x3a, 0x00, 0x07, 0x00, 0x00, 0x00, 0x02, 0x00, 0x53, 0x00, 0x67, 0x04, 0x62, 0x00, 0x67,
+    0x00, 0x4d, 0x00, 0x27, 0x00, 0x4b, 0x00, 0x64, 0x01, 0x62, 0x00, 0x67, 0x00, 0x5b, 0x00, 0x22,
+    0x05, 0x00, 0x00, 0x01, 0x00, 0x59, 0x00, 0x48, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x6a, 0x00, 0x38,
+    0x00, 0x27, 0x00, 0x1d, 0x00, 0x1b, 0x00, 0x30, 0x00, 0x68, 0x00, 0x26, 0x00, 0x00, 0x00, 0x4a,
+    0x00, 0x55, 0x00, 0x0f, 0x00, 0x64, 0x00, 0x38, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x62, 0x00, 0x08,
+    0x00, 0x00, 0x00, 0x0f, 0x00, 0x08, 0x02, 0x00, 0x00, 0x02, 0x00, 0x59, 0x00, 0x40, 0x00, 0x1b,
+    0x00, 0x48, 0x00, 0x62, 0x00, 0x4b, 0x00, 0x59, 0x00, 0x6b, 0x00, 0x26, 0x00, 0x3a, 0x00, 0x60,
+    0x00, 0x53, 0x00, 0x48, 0x00, 0x38, 0x00, 0x1a, 0x00, 0x14, 0x00, 0x0c, 0x00, 0x02, 0xe9, 0x00,
+    0x00, 0x0b, 0x00, 0x5a, 0x00, 0x64, 0x01, 0x62, 0x00, 0x5c, 0x00, 0x4b, 0x00, 0x3a, 0x00, 0x2b,
+    0x00, 0x1d, 0x00, 0x08, 0x03, 0x00, 0x00, 0x47, 0x00, 0x68, 0x02, 0x62, 0x00, 0x64, 0x00, 0x67,
+    0x00, 0x40, 0x00, 0x2a, 0x00, 0x59, 0x00, 0x67, 0x01, 0x62, 0x00, 0x64, 0x00, 0x5b, 0x00, 0x0f,
+    0x06, 0x00, 0x00, 0x0c, 0x00, 0x64, 0x00, 0x38, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x68, 0x00, 0x48,
+    0x00, 0x4d, 0x00, 0x5b, 0x00, 0x64, 0x00, 0x67, 0x00, 0x64, 0x00, 0x14, 0x00, 0x01, 0x00, 0x5b,
+    0x00, 0x46, 0x00, 0x1d, 0x00, 0x6b, 0x00, 0x22, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x62, 0x00, 0x0e,
+    0x00, 0x00, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x1d, 0x00, 0x2b, 0x00, 0x01, 0x00, 0x0c, 0x00, 0x62,
+    0x00, 0x67, 0x00, 0x68, 0x00, 0x64, 0x00, 0x58, 0x00, 0x51, 0x00, 0x44, 0x00, 0x30, 0x00, 0x08,
+    0x00, 0x0c, 0x00, 0x08, 0x00, 0x01, 0xef, 0x00, 0x00, 0x13, 0x02, 0x62, 0x00, 0x67, 0x00, 0x38,
+    0x08, 0x00, 0x00, 0x14, 0x00, 0x5c, 0x00, 0x68, 0x00, 0x67, 0x00, 0x68, 0x00, 0x60, 0x00, 0x31,
+    0x00, 0x33, 0x00, 0x62, 0x02, 0x67, 0x00, 0x62, 0x00, 0x67, 0x00, 0x5b, 0x00, 0x07, 0x06, 0x00,
+    0x00, 0x1d, 0x00, 0x6b, 0x00, 0x24, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x62, 0x00, 0x53, 0x00, 0x48,
+    0x00, 0x3a, 0x00, 0x29, 0x00, 0x4b, 0x00, 0x5c, 0x00, 0x02, 0x00, 0x0a, 0x00, 0x64, 0x00, 0x30,
+    0x00, 0x2b, 0x00, 0x68, 0x00, 0x1d, 0x00, 0x16, 0x00, 0x5a, 0x00, 0x67, 0x00, 0x59, 0x00, 0x51,
+    0x00, 0x5c, 0x00, 0x62, 0x00, 0x6a, 0x00, 0x53, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x67, 0x00, 0x32,
+    0x00, 0x1e, 0x00, 0x0e, 0x00, 0x07, 0xf6, 0x00, 0x00, 0x21, 0x00, 0x67, 0x01, 0x62, 0x00, 0x67,
+    0x00, 0x22, 0x09, 0x00, 0x00, 0x0e, 0x00, 0x38, 0x00, 0x41, 0x00, 0x2b, 0x00, 0x20, 0x00, 0x47,
+    0x01, 0x68, 0x00, 0x62, 0x00, 0x4b, 0x00, 0x26, 0x00, 0x0f, 0x00, 0x51, 0x00, 0x6a, 0x00, 0x1b,
+    0x06, 0x00, 0x00, 0x2f, 0x00, 0x68, 0x00, 0x12, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x08, 0x03, 0x00,
+    0x00, 0x4d, 0x00, 0x54, 0x00, 0x0d, 0x00, 0x2c, 0x00, 0x6a, 0x00, 0x22, 0x00, 0x40, 0x00, 0x6a,
+    0x00, 0x64, 0x00, 0x68, 0x00, 0x62, 0x00, 0x53, 0x00, 0x4b, 0x00, 0x40, 0x00, 0x33, 0x00, 0x52,
+    0x00, 0x6a, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x5b, 0x00, 0x01, 0xf9, 0x00, 0x00, 0x2e,
+    0x00, 0x68, 0x02, 0x62, 0x00, 0x0f, 0x0c, 0x00, 0x00, 0x16, 0x00, 0x59, 0x00, 0x6b, 0x00, 0x5b,
+    0x00, 0x3a, 0x00, 0x14, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x59, 0x00, 0x30, 0x06, 0x00, 0x00, 0x44,
+    0x00, 0x5c, 0x00, 0x01, 0x01, 0x00, 0x00, 0x05, 0x00, 0x12, 0x00, 0x22, 0x00, 0x30, 0x00, 0x44,
+    0x00, 0x62, 0x00, 0x67, 0x00, 0x64, 0x00, 0x68, 0x00, 0x62, 0x00, 0x0f, 0x00, 0x3f, 0x00, 0x44,
+    0x00, 0x30, 0x00, 0x24, 0x00, 0x14, 0x00, 0x27, 0x00, 0x30, 0x00, 0x3f, 0x00, 0x4d, 0x00, 0x67,
+    0x00, 0x44, 0x00, 0x01, 0x00, 0x0c, 0x00, 0x62, 0x00, 0x38, 0xfa, 0x00, 0x00, 0x3e, 0x00, 0x67,
+    0x00, 0x62, 0x00, 0x64, 0x00, 0x59, 0x00, 0x05, 0x03, 0x00, 0x00, 0x01, 0x05, 0x00, 0x00, 0x01,
+    0x00, 0x30, 0x00, 0x65, 0x00, 0x4d, 0x00, 0x27, 0x00, 0x07, 0x05, 0x00, 0x00, 0x0f, 0x00, 0x3a,
+    0x06, 0x00, 0x00, 0x56, 0x00, 0x5b, 0x00, 0x36, 0x00, 0x47, 0x00, 0x51, 0x00, 0x5c, 0x00, 0x67,
+    0x00, 0x68, 0x00, 0x62, 0x00, 0x59, 0x00, 0x4b, 0x00, 0x3f, 0x00, 0x2b, 0x00, 0x1d, 0x00, 0x0e,
+    0x04, 0x00, 0x00, 0x0c, 0x00, 0x62, 0x00, 0x6a, 0x00, 0x64, 0x00, 0x59, 0x00, 0x30, 0x00, 0x01,
+    0x00, 0x02, 0x00, 0x4b, 0x00, 0x60, 0x00, 0x0c, 0xfa, 0x00, 0x00, 0x4c, 0x00, 0x6a, 0x01, 0x67,
+    0x00, 0x48, 0x03, 0x03, 0x01, 0x01, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x3c, 0x00, 0x41, 0x00, 0x16,
+    0x09, 0x00, 0x00, 0x08, 0x06, 0x00, 0x00, 0x63, 0x00, 0x64, 0x00, 0x62, 0x00, 0x54, 0x00, 0x48,
+    0x00, 0x38, 0x00, 0x2a, 0x00, 0x1a, 0x00, 0x0c, 0x00, 0x02, 0x09, 0x00, 0x00, 0x1e, 0x00, 0x68,
+    0x00, 0x30, 0x00, 0x0c, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x4d, 0x00, 0x68, 0x00, 0x24,
+    0xfb, 0x00, 0x00, 0x1c, 0x00, 0x2e, 0x00, 0x23, 0x00, 0x11, 0x00, 0x06, 0x00, 0x01, 0x08, 0x00,
+    0x00, 0x02, 0x00, 0x1f, 0x00, 0x0c, 0x13, 0x00, 0x01, 0x14, 0x00, 0x08, 0x00, 0x01, 0x0f, 0x00,
+    0x00, 0x30, 0x00, 0x67, 0x00, 0x16, 0x00, 0x0c, 0x00, 0x1a, 0x00, 0x3a, 0x01, 0x62, 0x00, 0x26,
+    0xff, 0x00, 0x36, 0x00, 0x00, 0x44, 0x00, 0x6a, 0x00, 0x5c, 0x00, 0x64, 0x00, 0x68, 0x00, 0x5c,
+    0x00, 0x3f, 0x00, 0x0d, 0xff, 0x00, 0x36, 0x00, 0x00, 0x01, 0x00, 0x4e, 0x00, 0x4b, 0x00, 0x3f,
+    0x00, 0x2f, 0x00, 0x1a, 0x00, 0x07, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xb3, 0x00,
 #endif /* GNW_TARGET_ZELDA */
 };
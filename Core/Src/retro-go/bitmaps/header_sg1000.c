@@ -1,73 +1,300 @@
+// Packed bitmap, see bitmaps.h. Generated by tools/img2bin.py --lut8-rle
 #if !defined(GNW_TARGET_ZELDA)
 #define GNW_TARGET_ZELDA 0
 #endif /* GNW_TARGET_ZELDA */
 
-const unsigned short header_sg1000[] = {
+const unsigned char header_sg1000[] __attribute__((aligned(4))) = {
 #if GNW_TARGET_ZELDA != 0
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x53E5,0xC4A9,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xDC88,0x8426,0x0320,0x0320,0x0320,0x0320,0x1361,0x9447,0xD488,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xCCA9,0x1B61,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x43A3,0xDC88,0xD467,0xD467,0xD467,0xD467,0xD467,0xCC88,0x1341,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x6405,0xCCA9,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD468,0xBCA9,0x43C4,0x0320,0x0320,0x0320,0x0320,0x1B62,0x9C68,0xD488,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD488,0x9447,0x1361,0x0320,0x0320,0x0320,0x0320,0x53E4,0xC4A9,0xD468,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xC4A9,0x5BE5,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x53C4,0xDC87,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xDC87,0x8426,0x0320,0x0320,0x0320,0x0B40,0x9C46,0xDC87,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xCC88,0x1B62,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x43A3,0xDC87,0xD446,0xD446,0xD446,0xD446,0xD446,0xCC68,0x1341,0x0320,0x0320,0x0320,0x0320,0x0320,0x63E5,0xDC87,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xDC66,0xD488,0x3BA3,0x0320,0x0320,0x1341,0xAC47,0xDC67,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xDC87,0xA446,0x0B40,0x0320,0x0320,0x4BC4,0xDC88,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xDC87,0x53E4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xC488,0xD446,0xD447,0xD446,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xE487,0x8C26,0x0320,0x0320,0x0320,0x4BE4,0xDC88,0xD446,0xD447,0xDC66,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC66,0xD489,0x1B62,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x43A3,0xE487,0xDC67,0xDC67,0xD446,0xD447,0xD446,0xCC88,0x1341,0x0320,0x0320,0x0320,0x0320,0x1361,0xCC88,0xD446,0xD447,0xD446,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xD446,0xD447,0xDC67,0x9C47,0x0320,0x0320,0x6405,0xDC87,0xD447,0xD447,0xDC66,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC66,0xD447,0xD446,0xDC88,0x4BE5,0x0320,0x0B40,0xAC68,0xDC67,0xD447,0xD446,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xD446,0xD447,0xD446,0xCC89,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xD467,0xD446,0xD446,0xC488,0x9C68,0x9C88,0x9C88,0x9C88,0x9C88,0x9C88,0x9C88,0x9C88,0x9C88,0x9C88,0xA488,0x5BE5,0x0320,0x0320,0x0320,0x63E4,0xDC87,0xD446,0xD467,0xAC88,0x9C68,0x9C88,0x9C88,0x9C88,0x9C88,0x9C88,0x9C88,0x9C88,0x9C88,0x9C88,0x9C88,0x9C88,0x9488,0x1341,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x2B83,0xA488,0x9C88,0x9C68,0xC488,0xD446,0xD446,0xCC88,0x1341,0x0320,0x0320,0x0320,0x0320,0x2382,0xD467,0xD447,0xD446,0xBC88,0x9C68,0x9C68,0x9C68,0x9C68,0x9C68,0x9C68,0x9C68,0x9C68,0x9C68,0x9C88,0xCC88,0xD447,0xD446,0xC489,0x0B41,0x0320,0x7C05,0xDC87,0xD446,0xD467,0xA488,0x9C68,0x9C68,0x9C68,0x9C68,0x9C68,0x9C68,0x9C68,0x9C68,0x9C68,0xAC89,0xD467,0xD446,0xDC87,0x6BE5,0x0320,0x1361,0xCCA9,0xD446,0xD446,0xC488,0x9C68,0x9C68,0x9C68,0x9C68,0x9C68,0x9C68,0x9C68,0x9C68,0x9C68,0x9C68,0xC488,0xD446,0xD446,0xD467,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xD467,0xD446,0xDC67,0x9468,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x63E4,0xDC87,0xD446,0xD488,0x4C05,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xA488,0xDC67,0xD446,0xCC88,0x1341,0x0320,0x0320,0x0320,0x0320,0x2B82,0xD447,0xD447,0xDC67,0x7C47,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xB488,0xDC67,0xD446,0xBC88,0x0B41,0x0320,0x7C05,0xDC87,0xD446,0xD488,0x33C4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x4BE5,0xDC88,0xD446,0xDC87,0x6BE5,0x0320,0x1361,0xCC89,0xD446,0xDC67,0xA488,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x9468,0xDC67,0xD446,0xD467,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xD467,0xD446,0xDC67,0x9468,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x63E4,0xDC87,0xD446,0xD488,0x4BE5,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xA488,0xDC67,0xD446,0xCC88,0x1341,0x0320,0x0320,0x0320,0x0320,0x2B82,0xD447,0xD447,0xDC67,0x8447,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xBC88,0xDC67,0xD446,0xBC88,0x0B41,0x0320,0x7C05,0xDC87,0xD446,0xD488,0x33C4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x4BE5,0xDC88,0xD446,0xDC87,0x6BE5,0x0320,0x1361,0xCC89,0xD446,0xDC67,0xA488,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x9C68,0xDC67,0xD446,0xD467,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xD467,0xD446,0xDC67,0x9468,0x0B41,0x0B41,0x0B41,0x0B41,0x0B41,0x0B41,0x0B41,0x0B41,0x0B41,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x63E4,0xDC87,0xD446,0xD488,0x4BE5,0x0320,0x0320,0x0320,0x0B41,0x0B41,0x0B41,0x0B41,0x0B41,0x0B41,0x0B41,0x0B41,0x0B41,0x0B41,0x0340,0x0320,0x0320,0x0340,0x0B41,0x0B41,0x0B41,0x0B41,0x0B41,0x0B41,0x0B41,0x0B41,0x0B41,0x0B41,0x0320,0x0320,0x0320,0x0320,0x0320,0xA488,0xDC67,0xD446,0xCC88,0x1341,0x0320,0x0320,0x0320,0x0320,0x2B82,0xD447,0xD447,0xDC67,0x8447,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xBC88,0xDC67,0xD446,0xBC88,0x0B41,0x0320,0x7C05,0xDC87,0xD446,0xD488,0x33C4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x4BE5,0xDC88,0xD446,0xDC87,0x6BE5,0x0320,0x1361,0xCC89,0xD446,0xDC67,0xA488,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x9C68,0xDC67,0xD446,0xD467,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xDC68,0xD446,0xD447,0xCC67,0xAC47,0xAC47,0xAC47,0xAC47,0xAC47,0xAC47,0xAC47,0xAC47,0xAC47,0xAC47,0x8446,0x1B82,0x0320,0x0320,0x0320,0x63E4,0xDC87,0xD446,0xD488,0x4BE5,0x0320,0x0320,0x3BC4,0xB467,0xAC47,0xAC47,0xAC47,0xAC47,0xAC47,0xAC47,0xAC47,0xAC47,0xB487,0x6BE5,0x0320,0x0320,0x9468,0xB467,0xAC47,0xAC47,0xAC47,0xAC47,0xAC47,0xAC47,0xAC47,0xAC47,0xAC88,0x2382,0x0320,0x0320,0x0320,0x0320,0xA488,0xDC67,0xD446,0xCC88,0x1341,0x0320,0x0320,0x0320,0x0320,0x2B82,0xD447,0xD447,0xDC67,0x8447,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xBC88,0xDC67,0xD446,0xBC88,0x0B41,0x0320,0x7C05,0xDC87,0xD446,0xD488,0x33C4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x4BE5,0xDC88,0xD446,0xDC87,0x6BE5,0x0320,0x1361,0xCC89,0xD446,0xDC67,0xA488,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x9C68,0xDC67,0xD446,0xD467,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xBC88,0xD446,0xD447,0xD446,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC87,0xBC88,0x2382,0x0320,0x0320,0x63E4,0xDC87,0xD446,0xD488,0x4BE5,0x0320,0x0320,0x43E4,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xE487,0x8405,0x0320,0x0320,0xB489,0xDC66,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC66,0xD488,0x33A3,0x0320,0x0320,0x0320,0x0320,0xA488,0xDC67,0xD446,0xCC88,0x1341,0x0320,0x0320,0x0320,0x0320,0x2B82,0xD447,0xD447,0xDC67,0x8447,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xBC88,0xDC67,0xD446,0xBC88,0x0B41,0x0320,0x7C05,0xDC87,0xD446,0xD488,0x33C4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x4BE5,0xDC88,0xD446,0xDC87,0x6BE5,0x0320,0x1361,0xCC89,0xD446,0xDC67,0xA488,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x9C68,0xDC67,0xD446,0xD467,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x53E5,0xDC88,0xDC67,0xDC66,0xDC66,0xDC66,0xDC66,0xDC66,0xDC66,0xDC66,0xDC66,0xDC66,0xDC46,0xD447,0xD447,0xDC87,0x7C06,0x0320,0x0320,0x63E4,0xDC87,0xD446,0xD488,0x4BE5,0x0320,0x0320,0x43E4,0xDC67,0xDC66,0xDC66,0xDC66,0xDC66,0xDC66,0xD446,0xD447,0xD447,0xDC87,0x8405,0x0320,0x0320,0xB489,0xDC66,0xDC66,0xDC66,0xDC66,0xDC66,0xDC66,0xDC66,0xDC66,0xDC66,0xD488,0x33A3,0x0320,0x0320,0x0320,0x0320,0xA488,0xDC67,0xD446,0xCC88,0x1341,0x0320,0x0320,0x0320,0x0320,0x2B82,0xD447,0xD447,0xDC67,0x8447,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xBC88,0xDC67,0xD446,0xBC88,0x0B41,0x0320,0x7C05,0xDC87,0xD446,0xD488,0x33C4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x4BE5,0xDC88,0xD446,0xDC87,0x6BE5,0x0320,0x1361,0xCC89,0xD446,0xDC67,0xA488,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x9C68,0xDC67,0xD446,0xD467,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x4BE5,0x9C47,0xB467,0xB468,0xB467,0xB467,0xB467,0xB467,0xB467,0xB467,0xB467,0xB468,0xD447,0xD447,0xDC66,0xA467,0x0340,0x0320,0x63E4,0xDC87,0xD446,0xD488,0x4BE5,0x0320,0x0320,0x3BC4,0xBC88,0xB467,0xB467,0xB467,0xB467,0xB467,0xBC68,0xD467,0xD447,0xDC87,0x8405,0x0320,0x0320,0x9488,0xBC88,0xB467,0xB467,0xB467,0xB467,0xB467,0xB467,0xB467,0xB467,0xB489,0x2383,0x0320,0x0320,0x0320,0x0320,0xA488,0xDC67,0xD446,0xCC88,0x1341,0x0320,0x0320,0x0320,0x0320,0x2B82,0xD447,0xD447,0xDC67,0x8447,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xBC88,0xDC67,0xD446,0xBC88,0x0B41,0x0320,0x7C05,0xDC87,0xD446,0xD488,0x33C4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x4BE5,0xDC88,0xD446,0xDC87,0x6BE5,0x0320,0x1361,0xCC89,0xD446,0xDC67,0xA488,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x9C68,0xDC67,0xD446,0xD467,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,0x1BA3,0xBC47,0xDC67,0xDC66,0xAC68,0x0B41,0x0320,0x63E4,0xDC87,0xD446,0xD488,0x4BE5,0x0320,0x0320,0x0320,0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,0x3BE5,0xD488,0xD446,0xDC87,0x8405,0x0320,0x0320,0x0B41,0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,0x1362,0x0320,0x0320,0x0320,0x0320,0x0320,0xA488,0xDC67,0xD446,0xCC88,0x1341,0x0320,0x0320,0x0320,0x0320,0x2B82,0xD447,0xD447,0xDC67,0x8447,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xBC88,0xDC67,0xD446,0xBC88,0x0B41,0x0320,0x7C05,0xDC87,0xD446,0xD488,0x33C4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x4BE5,0xDC88,0xD446,0xDC87,0x6BE5,0x0320,0x1361,0xCC89,0xD446,0xDC67,0xA488,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x9C68,0xDC67,0xD446,0xD467,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1362,0xBC47,0xDC67,0xDC66,0xAC68,0x0B41,0x0320,0x63E4,0xDC87,0xD446,0xD488,0x4BE5,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x33A3,0xD488,0xD446,0xDC87,0x8405,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xA488,0xDC67,0xD446,0xCC88,0x1341,0x0320,0x0320,0x0320,0x0320,0x2B82,0xD447,0xD447,0xDC67,0x8447,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xBC88,0xDC67,0xD446,0xBC88,0x0B41,0x0320,0x7C05,0xDC87,0xD446,0xD488,0x33C4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x4BE5,0xDC88,0xD446,0xDC87,0x6BE5,0x0320,0x1361,0xCC89,0xD446,0xDC67,0xA488,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x9C68,0xDC67,0xD446,0xD467,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0B61,0xB447,0xDC67,0xDC66,0xAC68,0x0B41,0x0320,0x63E4,0xDC87,0xD446,0xD488,0x4C05,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x33C4,0xD488,0xD446,0xDC87,0x8405,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xA488,0xDC67,0xD446,0xCC88,0x1361,0x0320,0x0320,0x0320,0x0320,0x2B82,0xD447,0xD447,0xDC67,0x7C47,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xB488,0xDC67,0xD446,0xBC88,0x0B41,0x0320,0x7C05,0xDC87,0xD446,0xD488,0x33C4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x4BE5,0xDC88,0xD446,0xDC87,0x6BE5,0x0320,0x1361,0xCC89,0xD446,0xDC67,0xA488,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x9468,0xDC67,0xD446,0xD467,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x7C68,0x9C88,0x9C88,0x9C88,0x9C88,0x9C88,0x9C88,0x9C88,0x9C88,0x9C88,0x9C88,0x9C68,0x9C88,0xCC47,0xD447,0xDC66,0xAC68,0x0B41,0x0320,0x63E4,0xDC87,0xD446,0xD467,0xAC88,0x9C68,0x9C88,0x9C88,0x9C88,0x9C88,0x9C88,0x9C88,0x9C88,0x9C88,0xA488,0xD467,0xD446,0xDC87,0x8405,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x2B83,0xA488,0x9C88,0x9C68,0xC488,0xD446,0xD446,0xD467,0xA488,0x9C88,0xA488,0x5C05,0x0320,0x2382,0xD447,0xD447,0xD446,0xBC88,0x9C68,0x9C68,0x9C68,0x9C68,0x9C68,0x9C68,0x9C68,0x9C68,0x9C68,0x9C88,0xCC88,0xD447,0xD446,0xC488,0x0B41,0x0320,0x7C05,0xDC87,0xD446,0xD467,0xA488,0x9C68,0x9C68,0x9C68,0x9C68,0x9C68,0x9C68,0x9C68,0x9C68,0x9C68,0xAC89,0xD467,0xD446,0xDC87,0x6BE5,0x0320,0x1361,0xCC89,0xD446,0xD446,0xC488,0x9C68,0x9C68,0x9C68,0x9C68,0x9C68,0x9C68,0x9C68,0x9C68,0x9C68,0x9C68,0xC488,0xD446,0xD446,0xD467,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xB4A9,0xDC66,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xD447,0xD447,0xDC67,0x8C26,0x0320,0x0320,0x5BE5,0xDC87,0xD447,0xD447,0xDC66,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC66,0xD447,0xD447,0xDC87,0x8405,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x43A3,0xE487,0xDC67,0xDC67,0xD446,0xD447,0xD447,0xD446,0xDC67,0xDC67,0xE487,0x7C26,0x0320,0x1B61,0xD488,0xD446,0xD447,0xD446,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xD446,0xD447,0xDC66,0xAC88,0x0320,0x0320,0x7426,0xDC87,0xD447,0xD447,0xDC66,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC66,0xD447,0xD447,0xDC87,0x5C05,0x0320,0x0B41,0xBC88,0xDC66,0xD447,0xD446,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xD446,0xD447,0xD446,0xD489,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xB4A9,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xDC46,0xD488,0x3BC4,0x0320,0x0320,0x1B62,0xC468,0xDC66,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xDC87,0x8405,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x43A3,0xDC87,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xDC67,0x7C06,0x0320,0x0320,0x9447,0xDC87,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xDC87,0x5BE4,0x0320,0x0320,0x2383,0xCC88,0xDC46,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xDC66,0xC468,0x1B82,0x0320,0x0320,0x7405,0xE487,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xE487,0x8447,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xB4A9,0xDC67,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD468,0xC4A9,0x4BC4,0x0320,0x0320,0x0320,0x0320,0x3BA3,0xB4A9,0xD488,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xDC88,0x8405,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x43A3,0xDC88,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xDC87,0x7C26,0x0320,0x0320,0x1361,0x9467,0xD4A9,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xCCA9,0x7426,0x0B41,0x0320,0x0320,0x0320,0x43C4,0xBCA9,0xD488,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD488,0xB4A9,0x3BA3,0x0320,0x0320,0x0320,0x0B41,0x8447,0xD4A9,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD4A9,0x8C47,0x0B41,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-  0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
+    0x40, 0x01, 0x20, 0x00, 0x65, 0x00, 0x20, 0x03, 0x40, 0x03, 0x40, 0x0b, 0x41, 0x0b, 0x61, 0x0b,
+    0x41, 0x13, 0x61, 0x13, 0x62, 0x13, 0x61, 0x1b, 0x62, 0x1b, 0x82, 0x1b, 0xa3, 0x1b, 0x82, 0x23,
+    0x83, 0x23, 0x82, 0x2b, 0x83, 0x2b, 0xa3, 0x33, 0xc4, 0x33, 0xa3, 0x3b, 0xc4, 0x3b, 0xe5, 0x3b,
+    0xa3, 0x43, 0xc4, 0x43, 0xe4, 0x43, 0xc4, 0x4b, 0xe4, 0x4b, 0xe5, 0x4b, 0x05, 0x4c, 0xc4, 0x53,
+    0xe4, 0x53, 0xe5, 0x53, 0xe4, 0x5b, 0xe5, 0x5b, 0x05, 0x5c, 0xe4, 0x63, 0xe5, 0x63, 0x05, 0x64,
+    0xe5, 0x6b, 0x05, 0x74, 0x26, 0x74, 0x05, 0x7c, 0x06, 0x7c, 0x26, 0x7c, 0x47, 0x7c, 0x68, 0x7c,
+    0x05, 0x84, 0x26, 0x84, 0x46, 0x84, 0x47, 0x84, 0x26, 0x8c, 0x47, 0x8c, 0x47, 0x94, 0x67, 0x94,
+    0x68, 0x94, 0x88, 0x94, 0x46, 0x9c, 0x47, 0x9c, 0x68, 0x9c, 0x88, 0x9c, 0x46, 0xa4, 0x67, 0xa4,
+    0x88, 0xa4, 0x47, 0xac, 0x68, 0xac, 0x88, 0xac, 0x89, 0xac, 0x47, 0xb4, 0x67, 0xb4, 0x68, 0xb4,
+    0x87, 0xb4, 0x88, 0xb4, 0x89, 0xb4, 0xa9, 0xb4, 0x47, 0xbc, 0x68, 0xbc, 0x88, 0xbc, 0xa9, 0xbc,
+    0x68, 0xc4, 0x88, 0xc4, 0x89, 0xc4, 0xa9, 0xc4, 0x47, 0xcc, 0x67, 0xcc, 0x68, 0xcc, 0x88, 0xcc,
+    0x89, 0xcc, 0xa9, 0xcc, 0x46, 0xd4, 0x47, 0xd4, 0x67, 0xd4, 0x68, 0xd4, 0x88, 0xd4, 0x89, 0xd4,
+    0xa9, 0xd4, 0x46, 0xdc, 0x66, 0xdc, 0x67, 0xdc, 0x68, 0xdc, 0x87, 0xdc, 0x88, 0xdc, 0x87, 0xe4,
+    0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
+    0xcc, 0x00, 0x00, 0x1e, 0x00, 0x50, 0x0a, 0x59, 0x00, 0x63, 0x00, 0x2e, 0x03, 0x00, 0x00, 0x06,
+    0x00, 0x33, 0x00, 0x5b, 0x0c, 0x59, 0x00, 0x56, 0x00, 0x08, 0x0d, 0x00, 0x00, 0x15, 0x00, 0x63,
+    0x04, 0x59, 0x00, 0x54, 0x00, 0x05, 0x05, 0x00, 0x00, 0x24, 0x00, 0x56, 0x0a, 0x59, 0x00, 0x5a,
+    0x00, 0x4c, 0x00, 0x16, 0x03, 0x00, 0x00, 0x09, 0x00, 0x39, 0x00, 0x5b, 0x0a, 0x59, 0x00, 0x5b,
+    0x00, 0x33, 0x00, 0x06, 0x03, 0x00, 0x00, 0x1d, 0x00, 0x50, 0x00, 0x5a, 0x0a, 0x59, 0x00, 0x50,
+    0x00, 0x20, 0xc3, 0x00, 0x00, 0x1c, 0x00, 0x62, 0x0b, 0x57, 0x00, 0x62, 0x00, 0x2e, 0x02, 0x00,
+    0x00, 0x02, 0x00, 0x37, 0x00, 0x62, 0x0d, 0x57, 0x00, 0x54, 0x00, 0x09, 0x0d, 0x00, 0x00, 0x15,
+    0x00, 0x62, 0x04, 0x57, 0x00, 0x53, 0x00, 0x05, 0x04, 0x00, 0x00, 0x23, 0x00, 0x62, 0x0c, 0x57,
+    0x00, 0x5f, 0x00, 0x5b, 0x00, 0x12, 0x01, 0x00, 0x00, 0x05, 0x00, 0x3e, 0x00, 0x60, 0x0c, 0x57,
+    0x00, 0x62, 0x00, 0x3b, 0x00, 0x02, 0x01, 0x00, 0x00, 0x18, 0x00, 0x63, 0x0d, 0x57, 0x00, 0x62,
+    0x00, 0x1d, 0xc2, 0x00, 0x00, 0x4e, 0x00, 0x57, 0x00, 0x58, 0x00, 0x57, 0x09, 0x60, 0x00, 0x64,
+    0x00, 0x31, 0x02, 0x00, 0x00, 0x19, 0x00, 0x63, 0x00, 0x57, 0x00, 0x58, 0x00, 0x5f, 0x0a, 0x60,
+    0x00, 0x5f, 0x00, 0x5c, 0x00, 0x09, 0x0d, 0x00, 0x00, 0x15, 0x00, 0x64, 0x01, 0x60, 0x00, 0x57,
+    0x00, 0x58, 0x00, 0x57, 0x00, 0x54, 0x00, 0x05, 0x03, 0x00, 0x00, 0x06, 0x00, 0x54, 0x00, 0x57,
+    0x00, 0x58, 0x00, 0x57, 0x09, 0x60, 0x00, 0x57, 0x00, 0x58, 0x00, 0x60, 0x00, 0x38, 0x01, 0x00,
+    0x00, 0x24, 0x00, 0x62, 0x01, 0x58, 0x00, 0x5f, 0x08, 0x60, 0x00, 0x5f, 0x00, 0x58, 0x00, 0x57,
+    0x00, 0x63, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x3f, 0x00, 0x60, 0x00, 0x58, 0x00, 0x57,
+    0x09, 0x60, 0x00, 0x57, 0x00, 0x58, 0x00, 0x57, 0x00, 0x55, 0xc2, 0x00, 0x00, 0x59, 0x01, 0x57,
+    0x00, 0x4e, 0x00, 0x39, 0x08, 0x3a, 0x00, 0x3d, 0x00, 0x20, 0x02, 0x00, 0x00, 0x22, 0x00, 0x62,
+    0x00, 0x57, 0x00, 0x59, 0x00, 0x40, 0x00, 0x39, 0x0a, 0x3a, 0x00, 0x36, 0x00, 0x05, 0x0d, 0x00,
+    0x00, 0x0f, 0x00, 0x3d, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x4e, 0x01, 0x57, 0x00, 0x54, 0x00, 0x05,
+    0x03, 0x00, 0x00, 0x0c, 0x00, 0x59, 0x00, 0x58, 0x00, 0x57, 0x00, 0x4b, 0x08, 0x39, 0x00, 0x3a,
+    0x00, 0x54, 0x00, 0x58, 0x00, 0x57, 0x00, 0x4f, 0x00, 0x03, 0x00, 0x00, 0x00, 0x28, 0x00, 0x62,
+    0x00, 0x57, 0x00, 0x59, 0x00, 0x3d, 0x08, 0x39, 0x00, 0x41, 0x00, 0x59, 0x00, 0x57, 0x00, 0x62,
+    0x00, 0x25, 0x00, 0x00, 0x00, 0x06, 0x00, 0x56, 0x01, 0x57, 0x00, 0x4e, 0x09, 0x39, 0x00, 0x4e,
+    0x01, 0x57, 0x00, 0x59, 0xc2, 0x00, 0x00, 0x59, 0x00, 0x57, 0x00, 0x60, 0x00, 0x35, 0x0e, 0x00,
+    0x00, 0x22, 0x00, 0x62, 0x00, 0x57, 0x00, 0x5b, 0x00, 0x1b, 0x1f, 0x00, 0x00, 0x3d, 0x00, 0x60,
+    0x00, 0x57, 0x00, 0x54, 0x00, 0x05, 0x03, 0x00, 0x00, 0x0e, 0x01, 0x58, 0x00, 0x60, 0x00, 0x2b,
+    0x09, 0x00, 0x00, 0x46, 0x00, 0x60, 0x00, 0x57, 0x00, 0x4b, 0x00, 0x03, 0x00, 0x00, 0x00, 0x28,
+    0x00, 0x62, 0x00, 0x57, 0x00, 0x5b, 0x00, 0x11, 0x08, 0x00, 0x00, 0x1a, 0x00, 0x63, 0x00, 0x57,
+    0x00, 0x62, 0x00, 0x25, 0x00, 0x00, 0x00, 0x06, 0x00, 0x55, 0x00, 0x57, 0x00, 0x60, 0x00, 0x3d,
+    0x09, 0x00, 0x00, 0x35, 0x00, 0x60, 0x00, 0x57, 0x00, 0x59, 0xc2, 0x00, 0x00, 0x59, 0x00, 0x57,
+    0x00, 0x60, 0x00, 0x35, 0x0e, 0x00, 0x00, 0x22, 0x00, 0x62, 0x00, 0x57, 0x00, 0x5b, 0x00, 0x1a,
+    0x1f, 0x00, 0x00, 0x3d, 0x00, 0x60, 0x00, 0x57, 0x00, 0x54, 0x00, 0x05, 0x03, 0x00, 0x00, 0x0e,
+    0x01, 0x58, 0x00, 0x60, 0x00, 0x30, 0x09, 0x00, 0x00, 0x4b, 0x00, 0x60, 0x00, 0x57, 0x00, 0x4b,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x28, 0x00, 0x62, 0x00, 0x57, 0x00, 0x5b, 0x00, 0x11, 0x08, 0x00,
+    0x00, 0x1a, 0x00, 0x63, 0x00, 0x57, 0x00, 0x62, 0x00, 0x25, 0x00, 0x00, 0x00, 0x06, 0x00, 0x55,
+    0x00, 0x57, 0x00, 0x60, 0x00, 0x3d, 0x09, 0x00, 0x00, 0x39, 0x00, 0x60, 0x00, 0x57, 0x00, 0x59,
+    0xc2, 0x00, 0x00, 0x59, 0x00, 0x57, 0x00, 0x60, 0x00, 0x35, 0x08, 0x03, 0x05, 0x00, 0x00, 0x22,
+    0x00, 0x62, 0x00, 0x57, 0x00, 0x5b, 0x00, 0x1a, 0x02, 0x00, 0x09, 0x03, 0x00, 0x01, 0x01, 0x00,
+    0x00, 0x01, 0x09, 0x03, 0x04, 0x00, 0x00, 0x3d, 0x00, 0x60, 0x00, 0x57, 0x00, 0x54, 0x00, 0x05,
+    0x03, 0x00, 0x00, 0x0e, 0x01, 0x58, 0x00, 0x60, 0x00, 0x30, 0x09, 0x00, 0x00, 0x4b, 0x00, 0x60,
+    0x00, 0x57, 0x00, 0x4b, 0x00, 0x03, 0x00, 0x00, 0x00, 0x28, 0x00, 0x62, 0x00, 0x57, 0x00, 0x5b,
+    0x00, 0x11, 0x08, 0x00, 0x00, 0x1a, 0x00, 0x63, 0x00, 0x57, 0x00, 0x62, 0x00, 0x25, 0x00, 0x00,
+    0x00, 0x06, 0x00, 0x55, 0x00, 0x57, 0x00, 0x60, 0x00, 0x3d, 0x09, 0x00, 0x00, 0x39, 0x00, 0x60,
+    0x00, 0x57, 0x00, 0x59, 0xc2, 0x00, 0x00, 0x61, 0x00, 0x57, 0x00, 0x58, 0x00, 0x52, 0x09, 0x3e,
+    0x00, 0x2f, 0x00, 0x0a, 0x02, 0x00, 0x00, 0x22, 0x00, 0x62, 0x00, 0x57, 0x00, 0x5b, 0x00, 0x1a,
+    0x01, 0x00, 0x00, 0x13, 0x00, 0x43, 0x07, 0x3e, 0x00, 0x45, 0x00, 0x25, 0x01, 0x00, 0x00, 0x35,
+    0x00, 0x43, 0x07, 0x3e, 0x00, 0x40, 0x00, 0x0c, 0x03, 0x00, 0x00, 0x3d, 0x00, 0x60, 0x00, 0x57,
+    0x00, 0x54, 0x00, 0x05, 0x03, 0x00, 0x00, 0x0e, 0x01, 0x58, 0x00, 0x60, 0x00, 0x30, 0x09, 0x00,
+    0x00, 0x4b, 0x00, 0x60, 0x00, 0x57, 0x00, 0x4b, 0x00, 0x03, 0x00, 0x00, 0x00, 0x28, 0x00, 0x62,
+    0x00, 0x57, 0x00, 0x5b, 0x00, 0x11, 0x08, 0x00, 0x00, 0x1a, 0x00, 0x63, 0x00, 0x57, 0x00, 0x62,
+    0x00, 0x25, 0x00, 0x00, 0x00, 0x06, 0x00, 0x55, 0x00, 0x57, 0x00, 0x60, 0x00, 0x3d, 0x09, 0x00,
+    0x00, 0x39, 0x00, 0x60, 0x00, 0x57, 0x00, 0x59, 0xc2, 0x00, 0x00, 0x4b, 0x00, 0x57, 0x00, 0x58,
+    0x00, 0x57, 0x09, 0x60, 0x00, 0x62, 0x00, 0x4b, 0x00, 0x0c, 0x01, 0x00, 0x00, 0x22, 0x00, 0x62,
+    0x00, 0x57, 0x00, 0x5b, 0x00, 0x1a, 0x01, 0x00, 0x00, 0x17, 0x08, 0x60, 0x00, 0x64, 0x00, 0x2d,
+    0x01, 0x00, 0x00, 0x47, 0x00, 0x5f, 0x06, 0x60, 0x00, 0x5f, 0x00, 0x5b, 0x00, 0x10, 0x03, 0x00,
+    0x00, 0x3d, 0x00, 0x60, 0x00, 0x57, 0x00, 0x54, 0x00, 0x05, 0x03, 0x00, 0x00, 0x0e, 0x01, 0x58,
+    0x00, 0x60, 0x00, 0x30, 0x09, 0x00, 0x00, 0x4b, 0x00, 0x60, 0x00, 0x57, 0x00, 0x4b, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x28, 0x00, 0x62, 0x00, 0x57, 0x00, 0x5b, 0x00, 0x11, 0x08, 0x00, 0x00, 0x1a,
+    0x00, 0x63, 0x00, 0x57, 0x00, 0x62, 0x00, 0x25, 0x00, 0x00, 0x00, 0x06, 0x00, 0x55, 0x00, 0x57,
+    0x00, 0x60, 0x00, 0x3d, 0x09, 0x00, 0x00, 0x39, 0x00, 0x60, 0x00, 0x57, 0x00, 0x59, 0xc2, 0x00,
+    0x00, 0x1e, 0x00, 0x63, 0x00, 0x60, 0x08, 0x5f, 0x00, 0x5e, 0x01, 0x58, 0x00, 0x62, 0x00, 0x29,
+    0x01, 0x00, 0x00, 0x22, 0x00, 0x62, 0x00, 0x57, 0x00, 0x5b, 0x00, 0x1a, 0x01, 0x00, 0x00, 0x17,
+    0x00, 0x60, 0x04, 0x5f, 0x00, 0x57, 0x01, 0x58, 0x00, 0x62, 0x00, 0x2d, 0x01, 0x00, 0x00, 0x47,
+    0x08, 0x5f, 0x00, 0x5b, 0x00, 0x10, 0x03, 0x00, 0x00, 0x3d, 0x00, 0x60, 0x00, 0x57, 0x00, 0x54,
+    0x00, 0x05, 0x03, 0x00, 0x00, 0x0e, 0x01, 0x58, 0x00, 0x60, 0x00, 0x30, 0x09, 0x00, 0x00, 0x4b,
+    0x00, 0x60, 0x00, 0x57, 0x00, 0x4b, 0x00, 0x03, 0x00, 0x00, 0x00, 0x28, 0x00, 0x62, 0x00, 0x57,
+    0x00, 0x5b, 0x00, 0x11, 0x08, 0x00, 0x00, 0x1a, 0x00, 0x63, 0x00, 0x57, 0x00, 0x62, 0x00, 0x25,
+    0x00, 0x00, 0x00, 0x06, 0x00, 0x55, 0x00, 0x57, 0x00, 0x60, 0x00, 0x3d, 0x09, 0x00, 0x00, 0x39,
+    0x00, 0x60, 0x00, 0x57, 0x00, 0x59, 0xc3, 0x00, 0x00, 0x1a, 0x00, 0x38, 0x00, 0x43, 0x00, 0x44,
+    0x06, 0x43, 0x00, 0x44, 0x01, 0x58, 0x00, 0x5f, 0x00, 0x3c, 0x00, 0x01, 0x00, 0x00, 0x00, 0x22,
+    0x00, 0x62, 0x00, 0x57, 0x00, 0x5b, 0x00, 0x1a, 0x01, 0x00, 0x00, 0x13, 0x00, 0x4b, 0x04, 0x43,
+    0x00, 0x4a, 0x00, 0x59, 0x00, 0x58, 0x00, 0x62, 0x00, 0x2d, 0x01, 0x00, 0x00, 0x36, 0x00, 0x4b,
+    0x07, 0x43, 0x00, 0x47, 0x00, 0x0d, 0x03, 0x00, 0x00, 0x3d, 0x00, 0x60, 0x00, 0x57, 0x00, 0x54,
+    0x00, 0x05, 0x03, 0x00, 0x00, 0x0e, 0x01, 0x58, 0x00, 0x60, 0x00, 0x30, 0x09, 0x00, 0x00, 0x4b,
+    0x00, 0x60, 0x00, 0x57, 0x00, 0x4b, 0x00, 0x03, 0x00, 0x00, 0x00, 0x28, 0x00, 0x62, 0x00, 0x57,
+    0x00, 0x5b, 0x00, 0x11, 0x08, 0x00, 0x00, 0x1a, 0x00, 0x63, 0x00, 0x57, 0x00, 0x62, 0x00, 0x25,
+    0x00, 0x00, 0x00, 0x06, 0x00, 0x55, 0x00, 0x57, 0x00, 0x60, 0x00, 0x3d, 0x09, 0x00, 0x00, 0x39,
+    0x00, 0x60, 0x00, 0x57, 0x00, 0x59, 0xc5, 0x00, 0x08, 0x07, 0x00, 0x0b, 0x00, 0x49, 0x00, 0x60,
+    0x00, 0x5f, 0x00, 0x3f, 0x00, 0x03, 0x00, 0x00, 0x00, 0x22, 0x00, 0x62, 0x00, 0x57, 0x00, 0x5b,
+    0x00, 0x1a, 0x02, 0x00, 0x05, 0x07, 0x00, 0x14, 0x00, 0x5b, 0x00, 0x57, 0x00, 0x62, 0x00, 0x2d,
+    0x01, 0x00, 0x00, 0x03, 0x09, 0x07, 0x04, 0x00, 0x00, 0x3d, 0x00, 0x60, 0x00, 0x57, 0x00, 0x54,
+    0x00, 0x05, 0x03, 0x00, 0x00, 0x0e, 0x01, 0x58, 0x00, 0x60, 0x00, 0x30, 0x09, 0x00, 0x00, 0x4b,
+    0x00, 0x60, 0x00, 0x57, 0x00, 0x4b, 0x00, 0x03, 0x00, 0x00, 0x00, 0x28, 0x00, 0x62, 0x00, 0x57,
+    0x00, 0x5b, 0x00, 0x11, 0x08, 0x00, 0x00, 0x1a, 0x00, 0x63, 0x00, 0x57, 0x00, 0x62, 0x00, 0x25,
+    0x00, 0x00, 0x00, 0x06, 0x00, 0x55, 0x00, 0x57, 0x00, 0x60, 0x00, 0x3d, 0x09, 0x00, 0x00, 0x39,
+    0x00, 0x60, 0x00, 0x57, 0x00, 0x59, 0xce, 0x00, 0x00, 0x07, 0x00, 0x49, 0x00, 0x60, 0x00, 0x5f,
+    0x00, 0x3f, 0x00, 0x03, 0x00, 0x00, 0x00, 0x22, 0x00, 0x62, 0x00, 0x57, 0x00, 0x5b, 0x00, 0x1a,
+    0x08, 0x00, 0x00, 0x10, 0x00, 0x5b, 0x00, 0x57, 0x00, 0x62, 0x00, 0x2d, 0x11, 0x00, 0x00, 0x3d,
+    0x00, 0x60, 0x00, 0x57, 0x00, 0x54, 0x00, 0x05, 0x03, 0x00, 0x00, 0x0e, 0x01, 0x58, 0x00, 0x60,
+    0x00, 0x30, 0x09, 0x00, 0x00, 0x4b, 0x00, 0x60, 0x00, 0x57, 0x00, 0x4b, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x28, 0x00, 0x62, 0x00, 0x57, 0x00, 0x5b, 0x00, 0x11, 0x08, 0x00, 0x00, 0x1a, 0x00, 0x63,
+    0x00, 0x57, 0x00, 0x62, 0x00, 0x25, 0x00, 0x00, 0x00, 0x06, 0x00, 0x55, 0x00, 0x57, 0x00, 0x60,
+    0x00, 0x3d, 0x09, 0x00, 0x00, 0x39, 0x00, 0x60, 0x00, 0x57, 0x00, 0x59, 0xce, 0x00, 0x00, 0x04,
+    0x00, 0x42, 0x00, 0x60, 0x00, 0x5f, 0x00, 0x3f, 0x00, 0x03, 0x00, 0x00, 0x00, 0x22, 0x00, 0x62,
+    0x00, 0x57, 0x00, 0x5b, 0x00, 0x1b, 0x08, 0x00, 0x00, 0x11, 0x00, 0x5b, 0x00, 0x57, 0x00, 0x62,
+    0x00, 0x2d, 0x11, 0x00, 0x00, 0x3d, 0x00, 0x60, 0x00, 0x57, 0x00, 0x54, 0x00, 0x06, 0x03, 0x00,
+    0x00, 0x0e, 0x01, 0x58, 0x00, 0x60, 0x00, 0x2b, 0x09, 0x00, 0x00, 0x46, 0x00, 0x60, 0x00, 0x57,
+    0x00, 0x4b, 0x00, 0x03, 0x00, 0x00, 0x00, 0x28, 0x00, 0x62, 0x00, 0x57, 0x00, 0x5b, 0x00, 0x11,
+    0x08, 0x00, 0x00, 0x1a, 0x00, 0x63, 0x00, 0x57, 0x00, 0x62, 0x00, 0x25, 0x00, 0x00, 0x00, 0x06,
+    0x00, 0x55, 0x00, 0x57, 0x00, 0x60, 0x00, 0x3d, 0x09, 0x00, 0x00, 0x35, 0x00, 0x60, 0x00, 0x57,
+    0x00, 0x59, 0xc2, 0x00, 0x00, 0x2c, 0x09, 0x3a, 0x00, 0x39, 0x00, 0x3a, 0x00, 0x51, 0x00, 0x58,
+    0x00, 0x5f, 0x00, 0x3f, 0x00, 0x03, 0x00, 0x00, 0x00, 0x22, 0x00, 0x62, 0x00, 0x57, 0x00, 0x59,
+    0x00, 0x40, 0x00, 0x39, 0x07, 0x3a, 0x00, 0x3d, 0x00, 0x59, 0x00, 0x57, 0x00, 0x62, 0x00, 0x2d,
+    0x0d, 0x00, 0x00, 0x0f, 0x00, 0x3d, 0x00, 0x3a, 0x00, 0x39, 0x00, 0x4e, 0x01, 0x57, 0x00, 0x59,
+    0x00, 0x3d, 0x00, 0x3a, 0x00, 0x3d, 0x00, 0x21, 0x00, 0x00, 0x00, 0x0c, 0x01, 0x58, 0x00, 0x57,
+    0x00, 0x4b, 0x08, 0x39, 0x00, 0x3a, 0x00, 0x54, 0x00, 0x58, 0x00, 0x57, 0x00, 0x4e, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x28, 0x00, 0x62, 0x00, 0x57, 0x00, 0x59, 0x00, 0x3d, 0x08, 0x39, 0x00, 0x41,
+    0x00, 0x59, 0x00, 0x57, 0x00, 0x62, 0x00, 0x25, 0x00, 0x00, 0x00, 0x06, 0x00, 0x55, 0x01, 0x57,
+    0x00, 0x4e, 0x09, 0x39, 0x00, 0x4e, 0x01, 0x57, 0x00, 0x59, 0xc2, 0x00, 0x00, 0x48, 0x00, 0x5f,
+    0x0a, 0x60, 0x01, 0x58, 0x00, 0x60, 0x00, 0x31, 0x01, 0x00, 0x00, 0x20, 0x00, 0x62, 0x01, 0x58,
+    0x00, 0x5f, 0x08, 0x60, 0x00, 0x5f, 0x01, 0x58, 0x00, 0x62, 0x00, 0x2d, 0x0d, 0x00, 0x00, 0x15,
+    0x00, 0x64, 0x01, 0x60, 0x00, 0x57, 0x01, 0x58, 0x00, 0x57, 0x01, 0x60, 0x00, 0x64, 0x00, 0x2a,
+    0x00, 0x00, 0x00, 0x08, 0x00, 0x5b, 0x00, 0x57, 0x00, 0x58, 0x00, 0x57, 0x09, 0x60, 0x00, 0x57,
+    0x00, 0x58, 0x00, 0x5f, 0x00, 0x40, 0x01, 0x00, 0x00, 0x27, 0x00, 0x62, 0x01, 0x58, 0x00, 0x5f,
+    0x08, 0x60, 0x00, 0x5f, 0x01, 0x58, 0x00, 0x62, 0x00, 0x21, 0x00, 0x00, 0x00, 0x03, 0x00, 0x4b,
+    0x00, 0x5f, 0x00, 0x58, 0x00, 0x57, 0x09, 0x60, 0x00, 0x57, 0x00, 0x58, 0x00, 0x57, 0x00, 0x5c,
+    0xc2, 0x00, 0x00, 0x48, 0x0c, 0x57, 0x00, 0x5e, 0x00, 0x5b, 0x00, 0x13, 0x01, 0x00, 0x00, 0x09,
+    0x00, 0x4d, 0x00, 0x5f, 0x0d, 0x57, 0x00, 0x62, 0x00, 0x2d, 0x0d, 0x00, 0x00, 0x15, 0x00, 0x62,
+    0x07, 0x57, 0x00, 0x60, 0x00, 0x29, 0x01, 0x00, 0x00, 0x33, 0x00, 0x62, 0x0d, 0x57, 0x00, 0x62,
+    0x00, 0x1f, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x54, 0x00, 0x5e, 0x0c, 0x57, 0x00, 0x5f, 0x00, 0x4d,
+    0x00, 0x0a, 0x01, 0x00, 0x00, 0x26, 0x00, 0x64, 0x0d, 0x57, 0x00, 0x64, 0x00, 0x30, 0xc2, 0x00,
+    0x00, 0x48, 0x00, 0x60, 0x0a, 0x59, 0x00, 0x5a, 0x00, 0x50, 0x00, 0x18, 0x03, 0x00, 0x00, 0x12,
+    0x00, 0x48, 0x00, 0x5b, 0x0c, 0x59, 0x00, 0x63, 0x00, 0x2d, 0x0d, 0x00, 0x00, 0x15, 0x00, 0x63,
+    0x07, 0x59, 0x00, 0x62, 0x00, 0x2a, 0x01, 0x00, 0x00, 0x06, 0x00, 0x34, 0x00, 0x5d, 0x0b, 0x59,
+    0x00, 0x56, 0x00, 0x27, 0x00, 0x03, 0x02, 0x00, 0x00, 0x16, 0x00, 0x4c, 0x00, 0x5b, 0x0a, 0x59,
+    0x00, 0x5b, 0x00, 0x48, 0x00, 0x12, 0x02, 0x00, 0x00, 0x03, 0x00, 0x30, 0x00, 0x5d, 0x0b, 0x59,
+    0x00, 0x5d, 0x00, 0x32, 0x00, 0x03, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
+    0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x76, 0x00,
 #else
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9205,0xD449,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xDC88,0xAAE6,0x6000,0x6000,0x6000,0x6000,0x6881,0xB347,0xD488,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD489,0x70A1,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x8163,0xDC88,0xD467,0xD467,0xD467,0xD467,0xD467,0xD468,0x6881,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A45,0xD469,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD468,0xCC29,0x8184,0x6000,0x6000,0x6000,0x6000,0x70A2,0xBB88,0xDC88,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD488,0xB347,0x6881,0x6000,0x6000,0x6000,0x6000,0x89E4,0xCC49,0xD468,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD469,0x9225,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x89E4,0xDC67,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xDC87,0xAAE6,0x6000,0x6000,0x6000,0x6040,0xBB66,0xDC87,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD468,0x70A2,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x8163,0xDC87,0xD446,0xD446,0xD446,0xD446,0xD446,0xD448,0x6881,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A45,0xDC87,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xDC66,0xD468,0x8163,0x6000,0x6000,0x6861,0xC3A7,0xDC67,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xDC87,0xBB86,0x6040,0x6000,0x6000,0x89C4,0xDC88,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xDC87,0x91E4,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xCC48,0xD446,0xD447,0xD446,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xE487,0xAAE6,0x6000,0x6000,0x6000,0x89E4,0xDC88,0xD446,0xD447,0xDC66,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC66,0xD489,0x70A2,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x8183,0xE487,0xDC67,0xDC67,0xD446,0xD447,0xD446,0xD448,0x6881,0x6000,0x6000,0x6000,0x6000,0x6881,0xCC48,0xD446,0xD447,0xD446,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xD446,0xD447,0xDC67,0xBB67,0x6020,0x6000,0x9245,0xDC87,0xD447,0xD447,0xDC66,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC66,0xD447,0xD446,0xDC88,0x89E5,0x6000,0x6040,0xC3C8,0xDC67,0xD447,0xD446,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xD446,0xD447,0xD446,0xD469,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xD467,0xD446,0xD446,0xCC28,0xB388,0xBB88,0xBB88,0xBB88,0xBB88,0xBB88,0xBB88,0xBB88,0xBB88,0xBB88,0xBBA8,0x9225,0x6000,0x6000,0x6000,0x9A24,0xDC87,0xD446,0xD467,0xC3E8,0xB388,0xBB88,0xBB88,0xBB88,0xBB88,0xBB88,0xBB88,0xBB88,0xBB88,0xBB88,0xBB88,0xBB88,0xB368,0x6861,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x7923,0xBBA8,0xBB88,0xB388,0xCC48,0xD446,0xD446,0xD448,0x6881,0x6000,0x6000,0x6000,0x6000,0x70E2,0xD447,0xD447,0xD446,0xC408,0xB388,0xB388,0xB388,0xB388,0xB388,0xB388,0xB388,0xB388,0xB388,0xB388,0xD448,0xD447,0xD446,0xCC49,0x6041,0x6000,0xA2C5,0xDC87,0xD446,0xD467,0xBBC8,0xB388,0xB388,0xB388,0xB388,0xB388,0xB388,0xB388,0xB388,0xB388,0xC3E9,0xD467,0xD446,0xDC87,0x9A45,0x6000,0x6881,0xD469,0xD446,0xD446,0xCC48,0xB388,0xB388,0xB388,0xB388,0xB388,0xB388,0xB388,0xB388,0xB388,0xB388,0xCC28,0xD446,0xD446,0xD467,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xD467,0xD446,0xDC67,0xB348,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A24,0xDC87,0xD446,0xD468,0x89E5,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xBBA8,0xDC67,0xD446,0xD448,0x6881,0x6000,0x6000,0x6000,0x6000,0x70E2,0xD447,0xD447,0xDC67,0xA2C7,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xC408,0xDC67,0xD446,0xCC28,0x6041,0x6000,0xA2A5,0xDC87,0xD446,0xD468,0x7944,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x89C5,0xDC88,0xD446,0xDC87,0x9A45,0x6000,0x6881,0xD469,0xD446,0xDC67,0xBBC8,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xB368,0xDC67,0xD446,0xD467,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xD467,0xD446,0xDC67,0xB368,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A24,0xDC87,0xD446,0xD488,0x89E5,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xBBA8,0xDC67,0xD446,0xD448,0x6881,0x6000,0x6000,0x6000,0x6000,0x70E2,0xD447,0xD447,0xDC67,0xAB07,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0xC408,0xDC67,0xD446,0xCC28,0x6041,0x6000,0xA2A5,0xDC87,0xD446,0xD468,0x7944,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x89E5,0xDC88,0xD446,0xDC87,0x9A45,0x6000,0x6881,0xD469,0xD446,0xDC67,0xBBC8,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xB368,0xDC67,0xD446,0xD467,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xD467,0xD446,0xDC67,0xB368,0x6041,0x6041,0x6041,0x6041,0x6041,0x6041,0x6041,0x6041,0x6041,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A24,0xDC87,0xD446,0xD488,0x89E5,0x6000,0x6000,0x6000,0x6041,0x6041,0x6041,0x6041,0x6041,0x6041,0x6041,0x6041,0x6041,0x6041,0x6020,0x6000,0x6000,0x6020,0x6041,0x6041,0x6041,0x6041,0x6041,0x6041,0x6041,0x6041,0x6041,0x6041,0x6000,0x6000,0x6000,0x6000,0x6000,0xBBA8,0xDC67,0xD446,0xD448,0x6881,0x6000,0x6000,0x6000,0x6000,0x70E2,0xD447,0xD447,0xDC67,0xAB07,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0xC408,0xDC67,0xD446,0xCC28,0x6041,0x6000,0xA2A5,0xDC87,0xD446,0xD468,0x7944,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x89E5,0xDC88,0xD446,0xDC87,0x9A45,0x6000,0x6881,0xD469,0xD446,0xDC67,0xBBC8,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xB368,0xDC67,0xD446,0xD467,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xDC68,0xD446,0xD447,0xCC27,0xC3A7,0xC3A7,0xC3A7,0xC3A7,0xC3A7,0xC3A7,0xC3A7,0xC3A7,0xC3C7,0xBBA7,0xAB06,0x70C2,0x6000,0x6000,0x6000,0x9A24,0xDC87,0xD446,0xD488,0x89E5,0x6000,0x6000,0x8164,0xC3C7,0xC3A7,0xC3A7,0xC3A7,0xC3A7,0xC3A7,0xC3A7,0xC3A7,0xC3A7,0xC3E7,0x9A45,0x6000,0x6020,0xB348,0xC3C7,0xC3A7,0xC3A7,0xC3A7,0xC3A7,0xC3A7,0xC3A7,0xC3A7,0xC3C7,0xC3C8,0x70E2,0x6000,0x6000,0x6000,0x6000,0xBBA8,0xDC67,0xD446,0xD448,0x6881,0x6000,0x6000,0x6000,0x6000,0x70E2,0xD447,0xD447,0xDC67,0xAB07,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0xC408,0xDC67,0xD446,0xCC28,0x6041,0x6000,0xA2A5,0xDC87,0xD446,0xD468,0x7944,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x89E5,0xDC88,0xD446,0xDC87,0x9A45,0x6000,0x6881,0xD469,0xD446,0xDC67,0xBBC8,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xB368,0xDC67,0xD446,0xD467,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xCC28,0xD446,0xD447,0xD446,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC87,0xCC08,0x70C2,0x6000,0x6000,0x9A24,0xDC87,0xD446,0xD488,0x89E5,0x6000,0x6000,0x81A4,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xE487,0xAAE5,0x6000,0x6020,0xC409,0xDC66,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC66,0xD488,0x7943,0x6000,0x6000,0x6000,0x6000,0xBBA8,0xDC67,0xD446,0xD448,0x6881,0x6000,0x6000,0x6000,0x6000,0x70E2,0xD447,0xD447,0xDC67,0xAB07,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0xC408,0xDC67,0xD446,0xCC28,0x6041,0x6000,0xA2A5,0xDC87,0xD446,0xD468,0x7944,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x89E5,0xDC88,0xD446,0xDC87,0x9A45,0x6000,0x6881,0xD469,0xD446,0xDC67,0xBBC8,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xB368,0xDC67,0xD446,0xD467,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x89E5,0xDC88,0xDC67,0xDC66,0xDC66,0xDC66,0xDC66,0xDC66,0xDC66,0xDC66,0xDC66,0xDC66,0xDC46,0xD447,0xD447,0xDC87,0xA2C6,0x6000,0x6000,0x9A24,0xDC87,0xD446,0xD488,0x89E5,0x6000,0x6000,0x81A4,0xDC67,0xDC66,0xDC66,0xDC66,0xDC66,0xDC66,0xD446,0xD447,0xD447,0xDC87,0xAAC5,0x6000,0x6020,0xC409,0xDC66,0xDC66,0xDC66,0xDC66,0xDC66,0xDC66,0xDC66,0xDC66,0xDC66,0xD488,0x7943,0x6000,0x6000,0x6000,0x6000,0xBBA8,0xDC67,0xD446,0xD448,0x6881,0x6000,0x6000,0x6000,0x6000,0x70E2,0xD447,0xD447,0xDC67,0xAB07,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0xC408,0xDC67,0xD446,0xCC28,0x6041,0x6000,0xA2A5,0xDC87,0xD446,0xD468,0x7944,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x89E5,0xDC88,0xD446,0xDC87,0x9A45,0x6000,0x6881,0xD469,0xD446,0xDC67,0xBBC8,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xB368,0xDC67,0xD446,0xD467,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x89C5,0xBB67,0xC3E7,0xC3E8,0xC3E7,0xC3E7,0xC3E7,0xC3E7,0xC3E7,0xC3E7,0xC3E7,0xC3E8,0xD447,0xD447,0xDC66,0xBBA7,0x6020,0x6000,0x9A24,0xDC87,0xD446,0xD488,0x89E5,0x6000,0x6000,0x8164,0xCC08,0xC3E7,0xC3E7,0xC3E7,0xC3E7,0xC3E7,0xCC08,0xD467,0xD447,0xDC87,0xAAC5,0x6000,0x6020,0xB388,0xCC08,0xC3E7,0xC3E7,0xC3E7,0xC3E7,0xC3E7,0xC3E7,0xC3E7,0xC3E7,0xC409,0x7103,0x6000,0x6000,0x6000,0x6000,0xBBA8,0xDC67,0xD446,0xD448,0x6881,0x6000,0x6000,0x6000,0x6000,0x70E2,0xD447,0xD447,0xDC67,0xAB07,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0xC408,0xDC67,0xD446,0xCC28,0x6041,0x6000,0xA2A5,0xDC87,0xD446,0xD468,0x7944,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x89E5,0xDC88,0xD446,0xDC87,0x9A45,0x6000,0x6881,0xD469,0xD446,0xDC67,0xBBC8,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xB368,0xDC67,0xD446,0xD467,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6882,0x6882,0x6882,0x6882,0x6882,0x6882,0x6882,0x6882,0x6882,0x70E3,0xC3E7,0xDC67,0xDC66,0xC3C8,0x6041,0x6000,0x9A24,0xDC87,0xD446,0xD488,0x89E5,0x6000,0x6000,0x6020,0x6882,0x6882,0x6882,0x6882,0x6882,0x6882,0x81A5,0xD468,0xD446,0xDC87,0xAAC5,0x6000,0x6000,0x6061,0x6882,0x6882,0x6882,0x6882,0x6882,0x6882,0x6882,0x6882,0x6882,0x6882,0x6000,0x6000,0x6000,0x6000,0x6000,0xBBA8,0xDC67,0xD446,0xD448,0x6881,0x6000,0x6000,0x6000,0x6000,0x70E2,0xD447,0xD447,0xDC67,0xAB07,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0xC408,0xDC67,0xD446,0xCC28,0x6041,0x6000,0xA2A5,0xDC87,0xD446,0xD468,0x7944,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x89E5,0xDC88,0xD446,0xDC87,0x9A45,0x6000,0x6881,0xD469,0xD446,0xDC67,0xBBC8,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xB368,0xDC67,0xD446,0xD467,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6882,0xC3E7,0xDC67,0xDC66,0xBBC8,0x6041,0x6000,0x9A24,0xDC87,0xD446,0xD488,0x89E5,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x7943,0xD468,0xD446,0xDC87,0xAAC5,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xBBA8,0xDC67,0xD446,0xD448,0x6881,0x6000,0x6000,0x6000,0x6000,0x70E2,0xD447,0xD447,0xDC67,0xAB07,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0xC408,0xDC67,0xD446,0xCC28,0x6041,0x6000,0xA2A5,0xDC87,0xD446,0xD468,0x7944,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x89E5,0xDC88,0xD446,0xDC87,0x9A45,0x6000,0x6881,0xD469,0xD446,0xDC67,0xBBC8,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xB368,0xDC67,0xD446,0xD467,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6861,0xC3C7,0xDC67,0xDC66,0xBBC8,0x6041,0x6000,0x9A24,0xDC87,0xD446,0xD468,0x89E5,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x7944,0xD468,0xD446,0xDC87,0xAAC5,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xBBA8,0xDC67,0xD446,0xD468,0x6881,0x6000,0x6000,0x6000,0x6000,0x70E2,0xD447,0xD447,0xDC67,0xA2C7,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xC408,0xDC67,0xD446,0xCC28,0x6041,0x6000,0xA2A5,0xDC87,0xD446,0xD468,0x7944,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x89C5,0xDC88,0xD446,0xDC87,0x9A45,0x6000,0x6881,0xD469,0xD446,0xDC67,0xBBC8,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xB368,0xDC67,0xD446,0xD467,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xAB08,0xBBA8,0xBB88,0xBB88,0xBB88,0xBB88,0xBB88,0xBB88,0xBB88,0xBB88,0xBB88,0xBB88,0xBB88,0xD427,0xD447,0xDC66,0xBBC8,0x6041,0x6000,0x9A24,0xDC87,0xD446,0xD467,0xC3E8,0xB388,0xBB88,0xBB88,0xBB88,0xBB88,0xBB88,0xBB88,0xBB88,0xB388,0xBBC8,0xD467,0xD446,0xDC87,0xAAC5,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x7923,0xBBA8,0xBB88,0xB388,0xCC48,0xD446,0xD446,0xD467,0xBBA8,0xBB88,0xBBA8,0x9225,0x6000,0x70E2,0xD447,0xD447,0xD446,0xC408,0xB388,0xB388,0xB388,0xB388,0xB388,0xB388,0xB388,0xB388,0xB388,0xB388,0xD448,0xD447,0xD446,0xCC48,0x6041,0x6000,0xA2A5,0xDC87,0xD446,0xD467,0xBBC8,0xB388,0xB388,0xB388,0xB388,0xB388,0xB388,0xB388,0xB388,0xB388,0xC3E9,0xD467,0xD446,0xDC87,0x9A45,0x6000,0x6881,0xD469,0xD446,0xD446,0xCC48,0xB388,0xB388,0xB388,0xB388,0xB388,0xB388,0xB388,0xB388,0xB388,0xB388,0xCC28,0xD446,0xD446,0xD467,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xC429,0xDC66,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xD447,0xD447,0xDC67,0xAB06,0x6000,0x6000,0x9225,0xDC87,0xD447,0xD447,0xDC66,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC66,0xD447,0xD447,0xDC87,0xAAC5,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x8183,0xE487,0xDC67,0xDC67,0xD446,0xD447,0xD447,0xD446,0xDC67,0xDC67,0xE487,0xA2C6,0x6000,0x68A1,0xD468,0xD446,0xD447,0xD446,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xD446,0xD447,0xDC66,0xC3C8,0x6020,0x6000,0xA2A6,0xDC87,0xD447,0xD447,0xDC66,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC66,0xD447,0xD447,0xDC87,0x9225,0x6000,0x6861,0xCC08,0xDC66,0xD447,0xD446,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xD446,0xD447,0xD446,0xD489,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xC409,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xDC46,0xD468,0x8184,0x6000,0x6000,0x68A2,0xCC28,0xDC66,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xDC87,0xAAC5,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x8163,0xDC87,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xDC67,0xA2A6,0x6000,0x6020,0xB347,0xDC87,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xDC87,0x9224,0x6000,0x6000,0x7103,0xD448,0xDC46,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xDC66,0xCC28,0x70A2,0x6000,0x6000,0xA285,0xE487,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xD446,0xE487,0xAB07,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xC409,0xDC67,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD468,0xCC29,0x89C4,0x6000,0x6000,0x6000,0x6000,0x8143,0xC409,0xD488,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xDC88,0xAAC5,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x8163,0xDC88,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xDC87,0xA2C6,0x6000,0x6000,0x6881,0xB367,0xD489,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD469,0xA2A6,0x6041,0x6000,0x6000,0x6000,0x89A4,0xCC29,0xD488,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD488,0xC409,0x8163,0x6000,0x6000,0x6000,0x6861,0xAAE7,0xD489,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD467,0xD489,0xAB07,0x6841,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-  0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
+    0x40, 0x01, 0x20, 0x00, 0x60, 0x00, 0x00, 0x60, 0x20, 0x60, 0x40, 0x60, 0x41, 0x60, 0x61, 0x60,
+    0x41, 0x68, 0x61, 0x68, 0x81, 0x68, 0x82, 0x68, 0xa1, 0x68, 0xa2, 0x68, 0xa1, 0x70, 0xa2, 0x70,
+    0xc2, 0x70, 0xe2, 0x70, 0xe3, 0x70, 0x03, 0x71, 0x23, 0x79, 0x43, 0x79, 0x44, 0x79, 0x43, 0x81,
+    0x63, 0x81, 0x64, 0x81, 0x83, 0x81, 0x84, 0x81, 0xa4, 0x81, 0xa5, 0x81, 0xa4, 0x89, 0xc4, 0x89,
+    0xc5, 0x89, 0xe4, 0x89, 0xe5, 0x89, 0xe4, 0x91, 0x05, 0x92, 0x24, 0x92, 0x25, 0x92, 0x45, 0x92,
+    0x24, 0x9a, 0x45, 0x9a, 0x85, 0xa2, 0xa5, 0xa2, 0xa6, 0xa2, 0xc5, 0xa2, 0xc6, 0xa2, 0xc7, 0xa2,
+    0xc5, 0xaa, 0xe5, 0xaa, 0xe6, 0xaa, 0xe7, 0xaa, 0x06, 0xab, 0x07, 0xab, 0x08, 0xab, 0x47, 0xb3,
+    0x48, 0xb3, 0x67, 0xb3, 0x68, 0xb3, 0x88, 0xb3, 0x66, 0xbb, 0x67, 0xbb, 0x86, 0xbb, 0x88, 0xbb,
+    0xa7, 0xbb, 0xa8, 0xbb, 0xc8, 0xbb, 0xa7, 0xc3, 0xc7, 0xc3, 0xc8, 0xc3, 0xe7, 0xc3, 0xe8, 0xc3,
+    0xe9, 0xc3, 0x08, 0xc4, 0x09, 0xc4, 0x29, 0xc4, 0x08, 0xcc, 0x27, 0xcc, 0x28, 0xcc, 0x29, 0xcc,
+    0x48, 0xcc, 0x49, 0xcc, 0x27, 0xd4, 0x46, 0xd4, 0x47, 0xd4, 0x48, 0xd4, 0x49, 0xd4, 0x67, 0xd4,
+    0x68, 0xd4, 0x69, 0xd4, 0x88, 0xd4, 0x89, 0xd4, 0x46, 0xdc, 0x66, 0xdc, 0x67, 0xdc, 0x68, 0xdc,
+    0x87, 0xdc, 0x88, 0xdc, 0x87, 0xe4, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
+    0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xcc, 0x00, 0x00, 0x21, 0x00, 0x53, 0x0a, 0x54, 0x00, 0x5e,
+    0x00, 0x2f, 0x03, 0x00, 0x00, 0x07, 0x00, 0x34, 0x00, 0x57, 0x0c, 0x54, 0x00, 0x58, 0x00, 0x0b,
+    0x0d, 0x00, 0x00, 0x15, 0x00, 0x5e, 0x04, 0x54, 0x00, 0x55, 0x00, 0x07, 0x05, 0x00, 0x00, 0x26,
+    0x00, 0x56, 0x0a, 0x54, 0x00, 0x55, 0x00, 0x4c, 0x00, 0x18, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x3c,
+    0x00, 0x5e, 0x0a, 0x54, 0x00, 0x57, 0x00, 0x34, 0x00, 0x07, 0x03, 0x00, 0x00, 0x1e, 0x00, 0x4e,
+    0x00, 0x55, 0x0a, 0x54, 0x00, 0x56, 0x00, 0x23, 0xc3, 0x00, 0x00, 0x1e, 0x00, 0x5b, 0x0b, 0x50,
+    0x00, 0x5d, 0x00, 0x2f, 0x02, 0x00, 0x00, 0x02, 0x00, 0x39, 0x00, 0x5d, 0x0d, 0x50, 0x00, 0x55,
+    0x00, 0x0c, 0x0d, 0x00, 0x00, 0x15, 0x00, 0x5d, 0x04, 0x50, 0x00, 0x52, 0x00, 0x07, 0x04, 0x00,
+    0x00, 0x26, 0x00, 0x5d, 0x0c, 0x50, 0x00, 0x5a, 0x00, 0x55, 0x00, 0x15, 0x01, 0x00, 0x00, 0x06,
+    0x00, 0x40, 0x00, 0x5b, 0x0c, 0x50, 0x00, 0x5d, 0x00, 0x3b, 0x00, 0x02, 0x01, 0x00, 0x00, 0x1c,
+    0x00, 0x5e, 0x0d, 0x50, 0x00, 0x5d, 0x00, 0x20, 0xc2, 0x00, 0x00, 0x4d, 0x00, 0x50, 0x00, 0x51,
+    0x00, 0x50, 0x09, 0x5b, 0x00, 0x5f, 0x00, 0x2f, 0x02, 0x00, 0x00, 0x1e, 0x00, 0x5e, 0x00, 0x50,
+    0x00, 0x51, 0x00, 0x5a, 0x0a, 0x5b, 0x00, 0x5a, 0x00, 0x58, 0x00, 0x0c, 0x0d, 0x00, 0x00, 0x17,
+    0x00, 0x5f, 0x01, 0x5b, 0x00, 0x50, 0x00, 0x51, 0x00, 0x50, 0x00, 0x52, 0x00, 0x07, 0x03, 0x00,
+    0x00, 0x07, 0x00, 0x4d, 0x00, 0x50, 0x00, 0x51, 0x00, 0x50, 0x09, 0x5b, 0x00, 0x50, 0x00, 0x51,
+    0x00, 0x5b, 0x00, 0x3a, 0x00, 0x01, 0x00, 0x00, 0x00, 0x24, 0x00, 0x5d, 0x01, 0x51, 0x00, 0x5a,
+    0x08, 0x5b, 0x00, 0x5a, 0x00, 0x51, 0x00, 0x50, 0x00, 0x5e, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x42, 0x00, 0x5b, 0x00, 0x51, 0x00, 0x50, 0x09, 0x5b, 0x00, 0x50, 0x00, 0x51, 0x00, 0x50,
+    0x00, 0x56, 0xc2, 0x00, 0x00, 0x54, 0x01, 0x50, 0x00, 0x4b, 0x00, 0x38, 0x08, 0x3c, 0x00, 0x3e,
+    0x00, 0x23, 0x02, 0x00, 0x00, 0x25, 0x00, 0x5d, 0x00, 0x50, 0x00, 0x54, 0x00, 0x44, 0x00, 0x38,
+    0x0a, 0x3c, 0x00, 0x37, 0x00, 0x06, 0x0d, 0x00, 0x00, 0x11, 0x00, 0x3e, 0x00, 0x3c, 0x00, 0x38,
+    0x00, 0x4d, 0x01, 0x50, 0x00, 0x52, 0x00, 0x07, 0x03, 0x00, 0x00, 0x0e, 0x01, 0x51, 0x00, 0x50,
+    0x00, 0x46, 0x09, 0x38, 0x00, 0x52, 0x00, 0x51, 0x00, 0x50, 0x00, 0x4e, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x2a, 0x00, 0x5d, 0x00, 0x50, 0x00, 0x54, 0x00, 0x3f, 0x08, 0x38, 0x00, 0x45, 0x00, 0x54,
+    0x00, 0x50, 0x00, 0x5d, 0x00, 0x26, 0x00, 0x00, 0x00, 0x07, 0x00, 0x56, 0x01, 0x50, 0x00, 0x4d,
+    0x09, 0x38, 0x00, 0x4b, 0x01, 0x50, 0x00, 0x54, 0xc2, 0x00, 0x00, 0x54, 0x00, 0x50, 0x00, 0x5b,
+    0x00, 0x35, 0x0e, 0x00, 0x00, 0x25, 0x00, 0x5d, 0x00, 0x50, 0x00, 0x55, 0x00, 0x1f, 0x1f, 0x00,
+    0x00, 0x3e, 0x00, 0x5b, 0x00, 0x50, 0x00, 0x52, 0x00, 0x07, 0x03, 0x00, 0x00, 0x0e, 0x01, 0x51,
+    0x00, 0x5b, 0x00, 0x2c, 0x09, 0x00, 0x00, 0x46, 0x00, 0x5b, 0x00, 0x50, 0x00, 0x4b, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x28, 0x00, 0x5d, 0x00, 0x50, 0x00, 0x55, 0x00, 0x13, 0x08, 0x00, 0x00, 0x1d,
+    0x00, 0x5e, 0x00, 0x50, 0x00, 0x5d, 0x00, 0x26, 0x00, 0x00, 0x00, 0x07, 0x00, 0x56, 0x00, 0x50,
+    0x00, 0x5b, 0x00, 0x3f, 0x09, 0x00, 0x00, 0x37, 0x00, 0x5b, 0x00, 0x50, 0x00, 0x54, 0xc2, 0x00,
+    0x00, 0x54, 0x00, 0x50, 0x00, 0x5b, 0x00, 0x37, 0x0e, 0x00, 0x00, 0x25, 0x00, 0x5d, 0x00, 0x50,
+    0x00, 0x57, 0x00, 0x1f, 0x1f, 0x00, 0x00, 0x3e, 0x00, 0x5b, 0x00, 0x50, 0x00, 0x52, 0x00, 0x07,
+    0x03, 0x00, 0x00, 0x0e, 0x01, 0x51, 0x00, 0x5b, 0x00, 0x32, 0x08, 0x00, 0x00, 0x01, 0x00, 0x46,
+    0x00, 0x5b, 0x00, 0x50, 0x00, 0x4b, 0x00, 0x03, 0x00, 0x00, 0x00, 0x28, 0x00, 0x5d, 0x00, 0x50,
+    0x00, 0x55, 0x00, 0x13, 0x08, 0x00, 0x00, 0x1f, 0x00, 0x5e, 0x00, 0x50, 0x00, 0x5d, 0x00, 0x26,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x56, 0x00, 0x50, 0x00, 0x5b, 0x00, 0x3f, 0x09, 0x00, 0x00, 0x37,
+    0x00, 0x5b, 0x00, 0x50, 0x00, 0x54, 0xc2, 0x00, 0x00, 0x54, 0x00, 0x50, 0x00, 0x5b, 0x00, 0x37,
+    0x08, 0x03, 0x00, 0x01, 0x04, 0x00, 0x00, 0x25, 0x00, 0x5d, 0x00, 0x50, 0x00, 0x57, 0x00, 0x1f,
+    0x02, 0x00, 0x09, 0x03, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x09, 0x03, 0x04, 0x00, 0x00, 0x3e,
+    0x00, 0x5b, 0x00, 0x50, 0x00, 0x52, 0x00, 0x07, 0x03, 0x00, 0x00, 0x0e, 0x01, 0x51, 0x00, 0x5b,
+    0x00, 0x32, 0x08, 0x00, 0x00, 0x01, 0x00, 0x46, 0x00, 0x5b, 0x00, 0x50, 0x00, 0x4b, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x28, 0x00, 0x5d, 0x00, 0x50, 0x00, 0x55, 0x00, 0x13, 0x08, 0x00, 0x00, 0x1f,
+    0x00, 0x5e, 0x00, 0x50, 0x00, 0x5d, 0x00, 0x26, 0x00, 0x00, 0x00, 0x07, 0x00, 0x56, 0x00, 0x50,
+    0x00, 0x5b, 0x00, 0x3f, 0x09, 0x00, 0x00, 0x37, 0x00, 0x5b, 0x00, 0x50, 0x00, 0x54, 0xc2, 0x00,
+    0x00, 0x5c, 0x00, 0x50, 0x00, 0x51, 0x00, 0x4a, 0x07, 0x40, 0x00, 0x41, 0x00, 0x3d, 0x00, 0x31,
+    0x00, 0x0d, 0x02, 0x00, 0x00, 0x25, 0x00, 0x5d, 0x00, 0x50, 0x00, 0x57, 0x00, 0x1f, 0x01, 0x00,
+    0x00, 0x16, 0x00, 0x41, 0x07, 0x40, 0x00, 0x43, 0x00, 0x26, 0x00, 0x00, 0x00, 0x01, 0x00, 0x35,
+    0x00, 0x41, 0x06, 0x40, 0x00, 0x41, 0x00, 0x42, 0x00, 0x0e, 0x03, 0x00, 0x00, 0x3e, 0x00, 0x5b,
+    0x00, 0x50, 0x00, 0x52, 0x00, 0x07, 0x03, 0x00, 0x00, 0x0e, 0x01, 0x51, 0x00, 0x5b, 0x00, 0x32,
+    0x08, 0x00, 0x00, 0x01, 0x00, 0x46, 0x00, 0x5b, 0x00, 0x50, 0x00, 0x4b, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x28, 0x00, 0x5d, 0x00, 0x50, 0x00, 0x55, 0x00, 0x13, 0x08, 0x00, 0x00, 0x1f, 0x00, 0x5e,
+    0x00, 0x50, 0x00, 0x5d, 0x00, 0x26, 0x00, 0x00, 0x00, 0x07, 0x00, 0x56, 0x00, 0x50, 0x00, 0x5b,
+    0x00, 0x3f, 0x09, 0x00, 0x00, 0x37, 0x00, 0x5b, 0x00, 0x50, 0x00, 0x54, 0xc2, 0x00, 0x00, 0x4b,
+    0x00, 0x50, 0x00, 0x51, 0x00, 0x50, 0x09, 0x5b, 0x00, 0x5d, 0x00, 0x49, 0x00, 0x0d, 0x01, 0x00,
+    0x00, 0x25, 0x00, 0x5d, 0x00, 0x50, 0x00, 0x57, 0x00, 0x1f, 0x01, 0x00, 0x00, 0x19, 0x08, 0x5b,
+    0x00, 0x5f, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x47, 0x00, 0x5a, 0x06, 0x5b, 0x00, 0x5a,
+    0x00, 0x57, 0x00, 0x12, 0x03, 0x00, 0x00, 0x3e, 0x00, 0x5b, 0x00, 0x50, 0x00, 0x52, 0x00, 0x07,
+    0x03, 0x00, 0x00, 0x0e, 0x01, 0x51, 0x00, 0x5b, 0x00, 0x32, 0x08, 0x00, 0x00, 0x01, 0x00, 0x46,
+    0x00, 0x5b, 0x00, 0x50, 0x00, 0x4b, 0x00, 0x03, 0x00, 0x00, 0x00, 0x28, 0x00, 0x5d, 0x00, 0x50,
+    0x00, 0x55, 0x00, 0x13, 0x08, 0x00, 0x00, 0x1f, 0x00, 0x5e, 0x00, 0x50, 0x00, 0x5d, 0x00, 0x26,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x56, 0x00, 0x50, 0x00, 0x5b, 0x00, 0x3f, 0x09, 0x00, 0x00, 0x37,
+    0x00, 0x5b, 0x00, 0x50, 0x00, 0x54, 0xc2, 0x00, 0x00, 0x1f, 0x00, 0x5e, 0x00, 0x5b, 0x08, 0x5a,
+    0x00, 0x59, 0x01, 0x51, 0x00, 0x5d, 0x00, 0x2b, 0x01, 0x00, 0x00, 0x25, 0x00, 0x5d, 0x00, 0x50,
+    0x00, 0x57, 0x00, 0x1f, 0x01, 0x00, 0x00, 0x19, 0x00, 0x5b, 0x04, 0x5a, 0x00, 0x50, 0x01, 0x51,
+    0x00, 0x5d, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x47, 0x08, 0x5a, 0x00, 0x57, 0x00, 0x12,
+    0x03, 0x00, 0x00, 0x3e, 0x00, 0x5b, 0x00, 0x50, 0x00, 0x52, 0x00, 0x07, 0x03, 0x00, 0x00, 0x0e,
+    0x01, 0x51, 0x00, 0x5b, 0x00, 0x32, 0x08, 0x00, 0x00, 0x01, 0x00, 0x46, 0x00, 0x5b, 0x00, 0x50,
+    0x00, 0x4b, 0x00, 0x03, 0x00, 0x00, 0x00, 0x28, 0x00, 0x5d, 0x00, 0x50, 0x00, 0x55, 0x00, 0x13,
+    0x08, 0x00, 0x00, 0x1f, 0x00, 0x5e, 0x00, 0x50, 0x00, 0x5d, 0x00, 0x26, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x56, 0x00, 0x50, 0x00, 0x5b, 0x00, 0x3f, 0x09, 0x00, 0x00, 0x37, 0x00, 0x5b, 0x00, 0x50,
+    0x00, 0x54, 0xc3, 0x00, 0x00, 0x1d, 0x00, 0x3a, 0x00, 0x43, 0x00, 0x44, 0x06, 0x43, 0x00, 0x44,
+    0x01, 0x51, 0x00, 0x5a, 0x00, 0x3d, 0x00, 0x01, 0x00, 0x00, 0x00, 0x25, 0x00, 0x5d, 0x00, 0x50,
+    0x00, 0x57, 0x00, 0x1f, 0x01, 0x00, 0x00, 0x16, 0x00, 0x49, 0x04, 0x43, 0x00, 0x49, 0x00, 0x54,
+    0x00, 0x51, 0x00, 0x5d, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x38, 0x00, 0x49, 0x07, 0x43,
+    0x00, 0x47, 0x00, 0x10, 0x03, 0x00, 0x00, 0x3e, 0x00, 0x5b, 0x00, 0x50, 0x00, 0x52, 0x00, 0x07,
+    0x03, 0x00, 0x00, 0x0e, 0x01, 0x51, 0x00, 0x5b, 0x00, 0x32, 0x08, 0x00, 0x00, 0x01, 0x00, 0x46,
+    0x00, 0x5b, 0x00, 0x50, 0x00, 0x4b, 0x00, 0x03, 0x00, 0x00, 0x00, 0x28, 0x00, 0x5d, 0x00, 0x50,
+    0x00, 0x55, 0x00, 0x13, 0x08, 0x00, 0x00, 0x1f, 0x00, 0x5e, 0x00, 0x50, 0x00, 0x5d, 0x00, 0x26,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x56, 0x00, 0x50, 0x00, 0x5b, 0x00, 0x3f, 0x09, 0x00, 0x00, 0x37,
+    0x00, 0x5b, 0x00, 0x50, 0x00, 0x54, 0xc5, 0x00, 0x08, 0x08, 0x00, 0x0f, 0x00, 0x43, 0x00, 0x5b,
+    0x00, 0x5a, 0x00, 0x42, 0x00, 0x03, 0x00, 0x00, 0x00, 0x25, 0x00, 0x5d, 0x00, 0x50, 0x00, 0x57,
+    0x00, 0x1f, 0x01, 0x00, 0x00, 0x01, 0x05, 0x08, 0x00, 0x1a, 0x00, 0x55, 0x00, 0x50, 0x00, 0x5d,
+    0x00, 0x2d, 0x01, 0x00, 0x00, 0x04, 0x09, 0x08, 0x04, 0x00, 0x00, 0x3e, 0x00, 0x5b, 0x00, 0x50,
+    0x00, 0x52, 0x00, 0x07, 0x03, 0x00, 0x00, 0x0e, 0x01, 0x51, 0x00, 0x5b, 0x00, 0x32, 0x08, 0x00,
+    0x00, 0x01, 0x00, 0x46, 0x00, 0x5b, 0x00, 0x50, 0x00, 0x4b, 0x00, 0x03, 0x00, 0x00, 0x00, 0x28,
+    0x00, 0x5d, 0x00, 0x50, 0x00, 0x55, 0x00, 0x13, 0x08, 0x00, 0x00, 0x1f, 0x00, 0x5e, 0x00, 0x50,
+    0x00, 0x5d, 0x00, 0x26, 0x00, 0x00, 0x00, 0x07, 0x00, 0x56, 0x00, 0x50, 0x00, 0x5b, 0x00, 0x3f,
+    0x09, 0x00, 0x00, 0x37, 0x00, 0x5b, 0x00, 0x50, 0x00, 0x54, 0xce, 0x00, 0x00, 0x08, 0x00, 0x43,
+    0x00, 0x5b, 0x00, 0x5a, 0x00, 0x3f, 0x00, 0x03, 0x00, 0x00, 0x00, 0x25, 0x00, 0x5d, 0x00, 0x50,
+    0x00, 0x57, 0x00, 0x1f, 0x08, 0x00, 0x00, 0x12, 0x00, 0x55, 0x00, 0x50, 0x00, 0x5d, 0x00, 0x2d,
+    0x11, 0x00, 0x00, 0x3e, 0x00, 0x5b, 0x00, 0x50, 0x00, 0x52, 0x00, 0x07, 0x03, 0x00, 0x00, 0x0e,
+    0x01, 0x51, 0x00, 0x5b, 0x00, 0x32, 0x08, 0x00, 0x00, 0x01, 0x00, 0x46, 0x00, 0x5b, 0x00, 0x50,
+    0x00, 0x4b, 0x00, 0x03, 0x00, 0x00, 0x00, 0x28, 0x00, 0x5d, 0x00, 0x50, 0x00, 0x55, 0x00, 0x13,
+    0x08, 0x00, 0x00, 0x1f, 0x00, 0x5e, 0x00, 0x50, 0x00, 0x5d, 0x00, 0x26, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x56, 0x00, 0x50, 0x00, 0x5b, 0x00, 0x3f, 0x09, 0x00, 0x00, 0x37, 0x00, 0x5b, 0x00, 0x50,
+    0x00, 0x54, 0xce, 0x00, 0x00, 0x06, 0x00, 0x41, 0x00, 0x5b, 0x00, 0x5a, 0x00, 0x3f, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x25, 0x00, 0x5d, 0x00, 0x50, 0x00, 0x55, 0x00, 0x1f, 0x08, 0x00, 0x00, 0x13,
+    0x00, 0x55, 0x00, 0x50, 0x00, 0x5d, 0x00, 0x2d, 0x11, 0x00, 0x00, 0x3e, 0x00, 0x5b, 0x00, 0x50,
+    0x00, 0x55, 0x00, 0x07, 0x03, 0x00, 0x00, 0x0e, 0x01, 0x51, 0x00, 0x5b, 0x00, 0x2c, 0x09, 0x00,
+    0x00, 0x46, 0x00, 0x5b, 0x00, 0x50, 0x00, 0x4b, 0x00, 0x03, 0x00, 0x00, 0x00, 0x28, 0x00, 0x5d,
+    0x00, 0x50, 0x00, 0x55, 0x00, 0x13, 0x08, 0x00, 0x00, 0x1d, 0x00, 0x5e, 0x00, 0x50, 0x00, 0x5d,
+    0x00, 0x26, 0x00, 0x00, 0x00, 0x07, 0x00, 0x56, 0x00, 0x50, 0x00, 0x5b, 0x00, 0x3f, 0x09, 0x00,
+    0x00, 0x37, 0x00, 0x5b, 0x00, 0x50, 0x00, 0x54, 0xc2, 0x00, 0x00, 0x33, 0x00, 0x3e, 0x0a, 0x3c,
+    0x00, 0x4f, 0x00, 0x51, 0x00, 0x5a, 0x00, 0x3f, 0x00, 0x03, 0x00, 0x00, 0x00, 0x25, 0x00, 0x5d,
+    0x00, 0x50, 0x00, 0x54, 0x00, 0x44, 0x00, 0x38, 0x06, 0x3c, 0x00, 0x38, 0x00, 0x3f, 0x00, 0x54,
+    0x00, 0x50, 0x00, 0x5d, 0x00, 0x2d, 0x0d, 0x00, 0x00, 0x11, 0x00, 0x3e, 0x00, 0x3c, 0x00, 0x38,
+    0x00, 0x4d, 0x01, 0x50, 0x00, 0x54, 0x00, 0x3e, 0x00, 0x3c, 0x00, 0x3e, 0x00, 0x23, 0x00, 0x00,
+    0x00, 0x0e, 0x01, 0x51, 0x00, 0x50, 0x00, 0x46, 0x09, 0x38, 0x00, 0x52, 0x00, 0x51, 0x00, 0x50,
+    0x00, 0x4d, 0x00, 0x03, 0x00, 0x00, 0x00, 0x28, 0x00, 0x5d, 0x00, 0x50, 0x00, 0x54, 0x00, 0x3f,
+    0x08, 0x38, 0x00, 0x45, 0x00, 0x54, 0x00, 0x50, 0x00, 0x5d, 0x00, 0x26, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x56, 0x01, 0x50, 0x00, 0x4d, 0x09, 0x38, 0x00, 0x4b, 0x01, 0x50, 0x00, 0x54, 0xc2, 0x00,
+    0x00, 0x48, 0x00, 0x5a, 0x0a, 0x5b, 0x01, 0x51, 0x00, 0x5b, 0x00, 0x31, 0x01, 0x00, 0x00, 0x23,
+    0x00, 0x5d, 0x01, 0x51, 0x00, 0x5a, 0x08, 0x5b, 0x00, 0x5a, 0x01, 0x51, 0x00, 0x5d, 0x00, 0x2d,
+    0x0d, 0x00, 0x00, 0x17, 0x00, 0x5f, 0x01, 0x5b, 0x00, 0x50, 0x01, 0x51, 0x00, 0x50, 0x01, 0x5b,
+    0x00, 0x5f, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x55, 0x00, 0x50, 0x00, 0x51, 0x00, 0x50,
+    0x09, 0x5b, 0x00, 0x50, 0x00, 0x51, 0x00, 0x5a, 0x00, 0x42, 0x00, 0x01, 0x00, 0x00, 0x00, 0x29,
+    0x00, 0x5d, 0x01, 0x51, 0x00, 0x5a, 0x08, 0x5b, 0x00, 0x5a, 0x01, 0x51, 0x00, 0x5d, 0x00, 0x23,
+    0x00, 0x00, 0x00, 0x06, 0x00, 0x49, 0x00, 0x5a, 0x00, 0x51, 0x00, 0x50, 0x09, 0x5b, 0x00, 0x50,
+    0x00, 0x51, 0x00, 0x50, 0x00, 0x58, 0xc2, 0x00, 0x00, 0x47, 0x0c, 0x50, 0x00, 0x59, 0x00, 0x55,
+    0x00, 0x18, 0x01, 0x00, 0x00, 0x0a, 0x00, 0x4b, 0x00, 0x5a, 0x0d, 0x50, 0x00, 0x5d, 0x00, 0x2d,
+    0x0d, 0x00, 0x00, 0x15, 0x00, 0x5d, 0x07, 0x50, 0x00, 0x5b, 0x00, 0x29, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x34, 0x00, 0x5d, 0x0d, 0x50, 0x00, 0x5d, 0x00, 0x22, 0x01, 0x00, 0x00, 0x10, 0x00, 0x52,
+    0x00, 0x59, 0x0c, 0x50, 0x00, 0x5a, 0x00, 0x4b, 0x00, 0x0c, 0x01, 0x00, 0x00, 0x27, 0x00, 0x5f,
+    0x0d, 0x50, 0x00, 0x5f, 0x00, 0x32, 0xc2, 0x00, 0x00, 0x47, 0x00, 0x5b, 0x0a, 0x54, 0x00, 0x55,
+    0x00, 0x4c, 0x00, 0x1c, 0x03, 0x00, 0x00, 0x14, 0x00, 0x47, 0x00, 0x57, 0x0c, 0x54, 0x00, 0x5e,
+    0x00, 0x2d, 0x0d, 0x00, 0x00, 0x15, 0x00, 0x5e, 0x07, 0x54, 0x00, 0x5d, 0x00, 0x2b, 0x01, 0x00,
+    0x00, 0x07, 0x00, 0x36, 0x00, 0x58, 0x0b, 0x54, 0x00, 0x56, 0x00, 0x29, 0x00, 0x03, 0x02, 0x00,
+    0x00, 0x1b, 0x00, 0x4c, 0x00, 0x57, 0x0a, 0x54, 0x00, 0x57, 0x00, 0x47, 0x00, 0x15, 0x02, 0x00,
+    0x00, 0x06, 0x00, 0x30, 0x00, 0x58, 0x0b, 0x54, 0x00, 0x58, 0x00, 0x32, 0x00, 0x05, 0xff, 0x00,
+    0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
+    0x76, 0x00,
 #endif /* GNW_TARGET_ZELDA */
 };
@@ -1,73 +1,643 @@
+// Packed bitmap, see bitmaps.h. Generated by tools/img2bin.py --lut8-rle
 #if !defined(GNW_TARGET_ZELDA)
 #define GNW_TARGET_ZELDA 0
 #endif /* GNW_TARGET_ZELDA */
 
-const unsigned short header_sms[] = {
+const unsigned char header_sms[] __attribute__((aligned(4))) = {
 #if GNW_TARGET_ZELDA != 0
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x3BA3,0x8405,0xA467,0xA468,0xA468,0xA468,0xA468,0xA468,0xA468,0xAC88,0x8C68,0x0320,0x0320,0x0320,0x2B82,0x7C05,0xA467,0xA468,0xA468,0xA468,0xA468,0xA468,0xA468,0xA468,0xAC88,0x43A3,0x0320,0x0320,0x1341,0x6405,0x9C46,0xAC68,0xA468,0xA468,0xA468,0xA468,0xA468,0xA468,0xAC88,0x53E5,0x0320,0x0320,0x0320,0x0320,0x0320,0x4BC3,0xB488,0xDC88,0xD488,0x9C47,0x2B82,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x94A9,0x9C68,0x9467,0x9467,0x9467,0x9468,0x1B61,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x43E5,0x9C88,0x9467,0x9467,0x9C68,0xA4A9,0x43C4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x33A3,0x9C67,0xD4A9,0xCC46,0xD489,0xB488,0x4BC3,0x3383,0x8467,0x0B41,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1341,0x8C26,0xD467,0xDC87,0xDC67,0xDC66,0xDC66,0xDC66,0xDC66,0xDC66,0xDC66,0xE486,0xBC88,0x0B41,0x0320,0x5BE4,0xCC67,0xDC87,0xDC87,0xDC66,0xDC66,0xDC66,0xDC66,0xDC66,0xDC66,0xDC66,0xE4A7,0x53C3,0x0320,0x33A3,0xB467,0xDC87,0xDC87,0xDC66,0xDC66,0xDC66,0xDC66,0xDC66,0xDC66,0xDC66,0xE487,0x6C06,0x0320,0x0320,0x0320,0x0320,0x4BC4,0xDC88,0xDC66,0xD447,0xD447,0xDC67,0xC467,0x2382,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x5C06,0x8C26,0xD467,0xDC66,0xDC66,0xDC87,0x6C26,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x8C47,0xE487,0xDC66,0xDC87,0xA426,0x6C26,0x2382,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1361,0x23A3,0x1B82,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x53E4,0xD487,0xAC67,0x3BC4,0x1B41,0x3BC4,0x9426,0xDC88,0xD467,0xC467,0x1382,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1B82,0x23A3,0x1361,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x9446,0xDC87,0xDC67,0xC447,0xAC47,0xAC67,0xAC67,0xAC67,0xAC67,0xAC67,0xAC67,0xAC67,0x8C47,0x0320,0x3BA3,0xD467,0xDC66,0xCC47,0xAC47,0xA468,0xA468,0xA468,0xA468,0xA468,0xA468,0xA468,0xAC88,0x3BA3,0x1341,0xBC67,0xDC67,0xD467,0xB447,0xA468,0xA468,0xA468,0xA468,0xA468,0xA468,0xA468,0xAC88,0x4BE5,0x0320,0x0320,0x0320,0x0B41,0xBC67,0xDC67,0xBC67,0x5C05,0x6C05,0xCC67,0xDC87,0x8426,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x7C26,0xD4A9,0xC4A9,0xDC66,0xAC67,0x0B40,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1361,0xB488,0xD4A9,0xD447,0xC467,0x23A3,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x7C05,0xD487,0x9C68,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x2B83,0xCC88,0xC488,0x1361,0x0320,0x0320,0x0320,0x0320,0x8C26,0xE487,0xBC68,0x1B82,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x9C68,0xD487,0x8468,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x5BE4,0xDC87,0xDC67,0xA447,0x6406,0x9447,0x9C47,0x9C47,0x9C47,0x9C47,0x9C47,0x9C47,0x9C67,0x7C26,0x0340,0xA447,0xDC67,0xCC67,0x6C26,0x8C46,0x9C47,0x9C47,0x9C47,0x9C47,0x9C47,0x9C47,0x9C47,0xA467,0x33A3,0x5BE5,0xDC87,0xD467,0x8426,0x7426,0x9C47,0x9C47,0x9C47,0x9C47,0x9C47,0x9C47,0x9C47,0x9C67,0x43C4,0x0320,0x0320,0x0320,0x3BA3,0xD467,0xDC67,0x7426,0xB447,0x8C26,0x9426,0xDC67,0xC468,0x1341,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x4BE5,0xC4CA,0x7C47,0xDC67,0xD488,0x3BC3,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x4BC4,0xBC68,0x9489,0xDC67,0xC447,0x1B82,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x8405,0xE487,0xA488,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x7406,0xE4A7,0x8405,0x0320,0x0320,0x0320,0x0320,0x0320,0x1B62,0xC467,0xC488,0x1B83,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xAC68,0xE487,0x8C68,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xAC68,0xDC66,0xBC47,0x6C26,0xD467,0xDC67,0xE487,0xDC87,0xDC87,0xDC87,0xDC87,0xDC87,0xE487,0xB468,0x23A3,0xCC68,0xDC67,0x8447,0xA447,0xDC87,0xDC67,0xDC87,0xDC87,0xDC87,0xDC87,0xDC87,0xDC87,0xE4A7,0x53C4,0x9C47,0xDC67,0xB447,0x7406,0xDC87,0xDC67,0xDC87,0xDC87,0xDC87,0xDC87,0xDC87,0xDC87,0xE4A7,0x6C06,0x0320,0x0320,0x0320,0x8426,0xDC87,0xC447,0x6C26,0xDC67,0xC447,0x6C06,0xD467,0xDC67,0x4BC4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x4BE5,0xCCA9,0x3BC4,0xC467,0xDC87,0x8C47,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x9C47,0x7426,0x8426,0xDC87,0xC447,0x1B82,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x7C05,0xE487,0x9C88,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xA488,0xDC66,0xA447,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x8447,0xCC88,0x1B82,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xA468,0xE487,0x8C68,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xD489,0xDC66,0x7C26,0x9C26,0xDC67,0xC447,0x9405,0x9C05,0x9C05,0x9C26,0xAC46,0xAC47,0xB447,0x8C47,0x2BA3,0xD488,0xDC67,0x6C26,0xB425,0xDC67,0xC447,0x9405,0x9C05,0x9C05,0x9C05,0x9C05,0x9C26,0xB467,0x43A3,0xA447,0xDC87,0x8C26,0x7C05,0xDC67,0xD467,0xA426,0x9405,0x9C05,0x9C05,0x9C05,0x9C05,0x9C25,0x4BC4,0x0320,0x0320,0x0B41,0xBC67,0xDC67,0x9C46,0x8C26,0xDC67,0xDC67,0x6C06,0xC447,0xDC87,0x8C26,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x4BE5,0xD4C9,0x1B61,0x9C67,0xDC66,0xC488,0x1B62,0x0320,0x0320,0x0320,0x0320,0x2382,0xC489,0x2B83,0x8406,0xDC87,0xC447,0x1B82,0x0320,0x0320,0x0320,0x3BA3,0x8447,0xAC89,0xACA9,0x8C67,0x3BA3,0x0320,0x0320,0x0320,0x1361,0x6C05,0xACA9,0xACA9,0x8447,0x5BE5,0x9C68,0x53C4,0xA426,0xDC67,0xB468,0x53C4,0x53C3,0x53A3,0x0B41,0x0320,0x53C4,0x9C88,0xB489,0xA488,0x5BE4,0x0B41,0x3BA3,0x53C3,0x53C4,0x6C05,0x3BC4,0x0320,0x4BC4,0x9C68,0x8447,0x1B61,0x0320,0x0320,0x8C47,0xDC66,0xD487,0x43C4,0x0320,0x0320,0x0320,0x0320,0x0320,0x3BA3,0xDCA9,0x6405,0x53A3,0x53C4,0x5BC4,0x2361,0x0320,0x0320,0x4BC4,0x5BC3,0x53C4,0x53C4,0x53C3,0x7426,0xACA9,0xACA9,0x7C26,0x6406,0x9C67,0x53C3,0xB468,0xDC67,0xAC88,0x53C4,0x53C3,0x4BA3,0x0340,0x1341,0x63E5,0xA489,0xAC89,0x9C68,0x53C4,0x0B41,0x4BA3,0x53A3,0x5BC4,0x6C26,0x2BA3,0x0320,0x4BC3,0x9C68,0xAC89,0x7C46,0x2382,0x0320,0x0320,0x3382,0x8446,0xAC89,0x9468,0x43C4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xD488,0xDC66,0x7406,0xA426,0xDC67,0xBC67,0x6C05,0x7426,0x6BE5,0x63E5,0x23A3,0x0320,0x0320,0x0320,0x2B82,0xD488,0xDC67,0x6C06,0xB425,0xDC67,0xB467,0x7426,0x7C26,0x7C26,0x7C26,0x7C46,0x5405,0x0340,0x0320,0xAC67,0xDC87,0x9426,0x7C05,0xE487,0xB467,0x5C05,0x7C26,0x7C26,0x7C26,0x7C26,0x7C26,0x8446,0x3BC4,0x0320,0x0320,0x43C4,0xDC67,0xDC67,0x7426,0xBC47,0xD467,0xDC67,0x9426,0x9426,0xDC87,0xBC67,0x1361,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x4BE5,0xD4C9,0x1341,0x4BE4,0xDC88,0xDC87,0x5C05,0x0320,0x0320,0x0320,0x0320,0x7426,0xAC68,0x0320,0x8426,0xDC87,0xC447,0x1B82,0x0320,0x0B40,0x7C05,0xD4A9,0x7C26,0x33A3,0x6405,0xD488,0xDC87,0x63E5,0x0320,0x1B62,0xB467,0xBC88,0x5C05,0x4BE5,0x9447,0xDCA8,0xDC87,0xC4A9,0xCC68,0xD446,0xD488,0xC4A9,0xCCA9,0xBCA9,0x3BE5,0xA467,0xCC88,0x7426,0x3BA3,0x8447,0xDC88,0xA446,0x7C47,0xC488,0xE4A7,0xDC87,0x8468,0x8C47,0xBC88,0xD467,0xE487,0x7C27,0x0320,0x0320,0x63E5,0xDC87,0xD447,0xCC67,0x6C05,0x1B62,0x0320,0x0320,0x0320,0x1B62,0x9446,0xDCA8,0xDC87,0xDC88,0xA447,0x3382,0x0320,0x0320,0x6C05,0xC487,0xE4A7,0xDCA8,0xE4A8,0xAC88,0x53E5,0x5405,0xA467,0xDCA8,0xDC87,0xC4A9,0xD468,0xD446,0xCC88,0xC4A9,0xCCA9,0xAC89,0x4405,0xB467,0xC488,0x6405,0x43C4,0x9447,0xDC88,0x9426,0x8C68,0xCC88,0xE487,0xE487,0x6C68,0x8426,0xC4A9,0xAC67,0xD468,0xE487,0xBC67,0x2382,0x5BC4,0xCCA9,0xAC67,0xCC88,0xDC87,0xD488,0x53E5,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xB488,0xDC66,0xAC47,0x7426,0xDC67,0xDC66,0xDC67,0xDC66,0xDC67,0xDC87,0xC467,0x5BE4,0x0320,0x0320,0x2B82,0xD488,0xDC67,0x6C06,0xB405,0xDC66,0xDC46,0xDC66,0xDC66,0xDC66,0xDC66,0xE487,0x9447,0x0320,0x0320,0xAC67,0xDC87,0x9426,0x7C05,0xE487,0xAC68,0x9447,0xE487,0xDC66,0xDC66,0xDC66,0xDC67,0xE487,0x6C06,0x0320,0x0320,0x8426,0xDC67,0xC447,0x6C26,0xD467,0xD447,0xD446,0xC447,0x6C06,0xD467,0xDC67,0x4BC4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x4BE5,0xD4C9,0x1B41,0x1362,0xC468,0xDC67,0xA467,0x0320,0x0320,0x0320,0x0B40,0xB468,0x5BE5,0x0320,0x8426,0xDC87,0xC447,0x1B82,0x0320,0x5BE5,0xE4A7,0xCC68,0x1361,0x0320,0x0320,0x6405,0xE487,0xCC88,0x1362,0x8C26,0xDCA9,0x33C4,0x0320,0x0320,0x0320,0x7C26,0xCC68,0x33E5,0x8406,0xDC87,0xA488,0x1382,0x1362,0x1B83,0xA468,0xDCA8,0x4BE4,0x0320,0x0320,0x0320,0x8447,0xE4A7,0x8C26,0x23A3,0xBC67,0xD446,0xC468,0x7426,0x23A3,0xCCA9,0xDC66,0x9C68,0x0320,0x0320,0x1341,0xAC47,0xDC87,0xD446,0xDC87,0xC467,0x8447,0x3BA3,0x0320,0x0320,0x0320,0x7426,0xDC87,0xCC68,0x2BA3,0x0320,0x0320,0x0320,0x0320,0x43E5,0xD4A9,0xCCA9,0xC488,0x1362,0x0320,0x0320,0x0320,0x9447,0xCCA9,0x23A3,0xAC47,0xDC87,0x9488,0x1362,0x1362,0x2BA3,0xB468,0xD468,0x2BA3,0x0320,0x0320,0x0320,0xA447,0xE4A7,0x6C05,0x3BC4,0xCC67,0xD447,0xC4A9,0x6C06,0x1361,0x0340,0x43C4,0xCC67,0xDC66,0xC488,0x8C26,0x2362,0x0340,0x2383,0xB467,0xDC66,0xB468,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x6C05,0xDC87,0xD467,0x9447,0x7426,0xAC67,0xB468,0xB468,0xBC47,0xD447,0xDC67,0xDC87,0x63E5,0x0320,0x2B82,0xD488,0xDC67,0x6C26,0x9446,0xB488,0xB468,0xB468,0xB468,0xB468,0xB468,0xBC88,0x7426,0x0320,0x0320,0xAC67,0xDC87,0x9426,0x7C05,0xE487,0xB467,0x7C26,0xBC88,0xB468,0xB468,0xBC68,0xD467,0xDC67,0x6405,0x0320,0x1341,0xBC67,0xDC67,0x9426,0x8C26,0xDC67,0xD446,0xD447,0xDC67,0x6C06,0xBC47,0xDC67,0x8C46,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x4BE5,0xD4C9,0x1B61,0x0320,0x8C47,0xDC67,0xD488,0x2BA3,0x0320,0x0320,0x3BA3,0xBC88,0x1362,0x0320,0x8426,0xDC87,0xC447,0x1B82,0x0320,0x7405,0xE4A8,0xD467,0x2382,0x0320,0x0320,0x33C4,0xD488,0xDC87,0x33A3,0xAC26,0xDCA8,0x2BA3,0x0320,0x0320,0x0320,0x1361,0xBCA9,0x33C4,0x7BE5,0xE487,0xA488,0x0320,0x0320,0x53E4,0xE4A7,0xA447,0x0320,0x0320,0x0320,0x0320,0x3BA3,0xDC88,0xD488,0x2BA3,0x9C05,0xDC67,0x9467,0x0320,0x0320,0x7405,0xAC67,0x3BA3,0x0320,0x0320,0x0320,0x1B62,0xA467,0xDC87,0xDC67,0xDC66,0xDC67,0xD488,0xA467,0x3BA3,0x0320,0x1361,0xC488,0xDC67,0x7426,0x0320,0x0320,0x0320,0x0320,0x7C26,0xACA9,0xC488,0xC488,0x0B61,0x0320,0x0320,0x0320,0x2B83,0xC4CA,0x1B82,0xA446,0xE487,0x9468,0x0320,0x0320,0x7426,0xE487,0x8447,0x0320,0x0320,0x0320,0x0320,0x6406,0xDC87,0xC488,0x1341,0xBC47,0xDC87,0x8447,0x0320,0x0320,0x0320,0x0320,0xA467,0xDC87,0xBC67,0x0320,0x0320,0x0320,0x0320,0x6426,0xDC87,0xC447,0x1B82,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1341,0xAC47,0xDC67,0xDC67,0xA446,0x8426,0x8C47,0x8C26,0x7C26,0x6C05,0xC467,0xDC67,0xD467,0x2B82,0x2382,0xD488,0xDC67,0x6C26,0x7405,0x8C47,0x8C26,0x8C26,0x8C26,0x8C26,0x8C27,0x8C46,0x5BE5,0x0320,0x0320,0xAC67,0xDC87,0x9426,0x7C05,0xE487,0xB467,0x5C05,0x9446,0x8C26,0x8C26,0x6406,0xCC68,0xDC67,0x6405,0x0320,0x43C4,0xDC87,0xDC67,0x6C26,0xBC47,0xD447,0xD467,0xD467,0xDC67,0x9426,0x8C26,0xDC67,0xC467,0x1361,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x4BE5,0xD4C9,0x1B61,0x0320,0x3BC4,0xD488,0xDC67,0x7C26,0x0320,0x0320,0x9447,0x8446,0x0320,0x0320,0x8426,0xDC87,0xC447,0x1B82,0x0320,0x1B61,0x8467,0x5405,0x0320,0x0320,0x0320,0x33C4,0xD488,0xDC67,0x2B82,0xA426,0xE487,0xA447,0x33A3,0x0320,0x0320,0x0320,0x1B61,0x0B40,0x8405,0xE487,0xA488,0x0320,0x0320,0xA468,0xE4A7,0x7C26,0x0320,0x0320,0x0320,0x0320,0x2BA3,0xD488,0xDC87,0x3B82,0x9405,0xDC67,0x7C47,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0340,0x43C4,0x9C47,0xD488,0xDC67,0xDC67,0xDC67,0xD487,0x63E5,0x0320,0x8447,0xDC67,0xBC67,0x1361,0x0320,0x0320,0x0B41,0xB488,0x4BE4,0xC467,0xDC67,0x8C26,0x2BA3,0x0320,0x0320,0x0320,0x2361,0x0320,0xAC47,0xE487,0x9468,0x0320,0x1362,0xBC68,0xDC87,0x4BC3,0x0320,0x0320,0x0320,0x0320,0x4C05,0xD467,0xD447,0x2BA3,0xBC47,0xDC87,0x6426,0x0320,0x0320,0x0320,0x0320,0x9488,0xE487,0xA447,0x0320,0x0320,0x0320,0x0320,0x4BE5,0xD467,0xCC67,0x2BA3,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x2382,0xAC47,0xDC87,0xDC87,0xE487,0xE487,0xE487,0xDC87,0xBC47,0x6C26,0xCC67,0xDC87,0x7C05,0x2382,0xD488,0xDC67,0x6C06,0xBC26,0xDC87,0xDC87,0xE487,0xE487,0xE487,0xE487,0xE4A7,0x9467,0x0320,0x0320,0xAC67,0xDC87,0x9426,0x7C05,0xE487,0xAC67,0x9C47,0xE4A7,0xDC67,0xDC87,0x8447,0xC467,0xDC67,0x6405,0x0320,0x8C26,0xDC87,0xC447,0x6C26,0xDC67,0xDC67,0x8C47,0xAC67,0xDC66,0xC447,0x6C06,0xD467,0xDC67,0x4BC4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x4BE5,0xD4C9,0x1B61,0x0320,0x0B40,0xB468,0xDC67,0xBC68,0x0B41,0x1B61,0xC4A9,0x33A3,0x0320,0x0320,0x8426,0xDC87,0xC447,0x1B82,0x0320,0x0320,0x0320,0x0320,0x0320,0x3382,0x7426,0xBC88,0xD467,0xDC67,0x2B82,0x6406,0xDC87,0xDC67,0xD488,0xAC47,0x6C06,0x2382,0x0320,0x0320,0x8405,0xE487,0xA488,0x0320,0x0B40,0xC468,0xDC67,0xC467,0xAC26,0xAC26,0xAC26,0xAC26,0xB447,0xDC67,0xE487,0x43A3,0x93E4,0xDC87,0x8447,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x2382,0x7426,0xBC67,0xDC67,0xD446,0xD488,0x3383,0x2BA3,0xD488,0xD467,0x53E4,0x0320,0x0320,0x53E4,0xAC68,0x0320,0x7C26,0xDC87,0xDC67,0xCC68,0xA447,0x5C05,0x1B62,0x0320,0x0320,0xAC47,0xE487,0x9468,0x0320,0x2B82,0xD488,0xD447,0xBC46,0xAC26,0xAC26,0xAC26,0xAC26,0xBC47,0xDC67,0xDC67,0x43E5,0xBC47,0xDC87,0x6C27,0x0320,0x0320,0x0320,0x0320,0x9488,0xE487,0xA447,0x0320,0x0320,0x0320,0x0320,0x4BE5,0xD467,0xCC67,0x2BA3,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0B41,0x5BE5,0xA447,0xAC25,0xAC25,0xAC25,0xCC47,0xDC87,0x8426,0xA447,0xDC67,0xA467,0x2BA3,0xD488,0xDC67,0x6C06,0xB425,0xDC67,0xC446,0xAC05,0xAC25,0xAC25,0xAC25,0xB426,0x7426,0x0320,0x0320,0xAC67,0xDC87,0x9426,0x7C05,0xE487,0xAC67,0x7405,0xBC46,0xD447,0xDC67,0x7C47,0xCC67,0xDC67,0x6405,0x0B41,0xC467,0xDC67,0x9426,0x9426,0xDC67,0xD467,0x33A3,0x7405,0xDC67,0xDC67,0x6C26,0xBC47,0xDC87,0x9426,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x4BE5,0xD4C9,0x1B61,0x0320,0x0320,0x6C26,0xDC87,0xDC87,0x3BC4,0x5C05,0xAC68,0x0320,0x0320,0x0320,0x8426,0xDC87,0xC447,0x1B82,0x0320,0x0320,0x1361,0x6C06,0xB467,0xBC88,0x7C26,0x5C06,0xCC67,0xDC87,0x3382,0x0320,0x6C06,0xCC68,0xDC87,0xE487,0xDC87,0xC488,0x5BE4,0x0320,0x8405,0xE487,0xA488,0x0320,0x1B62,0xCC47,0xDC87,0x9447,0x4382,0x4BC3,0x4BA3,0x4BA3,0x43A3,0x43A3,0x43C3,0x1341,0x9C05,0xDC67,0x8447,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1361,0x3BA3,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1361,0x9C47,0xDC67,0xDC67,0x8C68,0x0320,0xA447,0xDC66,0xA467,0x0320,0x0320,0x9C68,0x5C05,0x0320,0x0B41,0x7C26,0xD488,0xDC87,0xE487,0xDC87,0xC467,0x4BC4,0x0320,0xAC47,0xE487,0x9468,0x0320,0x3382,0xDC88,0xD467,0x7405,0x4383,0x4BA3,0x4BA3,0x4BA3,0x43A3,0x43A3,0x43A3,0x1B62,0xBC47,0xDC87,0x6C27,0x0320,0x0320,0x0320,0x0320,0x9488,0xE487,0xA447,0x0320,0x0320,0x0320,0x0320,0x4BE5,0xD467,0xCC67,0x23A3,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x7C47,0x7C26,0x7426,0x7426,0x7426,0x6C06,0x6C06,0x6C06,0xC447,0xDC87,0x9426,0x9447,0xDC67,0xB468,0x33A3,0xD488,0xDC67,0x6C06,0xB425,0xDC67,0xB467,0x6C06,0x6C26,0x6C26,0x6C26,0x6C26,0x7426,0x8447,0x2B82,0xA447,0xDC87,0x8C26,0x7C05,0xDC67,0xCC67,0x7406,0x7C26,0xD467,0xDC67,0x7C47,0xCC67,0xDC67,0x5C05,0x43C4,0xDC87,0xD467,0x6C06,0xC447,0xD446,0xD468,0xA426,0xB447,0xD447,0xDC67,0x9C26,0x8C26,0xDC67,0xC467,0x1361,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x4BE5,0xD4CA,0x1B61,0x0320,0x0320,0x2BA3,0xD488,0xDC67,0x9488,0xAC67,0x5BE5,0x0320,0x0320,0x0320,0x8426,0xDC87,0xC447,0x1B82,0x0320,0x33A3,0xBC67,0xE4A8,0x7C26,0x1361,0x0320,0x33C4,0xD488,0xDC88,0x2B82,0x0320,0x0320,0x2382,0x6405,0xAC47,0xD467,0xDC67,0xD467,0x43C4,0x7BE4,0xE487,0xA488,0x0320,0x1341,0xC467,0xDC87,0x7C26,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xA426,0xDC67,0x8447,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x3BE4,0xCC88,0x2382,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x2382,0xCC68,0xDC67,0xA467,0x0320,0x53E5,0xDC87,0xCC67,0x33A3,0x2382,0xBC88,0x1341,0x0320,0x0320,0x0320,0x2B82,0x6C26,0xAC67,0xD467,0xDC66,0xD487,0x2B82,0xA446,0xE487,0x9468,0x0320,0x3382,0xDC88,0xDC67,0x4BC3,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0B20,0xC467,0xDC87,0x6C27,0x0320,0x0320,0x0320,0x0320,0x9488,0xE487,0xA447,0x0320,0x0320,0x0320,0x0320,0x4BE5,0xD467,0xCC67,0x23A3,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xDCA8,0xDC66,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0x6C06,0xBC47,0xDC87,0x9426,0x23A3,0xCC88,0xDC67,0x7C26,0xAC26,0xDC67,0xD446,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xE4A7,0x4BA3,0x9C47,0xDC67,0x9C47,0x7C06,0xDC87,0xD446,0xDC67,0xDC66,0xD446,0xDC67,0x7C47,0xCC67,0xDC67,0x6405,0x8426,0xDC67,0xBC47,0x6C06,0xD467,0xD446,0xB4A9,0xD488,0xDC66,0xD446,0xD446,0xC447,0x6C06,0xD467,0xDC87,0x4BC4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x4BE5,0xD4A9,0x1B41,0x0320,0x0320,0x0320,0xA467,0xDC67,0xDC88,0xBC88,0x1362,0x0320,0x0320,0x0320,0x8426,0xDC87,0xC447,0x1B82,0x0B20,0xB468,0xE487,0x9446,0x0320,0x0320,0x0320,0x3BC4,0xD488,0xD467,0x53E5,0x6426,0x0320,0x0320,0x0320,0x0320,0x3BC3,0xB467,0xDC66,0x9468,0x7BE5,0xDC87,0xA488,0x0320,0x0320,0xB489,0xDC66,0x9C47,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xA426,0xDC67,0x8447,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x2BC4,0xD467,0x7426,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xA447,0xE487,0xA468,0x0320,0x1361,0xBC68,0xDC67,0x7426,0x7C26,0x7C26,0x0320,0x43E4,0x5405,0x0320,0x0320,0x0320,0x0320,0x43C4,0xBC67,0xDC87,0x8447,0x9C47,0xE487,0x9488,0x0320,0x2382,0xC488,0xDC46,0x7C27,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xC467,0xDC87,0x6C27,0x0320,0x0320,0x0320,0x0320,0x9488,0xE487,0xA447,0x0320,0x0320,0x0320,0x0320,0x4BE5,0xD467,0xCC67,0x23A3,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xBC88,0xBC68,0xBC68,0xBC68,0xBC68,0xBC68,0xBC68,0xBC68,0xB467,0x6BE5,0x8C26,0xDC67,0xDC87,0x53C4,0x0320,0xB447,0xDC67,0xB447,0x6C26,0xB447,0xC488,0xBC68,0xBC68,0xBC68,0xBC68,0xBC68,0xBC68,0xC4A8,0x3BA3,0x7406,0xDC87,0xD467,0x7447,0x9C47,0xC488,0xBC68,0xBC68,0xBC68,0xC488,0x6C26,0xCC68,0xDC67,0x6405,0xB447,0xDC67,0x8C26,0x9426,0xDC67,0xD467,0x7426,0xC488,0xC468,0xC468,0xC468,0xC488,0x6406,0xB447,0xDC87,0x9446,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x53E5,0xDCA8,0x2B82,0x0320,0x0320,0x0320,0x53E4,0xDC87,0xDC67,0x7C26,0x0320,0x0320,0x0320,0x0320,0x8426,0xDC87,0xC447,0x1B82,0x1B62,0xCC67,0xDC87,0x6C26,0x0320,0x0320,0x0320,0x3BC4,0xD488,0xD468,0x6C26,0xCCA9,0x2B82,0x0320,0x0320,0x0320,0x0320,0x3BA3,0xDC67,0x9C68,0x8405,0xDC87,0xAC88,0x0320,0x0320,0x7426,0xDC87,0xCC88,0x2B82,0x0320,0x0320,0x0320,0x0320,0x0320,0x5BE5,0x43C4,0x9C05,0xDC67,0x8447,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x2BA3,0xCC47,0xC488,0x2382,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xA447,0xE4A7,0x6426,0x0320,0x0320,0x7C26,0xDC67,0xCC88,0xBC88,0x2BA3,0x0320,0x6C26,0xC4A9,0x1361,0x0320,0x0320,0x0320,0x0320,0x5BE5,0xE4C8,0x8C47,0x9C47,0xE487,0x9C68,0x0320,0x0320,0x9447,0xDC67,0xBC68,0x1361,0x0320,0x0320,0x0320,0x0320,0x0320,0x6406,0x43E4,0xBC47,0xDC87,0x6426,0x0320,0x0320,0x0320,0x0320,0x9488,0xE487,0xA447,0x0320,0x0320,0x0320,0x0320,0x4BE5,0xD467,0xCC67,0x23A3,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x7C26,0x7C26,0x7C26,0x7C26,0x7C26,0x7C26,0x7C26,0x7C26,0x7405,0xAC46,0xDC67,0xDC67,0xAC67,0x0B41,0x0320,0x6405,0xDC87,0xDC67,0xB447,0x7405,0x7C26,0x7C26,0x7C26,0x7C26,0x7C26,0x7C26,0x7C26,0x8426,0x2B82,0x2382,0xCC67,0xDC66,0xCC67,0x7C05,0x7C26,0x7C26,0x7C26,0x7C26,0x7C26,0x7C26,0xD467,0xD447,0xACA9,0xD467,0xDC67,0x6C06,0xC447,0xDC67,0xB447,0x2BA3,0x8426,0x7C26,0x7C26,0x7C26,0x8426,0x7405,0xB447,0xDC67,0xC467,0x1B62,0x0320,0x0320,0x0320,0x0320,0x0320,0x7C06,0xE487,0x7447,0x0320,0x0320,0x0320,0x1B62,0xC467,0xD488,0x2BA3,0x0320,0x0320,0x0320,0x0320,0x9426,0xDC67,0xCC67,0x23A3,0x1B61,0xCC67,0xDC87,0x8426,0x0320,0x0320,0x0B40,0x7C26,0xDC67,0xD467,0x6426,0xD488,0x9446,0x0B20,0x0320,0x0320,0x0320,0x3BA3,0xDC87,0x6405,0x73E5,0xDC87,0xC488,0x1B82,0x0320,0x1B62,0xC488,0xDC67,0xA467,0x1B62,0x0320,0x0320,0x0320,0x3BA3,0xCCA9,0x43C4,0x9C05,0xDC67,0x8447,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x2382,0xCC47,0xDC67,0xAC68,0x1B62,0x0320,0x0320,0x0320,0x0320,0x33A3,0xCC87,0xBC67,0x1361,0x0320,0x0320,0x2B83,0xCC88,0xDC66,0x9447,0x0320,0x0320,0x5C26,0xDCA8,0x7C26,0x0320,0x0320,0x0320,0x0320,0x5BE4,0xE4C8,0x5405,0xA447,0xDC87,0xB467,0x0B41,0x0320,0x33A3,0xD488,0xDC67,0x8C47,0x0B41,0x0320,0x0320,0x0320,0x53E5,0xC488,0x33A3,0xBC47,0xDC87,0x6C26,0x0320,0x0320,0x0320,0x0320,0x9468,0xE487,0xA447,0x0320,0x0320,0x0320,0x0320,0x4C05,0xD467,0xCC67,0x2BA3,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xDC88,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC66,0xDC87,0xAC67,0x1B61,0x0320,0x0320,0x0320,0x8C26,0xDC87,0xDC66,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xE4A8,0x4BA3,0x0320,0x53E4,0xD467,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xD447,0xD447,0xD467,0xD446,0xBC47,0x6C06,0xDC67,0xDC87,0x7405,0x33A3,0xE4A8,0xDC67,0xDC67,0xDC67,0xDC67,0xDC87,0xD467,0xD447,0xDC67,0x53E4,0x0320,0x0320,0x0320,0x5405,0x8426,0xD467,0xD446,0xD467,0x9446,0x5406,0x0320,0x0320,0x9447,0xAC68,0x0320,0x0320,0x1361,0x5405,0x8447,0xCC67,0xD446,0xD467,0xAC47,0x5C06,0xAC89,0xDC46,0xD467,0x8C47,0x7447,0xA467,0x8C47,0xBC47,0xDC46,0xB488,0xD467,0xDCA8,0x9C26,0x3383,0x2382,0x3382,0xB488,0xB467,0x1341,0x5C05,0xDC88,0xD467,0xB447,0x8C26,0x8C05,0x8488,0xBC47,0xDC87,0xB447,0x7C47,0x6C47,0x8C26,0xC488,0x7406,0x53E4,0xCC67,0xD446,0xC468,0x6406,0x2B83,0x0320,0x0320,0x0320,0x0320,0x1B62,0xCC47,0xC467,0xD467,0xBC67,0x5C05,0x2361,0x2361,0x53E4,0xC488,0xBC67,0x33A3,0x0320,0x0320,0x0320,0x0320,0x9C47,0xDC87,0x43C4,0x0320,0x0320,0x5C26,0xDC88,0xD487,0x8426,0x2B82,0x2382,0x43A3,0xC488,0x9C47,0x0B40,0x7427,0xDC87,0xD467,0xA446,0x8C26,0x9426,0x7C47,0xCC47,0xDC87,0xAC47,0x7C47,0x6C47,0x9446,0xC488,0x5C05,0x6405,0xD467,0xDC66,0xBC67,0x53E5,0x0B20,0x0B20,0x4BE4,0xC468,0xDC66,0xCC67,0x6C06,0x1B61,0x0320,0x3BC4,0x9C67,0xDC67,0xD447,0x9C67,0x3BC4,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0xD488,0xD446,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD467,0xC488,0x6C05,0x0B41,0x0320,0x0320,0x0320,0x0320,0x0320,0x63E4,0xC488,0xD467,0xD446,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC87,0x4BA3,0x0320,0x0320,0x3BA3,0xAC67,0xD468,0xD446,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xDC67,0x8C26,0x9C26,0xDC67,0xD467,0x33A3,0x3382,0xDC88,0xD446,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC67,0x9C47,0x0320,0x0320,0x0320,0xA4A9,0xA489,0x9C88,0x9C88,0x9C88,0xA488,0x9C89,0x1361,0x0320,0x2362,0x33A3,0x0320,0x0320,0x33C4,0xACA9,0xA489,0xA488,0x9C88,0x9C88,0xA488,0xACA9,0x5C26,0x8426,0xBC46,0xC447,0xB468,0x53E4,0x0320,0x4BE4,0xB467,0xBC47,0xA468,0x4BE5,0x9447,0xBC67,0xBC88,0xB447,0x7C26,0x1B61,0x0320,0x0B20,0x7C26,0xBC47,0xBC47,0xB488,0x7405,0x1B62,0x2362,0x8C47,0xBC47,0xC447,0xBC67,0xA468,0x3382,0x5C26,0xACA9,0x9C88,0x9C88,0xA488,0xA489,0x8C68,0x0320,0x0320,0x0320,0x0320,0x1341,0x9468,0x33A3,0x43A3,0x9C67,0xBC67,0xBC68,0xBC67,0xB467,0x7426,0x1361,0x0320,0x0320,0x0320,0x0320,0x0320,0x6426,0xB488,0x0B41,0x0320,0x0320,0x43C4,0x8C68,0x43C4,0xA467,0xBC67,0xBC88,0xB447,0x6C06,0x0B41,0x0320,0x1341,0x8C47,0xBC47,0xBC47,0xAC88,0x63E5,0x1361,0x33A3,0x9467,0xBC67,0xC467,0xBC67,0x9467,0x2B62,0x6C27,0xACA9,0x9C88,0x9C88,0xA488,0xA489,0x1B62,0x2B83,0xACA9,0xA488,0x9C88,0xA488,0xA489,0x5405,0x1361,0x9CA9,0xA488,0x9C88,0x9C88,0xA488,0x9CA9,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0B41,0x1361,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0B41,0x1362,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0B40,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1382,0x0B41,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0B41,0x1B82,0x1362,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x9447,0x6405,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0B61,0x1362,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0340,0x0B40,0x0320,0x0320,0x0320,0x0320,0x0320,0x0B40,0x1382,0x0B41,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0B41,0x0320,0x0320,0x43C4,0xB488,0x1341,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x7426,0xBCA8,0x33A3,0x0B61,0xB488,0x5BE5,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x1B82,0xCC88,0xDC66,0xBC67,0x9447,0x8C26,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x7406,0xDC88,0xDC88,0x8C47,0x1361,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
-    0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,0x0320,
+    0x40, 0x01, 0x20, 0x00, 0xc7, 0x00, 0x20, 0x03, 0x40, 0x03, 0x20, 0x0b, 0x40, 0x0b, 0x41, 0x0b,
+    0x61, 0x0b, 0x41, 0x13, 0x61, 0x13, 0x62, 0x13, 0x82, 0x13, 0x41, 0x1b, 0x61, 0x1b, 0x62, 0x1b,
+    0x82, 0x1b, 0x83, 0x1b, 0x61, 0x23, 0x62, 0x23, 0x82, 0x23, 0x83, 0x23, 0xa3, 0x23, 0x62, 0x2b,
+    0x82, 0x2b, 0x83, 0x2b, 0xa3, 0x2b, 0xc4, 0x2b, 0x82, 0x33, 0x83, 0x33, 0xa3, 0x33, 0xc4, 0x33,
+    0xe5, 0x33, 0x82, 0x3b, 0xa3, 0x3b, 0xc3, 0x3b, 0xc4, 0x3b, 0xe4, 0x3b, 0xe5, 0x3b, 0x82, 0x43,
+    0x83, 0x43, 0xa3, 0x43, 0xc3, 0x43, 0xc4, 0x43, 0xe4, 0x43, 0xe5, 0x43, 0x05, 0x44, 0xa3, 0x4b,
+    0xc3, 0x4b, 0xc4, 0x4b, 0xe4, 0x4b, 0xe5, 0x4b, 0x05, 0x4c, 0xa3, 0x53, 0xc3, 0x53, 0xc4, 0x53,
+    0xe4, 0x53, 0xe5, 0x53, 0x05, 0x54, 0x06, 0x54, 0xc3, 0x5b, 0xc4, 0x5b, 0xe4, 0x5b, 0xe5, 0x5b,
+    0x05, 0x5c, 0x06, 0x5c, 0x26, 0x5c, 0xe4, 0x63, 0xe5, 0x63, 0x05, 0x64, 0x06, 0x64, 0x26, 0x64,
+    0xe5, 0x6b, 0x05, 0x6c, 0x06, 0x6c, 0x26, 0x6c, 0x27, 0x6c, 0x47, 0x6c, 0x68, 0x6c, 0xe5, 0x73,
+    0x05, 0x74, 0x06, 0x74, 0x26, 0x74, 0x27, 0x74, 0x47, 0x74, 0xe4, 0x7b, 0xe5, 0x7b, 0x05, 0x7c,
+    0x06, 0x7c, 0x26, 0x7c, 0x27, 0x7c, 0x46, 0x7c, 0x47, 0x7c, 0x05, 0x84, 0x06, 0x84, 0x26, 0x84,
+    0x46, 0x84, 0x47, 0x84, 0x67, 0x84, 0x68, 0x84, 0x88, 0x84, 0x05, 0x8c, 0x26, 0x8c, 0x27, 0x8c,
+    0x46, 0x8c, 0x47, 0x8c, 0x67, 0x8c, 0x68, 0x8c, 0xe4, 0x93, 0x05, 0x94, 0x26, 0x94, 0x46, 0x94,
+    0x47, 0x94, 0x67, 0x94, 0x68, 0x94, 0x88, 0x94, 0x89, 0x94, 0xa9, 0x94, 0x05, 0x9c, 0x25, 0x9c,
+    0x26, 0x9c, 0x46, 0x9c, 0x47, 0x9c, 0x67, 0x9c, 0x68, 0x9c, 0x88, 0x9c, 0x89, 0x9c, 0xa9, 0x9c,
+    0x26, 0xa4, 0x46, 0xa4, 0x47, 0xa4, 0x67, 0xa4, 0x68, 0xa4, 0x88, 0xa4, 0x89, 0xa4, 0xa9, 0xa4,
+    0x05, 0xac, 0x25, 0xac, 0x26, 0xac, 0x46, 0xac, 0x47, 0xac, 0x67, 0xac, 0x68, 0xac, 0x88, 0xac,
+    0x89, 0xac, 0xa9, 0xac, 0x05, 0xb4, 0x25, 0xb4, 0x26, 0xb4, 0x47, 0xb4, 0x67, 0xb4, 0x68, 0xb4,
+    0x88, 0xb4, 0x89, 0xb4, 0xa9, 0xb4, 0x26, 0xbc, 0x46, 0xbc, 0x47, 0xbc, 0x67, 0xbc, 0x68, 0xbc,
+    0x88, 0xbc, 0xa8, 0xbc, 0xa9, 0xbc, 0x46, 0xc4, 0x47, 0xc4, 0x67, 0xc4, 0x68, 0xc4, 0x87, 0xc4,
+    0x88, 0xc4, 0x89, 0xc4, 0xa8, 0xc4, 0xa9, 0xc4, 0xca, 0xc4, 0x46, 0xcc, 0x47, 0xcc, 0x67, 0xcc,
+    0x68, 0xcc, 0x87, 0xcc, 0x88, 0xcc, 0xa9, 0xcc, 0x46, 0xd4, 0x47, 0xd4, 0x67, 0xd4, 0x68, 0xd4,
+    0x87, 0xd4, 0x88, 0xd4, 0x89, 0xd4, 0xa9, 0xd4, 0xc9, 0xd4, 0xca, 0xd4, 0x46, 0xdc, 0x66, 0xdc,
+    0x67, 0xdc, 0x87, 0xdc, 0x88, 0xdc, 0xa8, 0xdc, 0xa9, 0xdc, 0x86, 0xe4, 0x87, 0xe4, 0xa7, 0xe4,
+    0xa8, 0xe4, 0xc8, 0xe4, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
+    0xff, 0x00, 0xff, 0x00, 0xce, 0x00, 0x00, 0x1f, 0x00, 0x5a, 0x00, 0x80, 0x05, 0x81, 0x00, 0x8c,
+    0x00, 0x68, 0x02, 0x00, 0x00, 0x15, 0x00, 0x54, 0x00, 0x80, 0x06, 0x81, 0x00, 0x8c, 0x00, 0x26,
+    0x01, 0x00, 0x00, 0x06, 0x00, 0x42, 0x00, 0x76, 0x00, 0x8b, 0x05, 0x81, 0x00, 0x8c, 0x00, 0x36,
+    0x04, 0x00, 0x00, 0x2d, 0x00, 0x95, 0x00, 0xbf, 0x00, 0xb6, 0x00, 0x77, 0x00, 0x15, 0x08, 0x00,
+    0x00, 0x72, 0x00, 0x79, 0x02, 0x6e, 0x00, 0x6f, 0x00, 0x0b, 0x07, 0x00, 0x00, 0x2a, 0x00, 0x7a,
+    0x01, 0x6e, 0x00, 0x79, 0x00, 0x84, 0x00, 0x28, 0x2d, 0x00, 0x00, 0x1b, 0x00, 0x78, 0x00, 0xb8,
+    0x00, 0xaa, 0x00, 0xb7, 0x00, 0x95, 0x00, 0x2d, 0x00, 0x1a, 0x00, 0x5f, 0x00, 0x04, 0xb3, 0x00,
+    0x00, 0x06, 0x00, 0x63, 0x00, 0xb3, 0x00, 0xbe, 0x00, 0xbd, 0x05, 0xbc, 0x00, 0xc2, 0x00, 0x9d,
+    0x00, 0x04, 0x00, 0x00, 0x00, 0x3b, 0x00, 0xac, 0x01, 0xbe, 0x06, 0xbc, 0x00, 0xc4, 0x00, 0x33,
+    0x00, 0x00, 0x00, 0x1b, 0x00, 0x93, 0x01, 0xbe, 0x06, 0xbc, 0x00, 0xc3, 0x00, 0x47, 0x03, 0x00,
+    0x00, 0x2e, 0x00, 0xbf, 0x00, 0xbc, 0x01, 0xb2, 0x00, 0xbd, 0x00, 0xa2, 0x00, 0x11, 0x07, 0x00,
+    0x00, 0x3e, 0x00, 0x63, 0x00, 0xb3, 0x01, 0xbc, 0x00, 0xbe, 0x00, 0x48, 0x07, 0x00, 0x00, 0x66,
+    0x00, 0xc3, 0x00, 0xbc, 0x00, 0xbe, 0x00, 0x7d, 0x00, 0x48, 0x00, 0x11, 0x11, 0x00, 0x00, 0x07,
+    0x00, 0x13, 0x00, 0x0d, 0x17, 0x00, 0x00, 0x35, 0x00, 0xb5, 0x00, 0x8a, 0x00, 0x21, 0x00, 0x0a,
+    0x00, 0x21, 0x00, 0x6b, 0x00, 0xbf, 0x00, 0xb3, 0x00, 0xa2, 0x00, 0x09, 0x11, 0x00, 0x00, 0x0d,
+    0x00, 0x13, 0x00, 0x07, 0x9e, 0x00, 0x00, 0x6c, 0x00, 0xbe, 0x00, 0xbd, 0x00, 0xa1, 0x00, 0x89,
+    0x06, 0x8a, 0x00, 0x66, 0x00, 0x00, 0x00, 0x1f, 0x00, 0xb3, 0x00, 0xbc, 0x00, 0xab, 0x00, 0x89,
+    0x06, 0x81, 0x00, 0x8c, 0x00, 0x1f, 0x00, 0x06, 0x00, 0x9b, 0x00, 0xbd, 0x00, 0xb3, 0x00, 0x92,
+    0x06, 0x81, 0x00, 0x8c, 0x00, 0x30, 0x02, 0x00, 0x00, 0x04, 0x00, 0x9b, 0x00, 0xbd, 0x00, 0x9b,
+    0x00, 0x3d, 0x00, 0x46, 0x00, 0xac, 0x00, 0xbe, 0x00, 0x5c, 0x09, 0x00, 0x00, 0x56, 0x00, 0xb8,
+    0x00, 0xa8, 0x00, 0xbc, 0x00, 0x8a, 0x00, 0x03, 0x05, 0x00, 0x00, 0x07, 0x00, 0x95, 0x00, 0xb8,
+    0x00, 0xb2, 0x00, 0xa2, 0x00, 0x13, 0x13, 0x00, 0x00, 0x54, 0x00, 0xb5, 0x00, 0x79, 0x16, 0x00,
+    0x00, 0x16, 0x00, 0xaf, 0x00, 0xa5, 0x00, 0x07, 0x03, 0x00, 0x00, 0x63, 0x00, 0xc3, 0x00, 0x9c,
+    0x00, 0x0d, 0x11, 0x00, 0x00, 0x79, 0x00, 0xb5, 0x00, 0x60, 0x9d, 0x00, 0x00, 0x3b, 0x00, 0xbe,
+    0x00, 0xbd, 0x00, 0x7f, 0x00, 0x43, 0x00, 0x6d, 0x05, 0x77, 0x00, 0x78, 0x00, 0x56, 0x00, 0x01,
+    0x00, 0x7f, 0x00, 0xbd, 0x00, 0xac, 0x00, 0x48, 0x00, 0x65, 0x06, 0x77, 0x00, 0x80, 0x00, 0x1b,
+    0x00, 0x3c, 0x00, 0xbe, 0x00, 0xb3, 0x00, 0x5c, 0x00, 0x4f, 0x06, 0x77, 0x00, 0x78, 0x00, 0x28,
+    0x02, 0x00, 0x00, 0x1f, 0x00, 0xb3, 0x00, 0xbd, 0x00, 0x4f, 0x00, 0x92, 0x00, 0x63, 0x00, 0x6b,
+    0x00, 0xbd, 0x00, 0xa3, 0x00, 0x06, 0x08, 0x00, 0x00, 0x30, 0x00, 0xa9, 0x00, 0x59, 0x00, 0xbd,
+    0x00, 0xb6, 0x00, 0x20, 0x05, 0x00, 0x00, 0x2e, 0x00, 0x9c, 0x00, 0x71, 0x00, 0xbd, 0x00, 0xa1,
+    0x00, 0x0d, 0x13, 0x00, 0x00, 0x5a, 0x00, 0xc3, 0x00, 0x82, 0x16, 0x00, 0x00, 0x4e, 0x00, 0xc4,
+    0x00, 0x5a, 0x04, 0x00, 0x00, 0x0c, 0x00, 0xa2, 0x00, 0xa5, 0x00, 0x0e, 0x11, 0x00, 0x00, 0x8b,
+    0x00, 0xc3, 0x00, 0x68, 0x9d, 0x00, 0x00, 0x8b, 0x00, 0xbc, 0x00, 0x9a, 0x00, 0x48, 0x00, 0xb3,
+    0x00, 0xbd, 0x00, 0xc3, 0x04, 0xbe, 0x00, 0xc3, 0x00, 0x94, 0x00, 0x13, 0x00, 0xad, 0x00, 0xbd,
+    0x00, 0x5e, 0x00, 0x7f, 0x00, 0xbe, 0x00, 0xbd, 0x05, 0xbe, 0x00, 0xc4, 0x00, 0x34, 0x00, 0x77,
+    0x00, 0xbd, 0x00, 0x92, 0x00, 0x4e, 0x00, 0xbe, 0x00, 0xbd, 0x05, 0xbe, 0x00, 0xc4, 0x00, 0x47,
+    0x02, 0x00, 0x00, 0x5c, 0x00, 0xbe, 0x00, 0xa1, 0x00, 0x48, 0x00, 0xbd, 0x00, 0xa1, 0x00, 0x47,
+    0x00, 0xb3, 0x00, 0xbd, 0x00, 0x2e, 0x08, 0x00, 0x00, 0x30, 0x00, 0xb0, 0x00, 0x21, 0x00, 0xa2,
+    0x00, 0xbe, 0x00, 0x66, 0x05, 0x00, 0x00, 0x77, 0x00, 0x4f, 0x00, 0x5c, 0x00, 0xbe, 0x00, 0xa1,
+    0x00, 0x0d, 0x13, 0x00, 0x00, 0x54, 0x00, 0xc3, 0x00, 0x7a, 0x16, 0x00, 0x00, 0x82, 0x00, 0xbc,
+    0x00, 0x7f, 0x05, 0x00, 0x00, 0x5e, 0x00, 0xaf, 0x00, 0x0d, 0x11, 0x00, 0x00, 0x81, 0x00, 0xc3,
+    0x00, 0x68, 0x9d, 0x00, 0x00, 0xb7, 0x00, 0xbc, 0x00, 0x56, 0x00, 0x75, 0x00, 0xbd, 0x00, 0xa1,
+    0x00, 0x6a, 0x01, 0x73, 0x00, 0x75, 0x00, 0x88, 0x00, 0x89, 0x00, 0x92, 0x00, 0x66, 0x00, 0x17,
+    0x00, 0xb6, 0x00, 0xbd, 0x00, 0x48, 0x00, 0x90, 0x00, 0xbd, 0x00, 0xa1, 0x00, 0x6a, 0x03, 0x73,
+    0x00, 0x75, 0x00, 0x93, 0x00, 0x26, 0x00, 0x7f, 0x00, 0xbe, 0x00, 0x63, 0x00, 0x54, 0x00, 0xbd,
+    0x00, 0xb3, 0x00, 0x7d, 0x00, 0x6a, 0x03, 0x73, 0x00, 0x74, 0x00, 0x2e, 0x01, 0x00, 0x00, 0x04,
+    0x00, 0x9b, 0x00, 0xbd, 0x00, 0x76, 0x00, 0x63, 0x01, 0xbd, 0x00, 0x47, 0x00, 0xa1, 0x00, 0xbe,
+    0x00, 0x63, 0x08, 0x00, 0x00, 0x30, 0x00, 0xb9, 0x00, 0x0b, 0x00, 0x78, 0x00, 0xbc, 0x00, 0xa5,
+    0x00, 0x0c, 0x03, 0x00, 0x00, 0x11, 0x00, 0xa6, 0x00, 0x16, 0x00, 0x5b, 0x00, 0xbe, 0x00, 0xa1,
+    0x00, 0x0d, 0x02, 0x00, 0x00, 0x1f, 0x00, 0x5e, 0x00, 0x8d, 0x00, 0x8e, 0x00, 0x67, 0x00, 0x1f,
+    0x02, 0x00, 0x00, 0x07, 0x00, 0x46, 0x01, 0x8e, 0x00, 0x5e, 0x00, 0x3c, 0x00, 0x79, 0x00, 0x34,
+    0x00, 0x7d, 0x00, 0xbd, 0x00, 0x94, 0x00, 0x34, 0x00, 0x33, 0x00, 0x32, 0x00, 0x04, 0x00, 0x00,
+    0x00, 0x34, 0x00, 0x7a, 0x00, 0x96, 0x00, 0x82, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x1f, 0x00, 0x33,
+    0x00, 0x34, 0x00, 0x46, 0x00, 0x21, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x79, 0x00, 0x5e, 0x00, 0x0b,
+    0x01, 0x00, 0x00, 0x66, 0x00, 0xbc, 0x00, 0xb5, 0x00, 0x28, 0x04, 0x00, 0x00, 0x1f, 0x00, 0xc1,
+    0x00, 0x42, 0x00, 0x32, 0x00, 0x34, 0x00, 0x3a, 0x00, 0x0f, 0x01, 0x00, 0x00, 0x2e, 0x00, 0x39,
+    0x01, 0x34, 0x00, 0x33, 0x00, 0x4f, 0x01, 0x8e, 0x00, 0x56, 0x00, 0x43, 0x00, 0x78, 0x00, 0x33,
+    0x00, 0x94, 0x00, 0xbd, 0x00, 0x8c, 0x00, 0x34, 0x00, 0x33, 0x00, 0x2c, 0x00, 0x01, 0x00, 0x06,
+    0x00, 0x41, 0x00, 0x83, 0x00, 0x8d, 0x00, 0x79, 0x00, 0x34, 0x00, 0x04, 0x00, 0x2c, 0x00, 0x32,
+    0x00, 0x3a, 0x00, 0x48, 0x00, 0x17, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x79, 0x00, 0x8d, 0x00, 0x58,
+    0x00, 0x11, 0x01, 0x00, 0x00, 0x19, 0x00, 0x5d, 0x00, 0x8d, 0x00, 0x6f, 0x00, 0x28, 0x80, 0x00,
+    0x00, 0xb6, 0x00, 0xbc, 0x00, 0x4e, 0x00, 0x7d, 0x00, 0xbd, 0x00, 0x9b, 0x00, 0x46, 0x00, 0x4f,
+    0x00, 0x45, 0x00, 0x41, 0x00, 0x13, 0x02, 0x00, 0x00, 0x15, 0x00, 0xb6, 0x00, 0xbd, 0x00, 0x47,
+    0x00, 0x90, 0x00, 0xbd, 0x00, 0x93, 0x00, 0x4f, 0x02, 0x56, 0x00, 0x58, 0x00, 0x37, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x8a, 0x00, 0xbe, 0x00, 0x6b, 0x00, 0x54, 0x00, 0xc3, 0x00, 0x93, 0x00, 0x3d,
+    0x04, 0x56, 0x00, 0x5d, 0x00, 0x21, 0x01, 0x00, 0x00, 0x28, 0x01, 0xbd, 0x00, 0x4f, 0x00, 0x9a,
+    0x00, 0xb3, 0x00, 0xbd, 0x01, 0x6b, 0x00, 0xbe, 0x00, 0x9b, 0x00, 0x07, 0x07, 0x00, 0x00, 0x30,
+    0x00, 0xb9, 0x00, 0x06, 0x00, 0x2f, 0x00, 0xbf, 0x00, 0xbe, 0x00, 0x3d, 0x03, 0x00, 0x00, 0x4f,
+    0x00, 0x8b, 0x00, 0x00, 0x00, 0x5c, 0x00, 0xbe, 0x00, 0xa1, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x03,
+    0x00, 0x54, 0x00, 0xb8, 0x00, 0x56, 0x00, 0x1b, 0x00, 0x42, 0x00, 0xb6, 0x00, 0xbe, 0x00, 0x41,
+    0x00, 0x00, 0x00, 0x0c, 0x00, 0x93, 0x00, 0x9d, 0x00, 0x3d, 0x00, 0x30, 0x00, 0x6d, 0x00, 0xc0,
+    0x00, 0xbe, 0x00, 0xa8, 0x00, 0xad, 0x00, 0xb1, 0x00, 0xb6, 0x00, 0xa8, 0x00, 0xb0, 0x00, 0x9f,
+    0x00, 0x23, 0x00, 0x80, 0x00, 0xaf, 0x00, 0x4f, 0x00, 0x1f, 0x00, 0x5e, 0x00, 0xbf, 0x00, 0x7e,
+    0x00, 0x59, 0x00, 0xa5, 0x00, 0xc4, 0x00, 0xbe, 0x00, 0x60, 0x00, 0x66, 0x00, 0x9d, 0x00, 0xb3,
+    0x00, 0xc3, 0x00, 0x57, 0x01, 0x00, 0x00, 0x41, 0x00, 0xbe, 0x00, 0xb2, 0x00, 0xac, 0x00, 0x46,
+    0x00, 0x0c, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x6c, 0x00, 0xc0, 0x00, 0xbe, 0x00, 0xbf, 0x00, 0x7f,
+    0x00, 0x19, 0x01, 0x00, 0x00, 0x46, 0x00, 0xa4, 0x00, 0xc4, 0x00, 0xc0, 0x00, 0xc5, 0x00, 0x8c,
+    0x00, 0x36, 0x00, 0x37, 0x00, 0x80, 0x00, 0xc0, 0x00, 0xbe, 0x00, 0xa8, 0x00, 0xb4, 0x00, 0xb1,
+    0x00, 0xaf, 0x00, 0xa8, 0x00, 0xb0, 0x00, 0x8d, 0x00, 0x2b, 0x00, 0x93, 0x00, 0xa5, 0x00, 0x42,
+    0x00, 0x28, 0x00, 0x6d, 0x00, 0xbf, 0x00, 0x6b, 0x00, 0x68, 0x00, 0xaf, 0x01, 0xc3, 0x00, 0x4b,
+    0x00, 0x5c, 0x00, 0xa8, 0x00, 0x8a, 0x00, 0xb4, 0x00, 0xc3, 0x00, 0x9b, 0x00, 0x11, 0x00, 0x3a,
+    0x00, 0xb0, 0x00, 0x8a, 0x00, 0xaf, 0x00, 0xbe, 0x00, 0xb6, 0x00, 0x36, 0x7f, 0x00, 0x00, 0x95,
+    0x00, 0xbc, 0x00, 0x89, 0x00, 0x4f, 0x00, 0xbd, 0x00, 0xbc, 0x00, 0xbd, 0x00, 0xbc, 0x00, 0xbd,
+    0x00, 0xbe, 0x00, 0xa2, 0x00, 0x3b, 0x01, 0x00, 0x00, 0x15, 0x00, 0xb6, 0x00, 0xbd, 0x00, 0x47,
+    0x00, 0x8f, 0x00, 0xbc, 0x00, 0xbb, 0x03, 0xbc, 0x00, 0xc3, 0x00, 0x6d, 0x01, 0x00, 0x00, 0x8a,
+    0x00, 0xbe, 0x00, 0x6b, 0x00, 0x54, 0x00, 0xc3, 0x00, 0x8b, 0x00, 0x6d, 0x00, 0xc3, 0x02, 0xbc,
+    0x00, 0xbd, 0x00, 0xc3, 0x00, 0x47, 0x01, 0x00, 0x00, 0x5c, 0x00, 0xbd, 0x00, 0xa1, 0x00, 0x48,
+    0x00, 0xb3, 0x00, 0xb2, 0x00, 0xb1, 0x00, 0xa1, 0x00, 0x47, 0x00, 0xb3, 0x00, 0xbd, 0x00, 0x2e,
+    0x07, 0x00, 0x00, 0x30, 0x00, 0xb9, 0x00, 0x0a, 0x00, 0x08, 0x00, 0xa3, 0x00, 0xbd, 0x00, 0x80,
+    0x02, 0x00, 0x00, 0x03, 0x00, 0x94, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x5c, 0x00, 0xbe, 0x00, 0xa1,
+    0x00, 0x0d, 0x00, 0x00, 0x00, 0x3c, 0x00, 0xc4, 0x00, 0xad, 0x00, 0x07, 0x01, 0x00, 0x00, 0x42,
+    0x00, 0xc3, 0x00, 0xaf, 0x00, 0x08, 0x00, 0x63, 0x00, 0xc1, 0x00, 0x1c, 0x02, 0x00, 0x00, 0x56,
+    0x00, 0xad, 0x00, 0x1d, 0x00, 0x5b, 0x00, 0xbe, 0x00, 0x82, 0x00, 0x09, 0x00, 0x08, 0x00, 0x0e,
+    0x00, 0x81, 0x00, 0xc0, 0x00, 0x2f, 0x02, 0x00, 0x00, 0x5e, 0x00, 0xc4, 0x00, 0x63, 0x00, 0x13,
+    0x00, 0x9b, 0x00, 0xb1, 0x00, 0xa3, 0x00, 0x4f, 0x00, 0x13, 0x00, 0xb0, 0x00, 0xbc, 0x00, 0x79,
+    0x01, 0x00, 0x00, 0x06, 0x00, 0x89, 0x00, 0xbe, 0x00, 0xb1, 0x00, 0xbe, 0x00, 0xa2, 0x00, 0x5e,
+    0x00, 0x1f, 0x02, 0x00, 0x00, 0x4f, 0x00, 0xbe, 0x00, 0xad, 0x00, 0x17, 0x03, 0x00, 0x00, 0x2a,
+    0x00, 0xb8, 0x00, 0xb0, 0x00, 0xa5, 0x00, 0x08, 0x02, 0x00, 0x00, 0x6d, 0x00, 0xb0, 0x00, 0x13,
+    0x00, 0x89, 0x00, 0xbe, 0x00, 0x70, 0x01, 0x08, 0x00, 0x17, 0x00, 0x94, 0x00, 0xb4, 0x00, 0x17,
+    0x02, 0x00, 0x00, 0x7f, 0x00, 0xc4, 0x00, 0x46, 0x00, 0x21, 0x00, 0xac, 0x00, 0xb2, 0x00, 0xa8,
+    0x00, 0x47, 0x00, 0x07, 0x00, 0x01, 0x00, 0x28, 0x00, 0xac, 0x00, 0xbc, 0x00, 0xa5, 0x00, 0x63,
+    0x00, 0x10, 0x00, 0x01, 0x00, 0x12, 0x00, 0x93, 0x00, 0xbc, 0x00, 0x94, 0x7f, 0x00, 0x00, 0x46,
+    0x00, 0xbe, 0x00, 0xb3, 0x00, 0x6d, 0x00, 0x4f, 0x00, 0x8a, 0x01, 0x94, 0x00, 0x9a, 0x00, 0xb2,
+    0x00, 0xbd, 0x00, 0xbe, 0x00, 0x41, 0x00, 0x00, 0x00, 0x15, 0x00, 0xb6, 0x00, 0xbd, 0x00, 0x48,
+    0x00, 0x6c, 0x00, 0x95, 0x04, 0x94, 0x00, 0x9d, 0x00, 0x4f, 0x01, 0x00, 0x00, 0x8a, 0x00, 0xbe,
+    0x00, 0x6b, 0x00, 0x54, 0x00, 0xc3, 0x00, 0x93, 0x00, 0x56, 0x00, 0x9d, 0x01, 0x94, 0x00, 0x9c,
+    0x00, 0xb3, 0x00, 0xbd, 0x00, 0x42, 0x00, 0x00, 0x00, 0x06, 0x00, 0x9b, 0x00, 0xbd, 0x00, 0x6b,
+    0x00, 0x63, 0x00, 0xbd, 0x00, 0xb1, 0x00, 0xb2, 0x00, 0xbd, 0x00, 0x47, 0x00, 0x9a, 0x00, 0xbd,
+    0x00, 0x65, 0x07, 0x00, 0x00, 0x30, 0x00, 0xb9, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x66, 0x00, 0xbd,
+    0x00, 0xb6, 0x00, 0x17, 0x01, 0x00, 0x00, 0x1f, 0x00, 0x9d, 0x00, 0x08, 0x00, 0x00, 0x00, 0x5c,
+    0x00, 0xbe, 0x00, 0xa1, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x4d, 0x00, 0xc5, 0x00, 0xb3, 0x00, 0x11,
+    0x01, 0x00, 0x00, 0x1c, 0x00, 0xb6, 0x00, 0xbe, 0x00, 0x1b, 0x00, 0x87, 0x00, 0xc0, 0x00, 0x17,
+    0x02, 0x00, 0x00, 0x07, 0x00, 0x9f, 0x00, 0x1c, 0x00, 0x53, 0x00, 0xc3, 0x00, 0x82, 0x01, 0x00,
+    0x00, 0x35, 0x00, 0xc4, 0x00, 0x7f, 0x03, 0x00, 0x00, 0x1f, 0x00, 0xbf, 0x00, 0xb6, 0x00, 0x17,
+    0x00, 0x73, 0x00, 0xbd, 0x00, 0x6e, 0x01, 0x00, 0x00, 0x4d, 0x00, 0x8a, 0x00, 0x1f, 0x02, 0x00,
+    0x00, 0x0c, 0x00, 0x80, 0x00, 0xbe, 0x00, 0xbd, 0x00, 0xbc, 0x00, 0xbd, 0x00, 0xb6, 0x00, 0x80,
+    0x00, 0x1f, 0x00, 0x00, 0x00, 0x07, 0x00, 0xa5, 0x00, 0xbd, 0x00, 0x4f, 0x03, 0x00, 0x00, 0x56,
+    0x00, 0x8e, 0x01, 0xa5, 0x00, 0x05, 0x02, 0x00, 0x00, 0x16, 0x00, 0xa9, 0x00, 0x0d, 0x00, 0x7e,
+    0x00, 0xc3, 0x00, 0x6f, 0x01, 0x00, 0x00, 0x4f, 0x00, 0xc3, 0x00, 0x5e, 0x03, 0x00, 0x00, 0x43,
+    0x00, 0xbe, 0x00, 0xa5, 0x00, 0x06, 0x00, 0x9a, 0x00, 0xbe, 0x00, 0x5e, 0x03, 0x00, 0x00, 0x80,
+    0x00, 0xbe, 0x00, 0x9b, 0x03, 0x00, 0x00, 0x44, 0x00, 0xbe, 0x00, 0xa1, 0x00, 0x0d, 0x7e, 0x00,
+    0x00, 0x06, 0x00, 0x89, 0x01, 0xbd, 0x00, 0x7e, 0x00, 0x5c, 0x00, 0x66, 0x00, 0x63, 0x00, 0x56,
+    0x00, 0x46, 0x00, 0xa2, 0x00, 0xbd, 0x00, 0xb3, 0x00, 0x15, 0x00, 0x11, 0x00, 0xb6, 0x00, 0xbd,
+    0x00, 0x48, 0x00, 0x4d, 0x00, 0x66, 0x03, 0x63, 0x00, 0x64, 0x00, 0x65, 0x00, 0x3c, 0x01, 0x00,
+    0x00, 0x8a, 0x00, 0xbe, 0x00, 0x6b, 0x00, 0x54, 0x00, 0xc3, 0x00, 0x93, 0x00, 0x3d, 0x00, 0x6c,
+    0x01, 0x63, 0x00, 0x43, 0x00, 0xad, 0x00, 0xbd, 0x00, 0x42, 0x00, 0x00, 0x00, 0x28, 0x00, 0xbe,
+    0x00, 0xbd, 0x00, 0x48, 0x00, 0x9a, 0x00, 0xb2, 0x01, 0xb3, 0x00, 0xbd, 0x00, 0x6b, 0x00, 0x63,
+    0x00, 0xbd, 0x00, 0xa2, 0x00, 0x07, 0x06, 0x00, 0x00, 0x30, 0x00, 0xb9, 0x00, 0x0b, 0x00, 0x00,
+    0x00, 0x21, 0x00, 0xb6, 0x00, 0xbd, 0x00, 0x56, 0x01, 0x00, 0x00, 0x6d, 0x00, 0x5d, 0x01, 0x00,
+    0x00, 0x5c, 0x00, 0xbe, 0x00, 0xa1, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x5f, 0x00, 0x37,
+    0x02, 0x00, 0x00, 0x1c, 0x00, 0xb6, 0x00, 0xbd, 0x00, 0x15, 0x00, 0x7d, 0x00, 0xc3, 0x00, 0x7f,
+    0x00, 0x1b, 0x02, 0x00, 0x00, 0x0b, 0x00, 0x03, 0x00, 0x5a, 0x00, 0xc3, 0x00, 0x82, 0x01, 0x00,
+    0x00, 0x81, 0x00, 0xc4, 0x00, 0x56, 0x03, 0x00, 0x00, 0x17, 0x00, 0xb6, 0x00, 0xbe, 0x00, 0x1e,
+    0x00, 0x6a, 0x00, 0xbd, 0x00, 0x59, 0x08, 0x00, 0x00, 0x01, 0x00, 0x28, 0x00, 0x77, 0x00, 0xb6,
+    0x02, 0xbd, 0x00, 0xb5, 0x00, 0x41, 0x00, 0x00, 0x00, 0x5e, 0x00, 0xbd, 0x00, 0x9b, 0x00, 0x07,
+    0x01, 0x00, 0x00, 0x04, 0x00, 0x95, 0x00, 0x2f, 0x00, 0xa2, 0x00, 0xbd, 0x00, 0x63, 0x00, 0x17,
+    0x02, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x89, 0x00, 0xc3, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x08,
+    0x00, 0x9c, 0x00, 0xbe, 0x00, 0x2d, 0x03, 0x00, 0x00, 0x31, 0x00, 0xb3, 0x00, 0xb2, 0x00, 0x17,
+    0x00, 0x9a, 0x00, 0xbe, 0x00, 0x44, 0x03, 0x00, 0x00, 0x70, 0x00, 0xc3, 0x00, 0x7f, 0x03, 0x00,
+    0x00, 0x30, 0x00, 0xb3, 0x00, 0xac, 0x00, 0x17, 0x7f, 0x00, 0x00, 0x11, 0x00, 0x89, 0x01, 0xbe,
+    0x02, 0xc3, 0x00, 0xbe, 0x00, 0x9a, 0x00, 0x48, 0x00, 0xac, 0x00, 0xbe, 0x00, 0x54, 0x00, 0x11,
+    0x00, 0xb6, 0x00, 0xbd, 0x00, 0x47, 0x00, 0x98, 0x01, 0xbe, 0x03, 0xc3, 0x00, 0xc4, 0x00, 0x6e,
+    0x01, 0x00, 0x00, 0x8a, 0x00, 0xbe, 0x00, 0x6b, 0x00, 0x54, 0x00, 0xc3, 0x00, 0x8a, 0x00, 0x77,
+    0x00, 0xc4, 0x00, 0xbd, 0x00, 0xbe, 0x00, 0x5e, 0x00, 0xa2, 0x00, 0xbd, 0x00, 0x42, 0x00, 0x00,
+    0x00, 0x63, 0x00, 0xbe, 0x00, 0xa1, 0x00, 0x48, 0x01, 0xbd, 0x00, 0x66, 0x00, 0x8a, 0x00, 0xbc,
+    0x00, 0xa1, 0x00, 0x47, 0x00, 0xb3, 0x00, 0xbd, 0x00, 0x2e, 0x06, 0x00, 0x00, 0x30, 0x00, 0xb9,
+    0x00, 0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x94, 0x00, 0xbd, 0x00, 0x9c, 0x00, 0x04, 0x00, 0x0b,
+    0x00, 0xa8, 0x00, 0x1b, 0x01, 0x00, 0x00, 0x5c, 0x00, 0xbe, 0x00, 0xa1, 0x00, 0x0d, 0x04, 0x00,
+    0x00, 0x19, 0x00, 0x4f, 0x00, 0x9d, 0x00, 0xb3, 0x00, 0xbd, 0x00, 0x15, 0x00, 0x43, 0x00, 0xbe,
+    0x00, 0xbd, 0x00, 0xb6, 0x00, 0x89, 0x00, 0x47, 0x00, 0x11, 0x01, 0x00, 0x00, 0x5a, 0x00, 0xc3,
+    0x00, 0x82, 0x00, 0x00, 0x00, 0x03, 0x00, 0xa3, 0x00, 0xbd, 0x00, 0xa2, 0x03, 0x87, 0x00, 0x92,
+    0x00, 0xbd, 0x00, 0xc3, 0x00, 0x26, 0x00, 0x69, 0x00, 0xbe, 0x00, 0x5e, 0x0b, 0x00, 0x00, 0x11,
+    0x00, 0x4f, 0x00, 0x9b, 0x00, 0xbd, 0x00, 0xb1, 0x00, 0xb6, 0x00, 0x1a, 0x00, 0x17, 0x00, 0xb6,
+    0x00, 0xb3, 0x00, 0x35, 0x01, 0x00, 0x00, 0x35, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x56, 0x00, 0xbe,
+    0x00, 0xbd, 0x00, 0xad, 0x00, 0x7f, 0x00, 0x3d, 0x00, 0x0c, 0x01, 0x00, 0x00, 0x89, 0x00, 0xc3,
+    0x00, 0x6f, 0x00, 0x00, 0x00, 0x15, 0x00, 0xb6, 0x00, 0xb2, 0x00, 0x99, 0x03, 0x87, 0x00, 0x9a,
+    0x01, 0xbd, 0x00, 0x2a, 0x00, 0x9a, 0x00, 0xbe, 0x00, 0x49, 0x03, 0x00, 0x00, 0x70, 0x00, 0xc3,
+    0x00, 0x7f, 0x03, 0x00, 0x00, 0x30, 0x00, 0xb3, 0x00, 0xac, 0x00, 0x17, 0x80, 0x00, 0x00, 0x04,
+    0x00, 0x3c, 0x00, 0x7f, 0x02, 0x86, 0x00, 0xab, 0x00, 0xbe, 0x00, 0x5c, 0x00, 0x7f, 0x00, 0xbd,
+    0x00, 0x80, 0x00, 0x17, 0x00, 0xb6, 0x00, 0xbd, 0x00, 0x47, 0x00, 0x90, 0x00, 0xbd, 0x00, 0xa0,
+    0x00, 0x85, 0x02, 0x86, 0x00, 0x91, 0x00, 0x4f, 0x01, 0x00, 0x00, 0x8a, 0x00, 0xbe, 0x00, 0x6b,
+    0x00, 0x54, 0x00, 0xc3, 0x00, 0x8a, 0x00, 0x4d, 0x00, 0x99, 0x00, 0xb2, 0x00, 0xbd, 0x00, 0x59,
+    0x00, 0xac, 0x00, 0xbd, 0x00, 0x42, 0x00, 0x04, 0x00, 0xa2, 0x00, 0xbd, 0x01, 0x6b, 0x00, 0xbd,
+    0x00, 0xb3, 0x00, 0x1b, 0x00, 0x4d, 0x01, 0xbd, 0x00, 0x48, 0x00, 0x9a, 0x00, 0xbe, 0x00, 0x6b,
+    0x06, 0x00, 0x00, 0x30, 0x00, 0xb9, 0x00, 0x0b, 0x01, 0x00, 0x00, 0x48, 0x01, 0xbe, 0x00, 0x21,
+    0x00, 0x3d, 0x00, 0x8b, 0x02, 0x00, 0x00, 0x5c, 0x00, 0xbe, 0x00, 0xa1, 0x00, 0x0d, 0x01, 0x00,
+    0x00, 0x07, 0x00, 0x47, 0x00, 0x93, 0x00, 0x9d, 0x00, 0x56, 0x00, 0x3e, 0x00, 0xac, 0x00, 0xbe,
+    0x00, 0x19, 0x00, 0x00, 0x00, 0x47, 0x00, 0xad, 0x00, 0xbe, 0x00, 0xc3, 0x00, 0xbe, 0x00, 0xa5,
+    0x00, 0x3b, 0x00, 0x00, 0x00, 0x5a, 0x00, 0xc3, 0x00, 0x82, 0x00, 0x00, 0x00, 0x0c, 0x00, 0xab,
+    0x00, 0xbe, 0x00, 0x6d, 0x00, 0x24, 0x00, 0x2d, 0x01, 0x2c, 0x01, 0x26, 0x00, 0x27, 0x00, 0x06,
+    0x00, 0x73, 0x00, 0xbd, 0x00, 0x5e, 0x05, 0x00, 0x00, 0x07, 0x00, 0x1f, 0x05, 0x00, 0x00, 0x07,
+    0x00, 0x77, 0x01, 0xbd, 0x00, 0x68, 0x00, 0x00, 0x00, 0x7f, 0x00, 0xbc, 0x00, 0x80, 0x01, 0x00,
+    0x00, 0x79, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x56, 0x00, 0xb6, 0x00, 0xbe, 0x00, 0xc3,
+    0x00, 0xbe, 0x00, 0xa2, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x89, 0x00, 0xc3, 0x00, 0x6f, 0x00, 0x00,
+    0x00, 0x19, 0x00, 0xbf, 0x00, 0xb3, 0x00, 0x4d, 0x00, 0x25, 0x02, 0x2c, 0x02, 0x26, 0x00, 0x0c,
+    0x00, 0x9a, 0x00, 0xbe, 0x00, 0x49, 0x03, 0x00, 0x00, 0x70, 0x00, 0xc3, 0x00, 0x7f, 0x03, 0x00,
+    0x00, 0x30, 0x00, 0xb3, 0x00, 0xac, 0x00, 0x13, 0x7e, 0x00, 0x00, 0x59, 0x00, 0x56, 0x02, 0x4f,
+    0x02, 0x47, 0x00, 0xa1, 0x00, 0xbe, 0x00, 0x6b, 0x00, 0x6d, 0x00, 0xbd, 0x00, 0x94, 0x00, 0x1b,
+    0x00, 0xb6, 0x00, 0xbd, 0x00, 0x47, 0x00, 0x90, 0x00, 0xbd, 0x00, 0x93, 0x00, 0x47, 0x03, 0x48,
+    0x00, 0x4f, 0x00, 0x5e, 0x00, 0x15, 0x00, 0x7f, 0x00, 0xbe, 0x00, 0x63, 0x00, 0x54, 0x00, 0xbd,
+    0x00, 0xac, 0x00, 0x4e, 0x00, 0x56, 0x00, 0xb3, 0x00, 0xbd, 0x00, 0x59, 0x00, 0xac, 0x00, 0xbd,
+    0x00, 0x3d, 0x00, 0x28, 0x00, 0xbe, 0x00, 0xb3, 0x00, 0x47, 0x00, 0xa1, 0x00, 0xb1, 0x00, 0xb4,
+    0x00, 0x7d, 0x00, 0x92, 0x00, 0xb2, 0x00, 0xbd, 0x00, 0x75, 0x00, 0x63, 0x00, 0xbd, 0x00, 0xa2,
+    0x00, 0x07, 0x05, 0x00, 0x00, 0x30, 0x00, 0xba, 0x00, 0x0b, 0x01, 0x00, 0x00, 0x17, 0x00, 0xb6,
+    0x00, 0xbd, 0x00, 0x70, 0x00, 0x8a, 0x00, 0x3c, 0x02, 0x00, 0x00, 0x5c, 0x00, 0xbe, 0x00, 0xa1,
+    0x00, 0x0d, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x9b, 0x00, 0xc5, 0x00, 0x56, 0x00, 0x07, 0x00, 0x00,
+    0x00, 0x1c, 0x00, 0xb6, 0x00, 0xbf, 0x00, 0x15, 0x01, 0x00, 0x00, 0x11, 0x00, 0x42, 0x00, 0x89,
+    0x00, 0xb3, 0x00, 0xbd, 0x00, 0xb3, 0x00, 0x28, 0x00, 0x52, 0x00, 0xc3, 0x00, 0x82, 0x00, 0x00,
+    0x00, 0x06, 0x00, 0xa2, 0x00, 0xbe, 0x00, 0x56, 0x07, 0x00, 0x00, 0x7d, 0x00, 0xbd, 0x00, 0x5e,
+    0x05, 0x00, 0x00, 0x22, 0x00, 0xaf, 0x00, 0x11, 0x05, 0x00, 0x00, 0x11, 0x00, 0xad, 0x00, 0xbd,
+    0x00, 0x80, 0x00, 0x00, 0x00, 0x36, 0x00, 0xbe, 0x00, 0xac, 0x00, 0x1b, 0x00, 0x11, 0x00, 0x9d,
+    0x00, 0x06, 0x02, 0x00, 0x00, 0x15, 0x00, 0x48, 0x00, 0x8a, 0x00, 0xb3, 0x00, 0xbc, 0x00, 0xb5,
+    0x00, 0x15, 0x00, 0x7e, 0x00, 0xc3, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x19, 0x00, 0xbf, 0x00, 0xbd,
+    0x00, 0x2d, 0x06, 0x00, 0x00, 0x02, 0x00, 0xa2, 0x00, 0xbe, 0x00, 0x49, 0x03, 0x00, 0x00, 0x70,
+    0x00, 0xc3, 0x00, 0x7f, 0x03, 0x00, 0x00, 0x30, 0x00, 0xb3, 0x00, 0xac, 0x00, 0x13, 0x7e, 0x00,
+    0x00, 0xc0, 0x00, 0xbc, 0x07, 0xbd, 0x00, 0x47, 0x00, 0x9a, 0x00, 0xbe, 0x00, 0x6b, 0x00, 0x13,
+    0x00, 0xaf, 0x00, 0xbd, 0x00, 0x56, 0x00, 0x87, 0x00, 0xbd, 0x00, 0xb1, 0x05, 0xbd, 0x00, 0xc4,
+    0x00, 0x2c, 0x00, 0x77, 0x00, 0xbd, 0x00, 0x77, 0x00, 0x55, 0x00, 0xbe, 0x00, 0xb1, 0x00, 0xbd,
+    0x00, 0xbc, 0x00, 0xb1, 0x00, 0xbd, 0x00, 0x59, 0x00, 0xac, 0x00, 0xbd, 0x00, 0x42, 0x00, 0x5c,
+    0x00, 0xbd, 0x00, 0x9a, 0x00, 0x47, 0x00, 0xb3, 0x00, 0xb1, 0x00, 0x97, 0x00, 0xb6, 0x00, 0xbc,
+    0x01, 0xb1, 0x00, 0xa1, 0x00, 0x47, 0x00, 0xb3, 0x00, 0xbe, 0x00, 0x2e, 0x05, 0x00, 0x00, 0x30,
+    0x00, 0xb8, 0x00, 0x0a, 0x02, 0x00, 0x00, 0x80, 0x00, 0xbd, 0x00, 0xbf, 0x00, 0x9d, 0x00, 0x08,
+    0x02, 0x00, 0x00, 0x5c, 0x00, 0xbe, 0x00, 0xa1, 0x00, 0x0d, 0x00, 0x02, 0x00, 0x94, 0x00, 0xc3,
+    0x00, 0x6c, 0x02, 0x00, 0x00, 0x21, 0x00, 0xb6, 0x00, 0xb3, 0x00, 0x36, 0x00, 0x44, 0x03, 0x00,
+    0x00, 0x20, 0x00, 0x93, 0x00, 0xbc, 0x00, 0x6f, 0x00, 0x53, 0x00, 0xbe, 0x00, 0x82, 0x01, 0x00,
+    0x00, 0x96, 0x00, 0xbc, 0x00, 0x77, 0x07, 0x00, 0x00, 0x7d, 0x00, 0xbd, 0x00, 0x5e, 0x05, 0x00,
+    0x00, 0x18, 0x00, 0xb3, 0x00, 0x4f, 0x06, 0x00, 0x00, 0x7f, 0x00, 0xc3, 0x00, 0x81, 0x00, 0x00,
+    0x00, 0x07, 0x00, 0x9c, 0x00, 0xbd, 0x00, 0x4f, 0x01, 0x56, 0x00, 0x00, 0x00, 0x29, 0x00, 0x37,
+    0x03, 0x00, 0x00, 0x28, 0x00, 0x9b, 0x00, 0xbe, 0x00, 0x5e, 0x00, 0x77, 0x00, 0xc3, 0x00, 0x70,
+    0x00, 0x00, 0x00, 0x11, 0x00, 0xa5, 0x00, 0xbb, 0x00, 0x57, 0x07, 0x00, 0x00, 0xa2, 0x00, 0xbe,
+    0x00, 0x49, 0x03, 0x00, 0x00, 0x70, 0x00, 0xc3, 0x00, 0x7f, 0x03, 0x00, 0x00, 0x30, 0x00, 0xb3,
+    0x00, 0xac, 0x00, 0x13, 0x7e, 0x00, 0x00, 0x9d, 0x06, 0x9c, 0x00, 0x93, 0x00, 0x45, 0x00, 0x63,
+    0x00, 0xbd, 0x00, 0xbe, 0x00, 0x34, 0x00, 0x00, 0x00, 0x92, 0x00, 0xbd, 0x00, 0x92, 0x00, 0x48,
+    0x00, 0x92, 0x00, 0xa5, 0x05, 0x9c, 0x00, 0xa7, 0x00, 0x1f, 0x00, 0x4e, 0x00, 0xbe, 0x00, 0xb3,
+    0x00, 0x51, 0x00, 0x77, 0x00, 0xa5, 0x02, 0x9c, 0x00, 0xa5, 0x00, 0x48, 0x00, 0xad, 0x00, 0xbd,
+    0x00, 0x42, 0x00, 0x92, 0x00, 0xbd, 0x00, 0x63, 0x00, 0x6b, 0x00, 0xbd, 0x00, 0xb3, 0x00, 0x4f,
+    0x00, 0xa5, 0x02, 0xa3, 0x00, 0xa5, 0x00, 0x43, 0x00, 0x92, 0x00, 0xbe, 0x00, 0x6c, 0x05, 0x00,
+    0x00, 0x36, 0x00, 0xc0, 0x00, 0x15, 0x02, 0x00, 0x00, 0x35, 0x00, 0xbe, 0x00, 0xbd, 0x00, 0x56,
+    0x03, 0x00, 0x00, 0x5c, 0x00, 0xbe, 0x00, 0xa1, 0x00, 0x0d, 0x00, 0x0c, 0x00, 0xac, 0x00, 0xbe,
+    0x00, 0x48, 0x02, 0x00, 0x00, 0x21, 0x00, 0xb6, 0x00, 0xb4, 0x00, 0x48, 0x00, 0xb0, 0x00, 0x15,
+    0x03, 0x00, 0x00, 0x1f, 0x00, 0xbd, 0x00, 0x79, 0x00, 0x5a, 0x00, 0xbe, 0x00, 0x8c, 0x01, 0x00,
+    0x00, 0x4f, 0x00, 0xbe, 0x00, 0xaf, 0x00, 0x15, 0x04, 0x00, 0x00, 0x3c, 0x00, 0x28, 0x00, 0x73,
+    0x00, 0xbd, 0x00, 0x5e, 0x05, 0x00, 0x00, 0x17, 0x00, 0xab, 0x00, 0xa5, 0x00, 0x11, 0x05, 0x00,
+    0x00, 0x7f, 0x00, 0xc4, 0x00, 0x44, 0x01, 0x00, 0x00, 0x56, 0x00, 0xbd, 0x00, 0xaf, 0x00, 0x9d,
+    0x00, 0x17, 0x00, 0x00, 0x00, 0x48, 0x00, 0xa8, 0x00, 0x07, 0x03, 0x00, 0x00, 0x3c, 0x00, 0xc6,
+    0x00, 0x66, 0x00, 0x77, 0x00, 0xc3, 0x00, 0x79, 0x01, 0x00, 0x00, 0x6d, 0x00, 0xbd, 0x00, 0x9c,
+    0x00, 0x07, 0x04, 0x00, 0x00, 0x43, 0x00, 0x29, 0x00, 0x9a, 0x00, 0xbe, 0x00, 0x44, 0x03, 0x00,
+    0x00, 0x70, 0x00, 0xc3, 0x00, 0x7f, 0x03, 0x00, 0x00, 0x30, 0x00, 0xb3, 0x00, 0xac, 0x00, 0x13,
+    0x7e, 0x00, 0x07, 0x56, 0x00, 0x4d, 0x00, 0x88, 0x01, 0xbd, 0x00, 0x8a, 0x00, 0x04, 0x00, 0x00,
+    0x00, 0x42, 0x00, 0xbe, 0x00, 0xbd, 0x00, 0x92, 0x00, 0x4d, 0x06, 0x56, 0x00, 0x5c, 0x00, 0x15,
+    0x00, 0x11, 0x00, 0xac, 0x00, 0xbc, 0x00, 0xac, 0x00, 0x54, 0x05, 0x56, 0x00, 0xb3, 0x00, 0xb2,
+    0x00, 0x8e, 0x00, 0xb3, 0x00, 0xbd, 0x00, 0x47, 0x00, 0xa1, 0x00, 0xbd, 0x00, 0x92, 0x00, 0x17,
+    0x00, 0x5c, 0x02, 0x56, 0x00, 0x5c, 0x00, 0x4d, 0x00, 0x92, 0x00, 0xbd, 0x00, 0xa2, 0x00, 0x0c,
+    0x04, 0x00, 0x00, 0x55, 0x00, 0xc3, 0x00, 0x51, 0x02, 0x00, 0x00, 0x0c, 0x00, 0xa2, 0x00, 0xb6,
+    0x00, 0x17, 0x03, 0x00, 0x00, 0x6b, 0x00, 0xbd, 0x00, 0xac, 0x00, 0x13, 0x00, 0x0b, 0x00, 0xac,
+    0x00, 0xbe, 0x00, 0x5c, 0x01, 0x00, 0x00, 0x03, 0x00, 0x56, 0x00, 0xbd, 0x00, 0xb3, 0x00, 0x44,
+    0x00, 0xb6, 0x00, 0x6c, 0x00, 0x02, 0x02, 0x00, 0x00, 0x1f, 0x00, 0xbe, 0x00, 0x42, 0x00, 0x4c,
+    0x00, 0xbe, 0x00, 0xa5, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x0c, 0x00, 0xa5, 0x00, 0xbd, 0x00, 0x80,
+    0x00, 0x0c, 0x02, 0x00, 0x00, 0x1f, 0x00, 0xb0, 0x00, 0x28, 0x00, 0x73, 0x00, 0xbd, 0x00, 0x5e,
+    0x05, 0x00, 0x00, 0x11, 0x00, 0xab, 0x00, 0xbd, 0x00, 0x8b, 0x00, 0x0c, 0x03, 0x00, 0x00, 0x1b,
+    0x00, 0xae, 0x00, 0x9b, 0x00, 0x07, 0x01, 0x00, 0x00, 0x16, 0x00, 0xaf, 0x00, 0xbc, 0x00, 0x6d,
+    0x01, 0x00, 0x00, 0x3f, 0x00, 0xc0, 0x00, 0x56, 0x03, 0x00, 0x00, 0x3b, 0x00, 0xc6, 0x00, 0x37,
+    0x00, 0x7f, 0x00, 0xbe, 0x00, 0x93, 0x00, 0x04, 0x00, 0x00, 0x00, 0x1b, 0x00, 0xb6, 0x00, 0xbd,
+    0x00, 0x66, 0x00, 0x04, 0x02, 0x00, 0x00, 0x36, 0x00, 0xa5, 0x00, 0x1b, 0x00, 0x9a, 0x00, 0xbe,
+    0x00, 0x48, 0x03, 0x00, 0x00, 0x6f, 0x00, 0xc3, 0x00, 0x7f, 0x03, 0x00, 0x00, 0x31, 0x00, 0xb3,
+    0x00, 0xac, 0x00, 0x17, 0x7e, 0x00, 0x00, 0xbf, 0x07, 0xbd, 0x00, 0xbc, 0x00, 0xbe, 0x00, 0x8a,
+    0x00, 0x0b, 0x02, 0x00, 0x00, 0x63, 0x00, 0xbe, 0x00, 0xbc, 0x07, 0xbd, 0x00, 0xc5, 0x00, 0x2c,
+    0x00, 0x00, 0x00, 0x35, 0x00, 0xb3, 0x07, 0xbd, 0x01, 0xb2, 0x00, 0xb3, 0x00, 0xb1, 0x00, 0x9a,
+    0x00, 0x47, 0x00, 0xbd, 0x00, 0xbe, 0x00, 0x4d, 0x00, 0x1b, 0x00, 0xc5, 0x03, 0xbd, 0x00, 0xbe,
+    0x00, 0xb3, 0x00, 0xb2, 0x00, 0xbd, 0x00, 0x35, 0x02, 0x00, 0x00, 0x37, 0x00, 0x5c, 0x00, 0xb3,
+    0x00, 0xb1, 0x00, 0xb3, 0x00, 0x6c, 0x00, 0x38, 0x01, 0x00, 0x00, 0x6d, 0x00, 0x8b, 0x01, 0x00,
+    0x00, 0x07, 0x00, 0x37, 0x00, 0x5e, 0x00, 0xac, 0x00, 0xb1, 0x00, 0xb3, 0x00, 0x89, 0x00, 0x3e,
+    0x00, 0x8d, 0x00, 0xbb, 0x00, 0xb3, 0x00, 0x66, 0x00, 0x51, 0x00, 0x80, 0x00, 0x66, 0x00, 0x9a,
+    0x00, 0xbb, 0x00, 0x95, 0x00, 0xb3, 0x00, 0xc0, 0x00, 0x75, 0x00, 0x1a, 0x00, 0x11, 0x00, 0x19,
+    0x00, 0x95, 0x00, 0x93, 0x00, 0x06, 0x00, 0x3d, 0x00, 0xbf, 0x00, 0xb3, 0x00, 0x92, 0x00, 0x63,
+    0x00, 0x62, 0x00, 0x61, 0x00, 0x9a, 0x00, 0xbe, 0x00, 0x92, 0x00, 0x59, 0x00, 0x4a, 0x00, 0x63,
+    0x00, 0xa5, 0x00, 0x4e, 0x00, 0x35, 0x00, 0xac, 0x00, 0xb1, 0x00, 0xa3, 0x00, 0x43, 0x00, 0x16,
+    0x03, 0x00, 0x00, 0x0c, 0x00, 0xab, 0x00, 0xa2, 0x00, 0xb3, 0x00, 0x9b, 0x00, 0x3d, 0x01, 0x0f,
+    0x00, 0x35, 0x00, 0xa5, 0x00, 0x9b, 0x00, 0x1b, 0x03, 0x00, 0x00, 0x77, 0x00, 0xbe, 0x00, 0x28,
+    0x01, 0x00, 0x00, 0x3f, 0x00, 0xbf, 0x00, 0xb5, 0x00, 0x5c, 0x00, 0x15, 0x00, 0x11, 0x00, 0x26,
+    0x00, 0xa5, 0x00, 0x77, 0x00, 0x03, 0x00, 0x50, 0x00, 0xbe, 0x00, 0xb3, 0x00, 0x7e, 0x00, 0x63,
+    0x00, 0x6b, 0x00, 0x59, 0x00, 0xab, 0x00, 0xbe, 0x00, 0x89, 0x00, 0x59, 0x00, 0x4a, 0x00, 0x6c,
+    0x00, 0xa5, 0x00, 0x3d, 0x00, 0x42, 0x00, 0xb3, 0x00, 0xbc, 0x00, 0x9b, 0x00, 0x36, 0x01, 0x02,
+    0x00, 0x2f, 0x00, 0xa3, 0x00, 0xbc, 0x00, 0xac, 0x00, 0x47, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x21,
+    0x00, 0x78, 0x00, 0xbd, 0x00, 0xb2, 0x00, 0x78, 0x00, 0x21, 0x7d, 0x00, 0x00, 0xb6, 0x00, 0xb1,
+    0x05, 0xb2, 0x00, 0xb3, 0x00, 0xa5, 0x00, 0x46, 0x00, 0x04, 0x04, 0x00, 0x00, 0x40, 0x00, 0xa5,
+    0x00, 0xb3, 0x00, 0xb1, 0x05, 0xb2, 0x00, 0xbe, 0x00, 0x2c, 0x01, 0x00, 0x00, 0x1f, 0x00, 0x8a,
+    0x00, 0xb4, 0x00, 0xb1, 0x06, 0xb2, 0x00, 0xb1, 0x00, 0xbd, 0x00, 0x63, 0x00, 0x75, 0x00, 0xbd,
+    0x00, 0xb3, 0x00, 0x1b, 0x00, 0x19, 0x00, 0xbf, 0x00, 0xb1, 0x05, 0xb2, 0x00, 0xbd, 0x00, 0x77,
+    0x02, 0x00, 0x00, 0x84, 0x00, 0x83, 0x02, 0x7a, 0x00, 0x82, 0x00, 0x7b, 0x00, 0x07, 0x00, 0x00,
+    0x00, 0x10, 0x00, 0x1b, 0x01, 0x00, 0x00, 0x1c, 0x00, 0x8e, 0x00, 0x83, 0x00, 0x82, 0x01, 0x7a,
+    0x00, 0x82, 0x00, 0x8e, 0x00, 0x3f, 0x00, 0x5c, 0x00, 0x99, 0x00, 0xa1, 0x00, 0x94, 0x00, 0x35,
+    0x00, 0x00, 0x00, 0x2f, 0x00, 0x93, 0x00, 0x9a, 0x00, 0x81, 0x00, 0x30, 0x00, 0x6d, 0x00, 0x9b,
+    0x00, 0x9d, 0x00, 0x92, 0x00, 0x56, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x56, 0x01, 0x9a,
+    0x00, 0x95, 0x00, 0x4d, 0x00, 0x0c, 0x00, 0x10, 0x00, 0x66, 0x00, 0x9a, 0x00, 0xa1, 0x00, 0x9b,
+    0x00, 0x81, 0x00, 0x19, 0x00, 0x3f, 0x00, 0x8e, 0x01, 0x7a, 0x00, 0x82, 0x00, 0x83, 0x00, 0x68,
+    0x03, 0x00, 0x00, 0x06, 0x00, 0x6f, 0x00, 0x1b, 0x00, 0x26, 0x00, 0x78, 0x00, 0x9b, 0x00, 0x9c,
+    0x00, 0x9b, 0x00, 0x93, 0x00, 0x4f, 0x00, 0x07, 0x04, 0x00, 0x00, 0x44, 0x00, 0x95, 0x00, 0x04,
+    0x01, 0x00, 0x00, 0x28, 0x00, 0x68, 0x00, 0x28, 0x00, 0x80, 0x00, 0x9b, 0x00, 0x9d, 0x00, 0x92,
+    0x00, 0x47, 0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x66, 0x01, 0x9a, 0x00, 0x8c, 0x00, 0x41,
+    0x00, 0x07, 0x00, 0x1b, 0x00, 0x6e, 0x00, 0x9b, 0x00, 0xa2, 0x00, 0x9b, 0x00, 0x6e, 0x00, 0x14,
+    0x00, 0x49, 0x00, 0x8e, 0x01, 0x7a, 0x00, 0x82, 0x00, 0x83, 0x00, 0x0c, 0x00, 0x16, 0x00, 0x8e,
+    0x00, 0x82, 0x00, 0x7a, 0x00, 0x82, 0x00, 0x83, 0x00, 0x37, 0x00, 0x07, 0x00, 0x7c, 0x00, 0x82,
+    0x01, 0x7a, 0x00, 0x82, 0x00, 0x7c, 0xd3, 0x00, 0x00, 0x04, 0x00, 0x07, 0x08, 0x00, 0x00, 0x04,
+    0x00, 0x08, 0x06, 0x00, 0x00, 0x03, 0x05, 0x00, 0x00, 0x09, 0x00, 0x04, 0x11, 0x00, 0x00, 0x04,
+    0x00, 0x0d, 0x00, 0x08, 0x07, 0x00, 0x00, 0x6d, 0x00, 0x42, 0x06, 0x00, 0x00, 0x05, 0x00, 0x08,
+    0x05, 0x00, 0x00, 0x01, 0x00, 0x03, 0x04, 0x00, 0x00, 0x03, 0x00, 0x09, 0x00, 0x04, 0xff, 0x00,
+    0x20, 0x00, 0x00, 0x04, 0x01, 0x00, 0x00, 0x28, 0x00, 0x95, 0x00, 0x06, 0xff, 0x00, 0x38, 0x00,
+    0x00, 0x4f, 0x00, 0x9e, 0x00, 0x1b, 0x00, 0x05, 0x00, 0x95, 0x00, 0x3c, 0xff, 0x00, 0x38, 0x00,
+    0x00, 0x0d, 0x00, 0xaf, 0x00, 0xbc, 0x00, 0x9b, 0x00, 0x6d, 0x00, 0x63, 0xff, 0x00, 0x3a, 0x00,
+    0x00, 0x4e, 0x01, 0xbf, 0x00, 0x66, 0x00, 0x07, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0x23, 0x00,
 #else
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x8163,0xAAC5,0xBB87,0xBBA8,0xBBA8,0xBBA8,0xBBA8,0xBBA8,0xBBA8,0xC3C8,0xAB28,0x6020,0x6000,0x6000,0x7902,0xA2A5,0xBB87,0xBBA8,0xBBA8,0xBBA8,0xBBA8,0xBBA8,0xBBA8,0xBBA8,0xC3E8,0x8183,0x6000,0x6000,0x6861,0x9A45,0xB346,0xBBA8,0xBBA8,0xBBA8,0xBBA8,0xBBA8,0xBBA8,0xBBA8,0xC3C8,0x89E5,0x6000,0x6000,0x6000,0x6000,0x6000,0x89A3,0xC3E8,0xDC88,0xD468,0xB367,0x7102,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xB389,0xBB88,0xB367,0xB367,0xB367,0xB368,0x68A1,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x81A5,0xBB88,0xB367,0xB367,0xB368,0xBBC9,0x81A4,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x7943,0xBB67,0xD489,0xCC06,0xD489,0xC3E8,0x89A3,0x7923,0xAB27,0x6061,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6861,0xAB06,0xDC67,0xDC87,0xDC67,0xDC66,0xDC66,0xDC66,0xDC66,0xDC66,0xDC66,0xE486,0xCC08,0x6041,0x6000,0x9204,0xD447,0xDC87,0xDC87,0xDC66,0xDC66,0xDC66,0xDC66,0xDC66,0xDC66,0xDC66,0xE4A7,0x91E3,0x6000,0x7923,0xC3E7,0xDC87,0xDC87,0xDC66,0xDC66,0xDC66,0xDC66,0xDC66,0xDC66,0xDC66,0xE487,0x9A86,0x6000,0x6000,0x6000,0x6000,0x89C4,0xDC88,0xDC66,0xD447,0xD447,0xDC67,0xCC07,0x70E2,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9246,0xAB06,0xD467,0xDC66,0xDC66,0xDC87,0x9A86,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xAB07,0xE487,0xDC66,0xDC87,0xBB66,0x9A86,0x70E2,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6881,0x70E3,0x68A2,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x89E4,0xD467,0xC3C7,0x8184,0x6881,0x8184,0xB326,0xDC88,0xD447,0xCC07,0x68A2,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x68A2,0x7103,0x6881,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0xB346,0xDC87,0xDC67,0xCC07,0xBBA7,0xBBA7,0xBBA7,0xBBA7,0xBBA7,0xBBA7,0xBBA7,0xC3C7,0xAB27,0x6000,0x8163,0xDC67,0xDC66,0xD427,0xBB87,0xBBA8,0xBBA8,0xBBA8,0xBBA8,0xBBA8,0xBBA8,0xBBA8,0xC3C8,0x8163,0x6861,0xC3E7,0xDC67,0xD467,0xC3C7,0xBBA8,0xBBA8,0xBBA8,0xBBA8,0xBBA8,0xBBA8,0xBBA8,0xC3C8,0x89E5,0x6000,0x6000,0x6000,0x6841,0xC3E7,0xDC67,0xCC07,0x9245,0x9A85,0xD447,0xDC87,0xAAE6,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xA2C6,0xDCA9,0xCC69,0xDC66,0xC3C7,0x6040,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6881,0xC408,0xD489,0xD447,0xCC27,0x70E3,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xA2A5,0xDC67,0xB388,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x7903,0xD448,0xCC28,0x6881,0x6000,0x6000,0x6000,0x6000,0xAB06,0xE487,0xCC08,0x68C2,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xBB88,0xDC67,0xAB28,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9204,0xDC87,0xDC67,0xBB87,0x9A46,0xB347,0xB367,0xB367,0xB367,0xB367,0xB367,0xB367,0xBB67,0xA2E6,0x6020,0xBB87,0xDC67,0xCC27,0x9A86,0xAB06,0xB367,0xB367,0xB367,0xB367,0xB367,0xB367,0xB367,0xBB87,0x7943,0x9225,0xDC87,0xDC67,0xAAC6,0xA2A6,0xBB67,0xB367,0xB367,0xB367,0xB367,0xB367,0xB367,0xBB87,0x89A4,0x6000,0x6000,0x6000,0x8163,0xD467,0xDC67,0xA286,0xC3C7,0xAB06,0xB346,0xDC67,0xCC28,0x6861,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x89C5,0xD48A,0xA2E7,0xDC67,0xD488,0x8163,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x89C4,0xCC08,0xB389,0xDC67,0xCC07,0x70C2,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xAAC5,0xE487,0xBBA8,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xA2A6,0xE4A7,0xAAE5,0x6000,0x6000,0x6000,0x6000,0x6000,0x68A2,0xCC27,0xCC48,0x70C3,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xBBA8,0xE487,0xB348,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xC3C8,0xDC66,0xCBE7,0x9A86,0xD447,0xDC67,0xE487,0xDC87,0xDC87,0xDC87,0xDC87,0xDC87,0xE487,0xC3E8,0x7103,0xCC48,0xDC67,0xAB07,0xBB67,0xDC87,0xDC67,0xDC87,0xDC87,0xDC87,0xDC87,0xDC87,0xDC87,0xE4A7,0x89C4,0xB367,0xDC67,0xC3C7,0xA286,0xDC87,0xDC67,0xDC87,0xDC87,0xDC87,0xDC87,0xDC87,0xDC87,0xE4A7,0x9A86,0x6000,0x6000,0x6000,0xAAE6,0xDC87,0xCC07,0x9A66,0xDC67,0xCC07,0x9A86,0xDC67,0xDC67,0x89A4,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x89C5,0xD489,0x8184,0xCC27,0xDC87,0xAB27,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0xB367,0xA2A6,0xAAC6,0xDC87,0xCC07,0x70C2,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xA2A5,0xE487,0xBB88,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0xBBA8,0xDC66,0xBB87,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xAB07,0xD468,0x68C2,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xBBA8,0xE487,0xAB48,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xD489,0xDC66,0xA2C6,0xB346,0xDC67,0xCC07,0xB305,0xB325,0xB325,0xBB46,0xBB86,0xBBA7,0xC3A7,0xAB27,0x7923,0xD468,0xDC67,0x9A66,0xC3A5,0xDC67,0xCC07,0xB325,0xB325,0xB325,0xB325,0xB325,0xBB46,0xC3C7,0x8163,0xBB87,0xDC87,0xB306,0xA2C5,0xDC67,0xD447,0xBB66,0xB325,0xB325,0xB325,0xB325,0xB325,0xBB45,0x89C4,0x6000,0x6000,0x6841,0xCC07,0xDC67,0xB346,0xAB06,0xDC67,0xDC67,0x9A86,0xCC07,0xDC87,0xAB06,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x89C5,0xD4A9,0x6881,0xB367,0xDC66,0xCC28,0x68A2,0x6000,0x6000,0x6000,0x6000,0x70E2,0xCC49,0x7903,0xAAC6,0xDC87,0xCC07,0x70C2,0x6000,0x6000,0x6000,0x8163,0xAB07,0xC3E9,0xC3E9,0xAB27,0x8163,0x6000,0x6000,0x6000,0x6881,0x9A85,0xC3E9,0xC3E9,0xAB07,0x9205,0xBB88,0x91E4,0xBB66,0xDC67,0xC3E8,0x89E4,0x89C3,0x89C3,0x6041,0x6020,0x89E4,0xBB88,0xC409,0xBBA8,0x9204,0x6041,0x8143,0x91C3,0x91E4,0x9A45,0x8184,0x6000,0x89A4,0xB368,0xAB07,0x68A1,0x6000,0x6000,0xB327,0xDC66,0xD467,0x8184,0x6000,0x6000,0x6000,0x6000,0x6000,0x8163,0xDCA9,0x9A45,0x89C3,0x91E4,0x9204,0x70C1,0x6000,0x6020,0x89A4,0x91E3,0x89E4,0x91E4,0x89C3,0xA2C6,0xC3E9,0xC3E9,0xA2A6,0x9A46,0xB367,0x89C3,0xC3E8,0xDC67,0xBBC8,0x89C4,0x89C3,0x8983,0x6020,0x6861,0x9225,0xBBC9,0xC3E9,0xB368,0x89C4,0x6041,0x89A3,0x89C3,0x91E4,0x9A86,0x7923,0x6000,0x89A3,0xB368,0xC3E9,0xAAE6,0x70C2,0x6000,0x6000,0x7922,0xAAE6,0xC3C9,0xB368,0x8184,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xD488,0xDC66,0xA2A6,0xBB66,0xDC67,0xC3E7,0x9A65,0xA2A6,0x9A65,0x9225,0x7103,0x6000,0x6020,0x6000,0x7102,0xD468,0xDC67,0x9A66,0xC3A5,0xDC67,0xC3C7,0xA2A6,0xA2C6,0xA2C6,0xA2C6,0xAAE6,0x9205,0x6020,0x6000,0xBBA7,0xDC87,0xB326,0xA2C5,0xE487,0xC3E7,0x9225,0xAAC6,0xA2C6,0xA2C6,0xA2C6,0xA2C6,0xAAE6,0x8184,0x6000,0x6000,0x8184,0xDC67,0xDC67,0x9A86,0xC3E7,0xD467,0xDC67,0xB326,0xB326,0xDC87,0xCC07,0x6881,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x89C5,0xD4A9,0x6861,0x89C4,0xDC88,0xDC87,0x9225,0x6000,0x6000,0x6000,0x6000,0xA286,0xC3C8,0x6000,0xAAE6,0xDC87,0xCC07,0x70C2,0x6000,0x6020,0xA2C5,0xDC89,0xAAE6,0x7943,0x9A45,0xDC68,0xDC67,0x9225,0x6000,0x70A2,0xCBE7,0xCC28,0x9225,0x89E5,0xB347,0xDCA8,0xDC87,0xCC69,0xD468,0xD446,0xD468,0xCC69,0xD469,0xCC29,0x8185,0xBB87,0xD448,0xA2A6,0x8163,0xAB07,0xDC88,0xBB66,0xA2C7,0xCC28,0xE4A7,0xDC87,0xAB28,0xAB27,0xCC08,0xD467,0xE487,0xAAE7,0x6000,0x6000,0x9225,0xDC87,0xD447,0xD447,0x9A65,0x68A2,0x6000,0x6000,0x6000,0x70A2,0xB346,0xDCA8,0xDC87,0xDC88,0xBB87,0x7922,0x6000,0x6020,0x9A65,0xCC27,0xE4A7,0xDCA8,0xE4A8,0xC3C8,0x89E5,0x9205,0xBBA7,0xDCA8,0xDC87,0xCC49,0xD468,0xD446,0xD468,0xCC69,0xD469,0xC3E9,0x89C5,0xC3C7,0xCC48,0x9A65,0x8184,0xB347,0xDC88,0xB326,0xAB28,0xD468,0xE487,0xE487,0x9AA8,0xAB06,0xD449,0xC3C7,0xD468,0xE487,0xCC07,0x70C2,0x9204,0xD469,0xC3C7,0xCC48,0xDC87,0xD468,0x9205,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xC408,0xDC66,0xC3C7,0xA2A6,0xDC67,0xDC66,0xDC67,0xDC66,0xDC67,0xDC87,0xD427,0x9204,0x6000,0x6000,0x7102,0xD468,0xDC67,0x9A66,0xC3A5,0xDC66,0xDC46,0xDC66,0xDC66,0xDC66,0xDC66,0xE487,0xB347,0x6000,0x6000,0xBBA7,0xDC87,0xB326,0xA2C5,0xE487,0xC3C8,0xB347,0xE487,0xDC66,0xDC66,0xDC66,0xDC67,0xE487,0x9A66,0x6000,0x6000,0xAB06,0xDC67,0xCC07,0x9A86,0xD467,0xD447,0xD446,0xCC07,0x9A86,0xD467,0xDC67,0x89A4,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x89C5,0xD4A9,0x6881,0x6882,0xCC28,0xDC67,0xBB87,0x6020,0x6000,0x6000,0x6040,0xC3E8,0x9205,0x6000,0xAAE6,0xDC87,0xCC07,0x70C2,0x6000,0x9225,0xE4A7,0xD448,0x6881,0x6000,0x6000,0x9245,0xE487,0xD448,0x68A2,0xAB26,0xDCA9,0x7944,0x6000,0x6000,0x6000,0xA2A6,0xD448,0x7965,0xAAE6,0xDC87,0xBBC8,0x68A2,0x68A2,0x70C3,0xBBA8,0xDCA8,0x89C4,0x6000,0x6000,0x6000,0xAB07,0xE4A7,0xB326,0x7103,0xCC07,0xD446,0xCC28,0xA2A6,0x7103,0xD489,0xDC66,0xB368,0x6000,0x6000,0x6861,0xC3A7,0xDC87,0xD446,0xDC87,0xCC27,0xAB07,0x8143,0x6000,0x6000,0x6000,0xA2A6,0xDC87,0xD448,0x7903,0x6000,0x6000,0x6000,0x6000,0x89C5,0xD489,0xD489,0xCC48,0x6882,0x6000,0x6000,0x6020,0xB347,0xD469,0x7103,0xBBA7,0xDC87,0xB388,0x6882,0x68A2,0x7923,0xC3E8,0xD448,0x7923,0x6000,0x6000,0x6020,0xBB87,0xE4A7,0x9A85,0x8164,0xD447,0xD447,0xCC49,0x9A86,0x6881,0x6020,0x81A4,0xD447,0xDC66,0xCC28,0xAB06,0x70C2,0x6020,0x70E3,0xC3E7,0xDC66,0xC3E8,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A65,0xDC87,0xD467,0xB347,0xA2A6,0xC3A7,0xC3E8,0xC3E8,0xC3E7,0xD447,0xDC67,0xDC87,0x9A45,0x6000,0x7102,0xD468,0xDC67,0x9A86,0xB346,0xC3E8,0xC3E8,0xC3E8,0xC3E8,0xC3E8,0xC3E8,0xCC08,0xA2C6,0x6000,0x6000,0xBBA7,0xDC87,0xB326,0xA2C5,0xE487,0xC3C7,0xA2C6,0xCC08,0xC3E8,0xC3E8,0xCC08,0xD467,0xDC67,0x9A65,0x6000,0x6861,0xCC07,0xDC67,0xB346,0xAB26,0xDC67,0xD446,0xD447,0xDC67,0x9A86,0xCBE7,0xDC67,0xB326,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x89C5,0xD4A9,0x68A1,0x6000,0xAB07,0xDC67,0xD468,0x7903,0x6000,0x6000,0x8183,0xCC28,0x68A2,0x6000,0xAAE6,0xDC87,0xCC07,0x70C2,0x6000,0xA285,0xE4A8,0xD467,0x70E2,0x6000,0x6000,0x8164,0xD468,0xDC87,0x7923,0xBB86,0xDC88,0x7103,0x6000,0x6000,0x6000,0x6881,0xCC29,0x7944,0xA2A5,0xE487,0xBBA8,0x6000,0x6000,0x89E4,0xE4A7,0xBB87,0x6000,0x6000,0x6000,0x6000,0x8163,0xDC88,0xD488,0x7923,0xB325,0xDC67,0xB347,0x6000,0x6000,0x9A85,0xC3A7,0x8163,0x6000,0x6000,0x6000,0x68A2,0xBB87,0xDC87,0xDC67,0xDC66,0xDC67,0xDC88,0xBB87,0x8163,0x6000,0x6881,0xCC28,0xDC67,0xA2A6,0x6000,0x6000,0x6000,0x6000,0xA2A6,0xBBE9,0xCC48,0xCC48,0x6861,0x6000,0x6000,0x6000,0x7903,0xCC6A,0x70A2,0xBB66,0xE487,0xB368,0x6000,0x6000,0xA2A6,0xE487,0xAB07,0x6000,0x6000,0x6000,0x6000,0x9A46,0xDC87,0xCC48,0x6881,0xC3E7,0xDC87,0xAB07,0x6000,0x6000,0x6000,0x6000,0xBB87,0xDC87,0xC3E7,0x6020,0x6000,0x6000,0x6000,0x9A66,0xDC87,0xCC07,0x70A2,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6861,0xC3A7,0xDC67,0xDC67,0xBB86,0xAAE6,0xAB27,0xAB26,0xAAC6,0x9A65,0xCC27,0xDC67,0xD467,0x7902,0x70E2,0xD468,0xDC67,0x9A86,0xA285,0xAB27,0xAB06,0xAB06,0xAB06,0xAB06,0xAB07,0xB326,0x9205,0x6000,0x6000,0xBBA7,0xDC87,0xB326,0xA2C5,0xE487,0xC3E7,0x9225,0xB326,0xAB06,0xB306,0x9A46,0xD448,0xDC67,0x9A65,0x6000,0x81A4,0xDC87,0xDC67,0x9A86,0xCBE7,0xD447,0xD447,0xD467,0xDC67,0xB346,0xAB26,0xDC67,0xCC27,0x6881,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x89C5,0xD4A9,0x68A1,0x6000,0x8184,0xDC88,0xDC67,0xA2C6,0x6000,0x6000,0xB367,0xAB06,0x6000,0x6000,0xAAE6,0xDC87,0xCC07,0x70C2,0x6000,0x6881,0xAB07,0x9205,0x6000,0x6000,0x6000,0x7944,0xD468,0xDC67,0x7902,0xBB86,0xE487,0xBB87,0x7943,0x6000,0x6000,0x6000,0x70A1,0x6040,0xAAC5,0xE487,0xBBA8,0x6020,0x6020,0xBBA8,0xE4A7,0xA2A6,0x6000,0x6000,0x6000,0x6000,0x7923,0xD468,0xDC87,0x7942,0xB305,0xDC67,0xA2E7,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0x89A4,0xB367,0xD468,0xDC67,0xDC67,0xDC67,0xDC67,0x9225,0x6000,0xAB07,0xDC67,0xC3E7,0x6861,0x6000,0x6000,0x6861,0xC408,0x89C4,0xCC27,0xDC67,0xAB06,0x7903,0x6000,0x6000,0x6000,0x70C1,0x6020,0xBBA7,0xE487,0xB368,0x6000,0x68A2,0xC3E8,0xDC87,0x89A3,0x6000,0x6000,0x6000,0x6000,0x89E5,0xD467,0xD447,0x7923,0xC3E7,0xDC87,0x9A66,0x6000,0x6000,0x6000,0x6000,0xB388,0xE487,0xBB87,0x6000,0x6000,0x6000,0x6000,0x89E5,0xD467,0xCC27,0x7923,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x70C2,0xC3A7,0xDC87,0xDC87,0xE487,0xE487,0xE487,0xDC87,0xC3E7,0x9A66,0xD427,0xDC87,0xA2A5,0x70E2,0xD468,0xDC67,0x9A66,0xC3C6,0xDC87,0xDC87,0xE487,0xE487,0xE487,0xE487,0xE4A7,0xB367,0x6000,0x6000,0xBBA7,0xDC87,0xB326,0xA2C5,0xE487,0xC3C7,0xB367,0xE4A7,0xDC67,0xDC87,0xAAE7,0xCC27,0xDC67,0x9A65,0x6000,0xAB06,0xDC87,0xCC07,0x9A66,0xDC67,0xDC67,0xAB27,0xC3C7,0xDC66,0xCC07,0x9A66,0xD467,0xDC67,0x89C4,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x89C5,0xD4A9,0x68A1,0x6000,0x6020,0xC3E8,0xDC67,0xC3E8,0x6041,0x68A1,0xCC49,0x7943,0x6000,0x6000,0xAAE6,0xDC87,0xCC07,0x70C2,0x6000,0x6000,0x6000,0x6000,0x6000,0x7922,0xA2A6,0xCC08,0xD467,0xDC67,0x7902,0x9A46,0xDC87,0xDC67,0xD468,0xBBA7,0x9A66,0x70C2,0x6000,0x6000,0xAAC5,0xE487,0xBBA8,0x6020,0x6040,0xCC28,0xDC67,0xCC07,0xBB86,0xBB86,0xBB86,0xBB86,0xC3C7,0xDC67,0xE487,0x8183,0xAAE4,0xDC87,0xAB07,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x70E2,0xA2A6,0xC3E7,0xDC67,0xD446,0xDC88,0x7923,0x7903,0xD488,0xDC67,0x89E4,0x6000,0x6000,0x89E4,0xBBC8,0x6020,0xA2E6,0xDC87,0xDC67,0xD468,0xBB87,0x9225,0x68A2,0x6000,0x6000,0xBBA7,0xE487,0xB368,0x6000,0x7902,0xD488,0xD447,0xC3C6,0xBB86,0xBB86,0xBB86,0xBB86,0xCBE7,0xDC67,0xDC67,0x89C5,0xC3C7,0xDC87,0x9A87,0x6000,0x6000,0x6000,0x6000,0xB388,0xE487,0xBB87,0x6000,0x6000,0x6000,0x6000,0x89E5,0xD467,0xCC27,0x7903,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6041,0x9225,0xBB87,0xBB85,0xBB85,0xBB85,0xD427,0xDC87,0xAAE6,0xBB87,0xDC67,0xBBA7,0x7923,0xD468,0xDC67,0x9A66,0xC3A5,0xDC67,0xCC06,0xBB65,0xBB85,0xBB85,0xBB85,0xC3A6,0xA286,0x6000,0x6000,0xBBA7,0xDC87,0xB326,0xA2C5,0xE487,0xC3C7,0xA285,0xCBC6,0xD447,0xDC67,0xA2E7,0xCC27,0xDC67,0x9A45,0x6041,0xCC27,0xDC67,0xB326,0xB326,0xDC67,0xDC67,0x7943,0xA285,0xDC67,0xDC67,0x9A86,0xC3E7,0xDC87,0xB326,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x89C5,0xD4A9,0x68A1,0x6000,0x6000,0x9A86,0xDC87,0xDC87,0x8164,0x9225,0xC3E8,0x6000,0x6000,0x6000,0xAAE6,0xDC87,0xCC07,0x70C2,0x6000,0x6000,0x6881,0x9A66,0xC3C7,0xCC08,0xA2C6,0x9226,0xD447,0xDC87,0x7902,0x6020,0x9A86,0xD448,0xDC87,0xE487,0xDC87,0xCC48,0x9204,0x6000,0xAAC5,0xE487,0xBBA8,0x6000,0x68A2,0xCC07,0xDC87,0xB327,0x8162,0x89A3,0x89A3,0x89A3,0x8983,0x8183,0x8983,0x6861,0xB345,0xDC67,0xAB07,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6881,0x8163,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6861,0xBB67,0xDC67,0xDC67,0xB348,0x6000,0xBB87,0xDC66,0xBB87,0x6000,0x6000,0xBB88,0x9225,0x6000,0x6841,0xA2C6,0xD468,0xDC87,0xE487,0xDC87,0xCC07,0x89C4,0x6000,0xBBA7,0xE487,0xB368,0x6000,0x7902,0xDC88,0xD467,0xA285,0x8163,0x89A3,0x89A3,0x89A3,0x8983,0x8183,0x8183,0x68A2,0xCC07,0xDC87,0x9A87,0x6000,0x6000,0x6000,0x6000,0xB388,0xE487,0xBB87,0x6000,0x6000,0x6000,0x6000,0x89E5,0xD467,0xCC27,0x7103,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xA2C7,0xA2C6,0xA2C6,0xA2A6,0xA2C6,0x9A66,0x9A66,0x9A66,0xCC07,0xDC87,0xB326,0xB367,0xDC67,0xC3E8,0x7943,0xD468,0xDC67,0x9A66,0xC3A5,0xDC67,0xC3C7,0x9A66,0x9A86,0x9A86,0x9A86,0x9A86,0xA2A6,0xAB07,0x7902,0xBB87,0xDC87,0xB306,0xA2C5,0xDC67,0xD447,0xA286,0xA2C6,0xD447,0xDC67,0xA2E7,0xCC27,0xDC67,0x9225,0x8184,0xDC87,0xDC67,0x9A66,0xCC07,0xD446,0xD468,0xBB66,0xC3C7,0xD447,0xDC67,0xB346,0xAB06,0xDC67,0xCC27,0x6881,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x89C5,0xD4AA,0x68A1,0x6000,0x6000,0x7903,0xD468,0xDC67,0xB368,0xBBA7,0x9225,0x6000,0x6000,0x6000,0xAAE6,0xDC87,0xCC07,0x70C2,0x6000,0x7923,0xCBE7,0xE4A8,0xA2C6,0x6881,0x6000,0x7944,0xD468,0xDC88,0x78E2,0x6000,0x6000,0x70C2,0x9A45,0xBBA7,0xD467,0xDC67,0xD467,0x8184,0xA284,0xE487,0xBBA8,0x6020,0x6861,0xCC27,0xDC87,0xA2A6,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xBB66,0xDC67,0xAB07,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x8184,0xD468,0x70E2,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x70E2,0xD428,0xDC67,0xBBA7,0x6000,0x9205,0xDC87,0xD447,0x7943,0x70E2,0xCC08,0x6861,0x6000,0x6000,0x6000,0x7902,0xA286,0xC3C7,0xD467,0xDC66,0xD467,0x7902,0xBB86,0xE487,0xB368,0x6000,0x7902,0xDC88,0xDC67,0x89A3,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0xCC07,0xDC87,0x9A87,0x6000,0x6000,0x6000,0x6000,0xB388,0xE487,0xBB87,0x6000,0x6000,0x6000,0x6000,0x89E5,0xD467,0xCC27,0x7103,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xDCA8,0xDC66,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0x9A86,0xCBE7,0xDC87,0xB326,0x70E3,0xD468,0xDC67,0xA2C6,0xC3A6,0xDC67,0xD446,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xE4A7,0x89A3,0xBB87,0xDC67,0xBB67,0xA2C6,0xDC87,0xD446,0xDC67,0xDC66,0xD446,0xDC67,0xAAE7,0xCC27,0xDC67,0x9245,0xAAE6,0xDC67,0xCBE7,0x9A86,0xD467,0xD446,0xC429,0xD488,0xDC66,0xD446,0xD446,0xCC07,0x9A66,0xD467,0xDC87,0x89C4,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x89C5,0xD4A9,0x6881,0x6000,0x6000,0x6000,0xBB87,0xDC67,0xDC88,0xCC28,0x68A2,0x6000,0x6000,0x6000,0xAAE6,0xDC87,0xCC07,0x70C2,0x6020,0xC3E8,0xE487,0xB326,0x6000,0x6000,0x6000,0x8184,0xD468,0xD467,0x89E5,0x9A66,0x6000,0x6000,0x6000,0x6000,0x8163,0xC3C7,0xDC66,0xB368,0xA2A5,0xDC87,0xBBA8,0x6020,0x6020,0xC409,0xDC66,0xB347,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xBB66,0xDC67,0xAB07,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x7944,0xD467,0xA2A6,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xBB87,0xE487,0xBBA8,0x6000,0x6881,0xCC08,0xDC67,0xA2C6,0xA2C6,0xA2C6,0x6000,0x81A4,0x9205,0x6000,0x6000,0x6000,0x6000,0x81A4,0xCC07,0xDC87,0xAB07,0xBB67,0xE487,0xB368,0x6000,0x70E2,0xCC48,0xDC46,0xA2C7,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0xCC07,0xDC87,0x9A87,0x6000,0x6000,0x6000,0x6000,0xB388,0xE487,0xBB87,0x6000,0x6000,0x6000,0x6000,0x89E5,0xD467,0xCC27,0x7103,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xCC28,0xCC08,0xCC08,0xCC08,0xCC08,0xCC08,0xCC08,0xCC28,0xC3C7,0x9A65,0xAB06,0xDC67,0xDC87,0x89E4,0x6020,0xC3C7,0xDC67,0xC3C7,0x9A86,0xC3C7,0xCC28,0xCC08,0xCC08,0xCC08,0xCC08,0xCC08,0xCC08,0xD448,0x8163,0xA2A6,0xDC87,0xD447,0xA2C7,0xB367,0xCC28,0xCC08,0xCC08,0xCC08,0xCC28,0x9AA6,0xCC28,0xDC67,0x9A45,0xC3C7,0xDC67,0xB326,0xB326,0xDC67,0xD447,0xA2A6,0xCC28,0xCC28,0xCC28,0xCC28,0xD448,0x9A66,0xC3C7,0xDC87,0xB326,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x9205,0xDC88,0x7902,0x6000,0x6000,0x6000,0x89E4,0xDC87,0xDC67,0xA2E6,0x6000,0x6000,0x6000,0x6000,0xAAE6,0xDC87,0xCC07,0x70C2,0x70C2,0xD447,0xDC87,0x9A66,0x6000,0x6000,0x6000,0x8184,0xD488,0xD468,0x9A66,0xD489,0x7102,0x6000,0x6000,0x6000,0x6000,0x8163,0xDC67,0xBB88,0xA2C5,0xDC87,0xC3E8,0x6020,0x6000,0xA2A6,0xDC87,0xD468,0x7102,0x6000,0x6000,0x6000,0x6000,0x6000,0x9205,0x8184,0xB325,0xDC67,0xAB07,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x7103,0xD427,0xCC28,0x70E2,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xBB87,0xE4A7,0x9A66,0x6000,0x6000,0xA2C6,0xDC67,0xD448,0xC408,0x7903,0x6000,0x9A86,0xCC69,0x6881,0x6000,0x6000,0x6000,0x6000,0x9205,0xE4C8,0xAB27,0xBB67,0xE487,0xB388,0x6000,0x6020,0xB347,0xDC67,0xC3E8,0x6881,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A46,0x81A4,0xC3E7,0xDC87,0x9A86,0x6000,0x6000,0x6000,0x6000,0xB388,0xE487,0xBB87,0x6000,0x6000,0x6000,0x6000,0x89E5,0xD467,0xCC27,0x7103,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xA2C6,0xA2C6,0xA2C6,0xA2C6,0xA2C6,0xA2C6,0xA2C6,0xA2C6,0xA285,0xBB86,0xDC67,0xDC67,0xBBA7,0x6041,0x6000,0x9A45,0xDC87,0xDC67,0xC3C7,0xA285,0xA2C6,0xA2C6,0xA2C6,0xA2C6,0xA2C6,0xA2C6,0xA2C6,0xAAE6,0x70E2,0x70E2,0xD447,0xDC66,0xCC27,0xA2C5,0xA2C6,0xA2C6,0xA2C6,0xA2C6,0xA2C6,0xA2C6,0xD467,0xD447,0xC3E9,0xD467,0xDC67,0x9A66,0xCC07,0xDC67,0xC3C7,0x7923,0xAAE6,0xA2E6,0xA2E6,0xA2E6,0xAAE6,0x9A85,0xC3C7,0xDC67,0xCC27,0x68A2,0x6000,0x6000,0x6000,0x6000,0x6000,0xA2A6,0xE487,0xA2C7,0x6000,0x6000,0x6000,0x68A2,0xCC07,0xDC68,0x7923,0x6000,0x6000,0x6000,0x6000,0xB326,0xDC67,0xCC27,0x7103,0x68A1,0xD447,0xDC87,0xAAE6,0x6000,0x6000,0x6040,0xA2C6,0xDC67,0xD467,0x9A66,0xD488,0xB346,0x6020,0x6000,0x6000,0x6000,0x8163,0xDC87,0x9A45,0xA285,0xDC87,0xCC28,0x70C2,0x6000,0x68A2,0xCC28,0xDC67,0xBB87,0x68A2,0x6000,0x6000,0x6000,0x8163,0xD469,0x81A4,0xB325,0xDC67,0xAB07,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x70C2,0xCC27,0xDC67,0xC3C8,0x70C2,0x6000,0x6000,0x6000,0x6000,0x7943,0xD447,0xCBE7,0x6881,0x6000,0x6000,0x7903,0xD468,0xDC66,0xB367,0x6000,0x6000,0x9246,0xDCA8,0xA2A6,0x6000,0x6000,0x6000,0x6000,0x9204,0xE4C8,0x9205,0xBB87,0xDC87,0xC3C7,0x6861,0x6000,0x7943,0xD468,0xDC67,0xAB27,0x6841,0x6000,0x6000,0x6000,0x9205,0xCC48,0x7943,0xC3E7,0xDC87,0x9A86,0x6000,0x6000,0x6000,0x6000,0xB368,0xE487,0xBBA7,0x6000,0x6000,0x6000,0x6000,0x89E5,0xD467,0xD427,0x7923,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xDC88,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC66,0xDC87,0xC3C7,0x70A1,0x6000,0x6000,0x6020,0xAB06,0xDC87,0xDC66,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xE4A8,0x89A3,0x6000,0x91E4,0xD447,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xDC67,0xD447,0xD447,0xD467,0xD446,0xC3E7,0x9A86,0xDC67,0xDC87,0xA2A5,0x7943,0xE4A8,0xDC67,0xDC67,0xDC67,0xDC67,0xDC87,0xD467,0xD447,0xDC67,0x89E4,0x6000,0x6000,0x6000,0x9205,0xAB06,0xD447,0xD446,0xD447,0xB326,0x9226,0x6020,0x6000,0xB347,0xC3C8,0x6020,0x6000,0x6881,0x9205,0xAB07,0xD447,0xD446,0xD467,0xBBA7,0x9246,0xC3E9,0xDC46,0xD447,0xAB07,0xA2C7,0xBB87,0xAB27,0xC3E7,0xDC46,0xC3E8,0xD447,0xDCA8,0xB346,0x7923,0x70C2,0x7922,0xC3E8,0xC3C7,0x6881,0x9205,0xDC88,0xD467,0xC3C7,0xAB06,0xAB05,0xAB28,0xC3E7,0xDC87,0xC3C7,0xAAE7,0x9AA7,0xAB06,0xCC28,0xA286,0x91E4,0xD447,0xD446,0xCC28,0x9A46,0x7903,0x6000,0x6000,0x6000,0x6000,0x70A2,0xCC27,0xCC07,0xD467,0xC3E7,0x9225,0x70C1,0x70C1,0x89E4,0xCC28,0xCBE7,0x7943,0x6000,0x6000,0x6000,0x6020,0xB367,0xDC87,0x89A4,0x6000,0x6000,0x9246,0xDC88,0xD467,0xAAE6,0x78E2,0x70C2,0x8163,0xCC28,0xBB67,0x6040,0xA2C7,0xDC87,0xD467,0xBB86,0xAB06,0xB326,0xAAE7,0xCC27,0xDC87,0xBB87,0xA2E7,0xA2A7,0xB326,0xCC28,0x9225,0x9A45,0xD447,0xDC66,0xC3E7,0x89E5,0x6020,0x6040,0x89C4,0xCC28,0xDC66,0xD427,0x9A66,0x68A1,0x6020,0x8164,0xBB87,0xDC67,0xD447,0xB367,0x8164,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xD468,0xD446,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD467,0xCC48,0x9A65,0x6861,0x6000,0x6000,0x6000,0x6000,0x6020,0x9224,0xCC28,0xD467,0xD446,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC87,0x89A3,0x6000,0x6000,0x8163,0xC3A7,0xD468,0xD446,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xD446,0xDC67,0xAB26,0xB346,0xDC67,0xD467,0x7943,0x7922,0xDC88,0xD446,0xD447,0xD447,0xD447,0xD447,0xD447,0xD447,0xDC67,0xB367,0x6000,0x6000,0x6000,0xBBC9,0xBBC9,0xBBA8,0xBB88,0xBB88,0xBBC8,0xBBA9,0x6881,0x6000,0x70C2,0x7943,0x6000,0x6000,0x8164,0xC3E9,0xBBC9,0xBBA8,0xBBA8,0xBBA8,0xBBA8,0xBBC9,0x9246,0xAAE6,0xCBE6,0xCC07,0xC3E8,0x9204,0x6000,0x89C4,0xC3C7,0xCBE7,0xBBA8,0x89E5,0xB347,0xCBE7,0xC408,0xC3C7,0xA2C6,0x6881,0x6000,0x6020,0xA2C6,0xC3E7,0xC3E7,0xC408,0xA285,0x70A2,0x70C2,0xAB27,0xC3E7,0xCC07,0xCC07,0xBBA8,0x7922,0x9246,0xC3E9,0xBBA8,0xBBA8,0xBBA8,0xBBC9,0xAB28,0x6000,0x6000,0x6000,0x6000,0x6861,0xB368,0x7923,0x8163,0xB367,0xCBE7,0xCC08,0xCC07,0xC3E7,0xA2A6,0x68A1,0x6000,0x6000,0x6000,0x6000,0x6000,0x9A66,0xC3E8,0x6041,0x6000,0x6000,0x8184,0xB348,0x89A4,0xBBA7,0xCBE7,0xC408,0xC3C7,0x9A86,0x6041,0x6000,0x6881,0xB327,0xC3E7,0xCBE7,0xC3E8,0x9A45,0x6881,0x7943,0xB367,0xCBE7,0xCC07,0xCC07,0xB367,0x70E2,0x9A87,0xC3C9,0xBBA8,0xBBA8,0xBBA8,0xBBC9,0x70C2,0x7923,0xC3E9,0xBBA8,0xBBA8,0xBBA8,0xBBC9,0x8A05,0x6881,0xBBA9,0xBBA8,0xBBA8,0xBBA8,0xBBC8,0xBBC9,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6861,0x6861,0x6000,0x6000,0x6000,0x6000,0x6020,0x6020,0x6000,0x6000,0x6000,0x6841,0x6882,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0x6040,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0x68A2,0x6861,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6041,0x70C2,0x68A2,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0xB367,0x9A45,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6861,0x6882,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0x6020,0x6000,0x6000,0x6000,0x6000,0x6000,0x6040,0x68A2,0x6041,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6020,0x6861,0x6000,0x6000,0x8184,0xC408,0x6861,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xA2A6,0xCC08,0x7943,0x6861,0xC3E8,0x9205,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x70C2,0xD448,0xDC66,0xCC07,0xB367,0xAB06,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0xA286,0xDC88,0xDC88,0xB327,0x6861,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
-    0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,0x6000,
+    0x40, 0x01, 0x20, 0x00, 0xae, 0x00, 0x00, 0x60, 0x20, 0x60, 0x40, 0x60, 0x41, 0x60, 0x61, 0x60,
+    0x41, 0x68, 0x61, 0x68, 0x81, 0x68, 0x82, 0x68, 0xa1, 0x68, 0xa2, 0x68, 0xc2, 0x68, 0xa1, 0x70,
+    0xa2, 0x70, 0xc1, 0x70, 0xc2, 0x70, 0xc3, 0x70, 0xe2, 0x70, 0xe3, 0x70, 0x02, 0x71, 0x03, 0x71,
+    0xe2, 0x78, 0x02, 0x79, 0x03, 0x79, 0x22, 0x79, 0x23, 0x79, 0x42, 0x79, 0x43, 0x79, 0x44, 0x79,
+    0x65, 0x79, 0x43, 0x81, 0x62, 0x81, 0x63, 0x81, 0x64, 0x81, 0x83, 0x81, 0x84, 0x81, 0x85, 0x81,
+    0xa4, 0x81, 0xa5, 0x81, 0x83, 0x89, 0xa3, 0x89, 0xa4, 0x89, 0xc3, 0x89, 0xc4, 0x89, 0xc5, 0x89,
+    0xe4, 0x89, 0xe5, 0x89, 0x05, 0x8a, 0xc3, 0x91, 0xe3, 0x91, 0xe4, 0x91, 0x04, 0x92, 0x05, 0x92,
+    0x24, 0x92, 0x25, 0x92, 0x26, 0x92, 0x45, 0x92, 0x46, 0x92, 0x45, 0x9a, 0x46, 0x9a, 0x65, 0x9a,
+    0x66, 0x9a, 0x85, 0x9a, 0x86, 0x9a, 0x87, 0x9a, 0xa6, 0x9a, 0xa7, 0x9a, 0xa8, 0x9a, 0x84, 0xa2,
+    0x85, 0xa2, 0x86, 0xa2, 0xa5, 0xa2, 0xa6, 0xa2, 0xa7, 0xa2, 0xc5, 0xa2, 0xc6, 0xa2, 0xc7, 0xa2,
+    0xe6, 0xa2, 0xe7, 0xa2, 0xc5, 0xaa, 0xc6, 0xaa, 0xe4, 0xaa, 0xe5, 0xaa, 0xe6, 0xaa, 0xe7, 0xaa,
+    0x05, 0xab, 0x06, 0xab, 0x07, 0xab, 0x26, 0xab, 0x27, 0xab, 0x28, 0xab, 0x48, 0xab, 0x05, 0xb3,
+    0x06, 0xb3, 0x25, 0xb3, 0x26, 0xb3, 0x27, 0xb3, 0x45, 0xb3, 0x46, 0xb3, 0x47, 0xb3, 0x48, 0xb3,
+    0x67, 0xb3, 0x68, 0xb3, 0x88, 0xb3, 0x89, 0xb3, 0x45, 0xbb, 0x46, 0xbb, 0x65, 0xbb, 0x66, 0xbb,
+    0x67, 0xbb, 0x85, 0xbb, 0x86, 0xbb, 0x87, 0xbb, 0x88, 0xbb, 0xa7, 0xbb, 0xa8, 0xbb, 0xa9, 0xbb,
+    0xc8, 0xbb, 0xc9, 0xbb, 0xe9, 0xbb, 0xa5, 0xc3, 0xa6, 0xc3, 0xa7, 0xc3, 0xc6, 0xc3, 0xc7, 0xc3,
+    0xc8, 0xc3, 0xc9, 0xc3, 0xe7, 0xc3, 0xe8, 0xc3, 0xe9, 0xc3, 0x08, 0xc4, 0x09, 0xc4, 0x29, 0xc4,
+    0xc6, 0xcb, 0xe6, 0xcb, 0xe7, 0xcb, 0x06, 0xcc, 0x07, 0xcc, 0x08, 0xcc, 0x27, 0xcc, 0x28, 0xcc,
+    0x29, 0xcc, 0x48, 0xcc, 0x49, 0xcc, 0x69, 0xcc, 0x6a, 0xcc, 0x27, 0xd4, 0x28, 0xd4, 0x46, 0xd4,
+    0x47, 0xd4, 0x48, 0xd4, 0x49, 0xd4, 0x67, 0xd4, 0x68, 0xd4, 0x69, 0xd4, 0x88, 0xd4, 0x89, 0xd4,
+    0x8a, 0xd4, 0xa9, 0xd4, 0xaa, 0xd4, 0x46, 0xdc, 0x66, 0xdc, 0x67, 0xdc, 0x68, 0xdc, 0x87, 0xdc,
+    0x88, 0xdc, 0x89, 0xdc, 0xa8, 0xdc, 0xa9, 0xdc, 0x86, 0xe4, 0x87, 0xe4, 0xa7, 0xe4, 0xa8, 0xe4,
+    0xc8, 0xe4, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00, 0xff, 0x00,
+    0xff, 0x00, 0xce, 0x00, 0x00, 0x20, 0x00, 0x4f, 0x00, 0x70, 0x05, 0x73, 0x00, 0x7d, 0x00, 0x5a,
+    0x00, 0x01, 0x01, 0x00, 0x00, 0x16, 0x00, 0x47, 0x00, 0x70, 0x06, 0x73, 0x00, 0x80, 0x00, 0x22,
+    0x01, 0x00, 0x00, 0x06, 0x00, 0x3a, 0x00, 0x62, 0x06, 0x73, 0x00, 0x7d, 0x00, 0x2e, 0x04, 0x00,
+    0x00, 0x28, 0x00, 0x80, 0x00, 0xa5, 0x00, 0x99, 0x00, 0x65, 0x00, 0x13, 0x08, 0x00, 0x00, 0x68,
+    0x00, 0x71, 0x02, 0x65, 0x00, 0x66, 0x00, 0x09, 0x07, 0x00, 0x00, 0x26, 0x00, 0x71, 0x01, 0x65,
+    0x00, 0x66, 0x00, 0x76, 0x00, 0x25, 0x2d, 0x00, 0x00, 0x1b, 0x00, 0x6d, 0x00, 0x9c, 0x00, 0x88,
+    0x00, 0x9c, 0x00, 0x80, 0x00, 0x28, 0x00, 0x19, 0x00, 0x59, 0x00, 0x04, 0xb3, 0x00, 0x00, 0x06,
+    0x00, 0x56, 0x00, 0xa2, 0x00, 0xa4, 0x00, 0xa2, 0x05, 0xa1, 0x00, 0xa9, 0x00, 0x8a, 0x00, 0x03,
+    0x00, 0x00, 0x00, 0x33, 0x00, 0x95, 0x01, 0xa4, 0x06, 0xa1, 0x00, 0xab, 0x00, 0x31, 0x00, 0x00,
+    0x00, 0x19, 0x00, 0x7f, 0x01, 0xa4, 0x06, 0xa1, 0x00, 0xaa, 0x00, 0x3f, 0x03, 0x00, 0x00, 0x2b,
+    0x00, 0xa5, 0x00, 0xa1, 0x01, 0x95, 0x00, 0xa2, 0x00, 0x89, 0x00, 0x11, 0x07, 0x00, 0x00, 0x39,
+    0x00, 0x56, 0x00, 0x98, 0x01, 0xa1, 0x00, 0xa4, 0x00, 0x3f, 0x07, 0x00, 0x00, 0x57, 0x00, 0xaa,
+    0x00, 0xa1, 0x00, 0xa4, 0x00, 0x6c, 0x00, 0x3f, 0x00, 0x11, 0x11, 0x00, 0x00, 0x07, 0x00, 0x12,
+    0x00, 0x0a, 0x17, 0x00, 0x00, 0x2d, 0x00, 0x98, 0x00, 0x7c, 0x00, 0x23, 0x00, 0x07, 0x00, 0x23,
+    0x00, 0x5f, 0x00, 0xa5, 0x00, 0x95, 0x00, 0x89, 0x00, 0x0a, 0x11, 0x00, 0x00, 0x0a, 0x00, 0x14,
+    0x00, 0x07, 0x9d, 0x00, 0x00, 0x01, 0x00, 0x62, 0x00, 0xa4, 0x00, 0xa2, 0x00, 0x89, 0x06, 0x72,
+    0x00, 0x7c, 0x00, 0x59, 0x00, 0x00, 0x00, 0x20, 0x00, 0xa2, 0x00, 0xa1, 0x00, 0x92, 0x00, 0x70,
+    0x06, 0x73, 0x00, 0x7d, 0x00, 0x20, 0x00, 0x06, 0x00, 0x7f, 0x00, 0xa2, 0x00, 0x98, 0x00, 0x7c,
+    0x06, 0x73, 0x00, 0x7d, 0x00, 0x2e, 0x02, 0x00, 0x00, 0x05, 0x00, 0x7f, 0x00, 0xa2, 0x00, 0x89,
+    0x00, 0x38, 0x00, 0x3e, 0x00, 0x95, 0x00, 0xa4, 0x00, 0x53, 0x09, 0x00, 0x00, 0x4b, 0x00, 0xa8,
+    0x00, 0x90, 0x00, 0xa1, 0x00, 0x7c, 0x00, 0x02, 0x05, 0x00, 0x00, 0x07, 0x00, 0x82, 0x00, 0x9c,
+    0x00, 0x95, 0x00, 0x8b, 0x00, 0x12, 0x13, 0x00, 0x00, 0x47, 0x00, 0xa2, 0x00, 0x67, 0x00, 0x01,
+    0x15, 0x00, 0x00, 0x17, 0x00, 0x96, 0x00, 0x8c, 0x00, 0x07, 0x03, 0x00, 0x00, 0x56, 0x00, 0xaa,
+    0x00, 0x8a, 0x00, 0x0b, 0x11, 0x00, 0x00, 0x71, 0x00, 0xa2, 0x00, 0x5a, 0x9d, 0x00, 0x00, 0x33,
+    0x00, 0xa4, 0x00, 0xa2, 0x00, 0x70, 0x00, 0x3b, 0x00, 0x63, 0x05, 0x65, 0x00, 0x6d, 0x00, 0x4d,
+    0x00, 0x01, 0x00, 0x70, 0x00, 0xa2, 0x00, 0x8b, 0x00, 0x3f, 0x00, 0x56, 0x06, 0x65, 0x00, 0x70,
+    0x00, 0x1b, 0x00, 0x36, 0x00, 0xa4, 0x00, 0xa2, 0x00, 0x50, 0x00, 0x48, 0x00, 0x6d, 0x05, 0x65,
+    0x00, 0x70, 0x00, 0x29, 0x02, 0x00, 0x00, 0x20, 0x00, 0x98, 0x00, 0xa2, 0x00, 0x46, 0x00, 0x7c,
+    0x00, 0x56, 0x00, 0x62, 0x00, 0xa2, 0x00, 0x8c, 0x00, 0x06, 0x08, 0x00, 0x00, 0x2c, 0x00, 0x9d,
+    0x00, 0x4e, 0x00, 0xa2, 0x00, 0x9b, 0x00, 0x20, 0x05, 0x00, 0x00, 0x2b, 0x00, 0x8a, 0x00, 0x68,
+    0x00, 0xa2, 0x00, 0x89, 0x00, 0x0f, 0x13, 0x00, 0x00, 0x4f, 0x00, 0xaa, 0x00, 0x73, 0x16, 0x00,
+    0x00, 0x48, 0x00, 0xab, 0x00, 0x52, 0x04, 0x00, 0x00, 0x0a, 0x00, 0x8b, 0x00, 0x8e, 0x00, 0x10,
+    0x11, 0x00, 0x00, 0x73, 0x00, 0xaa, 0x00, 0x64, 0x9d, 0x00, 0x00, 0x7d, 0x00, 0xa1, 0x00, 0x87,
+    0x00, 0x3f, 0x00, 0x95, 0x00, 0xa2, 0x00, 0xaa, 0x04, 0xa4, 0x00, 0xaa, 0x00, 0x80, 0x00, 0x14,
+    0x00, 0x8e, 0x00, 0xa2, 0x00, 0x57, 0x00, 0x6d, 0x00, 0xa4, 0x00, 0xa2, 0x05, 0xa4, 0x00, 0xab,
+    0x00, 0x2b, 0x00, 0x65, 0x00, 0xa2, 0x00, 0x7c, 0x00, 0x46, 0x00, 0xa4, 0x00, 0xa2, 0x05, 0xa4,
+    0x00, 0xab, 0x00, 0x3f, 0x02, 0x00, 0x00, 0x53, 0x00, 0xa4, 0x00, 0x89, 0x00, 0x3d, 0x00, 0xa2,
+    0x00, 0x89, 0x00, 0x3f, 0x01, 0xa2, 0x00, 0x29, 0x08, 0x00, 0x00, 0x2c, 0x00, 0x9c, 0x00, 0x23,
+    0x00, 0x8b, 0x00, 0xa4, 0x00, 0x59, 0x04, 0x00, 0x00, 0x01, 0x00, 0x65, 0x00, 0x48, 0x00, 0x50,
+    0x00, 0xa4, 0x00, 0x89, 0x00, 0x0f, 0x13, 0x00, 0x00, 0x47, 0x00, 0xaa, 0x00, 0x71, 0x15, 0x00,
+    0x00, 0x01, 0x00, 0x73, 0x00, 0xa1, 0x00, 0x70, 0x05, 0x00, 0x00, 0x57, 0x00, 0x99, 0x00, 0x0b,
+    0x11, 0x00, 0x00, 0x73, 0x00, 0xaa, 0x00, 0x5b, 0x9d, 0x00, 0x00, 0x9c, 0x00, 0xa1, 0x00, 0x4b,
+    0x00, 0x62, 0x00, 0xa2, 0x00, 0x89, 0x00, 0x5c, 0x01, 0x5e, 0x00, 0x6a, 0x00, 0x6f, 0x00, 0x72,
+    0x00, 0x7a, 0x00, 0x59, 0x00, 0x19, 0x00, 0x99, 0x00, 0xa2, 0x00, 0x3d, 0x00, 0x78, 0x00, 0xa2,
+    0x00, 0x89, 0x04, 0x5e, 0x00, 0x6a, 0x00, 0x7c, 0x00, 0x20, 0x00, 0x70, 0x00, 0xa4, 0x00, 0x5d,
+    0x00, 0x4a, 0x00, 0xa2, 0x00, 0x95, 0x00, 0x6c, 0x04, 0x5e, 0x00, 0x69, 0x00, 0x2b, 0x01, 0x00,
+    0x00, 0x05, 0x00, 0x89, 0x00, 0xa2, 0x00, 0x62, 0x00, 0x56, 0x01, 0xa2, 0x00, 0x3f, 0x00, 0x89,
+    0x00, 0xa4, 0x00, 0x56, 0x08, 0x00, 0x00, 0x2c, 0x00, 0x9e, 0x00, 0x07, 0x00, 0x65, 0x00, 0xa1,
+    0x00, 0x8c, 0x00, 0x0a, 0x03, 0x00, 0x00, 0x11, 0x00, 0x8f, 0x00, 0x17, 0x00, 0x50, 0x00, 0xa4,
+    0x00, 0x89, 0x00, 0x0f, 0x02, 0x00, 0x00, 0x20, 0x00, 0x57, 0x01, 0x81, 0x00, 0x59, 0x00, 0x20,
+    0x02, 0x00, 0x00, 0x07, 0x00, 0x3e, 0x01, 0x81, 0x00, 0x57, 0x00, 0x34, 0x00, 0x71, 0x00, 0x32,
+    0x00, 0x6c, 0x00, 0xa2, 0x00, 0x80, 0x00, 0x2d, 0x01, 0x2a, 0x00, 0x03, 0x00, 0x01, 0x00, 0x2d,
+    0x00, 0x71, 0x00, 0x83, 0x00, 0x73, 0x00, 0x33, 0x00, 0x03, 0x00, 0x1e, 0x00, 0x30, 0x00, 0x32,
+    0x00, 0x3a, 0x00, 0x23, 0x00, 0x00, 0x00, 0x29, 0x00, 0x66, 0x00, 0x57, 0x00, 0x09, 0x01, 0x00,
+    0x00, 0x60, 0x00, 0xa1, 0x00, 0x98, 0x00, 0x23, 0x04, 0x00, 0x00, 0x20, 0x00, 0xa8, 0x00, 0x3a,
+    0x00, 0x2a, 0x00, 0x32, 0x00, 0x33, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x29, 0x00, 0x31,
+    0x00, 0x2d, 0x00, 0x32, 0x00, 0x2a, 0x00, 0x4b, 0x01, 0x81, 0x00, 0x48, 0x00, 0x3b, 0x00, 0x65,
+    0x00, 0x2a, 0x00, 0x80, 0x00, 0xa2, 0x00, 0x75, 0x00, 0x2b, 0x00, 0x2a, 0x00, 0x27, 0x00, 0x01,
+    0x00, 0x06, 0x00, 0x36, 0x00, 0x76, 0x00, 0x81, 0x00, 0x66, 0x00, 0x2b, 0x00, 0x03, 0x00, 0x28,
+    0x00, 0x2a, 0x00, 0x32, 0x00, 0x3f, 0x00, 0x19, 0x00, 0x00, 0x00, 0x28, 0x00, 0x66, 0x00, 0x81,
+    0x00, 0x53, 0x00, 0x0f, 0x01, 0x00, 0x00, 0x18, 0x00, 0x53, 0x00, 0x7e, 0x00, 0x66, 0x00, 0x23,
+    0x80, 0x00, 0x00, 0x9b, 0x00, 0xa1, 0x00, 0x48, 0x00, 0x6c, 0x00, 0xa2, 0x00, 0x7f, 0x00, 0x3c,
+    0x00, 0x48, 0x00, 0x3c, 0x00, 0x36, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x13,
+    0x00, 0x99, 0x00, 0xa2, 0x00, 0x3d, 0x00, 0x78, 0x00, 0xa2, 0x00, 0x7c, 0x00, 0x48, 0x02, 0x4b,
+    0x00, 0x53, 0x00, 0x34, 0x00, 0x01, 0x00, 0x00, 0x00, 0x72, 0x00, 0xa4, 0x00, 0x5f, 0x00, 0x4a,
+    0x00, 0xaa, 0x00, 0x7f, 0x00, 0x36, 0x00, 0x50, 0x03, 0x4b, 0x00, 0x53, 0x00, 0x23, 0x01, 0x00,
+    0x00, 0x23, 0x01, 0xa2, 0x00, 0x3f, 0x00, 0x7f, 0x00, 0x98, 0x00, 0xa2, 0x01, 0x5f, 0x00, 0xa4,
+    0x00, 0x89, 0x00, 0x07, 0x07, 0x00, 0x00, 0x2c, 0x00, 0x9e, 0x00, 0x06, 0x00, 0x2b, 0x00, 0xa5,
+    0x00, 0xa4, 0x00, 0x36, 0x03, 0x00, 0x00, 0x46, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x53, 0x00, 0xa4,
+    0x00, 0x89, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x4a, 0x00, 0xa6, 0x00, 0x53, 0x00, 0x1b,
+    0x00, 0x3a, 0x00, 0xa3, 0x00, 0xa2, 0x00, 0x36, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x87, 0x00, 0x8c,
+    0x00, 0x36, 0x00, 0x2e, 0x00, 0x63, 0x00, 0xa7, 0x00, 0xa4, 0x00, 0x90, 0x00, 0x99, 0x00, 0x94,
+    0x00, 0x99, 0x00, 0x90, 0x00, 0x9a, 0x00, 0x8d, 0x00, 0x24, 0x00, 0x70, 0x00, 0x96, 0x00, 0x48,
+    0x00, 0x20, 0x00, 0x57, 0x00, 0xa5, 0x00, 0x6c, 0x00, 0x4c, 0x00, 0x8c, 0x00, 0xab, 0x00, 0xa4,
+    0x00, 0x5a, 0x00, 0x59, 0x00, 0x8a, 0x00, 0x98, 0x00, 0xaa, 0x00, 0x54, 0x01, 0x00, 0x00, 0x36,
+    0x00, 0xa4, 0x01, 0x95, 0x00, 0x3c, 0x00, 0x0a, 0x02, 0x00, 0x00, 0x0d, 0x00, 0x62, 0x00, 0xa7,
+    0x00, 0xa4, 0x00, 0xa5, 0x00, 0x70, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x3c, 0x00, 0x8b,
+    0x00, 0xab, 0x00, 0xa7, 0x00, 0xac, 0x00, 0x7d, 0x00, 0x2e, 0x00, 0x34, 0x00, 0x72, 0x00, 0xa7,
+    0x00, 0xa4, 0x00, 0x8f, 0x00, 0x99, 0x00, 0x94, 0x00, 0x99, 0x00, 0x90, 0x00, 0x9a, 0x00, 0x81,
+    0x00, 0x2c, 0x00, 0x7c, 0x00, 0x8e, 0x00, 0x3c, 0x00, 0x23, 0x00, 0x63, 0x00, 0xa5, 0x00, 0x5f,
+    0x00, 0x5a, 0x00, 0x99, 0x01, 0xaa, 0x00, 0x43, 0x00, 0x56, 0x00, 0x97, 0x00, 0x7c, 0x00, 0x99,
+    0x00, 0xaa, 0x00, 0x89, 0x00, 0x0f, 0x00, 0x33, 0x00, 0x9a, 0x00, 0x7c, 0x00, 0x8e, 0x00, 0xa4,
+    0x00, 0x99, 0x00, 0x34, 0x7f, 0x00, 0x00, 0x82, 0x00, 0xa1, 0x00, 0x7c, 0x00, 0x48, 0x00, 0xa2,
+    0x00, 0xa1, 0x00, 0xa2, 0x00, 0xa1, 0x00, 0xa2, 0x00, 0xa4, 0x00, 0x92, 0x00, 0x33, 0x01, 0x00,
+    0x00, 0x13, 0x00, 0x99, 0x00, 0xa2, 0x00, 0x3d, 0x00, 0x78, 0x00, 0xa1, 0x00, 0xa0, 0x03, 0xa1,
+    0x00, 0xaa, 0x00, 0x63, 0x01, 0x00, 0x00, 0x72, 0x00, 0xa4, 0x00, 0x5f, 0x00, 0x4a, 0x00, 0xaa,
+    0x00, 0x7d, 0x00, 0x63, 0x00, 0xaa, 0x02, 0xa1, 0x00, 0xa2, 0x00, 0xaa, 0x00, 0x3d, 0x01, 0x00,
+    0x00, 0x56, 0x00, 0xa2, 0x00, 0x89, 0x00, 0x3f, 0x00, 0x98, 0x00, 0x95, 0x00, 0x94, 0x00, 0x89,
+    0x00, 0x3f, 0x00, 0x98, 0x00, 0xa2, 0x00, 0x29, 0x07, 0x00, 0x00, 0x2c, 0x00, 0x9e, 0x00, 0x07,
+    0x00, 0x08, 0x00, 0x8c, 0x00, 0xa2, 0x00, 0x70, 0x00, 0x01, 0x01, 0x00, 0x00, 0x02, 0x00, 0x80,
+    0x00, 0x34, 0x00, 0x00, 0x00, 0x53, 0x00, 0xa4, 0x00, 0x89, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x36,
+    0x00, 0xab, 0x00, 0x96, 0x00, 0x07, 0x01, 0x00, 0x00, 0x38, 0x00, 0xaa, 0x00, 0x96, 0x00, 0x0a,
+    0x00, 0x58, 0x00, 0xa8, 0x00, 0x1c, 0x02, 0x00, 0x00, 0x48, 0x00, 0x96, 0x00, 0x1d, 0x00, 0x53,
+    0x00, 0xa4, 0x00, 0x75, 0x01, 0x0a, 0x00, 0x10, 0x00, 0x73, 0x00, 0xa7, 0x00, 0x2b, 0x02, 0x00,
+    0x00, 0x57, 0x00, 0xab, 0x00, 0x5f, 0x00, 0x14, 0x00, 0x89, 0x00, 0x94, 0x00, 0x8c, 0x00, 0x48,
+    0x00, 0x14, 0x00, 0x9c, 0x00, 0xa1, 0x00, 0x66, 0x01, 0x00, 0x00, 0x06, 0x00, 0x7a, 0x00, 0xa4,
+    0x00, 0x94, 0x00, 0xa4, 0x00, 0x8b, 0x00, 0x57, 0x00, 0x1e, 0x02, 0x00, 0x00, 0x48, 0x00, 0xa4,
+    0x00, 0x96, 0x00, 0x17, 0x03, 0x00, 0x00, 0x2c, 0x01, 0x9c, 0x00, 0x8e, 0x00, 0x08, 0x01, 0x00,
+    0x00, 0x01, 0x00, 0x63, 0x00, 0x9a, 0x00, 0x14, 0x00, 0x72, 0x00, 0xa4, 0x00, 0x67, 0x00, 0x08,
+    0x00, 0x0a, 0x00, 0x19, 0x00, 0x80, 0x00, 0x96, 0x00, 0x19, 0x01, 0x00, 0x00, 0x01, 0x00, 0x70,
+    0x00, 0xab, 0x00, 0x3e, 0x00, 0x21, 0x01, 0x95, 0x00, 0x8f, 0x00, 0x3f, 0x00, 0x07, 0x00, 0x01,
+    0x00, 0x25, 0x00, 0x95, 0x00, 0xa1, 0x00, 0x8c, 0x00, 0x56, 0x00, 0x0f, 0x00, 0x01, 0x00, 0x12,
+    0x00, 0x7f, 0x00, 0xa1, 0x00, 0x80, 0x00, 0x01, 0x7e, 0x00, 0x00, 0x3c, 0x00, 0xa4, 0x00, 0x98,
+    0x00, 0x63, 0x00, 0x48, 0x00, 0x7a, 0x01, 0x80, 0x00, 0x7f, 0x00, 0x95, 0x00, 0xa2, 0x00, 0xa4,
+    0x00, 0x3a, 0x00, 0x00, 0x00, 0x13, 0x00, 0x99, 0x00, 0xa2, 0x00, 0x3f, 0x00, 0x62, 0x05, 0x80,
+    0x00, 0x8a, 0x00, 0x4b, 0x01, 0x00, 0x00, 0x72, 0x00, 0xa4, 0x00, 0x5f, 0x00, 0x4a, 0x00, 0xaa,
+    0x00, 0x7c, 0x00, 0x4b, 0x00, 0x8a, 0x01, 0x80, 0x00, 0x8a, 0x00, 0x98, 0x00, 0xa2, 0x00, 0x3c,
+    0x00, 0x00, 0x00, 0x06, 0x00, 0x89, 0x00, 0xa2, 0x00, 0x62, 0x00, 0x58, 0x00, 0xa2, 0x00, 0x94,
+    0x00, 0x95, 0x00, 0xa2, 0x00, 0x3f, 0x00, 0x87, 0x00, 0xa2, 0x00, 0x5f, 0x07, 0x00, 0x00, 0x2c,
+    0x00, 0x9e, 0x00, 0x09, 0x00, 0x00, 0x00, 0x57, 0x00, 0xa2, 0x00, 0x99, 0x00, 0x17, 0x01, 0x00,
+    0x00, 0x22, 0x00, 0x8c, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x53, 0x00, 0xa4, 0x00, 0x89, 0x00, 0x0f,
+    0x00, 0x00, 0x00, 0x45, 0x00, 0xac, 0x00, 0x98, 0x00, 0x11, 0x01, 0x00, 0x00, 0x21, 0x00, 0x99,
+    0x00, 0xa4, 0x00, 0x19, 0x00, 0x6f, 0x00, 0xa5, 0x00, 0x14, 0x02, 0x00, 0x00, 0x07, 0x00, 0x8d,
+    0x00, 0x1c, 0x00, 0x47, 0x00, 0xaa, 0x00, 0x73, 0x01, 0x00, 0x00, 0x2d, 0x00, 0xab, 0x00, 0x70,
+    0x03, 0x00, 0x00, 0x20, 0x00, 0xa5, 0x00, 0x9b, 0x00, 0x19, 0x00, 0x5e, 0x00, 0xa2, 0x00, 0x63,
+    0x01, 0x00, 0x00, 0x3e, 0x00, 0x7a, 0x00, 0x20, 0x02, 0x00, 0x00, 0x0a, 0x00, 0x70, 0x00, 0xa4,
+    0x00, 0xa2, 0x00, 0xa1, 0x00, 0xa2, 0x00, 0xa5, 0x00, 0x70, 0x00, 0x20, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x8c, 0x00, 0xa2, 0x00, 0x48, 0x03, 0x00, 0x00, 0x48, 0x00, 0x77, 0x01, 0x8e, 0x00, 0x06,
+    0x02, 0x00, 0x00, 0x17, 0x00, 0x91, 0x00, 0x0d, 0x00, 0x6c, 0x00, 0xaa, 0x00, 0x66, 0x01, 0x00,
+    0x00, 0x48, 0x00, 0xaa, 0x00, 0x57, 0x03, 0x00, 0x00, 0x3b, 0x00, 0xa4, 0x00, 0x8e, 0x00, 0x07,
+    0x00, 0x7f, 0x00, 0xa4, 0x00, 0x57, 0x03, 0x00, 0x00, 0x70, 0x00, 0xa4, 0x00, 0x7f, 0x00, 0x01,
+    0x02, 0x00, 0x00, 0x3d, 0x00, 0xa4, 0x00, 0x89, 0x00, 0x0d, 0x7e, 0x00, 0x00, 0x06, 0x00, 0x7a,
+    0x01, 0xa2, 0x00, 0x6f, 0x00, 0x53, 0x00, 0x59, 0x00, 0x58, 0x00, 0x50, 0x00, 0x3c, 0x00, 0x8b,
+    0x00, 0xa2, 0x00, 0x98, 0x00, 0x16, 0x00, 0x11, 0x00, 0x99, 0x00, 0xa2, 0x00, 0x3f, 0x00, 0x45,
+    0x00, 0x59, 0x03, 0x56, 0x00, 0x57, 0x00, 0x5f, 0x00, 0x34, 0x01, 0x00, 0x00, 0x72, 0x00, 0xa4,
+    0x00, 0x5f, 0x00, 0x4a, 0x00, 0xaa, 0x00, 0x7f, 0x00, 0x36, 0x00, 0x5f, 0x00, 0x56, 0x00, 0x5d,
+    0x00, 0x3b, 0x00, 0x96, 0x00, 0xa2, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x25, 0x00, 0xa4, 0x00, 0xa2,
+    0x00, 0x3f, 0x00, 0x87, 0x01, 0x95, 0x00, 0x98, 0x00, 0xa2, 0x00, 0x62, 0x00, 0x58, 0x00, 0xa2,
+    0x00, 0x8b, 0x00, 0x07, 0x06, 0x00, 0x00, 0x2c, 0x00, 0x9e, 0x00, 0x09, 0x00, 0x00, 0x00, 0x23,
+    0x00, 0xa5, 0x00, 0xa2, 0x00, 0x4b, 0x01, 0x00, 0x00, 0x65, 0x00, 0x56, 0x01, 0x00, 0x00, 0x53,
+    0x00, 0xa4, 0x00, 0x89, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x07, 0x00, 0x57, 0x00, 0x34, 0x02, 0x00,
+    0x00, 0x1c, 0x00, 0x99, 0x00, 0xa2, 0x00, 0x16, 0x00, 0x6f, 0x00, 0xaa, 0x00, 0x70, 0x00, 0x1b,
+    0x02, 0x00, 0x00, 0x0c, 0x00, 0x02, 0x00, 0x4f, 0x00, 0xaa, 0x00, 0x73, 0x01, 0x01, 0x00, 0x73,
+    0x00, 0xab, 0x00, 0x48, 0x03, 0x00, 0x00, 0x19, 0x00, 0x99, 0x00, 0xa4, 0x00, 0x1a, 0x00, 0x5c,
+    0x00, 0xa2, 0x00, 0x4e, 0x08, 0x00, 0x00, 0x01, 0x00, 0x29, 0x00, 0x65, 0x00, 0x99, 0x03, 0xa2,
+    0x00, 0x36, 0x00, 0x00, 0x00, 0x57, 0x00, 0xa2, 0x00, 0x7f, 0x00, 0x06, 0x01, 0x00, 0x00, 0x06,
+    0x00, 0x82, 0x00, 0x2b, 0x00, 0x8b, 0x00, 0xa2, 0x00, 0x56, 0x00, 0x17, 0x02, 0x00, 0x00, 0x0e,
+    0x00, 0x01, 0x00, 0x72, 0x00, 0xaa, 0x00, 0x66, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x80, 0x00, 0xa4,
+    0x00, 0x28, 0x03, 0x00, 0x00, 0x2e, 0x00, 0x98, 0x00, 0x95, 0x00, 0x19, 0x00, 0x7f, 0x00, 0xa4,
+    0x00, 0x3d, 0x03, 0x00, 0x00, 0x67, 0x00, 0xaa, 0x00, 0x70, 0x03, 0x00, 0x00, 0x2e, 0x00, 0x98,
+    0x00, 0x8b, 0x00, 0x19, 0x7f, 0x00, 0x00, 0x0f, 0x00, 0x7a, 0x01, 0xa4, 0x02, 0xaa, 0x00, 0xa4,
+    0x00, 0x7f, 0x00, 0x3d, 0x00, 0x92, 0x00, 0xa4, 0x00, 0x47, 0x00, 0x11, 0x00, 0x99, 0x00, 0xa2,
+    0x00, 0x3d, 0x00, 0x7b, 0x01, 0xa4, 0x03, 0xaa, 0x00, 0xab, 0x00, 0x65, 0x01, 0x00, 0x00, 0x72,
+    0x00, 0xa4, 0x00, 0x5f, 0x00, 0x4a, 0x00, 0xaa, 0x00, 0x7c, 0x00, 0x65, 0x00, 0xab, 0x00, 0xa2,
+    0x00, 0xa4, 0x00, 0x54, 0x00, 0x8b, 0x00, 0xa2, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x56, 0x00, 0xa4,
+    0x00, 0x89, 0x00, 0x3d, 0x01, 0xa2, 0x00, 0x59, 0x00, 0x7c, 0x00, 0xa1, 0x00, 0x89, 0x00, 0x3d,
+    0x00, 0x98, 0x00, 0xa2, 0x00, 0x2b, 0x06, 0x00, 0x00, 0x2c, 0x00, 0x9e, 0x00, 0x09, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x80, 0x00, 0xa2, 0x00, 0x80, 0x00, 0x03, 0x00, 0x09, 0x00, 0x8f, 0x00, 0x1b,
+    0x01, 0x00, 0x00, 0x53, 0x00, 0xa4, 0x00, 0x89, 0x00, 0x0f, 0x04, 0x00, 0x00, 0x18, 0x00, 0x48,
+    0x00, 0x8a, 0x00, 0x98, 0x00, 0xa2, 0x00, 0x16, 0x00, 0x3b, 0x00, 0xa4, 0x00, 0xa2, 0x00, 0x99,
+    0x00, 0x72, 0x00, 0x3d, 0x00, 0x0f, 0x01, 0x00, 0x00, 0x4f, 0x00, 0xaa, 0x00, 0x73, 0x00, 0x01,
+    0x00, 0x02, 0x00, 0x8c, 0x00, 0xa2, 0x00, 0x89, 0x03, 0x6f, 0x00, 0x7c, 0x00, 0xa2, 0x00, 0xaa,
+    0x00, 0x22, 0x00, 0x51, 0x00, 0xa4, 0x00, 0x57, 0x0b, 0x00, 0x00, 0x11, 0x00, 0x48, 0x00, 0x7f,
+    0x00, 0xa2, 0x00, 0x94, 0x00, 0xa5, 0x00, 0x19, 0x00, 0x17, 0x00, 0x9b, 0x00, 0xa2, 0x00, 0x2d,
+    0x01, 0x00, 0x00, 0x2d, 0x00, 0x75, 0x00, 0x01, 0x00, 0x4d, 0x00, 0xa4, 0x00, 0xa2, 0x00, 0x99,
+    0x00, 0x70, 0x00, 0x36, 0x00, 0x0a, 0x01, 0x00, 0x00, 0x72, 0x00, 0xaa, 0x00, 0x66, 0x00, 0x00,
+    0x00, 0x16, 0x00, 0x9b, 0x00, 0x95, 0x00, 0x7b, 0x03, 0x6f, 0x00, 0x87, 0x01, 0xa2, 0x00, 0x2c,
+    0x00, 0x7c, 0x00, 0xa4, 0x00, 0x40, 0x03, 0x00, 0x00, 0x67, 0x00, 0xaa, 0x00, 0x70, 0x03, 0x00,
+    0x00, 0x2e, 0x00, 0x98, 0x00, 0x8b, 0x00, 0x17, 0x80, 0x00, 0x00, 0x03, 0x00, 0x36, 0x00, 0x70,
+    0x02, 0x6e, 0x00, 0x92, 0x00, 0xa4, 0x00, 0x53, 0x00, 0x70, 0x00, 0xa2, 0x00, 0x72, 0x00, 0x19,
+    0x00, 0x99, 0x00, 0xa2, 0x00, 0x3d, 0x00, 0x78, 0x00, 0xa2, 0x00, 0x88, 0x00, 0x6b, 0x02, 0x6e,
+    0x00, 0x79, 0x00, 0x46, 0x01, 0x00, 0x00, 0x72, 0x00, 0xa4, 0x00, 0x5f, 0x00, 0x4a, 0x00, 0xaa,
+    0x00, 0x7c, 0x00, 0x45, 0x00, 0x85, 0x00, 0x95, 0x00, 0xa2, 0x00, 0x4e, 0x00, 0x8b, 0x00, 0xa2,
+    0x00, 0x3a, 0x00, 0x03, 0x00, 0x8b, 0x00, 0xa2, 0x01, 0x5f, 0x01, 0xa2, 0x00, 0x1b, 0x00, 0x45,
+    0x01, 0xa2, 0x00, 0x3f, 0x00, 0x7f, 0x00, 0xa4, 0x00, 0x5f, 0x06, 0x00, 0x00, 0x2c, 0x00, 0x9e,
+    0x00, 0x09, 0x01, 0x00, 0x00, 0x3f, 0x01, 0xa4, 0x00, 0x21, 0x00, 0x36, 0x00, 0x80, 0x02, 0x00,
+    0x00, 0x53, 0x00, 0xa4, 0x00, 0x89, 0x00, 0x0f, 0x01, 0x00, 0x00, 0x07, 0x00, 0x3d, 0x00, 0x7c,
+    0x00, 0x8a, 0x00, 0x4b, 0x00, 0x37, 0x00, 0x95, 0x00, 0xa4, 0x00, 0x16, 0x00, 0x01, 0x00, 0x3f,
+    0x00, 0x96, 0x00, 0xa4, 0x00, 0xaa, 0x00, 0xa4, 0x00, 0x8e, 0x00, 0x33, 0x00, 0x00, 0x00, 0x4f,
+    0x00, 0xaa, 0x00, 0x73, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x89, 0x00, 0xa4, 0x00, 0x60, 0x00, 0x1f,
+    0x02, 0x28, 0x00, 0x27, 0x00, 0x22, 0x00, 0x27, 0x00, 0x06, 0x00, 0x61, 0x00, 0xa2, 0x00, 0x57,
+    0x05, 0x00, 0x00, 0x07, 0x00, 0x20, 0x05, 0x00, 0x00, 0x06, 0x00, 0x6d, 0x01, 0xa2, 0x00, 0x64,
+    0x00, 0x00, 0x00, 0x70, 0x00, 0xa1, 0x00, 0x70, 0x01, 0x00, 0x00, 0x71, 0x00, 0x36, 0x00, 0x00,
+    0x00, 0x05, 0x00, 0x4b, 0x00, 0x99, 0x00, 0xa4, 0x00, 0xaa, 0x00, 0xa4, 0x00, 0x89, 0x00, 0x2b,
+    0x00, 0x00, 0x00, 0x72, 0x00, 0xaa, 0x00, 0x66, 0x00, 0x00, 0x00, 0x16, 0x00, 0xa5, 0x00, 0x98,
+    0x00, 0x45, 0x00, 0x20, 0x02, 0x28, 0x00, 0x27, 0x01, 0x22, 0x00, 0x0a, 0x00, 0x89, 0x00, 0xa4,
+    0x00, 0x40, 0x03, 0x00, 0x00, 0x67, 0x00, 0xaa, 0x00, 0x70, 0x03, 0x00, 0x00, 0x2e, 0x00, 0x98,
+    0x00, 0x8b, 0x00, 0x14, 0x7e, 0x00, 0x00, 0x4c, 0x01, 0x4b, 0x00, 0x48, 0x00, 0x4b, 0x02, 0x3d,
+    0x00, 0x89, 0x00, 0xa4, 0x00, 0x5f, 0x00, 0x65, 0x00, 0xa2, 0x00, 0x80, 0x00, 0x1b, 0x00, 0x99,
+    0x00, 0xa2, 0x00, 0x3d, 0x00, 0x78, 0x00, 0xa2, 0x00, 0x7c, 0x00, 0x3d, 0x03, 0x3f, 0x00, 0x48,
+    0x00, 0x57, 0x00, 0x16, 0x00, 0x70, 0x00, 0xa4, 0x00, 0x5d, 0x00, 0x4a, 0x00, 0xa2, 0x00, 0x95,
+    0x00, 0x46, 0x00, 0x4b, 0x00, 0x95, 0x00, 0xa2, 0x00, 0x4e, 0x00, 0x8b, 0x00, 0xa2, 0x00, 0x36,
+    0x00, 0x23, 0x00, 0xa4, 0x00, 0xa2, 0x00, 0x3d, 0x00, 0x89, 0x00, 0x94, 0x00, 0x99, 0x00, 0x6c,
+    0x00, 0x7c, 0x00, 0x95, 0x00, 0xa2, 0x00, 0x62, 0x00, 0x56, 0x00, 0xa2, 0x00, 0x8b, 0x00, 0x07,
+    0x05, 0x00, 0x00, 0x2c, 0x00, 0x9f, 0x00, 0x09, 0x01, 0x00, 0x00, 0x17, 0x00, 0x99, 0x00, 0xa2,
+    0x00, 0x66, 0x00, 0x72, 0x00, 0x36, 0x02, 0x00, 0x00, 0x53, 0x00, 0xa4, 0x00, 0x89, 0x00, 0x0f,
+    0x00, 0x00, 0x00, 0x19, 0x00, 0x87, 0x00, 0xac, 0x00, 0x4b, 0x00, 0x07, 0x00, 0x00, 0x00, 0x1c,
+    0x00, 0x99, 0x00, 0xa5, 0x00, 0x15, 0x01, 0x00, 0x00, 0x0f, 0x00, 0x3a, 0x00, 0x72, 0x00, 0x98,
+    0x00, 0xa2, 0x00, 0x98, 0x00, 0x23, 0x00, 0x44, 0x00, 0xaa, 0x00, 0x73, 0x00, 0x01, 0x00, 0x06,
+    0x00, 0x8b, 0x00, 0xa4, 0x00, 0x48, 0x07, 0x00, 0x00, 0x6c, 0x00, 0xa2, 0x00, 0x57, 0x05, 0x00,
+    0x00, 0x23, 0x00, 0x99, 0x00, 0x11, 0x05, 0x00, 0x00, 0x11, 0x00, 0x93, 0x00, 0xa2, 0x00, 0x72,
+    0x00, 0x00, 0x00, 0x34, 0x00, 0xa4, 0x00, 0x95, 0x00, 0x1b, 0x00, 0x11, 0x00, 0x8a, 0x00, 0x06,
+    0x02, 0x00, 0x00, 0x16, 0x00, 0x46, 0x00, 0x7c, 0x00, 0x98, 0x00, 0xa1, 0x00, 0x98, 0x00, 0x16,
+    0x00, 0x6f, 0x00, 0xaa, 0x00, 0x66, 0x00, 0x00, 0x00, 0x16, 0x00, 0xa5, 0x00, 0xa2, 0x00, 0x28,
+    0x06, 0x00, 0x00, 0x01, 0x00, 0x89, 0x00, 0xa4, 0x00, 0x40, 0x03, 0x00, 0x00, 0x67, 0x00, 0xaa,
+    0x00, 0x70, 0x03, 0x00, 0x00, 0x2e, 0x00, 0x98, 0x00, 0x8b, 0x00, 0x14, 0x7e, 0x00, 0x00, 0xa7,
+    0x00, 0xa1, 0x07, 0xa2, 0x00, 0x3f, 0x00, 0x87, 0x00, 0xa4, 0x00, 0x5f, 0x00, 0x12, 0x00, 0x99,
+    0x00, 0xa2, 0x00, 0x4b, 0x00, 0x79, 0x00, 0xa2, 0x00, 0x94, 0x05, 0xa2, 0x00, 0xab, 0x00, 0x28,
+    0x00, 0x70, 0x00, 0xa2, 0x00, 0x6d, 0x00, 0x4b, 0x00, 0xa4, 0x00, 0x94, 0x00, 0xa2, 0x00, 0xa1,
+    0x00, 0x94, 0x00, 0xa2, 0x00, 0x54, 0x00, 0x8b, 0x00, 0xa2, 0x00, 0x38, 0x00, 0x53, 0x00, 0xa2,
+    0x00, 0x87, 0x00, 0x3f, 0x00, 0x98, 0x00, 0x94, 0x00, 0x84, 0x00, 0x9b, 0x00, 0xa1, 0x01, 0x94,
+    0x00, 0x89, 0x00, 0x3d, 0x00, 0x98, 0x00, 0xa4, 0x00, 0x2b, 0x05, 0x00, 0x00, 0x2c, 0x00, 0x9e,
+    0x00, 0x07, 0x02, 0x00, 0x00, 0x70, 0x00, 0xa2, 0x00, 0xa5, 0x00, 0x8c, 0x00, 0x0a, 0x02, 0x00,
+    0x00, 0x53, 0x00, 0xa4, 0x00, 0x89, 0x00, 0x0f, 0x00, 0x01, 0x00, 0x80, 0x00, 0xaa, 0x00, 0x5f,
+    0x02, 0x00, 0x00, 0x23, 0x00, 0x99, 0x00, 0x98, 0x00, 0x2e, 0x00, 0x3d, 0x03, 0x00, 0x00, 0x20,
+    0x00, 0x7c, 0x00, 0xa1, 0x00, 0x66, 0x00, 0x47, 0x00, 0xa4, 0x00, 0x73, 0x01, 0x01, 0x00, 0x83,
+    0x00, 0xa1, 0x00, 0x63, 0x07, 0x00, 0x00, 0x6c, 0x00, 0xa2, 0x00, 0x57, 0x05, 0x00, 0x00, 0x1c,
+    0x00, 0x98, 0x00, 0x48, 0x06, 0x00, 0x00, 0x70, 0x00, 0xaa, 0x00, 0x73, 0x00, 0x00, 0x00, 0x07,
+    0x00, 0x8a, 0x00, 0xa2, 0x02, 0x4b, 0x00, 0x00, 0x00, 0x25, 0x00, 0x34, 0x03, 0x00, 0x00, 0x25,
+    0x00, 0x89, 0x00, 0xa4, 0x00, 0x57, 0x00, 0x6d, 0x00, 0xaa, 0x00, 0x66, 0x00, 0x00, 0x00, 0x11,
+    0x00, 0x8e, 0x00, 0xa0, 0x00, 0x4c, 0x06, 0x00, 0x00, 0x01, 0x00, 0x89, 0x00, 0xa4, 0x00, 0x40,
+    0x03, 0x00, 0x00, 0x67, 0x00, 0xaa, 0x00, 0x70, 0x03, 0x00, 0x00, 0x2e, 0x00, 0x98, 0x00, 0x8b,
+    0x00, 0x14, 0x7e, 0x00, 0x00, 0x8c, 0x05, 0x8a, 0x00, 0x8c, 0x00, 0x7c, 0x00, 0x3c, 0x00, 0x56,
+    0x00, 0xa2, 0x00, 0xa4, 0x00, 0x2d, 0x00, 0x01, 0x00, 0x7c, 0x00, 0xa2, 0x00, 0x7c, 0x00, 0x3f,
+    0x00, 0x7c, 0x00, 0x8c, 0x05, 0x8a, 0x00, 0x96, 0x00, 0x20, 0x00, 0x48, 0x00, 0xa4, 0x00, 0x95,
+    0x00, 0x4c, 0x00, 0x65, 0x00, 0x8c, 0x02, 0x8a, 0x00, 0x8c, 0x00, 0x41, 0x00, 0x8c, 0x00, 0xa2,
+    0x00, 0x3a, 0x00, 0x7c, 0x00, 0xa2, 0x01, 0x5f, 0x00, 0xa2, 0x00, 0x95, 0x00, 0x48, 0x03, 0x8c,
+    0x00, 0x96, 0x00, 0x3d, 0x00, 0x7c, 0x00, 0xa4, 0x00, 0x5f, 0x05, 0x00, 0x00, 0x34, 0x00, 0xa5,
+    0x00, 0x16, 0x02, 0x00, 0x00, 0x2d, 0x00, 0xa4, 0x00, 0xa2, 0x00, 0x4d, 0x03, 0x00, 0x00, 0x53,
+    0x00, 0xa4, 0x00, 0x89, 0x01, 0x0f, 0x00, 0x95, 0x00, 0xa4, 0x00, 0x3d, 0x02, 0x00, 0x00, 0x23,
+    0x00, 0x9b, 0x00, 0x99, 0x00, 0x3d, 0x00, 0x9c, 0x00, 0x13, 0x03, 0x00, 0x00, 0x20, 0x00, 0xa2,
+    0x00, 0x71, 0x00, 0x4a, 0x00, 0xa4, 0x00, 0x80, 0x00, 0x01, 0x00, 0x00, 0x00, 0x48, 0x00, 0xa4,
+    0x00, 0x99, 0x00, 0x13, 0x04, 0x00, 0x00, 0x34, 0x00, 0x23, 0x00, 0x5e, 0x00, 0xa2, 0x00, 0x57,
+    0x05, 0x00, 0x00, 0x14, 0x00, 0x92, 0x00, 0x8c, 0x00, 0x11, 0x05, 0x00, 0x00, 0x70, 0x00, 0xab,
+    0x00, 0x3d, 0x01, 0x00, 0x00, 0x4b, 0x00, 0xa2, 0x00, 0x96, 0x00, 0x82, 0x00, 0x17, 0x00, 0x00,
+    0x00, 0x3f, 0x00, 0x90, 0x00, 0x07, 0x03, 0x00, 0x00, 0x34, 0x00, 0xad, 0x00, 0x59, 0x00, 0x6d,
+    0x00, 0xaa, 0x00, 0x67, 0x00, 0x00, 0x00, 0x01, 0x00, 0x63, 0x00, 0xa2, 0x00, 0x80, 0x00, 0x07,
+    0x04, 0x00, 0x00, 0x3b, 0x00, 0x25, 0x00, 0x7f, 0x00, 0xa4, 0x00, 0x3f, 0x03, 0x00, 0x00, 0x67,
+    0x00, 0xaa, 0x00, 0x70, 0x03, 0x00, 0x00, 0x2e, 0x00, 0x98, 0x00, 0x8b, 0x00, 0x14, 0x7e, 0x00,
+    0x07, 0x4b, 0x00, 0x45, 0x00, 0x6f, 0x01, 0xa2, 0x00, 0x72, 0x00, 0x03, 0x00, 0x00, 0x00, 0x3a,
+    0x00, 0xa4, 0x00, 0xa2, 0x00, 0x7c, 0x00, 0x45, 0x06, 0x4b, 0x00, 0x53, 0x01, 0x11, 0x00, 0x95,
+    0x00, 0xa1, 0x00, 0x8b, 0x00, 0x4a, 0x05, 0x4b, 0x00, 0x98, 0x00, 0x95, 0x00, 0x81, 0x00, 0x98,
+    0x00, 0xa2, 0x00, 0x3d, 0x00, 0x89, 0x00, 0xa2, 0x00, 0x7c, 0x00, 0x19, 0x00, 0x53, 0x02, 0x4d,
+    0x00, 0x53, 0x00, 0x3e, 0x00, 0x7c, 0x00, 0xa2, 0x00, 0x8b, 0x00, 0x0a, 0x04, 0x00, 0x00, 0x48,
+    0x00, 0xaa, 0x00, 0x4c, 0x02, 0x00, 0x00, 0x0a, 0x00, 0x89, 0x00, 0xa3, 0x00, 0x19, 0x03, 0x00,
+    0x00, 0x5f, 0x00, 0xa2, 0x00, 0x8b, 0x00, 0x14, 0x00, 0x09, 0x00, 0x95, 0x00, 0xa4, 0x00, 0x53,
+    0x01, 0x00, 0x00, 0x02, 0x00, 0x4b, 0x00, 0xa2, 0x00, 0x98, 0x00, 0x3d, 0x00, 0x9b, 0x00, 0x62,
+    0x00, 0x01, 0x02, 0x00, 0x00, 0x20, 0x00, 0xa4, 0x00, 0x3a, 0x00, 0x45, 0x00, 0xa4, 0x00, 0x8c,
+    0x00, 0x0f, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x8c, 0x00, 0xa2, 0x00, 0x70, 0x00, 0x0a, 0x02, 0x00,
+    0x00, 0x20, 0x00, 0x9a, 0x00, 0x25, 0x00, 0x5e, 0x00, 0xa2, 0x00, 0x57, 0x05, 0x00, 0x00, 0x0f,
+    0x00, 0x8b, 0x00, 0xa2, 0x00, 0x7d, 0x00, 0x0f, 0x03, 0x00, 0x00, 0x1b, 0x00, 0x95, 0x00, 0x87,
+    0x00, 0x07, 0x01, 0x00, 0x00, 0x17, 0x00, 0x99, 0x00, 0xa1, 0x00, 0x65, 0x01, 0x00, 0x00, 0x39,
+    0x00, 0xa7, 0x00, 0x48, 0x03, 0x00, 0x00, 0x33, 0x00, 0xad, 0x00, 0x34, 0x00, 0x70, 0x00, 0xa4,
+    0x00, 0x7c, 0x00, 0x06, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x99, 0x00, 0xa2, 0x00, 0x59, 0x00, 0x05,
+    0x02, 0x00, 0x00, 0x34, 0x00, 0x8e, 0x00, 0x1b, 0x00, 0x7f, 0x00, 0xa4, 0x00, 0x3f, 0x03, 0x00,
+    0x00, 0x66, 0x00, 0xaa, 0x00, 0x72, 0x03, 0x00, 0x00, 0x2e, 0x00, 0x98, 0x00, 0x92, 0x00, 0x19,
+    0x7e, 0x00, 0x00, 0xa5, 0x07, 0xa2, 0x00, 0xa1, 0x00, 0xa4, 0x00, 0x7c, 0x00, 0x0c, 0x01, 0x00,
+    0x00, 0x01, 0x00, 0x56, 0x00, 0xa4, 0x00, 0xa1, 0x07, 0xa2, 0x00, 0xac, 0x00, 0x28, 0x00, 0x00,
+    0x00, 0x32, 0x00, 0x95, 0x07, 0xa2, 0x01, 0x95, 0x00, 0x98, 0x00, 0x94, 0x00, 0x7f, 0x00, 0x3f,
+    0x00, 0xa2, 0x00, 0xa4, 0x00, 0x47, 0x00, 0x1b, 0x00, 0xac, 0x03, 0xa2, 0x00, 0xa4, 0x00, 0x98,
+    0x00, 0x95, 0x00, 0xa2, 0x00, 0x2d, 0x02, 0x00, 0x00, 0x34, 0x00, 0x56, 0x00, 0x95, 0x00, 0x94,
+    0x00, 0x95, 0x00, 0x5f, 0x00, 0x37, 0x00, 0x01, 0x00, 0x00, 0x00, 0x63, 0x00, 0x7d, 0x00, 0x01,
+    0x00, 0x00, 0x00, 0x07, 0x00, 0x34, 0x00, 0x57, 0x00, 0x95, 0x00, 0x94, 0x00, 0x98, 0x00, 0x72,
+    0x00, 0x39, 0x00, 0x81, 0x00, 0xa0, 0x00, 0x95, 0x00, 0x57, 0x00, 0x4c, 0x00, 0x70, 0x00, 0x59,
+    0x00, 0x7f, 0x00, 0xa0, 0x00, 0x80, 0x00, 0x95, 0x00, 0xa7, 0x00, 0x62, 0x00, 0x19, 0x00, 0x0f,
+    0x00, 0x18, 0x00, 0x80, 0x00, 0x7c, 0x00, 0x07, 0x00, 0x34, 0x00, 0xa5, 0x00, 0x98, 0x00, 0x7c,
+    0x00, 0x56, 0x00, 0x55, 0x00, 0x5a, 0x00, 0x7f, 0x00, 0xa4, 0x00, 0x7c, 0x00, 0x54, 0x00, 0x42,
+    0x00, 0x56, 0x00, 0x8c, 0x00, 0x46, 0x00, 0x32, 0x00, 0x95, 0x00, 0x94, 0x00, 0x8c, 0x00, 0x3b,
+    0x00, 0x17, 0x03, 0x00, 0x00, 0x0d, 0x00, 0x8b, 0x00, 0x89, 0x00, 0x98, 0x00, 0x7f, 0x00, 0x36,
+    0x01, 0x0e, 0x00, 0x2d, 0x00, 0x8c, 0x00, 0x87, 0x00, 0x1b, 0x02, 0x00, 0x00, 0x01, 0x00, 0x65,
+    0x00, 0xa4, 0x00, 0x29, 0x01, 0x00, 0x00, 0x39, 0x00, 0xa5, 0x00, 0x98, 0x00, 0x53, 0x00, 0x15,
+    0x00, 0x0f, 0x00, 0x20, 0x00, 0x8c, 0x00, 0x6d, 0x00, 0x02, 0x00, 0x4c, 0x00, 0xa4, 0x00, 0x98,
+    0x00, 0x6f, 0x00, 0x56, 0x00, 0x5f, 0x00, 0x54, 0x00, 0x8b, 0x00, 0xa4, 0x00, 0x70, 0x00, 0x4e,
+    0x00, 0x49, 0x00, 0x5f, 0x00, 0x8c, 0x00, 0x36, 0x00, 0x3a, 0x00, 0x95, 0x00, 0xa1, 0x00, 0x7f,
+    0x00, 0x2e, 0x00, 0x01, 0x00, 0x02, 0x00, 0x2b, 0x00, 0x8c, 0x00, 0xa1, 0x00, 0x92, 0x00, 0x3d,
+    0x00, 0x09, 0x00, 0x01, 0x00, 0x21, 0x00, 0x70, 0x00, 0xa2, 0x00, 0x95, 0x00, 0x65, 0x00, 0x21,
+    0x7d, 0x00, 0x00, 0x99, 0x00, 0x94, 0x05, 0x95, 0x00, 0x98, 0x00, 0x8e, 0x00, 0x3c, 0x00, 0x06,
+    0x03, 0x00, 0x00, 0x01, 0x00, 0x35, 0x00, 0x8c, 0x00, 0x98, 0x00, 0x94, 0x05, 0x95, 0x00, 0xa4,
+    0x00, 0x28, 0x01, 0x00, 0x00, 0x20, 0x00, 0x7a, 0x00, 0x99, 0x00, 0x94, 0x06, 0x95, 0x00, 0x94,
+    0x00, 0xa2, 0x00, 0x58, 0x00, 0x62, 0x00, 0xa2, 0x00, 0x98, 0x00, 0x1b, 0x00, 0x18, 0x00, 0xa5,
+    0x00, 0x94, 0x05, 0x95, 0x00, 0xa2, 0x00, 0x65, 0x02, 0x00, 0x01, 0x76, 0x00, 0x73, 0x01, 0x71,
+    0x00, 0x75, 0x00, 0x74, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x1b, 0x01, 0x00, 0x00, 0x21,
+    0x00, 0x81, 0x00, 0x76, 0x03, 0x73, 0x00, 0x76, 0x00, 0x39, 0x00, 0x53, 0x00, 0x86, 0x00, 0x89,
+    0x00, 0x80, 0x00, 0x33, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x7c, 0x00, 0x87, 0x00, 0x73, 0x00, 0x2e,
+    0x00, 0x63, 0x00, 0x87, 0x00, 0x82, 0x00, 0x7c, 0x00, 0x4b, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01,
+    0x00, 0x4b, 0x01, 0x7f, 0x00, 0x82, 0x00, 0x45, 0x00, 0x0d, 0x00, 0x0f, 0x00, 0x59, 0x00, 0x7f,
+    0x01, 0x89, 0x00, 0x73, 0x00, 0x18, 0x00, 0x39, 0x00, 0x81, 0x02, 0x73, 0x00, 0x76, 0x00, 0x5a,
+    0x03, 0x00, 0x00, 0x06, 0x00, 0x66, 0x00, 0x19, 0x00, 0x20, 0x00, 0x65, 0x00, 0x87, 0x00, 0x8a,
+    0x00, 0x89, 0x00, 0x7f, 0x00, 0x48, 0x00, 0x09, 0x04, 0x00, 0x00, 0x3d, 0x00, 0x80, 0x00, 0x03,
+    0x01, 0x00, 0x00, 0x23, 0x00, 0x64, 0x00, 0x29, 0x00, 0x72, 0x00, 0x87, 0x00, 0x82, 0x00, 0x7c,
+    0x00, 0x3f, 0x00, 0x03, 0x00, 0x00, 0x00, 0x07, 0x00, 0x60, 0x00, 0x7f, 0x00, 0x87, 0x00, 0x80,
+    0x00, 0x3a, 0x00, 0x07, 0x00, 0x1b, 0x00, 0x65, 0x00, 0x87, 0x01, 0x89, 0x00, 0x65, 0x00, 0x11,
+    0x00, 0x40, 0x00, 0x7e, 0x02, 0x73, 0x00, 0x76, 0x00, 0x0f, 0x00, 0x19, 0x00, 0x81, 0x02, 0x73,
+    0x00, 0x76, 0x00, 0x2f, 0x00, 0x07, 0x00, 0x74, 0x02, 0x73, 0x00, 0x75, 0x00, 0x76, 0xd3, 0x00,
+    0x01, 0x06, 0x03, 0x00, 0x01, 0x01, 0x02, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00, 0x01, 0x04, 0x00,
+    0x00, 0x01, 0x00, 0x02, 0x04, 0x00, 0x00, 0x01, 0x00, 0x0a, 0x00, 0x06, 0x11, 0x00, 0x00, 0x03,
+    0x00, 0x0f, 0x00, 0x0a, 0x00, 0x01, 0x05, 0x00, 0x00, 0x01, 0x00, 0x65, 0x00, 0x3a, 0x06, 0x00,
+    0x00, 0x06, 0x00, 0x08, 0x00, 0x01, 0x04, 0x00, 0x01, 0x01, 0x04, 0x00, 0x00, 0x02, 0x00, 0x0a,
+    0x00, 0x03, 0xff, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x00, 0x06, 0x01, 0x00, 0x00, 0x23, 0x00, 0x82,
+    0x00, 0x06, 0xff, 0x00, 0x38, 0x00, 0x00, 0x48, 0x00, 0x8a, 0x00, 0x1b, 0x00, 0x06, 0x00, 0x80,
+    0x00, 0x34, 0xff, 0x00, 0x38, 0x00, 0x00, 0x0f, 0x00, 0x96, 0x00, 0xa1, 0x00, 0x89, 0x00, 0x65,
+    0x00, 0x56, 0xff, 0x00, 0x3a, 0x00, 0x00, 0x46, 0x01, 0xa5, 0x00, 0x60, 0x00, 0x06, 0xff, 0x00,
+    0xff, 0x00, 0xff, 0x00, 0x23, 0x00,
 #endif /* GNW_TARGET_ZELDA */
 };
@@ -1,4 +1,5 @@
 #include <odroid_system.h>
+#include <ctype.h>
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
@@ -7,6 +8,9 @@
 #include "lupng.h"
 #include "gui.h"
 #include "gw_lcd.h"
+#include "gw_blit.h"
+#include "emu_arena.h"
+#include "lz4_depack.h"
 
 #define IMAGE_LOGO_WIDTH    (47)
 #define IMAGE_LOGO_HEIGHT   (51)
@@ -52,6 +56,18 @@ static size_t gp_buffer_size = 256 * 1024;
 static void  *gp_buffer = NULL;
 static char str_buffer[128];
 
+// What gui_draw_list() left in each of the (up to three) framebuffers
+typedef struct {
+    void *buffer;
+    const listbox_item_t *items;
+    int length;
+    int cursor;
+    int lines;
+} list_drawn_t;
+
+static list_drawn_t list_drawn[3];
+static uint32_t list_swap_count;
+
 retro_gui_t gui;
 
 void gui_event(gui_event_t event, tab_t *tab)
@@ -129,8 +145,11 @@ void gui_save_current_tab()
 {
     tab_t *tab = gui_get_current_tab();
 
-    odroid_settings_MainMenuCursor_set(tab->listbox.cursor);
-    odroid_settings_MainMenuSelectedTab_set(gui.selected);
+    // There are no tabs yet when a game is resumed at boot
+    if (tab != NULL) {
+        odroid_settings_MainMenuCursor_set(tab->listbox.cursor);
+        odroid_settings_MainMenuSelectedTab_set(gui.selected);
+    }
     odroid_settings_commit();
 }
 
@@ -183,6 +202,66 @@ void gui_resize_list(tab_t *tab, int new_size)
     printf("gui_resize_list: Resized list '%s' from %d to %d items\n", tab->name, cur_size, new_size);
 }
 
+// Same as the index of parse_roms.py: what sorts after 'z' goes with it
+static int letter_of(const listbox_item_t *item)
+{
+    int c = tolower((unsigned char) item->text[0]);
+
+    return (c < 'a') ? 0 : MIN(c, 'z');
+}
+
+// Rows that start a letter: the first one, and each first row of a letter
+static bool letter_start(const listbox_t *list, int row)
+{
+    if (row == 0) {
+        return true;
+    }
+    if (list->letters) {
+        for (int i = 0; i < LISTBOX_LETTERS; i++) {
+            if (list->letters[i] == row) {
+                return true;
+            }
+        }
+        return false;
+    }
+    return letter_of(&list->items[row]) != letter_of(&list->items[row - 1]);
+}
+
+static int letter_up(const listbox_t *list, int cursor)
+{
+    int up = 0;
+
+    if (list->letters == NULL) {
+        while (--cursor > 0 && !letter_start(list, cursor)) {
+        }
+        return MAX(cursor, 0);
+    }
+
+    for (int i = 0; i < LISTBOX_LETTERS; i++) {
+        if (list->letters[i] < cursor) {
+            up = list->letters[i];
+        }
+    }
+    return up;
+}
+
+static int letter_down(const listbox_t *list, int cursor)
+{
+    if (list->letters == NULL) {
+        while (++cursor < list->length && !letter_start(list, cursor)) {
+        }
+        return cursor;
+    }
+
+    for (int i = 0; i < LISTBOX_LETTERS; i++) {
+        if (list->letters[i] > cursor) {
+            return list->letters[i];
+        }
+    }
+    return list->length;
+}
+
+// Only moves the cursor, the caller redraws the list once it's done with the key
 void gui_scroll_list(tab_t *tab, scroll_mode_t mode)
 {
     listbox_t *list = &tab->listbox;
@@ -201,20 +280,24 @@ void gui_scroll_list(tab_t *tab, scroll_mode_t mode)
         cur_cursor++;
     }
     else if (mode == PAGE_UP) {
-        char st = ((char*)list->items[cur_cursor].text)[0];
-        int max = LIST_LINE_COUNT - 2;
-        while (--cur_cursor > 0 && max-- > 0)
-        {
-           if (st != ((char*)list->items[cur_cursor].text)[0]) break;
-        }
+        cur_cursor = (cur_cursor == 0) ? -1 : MAX(cur_cursor - (LIST_LINE_COUNT - 1), 0);
     }
     else if (mode == PAGE_DOWN) {
-        char st = ((char*)list->items[cur_cursor].text)[0];
-        int max = LIST_LINE_COUNT - 2;
-        while (++cur_cursor < list->length-1 && max-- > 0)
-        {
-           if (st != ((char*)list->items[cur_cursor].text)[0]) break;
-        }
+        cur_cursor = (cur_cursor == list->length - 1) ? list->length :
+                     MIN(cur_cursor + (LIST_LINE_COUNT - 1), list->length - 1);
+    }
+    else if (mode == FIRST_ROW) {
+        cur_cursor = 0;
+    }
+    else if (mode == LAST_ROW) {
+        cur_cursor = list->length - 1;
+    }
+    else if (mode == LETTER_UP) {
+        // From the first row to the start of the last letter
+        cur_cursor = (cur_cursor == 0) ? letter_up(list, list->length) : letter_up(list, cur_cursor);
+    }
+    else if (mode == LETTER_DOWN) {
+        cur_cursor = letter_down(list, cur_cursor);
     }
 
     if (cur_cursor < 0) cur_cursor = list->length - 1;
@@ -225,7 +308,6 @@ void gui_scroll_list(tab_t *tab, scroll_mode_t mode)
     if (cur_cursor != old_cursor)
     {
         gui_draw_notice(" ", C_BLACK);
-        gui_draw_list(tab);
         gui_event(TAB_SCROLL, tab);
     }
 }
@@ -239,6 +321,7 @@ void gui_redraw()
     gui_event(TAB_REDRAW, tab);
 
     lcd_swap();
+    list_swap_count = lcd_get_swap_count();
 }
 
 void gui_draw_navbar()
@@ -249,10 +332,81 @@ void gui_draw_navbar()
     }
 }
 
+typedef struct {
+    uint16_t width;
+    uint16_t height;
+    uint16_t colors;
+    uint16_t palette[];
+} packed_bitmap_t;
+
+#ifndef GW_LCD_MODE_LUT8
+// Indices of the banner unpacked last, see bitmaps.h
+static uint8_t *header_cache;
+static const void *header_cached;
+
+static bool draw_cached_bitmap(short left, short top, const packed_bitmap_t *bitmap)
+{
+    const uint8_t *run = (const uint8_t *) &bitmap->palette[bitmap->colors];
+    uint16_t *dest = lcd_get_active_buffer();
+    uint8_t *dst, *end;
+
+    if (header_cache == NULL) {
+        header_cache = emu_arena_try_alloc(EMU_ARENA_RAM_EMU, IMAGE_BANNER_WIDTH * IMAGE_BANNER_HEIGHT, 32);
+    }
+    if (header_cache == NULL || bitmap->width * bitmap->height > IMAGE_BANNER_WIDTH * IMAGE_BANNER_HEIGHT) {
+        return false;
+    }
+
+    dst = header_cache;
+    end = dst + bitmap->width * bitmap->height;
+    for (; header_cached != bitmap && dst < end; run += 2) {
+        uint32_t len = run[0] + 1;
+
+        memset(dst, run[1], MIN(len, end - dst));
+        dst += len;
+    }
+    header_cached = bitmap;
+
+    gw_blit_set_clut_rgb565(bitmap->palette, bitmap->colors);
+    gw_blit_l8_to_rgb565(header_cache, bitmap->width, &dest[top * GW_LCD_WIDTH + left], GW_LCD_WIDTH,
+                         bitmap->width, bitmap->height);
+    gw_blit_wait();
+    return true;
+}
+#endif
+
+void gui_release_caches(void)
+{
+#ifndef GW_LCD_MODE_LUT8
+    header_cache = NULL;
+    header_cached = NULL;
+#endif
+}
+
+static void draw_packed_bitmap(short left, short top, const packed_bitmap_t *bitmap)
+{
+    const uint8_t *run = (const uint8_t *) &bitmap->palette[bitmap->colors];
+    pixel_t *dest = lcd_get_active_buffer();
+    uint32_t size = bitmap->width * bitmap->height;
+
+#ifndef GW_LCD_MODE_LUT8
+    if (draw_cached_bitmap(left, top, bitmap)) {
+        return;
+    }
+#endif
+
+    // Straight into the frame, e.g. in the flash app that has no arena
+    for (uint32_t i = 0; i < size; run += 2) {
+        for (uint32_t len = run[0] + 1; len > 0 && i < size; len--, i++) {
+            dest[(top + i / bitmap->width) * GW_LCD_WIDTH + left + i % bitmap->width] = bitmap->palette[run[1]];
+        }
+    }
+}
+
 void gui_draw_header(tab_t *tab)
 {
     if (tab->img_header)
-        odroid_display_write(0, ODROID_SCREEN_HEIGHT - IMAGE_BANNER_HEIGHT - 15, IMAGE_BANNER_WIDTH, IMAGE_BANNER_HEIGHT, tab->img_header);
+        draw_packed_bitmap(0, ODROID_SCREEN_HEIGHT - IMAGE_BANNER_HEIGHT - 15, tab->img_header);
 
     odroid_overlay_draw_fill_rect(0, ODROID_SCREEN_HEIGHT - 15, ODROID_SCREEN_WIDTH, 1, C_GW_YELLOW);
     odroid_overlay_draw_fill_rect(0, ODROID_SCREEN_HEIGHT - 14, ODROID_SCREEN_WIDTH, 4, C_GW_MAIN_COLOR);
@@ -289,78 +443,148 @@ void gui_draw_status(tab_t *tab)
     odroid_overlay_draw_battery(ODROID_SCREEN_WIDTH - 32, 17);
 }
 
+static list_drawn_t *list_drawn_get(void *buffer)
+{
+    for (int i = 0; i < 3; i++) {
+        if (list_drawn[i].buffer == buffer)
+            return &list_drawn[i];
+    }
+    for (int i = 0; i < 3; i++) {
+        if (list_drawn[i].buffer == NULL) {
+            list_drawn[i].buffer = buffer;
+            return &list_drawn[i];
+        }
+    }
+    return NULL;
+}
+
+static void gui_draw_list_line(listbox_t *list, int line, int lines, int columns)
+{
+    int entry = list->cursor + line - (lines / 2);
+
+    if (entry >= 0 && entry < list->length) {
+        sprintf(str_buffer, "%.*s", columns, list->items[entry].text);
+    } else {
+        str_buffer[0] = '\0';
+    }
+
+    odroid_overlay_draw_text(
+        LIST_X_OFFSET,
+        LIST_Y_OFFSET + line * LIST_LINE_HEIGHT,
+        LIST_WIDTH,
+        str_buffer,
+        (entry == list->cursor) ? C_GW_YELLOW : C_GW_OPAQUE_YELLOW,
+        C_BLACK
+    );
+}
+
 void gui_draw_list(tab_t *tab)
 {
     int columns = LIST_WIDTH / odroid_overlay_get_font_width();
     int lines = LIST_LINE_COUNT;
     // theme_t *theme = &gui_themes[gui.theme % gui_themes_count];
     listbox_t *list = &tab->listbox;
+    pixel_t *buffer = lcd_get_active_buffer();
+
+    // Anyone else swapping the buffers may have drawn over the list
+    if (lcd_get_swap_count() != list_swap_count) {
+        memset(list_drawn, 0, sizeof(list_drawn));
+        list_swap_count = lcd_get_swap_count();
+    }
 
-    odroid_overlay_draw_fill_rect(0, LIST_Y_OFFSET, LIST_WIDTH, LIST_HEIGHT, C_BLACK);
+    list_drawn_t *drawn = list_drawn_get(buffer);
+    int shift = drawn ? list->cursor - drawn->cursor : 0;
 
-    for (int i = 0; i < lines; i++) {
-        int entry = list->cursor + i - (lines / 2);
+    // The list is centered on the cursor, so moving it shifts every line.
+    // Reuse what is already in the buffer by moving the lines and only
+    // draw the ones that came into view, plus the old and new selection.
+    if (drawn == NULL || drawn->items != list->items ||
+        drawn->length != list->length || drawn->lines != lines ||
+        abs(shift) >= lines) {
+        odroid_overlay_draw_fill_rect(0, LIST_Y_OFFSET, LIST_WIDTH, LIST_HEIGHT, C_BLACK);
 
-        if (entry >= 0 && entry < list->length) {
-            sprintf(str_buffer, "%.*s", columns, list->items[entry].text);
-        } else {
-            str_buffer[0] = '\0';
+        for (int i = 0; i < lines; i++) {
+            gui_draw_list_line(list, i, lines, columns);
         }
+    } else {
+        size_t line_size = LIST_LINE_HEIGHT * GW_LCD_WIDTH * sizeof(pixel_t);
+        pixel_t *top = &buffer[LIST_Y_OFFSET * GW_LCD_WIDTH];
+
+        if (shift > 0) {
+            memmove(top, &top[shift * line_size / sizeof(pixel_t)], (lines - shift) * line_size);
+        } else if (shift < 0) {
+            memmove(&top[-shift * line_size / sizeof(pixel_t)], top, (lines + shift) * line_size);
+        }
+
+        for (int i = 0; i < lines; i++) {
+            int from = i + shift;
 
-        odroid_overlay_draw_text(
-            LIST_X_OFFSET,
-            LIST_Y_OFFSET + i * LIST_LINE_HEIGHT,
-            LIST_WIDTH,
-            str_buffer,
-            (entry == list->cursor) ? C_GW_YELLOW : C_GW_OPAQUE_YELLOW,
-            C_BLACK
-        );
+            // The first line is shared with the notice, never move it around
+            if (from < 0 || from >= lines || from == 0 || i == 0 ||
+                from == lines / 2 || i == lines / 2) {
+                gui_draw_list_line(list, i, lines, columns);
+            }
+        }
+    }
 
+    if (drawn) {
+        drawn->items = list->items;
+        drawn->length = list->length;
+        drawn->cursor = list->cursor;
+        drawn->lines = lines;
     }
 }
 
 void gui_draw_cover(retro_emulator_file_t *file)
 {
-    retro_emulator_t *emu = file_to_emu(file);
+    const uint8_t *cover = file->cover;
+    const uint16_t *pixels = NULL;
+    uint16_t cover_width = 0, cover_height = 0;
 
-    if (gp_buffer == NULL)
-        gp_buffer = rg_alloc(gp_buffer_size, MEM_ANY);
+    if (cover == NULL)
+        return;
 
-    uint16_t *cover_buffer = (uint16_t*)gp_buffer;
-    const int cover_buffer_length = gp_buffer_size / 2;
-    uint16_t cover_width = 0, cover_height = 0;
+    // Packed by parse_roms.py, the pixels may not be aligned
+    memcpy(&cover_width, &cover[0], sizeof(cover_width));
+    memcpy(&cover_height, &cover[2], sizeof(cover_height));
 
-    if (file->checksum > 0 && file->missing_cover == 0)
+    if (memcmp(&cover[4], LZ4_MAGIC, LZ4_MAGIC_SIZE) == 0)
     {
-        char path1[128], path2[128], buf_crc[10];
-
-        sprintf(buf_crc, "%08lX", file->checksum);
-        sprintf(path1, "%s/%s/%c/%s.png", ODROID_BASE_PATH_ROMART, emu->dirname, buf_crc[0], buf_crc);
-        sprintf(path2, "%s/%s/%c/%s.art", ODROID_BASE_PATH_ROMART, emu->dirname, buf_crc[0], buf_crc);
+        if (gp_buffer == NULL)
+            gp_buffer = rg_alloc(gp_buffer_size, MEM_ANY);
 
-        FILE *fp;
+        lz4_stream_t stream;
+        int status = lz4_stream_init(&stream, &cover[4], gp_buffer, gp_buffer_size);
 
-        if ((fp = fopen(path2, "rb")))
-        {
-            fread(&cover_width, 2, 1, fp);
-            fread(&cover_height, 2, 1, fp);
-            fread(cover_buffer, 2, cover_buffer_length, fp);
-            fclose(fp);
+        while (status == LZ4_STREAM_MORE) {
+            status = lz4_stream_run(&stream, gp_buffer_size);
         }
 
-        if (cover_width > 0 && cover_height > 0)
-        {
-            int height = MIN(cover_height, COVER_MAX_HEIGHT);
-            int width = MIN(cover_width, COVER_MAX_WIDTH);
+        if (status == LZ4_STREAM_DONE && stream.out_pos == cover_width * cover_height * 2)
+            pixels = gp_buffer;
+    }
+    else
+    {
+        // Drawn straight from the memory mapped flash
+        pixels = (const uint16_t *)&cover[4];
+    }
 
-            if (cover_height > COVER_MAX_HEIGHT || cover_width > COVER_MAX_WIDTH)
-                gui_draw_notice("Art too large", C_ORANGE);
+    if (pixels && cover_width > 0 && cover_height > 0)
+    {
+        int height = MIN(cover_height, COVER_MAX_HEIGHT);
+        int width = MIN(cover_width, COVER_MAX_WIDTH);
 
-            odroid_display_write_rect(320 - width, 240 - height, width, height, cover_width, cover_buffer);
-            return;
-        }
+        if (cover_height > COVER_MAX_HEIGHT || cover_width > COVER_MAX_WIDTH)
+            gui_draw_notice("Art too large", C_ORANGE);
+
+        odroid_display_write_rect(320 - width, 240 - height, width, height, cover_width, pixels);
+
+        // Covers are drawn over the list, it has to be redrawn from scratch
+        list_drawn_t *drawn = list_drawn_get(lcd_get_active_buffer());
+        if (drawn)
+            drawn->lines = 0;
+        return;
     }
 
-    gui_draw_notice(" No art found", C_RED);
-    file->missing_cover = 1;
+    gui_draw_notice(" Bad art", C_RED);
 }
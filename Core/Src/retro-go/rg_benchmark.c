@@ -0,0 +1,444 @@
+#include <odroid_system.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "rg_benchmark.h"
+#include "main.h"
+#include "gw_flash.h"
+#include "gw_lcd.h"
+#include "gw_linker.h"
+#include "gw_timer.h"
+#include "gw_blit.h"
+#include "emu_arena.h"
+#include "lz4_pack.h"
+#include "lzma.h"
+#include "miniz.h"
+#include "inflate_fast.h"
+
+#define COPY_SIZE         (16 * 1024)
+#define COPY_PASSES       64
+
+#define FLASH_READ_SIZE   (1024 * 1024)
+#define FLASH_READ_COUNT  4096
+#define FLASH_BLOCK_SIZE  (64 * 1024)
+
+#define BLIT_PASSES       16
+#define CODEC_PASSES      16
+
+#define MAX_RESULTS       20
+#define VALUE_LENGTH      16
+
+static const char *words[16] = {
+    "the ", "game ", "and ", "watch ", "retro ", "go ", "frame ", "blit ",
+    "flash ", "audio ", "sprite ", "tile ", "bank ", "cpu ", "palette ", "scanline ",
+};
+
+typedef struct {
+    const char *name;
+    emu_arena_region_t arena;
+    uintptr_t start;
+    uintptr_t end;
+} region_t;
+
+static const region_t regions[] = {
+    {"DTCM", EMU_ARENA_DTCM, (uintptr_t) &__dtc_padding_start__, (uintptr_t) &__dtc_padding_end__},
+    {"AXI", EMU_ARENA_RAM_EMU, (uintptr_t) __RAM_EMU_START__, (uintptr_t) &__RAM_EMU_END__},
+    {"AHB", EMU_ARENA_AHBRAM, (uintptr_t) &__ahbram_end__, (uintptr_t) &__AHBRAM_END__},
+};
+
+#define REGION_COUNT (sizeof(regions) / sizeof(regions[0]))
+
+static char labels[MAX_RESULTS][24];
+static char values[MAX_RESULTS][VALUE_LENGTH];
+static uint32_t result_count;
+
+static void result(const char *label, const char *format, ...)
+{
+    va_list args;
+
+    if (result_count == MAX_RESULTS) {
+        return;
+    }
+
+    snprintf(labels[result_count], sizeof(labels[0]), "%s", label);
+    va_start(args, format);
+    vsnprintf(values[result_count], sizeof(values[0]), format, args);
+    va_end(args);
+
+    printf("Bench: %s %s\n", labels[result_count], values[result_count]);
+    result_count++;
+
+    wdog_refresh();
+}
+
+// bytes per microsecond is MB/s
+static void result_rate(const char *label, uint32_t bytes, uint32_t us)
+{
+    if (us == 0) {
+        us = 1;
+    }
+    result(label, "%lu MB/s", bytes / us);
+}
+
+void benchmark_payload(uint8_t *buffer, size_t size)
+{
+    uint32_t x = 1;
+    size_t pos = 0;
+
+    while (pos < size) {
+        const char *word;
+
+        // xorshift32, same as tools/benchmark_payload.py
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+
+        for (word = words[x & 15]; *word && pos < size; word++) {
+            buffer[pos++] = *word;
+        }
+    }
+}
+
+static uint8_t *region_alloc(const region_t *region, size_t size)
+{
+    uint8_t *block = emu_arena_try_alloc(region->arena, size, 32);
+
+    // Falling back to the next region would measure the wrong memory
+    if (block != NULL && ((uintptr_t) block < region->start || (uintptr_t) block + size > region->end)) {
+        return NULL;
+    }
+    return block;
+}
+
+static void bench_memcpy(void)
+{
+    uint32_t marks[EMU_ARENA_COUNT];
+    uint8_t *buffers[REGION_COUNT][2];
+    char label[24];
+
+    for (int i = 0; i < EMU_ARENA_COUNT; i++) {
+        marks[i] = emu_arena_mark(i);
+    }
+
+    for (int i = 0; i < REGION_COUNT; i++) {
+        buffers[i][0] = region_alloc(&regions[i], COPY_SIZE);
+        buffers[i][1] = region_alloc(&regions[i], COPY_SIZE);
+    }
+
+    for (int src = 0; src < REGION_COUNT; src++) {
+        for (int dst = 0; dst < REGION_COUNT; dst++) {
+            // Two buffers, so copies within a region don't overlap
+            uint8_t *from = buffers[src][0];
+            uint8_t *to = buffers[dst][(src == dst) ? 1 : 0];
+            uint32_t us = 0;
+
+            snprintf(label, sizeof(label), "memcpy %s>%s", regions[src].name, regions[dst].name);
+            if (from == NULL || to == NULL) {
+                result(label, "n/a");
+                continue;
+            }
+
+            for (int pass = 0; pass < COPY_PASSES; pass++) {
+                SCB_CleanInvalidateDCache_by_Addr((uint32_t *) from, COPY_SIZE);
+                SCB_CleanInvalidateDCache_by_Addr((uint32_t *) to, COPY_SIZE);
+
+                uint32_t start = gw_timer_us();
+                memcpy(to, from, COPY_SIZE);
+                // Until the copy is in the RAM
+                SCB_CleanDCache_by_Addr((uint32_t *) to, COPY_SIZE);
+                us += gw_timer_us() - start;
+            }
+
+            result_rate(label, COPY_SIZE * COPY_PASSES, us);
+        }
+    }
+
+    for (int i = 0; i < EMU_ARENA_COUNT; i++) {
+        emu_arena_release(i, marks[i]);
+    }
+}
+
+static void bench_flash_read(void)
+{
+    const uint8_t *flash = &__EXTFLASH_START__;
+    uint32_t size = MIN(FLASH_READ_SIZE, (uint32_t) &__EXTFLASH_TOTAL_LENGTH__) & ~31;
+    volatile uint32_t sum = 0;
+    uint32_t x = 1;
+    uint32_t start;
+    uint32_t us;
+
+    // Read only, so there's nothing to clean
+    SCB_InvalidateDCache_by_Addr((uint32_t *) flash, size);
+    start = gw_timer_us();
+    for (uint32_t i = 0; i < size; i += 4) {
+        sum += *(const uint32_t *) &flash[i];
+    }
+    result_rate("Flash seq. read", size, gw_timer_us() - start);
+
+    // One cache line per read, scattered over the same range
+    SCB_InvalidateDCache_by_Addr((uint32_t *) flash, size);
+    start = gw_timer_us();
+    for (uint32_t i = 0; i < FLASH_READ_COUNT; i++) {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        sum += *(const uint32_t *) &flash[(x % (size / 32)) * 32];
+    }
+    us = gw_timer_us() - start;
+    result("Flash rand. read", "%lu ns", (us * 1000) / FLASH_READ_COUNT);
+}
+
+// Nothing was programmed into it since it was erased
+static bool flash_block_blank(uint32_t address)
+{
+    const uint32_t *block = (const uint32_t *) (&__EXTFLASH_BASE__ + address);
+
+    SCB_InvalidateDCache_by_Addr((uint32_t *) block, FLASH_BLOCK_SIZE);
+    for (uint32_t i = 0; i < FLASH_BLOCK_SIZE / sizeof(uint32_t); i++) {
+        if (block[i] != 0xffffffff) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void bench_flash_write(bool allowed)
+{
+    uint32_t image_end = (uint32_t) &__EXTFLASH_OFFSET__ + (uint32_t) &__EXTFLASH_TOTAL_LENGTH__;
+    uint32_t address = (image_end + FLASH_BLOCK_SIZE - 1) & ~(FLASH_BLOCK_SIZE - 1);
+    uint32_t mark = emu_arena_mark(EMU_ARENA_RAM_EMU);
+    uint8_t *buffer = emu_arena_try_alloc(EMU_ARENA_RAM_EMU, FLASH_BLOCK_SIZE, 32);
+    uint32_t erase_us;
+    uint32_t program_us;
+    uint32_t start;
+    bool ok;
+
+    // Never touches the firmware, the ROMs or the saves, nor what else was
+    // put after them, it's erased again afterwards
+    if (!allowed || buffer == NULL || address + FLASH_BLOCK_SIZE > OSPI_GetSize() ||
+        !flash_block_blank(address)) {
+        result("Flash erase", "n/a");
+        result("Flash program", "n/a");
+        emu_arena_release(EMU_ARENA_RAM_EMU, mark);
+        return;
+    }
+
+    benchmark_payload(buffer, FLASH_BLOCK_SIZE);
+
+    OSPI_DisableMemoryMappedMode();
+    start = gw_timer_us();
+    OSPI_EraseSync(address, FLASH_BLOCK_SIZE);
+    erase_us = gw_timer_us() - start;
+
+    start = gw_timer_us();
+    OSPI_Program(address, buffer, FLASH_BLOCK_SIZE);
+    program_us = gw_timer_us() - start;
+    OSPI_EnableMemoryMappedMode();
+
+    SCB_InvalidateDCache_by_Addr((uint32_t *) (&__EXTFLASH_BASE__ + address), FLASH_BLOCK_SIZE);
+    ok = memcmp(&__EXTFLASH_BASE__ + address, buffer, FLASH_BLOCK_SIZE) == 0;
+
+    // Leave it as it was found
+    OSPI_DisableMemoryMappedMode();
+    OSPI_EraseSync(address, FLASH_BLOCK_SIZE);
+    OSPI_EnableMemoryMappedMode();
+    SCB_InvalidateDCache_by_Addr((uint32_t *) (&__EXTFLASH_BASE__ + address), FLASH_BLOCK_SIZE);
+
+    result("Flash erase", "%lu kB/s", (uint32_t) ((FLASH_BLOCK_SIZE * 1000000ULL) / 1024 / MAX(erase_us, 1)));
+    if (ok) {
+        result("Flash program", "%lu kB/s", (uint32_t) ((FLASH_BLOCK_SIZE * 1000000ULL) / 1024 / MAX(program_us, 1)));
+    } else {
+        result("Flash program", "bad data");
+    }
+
+    emu_arena_release(EMU_ARENA_RAM_EMU, mark);
+}
+
+static void bench_blit(void)
+{
+    uint32_t pixels = GW_LCD_WIDTH * GW_LCD_HEIGHT;
+    uint32_t mark = emu_arena_mark(EMU_ARENA_RAM_EMU);
+    uint16_t *dst = emu_arena_try_alloc(EMU_ARENA_RAM_EMU, pixels * 2, 32);
+    uint16_t *src = emu_arena_try_alloc(EMU_ARENA_RAM_EMU, pixels * 2, 32);
+    uint8_t *src_l8 = emu_arena_try_alloc(EMU_ARENA_RAM_EMU, pixels, 32);
+    uint16_t palette[256];
+    uint32_t start;
+
+    if (dst == NULL || src == NULL || src_l8 == NULL) {
+        result("DMA2D fill", "n/a");
+        result("DMA2D copy", "n/a");
+        result("DMA2D L8", "n/a");
+        emu_arena_release(EMU_ARENA_RAM_EMU, mark);
+        return;
+    }
+
+    // Not the LCD buffers, so nothing shows up on the screen
+    for (int i = 0; i < 256; i++) {
+        palette[i] = i * 0x0101;
+    }
+    memset(src, 0x55, pixels * 2);
+    memset(src_l8, 0xaa, pixels);
+    SCB_CleanDCache_by_Addr((uint32_t *) src, pixels * 2);
+    SCB_CleanDCache_by_Addr((uint32_t *) src_l8, pixels);
+    gw_blit_set_clut_rgb565(palette, 256);
+
+    start = gw_timer_us();
+    for (int pass = 0; pass < BLIT_PASSES; pass++) {
+        gw_blit_fill_rgb565(dst, GW_LCD_WIDTH, GW_LCD_WIDTH, GW_LCD_HEIGHT, pass);
+        gw_blit_wait();
+    }
+    result("DMA2D fill", "%lu us", (gw_timer_us() - start) / BLIT_PASSES);
+
+    start = gw_timer_us();
+    for (int pass = 0; pass < BLIT_PASSES; pass++) {
+        gw_blit_copy_rgb565(src, GW_LCD_WIDTH, dst, GW_LCD_WIDTH, GW_LCD_WIDTH, GW_LCD_HEIGHT);
+        gw_blit_wait();
+    }
+    result("DMA2D copy", "%lu us", (gw_timer_us() - start) / BLIT_PASSES);
+
+    start = gw_timer_us();
+    for (int pass = 0; pass < BLIT_PASSES; pass++) {
+        gw_blit_l8_to_rgb565(src_l8, GW_LCD_WIDTH, dst, GW_LCD_WIDTH, GW_LCD_WIDTH, GW_LCD_HEIGHT);
+        gw_blit_wait();
+    }
+    result("DMA2D L8", "%lu us", (gw_timer_us() - start) / BLIT_PASSES);
+
+    emu_arena_release(EMU_ARENA_RAM_EMU, mark);
+}
+
+typedef struct {
+    uint8_t *buffer;
+    size_t size;
+} pack_ctx_t;
+
+static void pack_write(void *ctx, const unsigned char *data, size_t size)
+{
+    pack_ctx_t *pack = ctx;
+
+    memcpy(&pack->buffer[pack->size], data, size);
+    pack->size += size;
+}
+
+static void bench_codecs(void)
+{
+    uint32_t mark = emu_arena_mark(EMU_ARENA_RAM_EMU);
+    uint8_t *payload = emu_arena_try_alloc(EMU_ARENA_RAM_EMU, BENCHMARK_PAYLOAD_SIZE, 32);
+    uint8_t *out = emu_arena_try_alloc(EMU_ARENA_RAM_EMU, BENCHMARK_PAYLOAD_SIZE, 32);
+    uint8_t *packed = emu_arena_try_alloc(EMU_ARENA_RAM_EMU, LZ4_PACK_BOUND(BENCHMARK_PAYLOAD_SIZE), 32);
+    pack_ctx_t pack = {packed, 0};
+    uint32_t start;
+    uint32_t us;
+    bool ok;
+
+    if (payload == NULL || out == NULL || packed == NULL) {
+        result("Unpack LZ4", "n/a");
+        result("Unpack DEFLATE", "n/a");
+#if DEFLATE_FAST
+        result("Unpack DEFLATE fast", "n/a");
+#endif
+        result("Unpack LZMA", "n/a");
+        emu_arena_release(EMU_ARENA_RAM_EMU, mark);
+        return;
+    }
+
+    benchmark_payload(payload, BENCHMARK_PAYLOAD_SIZE);
+    // There's no LZ4 payload in flash, the device can pack it itself
+    lz4_block_pack(payload, BENCHMARK_PAYLOAD_SIZE, pack_write, &pack);
+
+    ok = true;
+    start = gw_timer_us();
+    for (int pass = 0; pass < CODEC_PASSES; pass++) {
+        ok &= lz4_block_unpack(packed, pack.size, out, BENCHMARK_PAYLOAD_SIZE) == BENCHMARK_PAYLOAD_SIZE;
+    }
+    us = gw_timer_us() - start;
+    ok &= memcmp(out, payload, BENCHMARK_PAYLOAD_SIZE) == 0;
+    if (ok) {
+        result_rate("Unpack LZ4", BENCHMARK_PAYLOAD_SIZE * CODEC_PASSES, us);
+    } else {
+        result("Unpack LZ4", "bad data");
+    }
+
+    ok = true;
+    memset(out, 0, BENCHMARK_PAYLOAD_SIZE);
+    start = gw_timer_us();
+    for (int pass = 0; pass < CODEC_PASSES; pass++) {
+        ok &= tinfl_decompress_mem_to_mem(out, BENCHMARK_PAYLOAD_SIZE,
+                                          benchmark_payload_deflate, benchmark_payload_deflate_size,
+                                          0) == BENCHMARK_PAYLOAD_SIZE;
+    }
+    us = gw_timer_us() - start;
+    ok &= memcmp(out, payload, BENCHMARK_PAYLOAD_SIZE) == 0;
+    if (ok) {
+        result_rate("Unpack DEFLATE", BENCHMARK_PAYLOAD_SIZE * CODEC_PASSES, us);
+    } else {
+        result("Unpack DEFLATE", "bad data");
+    }
+
+#if DEFLATE_FAST
+    uint32_t dtcm_mark = emu_arena_mark(EMU_ARENA_DTCM);
+    inflate_tables_t *tables = region_alloc(&regions[0], sizeof(*tables));
+
+    ok = tables != NULL;
+    memset(out, 0, BENCHMARK_PAYLOAD_SIZE);
+    start = gw_timer_us();
+    for (int pass = 0; ok && pass < CODEC_PASSES; pass++) {
+        ok &= inflate_fast(out, BENCHMARK_PAYLOAD_SIZE, benchmark_payload_deflate, benchmark_payload_deflate_size,
+                           tables, NULL) == BENCHMARK_PAYLOAD_SIZE;
+    }
+    us = gw_timer_us() - start;
+    ok &= memcmp(out, payload, BENCHMARK_PAYLOAD_SIZE) == 0;
+    if (tables == NULL) {
+        result("Unpack DEFLATE fast", "n/a");
+    } else if (ok) {
+        result_rate("Unpack DEFLATE fast", BENCHMARK_PAYLOAD_SIZE * CODEC_PASSES, us);
+    } else {
+        result("Unpack DEFLATE fast", "bad data");
+    }
+    emu_arena_release(EMU_ARENA_DTCM, dtcm_mark);
+#endif
+
+    memset(out, 0, BENCHMARK_PAYLOAD_SIZE);
+    start = gw_timer_us();
+    for (int pass = 0; pass < CODEC_PASSES; pass++) {
+        // Asserts on corrupt data
+        lzma_inflate(out, BENCHMARK_PAYLOAD_SIZE, benchmark_payload_lzma, benchmark_payload_lzma_size);
+    }
+    us = gw_timer_us() - start;
+    if (memcmp(out, payload, BENCHMARK_PAYLOAD_SIZE) == 0) {
+        result_rate("Unpack LZMA", BENCHMARK_PAYLOAD_SIZE * CODEC_PASSES, us);
+    } else {
+        result("Unpack LZMA", "bad data");
+    }
+
+    emu_arena_release(EMU_ARENA_RAM_EMU, mark);
+}
+
+void benchmark_run(void)
+{
+    odroid_dialog_choice_t running[] = {
+        {0, "Running...", "", 1, NULL},
+        ODROID_DIALOG_CHOICE_LAST
+    };
+    odroid_dialog_choice_t last = ODROID_DIALOG_CHOICE_LAST;
+    odroid_dialog_choice_t choices[MAX_RESULTS + 2];
+    bool flash_write = odroid_overlay_confirm("Also erase free flash?", false) == 1;
+
+    odroid_overlay_draw_dialog("Benchmark", running, -1);
+    lcd_swap();
+
+    result_count = 0;
+    bench_memcpy();
+    bench_flash_read();
+    bench_flash_write(flash_write);
+    bench_blit();
+    bench_codecs();
+
+    for (int i = 0; i < result_count; i++) {
+        choices[i] = (odroid_dialog_choice_t) {0, labels[i], values[i], 1, NULL};
+    }
+    choices[result_count] = (odroid_dialog_choice_t) {0, "Close", "", 1, NULL};
+    choices[result_count + 1] = last;
+
+    odroid_overlay_dialog("Benchmark", choices, result_count);
+}
@@ -0,0 +1,206 @@
+// Generated by tools/benchmark_payload.py, don't edit
+
+#include <stdint.h>
+
+#include "rg_benchmark.h"
+
+const uint8_t benchmark_payload_deflate[] = {
+    0x7d, 0x99, 0x6b, 0x72, 0x23, 0x37, 0x0c, 0x84, 0xaf, 0xa2, 0xab, 0x29, 0xbb, 0x5a, 0xda, 0x15,
+    0xc7, 0xe3, 0xb2, 0xb5, 0x95, 0xeb, 0x67, 0xf9, 0x00, 0xfa, 0x6b, 0x90, 0xce, 0x0f, 0xcb, 0xd2,
+    0x0c, 0x87, 0x04, 0x81, 0x46, 0x37, 0xc0, 0x69, 0xf7, 0x7f, 0x1e, 0xb7, 0x36, 0x3e, 0xae, 0xdb,
+    0xd7, 0x8f, 0xfb, 0xfb, 0xdb, 0xeb, 0xfb, 0xba, 0xf0, 0x7c, 0x79, 0xdc, 0xbe, 0x3e, 0x3e, 0x5f,
+    0x9f, 0x8f, 0xdb, 0xfd, 0xfd, 0x67, 0xbf, 0xff, 0xf9, 0x78, 0x7e, 0x5e, 0xb7, 0xe7, 0xeb, 0xdb,
+    0xe3, 0xf6, 0xd7, 0xdb, 0xeb, 0x33, 0xee, 0x7e, 0xdc, 0xdf, 0x1e, 0xcf, 0xe7, 0x98, 0x61, 0x3c,
+    0xf8, 0xeb, 0xed, 0xfe, 0xf5, 0xb2, 0x3e, 0xc7, 0x85, 0xfb, 0xef, 0x9f, 0xaf, 0xd7, 0xed, 0xdf,
+    0xfb, 0xf3, 0xc7, 0xcb, 0xfa, 0x3e, 0xe6, 0xc8, 0xe5, 0xfa, 0xf4, 0xf3, 0xba, 0x2f, 0x12, 0x13,
+    0x8f, 0xc5, 0xe6, 0x75, 0x2c, 0xd0, 0xed, 0x9b, 0x17, 0x61, 0xa5, 0x3d, 0x32, 0x06, 0xaf, 0x9b,
+    0x73, 0xf5, 0x71, 0x79, 0x7c, 0x94, 0xf5, 0x7e, 0x7c, 0xfc, 0xee, 0x3f, 0xc6, 0xb2, 0x6b, 0xe8,
+    0xfd, 0xfd, 0x6f, 0xdd, 0xdf, 0x3f, 0xe7, 0xa8, 0xfe, 0x5c, 0xff, 0xfb, 0xf5, 0x19, 0x2e, 0x1b,
+    0xb3, 0xf7, 0x2f, 0x9b, 0x7d, 0x7d, 0xdc, 0x98, 0x35, 0x1d, 0x16, 0xcf, 0x8c, 0xe7, 0xd6, 0x7a,
+    0x73, 0xa6, 0x3e, 0x36, 0xfd, 0xd3, 0x6f, 0xa7, 0x25, 0x5a, 0x69, 0xfe, 0x1e, 0xcf, 0xcd, 0x70,
+    0xa4, 0x3f, 0xe5, 0xe3, 0xe9, 0x2a, 0x9b, 0x6d, 0xdd, 0x55, 0x74, 0xc7, 0xc0, 0x66, 0xf6, 0x8f,
+    0x49, 0xfb, 0xaf, 0xf9, 0x3c, 0x07, 0xce, 0x7d, 0xaf, 0x2b, 0xf9, 0xd4, 0x8a, 0xf6, 0x74, 0xe4,
+    0xf2, 0x6d, 0x42, 0x6b, 0x9b, 0x68, 0xac, 0x31, 0x37, 0xb2, 0xae, 0x68, 0xd7, 0xe9, 0x0b, 0xbb,
+    0x3f, 0x76, 0x80, 0x35, 0x5b, 0x0c, 0x9f, 0xf3, 0xa6, 0xbd, 0x0e, 0xac, 0x70, 0x74, 0x47, 0x06,
+    0xbc, 0x15, 0x97, 0x0d, 0x64, 0x73, 0xb9, 0x3f, 0x3b, 0xe8, 0x83, 0x03, 0x51, 0x63, 0x23, 0x7d,
+    0x99, 0x18, 0x15, 0x16, 0x02, 0x87, 0x2b, 0xc6, 0xb1, 0xe6, 0xd8, 0x5b, 0x2e, 0x3c, 0x26, 0x98,
+    0xe3, 0x64, 0x44, 0x8e, 0x35, 0x5f, 0x4e, 0x03, 0xfa, 0xa8, 0x09, 0x5e, 0x0f, 0x78, 0x8b, 0x69,
+    0xf2, 0xe1, 0xf9, 0x13, 0xc9, 0x97, 0x3b, 0x39, 0x67, 0xde, 0xd8, 0x2d, 0x52, 0xcd, 0x02, 0xee,
+    0xe6, 0x7f, 0xf3, 0x6b, 0x5a, 0x32, 0x3f, 0xe7, 0x9c, 0xda, 0xd9, 0xfc, 0x9d, 0x46, 0xcb, 0x73,
+    0xc3, 0xe3, 0xf0, 0xa9, 0xc0, 0xe0, 0xf6, 0xa6, 0x29, 0x7d, 0xac, 0x40, 0x9e, 0x19, 0x21, 0x24,
+    0xcf, 0xa5, 0x2c, 0xd3, 0x69, 0xcd, 0x7a, 0x76, 0x23, 0x90, 0x05, 0xce, 0x65, 0xf2, 0x0c, 0x0c,
+    0x36, 0x24, 0x5a, 0x43, 0xe2, 0x74, 0x5b, 0xc6, 0x26, 0x92, 0x37, 0x30, 0x98, 0xb8, 0x98, 0xcf,
+    0x60, 0x3a, 0xa5, 0x25, 0x6e, 0xc9, 0x1f, 0x63, 0x79, 0x87, 0x9e, 0x11, 0x15, 0xb9, 0x4c, 0x7b,
+    0x2e, 0xce, 0x58, 0xcf, 0x91, 0x46, 0xf7, 0x04, 0x9b, 0x4b, 0xe1, 0x9e, 0x53, 0xd6, 0x4a, 0x8b,
+    0x20, 0x2d, 0x8f, 0xfc, 0xb0, 0x15, 0x71, 0xeb, 0x7f, 0x9a, 0x2f, 0xec, 0x5b, 0x30, 0x75, 0x74,
+    0xc6, 0xcd, 0xbc, 0x50, 0xc4, 0x62, 0x00, 0x31, 0xc1, 0x28, 0x3a, 0xdb, 0x9e, 0x5b, 0xe8, 0x80,
+    0x7f, 0x05, 0x6f, 0x04, 0x63, 0x21, 0x60, 0xfa, 0xbe, 0xdb, 0x1e, 0x99, 0x0a, 0xe6, 0x58, 0xe9,
+    0x96, 0x5b, 0xec, 0xbb, 0x83, 0x2e, 0x38, 0x1e, 0x6d, 0x57, 0x6e, 0xfb, 0xf4, 0xae, 0x61, 0xd8,
+    0x8d, 0x1f, 0x10, 0xb6, 0xfb, 0xce, 0x4b, 0x82, 0x77, 0x7a, 0xb5, 0xc7, 0x27, 0xe5, 0xb7, 0xac,
+    0x4b, 0xb0, 0x72, 0xd0, 0x81, 0xbf, 0x0a, 0xc1, 0xc4, 0x4d, 0x33, 0xc3, 0xd4, 0xa0, 0x51, 0x51,
+    0x02, 0xee, 0x80, 0xb0, 0x19, 0x36, 0x95, 0x82, 0x9a, 0x03, 0xfa, 0x21, 0x58, 0x96, 0x58, 0x5f,
+    0x9e, 0xc2, 0x69, 0x45, 0x52, 0xc0, 0x62, 0x26, 0x27, 0xd4, 0x39, 0xbb, 0x82, 0x33, 0xb7, 0x6f,
+    0x6a, 0x08, 0x4c, 0x6e, 0x7b, 0x85, 0x78, 0x14, 0xa6, 0x48, 0x91, 0x78, 0x29, 0xfc, 0xb0, 0xea,
+    0x1b, 0x17, 0x5d, 0xb1, 0x40, 0xab, 0x84, 0x57, 0x80, 0xc4, 0x1c, 0xea, 0x4f, 0x79, 0xb0, 0xa3,
+    0x2c, 0xe2, 0x04, 0x00, 0x65, 0x18, 0x74, 0x28, 0x76, 0x32, 0xe9, 0xb7, 0xa4, 0x00, 0x89, 0xd4,
+    0x04, 0xdb, 0x29, 0x3d, 0x15, 0x55, 0xa9, 0x5b, 0x6a, 0x3b, 0x30, 0x43, 0xb3, 0xc8, 0xe7, 0x97,
+    0x8c, 0xe1, 0x74, 0x62, 0x48, 0x49, 0x75, 0x92, 0x80, 0x2f, 0xaa, 0x2d, 0xc4, 0xc0, 0x0a, 0x6e,
+    0x4c, 0xa3, 0x62, 0x45, 0x7c, 0x40, 0x92, 0xc6, 0x80, 0x82, 0xee, 0x76, 0x79, 0x1d, 0x92, 0x0c,
+    0x8e, 0xc2, 0x40, 0xea, 0xe0, 0x9a, 0xdc, 0x6a, 0x11, 0x4a, 0xac, 0xf1, 0xb3, 0x5d, 0x87, 0xa2,
+    0xcd, 0x8b, 0xa0, 0x6b, 0xab, 0x48, 0xe1, 0x6e, 0xb8, 0x7a, 0x29, 0x79, 0x28, 0x41, 0x7e, 0x51,
+    0xca, 0x91, 0xb2, 0x99, 0x4f, 0x05, 0x70, 0x44, 0xe1, 0x8a, 0xce, 0x2a, 0x5c, 0xa4, 0x15, 0x85,
+    0x2e, 0xb4, 0x46, 0xea, 0x59, 0xaa, 0x91, 0x2a, 0x2a, 0x88, 0x05, 0x1f, 0x2c, 0x7e, 0x1f, 0x35,
+    0x1e, 0xc7, 0xa8, 0xda, 0x46, 0x74, 0x1b, 0x6b, 0x64, 0x04, 0xd1, 0xb2, 0xcc, 0xa4, 0x0f, 0x68,
+    0x52, 0x1e, 0x69, 0x0e, 0x56, 0xdf, 0x5a, 0x51, 0xae, 0x17, 0x99, 0x00, 0x2c, 0xe1, 0x1e, 0x93,
+    0x5f, 0x2b, 0x7c, 0xaf, 0x92, 0x2e, 0x50, 0x84, 0x89, 0x90, 0x6f, 0xaa, 0xf7, 0x82, 0xaa, 0xc8,
+    0x86, 0x4c, 0x9b, 0x10, 0x9f, 0x52, 0xe6, 0x60, 0xca, 0x93, 0x84, 0xd4, 0xf4, 0x18, 0x53, 0xb9,
+    0xba, 0xcc, 0x68, 0xaf, 0x39, 0x94, 0xfe, 0xc6, 0x8f, 0x0c, 0xd5, 0xc6, 0x1e, 0x9b, 0x56, 0x86,
+    0x0f, 0xe2, 0x3f, 0x3a, 0x24, 0x01, 0xaa, 0x5c, 0xcc, 0xf0, 0x02, 0xeb, 0x9c, 0xb8, 0x25, 0xff,
+    0x7b, 0x5d, 0x31, 0xd8, 0x59, 0x8c, 0xa1, 0x40, 0x7a, 0x4d, 0x44, 0xb6, 0x34, 0x51, 0xa9, 0xfb,
+    0x76, 0xe9, 0xa6, 0x08, 0x2a, 0x6e, 0x42, 0x13, 0xfd, 0xb1, 0x3a, 0xcd, 0x17, 0xeb, 0x60, 0x4b,
+    0x15, 0x4e, 0xcc, 0x79, 0x2e, 0xd6, 0x0e, 0x01, 0x1b, 0x33, 0x98, 0xb0, 0xd7, 0x61, 0xa5, 0x76,
+    0x08, 0x61, 0x3b, 0x28, 0x77, 0xf0, 0xd4, 0x12, 0xd2, 0xca, 0xf6, 0x32, 0xd7, 0xd6, 0x8b, 0x32,
+    0x50, 0x22, 0x5a, 0x32, 0x2e, 0x77, 0x3a, 0xef, 0x2e, 0xa5, 0xa1, 0x48, 0xbb, 0x64, 0xc3, 0x2d,
+    0x23, 0x81, 0x8a, 0x19, 0x5c, 0x8f, 0x19, 0x56, 0x4a, 0xc4, 0xad, 0x73, 0xb0, 0xa6, 0x8b, 0x0f,
+    0x82, 0x02, 0xcd, 0xdf, 0x4e, 0x63, 0x99, 0xeb, 0x06, 0x31, 0x6c, 0x06, 0x59, 0x7c, 0xb6, 0xd8,
+    0x60, 0x56, 0x7d, 0x1f, 0x3c, 0x97, 0xad, 0x92, 0xce, 0x45, 0x98, 0x6c, 0xc5, 0xc1, 0x39, 0x30,
+    0xa8, 0xdd, 0x7d, 0xa8, 0x79, 0x82, 0x2d, 0x4a, 0x1d, 0x11, 0xbc, 0xa1, 0x0a, 0x7c, 0x0b, 0xaf,
+    0x94, 0x65, 0xef, 0x63, 0x4c, 0x42, 0x84, 0xbd, 0x76, 0xfd, 0x4f, 0xbd, 0xc0, 0x1c, 0x98, 0xa3,
+    0x88, 0x7b, 0x14, 0x2b, 0x28, 0xb8, 0x75, 0xcf, 0x02, 0x34, 0x6a, 0x3b, 0x47, 0x7b, 0x39, 0x79,
+    0x60, 0x8b, 0x02, 0x66, 0x89, 0x43, 0x28, 0x6f, 0xef, 0x09, 0x2c, 0xc8, 0xa4, 0xb4, 0x3d, 0x60,
+    0x80, 0x4b, 0xb9, 0x55, 0x4a, 0x85, 0xfc, 0xca, 0x7b, 0x2a, 0x19, 0x4a, 0x83, 0x56, 0x8e, 0xc2,
+    0x92, 0x89, 0x17, 0x54, 0x4b, 0x95, 0x54, 0xb6, 0x02, 0xd8, 0x06, 0x06, 0x40, 0xee, 0xa1, 0x3a,
+    0x50, 0xb7, 0xd2, 0x84, 0xb9, 0x28, 0x46, 0xf5, 0x56, 0x51, 0xe9, 0x72, 0x20, 0xfb, 0x49, 0xc5,
+    0xb0, 0xc4, 0xea, 0x9b, 0xfd, 0x28, 0x82, 0x75, 0x57, 0x89, 0x2f, 0x19, 0xe5, 0x3c, 0xcb, 0x3e,
+    0xa2, 0xe4, 0x3f, 0xcb, 0x34, 0xd6, 0x76, 0xb5, 0x3f, 0x41, 0x96, 0x53, 0x58, 0xcb, 0x79, 0x04,
+    0xb1, 0x28, 0x87, 0x43, 0x6d, 0xcc, 0x5f, 0x48, 0x05, 0x65, 0x6b, 0x0d, 0x3f, 0x1c, 0x25, 0x34,
+    0xe9, 0x24, 0x42, 0xbf, 0x33, 0xde, 0x3a, 0xaf, 0xb0, 0x9d, 0xa0, 0x3c, 0x8c, 0x8e, 0x4a, 0x79,
+    0x6a, 0x5a, 0xe5, 0x44, 0x50, 0x48, 0x00, 0xe1, 0x33, 0xf5, 0xd3, 0x0e, 0x64, 0x9c, 0xcd, 0x5a,
+    0x02, 0xba, 0x9d, 0x51, 0x40, 0xa6, 0x4a, 0x5b, 0x57, 0xc9, 0x23, 0x85, 0xd3, 0xd0, 0xd5, 0xd8,
+    0x2b, 0x6e, 0x4d, 0xd4, 0xe9, 0x74, 0xf7, 0xd0, 0x5b, 0xa7, 0x14, 0xeb, 0xe4, 0x68, 0xef, 0xfb,
+    0x3f, 0x49, 0x08, 0xe1, 0xc7, 0xfc, 0x71, 0xf4, 0x57, 0xd8, 0x85, 0x22, 0x1c, 0x90, 0xf3, 0x85,
+    0x54, 0xac, 0x57, 0x36, 0x55, 0x3b, 0x2a, 0xb6, 0x63, 0x7a, 0xb4, 0x03, 0x05, 0xb1, 0x49, 0x23,
+    0x3c, 0xd1, 0x64, 0x1d, 0x13, 0xae, 0x88, 0x96, 0x8c, 0x70, 0x99, 0x62, 0x35, 0xf0, 0xc2, 0xdc,
+    0xd4, 0xc4, 0x45, 0x65, 0x42, 0x15, 0x53, 0x65, 0xda, 0xf9, 0xec, 0x2e, 0x9b, 0x17, 0x16, 0xc9,
+    0xce, 0x7e, 0xd9, 0x07, 0x61, 0x93, 0x7e, 0x1a, 0xa4, 0x1a, 0xdc, 0x64, 0xca, 0xcf, 0xe0, 0x8c,
+    0x56, 0xbd, 0x02, 0xaa, 0x34, 0x20, 0xee, 0x4c, 0x8e, 0x2d, 0x36, 0xb3, 0xd2, 0xe4, 0x2d, 0xaf,
+    0x82, 0xbe, 0x51, 0x20, 0x92, 0x18, 0x88, 0xa0, 0xc8, 0x08, 0x8e, 0x9c, 0xd8, 0x2f, 0x58, 0x3a,
+    0x32, 0x41, 0xdb, 0x55, 0x3a, 0xaa, 0x7d, 0xb1, 0x5d, 0x84, 0x13, 0x6b, 0xc8, 0xcb, 0xc0, 0xfa,
+    0xe9, 0xcc, 0x08, 0x2d, 0xe4, 0xc2, 0x02, 0xce, 0xeb, 0x6d, 0x7c, 0x3d, 0x31, 0xb7, 0xb2, 0x85,
+    0x1a, 0x5c, 0xde, 0x71, 0x30, 0x57, 0xb4, 0x17, 0x88, 0x55, 0xdb, 0x69, 0x3b, 0xfb, 0x9d, 0x68,
+    0x96, 0x53, 0x36, 0xbe, 0x69, 0xbd, 0x59, 0xb6, 0x58, 0x36, 0xcb, 0x97, 0x10, 0xa1, 0x8c, 0xb7,
+    0xb3, 0x88, 0x17, 0x97, 0x38, 0x94, 0xa3, 0xe3, 0x8b, 0x7e, 0x4b, 0xbc, 0xa1, 0x24, 0xf5, 0x75,
+    0x57, 0xc1, 0x9a, 0x9f, 0xc2, 0xa1, 0x6e, 0x5d, 0x20, 0x8e, 0x33, 0xae, 0x7a, 0xe0, 0x00, 0x32,
+    0x6c, 0x56, 0x10, 0x1d, 0x5e, 0xca, 0xf8, 0x9b, 0x00, 0xec, 0xc2, 0x4c, 0x4a, 0x77, 0xd4, 0x7e,
+    0x42, 0x27, 0xfa, 0x49, 0x9b, 0xf5, 0xac, 0xdb, 0xe6, 0x3e, 0xbd, 0x2a, 0x6a, 0x57, 0x8d, 0x77,
+    0x31, 0xd8, 0x7b, 0x38, 0x7f, 0xa7, 0x14, 0xaa, 0xc8, 0x23, 0x9f, 0x12, 0xed, 0xc6, 0x23, 0xb2,
+    0x2c, 0xa6, 0xa4, 0x8b, 0xee, 0x23, 0xd3, 0xd3, 0x53, 0x1f, 0x53, 0x2b, 0x11, 0x1c, 0x1e, 0x38,
+    0xd5, 0x64, 0x52, 0x96, 0xe3, 0x99, 0xc6, 0x7a, 0x8c, 0xc2, 0x57, 0xaf, 0xee, 0x0d, 0x0b, 0x35,
+    0xa7, 0x50, 0x18, 0xdf, 0x91, 0x19, 0x8b, 0x1e, 0x4f, 0x65, 0x5a, 0x6d, 0x78, 0x4f, 0xb5, 0x40,
+    0xbe, 0x15, 0xf1, 0x2f, 0xe8, 0x9c, 0xed, 0xec, 0x21, 0x2f, 0xef, 0x6f, 0xd1, 0xfc, 0xc5, 0x63,
+    0xf6, 0x1f, 0x3a, 0xc6, 0x92, 0x76, 0x98, 0x8a, 0x59, 0x5f, 0xef, 0x75, 0xe6, 0xb1, 0x70, 0xf2,
+    0x9d, 0x57, 0x1d, 0x16, 0x0a, 0xf0, 0x66, 0x23, 0xa7, 0x36, 0xa4, 0x6f, 0x82, 0x54, 0x44, 0x56,
+    0x0d, 0xa7, 0x3b, 0x4e, 0xc4, 0xc8, 0xd6, 0xa2, 0x96, 0xad, 0xe5, 0x2d, 0x34, 0xf2, 0x1b, 0x2d,
+    0x81, 0xeb, 0x78, 0x20, 0xf9, 0x54, 0x51, 0x80, 0x71, 0x49, 0xa5, 0xdf, 0xd4, 0xb8, 0xed, 0x3a,
+    0x40, 0x4a, 0x5b, 0x81, 0xb3, 0x77, 0xa9, 0x11, 0xa7, 0x54, 0x3d, 0x76, 0x9e, 0x6e, 0x38, 0x58,
+    0x5d, 0x94, 0xc0, 0xa6, 0xea, 0xcf, 0x26, 0xff, 0x03,
+};
+const uint32_t benchmark_payload_deflate_size = sizeof(benchmark_payload_deflate);
+
+const uint8_t benchmark_payload_lzma[] = {
+    0x00, 0x33, 0x98, 0x49, 0xfd, 0xf9, 0xe2, 0x8b, 0x8e, 0x85, 0x19, 0xe5, 0x27, 0xae, 0xc8, 0x07,
+    0x82, 0x54, 0x55, 0xb7, 0x89, 0xf3, 0xfa, 0xd3, 0xd1, 0xe7, 0x49, 0x4c, 0x1a, 0xbc, 0xd6, 0xa6,
+    0x99, 0xa7, 0x47, 0x5d, 0x82, 0xfe, 0xf8, 0x90, 0xba, 0x1b, 0xac, 0x45, 0x77, 0x9b, 0xc1, 0xa2,
+    0xa7, 0x2f, 0x08, 0x2c, 0xaf, 0x98, 0x7a, 0x24, 0x2a, 0x3e, 0x4d, 0x46, 0xb3, 0xd5, 0x33, 0x93,
+    0x1b, 0x7d, 0x6c, 0x5a, 0x7e, 0x4d, 0xe2, 0x2a, 0x1a, 0xa5, 0xb5, 0xea, 0x53, 0xbb, 0xe5, 0xb0,
+    0x71, 0x5b, 0x60, 0xe0, 0x70, 0x71, 0x5e, 0x91, 0x9f, 0xcf, 0x5b, 0xa6, 0xf8, 0x31, 0x2b, 0x01,
+    0xa7, 0xfe, 0x63, 0xb1, 0x0c, 0x69, 0x16, 0x11, 0xaf, 0xbc, 0x2e, 0x65, 0x9b, 0x80, 0x6f, 0x64,
+    0x17, 0x2b, 0x58, 0x1d, 0x70, 0x85, 0xee, 0xa4, 0xbc, 0xfe, 0x23, 0xfc, 0xfd, 0x03, 0x3c, 0x72,
+    0xe5, 0x55, 0x88, 0xc4, 0x1e, 0x97, 0xd0, 0xd8, 0xb9, 0x25, 0x1c, 0x01, 0x5e, 0x46, 0xf7, 0xc0,
+    0x6c, 0x3f, 0x9f, 0xc3, 0x7c, 0x15, 0x7f, 0xa1, 0xe0, 0x86, 0x55, 0xb5, 0xd3, 0x4c, 0x19, 0x71,
+    0xc0, 0x18, 0xb0, 0xab, 0xea, 0x44, 0x02, 0xb2, 0x34, 0xdc, 0x96, 0x09, 0xfe, 0xf0, 0x68, 0x67,
+    0x4c, 0xaa, 0x6c, 0xa3, 0x0e, 0xed, 0xd4, 0xe0, 0xc6, 0xb5, 0x66, 0x51, 0x55, 0x86, 0xa6, 0x31,
+    0x49, 0x3d, 0x05, 0xa4, 0x88, 0x28, 0x7f, 0x26, 0x17, 0x2c, 0x3f, 0xb0, 0xfa, 0xdd, 0x9c, 0xac,
+    0xf5, 0xc3, 0xc0, 0x41, 0x7a, 0xca, 0xc6, 0x12, 0xc8, 0x74, 0xfa, 0xc5, 0xb8, 0x16, 0xa8, 0xc1,
+    0x88, 0xf2, 0xa4, 0x41, 0xec, 0x45, 0x48, 0x46, 0x37, 0xac, 0x47, 0x30, 0xd5, 0xca, 0xdb, 0x3a,
+    0xe9, 0xd6, 0xe0, 0xd2, 0xe3, 0x87, 0x92, 0xd7, 0x5e, 0x3d, 0x1d, 0x45, 0x55, 0xbf, 0x55, 0x2e,
+    0x8a, 0x84, 0xdb, 0x64, 0xd8, 0x9a, 0x7f, 0x80, 0xbc, 0x15, 0xf2, 0x4c, 0xab, 0xa8, 0x6c, 0x6c,
+    0xc0, 0xfc, 0x94, 0xd9, 0xb7, 0x9d, 0x18, 0x46, 0x5d, 0xed, 0xcc, 0x19, 0xbf, 0x04, 0x54, 0xf4,
+    0xaa, 0xe2, 0xd6, 0xd1, 0xde, 0x00, 0x34, 0x4a, 0x5f, 0x97, 0xde, 0x0b, 0x3e, 0x96, 0x32, 0x06,
+    0x13, 0x74, 0x33, 0x95, 0x65, 0xa1, 0x2f, 0xa0, 0x2c, 0xae, 0x8c, 0x1d, 0xfe, 0x47, 0x40, 0x2c,
+    0x7b, 0x6d, 0x59, 0xee, 0xa9, 0xa9, 0xdc, 0x6d, 0xf8, 0x61, 0x02, 0x51, 0xf4, 0xa3, 0x1a, 0xd8,
+    0x88, 0x8a, 0xa3, 0xa5, 0xe6, 0xf7, 0x0e, 0x9a, 0xa6, 0x5d, 0x64, 0x00, 0xe2, 0x5b, 0x0a, 0xbe,
+    0x42, 0x28, 0xfb, 0xee, 0x5e, 0x5c, 0x17, 0xcb, 0x7a, 0x64, 0x2d, 0xc0, 0x89, 0x5a, 0xda, 0xd7,
+    0x84, 0xa7, 0x05, 0x16, 0x66, 0xea, 0x83, 0xf7, 0x3a, 0x59, 0x15, 0xf7, 0x60, 0x51, 0x64, 0x35,
+    0xcc, 0x9c, 0xed, 0xcd, 0x4a, 0xb0, 0xb4, 0x0b, 0x4c, 0x63, 0x96, 0x88, 0x98, 0x00, 0x1c, 0x7e,
+    0x46, 0xe3, 0xf9, 0xaa, 0x76, 0xdf, 0x10, 0x76, 0x97, 0x7d, 0xcd, 0x82, 0x68, 0x47, 0x93, 0x1d,
+    0x1b, 0xe2, 0xef, 0x01, 0x17, 0x4e, 0x8b, 0x37, 0xbd, 0x5e, 0x1b, 0xbd, 0x32, 0xa7, 0xec, 0x38,
+    0x6e, 0x52, 0x3a, 0xd7, 0x22, 0x8b, 0xfc, 0xae, 0x1d, 0x4e, 0x6a, 0xbc, 0x79, 0x0d, 0xbf, 0x8f,
+    0x8f, 0x53, 0x03, 0x29, 0xf3, 0x54, 0x09, 0x15, 0x93, 0xbe, 0xe7, 0x46, 0x91, 0x7d, 0x6b, 0x1b,
+    0x26, 0xc3, 0xed, 0x7a, 0xe3, 0x66, 0xe4, 0x24, 0x2a, 0xd1, 0x6e, 0xb2, 0x3f, 0x9e, 0xef, 0x4b,
+    0x58, 0x7d, 0xbf, 0x18, 0x46, 0x19, 0xe4, 0x91, 0x4c, 0x4a, 0x66, 0x82, 0x8b, 0xe7, 0xa2, 0x49,
+    0x13, 0xfb, 0xeb, 0x84, 0x98, 0x64, 0x5f, 0x5b, 0x66, 0xf2, 0x3c, 0xd3, 0x15, 0x00, 0x47, 0x29,
+    0xf6, 0x9b, 0xd0, 0x3f, 0xfc, 0x62, 0x7e, 0x25, 0x63, 0x65, 0xe1, 0x58, 0x0e, 0xec, 0xde, 0xd5,
+    0x51, 0x65, 0xd9, 0x4e, 0xdd, 0xcd, 0xe5, 0x7b, 0x68, 0x87, 0xd4, 0x2d, 0x33, 0xb9, 0x21, 0xc5,
+    0xf9, 0x4b, 0x84, 0x53, 0x03, 0x04, 0xaa, 0x16, 0xd5, 0x30, 0xd6, 0x71, 0xe9, 0x6a, 0x5f, 0xf5,
+    0x8c, 0x28, 0x4d, 0x7e, 0x11, 0x9c, 0x9f, 0x83, 0xbe, 0xf5, 0xef, 0x12, 0x0f, 0x43, 0x09, 0x6a,
+    0x1b, 0xb8, 0x95, 0xfe, 0x1a, 0x39, 0xb8, 0x2a, 0xfd, 0x9e, 0xc5, 0x42, 0xe9, 0x0e, 0xb1, 0x09,
+    0x75, 0x17, 0xd8, 0x02, 0x7c, 0xf4, 0x9a, 0x55, 0x2b, 0xc3, 0x00, 0xd9, 0xb4, 0x96, 0x30, 0xf7,
+    0xfd, 0x34, 0x08, 0x1f, 0x48, 0xc9, 0x73, 0x43, 0x9f, 0x66, 0xb6, 0xca, 0xf9, 0x64, 0x5b, 0xc9,
+    0xed, 0x42, 0xa1, 0xd6, 0x07, 0xee, 0x58, 0xed, 0x51, 0xff, 0xbd, 0xf9, 0xb4, 0xb4, 0x9b, 0x44,
+    0x15, 0x31, 0x1a, 0x8d, 0xa1, 0x8c, 0x18, 0xdf, 0x40, 0x89, 0x79, 0x96, 0xdd, 0x4d, 0xcf, 0xff,
+    0x05, 0x18, 0xc2, 0x5c, 0x30, 0x68, 0x30, 0xc9, 0x60, 0xb9, 0x63, 0xf6, 0xd7, 0x5e, 0x57, 0x68,
+    0x3a, 0x05, 0xb7, 0x0e, 0x3e, 0x1c, 0x33, 0xa9, 0x5c, 0x5e, 0x09, 0x8c, 0x78, 0x67, 0x46, 0xc3,
+    0x95, 0xc3, 0x08, 0x8e, 0xe1, 0x94, 0x51, 0xd5, 0x9e, 0x13, 0x14, 0x37, 0xaf, 0x5e, 0x1f, 0x94,
+    0x62, 0x2f, 0xaf, 0x2a, 0xb3, 0x26, 0xbd, 0x63, 0x1d, 0x61, 0xfe, 0x65, 0x5c, 0x77, 0x11, 0xb7,
+    0x1e, 0x29, 0xcf, 0x70, 0x1e, 0xeb, 0xb4, 0x39, 0xde, 0x1b, 0xd0, 0xd3, 0xbf, 0x55, 0x15, 0x8a,
+    0xb3, 0x55, 0x39, 0x89, 0x52, 0xa8, 0x97, 0xb7, 0xed, 0x85, 0x9b, 0x1d, 0x60, 0x69, 0x38, 0xf0,
+    0x63, 0x10, 0x3d, 0x8b, 0x19, 0xba, 0xb1, 0x4e, 0xe9, 0x74, 0x44, 0x81, 0x29, 0x5b, 0x13, 0xa7,
+    0x66, 0xa7, 0x6f, 0xb1, 0x09, 0x31, 0x4b, 0xb9, 0xed, 0x77, 0x21, 0x83, 0x8d, 0xa1, 0x0c, 0x09,
+    0x70, 0xb7, 0x14, 0xb4, 0xa6, 0xe3, 0xba, 0x10, 0xb8, 0xeb, 0x4f, 0x2e, 0x2c, 0x5b, 0xb1, 0xf4,
+    0xca, 0xab, 0xe6, 0xaf, 0xb0, 0x8f, 0x3a, 0xe1, 0xbd, 0x1e, 0x96, 0x43, 0x4e, 0xf5, 0x49, 0x94,
+    0x43, 0x67, 0x05, 0xe9, 0x7f, 0x11, 0xb4, 0x05, 0x3d, 0x9b, 0x15, 0x10, 0x23, 0x5b, 0x49, 0x21,
+    0x1f, 0x81, 0xe9, 0x98, 0xe6, 0x3f, 0xe6, 0x83, 0x99, 0x7a, 0x25, 0x31, 0xb3, 0x77, 0xa7, 0x25,
+    0x75, 0x68, 0x7e, 0xfe, 0x8b, 0xac, 0x24, 0xc0, 0xad, 0x5b, 0xa6, 0xc0, 0x79, 0x8a, 0xb5, 0xfe,
+    0x24, 0xfe, 0xbb, 0x5d, 0x55, 0xf8, 0x0b, 0x92, 0xa7, 0x12, 0xe0, 0xe5, 0xd0, 0x28, 0x3c, 0xbb,
+    0x2f, 0x14, 0xf4, 0x8b, 0xd4, 0xb7, 0xa5, 0xa7, 0x7a, 0xf8, 0x50, 0x6d, 0x42, 0x6a, 0x36, 0x1d,
+    0x8e, 0xe7, 0x5f, 0xe2, 0x38, 0xd4, 0x18, 0x22, 0xe2, 0xda, 0x8a, 0x27, 0xd3, 0x67, 0x61, 0x60,
+    0x0a, 0xf9, 0x75, 0x99, 0x30, 0xca, 0xdd, 0x1c, 0xc2, 0x36, 0x77, 0x31, 0x0c, 0xee, 0x17, 0x3d,
+    0x7d, 0x54, 0x7e, 0xd7, 0x4f, 0xc6, 0xf0, 0xff, 0xb3, 0xda, 0x7a, 0x39, 0x6c, 0xf4, 0x1e, 0x3a,
+    0x68, 0x1b, 0x37, 0xad, 0xeb, 0x09, 0xf2, 0xea, 0x27, 0x7c, 0x99, 0xc2, 0x93, 0x63, 0x0a, 0xd0,
+    0x62, 0x3c, 0xb1, 0xca, 0x0c, 0x78, 0x76, 0xc9, 0x27, 0xe1, 0x8f, 0xa7, 0x2a, 0x74, 0x74, 0x1e,
+    0x47, 0x1b, 0x77, 0x3c, 0x14, 0xbd, 0x74, 0x44, 0x45, 0x88, 0xdc, 0x1a, 0xfe, 0x48, 0x84, 0x72,
+    0x73, 0x79, 0xc4, 0x75, 0xff, 0xf9, 0x41, 0x4c, 0xe0, 0x6f, 0xfa, 0xe5, 0x47, 0xde, 0xfd, 0x4f,
+    0x8b, 0x5e, 0xfb, 0x92, 0x23, 0xd2, 0xfb, 0xb4, 0x36, 0xdc, 0xe8, 0x58, 0xbd, 0x1e, 0x52, 0x67,
+    0x42, 0x3d, 0x62, 0x6b, 0x46, 0x14, 0x5a, 0x40, 0x0f, 0xd9, 0x54, 0x91, 0xf5, 0x71, 0x74, 0xd3,
+    0xe5, 0x8f, 0x62, 0x88, 0x8b, 0x62, 0x02, 0x84, 0xf6, 0xb3, 0x7b, 0x23, 0x69, 0xd7, 0xf4, 0x51,
+    0x58, 0x0c, 0x5c, 0x1f, 0xe8, 0x47, 0xa2, 0xd5, 0x1f, 0x56, 0x72, 0x64, 0x32, 0xb5, 0xa6, 0xb9,
+    0xb2, 0x3d, 0x70, 0xe5, 0x37, 0x1b, 0xc1, 0x50, 0x3a, 0xb1, 0x05, 0x98, 0x50, 0x4b, 0xd7, 0x64,
+    0x6c, 0xab, 0xa4, 0x14, 0x81, 0xe4, 0xf7, 0x7d, 0xea, 0xc8, 0x9b, 0x53, 0x79, 0x2c, 0xdd, 0x4e,
+    0x51, 0x76, 0xec, 0xfa, 0x3c, 0x0d, 0x71, 0xc1, 0x78, 0x65, 0xfd, 0x19, 0x46, 0xe0, 0x28, 0x77,
+    0xa7, 0x0f, 0xb6, 0xf2, 0x72, 0xf3, 0x16, 0x21, 0x58, 0xb8, 0x15, 0x6c, 0xfe, 0xb2, 0xe3, 0x8c,
+    0x7f, 0x99, 0x00, 0x2a, 0x48, 0x5a, 0x0d, 0x76, 0x0d, 0x2e, 0x08, 0x44, 0xea, 0xe7, 0x23, 0x13,
+    0xd6, 0x46, 0xb6, 0xed, 0x75, 0xbf, 0xae, 0x20, 0xd4, 0xfa, 0xd8, 0x1b, 0x4b, 0x3e, 0xc0, 0x8f,
+    0x0f, 0xe9, 0x19, 0xe2, 0xa5, 0x9d, 0x91, 0x38, 0x6c, 0x3d, 0xf9, 0x49, 0xab, 0x86, 0xa7, 0xa7,
+    0x77, 0x64, 0x0e, 0x29, 0x90, 0xa4, 0x14, 0xfb, 0x2b, 0x04, 0xbe, 0x86, 0xaa, 0x12, 0xab, 0xab,
+    0x6d, 0x15, 0xd0, 0x3a, 0xed, 0xfd, 0xa2, 0xb8, 0xc8, 0x6c, 0xdf, 0xe0, 0xe8, 0x9c, 0x71, 0xd6,
+    0x2f, 0xe6, 0x56, 0x30, 0x10, 0x69, 0xea, 0xdf, 0x67, 0xf1, 0x42, 0xb3, 0x36, 0x8a, 0xd6, 0x9f,
+    0x30, 0x2f, 0x9c, 0xe9, 0xee, 0x0c, 0xdf, 0x6d, 0xc0, 0xcc, 0x60, 0x64, 0x77, 0xeb, 0xae, 0xb5,
+    0x79, 0x37, 0xae, 0xe5, 0x7b, 0x9b, 0xb3, 0xcb, 0x56, 0x2e, 0x1e, 0x8a, 0xd0, 0xdd, 0xa9, 0xa6,
+    0x23, 0xb7, 0xaa, 0x69, 0x1e, 0x15, 0xc0, 0x0c, 0xc2, 0x2c, 0x1b, 0x3d, 0xda, 0x15, 0xc0, 0x69,
+    0x72, 0xae, 0xf9, 0x38, 0x67, 0x96, 0x04, 0x9d, 0xc1, 0x6d, 0x72, 0x90, 0x82, 0x1c, 0x2c, 0x5c,
+    0x29, 0x6e, 0x27, 0xc8, 0x0d, 0x2c, 0xdc, 0x7a, 0xec, 0x71, 0x40, 0x2b, 0xd6, 0x39, 0x20, 0xa1,
+    0x68, 0xac, 0x36, 0xe9, 0xb5, 0x30, 0x0b, 0x9a, 0x42, 0x8f, 0xb5, 0x6f, 0x78, 0x74, 0xe9, 0x4f,
+    0x76, 0x54, 0xb0, 0x81, 0xda, 0x37, 0x36, 0x1e, 0xc5, 0x98, 0x99, 0x23, 0x99, 0x73, 0x77, 0x24,
+    0xf0, 0x0f, 0x88, 0x1d, 0x86, 0x86, 0x95, 0x7c, 0xb6, 0x9d, 0xc2, 0x39, 0x74, 0x65, 0x11, 0x8a,
+    0xcd, 0x32, 0x7f, 0x67, 0x0b, 0x0e, 0x1d, 0xe4, 0xed, 0x3c, 0xd4, 0x35, 0xf5, 0x03, 0x49, 0x0f,
+    0xa5, 0x8e, 0x8d, 0x7a, 0x98, 0x20, 0x24, 0x34, 0x02, 0x43, 0xdc, 0xff, 0xaf, 0x8e, 0x45, 0x53,
+    0x0b, 0xbb, 0xf3, 0xdc, 0x3c, 0x72, 0x27, 0xd5, 0x11, 0x9d, 0x2d, 0xd9, 0x38, 0x44, 0x45, 0xaf,
+    0xd2, 0x4d, 0x9b, 0xae, 0x0c, 0x04, 0xb6, 0xcf, 0x28, 0x0f, 0x07, 0x07, 0x72, 0x82, 0xec, 0x0c,
+    0xec, 0x56, 0xe8, 0x51, 0xdc, 0x9f, 0xba, 0x83, 0xbe, 0x28, 0x9d, 0xd7, 0x3f, 0xcd, 0xa1, 0x37,
+    0x2a, 0x9d, 0x4f, 0x06, 0x37, 0x40, 0xac, 0xde, 0x7c, 0xfd, 0xac, 0xbb, 0x31, 0x1b, 0x14, 0x0f,
+    0x8c, 0xcc, 0x84, 0x8e, 0x31, 0xe5, 0x93, 0xcb, 0x57, 0x9a, 0x7c, 0xe2, 0xf5, 0xcb, 0x0b, 0x7e,
+    0xa4, 0x8f, 0x02, 0x37, 0x81, 0xf4, 0xe3, 0x76, 0xa8, 0xac, 0x87, 0xcc, 0x83, 0xad, 0x14, 0xfb,
+    0x83, 0xfa, 0xd0, 0x00, 0x0e, 0x6c, 0xdd, 0x7e, 0xfc, 0x69, 0x1a, 0x14,
+};
+const uint32_t benchmark_payload_lzma_size = sizeof(benchmark_payload_lzma);
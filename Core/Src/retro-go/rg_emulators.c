@@ -5,7 +5,8 @@
 
 #include "gw_linker.h"
 #include "rg_emulators.h"
-// #include "rg_favorites.h"
+#include "rg_favorites.h"
+#include "rg_recent.h"
 #include "bitmaps.h"
 #include "gui.h"
 #include "rom_manager.h"
@@ -16,6 +17,11 @@
 #include "main_smsplusgx.h"
 #include "main_pce.h"
 #include "main_gw.h"
+#include "save_log.h"
+#include "state_slots.h"
+#include "boot_trace.h"
+#include "emu_arena.h"
+#include "xip_copy.h"
 
 // Increase when adding new emulators
 #define MAX_EMULATORS 8
@@ -42,15 +48,11 @@ static void event_handler(gui_event_t event, tab_t *tab)
         if (emu->roms.count > 0)
         {
             sprintf(tab->status, " Games: %d", emu->roms.count);
-            gui_resize_list(tab, emu->roms.count);
 
-            for (int i = 0; i < emu->roms.count; i++)
-            {
-                tab->listbox.items[i].text = emu->roms.files[i].name;
-                tab->listbox.items[i].arg = (void *)&emu->roms.files[i];
-            }
-
-            gui_sort_list(tab, 0);
+            // Sorted when building, the list is only read from now on
+            tab->listbox.items = (listbox_item_t *)emu->system->list;
+            tab->listbox.length = emu->roms.count;
+            tab->listbox.letters = emu->system->letters;
             tab->is_empty = false;
         }
         else
@@ -233,63 +235,8 @@ const uint32_t *emu_get_file_address(retro_emulator_file_t *file)
 
 void emulator_crc32_file(retro_emulator_file_t *file)
 {
-    // if (file == NULL || file->checksum > 0)
-    //     return;
-
-    // const int chunk_size = 32768;
-    // const char *file_path = emu_get_file_path(file);
-    // char *cache_path = odroid_system_get_path(ODROID_PATH_CRC_CACHE, file_path);
-    // FILE *fp, *fp2;
-
-    // file->missing_cover = 0;
-
-    // if ((fp = fopen(cache_path, "rb")) != NULL)
-    // {
-    //     fread(&file->checksum, 4, 1, fp);
-    //     fclose(fp);
-    // }
-    // else if ((fp = fopen(file_path, "rb")) != NULL)
-    // {
-    //     void *buffer = malloc(chunk_size);
-    //     uint32_t crc_tmp = 0;
-    //     uint32_t count = 0;
-
-    //     gui_draw_notice("        CRC32", C_GREEN);
-
-    //     fseek(fp, file->crc_offset, SEEK_SET);
-    //     while (true)
-    //     {
-    //         odroid_input_read_gamepad(&gui.joystick);
-    //         if (gui.joystick.bitmask > 0) break;
-
-    //         count = fread(buffer, 1, chunk_size, fp);
-    //         if (count == 0) break;
-
-    //         crc_tmp = crc32_le(crc_tmp, buffer, count);
-    //         if (count < chunk_size) break;
-    //     }
-
-    //     free(buffer);
-
-    //     if (feof(fp))
-    //     {
-    //         file->checksum = crc_tmp;
-    //         if ((fp2 = fopen(cache_path, "wb")) != NULL)
-    //         {
-    //             fwrite(&file->checksum, 4, 1, fp2);
-    //             fclose(fp2);
-    //         }
-    //     }
-    //     fclose(fp);
-    // }
-    // else
-    // {
-    //     file->checksum = 1;
-    // }
-
-    // free(cache_path);
-
-    // gui_draw_notice(" ", C_RED);
+    // The files are in flash with the checksum from parse_roms.py, a ROM
+    // without one gets it when it's loaded, see rom_loader_crc32_active()
 }
 
 void emulator_show_file_info(retro_emulator_file_t *file)
@@ -334,15 +281,29 @@ void emulator_show_file_menu(retro_emulator_file_t *file)
     // char *sram_path = odroid_system_get_path(ODROID_PATH_SAVE_SRAM, emu_get_file_path(file));
     // bool has_save = odroid_sdcard_get_filesize(save_path) > 0;
     // bool has_sram = odroid_sdcard_get_filesize(sram_path) > 0;
-    // bool is_fav = favorite_find(file) != NULL;
+    bool is_fav = favorite_find(file);
 
     bool has_save = 1;
     bool has_sram = 0;
-    bool is_fav = 0;
+
+#if STATE_SAVING == 1
+#if STATE_SLOTS > 1
+    static char slot_value[16];
+#endif
+    int latest = (file->save_size > 0) ? state_slot_latest(file) : -1;
+
+    // Start out on the slot that was saved last
+    has_save = latest >= 0;
+    state_slot_set(has_save ? latest : 0);
+    state_slot_menu_init(file);
+#endif
 
     odroid_dialog_choice_t choices[] = {
 #if STATE_SAVING == 1
         {0, "Resume game ", "", has_save, NULL},
+#if STATE_SLOTS > 1
+        {4, "Slot        ", slot_value, 1, &state_slot_update_cb},
+#endif
 #endif
         {1, "New game    ", "", 1, NULL},
         {0, "------------", "", -1, NULL},
@@ -353,6 +314,9 @@ void emulator_show_file_menu(retro_emulator_file_t *file)
         ODROID_DIALOG_CHOICE_LAST
     };
     int sel = odroid_overlay_dialog(NULL, choices, has_save ? 0 : 1);
+#if STATE_SAVING == 1
+    state_slot_menu_done();
+#endif
 
     if (sel == 0 || sel == 1) {
         gui_save_current_tab();
@@ -360,44 +324,66 @@ void emulator_show_file_menu(retro_emulator_file_t *file)
     }
     else if (sel == 2) {
         if (odroid_overlay_confirm("Delete save file?", false) == 1) {
-            store_erase(file->save_address, file->save_size);
+            const uint8_t *slot = state_slot_address(file, state_slot_get());
+
+            save_log_discard(slot);
+            store_erase(slot, file->save_size);
         }
     }
     else if (sel == 3) {
-        // if (is_fav)
-        //     favorite_remove(file);
-        // else
-        //     favorite_add(file);
+        if (is_fav)
+            favorite_remove(file);
+        else
+            favorite_add(file);
     }
 
     // free(save_path);
     // free(sram_path);
 }
 
+// ITCRAM isn't cached, the new code only needs to be written before it runs
+static void load_itcram(void *load_start, size_t size)
+{
+    copy_from_xip(__itcram_emu_start__, load_start, size);
+    __DSB();
+    __ISB();
+}
+
 void emulator_start(retro_emulator_file_t *file, bool load_state, bool start_paused)
 {
     printf("Retro-Go: Starting game: %s\n", file->name);
+    boot_trace("emulator start");
+    launcher_leave();
     rom_manager_set_active_file(file);
+    recent_add(file, load_state);
 
     // odroid_settings_StartAction_set(load_state ? ODROID_START_ACTION_RESUME : ODROID_START_ACTION_NEWGAME);
     // odroid_settings_RomFilePath_set(path);
     // odroid_settings_commit();
 
     // odroid_system_switch_app(((retro_emulator_t *)file->emulator)->partition);
-    retro_emulator_t *emu = file_to_emu(file);
+    // Not file_to_emu(), the launcher isn't set up when resuming at boot
+    const rom_system_t *emu = file->system;
     // TODO: Make this cleaner
     if(strcmp(emu->system_name, "Nintendo Gameboy") == 0) {
 #ifdef ENABLE_EMULATOR_GB
-        memcpy(&__RAM_EMU_START__, &_OVERLAY_GB_LOAD_START, (size_t)&_OVERLAY_GB_SIZE);
+        copy_from_xip(&__RAM_EMU_START__, &_OVERLAY_GB_LOAD_START, (size_t)&_OVERLAY_GB_SIZE);
         memset(&_OVERLAY_GB_BSS_START, 0x0, (size_t)&_OVERLAY_GB_BSS_SIZE);
+        // The bank cache of the core takes the rest of RAM_EMU
+        emu_arena_init(&__RAM_EMU_END__);
         SCB_CleanDCache_by_Addr((uint32_t *)&__RAM_EMU_START__, (size_t)&_OVERLAY_GB_SIZE);
+        load_itcram(_ITCRAM_GB_LOAD_START, (size_t)&_ITCRAM_GB_SIZE);
+        memset(__dtcm_emu_start__, 0x0, (size_t)&_DTCM_EMU_GB_SIZE);
         app_main_gb(load_state, start_paused);
 #endif
     } else if(strcmp(emu->system_name, "Nintendo Entertainment System") == 0) {
 #ifdef ENABLE_EMULATOR_NES
-        memcpy(&__RAM_EMU_START__, &_OVERLAY_NES_LOAD_START, (size_t)&_OVERLAY_NES_SIZE);
+        copy_from_xip(&__RAM_EMU_START__, &_OVERLAY_NES_LOAD_START, (size_t)&_OVERLAY_NES_SIZE);
         memset(&_OVERLAY_NES_BSS_START, 0x0, (size_t)&_OVERLAY_NES_BSS_SIZE);
+        emu_arena_init(_OVERLAY_NES_BSS_END);
         SCB_CleanDCache_by_Addr((uint32_t *)&__RAM_EMU_START__, (size_t)&_OVERLAY_NES_SIZE);
+        load_itcram(_ITCRAM_NES_LOAD_START, (size_t)&_ITCRAM_NES_SIZE);
+        memset(__dtcm_emu_start__, 0x0, (size_t)&_DTCM_EMU_NES_SIZE);
         app_main_nes(load_state, start_paused);
 #endif
     } else if(strcmp(emu->system_name, "Sega Master System") == 0 ||
@@ -405,9 +391,12 @@ void emulator_start(retro_emulator_file_t *file, bool load_state, bool start_pau
               strcmp(emu->system_name, "Sega SG-1000") == 0       ||
               strcmp(emu->system_name, "Colecovision") == 0 ) {
 #if defined(ENABLE_EMULATOR_SMS) || defined(ENABLE_EMULATOR_GG) || defined(ENABLE_EMULATOR_COL) || defined(ENABLE_EMULATOR_SG1000)
-        memcpy(&__RAM_EMU_START__, &_OVERLAY_SMS_LOAD_START, (size_t)&_OVERLAY_SMS_SIZE);
+        copy_from_xip(&__RAM_EMU_START__, &_OVERLAY_SMS_LOAD_START, (size_t)&_OVERLAY_SMS_SIZE);
         memset(&_OVERLAY_SMS_BSS_START, 0x0, (size_t)&_OVERLAY_SMS_BSS_SIZE);
+        emu_arena_init(_OVERLAY_SMS_BSS_END);
         SCB_CleanDCache_by_Addr((uint32_t *)&__RAM_EMU_START__, (size_t)&_OVERLAY_SMS_SIZE);
+        load_itcram(_ITCRAM_SMS_LOAD_START, (size_t)&_ITCRAM_SMS_SIZE);
+        memset(__dtcm_emu_start__, 0x0, (size_t)&_DTCM_EMU_SMS_SIZE);
         if (! strcmp(emu->system_name, "Colecovision")) app_main_smsplusgx(load_state, start_paused, SMSPLUSGX_ENGINE_COLECO);
         else
         if (! strcmp(emu->system_name, "Sega SG-1000")) app_main_smsplusgx(load_state, start_paused, SMSPLUSGX_ENGINE_SG1000);
@@ -415,16 +404,22 @@ void emulator_start(retro_emulator_file_t *file, bool load_state, bool start_pau
 #endif
     } else if(strcmp(emu->system_name, "Game & Watch") == 0 ) {
 #ifdef ENABLE_EMULATOR_GW
-        memcpy(&__RAM_EMU_START__, &_OVERLAY_GW_LOAD_START, (size_t)&_OVERLAY_GW_SIZE);
+        copy_from_xip(&__RAM_EMU_START__, &_OVERLAY_GW_LOAD_START, (size_t)&_OVERLAY_GW_SIZE);
         memset(&_OVERLAY_GW_BSS_START, 0x0, (size_t)&_OVERLAY_GW_BSS_SIZE);
+        emu_arena_init(_OVERLAY_GW_BSS_END);
         SCB_CleanDCache_by_Addr((uint32_t *)&__RAM_EMU_START__, (size_t)&_OVERLAY_GW_SIZE);
+        load_itcram(_ITCRAM_GW_LOAD_START, (size_t)&_ITCRAM_GW_SIZE);
+        memset(__dtcm_emu_start__, 0x0, (size_t)&_DTCM_EMU_GW_SIZE);
         app_main_gw(load_state);
 #endif
     } else if(strcmp(emu->system_name, "PC Engine") == 0) {
 #ifdef ENABLE_EMULATOR_PCE
-      memcpy(&__RAM_EMU_START__, &_OVERLAY_PCE_LOAD_START, (size_t)&_OVERLAY_PCE_SIZE);
+      copy_from_xip(&__RAM_EMU_START__, &_OVERLAY_PCE_LOAD_START, (size_t)&_OVERLAY_PCE_SIZE);
       memset(&_OVERLAY_PCE_BSS_START, 0x0, (size_t)&_OVERLAY_PCE_BSS_SIZE);
+      emu_arena_init(_OVERLAY_PCE_BSS_END);
       SCB_CleanDCache_by_Addr((uint32_t *)&__RAM_EMU_START__, (size_t)&_OVERLAY_PCE_SIZE);
+      load_itcram(_ITCRAM_PCE_LOAD_START, (size_t)&_ITCRAM_PCE_SIZE);
+      memset(__dtcm_emu_start__, 0x0, (size_t)&_DTCM_EMU_PCE_SIZE);
       app_main_pce(load_state, start_paused);
 #endif
   }
@@ -480,13 +475,8 @@ void emulators_init()
 
 bool emulator_is_file_valid(retro_emulator_file_t *file)
 {
-    for (int i = 0; i < emulators_count; i++) {
-        for (int j = 0; j < emulators[i].roms.count; j++) {
-            if (&emulators[i].roms.files[j] == file) {
-                return true;
-            }
-        }
-    }
+    uint32_t id;
 
-    return false;
+    // Works before emulators_init(), for resuming at boot
+    return file != NULL && rom_manager_file_id(file, &id);
 }
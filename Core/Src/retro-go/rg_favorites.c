@@ -5,28 +5,27 @@
 #include <stdio.h>
 
 #include "rg_favorites.h"
+#include "rom_manager.h"
 #include "bitmaps.h"
 #include "gui.h"
+#include "common.h"
 
-#define KEY_FAVORITES "Favorites"
+// Favorites are stored in the settings as ROM ids, see rom_manager.h.
+// A bit per ROM tells if it's one.
+#define FAVORITE_SYSTEM(id)      ((id) >> 16)
+#define FAVORITE_ROM(id)         ((id) & 0x7fff)
 
-static favorite_t *favorites;
+static uint32_t favorites[FAVORITES_MAX];
 static int favorites_count = 0;
+static uint32_t **favorite_bits;
+static listbox_item_t favorite_items[FAVORITES_MAX];
 static tab_t *fav_tab;
 
-static void favorites_load();
-
 static void event_handler(gui_event_t event, tab_t *tab)
 {
     listbox_item_t *item = gui_get_selected_item(tab);
     retro_emulator_file_t *file = (retro_emulator_file_t *)(item ? item->arg : NULL);
 
-    if (event == TAB_INIT)
-    {
-        // I know this happens twice, this is needed for now...
-        favorites_load();
-    }
-
     if (file == NULL)
         return;
 
@@ -44,9 +43,6 @@ static void event_handler(gui_event_t event, tab_t *tab)
     {
         if (file->checksum == 0)
             emulator_crc32_file(file);
-
-        if (gui.show_cover && gui.idle_counter == (gui.show_cover == 1 ? 8 : 1))
-            gui_draw_cover(file);
     }
     else if (event == TAB_REDRAW)
     {
@@ -55,129 +51,142 @@ static void event_handler(gui_event_t event, tab_t *tab)
     }
 }
 
-static void favorites_load()
+static void favorite_set_bit(uint32_t id, bool set)
 {
-    char *favorites_str = odroid_settings_string_get(KEY_FAVORITES, "");
-    char *temp_ptr = favorites_str;
+    uint32_t *bits = &favorite_bits[FAVORITE_SYSTEM(id)][FAVORITE_ROM(id) / 32];
 
-    favorites_count = 0;
-    rg_free(favorites);
-
-    while (*temp_ptr)
-        if (*temp_ptr++ == '\n')
-            favorites_count++;
-
-    favorites = rg_calloc(favorites_count + 1, sizeof(favorite_t));
-    gui_resize_list(fav_tab, favorites_count);
+    if (set)
+        *bits |= 1 << (FAVORITE_ROM(id) % 32);
+    else
+        *bits &= ~(1 << (FAVORITE_ROM(id) % 32));
+}
 
-    char *token = strtok(favorites_str, "\n");
-    int pos = 0;
+static void favorites_update_list()
+{
+    fav_tab->listbox.items = favorite_items;
 
-    while (token != NULL)
+    if (favorites_count > 0)
     {
-        favorite_t *favorite = &favorites[pos];
-
-        if (emulator_build_file_object(token, &favorite->file))
-        {
-            strcpy(favorite->path, token);
-            sprintf(favorite->name, "[%-3s] %s", favorite->file.ext, favorite->file.name);
-            strcpy(fav_tab->listbox.items[pos].text, favorite->name);
-            fav_tab->listbox.items[pos].arg = &favorite->file;
-            pos++;
-        }
-        else
+        for (int i = 0; i < favorites_count; i++)
         {
-            printf("Unknown favorite: '%s'\n", token);
-            favorites_count--;
-        }
+            const retro_emulator_file_t *file = rom_manager_file(favorites[i]);
 
-        token = strtok(NULL, "\n");
-    }
+            favorite_items[i] = (listbox_item_t) {
+                .text = file->name,
+                .arg = (void *) file,
+            };
+        }
 
-    if (favorites_count > 0)
-    {
-        sprintf(fav_tab->status, "Favorites: %d", favorites_count);
-        gui_resize_list(fav_tab, favorites_count);
+        sprintf(fav_tab->status, " Favorites: %d", favorites_count);
+        fav_tab->listbox.length = favorites_count;
         gui_sort_list(fav_tab, 0);
         fav_tab->is_empty = false;
     }
     else
     {
-        sprintf(fav_tab->status, "No favorites");
-        gui_resize_list(fav_tab, 6);
-        sprintf(fav_tab->listbox.items[0].text, "Welcome to Retro-Go!");
-        sprintf(fav_tab->listbox.items[2].text, "You have no favorites.");
-        sprintf(fav_tab->listbox.items[4].text, "Use SELECT and START to navigate.");
+        memset(favorite_items, 0, sizeof(favorite_items));
+        favorite_items[0].text = "Welcome to Retro-Go!";
+        favorite_items[2].text = "You have no favorites.";
+        favorite_items[4].text = "Use SELECT and START to navigate.";
+
+        sprintf(fav_tab->status, " No favorites");
+        fav_tab->listbox.length = 5;
         fav_tab->listbox.cursor = 3;
         fav_tab->is_empty = true;
     }
+
+    fav_tab->listbox.cursor = MIN(fav_tab->listbox.cursor, fav_tab->listbox.length - 1);
+    fav_tab->listbox.cursor = MAX(fav_tab->listbox.cursor, 0);
 }
 
-static void favorites_save()
+static void favorites_load()
 {
-    char *buffer = rg_calloc(favorites_count, 128);
+    const uint32_t *ids;
+    uint32_t count = odroid_settings_Favorites_get(&ids);
 
-    for (int i = 0; i < favorites_count; i++)
+    favorites_count = 0;
+
+    for (int i = 0; i < count && favorites_count < FAVORITES_MAX; i++)
     {
-        if (!favorites[i].removed) {
-            strcat(buffer, favorites[i].path);
-            strcat(buffer, "\n");
+        const retro_emulator_file_t *file = rom_manager_file(ids[i]);
+
+        // The ROMs may have changed since the favorite was added
+        if (file == NULL || favorite_find((retro_emulator_file_t *)file))
+        {
+            printf("Unknown favorite: %08lx\n", ids[i]);
+            continue;
         }
+
+        favorites[favorites_count++] = ids[i] & ROM_ID_MASK;
+        favorite_set_bit(ids[i] & ROM_ID_MASK, true);
     }
+}
 
-    odroid_settings_string_set(KEY_FAVORITES, buffer);
-    odroid_settings_commit();
-    rg_free(buffer);
+static void favorites_save()
+{
+    odroid_settings_Favorites_set(favorites, favorites_count);
+    odroid_settings_commit_later();
 }
 
-favorite_t *favorite_find(retro_emulator_file_t *file)
+bool favorite_find(retro_emulator_file_t *file)
 {
-    for (int i = 0; i < favorites_count; i++)
-    {
-        if (favorites[i].file.emulator == file->emulator
-            && strcmp(favorites[i].file.name, file->name) == 0)
-        {
-            return &favorites[i];
-        }
-    }
+    uint32_t id;
 
-    return NULL;
+    if (!rom_manager_file_id(file, &id))
+        return false;
+
+    return favorite_bits[FAVORITE_SYSTEM(id)][FAVORITE_ROM(id) / 32] & (1 << (FAVORITE_ROM(id) % 32));
 }
 
 bool favorite_add(retro_emulator_file_t *file)
 {
-    // There's always one free slot at the end
-    favorite_t *favorite = &favorites[favorites_count++];
+    uint32_t id;
+
+    if (favorites_count >= FAVORITES_MAX || !rom_manager_file_id(file, &id) || favorite_find(file))
+        return false;
 
-    sprintf(favorite->path, "%s/%s.%s", file->folder, file->name, file->ext);
-    favorite->removed = false;
+    favorites[favorites_count++] = id;
+    favorite_set_bit(id, true);
 
     favorites_save();
-    favorites_load();
+    favorites_update_list();
 
     return true;
 }
 
 bool favorite_remove(retro_emulator_file_t *file)
 {
-    favorite_t *favorite = favorite_find(file);
+    uint32_t id;
 
-    if (favorite == NULL)
+    if (!favorite_find(file) || !rom_manager_file_id(file, &id))
         return false;
 
-    favorite->removed = true;
+    for (int i = 0; i < favorites_count; i++)
+    {
+        if (favorites[i] == id)
+        {
+            memmove(&favorites[i], &favorites[i + 1], (favorites_count - i - 1) * sizeof(favorites[0]));
+            favorites_count--;
+            break;
+        }
+    }
+    favorite_set_bit(id, false);
 
-    // Lazy lazy lazy
     favorites_save();
-    favorites_load();
+    favorites_update_list();
 
     return true;
 }
 
 void favorites_init()
 {
-    fav_tab = gui_add_tab("favorites", &logo_fav, NULL, NULL, event_handler);
+    fav_tab = gui_add_tab("favorites", logo_fav, header_fav, NULL, event_handler);
+
+    favorite_bits = rg_calloc(rom_mgr.systems_count, sizeof(uint32_t *));
+    for (int i = 0; i < rom_mgr.systems_count; i++)
+        favorite_bits[i] = rg_calloc((rom_mgr.systems[i]->roms_count + 31) / 32 + 1, sizeof(uint32_t));
 
-    // We must load favorites now because other tabs depend on it for menu items
+    // Loaded now because the other tabs show if their ROMs are favorites
     favorites_load();
+    favorites_update_list();
 }
@@ -1,4 +1,5 @@
 #include <odroid_system.h>
+#include <setjmp.h>
 #include <stdarg.h>
 #include <stdio.h>
 #include <stdint.h>
@@ -7,14 +8,30 @@
 #include <unistd.h>
 
 #include "appid.h"
+#include "common.h"
 #include "rg_emulators.h"
 #include "rg_favorites.h"
+#include "rg_recent.h"
 #include "gui.h"
 #include "githash.h"
 #include "main.h"
 #include "gw_buttons.h"
 #include "gw_flash.h"
+#include "gw_linker.h"
 #include "rg_rtc.h"
+#include "state_slots.h"
+#include "boot_trace.h"
+#include "emu_arena.h"
+#include "rg_benchmark.h"
+#include "cpu_clock.h"
+#include "gw_blit.h"
+#include "gw_lcd.h"
+#include "mem_stats.h"
+#include "ram_loader.h"
+#include "rewind.h"
+#include "run_ahead.h"
+#include "screenshot.h"
+#include "store_async.h"
 
 #if 0
 #define KEY_SELECTED_TAB  "SelectedTab"
@@ -153,6 +170,14 @@ static inline bool tab_enabled(tab_t *tab)
     return (disabled_tabs == gui.tabcount) || (tab->initialized && !tab->is_empty);
 }
 
+// The loop sleeps until a button changes or the next tick, which redraws
+// the status bar for the battery. While a button is held it wakes up every
+// LAUNCHER_REPEAT_MS for the key repeat.
+#define LAUNCHER_TICK_MS   2000
+#define LAUNCHER_REPEAT_MS 20
+// Once the key repeat moved the cursor 10 lines, UP and DOWN jump a letter per repeat
+#define LAUNCHER_LETTER_REPEAT (30 + 10 * 5)
+
 void retro_loop()
 {
     tab_t *tab = gui_get_current_tab();
@@ -160,8 +185,8 @@ void retro_loop()
     int repeat = 0;
     int selected_tab_last = -1;
     uint32_t idle_s;
-
-
+    uint32_t tick_last = HAL_GetTick();
+    bool redraw = true;
 
     // Read the initial state as to not trigger on button held down during boot
     odroid_input_read_gamepad(&gui.joystick);
@@ -173,7 +198,7 @@ void retro_loop()
     gui.selected      = odroid_settings_MainMenuSelectedTab_get();
     // gui.theme      = odroid_settings_int32_get(KEY_GUI_THEME, 0);
     // gui.show_empty = odroid_settings_int32_get(KEY_SHOW_EMPTY, 1);
-    // gui.show_cover = odroid_settings_int32_get(KEY_SHOW_COVER, 1);
+    gui.show_cover = odroid_settings_int32_get(KEY_SHOW_COVER, 1);
 
     while (true)
     {
@@ -219,15 +244,20 @@ void retro_loop()
         if (idle_s > 0 && gui.joystick.bitmask == 0)
         {
             gui_event(TAB_IDLE, tab);
+        }
 
-            if (idle_s % 10 == 0)
-                gui_draw_status(tab);
+        if (HAL_GetTick() - tick_last >= LAUNCHER_TICK_MS) {
+            tick_last = HAL_GetTick();
+            redraw = true;
         }
 
         if ((last_key < 0) || ((repeat >= 30) && (repeat % 5 == 0))) {
             for (int i = 0; i < ODROID_INPUT_MAX; i++)
                 if (gui.joystick.values[i]) last_key = i;
 
+            if (last_key >= 0)
+                redraw = true;
+
             if (last_key == ODROID_INPUT_START) {
                 odroid_dialog_choice_t choices[] = {
                     {0, "Ver.", GIT_HASH, 1, NULL},
@@ -284,6 +314,8 @@ void retro_loop()
                         {0, "DBGMCU IDCODE", dbgmcu_id_str, 1, NULL},
                         {1, "Enable DBGMCU CK", dbgmcu_cr_str, 1, NULL},
                         {2, "Disable DBGMCU CK", "", 1, NULL},
+                        {0, "------------------", "", 1, NULL},
+                        {3, "Run benchmark", "", 1, NULL},
                         {0, "Close", "", 1, NULL},
                         ODROID_DIALOG_CHOICE_LAST
                     };
@@ -311,6 +343,9 @@ void retro_loop()
                             DBGMCU_CR_DBG_CKSRDEN
                         );
                         break;
+                    case 3:
+                        benchmark_run();
+                        break;
                     default:
                         break;
                     }
@@ -325,7 +360,7 @@ void retro_loop()
                     {0, "Idle power off", timeout_value, 1, &main_menu_timeout_cb},
                     // {0, "Color theme", "1/10", 1, &color_shift_cb},
                     // {0, "Font size", "Small", 1, &font_size_cb},
-                    // {0, "Show cover", "Yes", 1, &show_cover_cb},
+                    {0, "Show cover", "Yes", 1, &show_cover_cb},
                     // {0, "Show empty", "Yes", 1, &show_empty_cb},
                     // {0, "---", "", -1, NULL},
                     // {0, "Startup app", "Last", 1, &startup_app_cb},
@@ -383,11 +418,11 @@ void retro_loop()
                 gui_redraw();
             }
             else if (last_key == ODROID_INPUT_UP) {
-                gui_scroll_list(tab, LINE_UP);
+                gui_scroll_list(tab, repeat >= LAUNCHER_LETTER_REPEAT ? LETTER_UP : LINE_UP);
                 repeat++;
             }
             else if (last_key == ODROID_INPUT_DOWN) {
-                gui_scroll_list(tab, LINE_DOWN);
+                gui_scroll_list(tab, repeat >= LAUNCHER_LETTER_REPEAT ? LETTER_DOWN : LINE_DOWN);
                 repeat++;
             }
             else if (last_key == ODROID_INPUT_LEFT) {
@@ -431,30 +466,103 @@ void retro_loop()
           odroid_system_sleep();
         }
 
-        gui_redraw();
-        HAL_Delay(20);
+        odroid_settings_idle();
+        ram_loader_poll();
+        if (redraw) {
+            gui_redraw();
+            redraw = false;
+        }
+
+        if (last_key >= 0) {
+            buttons_wait_event(NULL, LAUNCHER_REPEAT_MS);
+        } else {
+            // Nothing to do but wait, at the lowest clock
+            uint32_t elapsed = HAL_GetTick() - tick_last;
+
+            cpu_clock_set_level(CPU_CLOCK_88MHZ);
+            buttons_wait_event(NULL, elapsed < LAUNCHER_TICK_MS ? LAUNCHER_TICK_MS - elapsed : 0);
+            cpu_clock_reset();
+        }
+    }
+}
+
+static jmp_buf launcher_jmp;
+static bool launcher_ready;
+static gw_heap_mark_t launcher_heap;
+
+void launcher_leave(void)
+{
+    if (launcher_ready) {
+        gw_heap_mark(&launcher_heap);
+    }
+}
+
+void launcher_return(void)
+{
+    if (launcher_ready) {
+        longjmp(launcher_jmp, 1);
     }
 }
 
+// What the game left running or pointing into its arena. ITCM and the
+// emulator part of DTCM aren't used by the launcher, nothing to restore.
+static void launcher_resume(void)
+{
+    printf("Retro-Go: Back in the launcher\n");
+
+    odroid_audio_ring_stop();
+    store_async_flush();
+    screenshot_reset();
+    state_slot_reset();
+    common_emu_reset();
+    lcd_set_refresh_rate(0);
+    rewind_reset();
+    run_ahead_init(NULL, 0);
+    odroid_overlay_set_debug_options(NULL);
+
+    gw_blit_wait();
+    lcd_sync();
+    lcd_overlay_show(NULL);
+    cpu_clock_reset();
+
+    gw_heap_release(&launcher_heap);
+    emu_arena_reserve_top(&__RAM_EMU_END__);
+    emu_arena_init(__RAM_EMU_START__);
+    gui_release_caches();
+    odroid_system_init(APPID_LAUNCHER, 32000);
+}
+
 void app_main(void)
 {
+    // The launcher has all of RAM_EMU, until an emulator starts
+    emu_arena_init(__RAM_EMU_START__);
     odroid_system_init(APPID_LAUNCHER, 32000);
+    boot_trace("settings");
     // odroid_display_clear(0);
 
-    emulators_init();
-    // favorites_init();
-
-    // Start the previously running emulator directly if it's a valid pointer.
-    // If the user holds down the TIME button during startup,start the retro-go 
-    // gui instead of the last ROM as a fallback.
+    // Start the previously running emulator directly if it's a valid pointer,
+    // before any of the launcher is set up. If the user holds down the TIME
+    // button during startup, start the retro-go gui instead of the last ROM
+    // as a fallback.
     retro_emulator_file_t *file = odroid_settings_StartupFile_get();
     if (emulator_is_file_valid(file) && ((GW_GetBootButtons() & B_TIME) == 0)) {
 #if STATE_SAVING == 1
+        // Resume from the slot that was saved last
+        state_slot_set(state_slot_latest(file));
         emulator_start(file, true, true);
 #else
         emulator_start(file, false, true);
 #endif
-    } else {
-        retro_loop();
     }
+
+    emulators_init();
+    favorites_init();
+    recent_init();
+
+    boot_trace("launcher");
+    if (setjmp(launcher_jmp) != 0) {
+        launcher_resume();
+    }
+    launcher_ready = true;
+    retro_loop();
 }
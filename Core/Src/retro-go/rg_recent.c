@@ -0,0 +1,183 @@
+#include <odroid_system.h>
+#include <string.h>
+#include <stdio.h>
+
+#include "rg_recent.h"
+#include "rom_manager.h"
+#include "state_slots.h"
+#include "bitmaps.h"
+#include "gui.h"
+#include "common.h"
+
+// Stored in the settings as ROM ids (see rom_manager.h), the most recent
+// first, with a flag telling if the game was left with a save state.
+#define RECENT_HAS_SAVE 0x00008000
+
+static uint32_t recent[RECENT_MAX];
+static int recent_count = -1;
+static listbox_item_t recent_items[RECENT_MAX];
+static tab_t *recent_tab;
+
+// Games are added when they are resumed at boot, before recent_init()
+static void recent_load()
+{
+    const uint32_t *ids;
+    uint32_t count = odroid_settings_Recent_get(&ids);
+
+    if (recent_count >= 0)
+        return;
+
+    recent_count = 0;
+    for (int i = 0; i < count && recent_count < RECENT_MAX; i++)
+    {
+        // The ROMs may have changed since the game was played
+        if (rom_manager_file(ids[i]) != NULL)
+            recent[recent_count++] = ids[i];
+    }
+}
+
+static bool recent_find(const retro_emulator_file_t *file, int *index)
+{
+    uint32_t id;
+
+    if (!rom_manager_file_id(file, &id))
+        return false;
+
+    for (int i = 0; i < recent_count; i++)
+    {
+        if ((recent[i] & ROM_ID_MASK) == id)
+        {
+            *index = i;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void recent_update_list()
+{
+    recent_tab->listbox.items = recent_items;
+    memset(recent_items, 0, sizeof(recent_items));
+
+    if (recent_count > 0)
+    {
+        for (int i = 0; i < recent_count; i++)
+        {
+            const retro_emulator_file_t *file = rom_manager_file(recent[i]);
+
+            recent_items[i].text = file->name;
+            recent_items[i].arg = (void *) file;
+            recent_items[i].id = i;
+        }
+
+        sprintf(recent_tab->status, " Recently played: %d", recent_count);
+        recent_tab->listbox.length = recent_count;
+        recent_tab->is_empty = false;
+    }
+    else
+    {
+        recent_items[0].text = "No games played yet.";
+        recent_items[2].text = "Use SELECT and START to navigate.";
+
+        sprintf(recent_tab->status, " Recently played");
+        recent_tab->listbox.length = 3;
+        recent_tab->listbox.cursor = 1;
+        recent_tab->is_empty = true;
+    }
+
+    recent_tab->listbox.cursor = MIN(recent_tab->listbox.cursor, recent_tab->listbox.length - 1);
+    recent_tab->listbox.cursor = MAX(recent_tab->listbox.cursor, 0);
+}
+
+static void recent_store()
+{
+    // Committed along with the next change of the settings, e.g. when
+    // the emulator is left or the device goes to sleep
+    odroid_settings_Recent_set(recent, recent_count);
+}
+
+static void event_handler(gui_event_t event, tab_t *tab)
+{
+    listbox_item_t *item = gui_get_selected_item(tab);
+    retro_emulator_file_t *file = (retro_emulator_file_t *)(item ? item->arg : NULL);
+
+    if (file == NULL)
+        return;
+
+    if (event == KEY_PRESS_A)
+    {
+        bool has_save = false;
+
+#if STATE_SAVING == 1
+        // Straight back into the game, from where it was left
+        if (recent[item->id] & RECENT_HAS_SAVE)
+        {
+            int latest = state_slot_latest(file);
+
+            has_save = latest >= 0;
+            state_slot_set(has_save ? latest : 0);
+        }
+#endif
+        gui_save_current_tab();
+        emulator_start(file, has_save, false);
+    }
+    else if (event == KEY_PRESS_B)
+    {
+        emulator_show_file_menu(file);
+        gui_redraw();
+    }
+    else if (event == TAB_IDLE)
+    {
+        if (file->checksum == 0)
+            emulator_crc32_file(file);
+    }
+    else if (event == TAB_REDRAW)
+    {
+        if (gui.show_cover)
+            gui_draw_cover(file);
+    }
+}
+
+void recent_add(const retro_emulator_file_t *file, bool has_save)
+{
+    uint32_t id;
+    int index;
+
+    if (!rom_manager_file_id(file, &id))
+        return;
+
+    recent_load();
+    index = recent_count;
+    if (!recent_find(file, &index) && recent_count < RECENT_MAX)
+        recent_count++;
+
+    // Move it to the front, dropping the oldest one if the list is full
+    index = MIN(index, RECENT_MAX - 1);
+    memmove(&recent[1], &recent[0], index * sizeof(recent[0]));
+    recent[0] = id | (has_save ? RECENT_HAS_SAVE : 0);
+
+    recent_store();
+    if (recent_tab)
+        recent_update_list();
+}
+
+void recent_set_has_save(const retro_emulator_file_t *file)
+{
+    int index;
+
+    recent_load();
+    if (recent_find(file, &index) && !(recent[index] & RECENT_HAS_SAVE))
+    {
+        recent[index] |= RECENT_HAS_SAVE;
+        recent_store();
+    }
+}
+
+void recent_init()
+{
+    recent_tab = gui_add_tab("recent", logo_fav, header_fav, NULL, event_handler);
+
+    recent_load();
+    recent_update_list();
+}
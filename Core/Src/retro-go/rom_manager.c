@@ -44,6 +44,30 @@ const rom_system_t *rom_manager_system(const rom_manager_t *mgr, char *name) {
     return NULL;
 }
 
+bool rom_manager_file_id(const retro_emulator_file_t *file, uint32_t *id)
+{
+    for (int i = 0; i < rom_mgr.systems_count; i++) {
+        const rom_system_t *system = rom_mgr.systems[i];
+
+        if (file >= system->roms && file < system->roms + system->roms_count) {
+            *id = (i << 16) | (file - system->roms);
+            return true;
+        }
+    }
+    return false;
+}
+
+const retro_emulator_file_t *rom_manager_file(uint32_t id)
+{
+    uint32_t system = (id & ROM_ID_MASK) >> 16;
+    uint32_t rom = id & ROM_ID_MASK & 0xffff;
+
+    if (system >= rom_mgr.systems_count || rom >= rom_mgr.systems[system]->roms_count) {
+        return NULL;
+    }
+    return &rom_mgr.systems[system]->roms[rom];
+}
+
 void rom_manager_set_active_file(retro_emulator_file_t *file)
 {
     ACTIVE_FILE = file;
@@ -46,8 +46,10 @@ void sha256_transform(SHA256_CTX *ctx, const BYTE data[])
 {
 	WORD a, b, c, d, e, f, g, h, i, j, t1, t2, m[64];
 
-	for (i = 0, j = 0; i < 16; ++i, j += 4)
-		m[i] = (data[j] << 24) | (data[j + 1] << 16) | (data[j + 2] << 8) | (data[j + 3]);
+	for (i = 0, j = 0; i < 16; ++i, j += 4) {
+		memcpy(&m[i], &data[j], sizeof(WORD));
+		m[i] = __builtin_bswap32(m[i]);
+	}
 	for ( ; i < 64; ++i)
 		m[i] = SIG1(m[i - 2]) + m[i - 7] + SIG0(m[i - 15]) + m[i - 16];
 
@@ -99,9 +101,17 @@ void sha256_init(SHA256_CTX *ctx)
 
 void sha256_update(SHA256_CTX *ctx, const BYTE data[], size_t len)
 {
-	WORD i;
+	WORD i = 0;
+
+	// Whole blocks are transformed in place instead of copied byte by byte
+	if (ctx->datalen == 0) {
+		for ( ; len - i >= 64; i += 64) {
+			sha256_transform(ctx, &data[i]);
+			ctx->bitlen += 512;
+		}
+	}
 
-	for (i = 0; i < len; ++i) {
+	for ( ; i < len; ++i) {
 		ctx->data[ctx->datalen] = data[i];
 		ctx->datalen++;
 		if (ctx->datalen == 64) {
@@ -0,0 +1,199 @@
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "bench.h"
+#include "crc32.h"
+#include "input_replay.h"
+
+#define MAX_EVENTS 1024
+
+typedef struct {
+    uint32_t frame;
+    odroid_gamepad_state_t state;
+} bench_event_t;
+
+static const char *const phase_names[BENCH_PHASE_COUNT] = {
+    [BENCH_EMULATE] = "emulate",
+    [BENCH_BLIT]    = "blit",
+};
+
+static const char *const button_names[ODROID_INPUT_MAX] = {
+    [ODROID_INPUT_UP]     = "UP",
+    [ODROID_INPUT_RIGHT]  = "RIGHT",
+    [ODROID_INPUT_DOWN]   = "DOWN",
+    [ODROID_INPUT_LEFT]   = "LEFT",
+    [ODROID_INPUT_SELECT] = "SELECT",
+    [ODROID_INPUT_START]  = "START",
+    [ODROID_INPUT_A]      = "A",
+    [ODROID_INPUT_B]      = "B",
+};
+
+static bool enabled;
+static uint32_t frames_wanted;
+static uint32_t frames;
+static uint32_t frames_drawn;
+static uint32_t checksum;
+
+static bench_event_t events[MAX_EVENTS];
+static uint32_t event_count;
+static uint32_t next_event;
+static odroid_gamepad_state_t held;
+
+static bench_phase_t phase = BENCH_EMULATE;
+static uint64_t mark_ns;
+static uint64_t start_ns;
+static uint64_t phase_ns[BENCH_PHASE_COUNT];
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static void charge(void)
+{
+    uint64_t now = now_ns();
+
+    phase_ns[phase] += now - mark_ns;
+    mark_ns = now;
+}
+
+static void load_script(const char *path)
+{
+    FILE *f = fopen(path, "r");
+    char line[256];
+    int line_number = 0;
+
+    if (!f) {
+        fprintf(stderr, "Can't open %s\n", path);
+        exit(1);
+    }
+
+    while (fgets(line, sizeof(line), f)) {
+        char *token = strtok(line, " \t\r\n");
+        bench_event_t *event = &events[event_count];
+
+        line_number++;
+        if (!token || token[0] == '#')
+            continue;
+
+        if (event_count == MAX_EVENTS) {
+            fprintf(stderr, "%s: more than %d lines\n", path, MAX_EVENTS);
+            exit(1);
+        }
+
+        memset(event, 0, sizeof(*event));
+        event->frame = strtoul(token, NULL, 10);
+        while ((token = strtok(NULL, " \t\r\n")) != NULL) {
+            int i;
+
+            if (strcmp(token, "-") == 0)
+                continue;
+
+            for (i = 0; i < ODROID_INPUT_MAX; i++) {
+                if (button_names[i] && strcmp(token, button_names[i]) == 0)
+                    break;
+            }
+            if (i == ODROID_INPUT_MAX) {
+                fprintf(stderr, "%s:%d: unknown button %s\n", path, line_number, token);
+                exit(1);
+            }
+            event->state.values[i] = 1;
+        }
+        event_count++;
+    }
+
+    fclose(f);
+}
+
+static void load_replay(const char *path)
+{
+    FILE *f = fopen(path, "rb");
+
+    if (!f || fread(&input_replay, 1, sizeof(input_replay), f) < offsetof(input_replay_t, runs) ||
+        input_replay.magic != INPUT_REPLAY_MAGIC || input_replay.count > INPUT_REPLAY_RUNS) {
+        fprintf(stderr, "%s isn't a recording of tools/input_replay.py\n", path);
+        exit(1);
+    }
+    fclose(f);
+
+    input_replay_set_mode(INPUT_REPLAY_PLAY);
+}
+
+bool bench_init(int argc, char *argv[])
+{
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--bench") == 0 && i + 1 < argc) {
+            frames_wanted = strtoul(argv[++i], NULL, 10);
+            enabled = true;
+        } else if (strcmp(argv[i], "--input") == 0 && i + 1 < argc) {
+            load_script(argv[++i]);
+        } else if (strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+            load_replay(argv[++i]);
+        } else {
+            fprintf(stderr, "Usage: %s [--bench FRAMES [--input SCRIPT]] [--replay RECORDING]\n", argv[0]);
+            exit(1);
+        }
+    }
+
+    start_ns = mark_ns = now_ns();
+    return enabled;
+}
+
+bool bench_enabled(void)
+{
+    return enabled;
+}
+
+void bench_input(odroid_gamepad_state_t *state)
+{
+    while (next_event < event_count && events[next_event].frame <= frames) {
+        held = events[next_event++].state;
+    }
+
+    *state = held;
+}
+
+void bench_begin(bench_phase_t new_phase)
+{
+    charge();
+    phase = new_phase;
+}
+
+void bench_end(bench_phase_t old_phase)
+{
+    charge();
+    phase = BENCH_EMULATE;
+}
+
+bool bench_frame(const void *frame, uint32_t size)
+{
+    if (frame != NULL) {
+        // Chained, so the order of the frames counts too
+        checksum = crc32_le(checksum, (unsigned char const *) frame, size);
+        frames_drawn++;
+    }
+
+    return ++frames >= frames_wanted;
+}
+
+void bench_report(void)
+{
+    double total_s;
+
+    charge();
+    total_s = (now_ns() - start_ns) / 1e9;
+
+    printf("Bench: %u frames (%u drawn) in %.3f s, %.1f fps\n",
+           frames, frames_drawn, total_s, frames / total_s);
+    for (int i = 0; i < BENCH_PHASE_COUNT; i++) {
+        printf("Bench: %-8s %8.1f us/frame\n", phase_names[i],
+               frames ? phase_ns[i] / 1e3 / frames : 0);
+    }
+    printf("Bench: checksum %08x\n", checksum);
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "odroid_input.h"
+
+/*
+ * Headless benchmark of the linux ports:
+ *
+ *   ./build/retro-go-gb.elf --bench 3000 --input script.txt
+ *
+ * runs the game for the given number of frames without a window and as fast
+ * as possible, then prints the frames per second, the average time per
+ * frame of each phase and a checksum of all the frames drawn.
+ *
+ * The input script has one line per change of the buttons held, the frame
+ * it happens at followed by the buttons, e.g.:
+ *
+ *   120 START
+ *   130 -
+ *   200 RIGHT A
+ *
+ * Lines starting with # are comments.
+ *
+ * --replay plays back a recording saved from the device with
+ * tools/input_replay.py, with or without --bench, see input_replay.h.
+ *
+ * The makefiles build with -O0 and ASan, only compare numbers of builds with
+ * the same OPT, e.g. make -f Makefile.gb OPT=-O2.
+ */
+
+typedef enum {
+    BENCH_EMULATE,
+    BENCH_BLIT,
+    BENCH_PHASE_COUNT
+} bench_phase_t;
+
+// Returns true if --bench was given, exits on bad arguments
+bool bench_init(int argc, char *argv[]);
+bool bench_enabled(void);
+
+// Buttons of the script at the current frame
+void bench_input(odroid_gamepad_state_t *state);
+
+// Everything outside of a phase counts as emulation
+void bench_begin(bench_phase_t phase);
+void bench_end(bench_phase_t phase);
+
+// Called once per emulated frame with what was drawn (NULL if skipped),
+// returns true once all the frames have run
+bool bench_frame(const void *frame, uint32_t size);
+
+void bench_report(void);
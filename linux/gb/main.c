@@ -13,6 +13,9 @@
 #include "crc32.h"
 
 #include "gw_lcd.h"
+#include "bench.h"
+#include "input_replay.h"
+#include "gb_bank_trace.h"
 #include "gnuboy/loader.h"
 #include "gnuboy/hw.h"
 #include "gnuboy/lcd.h"
@@ -68,7 +71,14 @@ void odroid_display_force_refresh(void)
 }
 
 
+static bool frame_drawn;
+
 static inline void blit(void) {
+    frame_drawn = true;
+    // gnuboy draws straight into fb_data, there is nothing to convert
+    if (bench_enabled())
+        return;
+
     // we want 60 Hz for NTSC
     int wantedTime = 1000 / 60;
     SDL_Delay(wantedTime); // rendering takes basically "0ms"
@@ -188,14 +198,25 @@ void init(void)
 
 int main(int argc, char *argv[])
 {
-    init_window(WIDTH, HEIGHT);
+    bool bench = bench_init(argc, argv);
+
+    if (!bench)
+        init_window(WIDTH, HEIGHT);
 
     init();
     odroid_gamepad_state_t joystick = {0};
 
+#if GB_BANK_TRACE
+    atexit(gb_bank_trace_dump);
+#endif
+
     while (true)
     {
-        odroid_input_read_gamepad(&joystick);
+        if (bench)
+            bench_input(&joystick);
+        else
+            odroid_input_read_gamepad(&joystick);
+        input_replay_frame(&joystick);
 
         uint startTime = get_elapsed_time();
         bool drawFrame = !skipFrames;
@@ -209,12 +230,19 @@ int main(int argc, char *argv[])
         pad_set(PAD_A, joystick.values[ODROID_INPUT_A]);
         pad_set(PAD_B, joystick.values[ODROID_INPUT_B]);
 
+        frame_drawn = false;
         emu_run(drawFrame);
 
         // Tick before submitting audio/syncing
         odroid_system_tick(!drawFrame, fullFrame, get_elapsed_time_since(startTime));
+
+        if (bench && bench_frame(frame_drawn ? fb_data : NULL, WIDTH * HEIGHT * BPP))
+            break;
     }
 
+    if (bench)
+        bench_report();
+
     SDL_Quit();
 
     return 0;
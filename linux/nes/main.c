@@ -8,6 +8,8 @@
 
 #include "porting.h"
 #include "crc32.h"
+#include "bench.h"
+#include "input_replay.h"
 
 #include <string.h>
 #include <nofrendo.h>
@@ -93,19 +95,24 @@ void osd_blitscreen(bitmap_t *bmp)
     static uint32_t lastTime = 0;
     static uint32_t frames = 0;
 
-    frames++;
-    uint32_t currentTime = SDL_GetTicks();
-    float delta = currentTime - lastFPSTime;
-    if (delta >= 1000) {
-        printf("FPS: %f\n", ((float)frames / (delta / 1000.0f)));
-        frames = 0;
-        lastFPSTime = currentTime;
+    // The benchmark runs as fast as it can
+    if (!bench_enabled()) {
+        frames++;
+        uint32_t currentTime = SDL_GetTicks();
+        float delta = currentTime - lastFPSTime;
+        if (delta >= 1000) {
+            printf("FPS: %f\n", ((float)frames / (delta / 1000.0f)));
+            frames = 0;
+            lastFPSTime = currentTime;
+        }
+
+        // we want 60 Hz for NTSC
+        int wantedTime = 1000 / 60;
+        SDL_Delay(wantedTime); // rendering takes basically "0ms"
+        lastTime = currentTime;
     }
 
-    // we want 60 Hz for NTSC
-    int wantedTime = 1000 / 60;
-    SDL_Delay(wantedTime); // rendering takes basically "0ms"
-    lastTime = currentTime;
+    bench_begin(BENCH_BLIT);
 
     // LCD is 320 wide, framebuffer is only 256
     const int hpad = (WIDTH - NES_SCREEN_WIDTH) / 2;
@@ -130,6 +137,14 @@ void osd_blitscreen(bitmap_t *bmp)
         }
     }
 
+    bench_end(BENCH_BLIT);
+
+    if (bench_enabled()) {
+        if (bench_frame(fb_data, WIDTH * HEIGHT * sizeof(fb_data[0])))
+            nes_getptr()->poweroff = 1;
+        return;
+    }
+
     SDL_UpdateTexture(fb_texture, NULL, fb_data, WIDTH * BPP);
     SDL_RenderCopy(renderer, fb_texture, NULL, NULL);
     SDL_RenderPresent(renderer);
@@ -138,7 +153,9 @@ void osd_blitscreen(bitmap_t *bmp)
 void osd_getinput(void)
 {
     SDL_Event event;
-    if (SDL_PollEvent(&event)) {
+    if (bench_enabled()) {
+        bench_input(&joystick1);
+    } else if (SDL_PollEvent(&event)) {
         if (event.type == SDL_KEYDOWN) {
             // printf("Press %d\n", event.key.keysym.sym);
             switch (event.key.keysym.sym) {
@@ -205,6 +222,8 @@ void osd_getinput(void)
         }
     }
 
+    input_replay_frame(&joystick1);
+
     uint16 pad0 = 0, pad1 = 0;
 
     if (joystick1.values[ODROID_INPUT_START])  pad0 |= INP_PAD_START;
@@ -301,7 +320,10 @@ int init_window(int width, int height)
 
 int main(int argc, char *argv[])
 {
-    init_window(WIDTH, HEIGHT);
+    bool bench = bench_init(argc, argv);
+
+    if (!bench)
+        init_window(WIDTH, HEIGHT);
 
     odroid_system_init(APP_ID, AUDIO_SAMPLE_RATE);
     odroid_system_emu_init(&LoadState, &SaveState, NULL);
@@ -318,6 +340,9 @@ int main(int argc, char *argv[])
     // nofrendo_start("Rom name (E).nes", NES_PAL, AUDIO_SAMPLE_RATE);
     nofrendo_start("Rom name (USA).nes", NES_NTSC, AUDIO_SAMPLE_RATE, false);
 
+    if (bench)
+        bench_report();
+
     SDL_Quit();
 
     return 0;
@@ -1,8 +1,13 @@
 #!/usr/bin/env python3
 import argparse
+import hashlib
+import multiprocessing
 import os
+import re
 import shutil
+import struct
 import subprocess
+import zlib
 from pathlib import Path
 from tempfile import TemporaryDirectory
 from typing import List
@@ -24,10 +29,12 @@ ROM_ENTRY_TEMPLATE = """\t{{
 \t\t.ext = "{extension}",
 \t\t.address = {rom_entry},
 \t\t.size = {size},
-\t\t.save_address = {save_entry},
-\t\t.save_size = sizeof({save_entry}),
+\t\t.save_address = {save_entry}[0],
+\t\t.save_size = sizeof({save_entry}[0]),
+\t\t.checksum = {checksum:#010x},
 \t\t.system = &{system},
 \t\t.region = {region},
+\t\t.cover = {cover},
 \t}},"""
 
 ROM_ENTRY_TEMPLATE_NO_SAVE = """\t{{
@@ -35,10 +42,24 @@ ROM_ENTRY_TEMPLATE_NO_SAVE = """\t{{
 \t\t.ext = "{extension}",
 \t\t.address = {rom_entry},
 \t\t.size = {size},
+\t\t.checksum = {checksum:#010x},
 \t\t.system = &{system},
 \t\t.region = {region},
+\t\t.cover = {cover},
 \t}},"""
 
+ROM_LIST_TEMPLATE = """
+const listbox_item_t {name}[] __attribute__((section (".extflash_data"))) = {{
+{body}
+}};
+"""
+
+ROM_LIST_ENTRY_TEMPLATE = """\t{{ .text = "{name}", .arg = (void *) &{roms}[{index}] }},"""
+
+ROM_LETTERS_TEMPLATE = """
+const uint16_t {name}[] __attribute__((section (".extflash_data"))) = {{ {body} }};
+"""
+
 SYSTEM_PROTO_TEMPLATE = """
 extern const rom_system_t {name};
 """
@@ -49,6 +70,8 @@ const rom_system_t {name} = {{
 \t.roms = {variable_name},
 \t.extension = "{extension}",
 \t.roms_count = {roms_count},
+\t.list = {list_name},
+\t.letters = {list_name}_letters,
 }};
 """
 
@@ -67,6 +90,120 @@ SAVE_SIZES = {
 MAX_COMPRESSED_NES_SIZE = 0x00081000
 MAX_COMPRESSED_PCE_SIZE = 0x00049000
 
+GB_BANK_SIZE = 16384
+
+# The SMS, GG, SG-1000 and ColecoVision ROMs are compressed a page of the
+# Sega mapper at a time, with LZ4: the pages that don't fit in RAM are
+# unpacked while the game runs, see page_cache_sms.c
+SEGA8_PAGE_SIZE = 16384
+SEGA8_CODEC = "lz4"
+SEGA8_SYSTEMS = ["sms_system", "gg_system", "col_system", "sg1000_system"]
+
+# Alignment of the cover art in the external flash, it's read as uint16_t
+COVER_ALIGN = 4
+
+# Cover art is looked up next to the ROM, with the name of the ROM
+COVER_EXTENSIONS = [".png", ".jpg", ".jpeg", ".bmp"]
+
+# Number of GB banks that fit in the swap cache when there's no ELF to read
+# _GB_ROM_UNPACK_BUFFER_SIZE from yet, e.g. on the very first build.
+DEFAULT_GB_CACHE_BANKS = 26
+
+
+# --compress=auto compresses every ROM with each of these and keeps the
+# smallest one that unpacks within --load-time-budget
+AUTO_COMPRESS = "auto"
+AUTO_CODECS = ["lz4", "zopfli", "lzma"]
+
+# Rough decode time on the device in microseconds per kB of unpacked ROM.
+# These are replaced by the measurements passed with --codec-calibration.
+CODEC_DECODE_US_PER_KB = {
+    "lz4": 20,
+    "zopfli": 150,
+    "lzma": 600,
+}
+
+# Codec names in the log of rom_loader.c
+CODEC_LOG_NAMES = {
+    "LZ4": "lz4",
+    "DEFLATE": "zopfli",
+    "LZMA": "lzma",
+}
+
+
+def read_codec_calibration(path: Path):
+    """Reads the decode times logged by rom_loader.c, e.g. copied from
+    tools/logpoll.py after starting a few games built with each codec.
+    Returns the microseconds per kB of unpacked ROM for every codec found.
+    """
+    pattern = re.compile(r"(\w+): uncompressed \d+ to (\d+) bytes in (\d+) us")
+    totals = {}
+    for match in pattern.finditer(path.read_text()):
+        codec = CODEC_LOG_NAMES.get(match.group(1))
+        if codec is None:
+            continue
+        size, time_us = totals.get(codec, (0, 0))
+        totals[codec] = (size + int(match.group(2)), time_us + int(match.group(3)))
+
+    return {
+        codec: time_us * 1024 / size for codec, (size, time_us) in totals.items() if size
+    }
+
+
+def read_elf_symbol(path: Path, name: str):
+    """Returns the value of symbol ``name`` in the 32-bit little endian ELF
+    file at ``path``, or ``None`` if the file or the symbol doesn't exist.
+    """
+    try:
+        elf = path.read_bytes()
+    except OSError:
+        return None
+
+    if elf[:5] != b"\x7fELF\x01" or elf[5] != 1:
+        return None
+
+    e_shoff, = struct.unpack_from("<I", elf, 0x20)
+    e_shentsize, e_shnum = struct.unpack_from("<HH", elf, 0x2E)
+
+    sections = [
+        struct.unpack_from("<IIIIIIIIII", elf, e_shoff + i * e_shentsize)
+        for i in range(e_shnum)
+    ]
+    SHT_SYMTAB = 2
+    for sh_type, sh_offset, sh_size, sh_link in (
+        (s[1], s[4], s[5], s[6]) for s in sections
+    ):
+        if sh_type != SHT_SYMTAB:
+            continue
+        strtab_offset = sections[sh_link][4]
+        for offset in range(sh_offset, sh_offset + sh_size, 16):
+            st_name, st_value = struct.unpack_from("<II", elf, offset)
+            end = elf.index(b"\0", strtab_offset + st_name)
+            if elf[strtab_offset + st_name : end] == name.encode():
+                return st_value
+
+    return None
+
+
+def read_gb_bank_trace(rom_path: Path):
+    """Reads the bank access counts for a GB ROM from ``<rom>.banks`` next
+    to it, one ``<bank> <accesses>`` pair per line as dumped by the GB port.
+    Returns ``None`` if there's no trace for this ROM.
+    """
+    trace_path = Path(str(rom_path) + ".banks")
+    if not trace_path.exists():
+        return None
+
+    accesses = {}
+    for line in trace_path.read_text().splitlines():
+        line = line.split("#")[0].split()
+        if len(line) < 2:
+            continue
+        bank, count = int(line[0], 0), int(line[1], 0)
+        accesses[bank] = accesses.get(bank, 0) + count
+
+    return accesses
+
 """
 All ``compress_*`` functions must be decorated ``@COMPRESSIONS`` and have the
 following signature:
@@ -85,6 +222,11 @@ And return compressed bytes.
 
 DONT_COMPRESS = object()
 
+# Compressed ROMs and GB banks are kept in --compress-cache by the hash of
+# the codec and the data. Bump this when a compress_* function changes what
+# it returns for the same data.
+COMPRESS_CACHE_VERSION = 1
+
 
 class CompressionRegistry(dict):
     prefix = "compress_"
@@ -236,6 +378,10 @@ def compress_lzma(data, level=None):
                 "id": lzma.FILTER_LZMA1,
                 "preset": 6,
                 "dict_size": 16 * 1024,
+                # Must match LZMA_FIXED_* in LzmaDec.h
+                "lc": 3,
+                "lp": 0,
+                "pb": 2,
             }
         ],
     )
@@ -245,6 +391,60 @@ def compress_lzma(data, level=None):
     return compressed_data
 
 
+def compress_cache_path(codec: str, data: bytes) -> Path:
+    h = hashlib.sha256(f"{COMPRESS_CACHE_VERSION}:{codec}:".encode())
+    h.update(data)
+    return Path(args.compress_cache) / codec / h.hexdigest()
+
+
+def _compress_job(job):
+    codec, data = job
+    return COMPRESSIONS[codec](data)
+
+
+def compress_prefetch(jobs, description: str):
+    """Compresses the (codec, data) jobs that aren't cached yet with a pool
+    of --jobs processes, so compress_cached() finds all of them."""
+    misses = {}
+    for codec, data in jobs:
+        path = compress_cache_path(codec, data)
+        if not path.exists():
+            misses[path] = (codec, data)
+    if not misses:
+        return
+
+    with multiprocessing.Pool(args.jobs) as pool:
+        results = pool.imap(_compress_job, misses.values())
+        if tqdm:
+            results = tqdm(results, total=len(misses), desc=description)
+        for path, compressed in zip(misses, results):
+            _compress_cache_store(path, compressed)
+
+
+def compress_cached(codec: str, data: bytes) -> bytes:
+    path = compress_cache_path(codec, data)
+    if path.exists():
+        return path.read_bytes()
+
+    compressed = COMPRESSIONS[codec](data)
+    _compress_cache_store(path, compressed)
+    return compressed
+
+
+def _compress_cache_store(path: Path, compressed: bytes):
+    # Renamed into place, an interrupted build doesn't leave a partial entry
+    path.parent.mkdir(parents=True, exist_ok=True)
+    tmp = path.with_suffix(".tmp")
+    tmp.write_bytes(compressed)
+    tmp.replace(path)
+
+
+def write_bytes_if_changed(path: Path, data: bytes):
+    # Keeps the mtime, so the ROM object isn't rebuilt
+    if not path.exists() or path.read_bytes() != data:
+        path.write_bytes(data)
+
+
 class ROM:
     def __init__(self, system_name: str, filepath: str, extension: str):
         filepath = Path(filepath)
@@ -265,6 +465,9 @@ class ROM:
             + "".join([i if i.isalnum() else "_" for i in symbol_path])
             + "_start"
         )
+        self.cover = None
+        # CRC-32 of the uncompressed ROM, 0 if unknown
+        self.checksum = 0
 
     def __str__(self) -> str:
         return f"name: {self.name} size: {self.size} ext: {self.ext}"
@@ -328,6 +531,8 @@ class ROMParser:
                     region=region,
                     extension=rom.ext,
                     system=system,
+                    cover=rom.cover or "NULL",
+                    checksum=rom.checksum,
                 )
             else:
                 body += ROM_ENTRY_TEMPLATE_NO_SAVE.format(
@@ -338,13 +543,43 @@ class ROMParser:
                     region=region,
                     extension=rom.ext,
                     system=system,
+                    cover=rom.cover or "NULL",
+                    checksum=rom.checksum,
                 )
             body += "\n"
 
         return ROM_ENTRIES_TEMPLATE.format(name=name, body=body, rom_count=len(roms))
 
+    def generate_rom_list(self, name: str, roms: [ROM], roms_name: str) -> str:
+        """The launcher list of the system, sorted like strcasecmp() would."""
+        order = sorted(range(len(roms)), key=lambda i: roms[i].name.encode().lower())
+        body = "\n".join(
+            ROM_LIST_ENTRY_TEMPLATE.format(name=roms[i].name, roms=roms_name, index=i)
+            for i in order
+        )
+
+        # First row of each letter, see listbox_t in gui.h
+        keys = [roms[i].name.encode().lower() for i in order]
+        letters = [
+            next((row for row, key in enumerate(keys) if key[:1] >= bytes([c])), len(keys))
+            for c in range(ord("a"), ord("z") + 1)
+        ]
+        letters_body = ", ".join(str(row) for row in letters)
+
+        return ROM_LIST_TEMPLATE.format(name=name, body=body) + ROM_LETTERS_TEMPLATE.format(
+            name=name + "_letters", body=letters_body
+        )
+
     def generate_object_file(self, rom: ROM) -> str:
-        # convert rom to an .o file and place the data in the .extflash_game_rom section
+        return self.generate_binary_object(
+            rom.path, rom.obj_path, rom.symbol, args.rom_align
+        )
+
+    def generate_binary_object(
+        self, path: Path, obj_path: str, symbol: str, align: int = 1
+    ) -> str:
+        # convert a file to an .o file and place the data in the .extflash_game_rom section
+        # aligned to align bytes, the linker packs them in the order they're added
         prefix = ""
         if "GCC_PATH" in os.environ:
             prefix = os.environ["GCC_PATH"]
@@ -355,14 +590,17 @@ class ROMParser:
                 prefix / "arm-none-eabi-objcopy",
                 "--rename-section",
                 ".data=.extflash_game_rom,alloc,load,readonly,data,contents",
+                # By the name of the input section
+                "--set-section-alignment",
+                f".data={align}",
                 "-I",
                 "binary",
                 "-O",
                 "elf32-littlearm",
                 "-B",
                 "armv7e-m",
-                rom.path,
-                rom.obj_path,
+                path,
+                obj_path,
             ]
         )
         subprocess.check_output(
@@ -370,14 +608,67 @@ class ROMParser:
                 prefix / "arm-none-eabi-ar",
                 "-cr",
                 "build/roms.a",
-                rom.obj_path,
+                obj_path,
             ]
         )
         template = "extern const uint8_t {name}[];\n"
-        return template.format(name=rom.symbol)
+        return template.format(name=symbol)
+
+    def pack_cover(self, image_path: Path) -> bytes:
+        """The cover art as drawn by gui_draw_cover(): width and height as
+        little endian uint16, then the RGB565 pixels, LZ4 compressed when it
+        saves space.
+        """
+        from PIL import Image
+
+        image = Image.open(image_path).convert("RGB")
+        image.thumbnail((args.cover_width, args.cover_height))
+
+        pixels = b"".join(
+            (((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)).to_bytes(2, "little")
+            for r, g, b in image.getdata()
+        )
+        if args.compress_covers:
+            compressed = compress_lz4(pixels)
+            if len(compressed) < len(pixels):
+                pixels = compressed
+
+        return struct.pack("<HH", *image.size) + pixels
+
+    def generate_cover(self, rom: ROM) -> (str, int):
+        """Packs the cover art of ``rom`` into external flash, if it has any.
+        Returns the declaration of its symbol and its size in bytes.
+        """
+        image_path = None
+        for ext in COVER_EXTENSIONS:
+            if (rom.path.parent / (rom.name + ext)).exists():
+                image_path = rom.path.parent / (rom.name + ext)
+                break
+        if image_path is None:
+            return "", 0
+
+        obj_name = "".join([i if i.isalnum() else "_" for i in rom.path.name])
+        cover_path = Path("build/roms/covers") / (obj_name + ".cover")
+        cover_path.parent.mkdir(mode=0o755, parents=True, exist_ok=True)
+
+        data = self.pack_cover(image_path)
+        if not cover_path.exists() or cover_path.read_bytes() != data:
+            cover_path.write_bytes(data)
+
+        rom.cover = (
+            "_binary_"
+            + "".join([i if i.isalnum() else "_" for i in str(cover_path)])
+            + "_start"
+        )
+        declaration = self.generate_binary_object(
+            cover_path, "build/roms/" + obj_name + "_cover.o", rom.cover, COVER_ALIGN
+        )
+        return declaration, len(data) + COVER_ALIGN - 1
 
     def generate_save_entry(self, name: str, save_size: int) -> str:
-        return f'uint8_t {name}[{save_size}]  __attribute__((section (".saveflash"))) __attribute__((aligned(4096)));\n'
+        # One 4kB aligned slot per save state slot (state_slots.c)
+        slot_size = (save_size + 4096 - 1) // 4096 * 4096
+        return f'uint8_t {name}[{args.state_slots}][{slot_size}]  __attribute__((section (".saveflash"))) __attribute__((aligned(4096)));\n'
 
     def get_gameboy_save_size(self, file: Path):
         total_size = 4096
@@ -413,8 +704,48 @@ class ROMParser:
 
         return 0
 
-    def _compress_rom(self, variable_name, rom, compress_gb_speed=False, compress=None):
-        """This will create a compressed rom file next to the original rom."""
+    def _compress_chunks(self, variable_name, rom, data=None, verbose=False):
+        """The pieces of the ROM that are compressed on their own, the whole
+        ROM or the GB banks. None if the ROM isn't compressed."""
+        if data is None:
+            data = rom.read()
+
+        max_size = None
+        if "nes_system" in variable_name:  # NES
+            max_size = MAX_COMPRESSED_NES_SIZE
+        elif "pce_system" in variable_name:  # PCE
+            max_size = MAX_COMPRESSED_PCE_SIZE
+        elif "gb_system" in variable_name:  # GB/GBC
+            return [
+                data[i : i + GB_BANK_SIZE] for i in range(0, len(data), GB_BANK_SIZE)
+            ]
+        elif variable_name in SEGA8_SYSTEMS:  # SMS/GG/SG-1000/Coleco
+            return [
+                data[i : i + SEGA8_PAGE_SIZE]
+                for i in range(0, len(data), SEGA8_PAGE_SIZE)
+            ]
+        else:
+            return None
+
+        if len(data) > max_size:
+            if verbose:
+                print(
+                    f"INFO: {rom.name} is too large to compress, skipping compression!"
+                )
+            return None
+        return [data]
+
+    def _compress_rom(
+        self,
+        variable_name,
+        rom,
+        compress_gb_speed=False,
+        compress=None,
+        gb_cache_banks=DEFAULT_GB_CACHE_BANKS,
+    ):
+        """This will create a compressed rom file next to the original rom.
+        It's only written if it changed, and the compressed chunks come from
+        the cache if compress_prefetch() did them."""
 
         if compress is None:
             compress = "lz4"
@@ -422,33 +753,28 @@ class ROMParser:
         if compress not in COMPRESSIONS:
             raise ValueError(f'Unknown compression method: "{compress}"')
 
-        if compress[0] != ".":
-            compress = "." + compress
-        output_file = Path(str(rom.path) + compress)
-        compress = COMPRESSIONS[compress]
+        codec = compress.lstrip(".")
+        output_file = Path(f"{rom.path}.{codec}")
+        compress = COMPRESSIONS[codec]
 
         data = rom.read()
-
-        if "nes_system" in variable_name:  # NES
-            if rom.path.stat().st_size > MAX_COMPRESSED_NES_SIZE:
-                print(
-                    f"INFO: {rom.name} is too large to compress, skipping compression!"
-                )
-                return
-            compressed_data = compress(data)
-            output_file.write_bytes(compressed_data)
-        elif "pce_system" in variable_name:  # PCE
-            if rom.path.stat().st_size > MAX_COMPRESSED_PCE_SIZE:
-                print(
-                    f"INFO: {rom.name} is too large to compress, skipping compression!"
-                )
-                return
-            compressed_data = compress(data)
-            output_file.write_bytes(compressed_data)
-        elif "gb_system" in variable_name:  # GB/GBC
-            BANK_SIZE = 16384
-            banks = [data[i : i + BANK_SIZE] for i in range(0, len(data), BANK_SIZE)]
-            compressed_banks = [compress(bank) for bank in banks]
+        chunks = self._compress_chunks(variable_name, rom, data, verbose=True)
+        if chunks is None:
+            return
+
+        if variable_name in SEGA8_SYSTEMS:
+            # One frame per page, stored as it is if it doesn't get smaller
+            output_pages = []
+            for page in chunks:
+                compressed_page = compress_cached(codec, page)
+                stored_page = compress(page, level=DONT_COMPRESS)
+                output_pages.append(min(compressed_page, stored_page, key=len))
+            write_bytes_if_changed(output_file, b"".join(output_pages))
+        elif "gb_system" not in variable_name:
+            write_bytes_if_changed(output_file, compress_cached(codec, data))
+        else:  # GB/GBC
+            banks = chunks
+            compressed_banks = [compress_cached(codec, bank) for bank in banks]
 
             # For ROM having continous bank switching we can use 'partial' compression
             # a mix of comcompressed and uncompress
@@ -463,24 +789,28 @@ class ROMParser:
                 # any empty bank is compressed (=98bytes). considered never used by MBC.
 
                 # Ths is the cache size used as a compression credit
-                # TODO : can we the value from the linker ?
-                compression_credit = 26
-                compress_size = [len(bank) for bank in compressed_banks[1:]]
+                compression_credit = gb_cache_banks
 
                 # to keep empty banks compressed (size=98)
-                compress_size = [i for i in compress_size if i > 98]
-
-                ordered_size = sorted(compress_size)
-
-                if compression_credit > len(ordered_size):
-                    compression_credit = len(ordered_size) - 1
+                candidates = [
+                    i for i in range(1, len(banks)) if len(compressed_banks[i]) > 98
+                ]
 
-                compress_threshold = ordered_size[int(compression_credit)]
+                accesses = read_gb_bank_trace(rom.path)
+                if accesses is not None:
+                    # Banks that weren't touched while tracing are treated
+                    # like empty banks. Of the others, the coldest ones are
+                    # compressed and the hottest stay uncompressed.
+                    candidates = [i for i in candidates if accesses.get(i, 0) > 0]
+                    candidates.sort(
+                        key=lambda i: (accesses[i], len(compressed_banks[i]))
+                    )
+                else:
+                    # Compress the banks with the best compression ratio
+                    candidates.sort(key=lambda i: len(compressed_banks[i]))
 
-                for i, bank in enumerate(compressed_banks):
-                    if len(bank) >= compress_threshold:
-                        # Don't compress banks with poor compression
-                        compress_its[i] = False
+                for i in candidates[compression_credit:]:
+                    compress_its[i] = False
             # END : ALTERNATIVE COMPRESSION STRATEGY
 
             # Reassemble all banks back into one file
@@ -494,7 +824,7 @@ class ROMParser:
                     output_banks.append(compress(bank, level=DONT_COMPRESS))
             output_data = b"".join(output_banks)
 
-            output_file.write_bytes(output_data)
+            write_bytes_if_changed(output_file, output_data)
 
     def generate_system(
         self,
@@ -506,18 +836,30 @@ class ROMParser:
         save_prefix: str,
         compress: str = None,
         compress_gb_speed: bool = False,
+        gb_cache_banks: int = DEFAULT_GB_CACHE_BANKS,
     ) -> int:
         roms_raw = []
         for e in extensions:
             roms_raw += self.find_roms(system_name, folder, e)
 
+        if compress == AUTO_COMPRESS and "gb_system" in variable_name:
+            # GB banks are unpacked on bank switches, not while loading
+            compress = "lzma"
+        if compress and variable_name in SEGA8_SYSTEMS:
+            # The pages are unpacked while the game runs, it has to be fast
+            compress = SEGA8_CODEC
+        codecs = AUTO_CODECS if compress == AUTO_COMPRESS else [compress]
+
         def find_compressed_roms():
             if not compress:
                 return []
 
             roms = []
-            for e in extensions:
-                roms += self.find_roms(system_name, folder, e + "." + compress)
+            for codec in codecs:
+                for e in extensions:
+                    roms += self.find_roms(system_name, folder, e + "." + codec)
+            if compress == AUTO_COMPRESS:
+                roms = self.select_compressed_roms(roms, roms_raw)
             return roms
 
         def contains_rom_by_name(rom, roms):
@@ -526,22 +868,25 @@ class ROMParser:
                     return True
             return False
 
-        roms_compressed = find_compressed_roms()
-
-        roms_raw = [r for r in roms_raw if not contains_rom_by_name(r, roms_compressed)]
-        if roms_raw and compress != None:
-            pbar = tqdm(roms_raw) if tqdm else roms_raw
-            for r in pbar:
-                if tqdm:
-                    pbar.set_description(f"Compressing: {system_name} / {r.name}")
+        # Every ROM is compressed again, from the cache unless it changed,
+        # so a compressed ROM never goes stale
+        to_compress = [(r, codec) for r in roms_raw for codec in codecs]
+        if to_compress and compress != None:
+            jobs = []
+            for r, codec in to_compress:
+                chunks = self._compress_chunks(variable_name, r) or []
+                jobs += [(codec, chunk) for chunk in chunks]
+            compress_prefetch(jobs, f"Compressing: {system_name}")
+
+            for r, codec in to_compress:
                 self._compress_rom(
                     variable_name,
                     r,
                     compress_gb_speed=compress_gb_speed,
-                    compress=compress,
+                    compress=codec,
+                    gb_cache_banks=gb_cache_banks,
                 )
-            # Re-generate the compressed rom list
-            roms_compressed = find_compressed_roms()
+        roms_compressed = find_compressed_roms()
 
         # Create a list with all compressed roms and roms that
         # don't have a compressed counterpart.
@@ -550,6 +895,14 @@ class ROMParser:
             if not contains_rom_by_name(r, roms_compressed):
                 roms.append(r)
 
+        # Of the ROM as the emulator sees it, so it isn't computed at boot.
+        # Compressed ROMs without the original are left to the device, see
+        # rom_loader_crc32_active().
+        for rom in roms:
+            raw = next((r for r in roms_raw if r.name == rom.name), None)
+            if raw is not None:
+                rom.checksum = zlib.crc32(raw.read())
+
         total_save_size = 0
         total_rom_size = 0
 
@@ -566,10 +919,15 @@ class ROMParser:
                 aligned_size = 4 * 1024
                 total_save_size += (
                     (save_size + aligned_size - 1) // (aligned_size)
-                ) * aligned_size
-                total_rom_size += rom.size
+                ) * aligned_size * args.state_slots
+                # Plus the most padding the alignment can add
+                total_rom_size += rom.size + args.rom_align - 1
 
                 f.write(self.generate_object_file(rom))
+
+                cover, cover_size = self.generate_cover(rom)
+                f.write(cover)
+                total_rom_size += cover_size
                 if args.save:
                     f.write(self.generate_save_entry(save_prefix + str(i), save_size))
 
@@ -577,6 +935,7 @@ class ROMParser:
                 folder + "_roms", roms, save_prefix, variable_name
             )
             f.write(rom_entries)
+            f.write(self.generate_rom_list(folder + "_list", roms, folder + "_roms"))
 
             f.write(
                 SYSTEM_TEMPLATE.format(
@@ -585,6 +944,7 @@ class ROMParser:
                     variable_name=folder + "_roms",
                     extension=folder,
                     roms_count=len(roms),
+                    list_name=folder + "_list",
                 )
             )
 
@@ -593,6 +953,36 @@ class ROMParser:
         else:
             return 0, total_rom_size
 
+    def select_compressed_roms(self, roms: [ROM], roms_raw: [ROM]) -> [ROM]:
+        """Picks the smallest of the compressed versions of each ROM that
+        unpacks within the load time budget, or the fastest one if none do.
+        """
+        unpacked_sizes = {r.name: r.size for r in roms_raw}
+        budget_us = args.load_time_budget * 1000
+
+        def decode_us(rom):
+            # Without the original the unpacked size isn't known, so only
+            # the compressed size counts
+            size = unpacked_sizes.get(rom.name, 0)
+            return size / 1024 * self.codec_us_per_kb[rom.ext]
+
+        selected = []
+        for name in dict.fromkeys(r.name for r in roms):
+            variants = [r for r in roms if r.name == name]
+            in_budget = [r for r in variants if decode_us(r) <= budget_us]
+            if in_budget:
+                rom = min(in_budget, key=lambda r: r.size)
+            else:
+                rom = min(variants, key=decode_us)
+            if args.verbose:
+                print(
+                    f"{name}: {rom.ext}, {rom.size} bytes, "
+                    f"~{decode_us(rom) / 1000:.0f} ms to unpack"
+                )
+            selected.append(rom)
+
+        return selected
+
     def write_if_changed(self, path: str, data: str):
         path = Path(path)
         old_data = None
@@ -601,11 +991,32 @@ class ROMParser:
         if data != old_data:
             path.write_text(data)
 
+    def get_gb_cache_banks(self, args) -> int:
+        cache_size = read_elf_symbol(Path(args.elf), "_GB_ROM_UNPACK_BUFFER_SIZE")
+        if cache_size is None:
+            if args.compress_gb_speed:
+                print(
+                    f"INFO: {args.elf} not found, assuming the GB swap cache "
+                    f"holds {DEFAULT_GB_CACHE_BANKS} banks."
+                )
+            return DEFAULT_GB_CACHE_BANKS
+
+        if args.verbose:
+            print(f"GB swap cache:\t{cache_size} bytes")
+
+        return cache_size // GB_BANK_SIZE
+
     def parse(self, args):
         total_save_size = 0
         total_rom_size = 0
         build_config = ""
 
+        self.codec_us_per_kb = dict(CODEC_DECODE_US_PER_KB)
+        if args.codec_calibration:
+            self.codec_us_per_kb.update(
+                read_codec_calibration(Path(args.codec_calibration))
+            )
+
         save_size, rom_size = self.generate_system(
             "Core/Src/retro-go/gb_roms.c",
             "Nintendo Gameboy",
@@ -615,6 +1026,7 @@ class ROMParser:
             "SAVE_GB_",
             args.compress,
             args.compress_gb_speed,
+            self.get_gb_cache_banks(args),
         )
         total_save_size += save_size
         total_rom_size += rom_size
@@ -640,6 +1052,7 @@ class ROMParser:
             "sms",
             ["sms"],
             "SAVE_SMS_",
+            args.compress,
         )
         total_save_size += save_size
         total_rom_size += rom_size
@@ -652,6 +1065,7 @@ class ROMParser:
             "gg",
             ["gg"],
             "SAVE_GG_",
+            args.compress,
         )
         total_save_size += save_size
         total_rom_size += rom_size
@@ -664,6 +1078,7 @@ class ROMParser:
             "col",
             ["col"],
             "SAVE_COL_",
+            args.compress,
         )
         total_save_size += save_size
         total_rom_size += rom_size
@@ -676,6 +1091,7 @@ class ROMParser:
             "sg",
             ["sg"],
             "SAVE_SG1000_",
+            args.compress,
         )
         total_save_size += save_size
         total_rom_size += rom_size
@@ -715,6 +1131,10 @@ class ROMParser:
             )
             exit(-1)
 
+        if args.save:
+            total_save_size += args.save_log_size
+            total_size += args.save_log_size
+
         if args.verbose:
             print(
                 f"Save data:\t{total_save_size} bytes\nROM data:\t{total_rom_size} bytes\n"
@@ -744,10 +1164,25 @@ if __name__ == "__main__":
     compression_choices = [t for t in COMPRESSIONS if not t[0] == "."]
     parser.add_argument(
         "--compress",
-        choices=compression_choices,
+        choices=compression_choices + [AUTO_COMPRESS],
         type=str,
         default=None,
-        help="Compression method. Defaults to no compression.",
+        help="Compression method. Defaults to no compression. 'auto' picks "
+        "a method for each ROM, see --load-time-budget.",
+    )
+    parser.add_argument(
+        "--load-time-budget",
+        type=int,
+        default=500,
+        help="With --compress=auto, longest time in milliseconds a ROM may "
+        "take to unpack when it's started.",
+    )
+    parser.add_argument(
+        "--codec-calibration",
+        type=str,
+        default=None,
+        help="Log of the device with the decode times of compressed ROMs, "
+        "used instead of the built-in estimates for --compress=auto.",
     )
     parser.add_argument(
         "--compress_gb_speed",
@@ -759,10 +1194,70 @@ if __name__ == "__main__":
     parser.add_argument(
         "--no-compress_gb_speed", dest="compress_gb_speed", action="store_false"
     )
+    parser.add_argument(
+        "--elf",
+        type=str,
+        default="build/gw_retro_go.elf",
+        help="Firmware of a previous build to read the GB swap cache size from. "
+        "With --compress_gb_speed, the banks listed in <rom>.banks are used "
+        "to pick the banks left uncompressed.",
+    )
+    parser.add_argument(
+        "--compress-cache",
+        type=str,
+        default=".compress_cache",
+        help="Directory of the compressed ROMs and GB banks of earlier builds, "
+        "outside of build/ so it's kept by 'make clean'.",
+    )
+    parser.add_argument(
+        "--jobs",
+        "-j",
+        type=int,
+        default=os.cpu_count(),
+        help="Processes compressing ROMs and GB banks in parallel.",
+    )
     parser.set_defaults(compress_gb_speed=False)
     parser.add_argument(
         "--no-save", dest="save", action="store_false"
     )
+    parser.add_argument(
+        "--save-log-size",
+        type=int,
+        default=0,
+        help="Bytes of save flash to reserve for the save log (save_log.c).",
+    )
+    parser.add_argument(
+        "--state-slots",
+        type=int,
+        default=1,
+        help="Number of save state slots per ROM (state_slots.c).",
+    )
+    parser.add_argument(
+        "--rom-align",
+        type=int,
+        default=32,
+        help="Alignment of the ROMs in the external flash. 32 is a cache line, "
+        "so the banks of an uncompressed ROM don't start in the middle of one.",
+    )
+    parser.add_argument(
+        "--cover-width",
+        type=int,
+        default=128,
+        help="Cover art (an image named like the ROM next to it) is scaled "
+        "down to fit this width.",
+    )
+    parser.add_argument(
+        "--cover-height",
+        type=int,
+        default=128,
+        help="Cover art is scaled down to fit this height.",
+    )
+    parser.add_argument(
+        "--no-compress-covers",
+        dest="compress_covers",
+        action="store_false",
+        help="Store cover art uncompressed instead of LZ4 compressed.",
+    )
     parser.add_argument(
         "--verbose",
         action="store_true",
@@ -770,9 +1265,16 @@ if __name__ == "__main__":
     )
     args = parser.parse_args()
 
-    if args.compress and "." + args.compress not in COMPRESSIONS:
+    if (
+        args.compress
+        and args.compress != AUTO_COMPRESS
+        and "." + args.compress not in COMPRESSIONS
+    ):
         raise ValueError(f"Unknown compression method specified: {args.compress}")
 
+    if args.rom_align < 1 or args.rom_align & (args.rom_align - 1):
+        raise ValueError(f"--rom-align must be a power of 2: {args.rom_align}")
+
     roms_path = Path("build/roms")
     roms_path.mkdir(mode=0o755, parents=True, exist_ok=True)
 
@@ -12,9 +12,11 @@ cd linux
 # Build gb
 ./update_gb_rom.sh ../roms/gb/*.gb
 make -j$(nproc) -f Makefile.gb
+./build/retro-go-gb.elf --bench 600
 make -f Makefile.gb clean
 
 # Build nes
 ./update_nes_rom.sh ../roms/nes/*.nes
 make -j$(nproc) -f Makefile.nes
+./build/retro-go-nes.elf --bench 600
 make -f Makefile.nes clean
@@ -37,6 +37,9 @@ OPENOCD=${OPENOCD:-$(which openocd || true)}
 
 RESET_DBGMCU=${RESET_DBGMCU:-1}
 
+FLASHAPP_VERIFY_CRC32=${FLASHAPP_VERIFY_CRC32:-0}
+FLASHAPP_COMPRESS=${FLASHAPP_COMPRESS:-1}
+
 if [[ -z ${OPENOCD} ]]; then
   echo "Cannot find 'openocd' in the PATH. You can set the environment variable 'OPENOCD' to manually specify the location"
   exit 2
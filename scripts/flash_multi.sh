@@ -12,13 +12,16 @@ DIR="$( cd "$( dirname "${BASH_SOURCE[0]}" )" >/dev/null 2>&1 && pwd )"
 ELF=${DIR}/build/gw_base.elf
 
 if [[ $# -lt 1 ]]; then
-    echo "Usage: flash_multi.sh <binary to flash> [address=0] [chip_erase=0]"
+    echo "Usage: flash_multi.sh <binary to flash> [address=0] [chip_erase=0] [skip_identical=0]"
     echo ""
     echo "address:    The address to start writing to in the flash. Default is 0."
     echo "chip_erase: Forces the use of chip erase. Will erase the whole chip,"
     echo "            but may be faster for large flash chips."
+    echo "skip_identical: Compares the hash of each chunk with the flash first and"
+    echo "            skips chunks that are already there. Each chunk is then"
+    echo "            erased on its own."
     echo ""
-    echo "Note! This will cut the binary in 832kB chunks and flash them to address and onwards"
+    echo "Note! This will cut the binary in 412kB chunks (416kB if FLASHAPP_COMPRESS=0) and flash them to address and onwards"
     exit
 fi
 
@@ -33,6 +36,16 @@ if [[ $# -gt 2 ]]; then
     CHIP_ERASE=$3
 fi
 
+SKIP_IDENTICAL=0
+if [[ $# -gt 3 ]]; then
+    SKIP_IDENTICAL=$4
+fi
+
+if [[ $CHIP_ERASE == 1 && $SKIP_IDENTICAL == 1 ]]; then
+    echo "chip_erase and skip_identical can't be combined."
+    exit 1
+fi
+
 # stat on macOS has different flags
 if [[ "$(uname -s)" == "Darwin" ]]; then
     FILESIZE=$(stat -f%z "${IMAGE}")
@@ -40,7 +53,13 @@ else
     FILESIZE=$(stat -c%s "${IMAGE}")
 fi
 
-DEFAULT_CHUNK_SIZE_KB=$(( 832 ))
+# One of the two flashapp buffers, see flashapp.c. Compressed chunks are
+# decoded in place and need some room, see compress_lz4 in flashapp.sh.
+if [[ "${FLASHAPP_COMPRESS}" == "1" ]]; then
+    DEFAULT_CHUNK_SIZE_KB=$(( 412 ))
+else
+    DEFAULT_CHUNK_SIZE_KB=$(( 416 ))
+fi
 DEFAULT_CHUNK_SIZE=$(( DEFAULT_CHUNK_SIZE_KB * 1024 ))
 CHUNKS=$(( (FILESIZE + DEFAULT_CHUNK_SIZE - 1) / (DEFAULT_CHUNK_SIZE) ))
 SIZE=$((FILESIZE))
@@ -75,6 +94,10 @@ while [[ $SIZE -gt 0 ]]; do
     echo_green "Flashing!"
     if [[ $CHIP_ERASE == 1 ]]; then
         ERASE_BYTES=0
+    elif [[ $SKIP_IDENTICAL == 1 ]]; then
+        # Skipped chunks must be left alone, only erase this one
+        ERASE=1
+        ERASE_BYTES=$(( (( CHUNK_SIZE + SECTOR_SIZE - 1 ) / SECTOR_SIZE) * SECTOR_SIZE ))
     else
         ERASE_BYTES=$(( (( SIZE + SECTOR_SIZE - 1 ) / SECTOR_SIZE) * SECTOR_SIZE ))
     fi
@@ -94,7 +117,7 @@ while [[ $SIZE -gt 0 ]]; do
             echo "Retry count $RETRY_COUNT/10"
         fi
 
-        ${DIR}/flashapp.sh ${TMPFILE} ${ADDRESS_HEX} ${SIZE_HEX} ${ERASE} ${ERASE_BYTES} $((i + 1)) ${CHUNKS} && break
+        ${DIR}/flashapp.sh ${TMPFILE} ${ADDRESS_HEX} ${SIZE_HEX} ${ERASE} ${ERASE_BYTES} $((i + 1)) ${CHUNKS} ${SKIP_IDENTICAL} && break
     done
 
     if [[ $RETRY_COUNT -eq 10 ]]; then
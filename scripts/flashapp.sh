@@ -19,25 +19,44 @@ FLASHAPP_TEST_NEXT="0000000b"
 FLASHAPP_FINAL="0000000d"
 FLASHAPP_ERROR="0000000e"
 
+COMPARE_REQUESTED=1
+COMPARE_IDENTICAL="00000002"
+
 STATUS_BAD_HASH_RAM="bad00001"
 STATUS_BAD_HAS_FLASH="bad00002"
 STATUS_NOT_ALIGNED="bad00003"
+STATUS_BAD_COMPRESSION="bad00004"
 STATUS_IDLE="cafe0000"
 STATUS_DONE="cafe0001"
 STATUS_BUSY="cafe0002"
 
 VAR_boot_magic=$(              printf '0x%08x\n' $(get_symbol "boot_magic"))
 VAR_framebuffer2=$(            printf '0x%08x\n' $(get_symbol "framebuffer2"))
-VAR_flashapp_state=$(          printf '0x%08x\n' $(get_symbol "flashapp_state"))
+VAR_flashapp_comm=$(           printf '0x%08x\n' $(get_symbol "flashapp_comm"))
 VAR_program_start=$(           printf '0x%08x\n' $(get_symbol "program_start"))
-VAR_program_status=$(          printf '0x%08x\n' $(get_symbol "program_status"))
-VAR_program_size=$(            printf '0x%08x\n' $(get_symbol "program_size"))
-VAR_program_address=$(         printf '0x%08x\n' $(get_symbol "program_address"))
-VAR_program_erase=$(           printf '0x%08x\n' $(get_symbol "program_erase"))
-VAR_program_erase_bytes=$(     printf '0x%08x\n' $(get_symbol "program_erase_bytes"))
-VAR_program_chunk_idx=$(       printf '0x%08x\n' $(get_symbol "program_chunk_idx"))
-VAR_program_chunk_count=$(     printf '0x%08x\n' $(get_symbol "program_chunk_count"))
-VAR_program_expected_sha256=$( printf '0x%08x\n' $(get_symbol "program_expected_sha256"))
+VAR_program_jobs=$(            printf '0x%08x\n' $(get_symbol "program_jobs"))
+
+# Must match flashapp.c. Chunk N is loaded into buffer (N - 1) % BUFFER_COUNT
+# while the previous chunk is programmed from the other one.
+BUFFER_COUNT=2
+BUFFER_SIZE=$(( 416 * 1024 ))
+
+# Offsets in flashapp_job_t
+JOB_SIZE=108
+JOB_READY=0
+JOB_SIZE_OFFSET=4
+JOB_ADDRESS=8
+JOB_ERASE=12
+JOB_ERASE_BYTES=16
+JOB_CHUNK_IDX=20
+JOB_EXPECTED_SHA256=24
+JOB_COMPARE=92
+JOB_VERIFY_CRC32=96
+JOB_EXPECTED_CRC32=100
+JOB_COMPRESSED_SIZE=104
+
+# Offsets in flashapp_comm_t
+COMM_CHUNK_COUNT=12
 
 INTFLASH_BANK=${INTFLASH_BANK:-1}
 if [ $INTFLASH_BANK -eq 2 ]; then
@@ -48,6 +67,37 @@ fi
 
 # $1: file to hash
 # $2: file to write hash to in hex
+# $1: file
+function calc_crc32() {
+    /usr/bin/env python3 -c "import zlib; print('0x%08x' % zlib.crc32(open('$1', 'rb').read()))"
+}
+
+# Compresses the file into an LZ4 frame the flashapp can decode in place at
+# the end of a buffer. Prints its size, or 0 if it doesn't pay off or the
+# lz4 python module is missing.
+# $1: file
+# $2: output file
+# $3: buffer size
+function compress_lz4() {
+    /usr/bin/env python3 - "$1" "$2" "$3" <<'EOF'
+import sys
+try:
+    import lz4.frame as lz4
+except ImportError:
+    print(0)
+    sys.exit()
+data = open(sys.argv[1], "rb").read()
+frame = lz4.compress(data, compression_level=9, block_size=lz4.BLOCKSIZE_MAX1MB,
+                     block_linked=False, store_size=True)
+# Must match the room flashapp.c needs for decoding in place
+if len(frame) >= len(data) or len(data) + len(frame) // 256 + 64 > int(sys.argv[3]):
+    print(0)
+    sys.exit()
+open(sys.argv[2], "wb").write(frame)
+print(len(frame))
+EOF
+}
+
 function calc_sha256sum() {
     SHA256SUM=${SHA256SUM:-$(which sha256sum || true)}
     OPENSSL=${OPENSSL:-$(which openssl || true)}
@@ -66,6 +116,42 @@ function read_word() {
     ${OPENOCD} -f ${DIR}/interface_${ADAPTER}.cfg -c "init; mdw $1" -c "exit;" 2>&1 | grep $1 | cut -d" " -f2
 }
 
+# $1: address
+# $2: offset
+function offset_address() {
+    printf '0x%08x' $(( $1 + $2 ))
+}
+
+# Reads the status block and the ready flag of a job with one openocd run.
+# $1: address of the job
+# Sets STATE_REG, STATUS_REG, CHUNK_REG and READY_REG
+function read_status() {
+    local OUTPUT
+    OUTPUT=$(${OPENOCD} -f ${DIR}/interface_${ADAPTER}.cfg -c "init; mdw ${VAR_flashapp_comm} 3; mdw $1" -c "exit;" 2>&1)
+    read -r STATE_REG STATUS_REG CHUNK_REG <<< "$(echo "${OUTPUT}" | grep ${VAR_flashapp_comm} | cut -d" " -f2-4)"
+    READY_REG=$(echo "${OUTPUT}" | grep $1 | cut -d" " -f2)
+}
+
+function report_error() {
+    CHUNK=$(( 16#${CHUNK_REG} ))
+    if [[ "$STATUS_REG" == "$STATUS_BAD_HASH_RAM" ]]; then
+        echo_red "Hash mismatch in RAM in chunk ${CHUNK}. Flashing failed."
+        exit 3
+    elif [[ "$STATUS_REG" == "$STATUS_BAD_HAS_FLASH" ]]; then
+        echo_red "Hash mismatch in FLASH in chunk ${CHUNK}. Flashing failed."
+        exit 3
+    elif [[ "$STATUS_REG" == "$STATUS_NOT_ALIGNED" ]]; then
+        echo_red "Address not 4k aligned in chunk ${CHUNK}. Flashing failed."
+        exit 4
+    elif [[ "$STATUS_REG" == "$STATUS_BAD_COMPRESSION" ]]; then
+        echo_red "Bad compressed data in chunk ${CHUNK}. Flashing failed."
+        exit 3
+    else
+        echo_red "Unknown error in chunk ${CHUNK}. Flashing failed. Status: $STATUS_REG"
+        exit 5
+    fi
+}
+
 function state_to_string() {
     if   [[ "$1" == "00000000" ]]; then echo "FLASHAPP_INIT"
     elif [[ "$1" == "00000001" ]]; then echo "FLASHAPP_IDLE"
@@ -82,6 +168,8 @@ function state_to_string() {
     elif [[ "$1" == "0000000c" ]]; then echo "FLASHAPP_TEST"
     elif [[ "$1" == "0000000d" ]]; then echo "FLASHAPP_FINAL"
     elif [[ "$1" == "0000000e" ]]; then echo "FLASHAPP_ERROR"
+    elif [[ "$1" == "0000000f" ]]; then echo "FLASHAPP_COMPARE_FLASH"
+    elif [[ "$1" == "00000010" ]]; then echo "FLASHAPP_DECOMPRESS"
     else echo "UNKNOWN"
     fi
 }
@@ -89,7 +177,7 @@ function state_to_string() {
 function wait_for_idle() {
     # Wait for the idle state
     while true; do
-        STATE_REG=$(read_word ${VAR_flashapp_state})
+        STATE_REG=$(read_word ${VAR_flashapp_comm})
         if [[ "$STATE_REG" == "$FLASHAPP_IDLE" ]]; then
             echo "Ready!"
             break;
@@ -101,14 +189,21 @@ function wait_for_idle() {
 }
 
 if [[ $# -lt 1 ]]; then
-    echo "Usage: flashapp.sh <binary to flash> [address in flash] [size] [erase=1] [erase_bytes=0] [chunk_idx] [chunk_count]"
+    echo "Usage: flashapp.sh <binary to flash> [address in flash] [size] [erase=1] [erase_bytes=0] [chunk_idx] [chunk_count] [skip_identical=0]"
     echo "       flashapp.sh --test"
     echo "Note! Destination address must be aligned to 256 bytes."
+    echo "Chunks but the last one are only queued, the next run loads its chunk while"
+    echo "the previous one is programmed. A single chunk may be up to 832kB, otherwise $(( BUFFER_SIZE / 1024 ))kB."
     echo "'address in flash': Where to program to. 0x000000 is the start of the flash. "
     echo "'size': Size of the binary to flash. Should be aligned to 256 bytes."
     echo "'erase': If '0', chip erase will be skipped. Default '1'."
     echo "'erase_bytes': Number of bytes to erase, all if '0'. Default '0'."
+    echo "'skip_identical': If '1', only the hash is sent first and the chunk is neither"
+    echo "                  erased nor programmed if the flash already holds it. Default '0'."
     echo "--test: Performs a erase/write/read test"
+    echo ""
+    echo "Set FLASHAPP_VERIFY_CRC32=1 to verify chunks with a CRC-32 instead of SHA-256."
+    echo "Chunks are sent LZ4 compressed if it makes them smaller, set FLASHAPP_COMPRESS=0 to disable it."
     exit
 fi
 
@@ -162,6 +257,11 @@ if [[ $# -gt 6 ]]; then
     CHUNK_COUNT=$7
 fi
 
+SKIP_IDENTICAL=0
+if [[ $# -gt 7 ]]; then
+    SKIP_IDENTICAL=$8
+fi
+
 HASH_HEX_FILE=$(mktemp /tmp/sha256_hash_hex.XXXXXX)
 if [[ ! -e "${HASH_HEX_FILE}" ]]; then
     echo "Can't create tempfile!"
@@ -175,8 +275,31 @@ if [[ ! -e "${HASH_FILE}" ]]; then
 fi
 dd if="${IMAGE}" of="${HASH_FILE}" bs=1 count=$(( SIZE )) 2> /dev/null
 calc_sha256sum "${HASH_FILE}" "${HASH_HEX_FILE}"
+EXPECTED_CRC32=0
+if [[ "${FLASHAPP_VERIFY_CRC32}" == "1" ]]; then
+    EXPECTED_CRC32=$(calc_crc32 "${HASH_FILE}")
+fi
+
+COMPRESSED_SIZE=0
+COMPRESSED_FILE=$(mktemp /tmp/flash_chunk_lz4.XXXXXX)
+if [[ ! -e "${COMPRESSED_FILE}" ]]; then
+    echo "Can't create tempfile!"
+    exit 1
+fi
+if [[ "${FLASHAPP_COMPRESS}" == "1" ]]; then
+    COMPRESSED_SIZE=$(compress_lz4 "${HASH_FILE}" "${COMPRESSED_FILE}" ${BUFFER_SIZE})
+fi
 rm -f "${HASH_FILE}"
 
+if [[ ${CHUNK_COUNT} -gt 1 && ${SIZE} -gt ${BUFFER_SIZE} ]]; then
+    echo_red "Chunks can't be larger than ${BUFFER_SIZE} bytes."
+    exit 1
+fi
+
+BUFFER=$(( (CHUNK_IDX - 1) % BUFFER_COUNT ))
+VAR_buffer=$(offset_address ${VAR_framebuffer2} $(( BUFFER * BUFFER_SIZE )))
+VAR_job=$(offset_address ${VAR_program_jobs} $(( BUFFER * JOB_SIZE )))
+
 if [[ ${CHUNK_IDX} -eq "1" ]]; then
     ${OPENOCD} -f ${DIR}/interface_${ADAPTER}.cfg \
         -c "init; reset halt;" \
@@ -185,62 +308,114 @@ if [[ ${CHUNK_IDX} -eq "1" ]]; then
         -c 'reg msp $MSP' \
         -c 'reg pc $PC' \
         -c "mww ${VAR_boot_magic} ${BOOT_MAGIC_FLASHAPP}" \
-        -c "mww ${VAR_program_chunk_idx} ${CHUNK_IDX}" \
-        -c "mww ${VAR_program_chunk_count} ${CHUNK_COUNT}" \
         -c "echo \"Starting flash app\";" \
         -c "resume;" \
         -c "exit;"
+
+    wait_for_idle
 fi
 
-wait_for_idle
+# Wait until the chunk that was in this buffer is programmed
+while true; do
+    read_status ${VAR_job}
+    if [[ "$STATE_REG" == "$FLASHAPP_ERROR" ]]; then
+        report_error
+    elif [[ "$READY_REG" == "00000000" ]]; then
+        break
+    fi
+    echo "State: $(state_to_string $STATE_REG), waiting for buffer $BUFFER"
+    sleep 1
+done
+
+function wait_for_final() {
+    echo "Please see the LCD for interactive status."
 
-echo "Loading data"
+    # Wait for the final or error state
+    while true; do
+        read_status ${VAR_job}
+        if [[ "$STATE_REG" == "$FLASHAPP_FINAL" ]]; then
+            echo_green "Done!"
+            exit 0
+        elif [[ "$STATE_REG" == "$FLASHAPP_ERROR" ]]; then
+            report_error
+        else
+            echo "State: $(state_to_string $STATE_REG)"
+        fi
+        sleep 1
+    done
+}
+
+if [[ ${SKIP_IDENTICAL} -eq 1 ]]; then
+    # Only send the hash, the target compares it with what is in the flash
     ${OPENOCD} -f ${DIR}/interface_${ADAPTER}.cfg \
-    -c "init; halt;" \
+        -c "init;" \
+        -c "mww $(offset_address ${VAR_job} ${JOB_SIZE_OFFSET}) ${SIZE}" \
+        -c "mww $(offset_address ${VAR_job} ${JOB_ADDRESS}) ${ADDRESS}" \
+        -c "mww $(offset_address ${VAR_job} ${JOB_CHUNK_IDX}) ${CHUNK_IDX}" \
+        -c "mww $(offset_address ${VAR_job} ${JOB_COMPARE}) ${COMPARE_REQUESTED}" \
+        -c "load_image ${HASH_HEX_FILE} $(offset_address ${VAR_job} ${JOB_EXPECTED_SHA256});" \
+        -c "mww $(offset_address ${VAR_flashapp_comm} ${COMM_CHUNK_COUNT}) ${CHUNK_COUNT}" \
+        -c "mww $(offset_address ${VAR_job} ${JOB_READY}) 1" \
+        -c "exit;"
+
+    while true; do
+        read_status ${VAR_job}
+        if [[ "$STATE_REG" == "$FLASHAPP_ERROR" ]]; then
+            report_error
+        elif [[ "$READY_REG" == "00000000" ]]; then
+            break
+        fi
+        echo "State: $(state_to_string $STATE_REG), comparing chunk ${CHUNK_IDX}"
+        sleep 1
+    done
+
+    if [[ "$(read_word $(offset_address ${VAR_job} ${JOB_COMPARE}))" == "$COMPARE_IDENTICAL" ]]; then
+        rm -f "${HASH_HEX_FILE}" "${COMPRESSED_FILE}"
+        echo_green "Chunk ${CHUNK_IDX} is identical, skipped!"
+        if [[ ${CHUNK_IDX} -lt ${CHUNK_COUNT} ]]; then
+            exit 0
+        fi
+        wait_for_final
+    fi
+fi
+
+if [[ ${COMPRESSED_SIZE} -ne 0 ]]; then
+    # Decoded in place by the target, from the end of the buffer
+    echo "Compressed ${SIZE} bytes to ${COMPRESSED_SIZE} bytes"
+    LOAD_FILE=${COMPRESSED_FILE}
+    LOAD_ADDRESS=$(offset_address ${VAR_buffer} $(( BUFFER_SIZE - COMPRESSED_SIZE )))
+else
+    LOAD_FILE=${IMAGE}
+    LOAD_ADDRESS=${VAR_buffer}
+fi
+
+# The target keeps running, it may be programming the other buffer
+echo "Loading data"
+${OPENOCD} -f ${DIR}/interface_${ADAPTER}.cfg \
+    -c "init;" \
     -c "echo \"Loading image into RAM\";" \
-    -c "load_image ${IMAGE} ${VAR_framebuffer2};" \
-    -c "mww ${VAR_program_size} ${SIZE}" \
-    -c "mww ${VAR_program_address} ${ADDRESS}" \
-    -c "mww ${VAR_program_erase} ${ERASE}" \
-    -c "mww ${VAR_program_erase_bytes} ${ERASE_BYTES}" \
-    -c "mww ${VAR_program_chunk_idx} ${CHUNK_IDX}" \
-    -c "mww ${VAR_program_chunk_count} ${CHUNK_COUNT}" \
-    -c "load_image ${HASH_HEX_FILE} ${VAR_program_expected_sha256};" \
+    -c "load_image ${LOAD_FILE} ${LOAD_ADDRESS};" \
+    -c "mww $(offset_address ${VAR_job} ${JOB_SIZE_OFFSET}) ${SIZE}" \
+    -c "mww $(offset_address ${VAR_job} ${JOB_ADDRESS}) ${ADDRESS}" \
+    -c "mww $(offset_address ${VAR_job} ${JOB_ERASE}) ${ERASE}" \
+    -c "mww $(offset_address ${VAR_job} ${JOB_ERASE_BYTES}) ${ERASE_BYTES}" \
+    -c "mww $(offset_address ${VAR_job} ${JOB_CHUNK_IDX}) ${CHUNK_IDX}" \
+    -c "mww $(offset_address ${VAR_job} ${JOB_COMPARE}) 0" \
+    -c "mww $(offset_address ${VAR_job} ${JOB_VERIFY_CRC32}) ${FLASHAPP_VERIFY_CRC32}" \
+    -c "mww $(offset_address ${VAR_job} ${JOB_EXPECTED_CRC32}) ${EXPECTED_CRC32}" \
+    -c "mww $(offset_address ${VAR_job} ${JOB_COMPRESSED_SIZE}) ${COMPRESSED_SIZE}" \
+    -c "load_image ${HASH_HEX_FILE} $(offset_address ${VAR_job} ${JOB_EXPECTED_SHA256});" \
+    -c "mww $(offset_address ${VAR_flashapp_comm} ${COMM_CHUNK_COUNT}) ${CHUNK_COUNT}" \
     -c "echo \"Starting flash process\";" \
-    -c "mww ${VAR_program_start} 1" \
-    -c "resume; exit;"
+    -c "mww $(offset_address ${VAR_job} ${JOB_READY}) 1" \
+    -c "exit;"
 
 # Remove the temporary hash files
-rm -f "${HASH_HEX_FILE}"
+rm -f "${HASH_HEX_FILE}" "${COMPRESSED_FILE}"
 
-echo "Please see the LCD for interactive status."
+if [[ ${CHUNK_IDX} -lt ${CHUNK_COUNT} ]]; then
+    echo_green "Chunk ${CHUNK_IDX} queued, more chunks left!"
+    exit 0
+fi
 
-# Wait for the final or error state
-while true; do
-    STATE_REG=$(read_word ${VAR_flashapp_state})
-    if [[ "$STATE_REG" == "$FLASHAPP_FINAL" ]]; then
-        echo_green "Done!"
-        exit 0
-    elif [[ "$STATE_REG" == "$FLASHAPP_IDLE" ]]; then
-        echo_green "Done, more chunks left!"
-        exit 0
-    elif [[ "$STATE_REG" == "$FLASHAPP_ERROR" ]]; then
-        STATUS_REG=$(read_word ${VAR_program_status})
-        if [[ "$STATUS_REG" == "$STATUS_BAD_HASH_RAM" ]]; then
-            echo_red "Hash mismatch in RAM. Flashing failed."
-            exit 3
-        elif [[ "$STATUS_REG" == "$STATUS_BAD_HAS_FLASH" ]]; then
-            echo_red "Hash mismatch in FLASH. Flashing failed."
-            exit 3
-        elif [[ "$STATUS_REG" == "$STATUS_NOT_ALIGNED" ]]; then
-            echo_red "Address not 4k aligned. Flashing failed."
-            exit 4
-        else
-            echo_red "Unknown error. Flashing failed. Status: $STATUS_REG"
-            exit 5
-        fi
-    else
-        echo "State: $(state_to_string $STATE_REG)"
-    fi
-    sleep 1
-done
+wait_for_final
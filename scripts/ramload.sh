@@ -0,0 +1,77 @@
+#!/bin/bash
+
+. ./scripts/common.sh
+
+if [[ $# -lt 1 ]]; then
+    echo "Usage: $(basename $0) <rom file> [system extension]"
+    echo "Starts the ROM from RAM, without writing it to the external flash."
+    echo "The launcher must be running. The extension is the one of the system"
+    echo "in roms/, e.g. nes or sms, and defaults to that of the file."
+    exit 1
+fi
+
+DIR="$( cd "$( dirname "${BASH_SOURCE[0]}" )" >/dev/null 2>&1 && pwd )"
+ELF=${ELF:-${DIR}/../build/gw_retro_go.elf}
+
+ROM="$1"
+FILENAME=$(basename "$ROM")
+EXT=${2:-${FILENAME##*.}}
+NAME=${FILENAME%.*}
+
+# Must match ram_loader.h
+RAM_LOADER_MAGIC=0x4d4f5252
+RAM_LOADER_READY=1
+STATE_STARTED="00000002"
+STATE_BAD_ADDRESS="00000003"
+STATE_BAD_CRC="00000004"
+STATE_BAD_SYSTEM="00000005"
+
+VAR_ram_loader_comm=$(printf '0x%08x\n' $(get_symbol "ram_loader_comm"))
+RAM_EMU_END=$(get_symbol "__RAM_EMU_END__")
+
+SIZE=$(stat -c %s "$ROM" 2>/dev/null || stat -f %z "$ROM")
+# At the top of RAM_EMU, on a 4kB boundary
+ADDRESS=$(printf '0x%08x' $(( (RAM_EMU_END - SIZE) & ~0xfff )))
+
+COMM_FILE=$(mktemp /tmp/retro_go_ramload.XXXXXX)
+if [[ ! -e "${COMM_FILE}" ]]; then
+    echo "Can't create tempfile!"
+    exit 1
+fi
+
+/usr/bin/env python3 - "$ROM" "$COMM_FILE" "$ADDRESS" "$EXT" "$NAME" <<PYEOF
+import struct, sys, zlib
+rom, out, address, ext, name = sys.argv[1:]
+data = open(rom, "rb").read()
+open(out, "wb").write(struct.pack("<5I8s32s", $RAM_LOADER_MAGIC, $RAM_LOADER_READY, int(address, 16),
+                                  len(data), zlib.crc32(data), ext.encode()[:7], name.encode()[:31]))
+PYEOF
+
+echo "Loading ${NAME}.${EXT} (${SIZE} bytes) at ${ADDRESS}"
+${OPENOCD} -f ${DIR}/interface_${ADAPTER}.cfg \
+    -c "init; halt; load_image ${ROM} ${ADDRESS} bin; load_image ${COMM_FILE} ${VAR_ram_loader_comm} bin; resume; exit;" \
+    > /dev/null 2>&1
+
+rm -f "${COMM_FILE}"
+
+# The launcher looks for it every few seconds
+for i in $(seq 10); do
+    sleep 1
+    STATE_REG=$(${OPENOCD} -f ${DIR}/interface_${ADAPTER}.cfg -c "init; mdw $(printf '0x%08x' $(( VAR_ram_loader_comm + 4 )))" -c "exit;" 2>&1 | grep -i "0x" | tail -n 1 | cut -d" " -f2)
+    if [[ "$STATE_REG" == "$STATE_STARTED" ]]; then
+        echo_green "Started."
+        exit 0
+    elif [[ "$STATE_REG" == "$STATE_BAD_ADDRESS" ]]; then
+        echo_red "The ROM doesn't fit in RAM_EMU."
+        exit 3
+    elif [[ "$STATE_REG" == "$STATE_BAD_CRC" ]]; then
+        echo_red "CRC mismatch of the ROM in RAM."
+        exit 3
+    elif [[ "$STATE_REG" == "$STATE_BAD_SYSTEM" ]]; then
+        echo_red "No system for '${EXT}' in this build, or it can't be loaded from RAM."
+        exit 4
+    fi
+done
+
+echo_red "The launcher didn't pick it up, is it running?"
+exit 5
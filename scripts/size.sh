@@ -55,3 +55,12 @@ print_usage flash    __FLASH_LENGTH__
 print_usage extflash __EXTFLASH_LENGTH__
 print_usage saveflash __SAVEFLASH_LENGTH__
 print_usage fbflash __FBFLASH_LENGTH__
+
+# What each emulator can get from emu_arena.c at runtime
+ahb_free=$(( $(get_symbol __AHBRAM_LENGTH__) - $(get_section_length ahbram) ))
+ram_emu_length=$(get_symbol __RAM_EMU_LENGTH__)
+echo -e "\narena free\tdtcram\tram_emu\tahbram"
+for emu in nes gb sms pce gw; do
+	ram_emu_free=$(( $ram_emu_length - $(get_section_length ram_emu_$emu) ))
+	echo -e "$emu\t\t$dtc_free\t$ram_emu_free\t$ahb_free"
+done
@@ -0,0 +1,86 @@
+#!/usr/bin/env python3
+"""Writes the compressed payloads of the launcher's codec benchmark.
+
+The payload itself is made on the device by benchmark_payload() in
+Core/Src/retro-go/rg_benchmark.c, this makes the same bytes, compresses them
+the way parse_roms.py compresses ROMs and writes the result to
+Core/Src/retro-go/rg_benchmark_payload.c. Only needs to be run again if the
+payload or a codec's settings change.
+"""
+
+import lzma
+import zlib
+from pathlib import Path
+
+# Must match rg_benchmark.h and benchmark_payload()
+PAYLOAD_SIZE = 8192
+WORDS = [
+    b"the ", b"game ", b"and ", b"watch ", b"retro ", b"go ", b"frame ", b"blit ",
+    b"flash ", b"audio ", b"sprite ", b"tile ", b"bank ", b"cpu ", b"palette ", b"scanline ",
+]
+
+
+def payload(size):
+    x = 1
+    out = bytearray()
+    while len(out) < size:
+        # xorshift32
+        x ^= (x << 13) & 0xFFFFFFFF
+        x ^= x >> 17
+        x ^= (x << 5) & 0xFFFFFFFF
+        out += WORDS[x & 15]
+    return bytes(out[:size])
+
+
+def compress_deflate(data):
+    # Raw deflate like compress_zopfli() in parse_roms.py
+    compressor = zlib.compressobj(level=9, method=zlib.DEFLATED, wbits=-15)
+    return compressor.compress(data) + compressor.flush()
+
+
+def compress_lzma(data):
+    # Same as compress_lzma() in parse_roms.py
+    return lzma.compress(
+        data,
+        format=lzma.FORMAT_ALONE,
+        filters=[
+            {
+                "id": lzma.FILTER_LZMA1,
+                "preset": 6,
+                "dict_size": 16 * 1024,
+                "lc": 3,
+                "lp": 0,
+                "pb": 2,
+            }
+        ],
+    )[13:]
+
+
+def c_array(name, data):
+    lines = [f"const uint8_t {name}[] = {{"]
+    for i in range(0, len(data), 16):
+        lines.append("    " + " ".join(f"0x{b:02x}," for b in data[i : i + 16]))
+    lines.append("};")
+    lines.append(f"const uint32_t {name}_size = sizeof({name});")
+    return "\n".join(lines)
+
+
+def main():
+    data = payload(PAYLOAD_SIZE)
+    source = [
+        "// Generated by tools/benchmark_payload.py, don't edit",
+        "",
+        "#include <stdint.h>",
+        "",
+        '#include "rg_benchmark.h"',
+        "",
+        c_array("benchmark_payload_deflate", compress_deflate(data)),
+        "",
+        c_array("benchmark_payload_lzma", compress_lzma(data)),
+        "",
+    ]
+    Path("Core/Src/retro-go/rg_benchmark_payload.c").write_text("\n".join(source))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,320 @@
+#!/usr/bin/env python3
+"""Picks the variables of an emulator core to place in DTCM.
+
+The D-cache is 16 kB, the state an emulator touches for every emulated
+instruction had better not compete with the frames and ROM banks for it.
+This lists the data of a core with its size, the memory region it's in
+and how hot it is, then proposes the hottest bytes for the free DTCM and
+with --write puts them into dtcm/<core>.txt, which the Makefile turns
+into a linker script fragment.
+
+Hotness needs a build with PC_SAMPLER=1 running a game of the core, see
+Core/Inc/porting/pc_sample.h. The samples of each function are shared
+among the variables it takes the address of, through its literal pool or
+a MOVW/MOVT pair. That's no data access sampler, a function that only
+passes a pointer on counts too, but it ranks the state of the CPU loops
+first. With --static the target isn't needed and only sizes are known.
+
+The regions come from the "Memory Configuration" of the map file, i.e.
+from STM32H7B0VBTx_FLASH.ld. Only .bss of the core's own objects can be
+moved, the fragment takes input sections of build/<core>/*.o. Functions
+are placed in ITCRAM by tools/itcram_profile.py instead. Buffers the
+DMA2D or the SAI read can't live in DTCM, leave them out with --exclude.
+
+    python3 tools/dtcm_profile.py --core gnuboy --seconds 10
+    python3 tools/dtcm_profile.py --core gnuboy --seconds 10 --write
+"""
+
+import argparse
+import bisect
+import re
+import struct
+from collections import Counter
+from pathlib import Path
+from time import sleep
+
+from elftools.elf.elffile import ELFFile
+from itcram_profile import CORES, get_functions, get_symbol_value
+from openocd import OpenOCD
+from pcprof import PC_SAMPLE_BINS, code_sections, read_histogram
+
+# Name of the core's DTCM section size symbol, see the linker script
+DTCM_SIZES = {
+    "nes": "_DTCM_EMU_NES_SIZE",
+    "gnuboy": "_DTCM_EMU_GB_SIZE",
+    "smsplusgx": "_DTCM_EMU_SMS_SIZE",
+    "pce": "_DTCM_EMU_PCE_SIZE",
+    "gw": "_DTCM_EMU_GW_SIZE",
+}
+
+# Room for the alignment of each variable
+ALIGN_SLACK = 8
+
+
+def read_regions(map_text):
+    """(name, origin, length) of the MEMORY regions of the map file."""
+    regions = []
+    table = map_text.split("Memory Configuration", 1)[1].split("Linker script and memory map", 1)[0]
+    for m in re.finditer(r"^(\w+)\s+0x([0-9a-f]+)\s+0x([0-9a-f]+)", table, re.M):
+        if m.group(1) != "Name" and int(m.group(3), 16):
+            regions.append((m.group(1), int(m.group(2), 16), int(m.group(3), 16)))
+    return regions
+
+
+def region_of(regions, address):
+    for name, origin, length in regions:
+        if origin <= address < origin + length:
+            return name
+    return "?"
+
+
+def read_input_sections(map_text, core):
+    """(start, end, kind) of the data input sections of build/<core>/*.o.
+
+    kind is "bss" or "data" for the .bss.<name> and .data.<name> sections of
+    -fdata-sections, "dtcm_emu" for the variables tagged DTCM_EMU_ATTR.
+    """
+    sections = []
+    # ld puts the address and size of a long section name on the next line
+    map_text = re.sub(r"^( \.\S+)\n\s+(?=0x)", r"\1 ", map_text, flags=re.M)
+    pattern = (
+        rf"^ \.(bss|data|dtcm_emu)(?:\.\S+)?\s+0x([0-9a-f]+)\s+0x([0-9a-f]+)"
+        rf"\s+build/{core}/\S+\.o$"
+    )
+    for m in re.finditer(pattern, map_text, re.M):
+        start = int(m.group(2), 16)
+        size = int(m.group(3), 16)
+        if size:
+            sections.append((start, start + size, m.group(1)))
+    return sorted(sections)
+
+
+def get_variables(elffile, sections):
+    """Sorted (start, end, name, kind) of the data objects in the sections.
+
+    The cores share the addresses of their overlays, a symbol of another
+    core may be at the same address but won't be in a section of this one.
+    """
+    starts = [s[0] for s in sections]
+    variables = []
+    for symbol in elffile.get_section_by_name(".symtab").iter_symbols():
+        if symbol.entry.st_info.type != "STT_OBJECT" or symbol.entry.st_size == 0:
+            continue
+        start = symbol.entry.st_value
+        end = start + symbol.entry.st_size
+        i = bisect.bisect_right(starts, start) - 1
+        if i < 0 or end > sections[i][1]:
+            continue
+        # .bss.<name> holds the one variable, anything else is another core's
+        kind = sections[i][2]
+        if kind != "dtcm_emu" and (start, end) != sections[i][:2]:
+            continue
+        variables.append((start, end, symbol.name, kind))
+    return sorted(set(variables))
+
+
+def function_code(elffile, start, end):
+    for section in elffile.iter_sections():
+        lo = section["sh_addr"]
+        if section["sh_type"] == "SHT_PROGBITS" and lo <= start and end <= lo + section["sh_size"]:
+            return section.data()[start - lo : end - lo]
+    return b""
+
+
+def referenced_addresses(code, start):
+    """Addresses in the literal pool and loaded by MOVW/MOVT of a function."""
+    addresses = set()
+
+    # Literal pools are word aligned, whatever else looks like an address
+    # of a variable is rare enough
+    for offset in range(-start % 4, len(code) - 3, 4):
+        addresses.add(struct.unpack_from("<I", code, offset)[0])
+
+    movw = {}
+    for offset in range(0, len(code) - 3, 2):
+        hw1, hw2 = struct.unpack_from("<HH", code, offset)
+        if hw1 & 0xFBF0 not in (0xF240, 0xF2C0) or hw2 & 0x8000:
+            continue
+        imm16 = (hw1 & 0xF) << 12 | (hw1 >> 10 & 1) << 11 | (hw2 >> 12 & 7) << 8 | (hw2 & 0xFF)
+        rd = hw2 >> 8 & 0xF
+        if hw1 & 0xFBF0 == 0xF240:
+            movw[rd] = imm16
+        elif rd in movw:
+            addresses.add(imm16 << 16 | movw.pop(rd))
+
+    return addresses
+
+
+def sample_counts(args, elffile, functions):
+    bins_addr = get_symbol_value(elffile, "pc_sample_bins")
+    total_addr = get_symbol_value(elffile, "pc_sample_total")
+
+    with OpenOCD(host=args.host, port=args.port) as ocd:
+        # Halted so the interrupt doesn't count into a half cleared table
+        ocd.send("halt")
+        ocd.send(f"mww {bins_addr:#x} 0 {2 * PC_SAMPLE_BINS}")
+        ocd.send(f"mww {total_addr:#x} 0")
+        ocd.send("resume")
+        sleep(args.seconds)
+
+        ocd.send("halt")
+        histogram = read_histogram(ocd, bins_addr)
+        total = ocd.read_memory(32, total_addr, 1)[0]
+        ocd.send("resume")
+
+    starts = [f[0] for f in functions]
+    counts = Counter()
+    for pc, count in histogram:
+        i = bisect.bisect_right(starts, pc) - 1
+        if i >= 0 and pc < functions[i][1]:
+            counts[i] += count
+
+    return counts, total
+
+
+def attribute(elffile, functions, counts, variables):
+    """The samples of each function shared among the variables it references."""
+    starts = [v[0] for v in variables]
+    heat = Counter()
+
+    for i, count in counts.items():
+        start, end, _ = functions[i]
+        referenced = set()
+        for address in referenced_addresses(function_code(elffile, start, end), start):
+            j = bisect.bisect_right(starts, address) - 1
+            if j >= 0 and address < variables[j][1]:
+                referenced.add(j)
+        for j in referenced:
+            heat[j] += count / len(referenced)
+
+    return heat
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--core", choices=CORES.keys(), required=True)
+    parser.add_argument(
+        "--elf",
+        type=str,
+        default="build/gw_retro_go.elf",
+        help="Game and Watch Retro-Go ELF file, the map file is next to it",
+    )
+    parser.add_argument(
+        "--static",
+        action="store_true",
+        help="Don't sample the target, only list the largest variables",
+    )
+    parser.add_argument(
+        "--seconds", type=float, default=5, help="How long to let the target run"
+    )
+    parser.add_argument(
+        "--budget",
+        type=int,
+        default=None,
+        help="DTCM bytes to fill (default: the DTCM section of the largest core, "
+        "which is reserved anyway)",
+    )
+    parser.add_argument(
+        "--exclude",
+        action="append",
+        default=[],
+        help="Variable to keep out of DTCM, e.g. a buffer the DMA reads",
+    )
+    parser.add_argument(
+        "--write", action="store_true", help="Write the proposal to dtcm/<core>.txt"
+    )
+    parser.add_argument(
+        "--top", type=int, default=20, help="Number of variables to print"
+    )
+    parser.add_argument(
+        "--host",
+        type=str,
+        default="127.0.0.1",
+        help="OpenOCD TCL hostname",
+    )
+    parser.add_argument(
+        "--port",
+        type=int,
+        default=6666,
+        help="OpenOCD TCL port",
+    )
+    args = parser.parse_args()
+
+    if args.static and args.write:
+        parser.error("--write needs the samples of the target")
+
+    map_text = Path(args.elf).with_suffix(".map").read_text()
+    regions = read_regions(map_text)
+
+    with open(args.elf, "rb") as f:
+        elffile = ELFFile(f)
+        variables = get_variables(elffile, read_input_sections(map_text, args.core))
+        budget = args.budget
+        if budget is None:
+            budget = max(get_symbol_value(elffile, size) for size in DTCM_SIZES.values())
+        dtcm_free = get_symbol_value(elffile, "__dtc_padding_end__") - get_symbol_value(
+            elffile, "__dtc_padding_start__"
+        )
+
+        heat = Counter()
+        total = 0
+        if not args.static:
+            functions = get_functions(elffile, code_sections(elffile, args.core))
+            counts, total = sample_counts(args, elffile, functions)
+            heat = attribute(elffile, functions, counts, variables)
+
+    print("Regions:")
+    for name, origin, length in regions:
+        print(f"  {name:<12} {origin:#010x} {length // 1024:6} kB")
+    print()
+
+    notes = {"bss": "", "data": "  (initialized, stays)", "dtcm_emu": "  (DTCM_EMU_ATTR)"}
+
+    def show(title, order):
+        print(title)
+        print(f"{'bytes':>8} {'%':>6} {'region':<10} variable")
+        for j in order[: args.top]:
+            start, end, name, kind = variables[j]
+            share = 100 * heat[j] / total if total else 0
+            print(f"{end - start:8} {share:6.2f} {region_of(regions, start):<10} {name}{notes[kind]}")
+        print()
+
+    indices = range(len(variables))
+    show("Largest:", sorted(indices, key=lambda j: variables[j][0] - variables[j][1]))
+    if args.static:
+        return
+    print(f"{total} samples")
+    show("Hottest:", sorted((j for j in indices if heat[j]), key=lambda j: -heat[j]))
+
+    # Hottest bytes first, the DTCM_EMU_ATTR ones are there anyway
+    used = sum(v[1] - v[0] + ALIGN_SLACK for v in variables if v[3] == "dtcm_emu")
+    candidates = [
+        j
+        for j in indices
+        if heat[j] and variables[j][3] == "bss" and variables[j][2] not in args.exclude
+    ]
+    candidates.sort(key=lambda j: -heat[j] / (variables[j][1] - variables[j][0]))
+
+    lines = [
+        f"# Variables of the {args.core} core placed in DTCM, see DTCM_EMU_ATTR in porting.h.",
+        "# Only zero-initialized ones (.bss), they aren't loaded.",
+        f"# Regenerate with: tools/dtcm_profile.py --core {args.core}",
+    ]
+    for j in candidates:
+        start, end, name, _ = variables[j]
+        size = end - start + ALIGN_SLACK
+        if used + size > budget:
+            continue
+        used += size
+        lines.append(f"{name:<32} # {100 * heat[j] / total:5.1f}%, {end - start} bytes")
+
+    print(f"Proposed for DTCM, {used} / {budget} bytes ({dtcm_free} bytes of DTCM arena left):")
+    for line in lines[3:]:
+        print(f"  {line}")
+
+    if args.write:
+        Path(f"dtcm/{args.core}.txt").write_text("\n".join(lines) + "\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,452 @@
+#!/usr/bin/env python3
+
+"""Programs the external flash through the flashapp with a single OpenOCD session.
+
+Does the same as scripts/flash_multi.sh and scripts/flashapp.sh, but keeps
+one connection to the OpenOCD TCL server instead of starting OpenOCD for
+every step. See flashapp.c for the protocol.
+"""
+
+import argparse
+import hashlib
+import os
+import subprocess
+import sys
+import tempfile
+import threading
+import time
+import zlib
+from pathlib import Path
+from time import sleep
+
+from elftools.elf.elffile import ELFFile
+from openocd import OpenOCD
+
+BOOT_MAGIC_FLASHAPP = 0xF1A5F1A5
+
+FLASHAPP_IDLE = 0x01
+FLASHAPP_FINAL = 0x0D
+FLASHAPP_ERROR = 0x0E
+
+STATUS_MESSAGES = {
+    0xBAD00001: ("Hash mismatch in RAM", 3),
+    0xBAD00002: ("Hash mismatch in FLASH", 3),
+    0xBAD00003: ("Address not 4k aligned", 4),
+    0xBAD00004: ("Bad compressed data", 3),
+}
+
+COMPARE_REQUESTED = 1
+COMPARE_IDENTICAL = 2
+
+# Must match flashapp.c
+BUFFER_COUNT = 2
+BUFFER_SIZE = 416 * 1024
+SECTOR_SIZE = 4 * 1024
+
+# Offsets in flashapp_job_t
+JOB_SIZE = 108
+JOB_READY = 0
+JOB_DATA_SIZE = 4
+JOB_ADDRESS = 8
+JOB_ERASE = 12
+JOB_ERASE_BYTES = 16
+JOB_CHUNK_IDX = 20
+JOB_EXPECTED_SHA256 = 24
+JOB_COMPARE = 92
+JOB_VERIFY_CRC32 = 96
+JOB_EXPECTED_CRC32 = 100
+JOB_COMPRESSED_SIZE = 104
+
+# Offsets in flashapp_comm_t
+COMM_CHUNK_COUNT = 12
+
+# USB product IDs of the ST-LINK/V2, V2-1 and V3 variants
+STLINK_VENDOR_ID = "0483"
+STLINK_PRODUCT_IDS = ("3748", "374b", "374d", "374e", "374f", "3752", "3753")
+
+
+class FlashappError(Exception):
+    def __init__(self, message, code):
+        super().__init__(message)
+        self.code = code
+
+
+def get_symbol_by_symbol_name(elffile, symbol_name):
+    return elffile.get_section_by_name(".symtab").get_symbol_by_name(symbol_name)[0]
+
+
+def compress_lz4(data):
+    """LZ4 frame that the flashapp can decode in place, None if it doesn't pay off."""
+    try:
+        import lz4.frame as lz4
+    except ImportError:
+        return None
+
+    frame = lz4.compress(
+        data,
+        compression_level=9,
+        block_size=lz4.BLOCKSIZE_MAX1MB,
+        block_linked=False,
+        store_size=True,
+    )
+    # Must match the room flashapp.c needs for decoding in place
+    if len(frame) >= len(data) or len(data) + len(frame) // 256 + 64 > BUFFER_SIZE:
+        return None
+    return frame
+
+
+def find_stlinks():
+    """Serial numbers of the connected ST-LINK adapters, from sysfs (Linux only)."""
+    serials = []
+    for device in sorted(Path("/sys/bus/usb/devices").glob("*")):
+        try:
+            vendor = (device / "idVendor").read_text().strip()
+            product = (device / "idProduct").read_text().strip()
+            serial = (device / "serial").read_text().strip()
+        except OSError:
+            continue
+        if vendor == STLINK_VENDOR_ID and product in STLINK_PRODUCT_IDS:
+            serials.append(serial)
+    return serials
+
+
+class Flashapp:
+    def __init__(self, ocd, elf, args, name=None):
+        self.ocd = ocd
+        self.args = args
+        self.name = name
+        self.tmpdir = tempfile.TemporaryDirectory()
+
+        with open(elf, "rb") as f:
+            elffile = ELFFile(f)
+            self.boot_magic = get_symbol_by_symbol_name(elffile, "boot_magic").entry.st_value
+            self.framebuffer2 = get_symbol_by_symbol_name(elffile, "framebuffer2").entry.st_value
+            self.comm = get_symbol_by_symbol_name(elffile, "flashapp_comm").entry.st_value
+            self.jobs = get_symbol_by_symbol_name(elffile, "program_jobs").entry.st_value
+
+    def log(self, message):
+        if self.name is not None:
+            message = "[%s] %s" % (self.name, message)
+        print(message, flush=True)
+
+    def write_word(self, address, value):
+        self.ocd.send("mww 0x%x 0x%x" % (address, value))
+
+    def write_bytes(self, address, data):
+        path = Path(self.tmpdir.name) / "data.bin"
+        path.write_bytes(data)
+        self.ocd.send("load_image {%s} 0x%x bin" % (path, address))
+
+    def read_status(self, job):
+        """Returns the state, the status, the chunk index and whether the job is ready."""
+        state, status, chunk_idx = self.ocd.read_memory(32, self.comm, 3)
+        ready = self.ocd.read_memory(32, job + JOB_READY, 1)[0]
+        return state, status, chunk_idx, ready
+
+    def raise_error(self, status, chunk_idx):
+        message, code = STATUS_MESSAGES.get(status, ("Unknown error 0x%08x" % status, 5))
+        raise FlashappError("%s in chunk %d. Flashing failed." % (message, chunk_idx), code)
+
+    def start(self):
+        """Resets the target and starts the flashapp from the internal flash."""
+        intflash = 0x08100000 if self.args.intflash_bank == 2 else 0x08000000
+
+        self.ocd.send("reset halt")
+        msp, pc = self.ocd.read_memory(32, intflash, 2)
+        self.ocd.send("reg msp 0x%08x" % msp)
+        self.ocd.send("reg pc 0x%08x" % pc)
+        self.write_word(self.boot_magic, BOOT_MAGIC_FLASHAPP)
+        self.ocd.send("resume")
+
+        while self.ocd.read_memory(32, self.comm, 1)[0] != FLASHAPP_IDLE:
+            sleep(self.args.interval / 1000)
+
+    def wait_until_free(self, job):
+        while True:
+            state, status, chunk_idx, ready = self.read_status(job)
+            if state == FLASHAPP_ERROR:
+                self.raise_error(status, chunk_idx)
+            if not ready:
+                return
+            sleep(self.args.interval / 1000)
+
+    def wait_for_final(self, job):
+        while True:
+            state, status, chunk_idx, _ = self.read_status(job)
+            if state == FLASHAPP_FINAL:
+                return
+            if state == FLASHAPP_ERROR:
+                self.raise_error(status, chunk_idx)
+            sleep(self.args.interval / 1000)
+
+    def write_job(self, job, data, address, chunk_idx, chunk_count, erase, erase_bytes, compare):
+        self.write_word(job + JOB_DATA_SIZE, len(data))
+        self.write_word(job + JOB_ADDRESS, address)
+        self.write_word(job + JOB_ERASE, erase)
+        self.write_word(job + JOB_ERASE_BYTES, erase_bytes)
+        self.write_word(job + JOB_CHUNK_IDX, chunk_idx)
+        self.write_word(job + JOB_COMPARE, compare)
+        self.write_bytes(job + JOB_EXPECTED_SHA256, hashlib.sha256(data).hexdigest().encode() + b"\0")
+        self.write_word(job + JOB_VERIFY_CRC32, int(self.args.verify_crc32))
+        self.write_word(job + JOB_EXPECTED_CRC32, zlib.crc32(data))
+        self.write_word(self.comm + COMM_CHUNK_COUNT, chunk_count)
+
+    def program(self, image, address):
+        chunk_size = BUFFER_SIZE - 4 * 1024 if self.args.compress else BUFFER_SIZE
+        chunks = [image[i : i + chunk_size] for i in range(0, len(image), chunk_size)]
+
+        for i, data in enumerate(chunks):
+            chunk_idx = i + 1
+            chunk_address = address + i * chunk_size
+            buffer = self.framebuffer2 + (i % BUFFER_COUNT) * BUFFER_SIZE
+            job = self.jobs + (i % BUFFER_COUNT) * JOB_SIZE
+
+            if self.args.chip_erase:
+                erase, erase_bytes = int(i == 0), 0
+            elif self.args.skip_identical:
+                # Skipped chunks must be left alone, only erase this one
+                erase, erase_bytes = 1, ((len(data) + SECTOR_SIZE - 1) // SECTOR_SIZE) * SECTOR_SIZE
+            elif i == 0:
+                erase, erase_bytes = 1, ((len(image) + SECTOR_SIZE - 1) // SECTOR_SIZE) * SECTOR_SIZE
+            else:
+                erase, erase_bytes = 0, 0
+
+            # The target may still be programming the chunk in this buffer
+            self.wait_until_free(job)
+
+            if self.args.skip_identical:
+                self.write_job(job, data, chunk_address, chunk_idx, len(chunks), erase, erase_bytes, COMPARE_REQUESTED)
+                self.write_word(job + JOB_READY, 1)
+                self.wait_until_free(job)
+                if self.ocd.read_memory(32, job + JOB_COMPARE, 1)[0] == COMPARE_IDENTICAL:
+                    self.log("Chunk %d / %d is identical, skipped" % (chunk_idx, len(chunks)))
+                    continue
+
+            frame = compress_lz4(data) if self.args.compress else None
+            if frame is not None:
+                # Decoded in place by the target, from the end of the buffer
+                self.write_bytes(buffer + BUFFER_SIZE - len(frame), frame)
+            else:
+                # Like flash_multi.sh, don't load tiny files
+                self.write_bytes(buffer, data + bytes(max(0, 9 - len(data))))
+
+            self.write_job(job, data, chunk_address, chunk_idx, len(chunks), erase, erase_bytes, 0)
+            self.write_word(job + JOB_COMPRESSED_SIZE, len(frame) if frame is not None else 0)
+            self.write_word(job + JOB_READY, 1)
+
+            self.log(
+                "Chunk %d / %d queued (%d bytes%s)"
+                % (chunk_idx, len(chunks), len(data), ", %d compressed" % len(frame) if frame is not None else "")
+            )
+
+        self.wait_for_final(self.jobs + ((len(chunks) - 1) % BUFFER_COUNT) * JOB_SIZE)
+
+
+def flash(args, port=None, name=None):
+    image = Path(args.image).read_bytes()
+
+    with OpenOCD(host=args.host, port=port or args.port) as ocd:
+        flashapp = Flashapp(ocd, args.elf, args, name)
+        flashapp.start()
+        flashapp.program(image, args.address)
+
+    return len(image)
+
+
+def connect_retry(args, port, name, timeout=10):
+    """Like flash(), waiting for a freshly started openocd to accept connections."""
+    deadline = time.monotonic() + timeout
+    while True:
+        try:
+            return flash(args, port, name)
+        except ConnectionRefusedError:
+            if time.monotonic() > deadline:
+                raise
+            sleep(0.2)
+
+
+def flash_parallel(args, serials):
+    """Flashes every adapter with its own openocd, reports the results when all are done."""
+    openocd = os.environ.get("OPENOCD", "openocd")
+    adapter = os.environ.get("ADAPTER", "stlink")
+    results = {}
+    processes = []
+    threads = []
+
+    def worker(serial, port):
+        t0 = time.monotonic()
+        try:
+            size = connect_retry(args, port, serial)
+            results[serial] = (True, time.monotonic() - t0, size, "OK")
+        except FlashappError as e:
+            results[serial] = (False, time.monotonic() - t0, 0, str(e))
+        except Exception as e:
+            results[serial] = (False, time.monotonic() - t0, 0, "%s: %s" % (type(e).__name__, e))
+
+    for i, serial in enumerate(serials):
+        port = args.port + i
+        processes.append(
+            subprocess.Popen(
+                [
+                    openocd,
+                    "-f", "scripts/interface_%s.cfg" % adapter,
+                    "-c", "adapter serial %s" % serial,
+                    "-c", "tcl_port %d" % port,
+                    "-c", "gdb_port disabled",
+                    "-c", "telnet_port disabled",
+                    "-c", "init",
+                ],
+                stdout=subprocess.DEVNULL,
+                stderr=subprocess.DEVNULL,
+            )
+        )
+        threads.append(threading.Thread(target=worker, args=(serial, port)))
+
+    try:
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+    finally:
+        for p in processes:
+            p.terminate()
+            p.wait()
+
+    print("")
+    print("%-28s %-6s %8s %10s  %s" % ("Adapter", "Result", "Time", "Speed", "Message"))
+    for serial in serials:
+        ok, seconds, size, message = results[serial]
+        speed = "%.1f kB/s" % (size / 1024 / seconds) if ok and seconds > 0 else "-"
+        print(
+            "%-28s %-6s %7.1fs %10s  %s"
+            % (serial, "OK" if ok else "FAILED", seconds, speed, message)
+        )
+
+    failed = sum(1 for ok, *_ in results.values() if not ok)
+    print("%d / %d devices programmed" % (len(serials) - failed, len(serials)))
+    return failed == 0
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Programs the external flash through the flashapp with a single OpenOCD session"
+    )
+    parser.add_argument("image", type=str, help="Binary to flash")
+    parser.add_argument(
+        "address",
+        type=lambda x: int(x, 0),
+        nargs="?",
+        default=0,
+        help="Address to start writing to in the flash (default: 0)",
+    )
+    parser.add_argument(
+        "chip_erase",
+        type=int,
+        nargs="?",
+        default=0,
+        help="Set to 1 to erase the whole chip (default: 0)",
+    )
+    parser.add_argument(
+        "skip_identical",
+        type=int,
+        nargs="?",
+        default=0,
+        help="Set to 1 to skip chunks that are already in the flash (default: 0)",
+    )
+    parser.add_argument(
+        "--elf",
+        type=str,
+        default="build/gw_retro_go.elf",
+        help="Game and Watch Retro-Go ELF file",
+    )
+    parser.add_argument(
+        "--interval",
+        "-i",
+        type=int,
+        default=50,
+        help="Polling interval (ms)",
+    )
+    parser.add_argument(
+        "--host",
+        type=str,
+        default="127.0.0.1",
+        help="OpenOCD TCL hostname",
+    )
+    parser.add_argument(
+        "--port",
+        type=int,
+        default=6666,
+        help="OpenOCD TCL port",
+    )
+    parser.add_argument(
+        "--intflash-bank",
+        type=int,
+        default=int(os.environ.get("INTFLASH_BANK", 1)),
+        help="Internal flash bank the flashapp is in (default: $INTFLASH_BANK or 1)",
+    )
+    parser.add_argument(
+        "--verify-crc32",
+        action="store_true",
+        default=os.environ.get("FLASHAPP_VERIFY_CRC32", "0") == "1",
+        help="Verify chunks with a CRC-32 instead of SHA-256",
+    )
+    parser.add_argument(
+        "--no-compress",
+        dest="compress",
+        action="store_false",
+        default=os.environ.get("FLASHAPP_COMPRESS", "1") == "1",
+        help="Don't send LZ4 compressed chunks",
+    )
+    parser.add_argument(
+        "--serial",
+        type=str,
+        action="append",
+        default=[],
+        help="Serial number of an adapter to flash, can be given several times. "
+        "Every adapter gets its own openocd, with TCL ports counting up from --port",
+    )
+    parser.add_argument(
+        "--all-adapters",
+        action="store_true",
+        help="Flash all the connected ST-LINK adapters in parallel (Linux only)",
+    )
+    args = parser.parse_args()
+
+    if args.chip_erase and args.skip_identical:
+        parser.error("chip_erase and skip_identical can't be combined")
+
+    serials = list(args.serial)
+    if args.all_adapters:
+        serials += [s for s in find_stlinks() if s not in serials]
+        if not serials:
+            parser.error("no ST-LINK adapters found")
+
+    if serials:
+        sys.exit(0 if flash_parallel(args, serials) else 1)
+
+    try:
+        try:
+            flash(args)
+            print("Programming of the external flash succeeded.")
+            return
+        except ConnectionRefusedError:
+            pass
+
+        # Attempt to automagically launch openocd
+        p = subprocess.Popen(
+            ["make", "openocd"], stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL
+        )
+        try:
+            sleep(1)  # Give openocd some time to launch
+            flash(args)
+            print("Programming of the external flash succeeded.")
+        finally:
+            p.terminate()
+            p.wait()
+    except FlashappError as e:
+        print(e)
+        sys.exit(e.code)
+
+
+if __name__ == "__main__":
+    main()
@@ -6,32 +6,97 @@ def parse_args():
     """Parse bmp file to bin txt"""
     parser = argparse.ArgumentParser()
     parser.add_argument("bmp", type=Path)
+    parser.add_argument(
+        "--lut8-rle",
+        action="store_true",
+        help="Write a packed bitmap for gui_draw_header() to <stem>.c instead, see bitmaps.h "
+        "and draw_packed_bitmap() in gui.c",
+    )
+    parser.add_argument(
+        "--zelda", type=Path, help="With --lut8-rle, the image of the Zelda edition"
+    )
     args = parser.parse_args()
     return args
 
 
+def rgb565_pixels(fi):
+    from PIL import Image
 
-def write_rgb565(fi, fn):
-    from PIL import Image, ImageOps
     img = Image.open(fi).convert(mode="RGB")
-    pixels = list(img.getdata())
+    pixels = [
+        ((r >> 3) << 11) + ((g >> 2) << 5) + (b >> 3) for r, g, b in img.getdata()
+    ]
+    return img.width, img.height, pixels
+
+
+def write_rgb565(fi, fn):
+    width, height, pixels = rgb565_pixels(fi)
     with open(fn, "wb") as f:
         # TODO: this header could probably be a bit shorter, didn't really investigate
-        for y in range(img.height):
-        #for pix in pixels:
-            for x in range(img.width):
-            #img.pixels[x,y]
-                r = (pixels[(y * img.width) + x][0] >> 3) & 0x1F
-                g = (pixels[(y * img.width) + x][1] >> 2) & 0x3F
-                b = (pixels[(y * img.width) + x][2] >> 3) & 0x1F
-                px = (r << 11) + (g << 5) + b
+        for y in range(height):
+            for x in range(width):
+                px = pixels[(y * width) + x]
                 f.write(str.encode(f"0x{px:04X},", "utf-8"))
             f.write(str.encode("\n", "utf-8"))
 
+
+def pack_lut8_rle(width, height, pixels):
+    """Width, height and color count as uint16, the RGB565 palette, then
+    runs of (length - 1, index) bytes"""
+    palette = sorted(set(pixels))
+    if len(palette) > 256:
+        raise ValueError(f"{len(palette)} colors, a LUT8 bitmap has at most 256")
+    index = {color: i for i, color in enumerate(palette)}
+
+    out = bytearray()
+    for value in (width, height, len(palette), *palette):
+        out += value.to_bytes(2, "little")
+
+    i = 0
+    while i < len(pixels):
+        run = 1
+        while i + run < len(pixels) and run < 256 and pixels[i + run] == pixels[i]:
+            run += 1
+        out += bytes((run - 1, index[pixels[i]]))
+        i += run
+
+    return bytes(out)
+
+
+def c_bytes(data):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("    " + ", ".join(f"0x{b:02x}" for b in data[i : i + 16]) + ",")
+    return "\n".join(lines)
+
+
+def write_lut8_rle(name, packed, packed_zelda, fn):
+    with open(fn, "w") as f:
+        f.write("// Packed bitmap, see bitmaps.h. Generated by tools/img2bin.py --lut8-rle\n")
+        if packed_zelda is not None:
+            f.write("#if !defined(GNW_TARGET_ZELDA)\n")
+            f.write("#define GNW_TARGET_ZELDA 0\n")
+            f.write("#endif /* GNW_TARGET_ZELDA */\n\n")
+        f.write(f"const unsigned char {name}[] __attribute__((aligned(4))) = {{\n")
+        if packed_zelda is not None:
+            f.write("#if GNW_TARGET_ZELDA != 0\n")
+            f.write(c_bytes(packed_zelda) + "\n")
+            f.write("#else\n")
+            f.write(c_bytes(packed) + "\n")
+            f.write("#endif /* GNW_TARGET_ZELDA */\n")
+        else:
+            f.write(c_bytes(packed) + "\n")
+        f.write("};\n")
+
+
 def main():
     args = parse_args()
-    #filepath.stem
-    write_rgb565(args.bmp, args.bmp.stem + ".txt")
+    if args.lut8_rle:
+        packed = pack_lut8_rle(*rgb565_pixels(args.bmp))
+        packed_zelda = pack_lut8_rle(*rgb565_pixels(args.zelda)) if args.zelda else None
+        write_lut8_rle(args.bmp.stem, packed, packed_zelda, args.bmp.stem + ".c")
+    else:
+        write_rgb565(args.bmp, args.bmp.stem + ".txt")
 
 
 if __name__ == "__main__":
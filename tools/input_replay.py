@@ -0,0 +1,88 @@
+#!/usr/bin/env python3
+"""Saves the input recording of the target to a file, or loads one into it.
+
+Needs a build with INPUT_REPLAY=1, see Core/Inc/porting/input_replay.h.
+Record a session on the device, save it, then load it into another build
+and set the debug menu to "Play" to time the same session on both:
+
+    python3 tools/input_replay.py save zelda.rply
+    python3 tools/input_replay.py --elf other/gw_retro_go.elf load zelda.rply
+
+The linux ports play the same file with --replay.
+"""
+
+import argparse
+import os
+import struct
+
+from elftools.elf.elffile import ELFFile
+from itcram_profile import get_symbol_value
+from openocd import OpenOCD
+
+# See input_replay.h
+INPUT_REPLAY_MAGIC = 0x52504C59
+INPUT_REPLAY_RUNS = 2048
+INPUT_REPLAY_PLAY = 2
+HEADER = struct.Struct("<4I")
+SIZE = HEADER.size + 4 * INPUT_REPLAY_RUNS
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("command", choices=["save", "load"])
+    parser.add_argument("file", type=str)
+    parser.add_argument(
+        "--elf",
+        type=str,
+        default="build/gw_retro_go.elf",
+        help="Game and Watch Retro-Go ELF file",
+    )
+    parser.add_argument(
+        "--host",
+        type=str,
+        default="127.0.0.1",
+        help="OpenOCD TCL hostname",
+    )
+    parser.add_argument(
+        "--port",
+        type=int,
+        default=6666,
+        help="OpenOCD TCL port",
+    )
+    args = parser.parse_args()
+
+    with open(args.elf, "rb") as f:
+        address = get_symbol_value(ELFFile(f), "input_replay")
+
+    if args.command == "load":
+        with open(args.file, "rb") as f:
+            data = bytearray(f.read())
+        magic, _, count, frames = HEADER.unpack_from(data)
+        if magic != INPUT_REPLAY_MAGIC or len(data) != SIZE:
+            raise SystemExit(f"{args.file} isn't a recording")
+        # Played with the next game that's started
+        HEADER.pack_into(data, 0, magic, INPUT_REPLAY_PLAY, count, frames)
+        with open(args.file + ".tmp", "wb") as f:
+            f.write(data)
+
+    with OpenOCD(host=args.host, port=args.port) as ocd:
+        # AHBRAM isn't cached, the halt only keeps the recording consistent
+        ocd.send("halt")
+        if args.command == "save":
+            ocd.send(f"dump_image {args.file} {address:#x} {SIZE:#x}")
+        else:
+            ocd.send(f"load_image {args.file}.tmp {address:#x} bin")
+        ocd.send("resume")
+
+    if args.command == "load":
+        os.remove(args.file + ".tmp")
+    else:
+        with open(args.file, "rb") as f:
+            magic, _, count, frames = HEADER.unpack_from(f.read())
+    if magic != INPUT_REPLAY_MAGIC:
+        raise SystemExit("The target has no recording, set Input replay to Record first")
+    print(f"{count} runs, {frames} frames ({frames / 60:.1f} s at 60 fps)")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,142 @@
+#!/usr/bin/env python3
+"""Picks the functions of an emulator core to run from ITCRAM.
+
+Samples the program counter of the running target through the DWT PC
+sample register, counts the samples per function of the core and writes
+the hottest functions that fit in the free ITCRAM to itcram/<core>.txt.
+
+Start a game of the core on the target, then run e.g.:
+
+    python3 tools/itcram_profile.py --core nes --samples 20000
+"""
+
+import argparse
+import bisect
+from collections import Counter
+from pathlib import Path
+
+from elftools.elf.elffile import ELFFile
+from openocd import OpenOCD
+
+DWT_PCSR = 0xE000101C
+
+# Build directory of each core, and the name of its sections in the ELF
+CORES = {
+    "nes": "nes",
+    "gnuboy": "gb",
+    "smsplusgx": "sms",
+    "pce": "pce",
+    "gw": "gw",
+}
+
+
+def get_symbol_value(elffile, symbol_name):
+    symbols = elffile.get_section_by_name(".symtab").get_symbol_by_name(symbol_name)
+    return symbols[0].entry.st_value
+
+
+def get_functions(elffile, sections):
+    """Sorted (start, end, name) of the functions in the given sections."""
+    ranges = []
+    for name in sections:
+        section = elffile.get_section_by_name(name)
+        if section is not None:
+            ranges.append((section["sh_addr"], section["sh_addr"] + section["sh_size"]))
+
+    functions = []
+    for symbol in elffile.get_section_by_name(".symtab").iter_symbols():
+        if symbol.entry.st_info.type != "STT_FUNC" or symbol.entry.st_size == 0:
+            continue
+        start = symbol.entry.st_value & ~1  # Thumb bit
+        if any(lo <= start < hi for lo, hi in ranges):
+            functions.append((start, start + symbol.entry.st_size, symbol.name))
+
+    return sorted(functions)
+
+
+def sample(args, functions):
+    starts = [f[0] for f in functions]
+    counts = Counter()
+    missed = 0
+
+    with OpenOCD(host=args.host, port=args.port) as ocd:
+        for _ in range(args.samples):
+            pc = ocd.read_memory(32, DWT_PCSR, 1)[0]
+
+            # 0xffffffff while the core is halted or sleeping
+            i = bisect.bisect_right(starts, pc) - 1
+            if pc != 0xFFFFFFFF and i >= 0 and pc < functions[i][1]:
+                counts[i] += 1
+            else:
+                missed += 1
+
+    return counts, missed
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--core", choices=CORES.keys(), required=True)
+    parser.add_argument(
+        "--elf",
+        type=str,
+        default="build/gw_retro_go.elf",
+        help="Game and Watch Retro-Go ELF file",
+    )
+    parser.add_argument(
+        "--samples", type=int, default=10000, help="Number of PC samples to take"
+    )
+    parser.add_argument(
+        "--budget",
+        type=int,
+        default=None,
+        help="ITCRAM bytes to fill (default: all that's free after the HOT section)",
+    )
+    parser.add_argument(
+        "--host",
+        type=str,
+        default="127.0.0.1",
+        help="OpenOCD TCL hostname",
+    )
+    parser.add_argument(
+        "--port",
+        type=int,
+        default=6666,
+        help="OpenOCD TCL port",
+    )
+    args = parser.parse_args()
+
+    name = CORES[args.core]
+    with open(args.elf, "rb") as f:
+        elffile = ELFFile(f)
+        # Functions already in ITCRAM have to keep their place
+        functions = get_functions(elffile, [f".overlay_{name}", f".itcram_{name}"])
+        budget = args.budget
+        if budget is None:
+            budget = get_symbol_value(elffile, "__ITCMRAM_LENGTH__") - get_symbol_value(
+                elffile, "__itcram_emu_start__"
+            )
+
+    counts, missed = sample(args, functions)
+    total = sum(counts.values()) + missed
+    print(f"{total} samples, {missed} outside of the {args.core} core")
+
+    lines = [
+        f"# Functions of the {args.core} core run from ITCRAM, hottest first.",
+        f"# Regenerate with: tools/itcram_profile.py --core {args.core}",
+    ]
+    used = 0
+    for i, count in counts.most_common():
+        start, end, function = functions[i]
+        # Keep some room for the alignment of each function
+        size = end - start + 8
+        if used + size > budget:
+            continue
+        used += size
+        lines.append(f"{function:<32} # {100 * count / total:5.1f}%, {end - start} bytes")
+
+    print(f"{len(lines) - 2} functions, {used} / {budget} bytes")
+    Path(f"itcram/{args.core}.txt").write_text("\n".join(lines) + "\n")
+
+
+if __name__ == "__main__":
+    main()
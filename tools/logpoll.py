@@ -1,10 +1,12 @@
 #!/usr/bin/env python3
 
 import argparse
+import re
 import subprocess
 import sys
 from time import sleep
 
+from elftools.elf.constants import SH_FLAGS
 from elftools.elf.elffile import ELFFile
 from openocd import OpenOCD
 
@@ -17,6 +19,169 @@ def strtohex(data):
     return map(strtohex, data) if isinstance(data, list) else int(data, 16)
 
 
+def read_string(ocd, addr, max_len=32):
+    data = ocd.read_memory(8, addr, max_len)
+    if 0 in data:
+        data = data[: data.index(0)]
+    return "".join([chr(c) for c in data])
+
+
+def boot_trace(args):
+    with OpenOCD(host=args.host, port=args.port) as ocd:
+        with open(args.elf, "rb") as f:
+            elffile = ELFFile(f)
+            entries_addr = get_symbol_by_symbol_name(
+                elffile, "boot_trace_entries"
+            ).entry.st_value
+            count_addr = get_symbol_by_symbol_name(
+                elffile, "boot_trace_count"
+            ).entry.st_value
+
+        ocd.send("halt")
+
+        # Entries are a name pointer and a timestamp in us
+        count = ocd.read_memory(32, count_addr, 1)[0]
+        entries = ocd.read_memory(32, entries_addr, 2 * count) if count else []
+
+        last = 0
+        for i in range(count):
+            name = read_string(ocd, entries[2 * i])
+            us = entries[2 * i + 1]
+            print(f"{name:<16} {us:>9} us (+{us - last})")
+            last = us
+
+        ocd.send("resume")
+
+
+# See Core/Inc/porting/frame_stats.h
+FRAME_STATS_WINDOW = 256
+FRAME_STATS_UNIT_US = 10
+FRAME_TAGS = ["skipped", "overlay", "flash", "menu"]
+
+
+def frame_tags(tags):
+    return ",".join(name for i, name in enumerate(FRAME_TAGS) if tags & (1 << i)) or "-"
+
+
+def frame_stats(args):
+    with OpenOCD(host=args.host, port=args.port) as ocd:
+        with open(args.elf, "rb") as f:
+            elffile = ELFFile(f)
+            addr = get_symbol_by_symbol_name(elffile, "frame_stats").entry.st_value
+
+        ocd.send("halt")
+        times = ocd.read_memory(16, addr, FRAME_STATS_WINDOW)
+        tags = ocd.read_memory(8, addr + 2 * FRAME_STATS_WINDOW, FRAME_STATS_WINDOW)
+        count, period_us, late, menu_frames, longest_us, longest_tags = ocd.read_memory(
+            32, addr + 3 * FRAME_STATS_WINDOW, 6
+        )
+        ocd.send("resume")
+
+    # Oldest first
+    n = min(count, FRAME_STATS_WINDOW)
+    order = [(count - n + i) % FRAME_STATS_WINDOW for i in range(n)]
+    for i in order:
+        us = times[i] * FRAME_STATS_UNIT_US
+        print(f"{us / 1000:8.2f} ms {frame_tags(tags[i])}")
+
+    print(f"{count} frames of {period_us / 1000:.2f} ms, {late} late, {menu_frames} in menus")
+    if n:
+        sorted_us = sorted(times[i] * FRAME_STATS_UNIT_US for i in order)
+        for p in (50, 95, 99):
+            print(f"p{p}: {sorted_us[n * p // 100] / 1000:.2f} ms")
+    print(f"Longest: {longest_us / 1000:.2f} ms ({frame_tags(longest_tags & 0xFF)})")
+
+
+# See Core/Inc/porting/log_ring.h
+LOG_RING_MAGIC = 0xA0000000
+LOG_RING_ARGS_SHIFT = 24
+C_FORMAT = re.compile(r"%([-+ 0#]*\d*(?:\.\d+)?)(?:hh|h|ll|l|z)?([diuxXcsp%])")
+
+
+class LogRing:
+    """Formats the records of LOG_DEFER() with the strings from the ELF."""
+
+    def __init__(self, elffile):
+        symtab = elffile.get_section_by_name(".symtab")
+        ring = symtab.get_symbol_by_name("log_ring")[0]
+        self.ring_addr = ring.entry.st_value
+        self.words = ring.entry.st_size // 4
+        self.head_addr = symtab.get_symbol_by_name("log_ring_head")[0].entry.st_value
+        self.last = 0
+
+        section = elffile.get_section_by_name(".log_fmt")
+        self.formats = section.data() if section else b""
+
+        # For %s arguments, e.g. string literals in flash
+        self.sections = [
+            (section["sh_addr"], section.data())
+            for section in elffile.iter_sections()
+            if section["sh_flags"] & SH_FLAGS.SHF_ALLOC
+            and section["sh_type"] != "SHT_NOBITS"
+        ]
+
+    def string_at(self, addr):
+        for start, data in self.sections:
+            if start <= addr < start + len(data):
+                end = data.find(b"\0", addr - start)
+                return data[addr - start : end].decode(errors="replace")
+        return f"<{addr:#010x}>"
+
+    def format(self, fmt_id, args):
+        end = self.formats.find(b"\0", fmt_id)
+        fmt = self.formats[fmt_id:end].decode(errors="replace")
+        args = iter(args)
+
+        def convert(match):
+            flags, conv = match.groups()
+            if conv == "%":
+                return "%"
+            value = next(args, 0)
+            if conv in "di":
+                value -= (value & 0x80000000) << 1
+                conv = "d"
+            elif conv == "u":
+                conv = "d"
+            elif conv == "c":
+                value = chr(value & 0xFF)
+            elif conv == "s":
+                value = self.string_at(value)
+            elif conv == "p":
+                flags, conv = "#010", "x"
+            return f"%{flags}{conv}" % value
+
+        return C_FORMAT.sub(convert, fmt)
+
+    def poll(self, ocd):
+        head = ocd.read_memory(32, self.head_addr, 1)[0]
+
+        if head < self.last:
+            # The target rebooted
+            self.last = 0
+        if head - self.last > self.words:
+            self.last = head
+            return "[log ring overflowed]\n"
+        if head == self.last:
+            return ""
+
+        ring = ocd.read_memory(32, self.ring_addr, self.words)
+        out = ""
+        pos = self.last
+        while pos < head:
+            header = ring[pos % self.words]
+            count = (header >> LOG_RING_ARGS_SHIFT) & 0xF
+            if header & 0xF0000000 != LOG_RING_MAGIC or pos + 2 + count > head:
+                # Still being written
+                break
+            tick = ring[(pos + 1) % self.words]
+            args = [ring[(pos + 2 + i) % self.words] for i in range(count)]
+            out += f"[{tick:>8} ms] {self.format(header & 0xFFFFFF, args)}"
+            pos += 2 + count
+
+        self.last = pos
+        return out
+
+
 # OpenOCD class cherry-picked/inspired from from https://github.com/zmarvel/python-openocd
 
 
@@ -30,6 +195,7 @@ def logpoll(args):
             logbuf_addr = logbuf.entry.st_value
             logbuf_size = logbuf.entry.st_size
             log_idx_addr = get_symbol_by_symbol_name(elffile, "log_idx").entry.st_value
+            log_ring = LogRing(elffile)
 
         ocd.send("resume")
 
@@ -60,6 +226,8 @@ def logpoll(args):
                 logbuf_str += "".join([chr(c) for c in logbuf])
                 sys.stdout.write(logbuf_str)
 
+            sys.stdout.write(log_ring.poll(ocd))
+
             if args.halt:
                 ocd.send("resume")
 
@@ -102,10 +270,28 @@ def main():
         action="store_true",
         help="Halts the target during memory reads",
     )
+    parser.add_argument(
+        "--boot-trace",
+        dest="boot_trace",
+        action="store_true",
+        help="Prints the timestamps of the boot phases and exits",
+    )
+    parser.add_argument(
+        "--frame-stats",
+        dest="frame_stats",
+        action="store_true",
+        help="Prints the recent frame times of the running emulator and exits",
+    )
     args = parser.parse_args()
+    if args.boot_trace:
+        run = boot_trace
+    elif args.frame_stats:
+        run = frame_stats
+    else:
+        run = logpoll
 
     try:
-        logpoll(args)
+        run(args)
         return
     except ConnectionRefusedError:
         pass
@@ -116,7 +302,7 @@ def main():
             ["make", "openocd"], stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL
         )
         sleep(1)  # Give openocd some time to launch
-        logpoll(args)
+        run(args)
     except KeyboardInterrupt:
         pass
 
@@ -0,0 +1,130 @@
+#!/usr/bin/env python3
+"""Flat profile of the running target from its PC sample histogram.
+
+Needs a build with PC_SAMPLER=1, see Core/Inc/porting/pc_sample.h. Clears
+the histogram, lets the target run for a while, then reads it back and
+counts the samples per function of the ELF.
+
+The emulator cores share the addresses of their RAM and ITCRAM overlays,
+pass --core to attribute those to the core that's running, e.g.:
+
+    python3 tools/pcprof.py --core gnuboy --seconds 10
+"""
+
+import argparse
+import bisect
+from collections import Counter
+from time import sleep
+
+from elftools.elf.constants import SH_FLAGS
+from elftools.elf.elffile import ELFFile
+from itcram_profile import CORES, get_functions, get_symbol_value
+from openocd import OpenOCD
+
+# See pc_sample.h
+PC_SAMPLE_BINS = 2048
+
+
+def code_sections(elffile, core):
+    """Executable sections, those of core overlays only for the given core."""
+    names = []
+    overlays = [f".overlay_{name}" for name in CORES.values()]
+    overlays += [f".itcram_{name}" for name in CORES.values()]
+    wanted = [f".overlay_{CORES[core]}", f".itcram_{CORES[core]}"] if core else []
+
+    for section in elffile.iter_sections():
+        if not section["sh_flags"] & SH_FLAGS.SHF_EXECINSTR:
+            continue
+        if section.name in overlays and section.name not in wanted:
+            continue
+        names.append(section.name)
+
+    return names
+
+
+def read_histogram(ocd, bins_addr):
+    words = ocd.read_memory(32, bins_addr, 2 * PC_SAMPLE_BINS)
+    return [(words[i], words[i + 1]) for i in range(0, len(words), 2) if words[i + 1]]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--core", choices=CORES.keys(), default=None)
+    parser.add_argument(
+        "--elf",
+        type=str,
+        default="build/gw_retro_go.elf",
+        help="Game and Watch Retro-Go ELF file",
+    )
+    parser.add_argument(
+        "--seconds", type=float, default=5, help="How long to let the target run"
+    )
+    parser.add_argument(
+        "--no-reset",
+        action="store_true",
+        help="Read the samples collected so far instead of clearing them first",
+    )
+    parser.add_argument(
+        "--top", type=int, default=30, help="Number of functions to print"
+    )
+    parser.add_argument(
+        "--host",
+        type=str,
+        default="127.0.0.1",
+        help="OpenOCD TCL hostname",
+    )
+    parser.add_argument(
+        "--port",
+        type=int,
+        default=6666,
+        help="OpenOCD TCL port",
+    )
+    args = parser.parse_args()
+
+    with open(args.elf, "rb") as f:
+        elffile = ELFFile(f)
+        bins_addr = get_symbol_value(elffile, "pc_sample_bins")
+        total_addr = get_symbol_value(elffile, "pc_sample_total")
+        dropped_addr = get_symbol_value(elffile, "pc_sample_dropped")
+        functions = get_functions(elffile, code_sections(elffile, args.core))
+
+    with OpenOCD(host=args.host, port=args.port) as ocd:
+        if not args.no_reset:
+            # Halted so the interrupt doesn't count into a half cleared table
+            ocd.send("halt")
+            ocd.send(f"mww {bins_addr:#x} 0 {2 * PC_SAMPLE_BINS}")
+            ocd.send(f"mww {total_addr:#x} 0")
+            ocd.send(f"mww {dropped_addr:#x} 0")
+            ocd.send("resume")
+            sleep(args.seconds)
+
+        ocd.send("halt")
+        histogram = read_histogram(ocd, bins_addr)
+        total = ocd.read_memory(32, total_addr, 1)[0]
+        dropped = ocd.read_memory(32, dropped_addr, 1)[0]
+        ocd.send("resume")
+
+    starts = [f[0] for f in functions]
+    counts = Counter()
+    for pc, count in histogram:
+        i = bisect.bisect_right(starts, pc) - 1
+        if i >= 0 and pc < functions[i][1]:
+            counts[functions[i][2]] += count
+        else:
+            counts[f"?? {pc:#010x}"] += count
+
+    print(f"{total} samples, {dropped} didn't fit in the histogram")
+    if total == 0:
+        return
+
+    cumulative = 0
+    print(f"{'%':>6} {'cum %':>6} {'samples':>8}  function")
+    for function, count in counts.most_common(args.top):
+        cumulative += count
+        print(
+            f"{100 * count / total:6.2f} {100 * cumulative / total:6.2f} {count:8}  {function}"
+        )
+
+
+if __name__ == "__main__":
+    main()
@@ -2,26 +2,113 @@
 
 import argparse
 import os
+import struct
 import v4l2
 
 from elftools.elf.elffile import ELFFile
 from fcntl import ioctl
 from openocd import OpenOCD
+from PIL import Image, ImageDraw
 
 # 1. Create a v4l2 loopback and find out the name (/dev/video0 etc):
 #    sudo modprobe v4l2loopback
 # 2. Start openocd with a fast adapter speed separately:
 #    openocd -f interface/jlink.cfg -c "transport select swd;" -f target/stm32h7x.cfg -c "adapter speed 10000; init;"
 # 3. python3 tools/screengrabber.py
+#
+# The buffer shown is the one the LTDC scans out, in the pixel format the LTDC
+# is set up with. The frame time and skipped frames of frame_stats (see
+# Core/Inc/porting/frame_stats.h) are drawn along the bottom, --stats-log
+# also writes them to a file, one line per grabbed frame.
+
+# LTDC layer 1 registers, from the pixel format to the frame buffer address
+LTDC_L1PFCR = 0x50001094
+LTDC_L1CFBAR = 0x500010AC
+LTDC_PF_RGB565 = 2
+LTDC_PF_L8 = 5
+
+# See Core/Inc/porting/frame_stats.h
+FRAME_STATS_WINDOW = 256
+FRAME_STATS_UNIT_US = 10
+FRAME_STATS_SIZE = 3 * FRAME_STATS_WINDOW + 6 * 4
+FRAME_TAG_SKIPPED = 1 << 0
 
 def get_symbol_by_symbol_name(elffile, symbol_name):
     return elffile.get_section_by_name('.symtab').get_symbol_by_name(symbol_name)[0]
 
+def get_clut_address(elffile):
+    # Static in gw_lcd.c and only there with GW_LCD_MODE_LUT8
+    for symbol in elffile.get_section_by_name('.symtab').get_symbol_by_name("clut") or []:
+        if symbol.entry.st_size == 256 * 4:
+            return symbol.entry.st_value
+    return None
+
+def l8_to_rgb565(pixels, clut):
+    lo = bytearray(256)
+    hi = bytearray(256)
+    for i, color in enumerate(clut):
+        r, g, b = (color >> 16) & 0xFF, (color >> 8) & 0xFF, color & 0xFF
+        rgb565 = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+        lo[i], hi[i] = rgb565 & 0xFF, rgb565 >> 8
+
+    out = bytearray(2 * len(pixels))
+    out[0::2] = pixels.translate(lo)
+    out[1::2] = pixels.translate(hi)
+    return out
+
+class FrameStats:
+    """Frame times of the frames emulated since the previous grab."""
+
+    def __init__(self):
+        self.count = None
+        self.skipped = 0
+
+    def update(self, data):
+        times = struct.unpack_from(f"<{FRAME_STATS_WINDOW}H", data, 0)
+        tags = data[2 * FRAME_STATS_WINDOW:3 * FRAME_STATS_WINDOW]
+        count, period_us, late = struct.unpack_from("<3I", data, 3 * FRAME_STATS_WINDOW)
+
+        new = 0 if self.count is None else min(count - self.count, FRAME_STATS_WINDOW)
+        if new < 0:
+            # The target was reset
+            new = min(count, FRAME_STATS_WINDOW)
+        self.count = count
+
+        frames = [(count - new + i) % FRAME_STATS_WINDOW for i in range(new)]
+        frame_us = [times[i] * FRAME_STATS_UNIT_US for i in frames]
+        skipped = sum(1 for i in frames if tags[i] & FRAME_TAG_SKIPPED)
+        self.skipped += skipped
+
+        return {
+            "frames": new,
+            "avg_ms": sum(frame_us) / new / 1000 if new else 0,
+            "max_ms": max(frame_us) / 1000 if new else 0,
+            "skipped": skipped,
+            "total_skipped": self.skipped,
+            "late": late,
+            "period_ms": period_us / 1000,
+        }
+
+def draw_stats(fb, width, stats):
+    text = "{frames:2} frames {avg_ms:5.1f}/{max_ms:5.1f} ms skip {skipped} ({total_skipped}) late {late}".format(**stats)
+
+    # Rendered into a mask so the framebuffer can stay RGB565
+    height = 11
+    mask = Image.new("1", (width, height))
+    ImageDraw.Draw(mask).text((2, 0), text, fill=1)
+
+    top = len(fb) // (2 * width) - height
+    for y in range(height):
+        for x in range(width):
+            offset = 2 * ((top + y) * width + x)
+            fb[offset:offset + 2] = b"\xff\xff" if mask.getpixel((x, y)) else b"\x00\x00"
+
 def screengrabber(args):
-    # Find address of framebuffer
+    # Find the addresses of the frame stats and the color lookup table
     with open(args.elf, "rb") as f:
         elffile = ELFFile(f)
-        fb_address = get_symbol_by_symbol_name(elffile, "framebuffer1").entry.st_value
+        stats_address = get_symbol_by_symbol_name(elffile, "frame_stats").entry.st_value
+        clut_address = get_clut_address(elffile)
 
     # Open camera driver
     fd = os.open(args.device, os.O_RDWR, 0)
@@ -37,7 +124,7 @@ def screengrabber(args):
     width = args.width
     height = args.height
     sizeimage = width * height * 2
-    linewidth = width
+    linewidth = width * 2
 
     fmt = v4l2.v4l2_format()
     fmt.type = BUFTYPE
@@ -52,13 +139,42 @@ def screengrabber(args):
     ret = ioctl(fd, v4l2.VIDIOC_S_FMT, fmt)
     print("fcntl.ioctl(fd, v4l2.VIDIOC_S_FMT, fmt) = %d" % ret)
 
-    buffer_size = fmt.fmt.pix.sizeimage
+    frame_stats = FrameStats()
+    stats_log = open(args.stats_log, "w") if args.stats_log else None
 
     with OpenOCD(host=args.host, port=args.port) as ocd:
         while True:
-            fb = ocd.send(f"dump_image fb.bin {hex(fb_address)} {hex(buffer_size)}; exit")
+            pixel_format, *_, fb_address = ocd.read_memory(32, LTDC_L1PFCR, 7)
+            lut8 = (pixel_format & 0x7) == LTDC_PF_L8
+            pixel_size = 1 if lut8 else 2
+
+            # All of it in a single round trip, so the stats match the frame
+            dumps = [
+                f"dump_image fb.bin {hex(fb_address)} {hex(width * height * pixel_size)}",
+                f"dump_image stats.bin {hex(stats_address)} {hex(FRAME_STATS_SIZE)}",
+            ]
+            if lut8 and clut_address is not None:
+                dumps.append(f"dump_image clut.bin {hex(clut_address)} {hex(256 * 4)}")
+            ocd.send("; ".join(dumps))
+
             with open("fb.bin", "rb") as f_in:
-                os.write(fd, f_in.read())
+                fb = bytearray(f_in.read())
+            with open("stats.bin", "rb") as f_in:
+                stats = frame_stats.update(f_in.read())
+
+            if lut8:
+                clut = [0] * 256
+                if clut_address is not None:
+                    with open("clut.bin", "rb") as f_in:
+                        clut = struct.unpack("<256I", f_in.read())
+                fb = l8_to_rgb565(fb, clut)
+
+            if not args.no_overlay:
+                draw_stats(fb, width, stats)
+            if stats_log:
+                stats_log.write("{frames} {avg_ms:.2f} {max_ms:.2f} {skipped} {late}\n".format(**stats))
+
+            os.write(fd, fb)
 
 if __name__ == "__main__":
     parser = argparse.ArgumentParser(description="Grabs the framebuffer and renders it to a video4l2 device")
@@ -88,5 +204,16 @@ if __name__ == "__main__":
     )
     parser.add_argument("--width",  type=int, default=320)
     parser.add_argument("--height", type=int, default=240)
+    parser.add_argument(
+        "--no-overlay",
+        action="store_true",
+        help="Don't draw the frame stats over the picture",
+    )
+    parser.add_argument(
+        "--stats-log",
+        type=str,
+        default=None,
+        help="File to write the frame stats of each grabbed frame to",
+    )
 
     screengrabber(parser.parse_args())
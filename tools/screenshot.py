@@ -10,39 +10,100 @@ from openocd import OpenOCD
 from PIL import Image
 from time import sleep
 
+SECTOR_SIZE = 4096
+
+# screenshot_header_t, see Core/Inc/porting/screenshot.h
+SCREENSHOT_MAGIC = 0x54485353
+HEADER = struct.Struct("<IIHHHHI")
+FORMAT_RGB565 = 0
+FORMAT_LUT8 = 1
+
+
 def get_symbol_by_symbol_name(elffile, symbol_name):
     return elffile.get_section_by_name('.symtab').get_symbol_by_name(symbol_name)[0]
 
+
+def find_screenshots(area):
+    """Headers in the area with where they are, newest first."""
+    screenshots = []
+    for offset in range(0, len(area), SECTOR_SIZE):
+        if offset + HEADER.size > len(area):
+            break
+        magic, seq, width, height, fmt, clut_count, packed_size = HEADER.unpack_from(area, offset)
+        if magic != SCREENSHOT_MAGIC:
+            continue
+        end = offset + HEADER.size + clut_count * 4 + packed_size
+        if end > len(area):
+            continue
+        screenshots.append((seq, offset, width, height, fmt, clut_count, packed_size))
+    return sorted(screenshots, reverse=True)
+
+
+def decode(area, screenshot):
+    import lz4.block
+
+    seq, offset, width, height, fmt, clut_count, packed_size = screenshot
+    clut_start = offset + HEADER.size
+    block_start = clut_start + clut_count * 4
+    bpp = 1 if fmt == FORMAT_LUT8 else 2
+    data = lz4.block.decompress(
+        area[block_start:block_start + packed_size], uncompressed_size=width * height * bpp
+    )
+
+    img = Image.new("RGB", (width, height))
+    if fmt == FORMAT_LUT8:
+        clut = struct.unpack_from(f"<{clut_count}I", area, clut_start)
+        img.putdata([((c >> 16) & 0xff, (c >> 8) & 0xff, c & 0xff) for c in (clut[i] for i in data)])
+        return img
+
+    # Convert raw RGB565 pixel data
+    pixels = []
+    for color, in struct.iter_unpack('<H', data):
+        red =   int(((color & 0b1111100000000000) >> 11) / 31.0 * 255.0)
+        green = int(((color & 0b0000011111100000) >>  5) / 63.0 * 255.0)
+        blue =  int(((color & 0b0000000000011111)      ) / 31.0 * 255.0)
+        pixels.append((red, green, blue))
+    img.putdata(pixels)
+    return img
+
+
 def get_screenshot(args):
-    # Find address of framebuffer storage location
+    # Find address of the screenshot storage area
     with open(args.elf, "rb") as f:
         elffile = ELFFile(f)
-        fb_address = get_symbol_by_symbol_name(elffile, "framebuffer_capture").entry.st_value
-    
-    buffer_size = 320 * 240 * 2
+        symbol = get_symbol_by_symbol_name(elffile, "screenshot_area")
+        area_address = symbol.entry.st_value
+        area_size = symbol.entry.st_size
 
     with OpenOCD(host=args.host, port=args.port) as ocd:
-        ocd.send(f"dump_image {args.output}.bin {hex(fb_address)} {hex(buffer_size)}; resume; exit")
+        ocd.send(f"dump_image {args.output}.bin {hex(area_address)} {hex(area_size)}; resume; exit")
 
     with open(f"{args.output}.bin", "rb") as fd:
-        data = fd.read()
+        area = fd.read()
 
-    # Convert raw RGB565 pixel data to PNG
-    img = Image.new("RGB", (args.width, args.height))
-    pixels = img.load()
-    index = 0
-    for y in range(0, args.height):
-        for x in range(0, args.width):
-            color, = struct.unpack('<H', data[index:index+2])
-            red =   int(((color & 0b1111100000000000) >> 11) / 31.0 * 255.0)
-            green = int(((color & 0b0000011111100000) >>  5) / 63.0 * 255.0)
-            blue =  int(((color & 0b0000000000011111)      ) / 31.0 * 255.0)
-            pixels[x, y] = (red, green, blue)
-            index += 2
+    screenshots = find_screenshots(area)
+    if not screenshots:
+        print("No screenshot stored")
+        return
 
-    img.save(f"{args.output}.png")
+    if args.all:
+        selected = screenshots
+    elif args.index < len(screenshots):
+        selected = [screenshots[args.index]]
+    else:
+        print(f"Only {len(screenshots)} screenshots stored")
+        return
 
-    print(f"Screenshot saved as {args.output}.png")
+    for screenshot in selected:
+        name = f"{args.output}-{screenshot[0]}" if args.all else args.output
+        try:
+            img = decode(area, screenshot)
+        except Exception as e:
+            # E.g. overwritten in part by a newer one
+            print(f"Screenshot {screenshot[0]} is damaged: {e}")
+            continue
+        img.save(f"{name}.png")
+        print(f"Screenshot saved as {name}.png")
 
 def main():
     parser = argparse.ArgumentParser(description="Grabs the framebuffer and renders it to a video4l2 device")
@@ -64,8 +125,17 @@ def main():
         default=6666,
         help="OpenOCD TCL port",
     )
-    parser.add_argument("--width",  type=int, default=320)
-    parser.add_argument("--height", type=int, default=240)
+    parser.add_argument(
+        "--index",
+        type=int,
+        default=0,
+        help="Which screenshot, 0 is the newest",
+    )
+    parser.add_argument(
+        "--all",
+        action="store_true",
+        help="Save every stored screenshot, numbered",
+    )
     parser.add_argument(
         "--output",
         type=str,